@@ -2028,6 +2028,7 @@ typedef struct {
     BOOL multi_line;
     BOOL ignore_case;
     BOOL is_utf16;
+    int interrupt_counter;
     void *opaque; /* used for stack overflow check */
 
     size_t state_size;
@@ -2074,7 +2075,10 @@ static int push_state(REExecContext *s,
     return 0;
 }
 
-/* return 1 if match, 0 if not match or -1 if error. */
+/* number of backtracking steps between two lre_check_timeout() calls */
+#define INTERRUPT_COUNTER_INIT 100
+
+/* return 1 if match, 0 if not match or LRE_RET_x if error. */
 static intptr_t lre_exec_backtrack(REExecContext *s, uint8_t **capture,
                                    StackInt *stack, int stack_len,
                                    const uint8_t *pc, const uint8_t *cptr,
@@ -2104,6 +2108,11 @@ static intptr_t lre_exec_backtrack(REExecContext *s, uint8_t **capture,
                     return 0;
                 ret = 0;
             recurse:
+                if (--s->interrupt_counter <= 0) {
+                    s->interrupt_counter = INTERRUPT_COUNTER_INIT;
+                    if (lre_check_timeout(s->opaque))
+                        return LRE_RET_TIMEOUT;
+                }
                 for(;;) {
                     if (s->state_stack_len == 0)
                         return ret;
@@ -2194,7 +2203,7 @@ static intptr_t lre_exec_backtrack(REExecContext *s, uint8_t **capture,
                 ret = push_state(s, capture, stack, stack_len,
                                  pc1, cptr, RE_EXEC_STATE_SPLIT, 0);
                 if (ret < 0)
-                    return -1;
+                    return LRE_RET_MEMORY_ERROR;
                 break;
             }
         case REOP_lookahead:
@@ -2206,7 +2215,7 @@ static intptr_t lre_exec_backtrack(REExecContext *s, uint8_t **capture,
                              RE_EXEC_STATE_LOOKAHEAD + opcode - REOP_lookahead,
                              0);
             if (ret < 0)
-                return -1;
+                return LRE_RET_MEMORY_ERROR;
             break;
             
         case REOP_goto:
@@ -2454,7 +2463,8 @@ static intptr_t lre_exec_backtrack(REExecContext *s, uint8_t **capture,
                 for(;;) {
                     res = lre_exec_backtrack(s, capture, stack, stack_len,
                                              pc1, cptr, TRUE);
-                    if (res == -1)
+                    if (res == LRE_RET_MEMORY_ERROR ||
+                        res == LRE_RET_TIMEOUT)
                         return res;
                     if (!res)
                         break;
@@ -2472,7 +2482,7 @@ static intptr_t lre_exec_backtrack(REExecContext *s, uint8_t **capture,
                                      RE_EXEC_STATE_GREEDY_QUANT,
                                      q - quant_min);
                     if (ret < 0)
-                        return -1;
+                        return LRE_RET_MEMORY_ERROR;
                 }
             }
             break;
@@ -2482,9 +2492,9 @@ static intptr_t lre_exec_backtrack(REExecContext *s, uint8_t **capture,
     }
 }
 
-/* Return 1 if match, 0 if not match or -1 if error. cindex is the
-   starting position of the match and must be such as 0 <= cindex <=
-   clen. */
+/* Return 1 if match, 0 if not match or LRE_RET_x if error. cindex is
+   the starting position of the match and must be such as 0 <= cindex
+   <= clen. */
 int lre_exec(uint8_t **capture,
              const uint8_t *bc_buf, const uint8_t *cbuf, int cindex, int clen,
              int cbuf_type, void *opaque)
@@ -2505,6 +2515,7 @@ int lre_exec(uint8_t **capture,
     if (s->cbuf_type == 1 && s->is_utf16)
         s->cbuf_type = 2;
     s->opaque = opaque;
+    s->interrupt_counter = INTERRUPT_COUNTER_INIT;
 
     s->state_size = sizeof(REExecState) +
         s->capture_count * sizeof(capture[0]) * 2 +
@@ -2540,6 +2551,11 @@ BOOL lre_check_stack_overflow(void *opaque, size_t alloca_size)
     return FALSE;
 }
 
+BOOL lre_check_timeout(void *opaque)
+{
+    return FALSE;
+}
+
 void *lre_realloc(void *opaque, void *ptr, size_t size)
 {
     return realloc(ptr, size);
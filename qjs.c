@@ -271,6 +271,7 @@ void help(void)
            "-d  --dump         dump the memory usage stats\n"
            "    --memory-limit n       limit the memory usage to 'n' bytes\n"
            "    --stack-size n         limit the stack size to 'n' bytes\n"
+           "    --cpu-limit n          limit the CPU time to 'n' seconds\n"
            "    --unhandled-rejection  dump unhandled promise rejections\n"
            "-q  --quit         just instantiate the interpreter and quit\n");
     exit(1);
@@ -291,6 +292,7 @@ int main(int argc, char **argv)
     int load_std = 0;
     int dump_unhandled_promise_rejection = 0;
     size_t memory_limit = 0;
+    double cpu_limit = 0;
     char *include_list[32];
     int i, include_count = 0;
 #ifdef CONFIG_BIGNUM
@@ -417,6 +419,14 @@ int main(int argc, char **argv)
                 stack_size = (size_t)strtod(argv[optind++], NULL);
                 continue;
             }
+            if (!strcmp(longopt, "cpu-limit")) {
+                if (optind >= argc) {
+                    fprintf(stderr, "expecting CPU time limit");
+                    exit(1);
+                }
+                cpu_limit = strtod(argv[optind++], NULL);
+                continue;
+            }
             if (opt) {
                 fprintf(stderr, "qjs: unknown option '-%c'\n", opt);
             } else {
@@ -440,7 +450,18 @@ int main(int argc, char **argv)
         JS_SetMemoryLimit(rt, memory_limit);
     if (stack_size != 0)
         JS_SetMaxStackSize(rt, stack_size);
+    if (cpu_limit > 0) {
+        if (JS_SetCPUTimeLimit(rt, (int64_t)(cpu_limit * 1e6)) < 0) {
+            fprintf(stderr, "qjs: CPU time limit not supported\n");
+            exit(2);
+        }
+    }
     js_std_init_handlers(rt);
+    /* when the output is not interactive, use a large buffer so that
+       print() and console.log() are batched in few writes. The event
+       loop flushes it when it becomes idle. */
+    if (!isatty(fileno(stdout)))
+        setvbuf(stdout, NULL, _IOFBF, 64 * 1024);
     ctx = JS_NewContext(rt);
     if (!ctx) {
         fprintf(stderr, "qjs: cannot allocate JS context\n");
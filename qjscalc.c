@@ -0,0 +1,3980 @@
+/* File generated automatically by the QuickJS compiler. */
+
+#include <inttypes.h>
+
+const uint32_t qjsc_qjscalc_size = 31764;
+
+const uint8_t qjsc_qjscalc[31764] = {
+ 0x04, 0xba, 0x02, 0x0e, 0x49, 0x6e, 0x74, 0x65,
+ 0x67, 0x65, 0x72, 0x0a, 0x46, 0x6c, 0x6f, 0x61,
+ 0x74, 0x10, 0x46, 0x72, 0x61, 0x63, 0x74, 0x69,
+ 0x6f, 0x6e, 0x0e, 0x43, 0x6f, 0x6d, 0x70, 0x6c,
+ 0x65, 0x78, 0x06, 0x4d, 0x6f, 0x64, 0x14, 0x50,
+ 0x6f, 0x6c, 0x79, 0x6e, 0x6f, 0x6d, 0x69, 0x61,
+ 0x6c, 0x0e, 0x50, 0x6f, 0x6c, 0x79, 0x4d, 0x6f,
+ 0x64, 0x20, 0x52, 0x61, 0x74, 0x69, 0x6f, 0x6e,
+ 0x61, 0x6c, 0x46, 0x75, 0x6e, 0x63, 0x74, 0x69,
+ 0x6f, 0x6e, 0x0c, 0x53, 0x65, 0x72, 0x69, 0x65,
+ 0x73, 0x0c, 0x4d, 0x61, 0x74, 0x72, 0x69, 0x78,
+ 0x02, 0x49, 0x02, 0x58, 0x02, 0x4f, 0x06, 0x67,
+ 0x63, 0x64, 0x08, 0x66, 0x61, 0x63, 0x74, 0x08,
+ 0x63, 0x6f, 0x6d, 0x62, 0x08, 0x70, 0x6d, 0x6f,
+ 0x64, 0x0c, 0x69, 0x6e, 0x76, 0x6d, 0x6f, 0x64,
+ 0x0c, 0x66, 0x61, 0x63, 0x74, 0x6f, 0x72, 0x0e,
+ 0x69, 0x73, 0x70, 0x72, 0x69, 0x6d, 0x65, 0x12,
+ 0x6e, 0x65, 0x78, 0x74, 0x70, 0x72, 0x69, 0x6d,
+ 0x65, 0x0a, 0x64, 0x65, 0x72, 0x69, 0x76, 0x0a,
+ 0x69, 0x6e, 0x74, 0x65, 0x67, 0x0a, 0x6e, 0x6f,
+ 0x72, 0x6d, 0x32, 0x06, 0x61, 0x62, 0x73, 0x08,
+ 0x63, 0x6f, 0x6e, 0x6a, 0x06, 0x61, 0x72, 0x67,
+ 0x0e, 0x69, 0x6e, 0x76, 0x65, 0x72, 0x73, 0x65,
+ 0x0a, 0x74, 0x72, 0x75, 0x6e, 0x63, 0x0a, 0x66,
+ 0x6c, 0x6f, 0x6f, 0x72, 0x08, 0x63, 0x65, 0x69,
+ 0x6c, 0x08, 0x73, 0x71, 0x72, 0x74, 0x06, 0x65,
+ 0x78, 0x70, 0x06, 0x6c, 0x6f, 0x67, 0x08, 0x6c,
+ 0x6f, 0x67, 0x32, 0x0a, 0x6c, 0x6f, 0x67, 0x31,
+ 0x30, 0x08, 0x74, 0x6f, 0x64, 0x62, 0x0c, 0x66,
+ 0x72, 0x6f, 0x6d, 0x64, 0x62, 0x06, 0x73, 0x69,
+ 0x6e, 0x06, 0x63, 0x6f, 0x73, 0x06, 0x74, 0x61,
+ 0x6e, 0x08, 0x61, 0x73, 0x69, 0x6e, 0x08, 0x61,
+ 0x63, 0x6f, 0x73, 0x08, 0x61, 0x74, 0x61, 0x6e,
+ 0x0a, 0x61, 0x74, 0x61, 0x6e, 0x32, 0x08, 0x73,
+ 0x69, 0x6e, 0x63, 0x0a, 0x74, 0x6f, 0x64, 0x65,
+ 0x67, 0x0e, 0x66, 0x72, 0x6f, 0x6d, 0x64, 0x65,
+ 0x67, 0x08, 0x73, 0x69, 0x6e, 0x68, 0x08, 0x63,
+ 0x6f, 0x73, 0x68, 0x08, 0x74, 0x61, 0x6e, 0x68,
+ 0x0a, 0x61, 0x73, 0x69, 0x6e, 0x68, 0x0a, 0x61,
+ 0x63, 0x6f, 0x73, 0x68, 0x0a, 0x61, 0x74, 0x61,
+ 0x6e, 0x68, 0x06, 0x69, 0x64, 0x6e, 0x08, 0x64,
+ 0x69, 0x61, 0x67, 0x0a, 0x74, 0x72, 0x61, 0x6e,
+ 0x73, 0x0a, 0x74, 0x72, 0x61, 0x63, 0x65, 0x10,
+ 0x63, 0x68, 0x61, 0x72, 0x70, 0x6f, 0x6c, 0x79,
+ 0x12, 0x65, 0x69, 0x67, 0x65, 0x6e, 0x76, 0x61,
+ 0x6c, 0x73, 0x06, 0x64, 0x65, 0x74, 0x08, 0x72,
+ 0x61, 0x6e, 0x6b, 0x06, 0x6b, 0x65, 0x72, 0x04,
+ 0x63, 0x70, 0x04, 0x64, 0x70, 0x10, 0x70, 0x6f,
+ 0x6c, 0x72, 0x6f, 0x6f, 0x74, 0x73, 0x10, 0x62,
+ 0x65, 0x73, 0x74, 0x61, 0x70, 0x70, 0x72, 0x14,
+ 0x75, 0x73, 0x65, 0x20, 0x73, 0x74, 0x72, 0x69,
+ 0x63, 0x74, 0x10, 0x75, 0x73, 0x65, 0x20, 0x6d,
+ 0x61, 0x74, 0x68, 0x04, 0x50, 0x49, 0x0e, 0x69,
+ 0x73, 0x50, 0x72, 0x69, 0x6d, 0x65, 0x12, 0x6e,
+ 0x65, 0x78, 0x74, 0x50, 0x72, 0x69, 0x6d, 0x65,
+ 0x0a, 0x72, 0x6f, 0x6f, 0x74, 0x73, 0x14, 0x71,
+ 0x6a, 0x73, 0x63, 0x61, 0x6c, 0x63, 0x2e, 0x6a,
+ 0x73, 0x12, 0x61, 0x64, 0x64, 0x5f, 0x70, 0x72,
+ 0x6f, 0x70, 0x73, 0x1a, 0x6f, 0x70, 0x65, 0x72,
+ 0x61, 0x74, 0x6f, 0x72, 0x73, 0x5f, 0x73, 0x65,
+ 0x74, 0x16, 0x67, 0x65, 0x6e, 0x65, 0x72, 0x69,
+ 0x63, 0x5f, 0x70, 0x6f, 0x77, 0x18, 0x73, 0x6d,
+ 0x61, 0x6c, 0x6c, 0x5f, 0x70, 0x72, 0x69, 0x6d,
+ 0x65, 0x73, 0x22, 0x6d, 0x69, 0x6c, 0x6c, 0x65,
+ 0x72, 0x5f, 0x72, 0x61, 0x62, 0x69, 0x6e, 0x5f,
+ 0x74, 0x65, 0x73, 0x74, 0x10, 0x66, 0x61, 0x63,
+ 0x74, 0x5f, 0x72, 0x65, 0x63, 0x18, 0x66, 0x72,
+ 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x61,
+ 0x64, 0x64, 0x18, 0x66, 0x72, 0x61, 0x63, 0x74,
+ 0x69, 0x6f, 0x6e, 0x5f, 0x73, 0x75, 0x62, 0x18,
+ 0x66, 0x72, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e,
+ 0x5f, 0x6d, 0x75, 0x6c, 0x18, 0x66, 0x72, 0x61,
+ 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x64, 0x69,
+ 0x76, 0x18, 0x66, 0x72, 0x61, 0x63, 0x74, 0x69,
+ 0x6f, 0x6e, 0x5f, 0x6d, 0x6f, 0x64, 0x16, 0x66,
+ 0x72, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x5f,
+ 0x65, 0x71, 0x16, 0x66, 0x72, 0x61, 0x63, 0x74,
+ 0x69, 0x6f, 0x6e, 0x5f, 0x6c, 0x74, 0x12, 0x66,
+ 0x6c, 0x6f, 0x61, 0x74, 0x5f, 0x61, 0x64, 0x64,
+ 0x12, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x5f, 0x73,
+ 0x75, 0x62, 0x12, 0x66, 0x6c, 0x6f, 0x61, 0x74,
+ 0x5f, 0x6d, 0x75, 0x6c, 0x12, 0x66, 0x6c, 0x6f,
+ 0x61, 0x74, 0x5f, 0x64, 0x69, 0x76, 0x12, 0x66,
+ 0x6c, 0x6f, 0x61, 0x74, 0x5f, 0x6d, 0x6f, 0x64,
+ 0x12, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x5f, 0x70,
+ 0x6f, 0x77, 0x10, 0x66, 0x6c, 0x6f, 0x61, 0x74,
+ 0x5f, 0x65, 0x71, 0x10, 0x66, 0x6c, 0x6f, 0x61,
+ 0x74, 0x5f, 0x6c, 0x74, 0x12, 0x63, 0x6f, 0x6e,
+ 0x73, 0x74, 0x5f, 0x74, 0x61, 0x62, 0x12, 0x67,
+ 0x65, 0x74, 0x5f, 0x63, 0x6f, 0x6e, 0x73, 0x74,
+ 0x16, 0x63, 0x6f, 0x6d, 0x70, 0x6c, 0x65, 0x78,
+ 0x5f, 0x61, 0x64, 0x64, 0x16, 0x63, 0x6f, 0x6d,
+ 0x70, 0x6c, 0x65, 0x78, 0x5f, 0x73, 0x75, 0x62,
+ 0x16, 0x63, 0x6f, 0x6d, 0x70, 0x6c, 0x65, 0x78,
+ 0x5f, 0x6d, 0x75, 0x6c, 0x16, 0x63, 0x6f, 0x6d,
+ 0x70, 0x6c, 0x65, 0x78, 0x5f, 0x64, 0x69, 0x76,
+ 0x14, 0x63, 0x6f, 0x6d, 0x70, 0x6c, 0x65, 0x78,
+ 0x5f, 0x65, 0x71, 0x0e, 0x6d, 0x6f, 0x64, 0x5f,
+ 0x61, 0x64, 0x64, 0x0e, 0x6d, 0x6f, 0x64, 0x5f,
+ 0x73, 0x75, 0x62, 0x0e, 0x6d, 0x6f, 0x64, 0x5f,
+ 0x6d, 0x75, 0x6c, 0x0e, 0x6d, 0x6f, 0x64, 0x5f,
+ 0x64, 0x69, 0x76, 0x0c, 0x6d, 0x6f, 0x64, 0x5f,
+ 0x65, 0x71, 0x28, 0x70, 0x6f, 0x6c, 0x79, 0x6e,
+ 0x6f, 0x6d, 0x69, 0x61, 0x6c, 0x5f, 0x69, 0x73,
+ 0x5f, 0x73, 0x63, 0x61, 0x6c, 0x61, 0x72, 0x22,
+ 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x5f, 0x6e,
+ 0x65, 0x65, 0x64, 0x5f, 0x70, 0x61, 0x72, 0x65,
+ 0x6e, 0x22, 0x6d, 0x6f, 0x6e, 0x6f, 0x6d, 0x69,
+ 0x61, 0x6c, 0x5f, 0x74, 0x6f, 0x53, 0x74, 0x72,
+ 0x69, 0x6e, 0x67, 0x26, 0x70, 0x6f, 0x6c, 0x79,
+ 0x5f, 0x72, 0x6f, 0x6f, 0x74, 0x5f, 0x6c, 0x61,
+ 0x67, 0x75, 0x65, 0x72, 0x72, 0x65, 0x31, 0x14,
+ 0x70, 0x6f, 0x6c, 0x79, 0x5f, 0x72, 0x6f, 0x6f,
+ 0x74, 0x73, 0x1c, 0x70, 0x6f, 0x6c, 0x79, 0x6e,
+ 0x6f, 0x6d, 0x69, 0x61, 0x6c, 0x5f, 0x61, 0x64,
+ 0x64, 0x1c, 0x70, 0x6f, 0x6c, 0x79, 0x6e, 0x6f,
+ 0x6d, 0x69, 0x61, 0x6c, 0x5f, 0x73, 0x75, 0x62,
+ 0x1c, 0x70, 0x6f, 0x6c, 0x79, 0x6e, 0x6f, 0x6d,
+ 0x69, 0x61, 0x6c, 0x5f, 0x6d, 0x75, 0x6c, 0x2a,
+ 0x70, 0x6f, 0x6c, 0x79, 0x6e, 0x6f, 0x6d, 0x69,
+ 0x61, 0x6c, 0x5f, 0x64, 0x69, 0x76, 0x5f, 0x73,
+ 0x63, 0x61, 0x6c, 0x61, 0x72, 0x1c, 0x70, 0x6f,
+ 0x6c, 0x79, 0x6e, 0x6f, 0x6d, 0x69, 0x61, 0x6c,
+ 0x5f, 0x64, 0x69, 0x76, 0x1c, 0x70, 0x6f, 0x6c,
+ 0x79, 0x6e, 0x6f, 0x6d, 0x69, 0x61, 0x6c, 0x5f,
+ 0x6d, 0x6f, 0x64, 0x1a, 0x70, 0x6f, 0x6c, 0x79,
+ 0x6e, 0x6f, 0x6d, 0x69, 0x61, 0x6c, 0x5f, 0x65,
+ 0x71, 0x16, 0x70, 0x6f, 0x6c, 0x79, 0x6d, 0x6f,
+ 0x64, 0x5f, 0x61, 0x64, 0x64, 0x16, 0x70, 0x6f,
+ 0x6c, 0x79, 0x6d, 0x6f, 0x64, 0x5f, 0x73, 0x75,
+ 0x62, 0x16, 0x70, 0x6f, 0x6c, 0x79, 0x6d, 0x6f,
+ 0x64, 0x5f, 0x6d, 0x75, 0x6c, 0x16, 0x70, 0x6f,
+ 0x6c, 0x79, 0x6d, 0x6f, 0x64, 0x5f, 0x64, 0x69,
+ 0x76, 0x14, 0x70, 0x6f, 0x6c, 0x79, 0x6d, 0x6f,
+ 0x64, 0x5f, 0x65, 0x71, 0x16, 0x72, 0x61, 0x74,
+ 0x66, 0x75, 0x6e, 0x63, 0x5f, 0x61, 0x64, 0x64,
+ 0x16, 0x72, 0x61, 0x74, 0x66, 0x75, 0x6e, 0x63,
+ 0x5f, 0x73, 0x75, 0x62, 0x16, 0x72, 0x61, 0x74,
+ 0x66, 0x75, 0x6e, 0x63, 0x5f, 0x6d, 0x75, 0x6c,
+ 0x16, 0x72, 0x61, 0x74, 0x66, 0x75, 0x6e, 0x63,
+ 0x5f, 0x64, 0x69, 0x76, 0x14, 0x72, 0x61, 0x74,
+ 0x66, 0x75, 0x6e, 0x63, 0x5f, 0x65, 0x71, 0x10,
+ 0x67, 0x65, 0x74, 0x5f, 0x65, 0x6d, 0x69, 0x6e,
+ 0x3c, 0x73, 0x65, 0x72, 0x69, 0x65, 0x73, 0x5f,
+ 0x69, 0x73, 0x5f, 0x73, 0x63, 0x61, 0x6c, 0x61,
+ 0x72, 0x5f, 0x6f, 0x72, 0x5f, 0x70, 0x6f, 0x6c,
+ 0x79, 0x6e, 0x6f, 0x6d, 0x69, 0x61, 0x6c, 0x14,
+ 0x73, 0x65, 0x72, 0x69, 0x65, 0x73, 0x5f, 0x61,
+ 0x64, 0x64, 0x14, 0x73, 0x65, 0x72, 0x69, 0x65,
+ 0x73, 0x5f, 0x73, 0x75, 0x62, 0x14, 0x73, 0x65,
+ 0x72, 0x69, 0x65, 0x73, 0x5f, 0x6d, 0x75, 0x6c,
+ 0x14, 0x73, 0x65, 0x72, 0x69, 0x65, 0x73, 0x5f,
+ 0x64, 0x69, 0x76, 0x14, 0x73, 0x65, 0x72, 0x69,
+ 0x65, 0x73, 0x5f, 0x70, 0x6f, 0x77, 0x12, 0x73,
+ 0x65, 0x72, 0x69, 0x65, 0x73, 0x5f, 0x65, 0x71,
+ 0x12, 0x61, 0x72, 0x72, 0x61, 0x79, 0x5f, 0x61,
+ 0x64, 0x64, 0x12, 0x61, 0x72, 0x72, 0x61, 0x79,
+ 0x5f, 0x73, 0x75, 0x62, 0x20, 0x61, 0x72, 0x72,
+ 0x61, 0x79, 0x5f, 0x73, 0x63, 0x61, 0x6c, 0x61,
+ 0x72, 0x5f, 0x6d, 0x75, 0x6c, 0x12, 0x61, 0x72,
+ 0x72, 0x61, 0x79, 0x5f, 0x6d, 0x75, 0x6c, 0x12,
+ 0x61, 0x72, 0x72, 0x61, 0x79, 0x5f, 0x64, 0x69,
+ 0x76, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x5f,
+ 0x73, 0x63, 0x61, 0x6c, 0x61, 0x72, 0x5f, 0x64,
+ 0x69, 0x76, 0x10, 0x61, 0x72, 0x72, 0x61, 0x79,
+ 0x5f, 0x65, 0x71, 0x1a, 0x61, 0x6c, 0x67, 0x65,
+ 0x62, 0x72, 0x61, 0x69, 0x63, 0x4d, 0x6f, 0x64,
+ 0x65, 0x2a, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65,
+ 0x42, 0x69, 0x67, 0x49, 0x6e, 0x74, 0x4f, 0x70,
+ 0x65, 0x72, 0x61, 0x74, 0x6f, 0x72, 0x73, 0x02,
+ 0x2f, 0x04, 0x2a, 0x2a, 0x12, 0x69, 0x73, 0x49,
+ 0x6e, 0x74, 0x65, 0x67, 0x65, 0x72, 0x02, 0x2b,
+ 0x02, 0x2d, 0x02, 0x25, 0x04, 0x3d, 0x3d, 0x02,
+ 0x3c, 0x06, 0x70, 0x6f, 0x73, 0x06, 0x6e, 0x65,
+ 0x67, 0x08, 0x6c, 0x65, 0x66, 0x74, 0x0a, 0x72,
+ 0x69, 0x67, 0x68, 0x74, 0x14, 0x74, 0x6f, 0x46,
+ 0x72, 0x61, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x16,
+ 0x74, 0x6f, 0x50, 0x72, 0x69, 0x6d, 0x69, 0x74,
+ 0x69, 0x76, 0x65, 0x0e, 0x69, 0x73, 0x46, 0x6c,
+ 0x6f, 0x61, 0x74, 0x02, 0x45, 0x08, 0x4c, 0x4e,
+ 0x31, 0x30, 0x0a, 0x4c, 0x4f, 0x47, 0x32, 0x45,
+ 0x0c, 0x4c, 0x4f, 0x47, 0x31, 0x30, 0x45, 0x0e,
+ 0x53, 0x51, 0x52, 0x54, 0x31, 0x5f, 0x32, 0x0a,
+ 0x53, 0x51, 0x52, 0x54, 0x32, 0x12, 0x74, 0x6f,
+ 0x43, 0x6f, 0x6d, 0x70, 0x6c, 0x65, 0x78, 0x08,
+ 0x74, 0x72, 0x69, 0x6d, 0x06, 0x64, 0x65, 0x67,
+ 0x0c, 0x64, 0x69, 0x76, 0x72, 0x65, 0x6d, 0x24,
+ 0x74, 0x6f, 0x52, 0x61, 0x74, 0x69, 0x6f, 0x6e,
+ 0x61, 0x6c, 0x46, 0x75, 0x6e, 0x63, 0x74, 0x69,
+ 0x6f, 0x6e, 0x08, 0x7a, 0x65, 0x72, 0x6f, 0x0e,
+ 0x68, 0x69, 0x6c, 0x62, 0x65, 0x72, 0x74, 0x18,
+ 0x63, 0x68, 0x65, 0x63, 0x6b, 0x5f, 0x73, 0x71,
+ 0x75, 0x61, 0x72, 0x65, 0x06, 0x64, 0x75, 0x70,
+ 0x06, 0x6f, 0x62, 0x6a, 0x0a, 0x70, 0x72, 0x6f,
+ 0x70, 0x73, 0x02, 0x69, 0x06, 0x76, 0x61, 0x6c,
+ 0x08, 0x70, 0x72, 0x6f, 0x70, 0x06, 0x74, 0x61,
+ 0x62, 0x08, 0x64, 0x65, 0x73, 0x63, 0x0e, 0x52,
+ 0x65, 0x66, 0x6c, 0x65, 0x63, 0x74, 0x0a, 0x70,
+ 0x72, 0x6f, 0x74, 0x6f, 0x0e, 0x6f, 0x70, 0x5f,
+ 0x6c, 0x69, 0x73, 0x74, 0x16, 0x6e, 0x65, 0x77,
+ 0x5f, 0x6f, 0x70, 0x5f, 0x6c, 0x69, 0x73, 0x74,
+ 0x02, 0x61, 0x02, 0x6a, 0x02, 0x62, 0x02, 0x6b,
+ 0x0c, 0x66, 0x69, 0x65, 0x6c, 0x64, 0x73, 0x0e,
+ 0x69, 0x73, 0x41, 0x72, 0x72, 0x61, 0x79, 0x0c,
+ 0x61, 0x73, 0x73, 0x69, 0x67, 0x6e, 0x08, 0x70,
+ 0x75, 0x73, 0x68, 0x16, 0x6f, 0x70, 0x65, 0x72,
+ 0x61, 0x74, 0x6f, 0x72, 0x53, 0x65, 0x74, 0x0c,
+ 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x08, 0x63,
+ 0x61, 0x6c, 0x6c, 0x02, 0x72, 0x0c, 0x69, 0x73,
+ 0x5f, 0x6e, 0x65, 0x67, 0x12, 0x66, 0x6c, 0x6f,
+ 0x6f, 0x72, 0x4c, 0x6f, 0x67, 0x32, 0x5e, 0x6e,
+ 0x65, 0x67, 0x61, 0x74, 0x69, 0x76, 0x65, 0x20,
+ 0x70, 0x6f, 0x77, 0x65, 0x72, 0x73, 0x20, 0x61,
+ 0x72, 0x65, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x73,
+ 0x75, 0x70, 0x70, 0x6f, 0x72, 0x74, 0x65, 0x64,
+ 0x20, 0x66, 0x6f, 0x72, 0x20, 0x74, 0x68, 0x69,
+ 0x73, 0x20, 0x74, 0x79, 0x70, 0x65, 0x02, 0x6e,
+ 0x02, 0x74, 0x02, 0x64, 0x02, 0x73, 0x1a, 0x69,
+ 0x73, 0x53, 0x61, 0x66, 0x65, 0x49, 0x6e, 0x74,
+ 0x65, 0x67, 0x65, 0x72, 0x08, 0x74, 0x64, 0x69,
+ 0x76, 0x02, 0x78, 0x02, 0x79, 0x02, 0x71, 0x02,
+ 0x75, 0x02, 0x76, 0x02, 0x63, 0x0e, 0x66, 0x64,
+ 0x69, 0x76, 0x72, 0x65, 0x6d, 0x1c, 0x6e, 0x6f,
+ 0x74, 0x20, 0x69, 0x6e, 0x76, 0x65, 0x72, 0x74,
+ 0x69, 0x62, 0x6c, 0x65, 0x02, 0x6d, 0x04, 0x6e,
+ 0x31, 0x18, 0x69, 0x6e, 0x76, 0x61, 0x6c, 0x69,
+ 0x64, 0x20, 0x74, 0x79, 0x70, 0x65, 0x22, 0x6e,
+ 0x6f, 0x74, 0x20, 0x61, 0x20, 0x63, 0x6f, 0x6e,
+ 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x6f, 0x72,
+ 0x20, 0x69, 0x6e, 0x74, 0x65, 0x67, 0x65, 0x72,
+ 0x20, 0x65, 0x78, 0x70, 0x65, 0x63, 0x74, 0x65,
+ 0x64, 0x20, 0x64, 0x69, 0x76, 0x69, 0x73, 0x69,
+ 0x6f, 0x6e, 0x20, 0x62, 0x79, 0x20, 0x7a, 0x65,
+ 0x72, 0x6f, 0x06, 0x6e, 0x75, 0x6d, 0x06, 0x64,
+ 0x65, 0x6e, 0x04, 0x61, 0x31, 0x04, 0x62, 0x31,
+ 0x08, 0x65, 0x64, 0x69, 0x76, 0x0a, 0x69, 0x73,
+ 0x4e, 0x61, 0x4e, 0x08, 0x68, 0x69, 0x6e, 0x74,
+ 0x02, 0x70, 0x08, 0x70, 0x72, 0x65, 0x63, 0x08,
+ 0x6e, 0x75, 0x6d, 0x31, 0x08, 0x6e, 0x75, 0x6d,
+ 0x30, 0x08, 0x64, 0x65, 0x6e, 0x31, 0x08, 0x64,
+ 0x65, 0x6e, 0x30, 0x30, 0x73, 0x65, 0x63, 0x6f,
+ 0x6e, 0x64, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6d,
+ 0x65, 0x6e, 0x74, 0x20, 0x65, 0x78, 0x70, 0x65,
+ 0x63, 0x74, 0x65, 0x64, 0x04, 0x72, 0x65, 0x04,
+ 0x69, 0x6d, 0x04, 0x2d, 0x49, 0x04, 0x2a, 0x49,
+ 0x32, 0x74, 0x68, 0x65, 0x20, 0x6d, 0x6f, 0x64,
+ 0x75, 0x6c, 0x6f, 0x20, 0x63, 0x61, 0x6e, 0x6e,
+ 0x6f, 0x74, 0x20, 0x62, 0x65, 0x20, 0x3c, 0x3d,
+ 0x20, 0x30, 0x1a, 0x69, 0x6e, 0x76, 0x61, 0x6c,
+ 0x69, 0x64, 0x20, 0x74, 0x79, 0x70, 0x65, 0x73,
+ 0x06, 0x72, 0x65, 0x73, 0x06, 0x6d, 0x6f, 0x64,
+ 0x48, 0x64, 0x69, 0x66, 0x66, 0x65, 0x72, 0x65,
+ 0x6e, 0x74, 0x20, 0x6d, 0x6f, 0x64, 0x75, 0x6c,
+ 0x6f, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x62, 0x69,
+ 0x6e, 0x61, 0x72, 0x79, 0x20, 0x6f, 0x70, 0x65,
+ 0x72, 0x61, 0x74, 0x6f, 0x72, 0x20, 0x75, 0x6e,
+ 0x73, 0x75, 0x70, 0x70, 0x6f, 0x72, 0x74, 0x65,
+ 0x64, 0x20, 0x74, 0x79, 0x70, 0x65, 0x08, 0x4d,
+ 0x6f, 0x64, 0x28, 0x02, 0x2c, 0x02, 0x29, 0x08,
+ 0x73, 0x74, 0x72, 0x31, 0x02, 0x28, 0x02, 0x5e,
+ 0x02, 0x7a, 0x0c, 0x6d, 0x61, 0x78, 0x5f, 0x69,
+ 0x74, 0x04, 0x70, 0x31, 0x04, 0x70, 0x32, 0x04,
+ 0x7a, 0x30, 0x04, 0x7a, 0x31, 0x04, 0x7a, 0x32,
+ 0x04, 0x74, 0x30, 0x04, 0x74, 0x31, 0x04, 0x64,
+ 0x31, 0x04, 0x64, 0x32, 0x02, 0x65, 0x04, 0x65,
+ 0x6c, 0x04, 0x7a, 0x6c, 0x06, 0x65, 0x70, 0x73,
+ 0x18, 0x73, 0x74, 0x61, 0x72, 0x74, 0x5f, 0x70,
+ 0x6f, 0x69, 0x6e, 0x74, 0x73, 0x26, 0x70, 0x6f,
+ 0x6c, 0x79, 0x6e, 0x6f, 0x6d, 0x69, 0x61, 0x6c,
+ 0x20, 0x65, 0x78, 0x70, 0x65, 0x63, 0x74, 0x65,
+ 0x64, 0x3e, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x20,
+ 0x69, 0x6e, 0x20, 0x72, 0x6f, 0x6f, 0x74, 0x20,
+ 0x66, 0x69, 0x6e, 0x64, 0x69, 0x6e, 0x67, 0x20,
+ 0x61, 0x6c, 0x67, 0x6f, 0x72, 0x69, 0x74, 0x68,
+ 0x6d, 0x06, 0x73, 0x74, 0x72, 0x10, 0x49, 0x6e,
+ 0x66, 0x69, 0x6e, 0x69, 0x74, 0x79, 0x06, 0x74,
+ 0x6d, 0x70, 0x04, 0x6e, 0x32, 0x48, 0x74, 0x68,
+ 0x65, 0x20, 0x6d, 0x6f, 0x64, 0x75, 0x6c, 0x6f,
+ 0x20, 0x63, 0x61, 0x6e, 0x6e, 0x6f, 0x74, 0x20,
+ 0x68, 0x61, 0x76, 0x65, 0x20, 0x61, 0x20, 0x64,
+ 0x65, 0x67, 0x72, 0x65, 0x65, 0x20, 0x3c, 0x3d,
+ 0x20, 0x30, 0x10, 0x50, 0x6f, 0x6c, 0x79, 0x4d,
+ 0x6f, 0x64, 0x28, 0x04, 0x2f, 0x28, 0x08, 0x65,
+ 0x6d, 0x69, 0x6e, 0x06, 0x6d, 0x69, 0x6e, 0x04,
+ 0x76, 0x31, 0x04, 0x76, 0x32, 0x0e, 0x76, 0x32,
+ 0x5f, 0x65, 0x6d, 0x69, 0x6e, 0x04, 0x63, 0x31,
+ 0x04, 0x63, 0x32, 0x06, 0x73, 0x75, 0x6d, 0x04,
+ 0x4f, 0x28, 0x12, 0x52, 0x61, 0x6e, 0x67, 0x45,
+ 0x72, 0x72, 0x6f, 0x72, 0x36, 0x63, 0x61, 0x6e,
+ 0x6e, 0x6f, 0x74, 0x20, 0x72, 0x65, 0x70, 0x72,
+ 0x65, 0x73, 0x65, 0x6e, 0x74, 0x20, 0x69, 0x6e,
+ 0x74, 0x65, 0x67, 0x28, 0x31, 0x2f, 0x58, 0x29,
+ 0x30, 0x6e, 0x65, 0x67, 0x61, 0x74, 0x69, 0x76,
+ 0x65, 0x20, 0x65, 0x78, 0x70, 0x6f, 0x6e, 0x65,
+ 0x6e, 0x74, 0x20, 0x69, 0x6e, 0x20, 0x65, 0x78,
+ 0x70, 0x0a, 0x52, 0x61, 0x6e, 0x67, 0x65, 0x5e,
+ 0x6c, 0x6f, 0x67, 0x20, 0x61, 0x72, 0x67, 0x75,
+ 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x6d, 0x75, 0x73,
+ 0x74, 0x20, 0x68, 0x61, 0x76, 0x65, 0x20, 0x61,
+ 0x20, 0x6e, 0x6f, 0x6e, 0x20, 0x7a, 0x65, 0x72,
+ 0x6f, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61,
+ 0x6e, 0x74, 0x20, 0x74, 0x65, 0x72, 0x6d, 0x0c,
+ 0x45, 0x72, 0x72, 0x6f, 0x72, 0x4f, 0x28, 0x69,
+ 0x6e, 0x76, 0x61, 0x6c, 0x69, 0x64, 0x20, 0x4f,
+ 0x28, 0x29, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6d,
+ 0x65, 0x6e, 0x74, 0x02, 0x68, 0x02, 0x77, 0x04,
+ 0x72, 0x6c, 0x1e, 0x6d, 0x61, 0x74, 0x72, 0x69,
+ 0x78, 0x20, 0x65, 0x78, 0x70, 0x65, 0x63, 0x74,
+ 0x65, 0x64, 0x1c, 0x61, 0x72, 0x72, 0x61, 0x79,
+ 0x20, 0x65, 0x78, 0x70, 0x65, 0x63, 0x74, 0x65,
+ 0x64, 0x2c, 0x73, 0x71, 0x75, 0x61, 0x72, 0x65,
+ 0x20, 0x6d, 0x61, 0x74, 0x72, 0x69, 0x78, 0x20,
+ 0x65, 0x78, 0x70, 0x65, 0x63, 0x74, 0x65, 0x64,
+ 0x08, 0x63, 0x6f, 0x65, 0x66, 0x06, 0x73, 0x72,
+ 0x63, 0x06, 0x64, 0x73, 0x74, 0x30, 0x6d, 0x61,
+ 0x74, 0x72, 0x69, 0x78, 0x20, 0x69, 0x73, 0x20,
+ 0x6e, 0x6f, 0x74, 0x20, 0x69, 0x6e, 0x76, 0x65,
+ 0x72, 0x74, 0x69, 0x62, 0x6c, 0x65, 0x02, 0x6c,
+ 0x0e, 0x69, 0x6d, 0x5f, 0x63, 0x6f, 0x6c, 0x73,
+ 0x0e, 0x6b, 0x65, 0x72, 0x5f, 0x64, 0x69, 0x6d,
+ 0x32, 0x69, 0x6e, 0x63, 0x6f, 0x6d, 0x70, 0x61,
+ 0x74, 0x69, 0x62, 0x6c, 0x65, 0x20, 0x61, 0x72,
+ 0x72, 0x61, 0x79, 0x20, 0x6c, 0x65, 0x6e, 0x67,
+ 0x74, 0x68, 0x38, 0x76, 0x65, 0x63, 0x74, 0x6f,
+ 0x72, 0x73, 0x20, 0x6d, 0x75, 0x73, 0x74, 0x20,
+ 0x68, 0x61, 0x76, 0x65, 0x20, 0x33, 0x20, 0x65,
+ 0x6c, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x73, 0x2e,
+ 0x69, 0x6e, 0x63, 0x6f, 0x6d, 0x70, 0x61, 0x74,
+ 0x69, 0x62, 0x6c, 0x65, 0x20, 0x61, 0x72, 0x72,
+ 0x61, 0x79, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x0a,
+ 0x61, 0x5f, 0x6d, 0x61, 0x74, 0x0a, 0x62, 0x5f,
+ 0x6d, 0x61, 0x74, 0x30, 0x69, 0x6e, 0x63, 0x6f,
+ 0x6d, 0x70, 0x61, 0x74, 0x69, 0x62, 0x6c, 0x65,
+ 0x20, 0x6d, 0x61, 0x74, 0x72, 0x69, 0x78, 0x20,
+ 0x73, 0x69, 0x7a, 0x65, 0x08, 0x66, 0x64, 0x69,
+ 0x76, 0x08, 0x63, 0x64, 0x69, 0x76, 0x0e, 0x00,
+ 0x06, 0x05, 0xa0, 0x01, 0x00, 0x02, 0x00, 0x06,
+ 0x00, 0x23, 0xfb, 0x0a, 0x02, 0xa2, 0x01, 0x00,
+ 0x00, 0x00, 0x10, 0x00, 0x01, 0x00, 0x08, 0xce,
+ 0x3f, 0xe2, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xe3,
+ 0x00, 0x00, 0x00, 0x00, 0x3f, 0xe4, 0x00, 0x00,
+ 0x00, 0x00, 0x3f, 0xe5, 0x00, 0x00, 0x00, 0x00,
+ 0x3f, 0xe6, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xe7,
+ 0x00, 0x00, 0x00, 0x00, 0x3f, 0xe8, 0x00, 0x00,
+ 0x00, 0x00, 0x3f, 0xe9, 0x00, 0x00, 0x00, 0x00,
+ 0x3f, 0xea, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xeb,
+ 0x00, 0x00, 0x00, 0x00, 0x3f, 0xec, 0x00, 0x00,
+ 0x00, 0x00, 0x3f, 0xed, 0x00, 0x00, 0x00, 0x00,
+ 0x3f, 0xee, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xef,
+ 0x00, 0x00, 0x00, 0x00, 0x3f, 0xf0, 0x00, 0x00,
+ 0x00, 0x00, 0x3f, 0xf1, 0x00, 0x00, 0x00, 0x00,
+ 0x3f, 0xf2, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xf3,
+ 0x00, 0x00, 0x00, 0x00, 0x3f, 0xf4, 0x00, 0x00,
+ 0x00, 0x00, 0x3f, 0xf5, 0x00, 0x00, 0x00, 0x00,
+ 0x3f, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xf7,
+ 0x00, 0x00, 0x00, 0x40, 0x3f, 0xf8, 0x00, 0x00,
+ 0x00, 0x40, 0x3f, 0xf9, 0x00, 0x00, 0x00, 0x40,
+ 0x3f, 0xfa, 0x00, 0x00, 0x00, 0x40, 0x3f, 0xfb,
+ 0x00, 0x00, 0x00, 0x40, 0x3f, 0xfc, 0x00, 0x00,
+ 0x00, 0x40, 0x3f, 0xfd, 0x00, 0x00, 0x00, 0x40,
+ 0x3f, 0xfe, 0x00, 0x00, 0x00, 0x40, 0x3f, 0xff,
+ 0x00, 0x00, 0x00, 0x40, 0x3f, 0x00, 0x01, 0x00,
+ 0x00, 0x40, 0x3f, 0x01, 0x01, 0x00, 0x00, 0x40,
+ 0x3f, 0x02, 0x01, 0x00, 0x00, 0x40, 0x3f, 0x03,
+ 0x01, 0x00, 0x00, 0x40, 0x3f, 0x04, 0x01, 0x00,
+ 0x00, 0x40, 0x3f, 0x05, 0x01, 0x00, 0x00, 0x40,
+ 0x3f, 0x06, 0x01, 0x00, 0x00, 0x40, 0x3f, 0x07,
+ 0x01, 0x00, 0x00, 0x40, 0x3f, 0x08, 0x01, 0x00,
+ 0x00, 0x40, 0x3f, 0x09, 0x01, 0x00, 0x00, 0x40,
+ 0x3f, 0x0a, 0x01, 0x00, 0x00, 0x40, 0x3f, 0x0b,
+ 0x01, 0x00, 0x00, 0x40, 0x3f, 0x0c, 0x01, 0x00,
+ 0x00, 0x40, 0x3f, 0x0d, 0x01, 0x00, 0x00, 0x40,
+ 0x3f, 0x0e, 0x01, 0x00, 0x00, 0x40, 0x3f, 0x0f,
+ 0x01, 0x00, 0x00, 0x40, 0x3f, 0x10, 0x01, 0x00,
+ 0x00, 0x40, 0x3f, 0x11, 0x01, 0x00, 0x00, 0x40,
+ 0x3f, 0x12, 0x01, 0x00, 0x00, 0x40, 0x3f, 0x13,
+ 0x01, 0x00, 0x00, 0x40, 0x3f, 0x14, 0x01, 0x00,
+ 0x00, 0x40, 0x3f, 0x15, 0x01, 0x00, 0x00, 0x40,
+ 0x3f, 0x16, 0x01, 0x00, 0x00, 0x40, 0x3f, 0x17,
+ 0x01, 0x00, 0x00, 0x40, 0x3f, 0x18, 0x01, 0x00,
+ 0x00, 0x00, 0x3f, 0x19, 0x01, 0x00, 0x00, 0x00,
+ 0x3f, 0x1a, 0x01, 0x00, 0x00, 0x00, 0x3f, 0x1b,
+ 0x01, 0x00, 0x00, 0x00, 0x3f, 0x1c, 0x01, 0x00,
+ 0x00, 0x00, 0x3f, 0x1d, 0x01, 0x00, 0x00, 0x00,
+ 0x3f, 0x1e, 0x01, 0x00, 0x00, 0x00, 0x3f, 0x1f,
+ 0x01, 0x00, 0x00, 0x00, 0x3f, 0x20, 0x01, 0x00,
+ 0x00, 0x00, 0x3f, 0x21, 0x01, 0x00, 0x00, 0x00,
+ 0x3f, 0x22, 0x01, 0x00, 0x00, 0x00, 0x3f, 0x23,
+ 0x01, 0x00, 0x00, 0x00, 0x3f, 0x24, 0x01, 0x00,
+ 0x00, 0x00, 0x3e, 0xe2, 0x00, 0x00, 0x00, 0x00,
+ 0x3e, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x3e, 0xe4,
+ 0x00, 0x00, 0x00, 0x00, 0x3e, 0xe5, 0x00, 0x00,
+ 0x00, 0x00, 0x3e, 0xe6, 0x00, 0x00, 0x00, 0x00,
+ 0x3e, 0xe7, 0x00, 0x00, 0x00, 0x00, 0x3e, 0xe8,
+ 0x00, 0x00, 0x00, 0x00, 0x3e, 0xe9, 0x00, 0x00,
+ 0x00, 0x00, 0x3e, 0xea, 0x00, 0x00, 0x00, 0x00,
+ 0x3e, 0xeb, 0x00, 0x00, 0x00, 0x00, 0x3e, 0xec,
+ 0x00, 0x00, 0x00, 0x00, 0x3e, 0xed, 0x00, 0x00,
+ 0x00, 0x00, 0x3e, 0xee, 0x00, 0x00, 0x00, 0x00,
+ 0x3e, 0xef, 0x00, 0x00, 0x00, 0x00, 0x3e, 0xf0,
+ 0x00, 0x00, 0x00, 0x00, 0x3e, 0xf1, 0x00, 0x00,
+ 0x00, 0x00, 0x3e, 0xf2, 0x00, 0x00, 0x00, 0x00,
+ 0x3e, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x3e, 0xf4,
+ 0x00, 0x00, 0x00, 0x00, 0x3e, 0xf5, 0x00, 0x00,
+ 0x00, 0x00, 0x3e, 0xf6, 0x00, 0x00, 0x00, 0x00,
+ 0xc4, 0x02, 0x40, 0xf7, 0x00, 0x00, 0x00, 0x00,
+ 0xc4, 0x03, 0x40, 0xf8, 0x00, 0x00, 0x00, 0x00,
+ 0xc4, 0x04, 0x40, 0xf9, 0x00, 0x00, 0x00, 0x00,
+ 0xc4, 0x05, 0x40, 0xfa, 0x00, 0x00, 0x00, 0x00,
+ 0xc4, 0x06, 0x40, 0xfb, 0x00, 0x00, 0x00, 0x00,
+ 0xc4, 0x07, 0x40, 0xfc, 0x00, 0x00, 0x00, 0x00,
+ 0xc4, 0x08, 0x40, 0xfd, 0x00, 0x00, 0x00, 0x00,
+ 0xc4, 0x09, 0x40, 0xfe, 0x00, 0x00, 0x00, 0x00,
+ 0xc4, 0x0a, 0x40, 0xff, 0x00, 0x00, 0x00, 0x00,
+ 0xc4, 0x0b, 0x40, 0x00, 0x01, 0x00, 0x00, 0x00,
+ 0xc4, 0x0c, 0x40, 0x01, 0x01, 0x00, 0x00, 0x00,
+ 0xc4, 0x0d, 0x40, 0x02, 0x01, 0x00, 0x00, 0x00,
+ 0xc4, 0x0e, 0x40, 0x03, 0x01, 0x00, 0x00, 0x00,
+ 0xc4, 0x0f, 0x40, 0x04, 0x01, 0x00, 0x00, 0x00,
+ 0xc4, 0x10, 0x40, 0x05, 0x01, 0x00, 0x00, 0x00,
+ 0xc4, 0x11, 0x40, 0x06, 0x01, 0x00, 0x00, 0x00,
+ 0xc4, 0x12, 0x40, 0x07, 0x01, 0x00, 0x00, 0x00,
+ 0xc4, 0x13, 0x40, 0x08, 0x01, 0x00, 0x00, 0x00,
+ 0xc4, 0x14, 0x40, 0x09, 0x01, 0x00, 0x00, 0x00,
+ 0xc4, 0x15, 0x40, 0x0a, 0x01, 0x00, 0x00, 0x00,
+ 0xc4, 0x16, 0x40, 0x0b, 0x01, 0x00, 0x00, 0x00,
+ 0xc4, 0x17, 0x40, 0x0c, 0x01, 0x00, 0x00, 0x00,
+ 0xc4, 0x18, 0x40, 0x0d, 0x01, 0x00, 0x00, 0x00,
+ 0xc4, 0x19, 0x40, 0x0e, 0x01, 0x00, 0x00, 0x00,
+ 0xc4, 0x1a, 0x40, 0x0f, 0x01, 0x00, 0x00, 0x00,
+ 0xc4, 0x1b, 0x40, 0x10, 0x01, 0x00, 0x00, 0x00,
+ 0xc4, 0x1c, 0x40, 0x11, 0x01, 0x00, 0x00, 0x00,
+ 0xc4, 0x1d, 0x40, 0x12, 0x01, 0x00, 0x00, 0x00,
+ 0xc4, 0x1e, 0x40, 0x13, 0x01, 0x00, 0x00, 0x00,
+ 0xc4, 0x1f, 0x40, 0x14, 0x01, 0x00, 0x00, 0x00,
+ 0xc4, 0x20, 0x40, 0x15, 0x01, 0x00, 0x00, 0x00,
+ 0xc4, 0x21, 0x40, 0x16, 0x01, 0x00, 0x00, 0x00,
+ 0xc4, 0x22, 0x40, 0x17, 0x01, 0x00, 0x00, 0x00,
+ 0x3e, 0x18, 0x01, 0x00, 0x00, 0x00, 0x3e, 0x19,
+ 0x01, 0x00, 0x00, 0x00, 0x3e, 0x1a, 0x01, 0x00,
+ 0x00, 0x00, 0x3e, 0x1b, 0x01, 0x00, 0x00, 0x00,
+ 0x3e, 0x1c, 0x01, 0x00, 0x00, 0x00, 0x3e, 0x1d,
+ 0x01, 0x00, 0x00, 0x00, 0x3e, 0x1e, 0x01, 0x00,
+ 0x00, 0x00, 0x3e, 0x1f, 0x01, 0x00, 0x00, 0x00,
+ 0x3e, 0x20, 0x01, 0x00, 0x00, 0x00, 0x3e, 0x21,
+ 0x01, 0x00, 0x00, 0x00, 0x3e, 0x22, 0x01, 0x00,
+ 0x00, 0x00, 0x3e, 0x23, 0x01, 0x00, 0x00, 0x00,
+ 0x3e, 0x24, 0x01, 0x00, 0x00, 0x00, 0x04, 0x25,
+ 0x01, 0x00, 0x00, 0xcd, 0x04, 0x26, 0x01, 0x00,
+ 0x00, 0xcd, 0xc4, 0x00, 0xca, 0xf3, 0xcd, 0x36,
+ 0xec, 0x00, 0x00, 0x00, 0x38, 0xe5, 0x00, 0x00,
+ 0x00, 0xb9, 0xba, 0xf4, 0x3b, 0xec, 0x00, 0x00,
+ 0x00, 0x36, 0xed, 0x00, 0x00, 0x00, 0x38, 0xe7,
+ 0x00, 0x00, 0x00, 0xb9, 0xba, 0x26, 0x02, 0x00,
+ 0xf3, 0x3b, 0xed, 0x00, 0x00, 0x00, 0x36, 0xee,
+ 0x00, 0x00, 0x00, 0x38, 0xea, 0x00, 0x00, 0x00,
+ 0x41, 0xee, 0x00, 0x00, 0x00, 0x3b, 0xee, 0x00,
+ 0x00, 0x00, 0x38, 0x94, 0x00, 0x00, 0x00, 0x42,
+ 0x64, 0x00, 0x00, 0x00, 0xca, 0x04, 0x27, 0x01,
+ 0x00, 0x00, 0x0b, 0xc4, 0x01, 0x4d, 0x41, 0x00,
+ 0x00, 0x00, 0x4c, 0x41, 0x00, 0x00, 0x00, 0x24,
+ 0x03, 0x00, 0xcd, 0x36, 0xef, 0x00, 0x00, 0x00,
+ 0x38, 0xe2, 0x00, 0x00, 0x00, 0x41, 0xef, 0x00,
+ 0x00, 0x00, 0x3b, 0xef, 0x00, 0x00, 0x00, 0x36,
+ 0xf0, 0x00, 0x00, 0x00, 0x38, 0xe2, 0x00, 0x00,
+ 0x00, 0x41, 0xf0, 0x00, 0x00, 0x00, 0x3b, 0xf0,
+ 0x00, 0x00, 0x00, 0x36, 0xf1, 0x00, 0x00, 0x00,
+ 0x38, 0xe2, 0x00, 0x00, 0x00, 0x41, 0xf1, 0x00,
+ 0x00, 0x00, 0x3b, 0xf1, 0x00, 0x00, 0x00, 0x36,
+ 0xf2, 0x00, 0x00, 0x00, 0x38, 0xe2, 0x00, 0x00,
+ 0x00, 0x41, 0xf2, 0x00, 0x00, 0x00, 0x3b, 0xf2,
+ 0x00, 0x00, 0x00, 0x36, 0xf3, 0x00, 0x00, 0x00,
+ 0x38, 0xe2, 0x00, 0x00, 0x00, 0x41, 0xf3, 0x00,
+ 0x00, 0x00, 0x3b, 0xf3, 0x00, 0x00, 0x00, 0x36,
+ 0xf4, 0x00, 0x00, 0x00, 0x38, 0xe2, 0x00, 0x00,
+ 0x00, 0x41, 0xf4, 0x00, 0x00, 0x00, 0x3b, 0xf4,
+ 0x00, 0x00, 0x00, 0x36, 0xf5, 0x00, 0x00, 0x00,
+ 0x38, 0xe2, 0x00, 0x00, 0x00, 0x41, 0x28, 0x01,
+ 0x00, 0x00, 0x3b, 0xf5, 0x00, 0x00, 0x00, 0x36,
+ 0xf6, 0x00, 0x00, 0x00, 0x38, 0xe2, 0x00, 0x00,
+ 0x00, 0x41, 0x29, 0x01, 0x00, 0x00, 0x3b, 0xf6,
+ 0x00, 0x00, 0x00, 0x36, 0x18, 0x01, 0x00, 0x00,
+ 0x38, 0xeb, 0x00, 0x00, 0x00, 0x41, 0x18, 0x01,
+ 0x00, 0x00, 0x3b, 0x18, 0x01, 0x00, 0x00, 0x36,
+ 0x19, 0x01, 0x00, 0x00, 0x38, 0xeb, 0x00, 0x00,
+ 0x00, 0x41, 0x19, 0x01, 0x00, 0x00, 0x3b, 0x19,
+ 0x01, 0x00, 0x00, 0x36, 0x1a, 0x01, 0x00, 0x00,
+ 0x38, 0xeb, 0x00, 0x00, 0x00, 0x41, 0x1a, 0x01,
+ 0x00, 0x00, 0x3b, 0x1a, 0x01, 0x00, 0x00, 0x36,
+ 0x1b, 0x01, 0x00, 0x00, 0x38, 0xeb, 0x00, 0x00,
+ 0x00, 0x41, 0x1b, 0x01, 0x00, 0x00, 0x3b, 0x1b,
+ 0x01, 0x00, 0x00, 0x36, 0x1c, 0x01, 0x00, 0x00,
+ 0x38, 0xeb, 0x00, 0x00, 0x00, 0x41, 0x1c, 0x01,
+ 0x00, 0x00, 0x3b, 0x1c, 0x01, 0x00, 0x00, 0x36,
+ 0x1d, 0x01, 0x00, 0x00, 0x38, 0xeb, 0x00, 0x00,
+ 0x00, 0x41, 0x1d, 0x01, 0x00, 0x00, 0x3b, 0x1d,
+ 0x01, 0x00, 0x00, 0x36, 0x1e, 0x01, 0x00, 0x00,
+ 0x38, 0xeb, 0x00, 0x00, 0x00, 0x41, 0x1e, 0x01,
+ 0x00, 0x00, 0x3b, 0x1e, 0x01, 0x00, 0x00, 0x36,
+ 0x1f, 0x01, 0x00, 0x00, 0x38, 0xeb, 0x00, 0x00,
+ 0x00, 0x41, 0x1f, 0x01, 0x00, 0x00, 0x3b, 0x1f,
+ 0x01, 0x00, 0x00, 0x36, 0x20, 0x01, 0x00, 0x00,
+ 0x38, 0xeb, 0x00, 0x00, 0x00, 0x41, 0x20, 0x01,
+ 0x00, 0x00, 0x3b, 0x20, 0x01, 0x00, 0x00, 0x36,
+ 0x21, 0x01, 0x00, 0x00, 0x38, 0xeb, 0x00, 0x00,
+ 0x00, 0x41, 0x21, 0x01, 0x00, 0x00, 0x3b, 0x21,
+ 0x01, 0x00, 0x00, 0x36, 0x22, 0x01, 0x00, 0x00,
+ 0x38, 0xeb, 0x00, 0x00, 0x00, 0x41, 0x22, 0x01,
+ 0x00, 0x00, 0x3b, 0x22, 0x01, 0x00, 0x00, 0x36,
+ 0x23, 0x01, 0x00, 0x00, 0x38, 0xe7, 0x00, 0x00,
+ 0x00, 0x41, 0x2a, 0x01, 0x00, 0x00, 0x3b, 0x23,
+ 0x01, 0x00, 0x00, 0x36, 0x24, 0x01, 0x00, 0x00,
+ 0x38, 0xe3, 0x00, 0x00, 0x00, 0x41, 0x24, 0x01,
+ 0x00, 0x00, 0x3b, 0x24, 0x01, 0x00, 0x00, 0xc9,
+ 0x28, 0xd6, 0x04, 0x01, 0x2c, 0x00, 0x94, 0x03,
+ 0x01, 0x00, 0xd4, 0x03, 0x02, 0x00, 0x05, 0x2e,
+ 0x21, 0x00, 0x01, 0xe0, 0x24, 0x1e, 0x5d, 0x6c,
+ 0x68, 0xaa, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+ 0x67, 0x00, 0x14, 0xd4, 0x03, 0x67, 0x67, 0x67,
+ 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x68,
+ 0x67, 0x0e, 0x43, 0x06, 0x05, 0x00, 0x01, 0x46,
+ 0x01, 0x20, 0x00, 0xcc, 0x01, 0x8a, 0x1d, 0x47,
+ 0xda, 0x01, 0x00, 0x01, 0x80, 0xd8, 0x04, 0x00,
+ 0x00, 0x00, 0xda, 0x04, 0x00, 0x01, 0x00, 0xdc,
+ 0x04, 0x00, 0x02, 0x80, 0xde, 0x04, 0x00, 0x03,
+ 0x80, 0xe0, 0x04, 0x00, 0x04, 0x80, 0xe2, 0x04,
+ 0x00, 0x05, 0x80, 0xe4, 0x04, 0x00, 0x06, 0x00,
+ 0xe6, 0x04, 0x00, 0x07, 0x00, 0xe8, 0x04, 0x00,
+ 0x08, 0x00, 0xea, 0x04, 0x00, 0x09, 0x00, 0xec,
+ 0x04, 0x00, 0x0a, 0x00, 0xee, 0x04, 0x00, 0x0b,
+ 0x00, 0xf0, 0x04, 0x00, 0x0c, 0x00, 0xf2, 0x04,
+ 0x00, 0x0d, 0x00, 0xf4, 0x04, 0x00, 0x0e, 0x00,
+ 0xf6, 0x04, 0x00, 0x0f, 0x00, 0xf8, 0x04, 0x00,
+ 0x10, 0x00, 0xfa, 0x04, 0x00, 0x11, 0x00, 0xfc,
+ 0x04, 0x00, 0x12, 0x00, 0xfe, 0x04, 0x00, 0x13,
+ 0x00, 0x80, 0x05, 0x00, 0x14, 0x00, 0x82, 0x05,
+ 0x00, 0x15, 0x80, 0x84, 0x05, 0x00, 0x16, 0x80,
+ 0x86, 0x05, 0x00, 0x17, 0x00, 0x88, 0x05, 0x00,
+ 0x18, 0x00, 0x8a, 0x05, 0x00, 0x19, 0x00, 0x8c,
+ 0x05, 0x00, 0x1a, 0x00, 0x8e, 0x05, 0x00, 0x1b,
+ 0x00, 0x90, 0x05, 0x00, 0x1c, 0x00, 0x92, 0x05,
+ 0x00, 0x1d, 0x00, 0x94, 0x05, 0x00, 0x1e, 0x80,
+ 0x96, 0x05, 0x00, 0x1f, 0x00, 0x98, 0x05, 0x00,
+ 0x20, 0x00, 0x9a, 0x05, 0x00, 0x21, 0x80, 0x9c,
+ 0x05, 0x00, 0x22, 0x80, 0x9e, 0x05, 0x00, 0x23,
+ 0x80, 0xa0, 0x05, 0x00, 0x24, 0x80, 0xa2, 0x05,
+ 0x00, 0x25, 0x80, 0xa4, 0x05, 0x00, 0x26, 0x80,
+ 0xa6, 0x05, 0x00, 0x27, 0x00, 0xa8, 0x05, 0x00,
+ 0x28, 0x00, 0xaa, 0x05, 0x00, 0x29, 0x00, 0xac,
+ 0x05, 0x00, 0x2a, 0x00, 0xae, 0x05, 0x00, 0x2b,
+ 0x00, 0xb0, 0x05, 0x00, 0x2c, 0x00, 0xb2, 0x05,
+ 0x00, 0x2d, 0x80, 0xb4, 0x05, 0x00, 0x2e, 0x00,
+ 0xb6, 0x05, 0x00, 0x2f, 0x80, 0xb8, 0x05, 0x00,
+ 0x30, 0x00, 0xba, 0x05, 0x00, 0x31, 0x00, 0xbc,
+ 0x05, 0x00, 0x32, 0x00, 0xbe, 0x05, 0x00, 0x33,
+ 0x00, 0xc0, 0x05, 0x00, 0x34, 0x00, 0xc2, 0x05,
+ 0x00, 0x35, 0x00, 0xc4, 0x05, 0x00, 0x36, 0x00,
+ 0xc6, 0x05, 0x00, 0x37, 0x80, 0xc8, 0x05, 0x00,
+ 0x38, 0x80, 0xca, 0x05, 0x00, 0x39, 0x80, 0xcc,
+ 0x05, 0x00, 0x3a, 0x00, 0xce, 0x05, 0x00, 0x3b,
+ 0x80, 0xd0, 0x05, 0x00, 0x3c, 0x00, 0xd2, 0x05,
+ 0x00, 0x3d, 0x00, 0xd4, 0x05, 0x00, 0x3e, 0x00,
+ 0xd6, 0x05, 0x00, 0x3f, 0x00, 0xd8, 0x05, 0x00,
+ 0x40, 0x00, 0xda, 0x05, 0x00, 0x41, 0x80, 0xdc,
+ 0x05, 0x00, 0x42, 0x80, 0xde, 0x05, 0x00, 0x43,
+ 0x00, 0xe0, 0x05, 0x00, 0x44, 0x80, 0xe2, 0x05,
+ 0x00, 0x45, 0x00, 0xc4, 0x00, 0xcd, 0xc4, 0x01,
+ 0xce, 0xc4, 0x02, 0xcf, 0xc4, 0x03, 0xc7, 0x04,
+ 0xc4, 0x04, 0xc7, 0x05, 0xc4, 0x18, 0xc7, 0x06,
+ 0xc4, 0x19, 0xc7, 0x07, 0xc4, 0x1a, 0xc7, 0x08,
+ 0xc4, 0x1b, 0xc7, 0x09, 0xc4, 0x1c, 0xc7, 0x0a,
+ 0xc4, 0x1d, 0xc7, 0x0b, 0xc4, 0x1e, 0xc7, 0x0c,
+ 0xc4, 0x1f, 0xc7, 0x0d, 0xc4, 0x20, 0xc7, 0x0e,
+ 0xc4, 0x21, 0xc7, 0x0f, 0xc4, 0x22, 0xc7, 0x10,
+ 0xc4, 0x23, 0xc7, 0x11, 0xc4, 0x24, 0xc7, 0x12,
+ 0xc4, 0x25, 0xc7, 0x13, 0xc4, 0x26, 0xc7, 0x14,
+ 0xc4, 0x3a, 0xc7, 0x16, 0xc4, 0x4b, 0xc7, 0x17,
+ 0xc4, 0x4c, 0xc7, 0x18, 0xc4, 0x4d, 0xc7, 0x19,
+ 0xc4, 0x4e, 0xc7, 0x1a, 0xc4, 0x4f, 0xc7, 0x1b,
+ 0xc4, 0x5c, 0xc7, 0x1c, 0xc4, 0x5d, 0xc7, 0x1d,
+ 0xc4, 0x5e, 0xc7, 0x1e, 0xc4, 0x5f, 0xc7, 0x1f,
+ 0xc4, 0x60, 0xc7, 0x20, 0xc4, 0x65, 0xc7, 0x21,
+ 0xc4, 0x67, 0xc7, 0x22, 0xc4, 0x68, 0xc7, 0x23,
+ 0xc4, 0x69, 0xc7, 0x24, 0xc4, 0x6a, 0xc7, 0x25,
+ 0xc4, 0x74, 0xc7, 0x26, 0xc4, 0x75, 0xc7, 0x27,
+ 0xc4, 0x76, 0xc7, 0x28, 0xc4, 0x77, 0xc7, 0x29,
+ 0xc4, 0x78, 0xc7, 0x2a, 0xc4, 0x79, 0xc7, 0x2b,
+ 0xc4, 0x7a, 0xc7, 0x2c, 0xc4, 0x82, 0xc7, 0x2d,
+ 0xc4, 0x83, 0xc7, 0x2e, 0xc4, 0x84, 0xc7, 0x2f,
+ 0xc4, 0x85, 0xc7, 0x30, 0xc4, 0x86, 0xc7, 0x31,
+ 0xc4, 0x91, 0xc7, 0x32, 0xc4, 0x92, 0xc7, 0x33,
+ 0xc4, 0x93, 0xc7, 0x34, 0xc4, 0x94, 0xc7, 0x35,
+ 0xc4, 0x95, 0xc7, 0x36, 0xc4, 0x99, 0xc7, 0x37,
+ 0xc4, 0x9a, 0xc7, 0x38, 0xc4, 0x9c, 0xc7, 0x39,
+ 0xc4, 0x9d, 0xc7, 0x3a, 0xc4, 0x9e, 0xc7, 0x3b,
+ 0xc4, 0x9f, 0xc7, 0x3c, 0xc4, 0xa0, 0xc7, 0x3d,
+ 0xc4, 0xa1, 0xc7, 0x3e, 0xc4, 0xbe, 0xc7, 0x3f,
+ 0xc4, 0xbf, 0xc7, 0x40, 0xc4, 0xc0, 0xc7, 0x41,
+ 0xc4, 0xc1, 0xc7, 0x42, 0xc4, 0xc2, 0xc7, 0x43,
+ 0xc4, 0xc3, 0xc7, 0x44, 0xc4, 0xc4, 0xc7, 0x45,
+ 0xd5, 0xd5, 0x41, 0xb1, 0x00, 0x00, 0x00, 0x43,
+ 0xe2, 0x00, 0x00, 0x00, 0xd5, 0xd5, 0x41, 0xb2,
+ 0x00, 0x00, 0x00, 0x43, 0xe3, 0x00, 0x00, 0x00,
+ 0xd5, 0x0a, 0x43, 0x72, 0x01, 0x00, 0x00, 0xbb,
+ 0xbc, 0xbe, 0xc0, 0xc1, 0x0b, 0xc1, 0x0d, 0xc1,
+ 0x11, 0xc1, 0x13, 0xc1, 0x17, 0xc1, 0x1d, 0xc1,
+ 0x1f, 0xc1, 0x25, 0xc1, 0x29, 0xc1, 0x2b, 0xc1,
+ 0x2f, 0xc1, 0x35, 0xc1, 0x3b, 0xc1, 0x3d, 0xc1,
+ 0x43, 0xc1, 0x47, 0xc1, 0x49, 0xc1, 0x4f, 0xc1,
+ 0x53, 0xc1, 0x59, 0xc1, 0x61, 0xc1, 0x65, 0xc1,
+ 0x67, 0xc1, 0x6b, 0xc1, 0x6d, 0xc1, 0x71, 0xc1,
+ 0x7f, 0xc2, 0x83, 0x00, 0x26, 0x20, 0x00, 0xc2,
+ 0x89, 0x00, 0x4c, 0x20, 0x00, 0x00, 0x80, 0xc2,
+ 0x8b, 0x00, 0x4c, 0x21, 0x00, 0x00, 0x80, 0xc2,
+ 0x95, 0x00, 0x4c, 0x22, 0x00, 0x00, 0x80, 0xc2,
+ 0x97, 0x00, 0x4c, 0x23, 0x00, 0x00, 0x80, 0xc2,
+ 0x9d, 0x00, 0x4c, 0x24, 0x00, 0x00, 0x80, 0xc2,
+ 0xa3, 0x00, 0x4c, 0x25, 0x00, 0x00, 0x80, 0xc2,
+ 0xa7, 0x00, 0x4c, 0x26, 0x00, 0x00, 0x80, 0xc2,
+ 0xad, 0x00, 0x4c, 0x27, 0x00, 0x00, 0x80, 0xc2,
+ 0xb3, 0x00, 0x4c, 0x28, 0x00, 0x00, 0x80, 0xc2,
+ 0xb5, 0x00, 0x4c, 0x29, 0x00, 0x00, 0x80, 0xc2,
+ 0xbf, 0x00, 0x4c, 0x2a, 0x00, 0x00, 0x80, 0xc2,
+ 0xc1, 0x00, 0x4c, 0x2b, 0x00, 0x00, 0x80, 0xc2,
+ 0xc5, 0x00, 0x4c, 0x2c, 0x00, 0x00, 0x80, 0xc2,
+ 0xc7, 0x00, 0x4c, 0x2d, 0x00, 0x00, 0x80, 0xc2,
+ 0xd3, 0x00, 0x4c, 0x2e, 0x00, 0x00, 0x80, 0xc2,
+ 0xdf, 0x00, 0x4c, 0x2f, 0x00, 0x00, 0x80, 0xc2,
+ 0xe3, 0x00, 0x4c, 0x30, 0x00, 0x00, 0x80, 0xc2,
+ 0xe5, 0x00, 0x4c, 0x31, 0x00, 0x00, 0x80, 0xc2,
+ 0xe9, 0x00, 0x4c, 0x32, 0x00, 0x00, 0x80, 0xc2,
+ 0xef, 0x00, 0x4c, 0x33, 0x00, 0x00, 0x80, 0xc2,
+ 0xf1, 0x00, 0x4c, 0x34, 0x00, 0x00, 0x80, 0xc2,
+ 0xfb, 0x00, 0x4c, 0x35, 0x00, 0x00, 0x80, 0xc2,
+ 0x01, 0x01, 0x4c, 0x36, 0x00, 0x00, 0x80, 0xc2,
+ 0x07, 0x01, 0x4c, 0x37, 0x00, 0x00, 0x80, 0xc2,
+ 0x0d, 0x01, 0x4c, 0x38, 0x00, 0x00, 0x80, 0xc2,
+ 0x0f, 0x01, 0x4c, 0x39, 0x00, 0x00, 0x80, 0xc2,
+ 0x15, 0x01, 0x4c, 0x3a, 0x00, 0x00, 0x80, 0xc2,
+ 0x19, 0x01, 0x4c, 0x3b, 0x00, 0x00, 0x80, 0xc2,
+ 0x1b, 0x01, 0x4c, 0x3c, 0x00, 0x00, 0x80, 0xc2,
+ 0x25, 0x01, 0x4c, 0x3d, 0x00, 0x00, 0x80, 0xc2,
+ 0x33, 0x01, 0x4c, 0x3e, 0x00, 0x00, 0x80, 0xc2,
+ 0x37, 0x01, 0x4c, 0x3f, 0x00, 0x00, 0x80, 0xc2,
+ 0x39, 0x01, 0x4c, 0x40, 0x00, 0x00, 0x80, 0xc2,
+ 0x3d, 0x01, 0x4c, 0x41, 0x00, 0x00, 0x80, 0xc2,
+ 0x4b, 0x01, 0x4c, 0x42, 0x00, 0x00, 0x80, 0xc2,
+ 0x51, 0x01, 0x4c, 0x43, 0x00, 0x00, 0x80, 0xc2,
+ 0x5b, 0x01, 0x4c, 0x44, 0x00, 0x00, 0x80, 0xc2,
+ 0x5d, 0x01, 0x4c, 0x45, 0x00, 0x00, 0x80, 0xc2,
+ 0x61, 0x01, 0x4c, 0x46, 0x00, 0x00, 0x80, 0xc2,
+ 0x67, 0x01, 0x4c, 0x47, 0x00, 0x00, 0x80, 0xc2,
+ 0x6f, 0x01, 0x4c, 0x48, 0x00, 0x00, 0x80, 0xc2,
+ 0x75, 0x01, 0x4c, 0x49, 0x00, 0x00, 0x80, 0xc2,
+ 0x7b, 0x01, 0x4c, 0x4a, 0x00, 0x00, 0x80, 0xc2,
+ 0x7f, 0x01, 0x4c, 0x4b, 0x00, 0x00, 0x80, 0xc2,
+ 0x85, 0x01, 0x4c, 0x4c, 0x00, 0x00, 0x80, 0xc2,
+ 0x8d, 0x01, 0x4c, 0x4d, 0x00, 0x00, 0x80, 0xc2,
+ 0x91, 0x01, 0x4c, 0x4e, 0x00, 0x00, 0x80, 0xc2,
+ 0x99, 0x01, 0x4c, 0x4f, 0x00, 0x00, 0x80, 0xc2,
+ 0xa3, 0x01, 0x4c, 0x50, 0x00, 0x00, 0x80, 0xc2,
+ 0xa5, 0x01, 0x4c, 0x51, 0x00, 0x00, 0x80, 0xc2,
+ 0xaf, 0x01, 0x4c, 0x52, 0x00, 0x00, 0x80, 0xc2,
+ 0xb1, 0x01, 0x4c, 0x53, 0x00, 0x00, 0x80, 0xc2,
+ 0xb7, 0x01, 0x4c, 0x54, 0x00, 0x00, 0x80, 0xc2,
+ 0xbb, 0x01, 0x4c, 0x55, 0x00, 0x00, 0x80, 0xc2,
+ 0xc1, 0x01, 0x4c, 0x56, 0x00, 0x00, 0x80, 0xc2,
+ 0xc9, 0x01, 0x4c, 0x57, 0x00, 0x00, 0x80, 0xc2,
+ 0xcd, 0x01, 0x4c, 0x58, 0x00, 0x00, 0x80, 0xc2,
+ 0xcf, 0x01, 0x4c, 0x59, 0x00, 0x00, 0x80, 0xc2,
+ 0xd3, 0x01, 0x4c, 0x5a, 0x00, 0x00, 0x80, 0xc2,
+ 0xdf, 0x01, 0x4c, 0x5b, 0x00, 0x00, 0x80, 0xc2,
+ 0xe7, 0x01, 0x4c, 0x5c, 0x00, 0x00, 0x80, 0xc2,
+ 0xeb, 0x01, 0x4c, 0x5d, 0x00, 0x00, 0x80, 0xc2,
+ 0xf3, 0x01, 0x4c, 0x5e, 0x00, 0x00, 0x80, 0xd0,
+ 0x38, 0xb6, 0x00, 0x00, 0x00, 0x42, 0x73, 0x01,
+ 0x00, 0x00, 0x0b, 0xc4, 0x05, 0x54, 0x74, 0x01,
+ 0x00, 0x00, 0x04, 0xc4, 0x06, 0x54, 0x75, 0x01,
+ 0x00, 0x00, 0x04, 0x24, 0x01, 0x00, 0x0e, 0xc9,
+ 0x38, 0xe2, 0x00, 0x00, 0x00, 0x0b, 0xc4, 0x07,
+ 0x54, 0x76, 0x01, 0x00, 0x00, 0x04, 0xc4, 0x08,
+ 0x54, 0xef, 0x00, 0x00, 0x00, 0x04, 0xc4, 0x09,
+ 0x54, 0xf0, 0x00, 0x00, 0x00, 0x04, 0xc4, 0x0a,
+ 0x54, 0xf1, 0x00, 0x00, 0x00, 0x04, 0xc4, 0x0b,
+ 0x54, 0xf3, 0x00, 0x00, 0x00, 0x04, 0xc4, 0x0c,
+ 0x54, 0xf2, 0x00, 0x00, 0x00, 0x04, 0xc4, 0x0d,
+ 0x54, 0x28, 0x01, 0x00, 0x00, 0x04, 0xc4, 0x0e,
+ 0x54, 0x29, 0x01, 0x00, 0x00, 0x04, 0xc4, 0x0f,
+ 0x54, 0xf4, 0x00, 0x00, 0x00, 0x04, 0xf4, 0x0e,
+ 0xc9, 0x38, 0xe2, 0x00, 0x00, 0x00, 0x41, 0x3b,
+ 0x00, 0x00, 0x00, 0x0b, 0xc4, 0x10, 0x54, 0xfd,
+ 0x00, 0x00, 0x00, 0x04, 0xc4, 0x11, 0x54, 0xf9,
+ 0x00, 0x00, 0x00, 0x04, 0xc4, 0x12, 0x54, 0xfa,
+ 0x00, 0x00, 0x00, 0x04, 0xc4, 0x13, 0x54, 0xfb,
+ 0x00, 0x00, 0x00, 0x04, 0xc4, 0x14, 0x54, 0xfc,
+ 0x00, 0x00, 0x00, 0x04, 0xc4, 0x15, 0x54, 0x02,
+ 0x01, 0x00, 0x00, 0x04, 0xc4, 0x16, 0x54, 0x03,
+ 0x01, 0x00, 0x00, 0x04, 0xf4, 0x0e, 0x36, 0xe4,
+ 0x00, 0x00, 0x00, 0xc4, 0x17, 0x3b, 0xe4, 0x00,
+ 0x00, 0x00, 0xca, 0x38, 0xe4, 0x00, 0x00, 0x00,
+ 0x41, 0x3b, 0x00, 0x00, 0x00, 0x0b, 0xc6, 0x06,
+ 0x4c, 0x77, 0x01, 0x00, 0x00, 0xc6, 0x07, 0x4c,
+ 0x78, 0x01, 0x00, 0x00, 0xc6, 0x08, 0x4c, 0x7c,
+ 0x00, 0x00, 0x00, 0xc6, 0x09, 0x4c, 0x74, 0x01,
+ 0x00, 0x00, 0xc6, 0x0a, 0x4c, 0x79, 0x01, 0x00,
+ 0x00, 0xcb, 0x4c, 0x75, 0x01, 0x00, 0x00, 0xc6,
+ 0x0b, 0x4c, 0x7a, 0x01, 0x00, 0x00, 0xc6, 0x0c,
+ 0x4c, 0x7b, 0x01, 0x00, 0x00, 0xc4, 0x27, 0x54,
+ 0x7c, 0x01, 0x00, 0x00, 0x04, 0xc4, 0x28, 0x54,
+ 0x7d, 0x01, 0x00, 0x00, 0x04, 0x0b, 0x38, 0x97,
+ 0x00, 0x00, 0x00, 0x38, 0xb1, 0x00, 0x00, 0x00,
+ 0x26, 0x02, 0x00, 0x4c, 0x7e, 0x01, 0x00, 0x00,
+ 0x38, 0x97, 0x00, 0x00, 0x00, 0x38, 0xb1, 0x00,
+ 0x00, 0x00, 0x26, 0x02, 0x00, 0x4c, 0x7f, 0x01,
+ 0x00, 0x00, 0xc6, 0x06, 0x4c, 0x77, 0x01, 0x00,
+ 0x00, 0xc6, 0x07, 0x4c, 0x78, 0x01, 0x00, 0x00,
+ 0xc6, 0x08, 0x4c, 0x7c, 0x00, 0x00, 0x00, 0xc6,
+ 0x09, 0x4c, 0x74, 0x01, 0x00, 0x00, 0xc6, 0x0a,
+ 0x4c, 0x79, 0x01, 0x00, 0x00, 0xcb, 0x4c, 0x75,
+ 0x01, 0x00, 0x00, 0xc6, 0x0b, 0x4c, 0x7a, 0x01,
+ 0x00, 0x00, 0xc6, 0x0c, 0x4c, 0x7b, 0x01, 0x00,
+ 0x00, 0x0b, 0x38, 0xe3, 0x00, 0x00, 0x00, 0x4c,
+ 0x7e, 0x01, 0x00, 0x00, 0x38, 0xe3, 0x00, 0x00,
+ 0x00, 0x4c, 0x7f, 0x01, 0x00, 0x00, 0xc6, 0x0d,
+ 0x4c, 0x77, 0x01, 0x00, 0x00, 0xc6, 0x0e, 0x4c,
+ 0x78, 0x01, 0x00, 0x00, 0xc6, 0x0f, 0x4c, 0x7c,
+ 0x00, 0x00, 0x00, 0xc6, 0x10, 0x4c, 0x74, 0x01,
+ 0x00, 0x00, 0xc6, 0x11, 0x4c, 0x79, 0x01, 0x00,
+ 0x00, 0xc6, 0x12, 0x4c, 0x75, 0x01, 0x00, 0x00,
+ 0xc6, 0x13, 0x4c, 0x7a, 0x01, 0x00, 0x00, 0xc6,
+ 0x14, 0x4c, 0x7b, 0x01, 0x00, 0x00, 0x22, 0x04,
+ 0x00, 0x0e, 0xc9, 0x38, 0xe4, 0x00, 0x00, 0x00,
+ 0x0b, 0xc4, 0x29, 0x54, 0x80, 0x01, 0x00, 0x00,
+ 0x04, 0xf4, 0x0e, 0xc9, 0x38, 0xe4, 0x00, 0x00,
+ 0x00, 0x41, 0x3b, 0x00, 0x00, 0x00, 0x0b, 0x38,
+ 0x9a, 0x00, 0x00, 0x00, 0x41, 0x81, 0x01, 0x00,
+ 0x00, 0xc4, 0x2a, 0x55, 0x04, 0xc4, 0x2b, 0x54,
+ 0xfd, 0x00, 0x00, 0x00, 0x04, 0xc4, 0x2c, 0x54,
+ 0x37, 0x00, 0x00, 0x00, 0x04, 0xc4, 0x2d, 0x54,
+ 0xf9, 0x00, 0x00, 0x00, 0x04, 0xc4, 0x2e, 0x54,
+ 0xfa, 0x00, 0x00, 0x00, 0x04, 0xc4, 0x2f, 0x54,
+ 0xfb, 0x00, 0x00, 0x00, 0x04, 0xc4, 0x30, 0x54,
+ 0xfc, 0x00, 0x00, 0x00, 0x04, 0xc4, 0x31, 0x54,
+ 0x02, 0x01, 0x00, 0x00, 0x04, 0xc4, 0x32, 0x54,
+ 0x03, 0x01, 0x00, 0x00, 0x04, 0xf4, 0x0e, 0xc9,
+ 0x38, 0x97, 0x00, 0x00, 0x00, 0x41, 0x3b, 0x00,
+ 0x00, 0x00, 0x0b, 0xc4, 0x33, 0x54, 0xfd, 0x00,
+ 0x00, 0x00, 0x04, 0xc4, 0x34, 0x54, 0xf9, 0x00,
+ 0x00, 0x00, 0x04, 0xc4, 0x35, 0x54, 0xfa, 0x00,
+ 0x00, 0x00, 0x04, 0xc4, 0x36, 0x54, 0xfb, 0x00,
+ 0x00, 0x00, 0x04, 0xc4, 0x37, 0x54, 0xfc, 0x00,
+ 0x00, 0x00, 0x04, 0xc4, 0x38, 0x54, 0x02, 0x01,
+ 0x00, 0x00, 0x04, 0xc4, 0x39, 0x54, 0x03, 0x01,
+ 0x00, 0x00, 0x04, 0xf4, 0x0e, 0x26, 0x00, 0x00,
+ 0xc7, 0x15, 0xc9, 0x38, 0xe3, 0x00, 0x00, 0x00,
+ 0x0b, 0xc4, 0x3b, 0x54, 0x82, 0x01, 0x00, 0x00,
+ 0x04, 0xc4, 0x3c, 0x54, 0x24, 0x01, 0x00, 0x00,
+ 0x04, 0xc4, 0x3d, 0x54, 0x83, 0x01, 0x00, 0x00,
+ 0x05, 0xc4, 0x3e, 0x54, 0x84, 0x01, 0x00, 0x00,
+ 0x05, 0xc4, 0x3f, 0x54, 0x85, 0x01, 0x00, 0x00,
+ 0x05, 0xc4, 0x40, 0x54, 0x86, 0x01, 0x00, 0x00,
+ 0x05, 0xc4, 0x41, 0x54, 0x87, 0x01, 0x00, 0x00,
+ 0x05, 0xc4, 0x42, 0x54, 0x88, 0x01, 0x00, 0x00,
+ 0x05, 0xf4, 0x0e, 0xc9, 0x38, 0xe3, 0x00, 0x00,
+ 0x00, 0x41, 0x3b, 0x00, 0x00, 0x00, 0x0b, 0xc4,
+ 0x43, 0x54, 0xfd, 0x00, 0x00, 0x00, 0x04, 0xc4,
+ 0x44, 0x54, 0xf9, 0x00, 0x00, 0x00, 0x04, 0xc4,
+ 0x45, 0x54, 0xfa, 0x00, 0x00, 0x00, 0x04, 0xc4,
+ 0x46, 0x54, 0xfb, 0x00, 0x00, 0x00, 0x04, 0xc4,
+ 0x47, 0x54, 0xfc, 0x00, 0x00, 0x00, 0x04, 0xc4,
+ 0x48, 0x54, 0x02, 0x01, 0x00, 0x00, 0x04, 0xc4,
+ 0x49, 0x54, 0x03, 0x01, 0x00, 0x00, 0x04, 0xf4,
+ 0x0e, 0x36, 0xe5, 0x00, 0x00, 0x00, 0xc4, 0x4a,
+ 0x3b, 0xe5, 0x00, 0x00, 0x00, 0xca, 0x38, 0xe5,
+ 0x00, 0x00, 0x00, 0x41, 0x3b, 0x00, 0x00, 0x00,
+ 0x0b, 0xc6, 0x17, 0x4c, 0x77, 0x01, 0x00, 0x00,
+ 0xc6, 0x18, 0x4c, 0x78, 0x01, 0x00, 0x00, 0xc6,
+ 0x19, 0x4c, 0x7c, 0x00, 0x00, 0x00, 0xc6, 0x1a,
+ 0x4c, 0x74, 0x01, 0x00, 0x00, 0xcb, 0x4c, 0x75,
+ 0x01, 0x00, 0x00, 0xc6, 0x1b, 0x4c, 0x7a, 0x01,
+ 0x00, 0x00, 0xc4, 0x50, 0x54, 0x7c, 0x01, 0x00,
+ 0x00, 0x04, 0xc4, 0x51, 0x54, 0x7d, 0x01, 0x00,
+ 0x00, 0x04, 0x0b, 0x38, 0x97, 0x00, 0x00, 0x00,
+ 0x38, 0xb1, 0x00, 0x00, 0x00, 0x38, 0xe3, 0x00,
+ 0x00, 0x00, 0x38, 0xe4, 0x00, 0x00, 0x00, 0x26,
+ 0x04, 0x00, 0x4c, 0x7e, 0x01, 0x00, 0x00, 0x38,
+ 0x97, 0x00, 0x00, 0x00, 0x38, 0xb1, 0x00, 0x00,
+ 0x00, 0x38, 0xe3, 0x00, 0x00, 0x00, 0x38, 0xe4,
+ 0x00, 0x00, 0x00, 0x26, 0x04, 0x00, 0x4c, 0x7f,
+ 0x01, 0x00, 0x00, 0xc6, 0x17, 0x4c, 0x77, 0x01,
+ 0x00, 0x00, 0xc6, 0x18, 0x4c, 0x78, 0x01, 0x00,
+ 0x00, 0xc6, 0x19, 0x4c, 0x7c, 0x00, 0x00, 0x00,
+ 0xc6, 0x1a, 0x4c, 0x74, 0x01, 0x00, 0x00, 0xcb,
+ 0x4c, 0x75, 0x01, 0x00, 0x00, 0xc6, 0x1b, 0x4c,
+ 0x7a, 0x01, 0x00, 0x00, 0xf5, 0x0e, 0xc9, 0x38,
+ 0xe5, 0x00, 0x00, 0x00, 0x0b, 0xc4, 0x52, 0x54,
+ 0x89, 0x01, 0x00, 0x00, 0x04, 0xf4, 0x0e, 0xc9,
+ 0x38, 0xe5, 0x00, 0x00, 0x00, 0x41, 0x3b, 0x00,
+ 0x00, 0x00, 0x0b, 0xc4, 0x53, 0x54, 0xfd, 0x00,
+ 0x00, 0x00, 0x04, 0xc4, 0x54, 0x54, 0x37, 0x00,
+ 0x00, 0x00, 0x04, 0xc4, 0x55, 0x54, 0xf9, 0x00,
+ 0x00, 0x00, 0x04, 0xc4, 0x56, 0x54, 0xfa, 0x00,
+ 0x00, 0x00, 0x04, 0xc4, 0x57, 0x54, 0xfb, 0x00,
+ 0x00, 0x00, 0x04, 0xc4, 0x58, 0x54, 0xfc, 0x00,
+ 0x00, 0x00, 0x04, 0xc4, 0x59, 0x54, 0x02, 0x01,
+ 0x00, 0x00, 0x04, 0xc4, 0x5a, 0x54, 0x03, 0x01,
+ 0x00, 0x00, 0x04, 0xf4, 0x0e, 0x36, 0xe6, 0x00,
+ 0x00, 0x00, 0xc4, 0x5b, 0x3b, 0xe6, 0x00, 0x00,
+ 0x00, 0xca, 0x38, 0xe6, 0x00, 0x00, 0x00, 0x41,
+ 0x3b, 0x00, 0x00, 0x00, 0x0b, 0xc6, 0x1c, 0x4c,
+ 0x77, 0x01, 0x00, 0x00, 0xc6, 0x1d, 0x4c, 0x78,
+ 0x01, 0x00, 0x00, 0xc6, 0x1e, 0x4c, 0x7c, 0x00,
+ 0x00, 0x00, 0xc6, 0x1f, 0x4c, 0x74, 0x01, 0x00,
+ 0x00, 0xcb, 0x4c, 0x75, 0x01, 0x00, 0x00, 0xc6,
+ 0x20, 0x4c, 0x7a, 0x01, 0x00, 0x00, 0xc4, 0x61,
+ 0x54, 0x7c, 0x01, 0x00, 0x00, 0x04, 0xc4, 0x62,
+ 0x54, 0x7d, 0x01, 0x00, 0x00, 0x04, 0x0b, 0x38,
+ 0x97, 0x00, 0x00, 0x00, 0x38, 0xb1, 0x00, 0x00,
+ 0x00, 0x38, 0xe3, 0x00, 0x00, 0x00, 0x38, 0xe4,
+ 0x00, 0x00, 0x00, 0x26, 0x04, 0x00, 0x4c, 0x7e,
+ 0x01, 0x00, 0x00, 0x38, 0x97, 0x00, 0x00, 0x00,
+ 0x38, 0xb1, 0x00, 0x00, 0x00, 0x38, 0xe3, 0x00,
+ 0x00, 0x00, 0x38, 0xe4, 0x00, 0x00, 0x00, 0x26,
+ 0x04, 0x00, 0x4c, 0x7f, 0x01, 0x00, 0x00, 0xc6,
+ 0x1c, 0x4c, 0x77, 0x01, 0x00, 0x00, 0xc6, 0x1d,
+ 0x4c, 0x78, 0x01, 0x00, 0x00, 0xc6, 0x1e, 0x4c,
+ 0x7c, 0x00, 0x00, 0x00, 0xc6, 0x1f, 0x4c, 0x74,
+ 0x01, 0x00, 0x00, 0xcb, 0x4c, 0x75, 0x01, 0x00,
+ 0x00, 0xf5, 0x0e, 0xc9, 0x38, 0xe6, 0x00, 0x00,
+ 0x00, 0x41, 0x3b, 0x00, 0x00, 0x00, 0x0b, 0xc4,
+ 0x63, 0x54, 0xfd, 0x00, 0x00, 0x00, 0x04, 0xc4,
+ 0x64, 0x54, 0x37, 0x00, 0x00, 0x00, 0x04, 0xf4,
+ 0x0e, 0x36, 0xe7, 0x00, 0x00, 0x00, 0xc4, 0x66,
+ 0x3b, 0xe7, 0x00, 0x00, 0x00, 0xc9, 0x38, 0xe7,
+ 0x00, 0x00, 0x00, 0x41, 0x3b, 0x00, 0x00, 0x00,
+ 0x0b, 0xc4, 0x6b, 0x54, 0x8a, 0x01, 0x00, 0x00,
+ 0x04, 0xc4, 0x6c, 0x54, 0xfb, 0x00, 0x00, 0x00,
+ 0x04, 0xc4, 0x6d, 0x54, 0xfd, 0x00, 0x00, 0x00,
+ 0x04, 0xc4, 0x6e, 0x54, 0x37, 0x00, 0x00, 0x00,
+ 0x04, 0xc4, 0x6f, 0x54, 0x8b, 0x01, 0x00, 0x00,
+ 0x04, 0xc4, 0x70, 0x54, 0x59, 0x00, 0x00, 0x00,
+ 0x04, 0xc4, 0x71, 0x54, 0xf7, 0x00, 0x00, 0x00,
+ 0x04, 0xc4, 0x72, 0x54, 0xf8, 0x00, 0x00, 0x00,
+ 0x04, 0xc4, 0x73, 0x54, 0xf9, 0x00, 0x00, 0x00,
+ 0x04, 0xf4, 0x0e, 0xca, 0x38, 0xe7, 0x00, 0x00,
+ 0x00, 0x41, 0x3b, 0x00, 0x00, 0x00, 0x0b, 0xc6,
+ 0x26, 0x4c, 0x77, 0x01, 0x00, 0x00, 0xc6, 0x27,
+ 0x4c, 0x78, 0x01, 0x00, 0x00, 0xc6, 0x28, 0x4c,
+ 0x7c, 0x00, 0x00, 0x00, 0xc6, 0x2a, 0x4c, 0x74,
+ 0x01, 0x00, 0x00, 0xcb, 0x4c, 0x75, 0x01, 0x00,
+ 0x00, 0xc6, 0x2c, 0x4c, 0x7a, 0x01, 0x00, 0x00,
+ 0xc4, 0x7b, 0x54, 0x7c, 0x01, 0x00, 0x00, 0x04,
+ 0xc4, 0x7c, 0x54, 0x7d, 0x01, 0x00, 0x00, 0x04,
+ 0x0b, 0x38, 0x97, 0x00, 0x00, 0x00, 0x38, 0xb1,
+ 0x00, 0x00, 0x00, 0x38, 0xe3, 0x00, 0x00, 0x00,
+ 0x38, 0xe4, 0x00, 0x00, 0x00, 0x38, 0xe5, 0x00,
+ 0x00, 0x00, 0x38, 0xe6, 0x00, 0x00, 0x00, 0x26,
+ 0x06, 0x00, 0x4c, 0x7e, 0x01, 0x00, 0x00, 0xc6,
+ 0x26, 0x4c, 0x77, 0x01, 0x00, 0x00, 0xc6, 0x27,
+ 0x4c, 0x78, 0x01, 0x00, 0x00, 0xc6, 0x28, 0x4c,
+ 0x7c, 0x00, 0x00, 0x00, 0xc6, 0x2a, 0x4c, 0x74,
+ 0x01, 0x00, 0x00, 0xcb, 0x4c, 0x75, 0x01, 0x00,
+ 0x00, 0x0b, 0x38, 0x97, 0x00, 0x00, 0x00, 0x38,
+ 0xb1, 0x00, 0x00, 0x00, 0x38, 0xe3, 0x00, 0x00,
+ 0x00, 0x38, 0xe4, 0x00, 0x00, 0x00, 0x38, 0xe5,
+ 0x00, 0x00, 0x00, 0x38, 0xe6, 0x00, 0x00, 0x00,
+ 0x26, 0x06, 0x00, 0x4c, 0x7f, 0x01, 0x00, 0x00,
+ 0xc6, 0x26, 0x4c, 0x77, 0x01, 0x00, 0x00, 0xc6,
+ 0x27, 0x4c, 0x78, 0x01, 0x00, 0x00, 0xc6, 0x28,
+ 0x4c, 0x7c, 0x00, 0x00, 0x00, 0xc6, 0x29, 0x4c,
+ 0x74, 0x01, 0x00, 0x00, 0xcb, 0x4c, 0x75, 0x01,
+ 0x00, 0x00, 0x22, 0x04, 0x00, 0x0e, 0xc9, 0x38,
+ 0xe7, 0x00, 0x00, 0x00, 0x0b, 0xc4, 0x7d, 0x54,
+ 0x8c, 0x01, 0x00, 0x00, 0x04, 0xc4, 0x7e, 0x54,
+ 0xef, 0x00, 0x00, 0x00, 0x04, 0xc4, 0x7f, 0x54,
+ 0xf3, 0x00, 0x00, 0x00, 0x04, 0xc4, 0x80, 0x54,
+ 0x2a, 0x01, 0x00, 0x00, 0x04, 0xf4, 0x0e, 0x36,
+ 0xe8, 0x00, 0x00, 0x00, 0xc4, 0x81, 0x3b, 0xe8,
+ 0x00, 0x00, 0x00, 0xca, 0x38, 0xe8, 0x00, 0x00,
+ 0x00, 0x41, 0x3b, 0x00, 0x00, 0x00, 0x0b, 0xc6,
+ 0x2d, 0x4c, 0x77, 0x01, 0x00, 0x00, 0xc6, 0x2e,
+ 0x4c, 0x78, 0x01, 0x00, 0x00, 0xc6, 0x2f, 0x4c,
+ 0x7c, 0x00, 0x00, 0x00, 0xc6, 0x30, 0x4c, 0x74,
+ 0x01, 0x00, 0x00, 0xcb, 0x4c, 0x75, 0x01, 0x00,
+ 0x00, 0xc6, 0x31, 0x4c, 0x7a, 0x01, 0x00, 0x00,
+ 0xc4, 0x87, 0x54, 0x7c, 0x01, 0x00, 0x00, 0x04,
+ 0xc4, 0x88, 0x54, 0x7d, 0x01, 0x00, 0x00, 0x04,
+ 0x0b, 0x38, 0x97, 0x00, 0x00, 0x00, 0x38, 0xb1,
+ 0x00, 0x00, 0x00, 0x38, 0xe3, 0x00, 0x00, 0x00,
+ 0x38, 0xe4, 0x00, 0x00, 0x00, 0x38, 0xe5, 0x00,
+ 0x00, 0x00, 0x38, 0xe6, 0x00, 0x00, 0x00, 0x38,
+ 0xe7, 0x00, 0x00, 0x00, 0x26, 0x07, 0x00, 0x4c,
+ 0x7e, 0x01, 0x00, 0x00, 0x38, 0x97, 0x00, 0x00,
+ 0x00, 0x38, 0xb1, 0x00, 0x00, 0x00, 0x38, 0xe3,
+ 0x00, 0x00, 0x00, 0x38, 0xe4, 0x00, 0x00, 0x00,
+ 0x38, 0xe5, 0x00, 0x00, 0x00, 0x38, 0xe6, 0x00,
+ 0x00, 0x00, 0x38, 0xe7, 0x00, 0x00, 0x00, 0x26,
+ 0x07, 0x00, 0x4c, 0x7f, 0x01, 0x00, 0x00, 0xc6,
+ 0x2d, 0x4c, 0x77, 0x01, 0x00, 0x00, 0xc6, 0x2e,
+ 0x4c, 0x78, 0x01, 0x00, 0x00, 0xc6, 0x2f, 0x4c,
+ 0x7c, 0x00, 0x00, 0x00, 0xc6, 0x30, 0x4c, 0x74,
+ 0x01, 0x00, 0x00, 0xcb, 0x4c, 0x75, 0x01, 0x00,
+ 0x00, 0xf5, 0x0e, 0xc9, 0x38, 0xe8, 0x00, 0x00,
+ 0x00, 0x41, 0x3b, 0x00, 0x00, 0x00, 0x0b, 0xc4,
+ 0x89, 0x54, 0xfd, 0x00, 0x00, 0x00, 0x04, 0xc4,
+ 0x8a, 0x54, 0x37, 0x00, 0x00, 0x00, 0x04, 0xf4,
+ 0x0e, 0x36, 0xe9, 0x00, 0x00, 0x00, 0xc4, 0x8b,
+ 0x3b, 0xe9, 0x00, 0x00, 0x00, 0xc9, 0x38, 0xe9,
+ 0x00, 0x00, 0x00, 0x41, 0x3b, 0x00, 0x00, 0x00,
+ 0x0b, 0xc4, 0x8c, 0x54, 0xfd, 0x00, 0x00, 0x00,
+ 0x04, 0xc4, 0x8d, 0x54, 0xfb, 0x00, 0x00, 0x00,
+ 0x04, 0xc4, 0x8e, 0x54, 0x37, 0x00, 0x00, 0x00,
+ 0x04, 0xc4, 0x8f, 0x54, 0x59, 0x00, 0x00, 0x00,
+ 0x04, 0xc4, 0x90, 0x54, 0xf7, 0x00, 0x00, 0x00,
+ 0x04, 0xf4, 0x0e, 0xca, 0x38, 0xe9, 0x00, 0x00,
+ 0x00, 0x41, 0x3b, 0x00, 0x00, 0x00, 0x0b, 0xc6,
+ 0x32, 0x4c, 0x77, 0x01, 0x00, 0x00, 0xc6, 0x33,
+ 0x4c, 0x78, 0x01, 0x00, 0x00, 0xc6, 0x34, 0x4c,
+ 0x7c, 0x00, 0x00, 0x00, 0xc6, 0x35, 0x4c, 0x74,
+ 0x01, 0x00, 0x00, 0xcb, 0x4c, 0x75, 0x01, 0x00,
+ 0x00, 0xc6, 0x36, 0x4c, 0x7a, 0x01, 0x00, 0x00,
+ 0xc4, 0x96, 0x54, 0x7c, 0x01, 0x00, 0x00, 0x04,
+ 0xc4, 0x97, 0x54, 0x7d, 0x01, 0x00, 0x00, 0x04,
+ 0x0b, 0x38, 0x97, 0x00, 0x00, 0x00, 0x38, 0xb1,
+ 0x00, 0x00, 0x00, 0x38, 0xe3, 0x00, 0x00, 0x00,
+ 0x38, 0xe4, 0x00, 0x00, 0x00, 0x38, 0xe5, 0x00,
+ 0x00, 0x00, 0x38, 0xe6, 0x00, 0x00, 0x00, 0x38,
+ 0xe7, 0x00, 0x00, 0x00, 0x26, 0x07, 0x00, 0x4c,
+ 0x7e, 0x01, 0x00, 0x00, 0x38, 0x97, 0x00, 0x00,
+ 0x00, 0x38, 0xb1, 0x00, 0x00, 0x00, 0x38, 0xe3,
+ 0x00, 0x00, 0x00, 0x38, 0xe4, 0x00, 0x00, 0x00,
+ 0x38, 0xe5, 0x00, 0x00, 0x00, 0x38, 0xe6, 0x00,
+ 0x00, 0x00, 0x38, 0xe7, 0x00, 0x00, 0x00, 0x26,
+ 0x07, 0x00, 0x4c, 0x7f, 0x01, 0x00, 0x00, 0xc6,
+ 0x32, 0x4c, 0x77, 0x01, 0x00, 0x00, 0xc6, 0x33,
+ 0x4c, 0x78, 0x01, 0x00, 0x00, 0xc6, 0x34, 0x4c,
+ 0x7c, 0x00, 0x00, 0x00, 0xc6, 0x35, 0x4c, 0x74,
+ 0x01, 0x00, 0x00, 0xcb, 0x4c, 0x75, 0x01, 0x00,
+ 0x00, 0xf5, 0x0e, 0xc9, 0x38, 0xe9, 0x00, 0x00,
+ 0x00, 0x0b, 0xc4, 0x98, 0x54, 0x8d, 0x01, 0x00,
+ 0x00, 0x04, 0xf4, 0x0e, 0x36, 0xea, 0x00, 0x00,
+ 0x00, 0xc4, 0x9b, 0x3b, 0xea, 0x00, 0x00, 0x00,
+ 0xca, 0x38, 0xea, 0x00, 0x00, 0x00, 0x41, 0x3b,
+ 0x00, 0x00, 0x00, 0x0b, 0xc6, 0x39, 0x4c, 0x77,
+ 0x01, 0x00, 0x00, 0xc6, 0x3a, 0x4c, 0x78, 0x01,
+ 0x00, 0x00, 0xc6, 0x3b, 0x4c, 0x7c, 0x00, 0x00,
+ 0x00, 0xc6, 0x3c, 0x4c, 0x74, 0x01, 0x00, 0x00,
+ 0xc6, 0x3d, 0x4c, 0x75, 0x01, 0x00, 0x00, 0xc6,
+ 0x3e, 0x4c, 0x7a, 0x01, 0x00, 0x00, 0xc4, 0xa2,
+ 0x54, 0x7c, 0x01, 0x00, 0x00, 0x04, 0xc4, 0xa3,
+ 0x54, 0x7d, 0x01, 0x00, 0x00, 0x04, 0x0b, 0x38,
+ 0x97, 0x00, 0x00, 0x00, 0x38, 0xb1, 0x00, 0x00,
+ 0x00, 0x38, 0xe3, 0x00, 0x00, 0x00, 0x38, 0xe4,
+ 0x00, 0x00, 0x00, 0x38, 0xe5, 0x00, 0x00, 0x00,
+ 0x38, 0xe6, 0x00, 0x00, 0x00, 0x38, 0xe7, 0x00,
+ 0x00, 0x00, 0x26, 0x07, 0x00, 0x4c, 0x7e, 0x01,
+ 0x00, 0x00, 0x38, 0x97, 0x00, 0x00, 0x00, 0x38,
+ 0xb1, 0x00, 0x00, 0x00, 0x38, 0xe3, 0x00, 0x00,
+ 0x00, 0x38, 0xe4, 0x00, 0x00, 0x00, 0x38, 0xe5,
+ 0x00, 0x00, 0x00, 0x38, 0xe6, 0x00, 0x00, 0x00,
+ 0x38, 0xe7, 0x00, 0x00, 0x00, 0x26, 0x07, 0x00,
+ 0x4c, 0x7f, 0x01, 0x00, 0x00, 0xc6, 0x39, 0x4c,
+ 0x77, 0x01, 0x00, 0x00, 0xc6, 0x3a, 0x4c, 0x78,
+ 0x01, 0x00, 0x00, 0xc6, 0x3b, 0x4c, 0x7c, 0x00,
+ 0x00, 0x00, 0xc6, 0x3c, 0x4c, 0x74, 0x01, 0x00,
+ 0x00, 0xc6, 0x3d, 0x4c, 0x75, 0x01, 0x00, 0x00,
+ 0xf5, 0x0e, 0xc9, 0x38, 0xea, 0x00, 0x00, 0x00,
+ 0x41, 0x3b, 0x00, 0x00, 0x00, 0x0b, 0xc4, 0xa4,
+ 0x54, 0xfb, 0x00, 0x00, 0x00, 0x04, 0xc4, 0xa5,
+ 0x54, 0xfd, 0x00, 0x00, 0x00, 0x04, 0xc4, 0xa6,
+ 0x54, 0x8a, 0x01, 0x00, 0x00, 0x04, 0xc4, 0xa7,
+ 0x54, 0x37, 0x00, 0x00, 0x00, 0x04, 0xc4, 0xa8,
+ 0x54, 0x59, 0x00, 0x00, 0x00, 0x04, 0xc4, 0xa9,
+ 0x54, 0xf7, 0x00, 0x00, 0x00, 0x04, 0xc4, 0xaa,
+ 0x54, 0xf8, 0x00, 0x00, 0x00, 0x04, 0xc4, 0xab,
+ 0x54, 0x02, 0x01, 0x00, 0x00, 0x04, 0xc4, 0xac,
+ 0x54, 0x03, 0x01, 0x00, 0x00, 0x04, 0xf4, 0x0e,
+ 0xc9, 0x38, 0xea, 0x00, 0x00, 0x00, 0x0b, 0xc4,
+ 0xad, 0x54, 0x8e, 0x01, 0x00, 0x00, 0x04, 0xc4,
+ 0xae, 0x54, 0xee, 0x00, 0x00, 0x00, 0x04, 0xf4,
+ 0x0e, 0x36, 0xeb, 0x00, 0x00, 0x00, 0xc4, 0xaf,
+ 0x3b, 0xeb, 0x00, 0x00, 0x00, 0xc9, 0x38, 0xeb,
+ 0x00, 0x00, 0x00, 0x0b, 0xc4, 0xb0, 0x54, 0x18,
+ 0x01, 0x00, 0x00, 0x04, 0xc4, 0xb1, 0x54, 0x19,
+ 0x01, 0x00, 0x00, 0x04, 0xc4, 0xb2, 0x54, 0x8f,
+ 0x01, 0x00, 0x00, 0x04, 0xc4, 0xb3, 0x54, 0x1a,
+ 0x01, 0x00, 0x00, 0x04, 0xc4, 0xb4, 0x54, 0x90,
+ 0x01, 0x00, 0x00, 0x04, 0xc4, 0xb5, 0x54, 0x1b,
+ 0x01, 0x00, 0x00, 0x04, 0xc4, 0xb6, 0x54, 0x1c,
+ 0x01, 0x00, 0x00, 0x04, 0xc4, 0xb7, 0x54, 0x1d,
+ 0x01, 0x00, 0x00, 0x04, 0xc4, 0xb8, 0x54, 0x1e,
+ 0x01, 0x00, 0x00, 0x04, 0xc4, 0xb9, 0x54, 0xfd,
+ 0x00, 0x00, 0x00, 0x04, 0xc4, 0xba, 0x54, 0x1f,
+ 0x01, 0x00, 0x00, 0x04, 0xc4, 0xbb, 0x54, 0x20,
+ 0x01, 0x00, 0x00, 0x04, 0xc4, 0xbc, 0x54, 0x22,
+ 0x01, 0x00, 0x00, 0x04, 0xc4, 0xbd, 0x54, 0x21,
+ 0x01, 0x00, 0x00, 0x04, 0xf4, 0x0e, 0xca, 0x38,
+ 0x95, 0x00, 0x00, 0x00, 0x41, 0x3b, 0x00, 0x00,
+ 0x00, 0x0b, 0xc6, 0x3f, 0x4c, 0x77, 0x01, 0x00,
+ 0x00, 0xc6, 0x40, 0x4c, 0x78, 0x01, 0x00, 0x00,
+ 0xc6, 0x42, 0x4c, 0x7c, 0x00, 0x00, 0x00, 0xc6,
+ 0x43, 0x4c, 0x74, 0x01, 0x00, 0x00, 0xc6, 0x45,
+ 0x4c, 0x7a, 0x01, 0x00, 0x00, 0xc4, 0xc5, 0x54,
+ 0x7c, 0x01, 0x00, 0x00, 0x04, 0xc4, 0xc6, 0x54,
+ 0x7d, 0x01, 0x00, 0x00, 0x04, 0x0b, 0x38, 0x97,
+ 0x00, 0x00, 0x00, 0x38, 0xb1, 0x00, 0x00, 0x00,
+ 0x38, 0xe3, 0x00, 0x00, 0x00, 0x38, 0xe4, 0x00,
+ 0x00, 0x00, 0x38, 0xe5, 0x00, 0x00, 0x00, 0x38,
+ 0xe6, 0x00, 0x00, 0x00, 0x38, 0xe7, 0x00, 0x00,
+ 0x00, 0x38, 0xe8, 0x00, 0x00, 0x00, 0x38, 0xe9,
+ 0x00, 0x00, 0x00, 0x38, 0xea, 0x00, 0x00, 0x00,
+ 0x26, 0x0a, 0x00, 0x4c, 0x7f, 0x01, 0x00, 0x00,
+ 0xc6, 0x41, 0x4c, 0x7c, 0x00, 0x00, 0x00, 0xc6,
+ 0x44, 0x4c, 0x74, 0x01, 0x00, 0x00, 0xcb, 0x4c,
+ 0x75, 0x01, 0x00, 0x00, 0x0b, 0x38, 0x97, 0x00,
+ 0x00, 0x00, 0x38, 0xb1, 0x00, 0x00, 0x00, 0x38,
+ 0xe3, 0x00, 0x00, 0x00, 0x38, 0xe4, 0x00, 0x00,
+ 0x00, 0x38, 0xe5, 0x00, 0x00, 0x00, 0x38, 0xe6,
+ 0x00, 0x00, 0x00, 0x38, 0xe7, 0x00, 0x00, 0x00,
+ 0x38, 0xe8, 0x00, 0x00, 0x00, 0x38, 0xe9, 0x00,
+ 0x00, 0x00, 0x38, 0xea, 0x00, 0x00, 0x00, 0x26,
+ 0x0a, 0x00, 0x4c, 0x7e, 0x01, 0x00, 0x00, 0xc4,
+ 0xc7, 0x54, 0x7c, 0x00, 0x00, 0x00, 0x04, 0xc4,
+ 0xc8, 0x54, 0x74, 0x01, 0x00, 0x00, 0x04, 0x22,
+ 0x04, 0x00, 0x0e, 0xc9, 0x38, 0x95, 0x00, 0x00,
+ 0x00, 0x41, 0x3b, 0x00, 0x00, 0x00, 0x0b, 0xc4,
+ 0xc9, 0x54, 0xfb, 0x00, 0x00, 0x00, 0x04, 0xc4,
+ 0xca, 0x54, 0x91, 0x01, 0x00, 0x00, 0x04, 0xc4,
+ 0xcb, 0x54, 0xfd, 0x00, 0x00, 0x00, 0x04, 0x38,
+ 0xe7, 0x00, 0x00, 0x00, 0x41, 0x3b, 0x00, 0x00,
+ 0x00, 0x41, 0xf9, 0x00, 0x00, 0x00, 0x4c, 0xf9,
+ 0x00, 0x00, 0x00, 0xf4, 0x29, 0xd6, 0x04, 0x1d,
+ 0xb7, 0x04, 0x00, 0x8d, 0x02, 0x02, 0x3f, 0x3f,
+ 0x00, 0x07, 0xba, 0x01, 0x00, 0xb9, 0x04, 0x5a,
+ 0x35, 0x00, 0x01, 0x0e, 0x00, 0x08, 0x0e, 0x2b,
+ 0x18, 0x00, 0x07, 0x0a, 0x00, 0x08, 0x12, 0x2d,
+ 0x00, 0x08, 0x14, 0x00, 0x08, 0x2a, 0x00, 0x08,
+ 0x2a, 0x00, 0x08, 0x34, 0x00, 0x08, 0x16, 0x00,
+ 0x08, 0x50, 0x2b, 0x0e, 0x41, 0x2d, 0x00, 0x08,
+ 0x0c, 0x2d, 0x00, 0x08, 0x0c, 0x00, 0x08, 0x0c,
+ 0x00, 0x08, 0x0c, 0x2b, 0x00, 0x02, 0x08, 0x00,
+ 0x05, 0x42, 0x00, 0x07, 0x90, 0x01, 0x3a, 0x08,
+ 0x26, 0x26, 0x26, 0x26, 0x26, 0x21, 0x26, 0x28,
+ 0x2d, 0x2c, 0x08, 0x5d, 0x5d, 0x26, 0x26, 0x26,
+ 0x26, 0x26, 0x21, 0x26, 0x27, 0x08, 0x35, 0x35,
+ 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26, 0x26,
+ 0x18, 0x00, 0x07, 0x10, 0x2b, 0x0e, 0x3f, 0x00,
+ 0x0a, 0x0c, 0x19, 0x2d, 0x2d, 0x00, 0x08, 0x0c,
+ 0x2d, 0x00, 0x08, 0x0c, 0x2d, 0x2d, 0x2b, 0x00,
+ 0x02, 0x08, 0x41, 0x2d, 0x2d, 0x2d, 0x00, 0x08,
+ 0x0c, 0x2d, 0x00, 0x08, 0x0e, 0x2b, 0x00, 0x02,
+ 0x08, 0x00, 0x05, 0x36, 0x28, 0x00, 0x08, 0x2e,
+ 0x2c, 0x2b, 0x2c, 0x2b, 0x2c, 0x2b, 0x2b, 0x0e,
+ 0x41, 0x2d, 0x2d, 0x2d, 0x00, 0x08, 0x0c, 0x2d,
+ 0x00, 0x08, 0x0e, 0x2b, 0x00, 0x02, 0x08, 0x00,
+ 0x05, 0x1c, 0x00, 0x07, 0x3c, 0x3a, 0x08, 0x26,
+ 0x26, 0x26, 0x26, 0x21, 0x28, 0x2d, 0x2c, 0x08,
+ 0x8f, 0x8f, 0x26, 0x26, 0x26, 0x26, 0x21, 0x26,
+ 0x0e, 0x00, 0x07, 0x0e, 0x2b, 0x0e, 0x00, 0x0c,
+ 0x08, 0x00, 0x08, 0x24, 0x2d, 0x2d, 0x2d, 0x2d,
+ 0x00, 0x08, 0x08, 0x2d, 0x2b, 0x00, 0x02, 0x08,
+ 0x00, 0x05, 0x2a, 0x00, 0x07, 0x58, 0x3a, 0x08,
+ 0x26, 0x26, 0x26, 0x26, 0x21, 0x28, 0x2d, 0x2c,
+ 0x08, 0x8f, 0x8f, 0x26, 0x26, 0x26, 0x26, 0x21,
+ 0x0e, 0x00, 0x0c, 0x10, 0x2d, 0x2b, 0x00, 0x02,
+ 0x22, 0x00, 0x05, 0x24, 0x00, 0x07, 0xf0, 0x01,
+ 0x00, 0x0c, 0x10, 0x00, 0x08, 0x12, 0x2d, 0x00,
+ 0x08, 0x28, 0x00, 0x08, 0x0c, 0x00, 0x08, 0x14,
+ 0x00, 0x08, 0x1a, 0x00, 0x08, 0x12, 0x00, 0x08,
+ 0x12, 0x2b, 0x00, 0x02, 0x80, 0x01, 0x3a, 0x08,
+ 0x26, 0x26, 0x26, 0x26, 0x21, 0x28, 0x00, 0x08,
+ 0x10, 0x2c, 0x08, 0xc1, 0x26, 0x26, 0x26, 0x26,
+ 0x22, 0x08, 0xc1, 0x26, 0x26, 0x26, 0x26, 0x21,
+ 0x18, 0x00, 0x07, 0x36, 0x00, 0x08, 0x14, 0x00,
+ 0x08, 0x28, 0x2d, 0x2b, 0x00, 0x02, 0x08, 0x00,
+ 0x05, 0x2a, 0x00, 0x07, 0x48, 0x3a, 0x08, 0x26,
+ 0x26, 0x26, 0x26, 0x21, 0x28, 0x2d, 0x2c, 0x08,
+ 0xda, 0xda, 0x26, 0x26, 0x26, 0x26, 0x21, 0x0e,
+ 0x00, 0x0c, 0x10, 0x2d, 0x2b, 0x00, 0x02, 0x08,
+ 0x00, 0x05, 0x2a, 0x27, 0x41, 0x2d, 0x00, 0x08,
+ 0x14, 0x2d, 0x00, 0x08, 0x08, 0x2b, 0x00, 0x02,
+ 0x3a, 0x3a, 0x08, 0x26, 0x26, 0x26, 0x26, 0x21,
+ 0x28, 0x2d, 0x2c, 0x08, 0xda, 0xda, 0x26, 0x26,
+ 0x26, 0x26, 0x21, 0x0e, 0x00, 0x07, 0x1c, 0x2b,
+ 0x00, 0x02, 0x2c, 0x00, 0x05, 0x2e, 0x00, 0x07,
+ 0xc0, 0x01, 0x3a, 0x08, 0x26, 0x26, 0x26, 0x26,
+ 0x26, 0x28, 0x00, 0x08, 0x12, 0x2c, 0x08, 0xda,
+ 0xda, 0x26, 0x26, 0x26, 0x26, 0x26, 0x0e, 0x00,
+ 0x0c, 0x12, 0x00, 0x08, 0x20, 0x00, 0x08, 0x1e,
+ 0x00, 0x08, 0x2c, 0x00, 0x08, 0x1c, 0x00, 0x08,
+ 0x20, 0x00, 0x08, 0x1c, 0x00, 0x08, 0x22, 0x00,
+ 0x08, 0x12, 0x2b, 0x0e, 0x00, 0x07, 0x1a, 0x00,
+ 0x08, 0x2a, 0x2b, 0x00, 0x02, 0x08, 0x00, 0x05,
+ 0x18, 0x27, 0x00, 0x07, 0x0e, 0x00, 0x08, 0x10,
+ 0x00, 0x08, 0x14, 0x00, 0x08, 0x2c, 0x00, 0x08,
+ 0x12, 0x00, 0x08, 0x12, 0x00, 0x08, 0x22, 0x2d,
+ 0x00, 0x08, 0x44, 0x00, 0x08, 0x54, 0x00, 0x08,
+ 0x52, 0x00, 0x08, 0x94, 0x01, 0x00, 0x08, 0x18,
+ 0x00, 0x08, 0x16, 0x2b, 0x00, 0x02, 0xc8, 0x01,
+ 0x3a, 0x08, 0x26, 0x26, 0x26, 0x26, 0x28, 0x00,
+ 0x08, 0x10, 0x2c, 0x08, 0x99, 0x8f, 0x26, 0x26,
+ 0x22, 0x08, 0x99, 0x8f, 0x2b, 0x2b, 0x18, 0x00,
+ 0x0c, 0x10, 0x00, 0x08, 0x18, 0x2d, 0x2b, 0x67,
+ 0x09, 0x0e, 0x43, 0x06, 0x05, 0xd8, 0x04, 0x02,
+ 0x05, 0x02, 0x05, 0x00, 0x00, 0x77, 0x07, 0xa4,
+ 0x06, 0x00, 0x01, 0x00, 0xa6, 0x06, 0x00, 0x01,
+ 0x00, 0xa8, 0x06, 0x00, 0x00, 0x00, 0xaa, 0x06,
+ 0x00, 0x01, 0x00, 0xac, 0x06, 0x00, 0x02, 0x00,
+ 0xae, 0x06, 0x00, 0x03, 0x00, 0xb0, 0x06, 0x00,
+ 0x04, 0x00, 0x38, 0x99, 0x01, 0x00, 0x00, 0x42,
+ 0x66, 0x00, 0x00, 0x00, 0xd6, 0x24, 0x01, 0x00,
+ 0xd0, 0xb9, 0xcd, 0xc9, 0xcc, 0xed, 0xa7, 0xee,
+ 0x60, 0xcc, 0xc9, 0x47, 0xcf, 0x38, 0x94, 0x00,
+ 0x00, 0x00, 0x42, 0x65, 0x00, 0x00, 0x00, 0xd6,
+ 0xcb, 0x24, 0x02, 0x00, 0xc8, 0x04, 0x09, 0x43,
+ 0x3f, 0x00, 0x00, 0x00, 0x04, 0x40, 0x00, 0x00,
+ 0x00, 0xc6, 0x04, 0xac, 0xee, 0x1d, 0xc6, 0x04,
+ 0x41, 0x40, 0x00, 0x00, 0x00, 0xf8, 0xef, 0x11,
+ 0xc6, 0x04, 0x09, 0x43, 0x3e, 0x00, 0x00, 0x00,
+ 0xc6, 0x04, 0x09, 0x43, 0x3d, 0x00, 0x00, 0x00,
+ 0xf0, 0x09, 0xc6, 0x04, 0x09, 0x43, 0x3d, 0x00,
+ 0x00, 0x00, 0x38, 0x94, 0x00, 0x00, 0x00, 0x42,
+ 0x64, 0x00, 0x00, 0x00, 0xd5, 0xcb, 0xc6, 0x04,
+ 0x24, 0x03, 0x00, 0x0e, 0x97, 0x00, 0xf0, 0x9c,
+ 0x29, 0xd6, 0x04, 0x23, 0x0e, 0x04, 0x4e, 0x2b,
+ 0x17, 0x58, 0x21, 0x35, 0x35, 0x2b, 0x2c, 0x0e,
+ 0x2c, 0x5d, 0x17, 0x0e, 0x41, 0x06, 0x05, 0xda,
+ 0x04, 0x02, 0x09, 0x01, 0x07, 0x00, 0x00, 0xfd,
+ 0x01, 0x0b, 0xb4, 0x06, 0x00, 0x01, 0x00, 0xb6,
+ 0x06, 0x00, 0x01, 0x00, 0xb8, 0x06, 0x00, 0x00,
+ 0x00, 0xa8, 0x06, 0x00, 0x01, 0x00, 0xba, 0x06,
+ 0x00, 0x02, 0x00, 0xbc, 0x06, 0x00, 0x03, 0x00,
+ 0xbe, 0x06, 0x00, 0x04, 0x00, 0xc0, 0x06, 0x00,
+ 0x05, 0x00, 0xa4, 0x06, 0x00, 0x06, 0x00, 0xae,
+ 0x06, 0x00, 0x07, 0x00, 0xc2, 0x06, 0x00, 0x08,
+ 0x00, 0x0d, 0x01, 0x00, 0xda, 0x04, 0x7e, 0x01,
+ 0x00, 0x00, 0x04, 0x7f, 0x01, 0x00, 0x00, 0x26,
+ 0x02, 0x00, 0xc7, 0x08, 0x26, 0x00, 0x00, 0xcd,
+ 0xb9, 0xce, 0xca, 0xd6, 0xed, 0xa7, 0x6c, 0xb6,
+ 0x00, 0x00, 0x00, 0xd6, 0xca, 0x47, 0xd3, 0x41,
+ 0x7e, 0x01, 0x00, 0x00, 0x11, 0xef, 0x08, 0x0e,
+ 0xcb, 0x41, 0x7f, 0x01, 0x00, 0x00, 0x6c, 0x8e,
+ 0x00, 0x00, 0x00, 0xcb, 0x41, 0x7e, 0x01, 0x00,
+ 0x00, 0xcb, 0x41, 0x7f, 0x01, 0x00, 0x00, 0x26,
+ 0x02, 0x00, 0xc7, 0x07, 0xcb, 0x04, 0x7e, 0x01,
+ 0x00, 0x00, 0x9c, 0x0e, 0xcb, 0x04, 0x7f, 0x01,
+ 0x00, 0x00, 0x9c, 0x0e, 0xb9, 0xc7, 0x05, 0xc6,
+ 0x05, 0xbb, 0xa7, 0xee, 0x6c, 0xc6, 0x07, 0xc6,
+ 0x05, 0x47, 0xc8, 0x06, 0xee, 0x54, 0x38, 0x95,
+ 0x00, 0x00, 0x00, 0x42, 0xa2, 0x01, 0x00, 0x00,
+ 0xc6, 0x06, 0x24, 0x01, 0x00, 0x9a, 0xee, 0x08,
+ 0xc6, 0x06, 0x26, 0x01, 0x00, 0xc7, 0x06, 0xb9,
+ 0xd0, 0xcc, 0xc6, 0x06, 0xed, 0xa7, 0xee, 0x32,
+ 0x0b, 0xc7, 0x04, 0x38, 0x94, 0x00, 0x00, 0x00,
+ 0x42, 0xa3, 0x01, 0x00, 0x00, 0xc6, 0x04, 0xcb,
+ 0x24, 0x02, 0x00, 0x0e, 0xc6, 0x04, 0xc6, 0x08,
+ 0xc6, 0x05, 0x47, 0x74, 0xc6, 0x06, 0xcc, 0x47,
+ 0x49, 0xc9, 0x42, 0xa4, 0x01, 0x00, 0x00, 0xc6,
+ 0x04, 0x24, 0x01, 0x00, 0x0e, 0x97, 0x03, 0xf0,
+ 0xc9, 0x97, 0x05, 0xf0, 0x9b, 0xc9, 0x42, 0xa4,
+ 0x01, 0x00, 0x00, 0xcb, 0x24, 0x01, 0x00, 0x0e,
+ 0x97, 0x01, 0xf1, 0x47, 0xff, 0xd5, 0x38, 0x9a,
+ 0x00, 0x00, 0x00, 0x41, 0xa5, 0x01, 0x00, 0x00,
+ 0x74, 0x38, 0xb6, 0x00, 0x00, 0x00, 0x41, 0xa6,
+ 0x01, 0x00, 0x00, 0x42, 0xa7, 0x01, 0x00, 0x00,
+ 0x07, 0x26, 0x01, 0x00, 0xba, 0xc9, 0x52, 0x0e,
+ 0x18, 0x27, 0x00, 0x00, 0x49, 0x29, 0xd6, 0x04,
+ 0x3a, 0x19, 0x19, 0x4e, 0x17, 0x3a, 0x17, 0x67,
+ 0x58, 0x2b, 0x2b, 0x30, 0x26, 0x0d, 0x5d, 0x27,
+ 0x30, 0x12, 0x58, 0x44, 0x3f, 0x18, 0x18, 0x3b,
+ 0x1c, 0x3f, 0x8f, 0x0e, 0x43, 0x06, 0x05, 0xdc,
+ 0x04, 0x02, 0x03, 0x02, 0x04, 0x00, 0x00, 0xbc,
+ 0x01, 0x05, 0xba, 0x06, 0x00, 0x01, 0x00, 0xbe,
+ 0x06, 0x00, 0x01, 0x00, 0xd0, 0x06, 0x00, 0x00,
+ 0x00, 0xd2, 0x06, 0x00, 0x01, 0x00, 0xa8, 0x06,
+ 0x00, 0x02, 0x00, 0x38, 0xe2, 0x00, 0x00, 0x00,
+ 0x42, 0x76, 0x01, 0x00, 0x00, 0xd6, 0x24, 0x01,
+ 0x00, 0x9a, 0xee, 0x12, 0x38, 0x02, 0x01, 0x00,
+ 0x00, 0x38, 0x03, 0x01, 0x00, 0x00, 0xd5, 0xf3,
+ 0xd6, 0x9e, 0x23, 0x01, 0x00, 0x38, 0x95, 0x00,
+ 0x00, 0x00, 0x42, 0xa2, 0x01, 0x00, 0x00, 0xd5,
+ 0x24, 0x01, 0x00, 0xee, 0x2d, 0xd5, 0x38, 0xe7,
+ 0x00, 0x00, 0x00, 0xab, 0x11, 0xef, 0x09, 0x0e,
+ 0xd5, 0x38, 0xea, 0x00, 0x00, 0x00, 0xab, 0x9a,
+ 0xee, 0x18, 0x38, 0x18, 0x01, 0x00, 0x00, 0x38,
+ 0xeb, 0x00, 0x00, 0x00, 0x42, 0x90, 0x01, 0x00,
+ 0x00, 0xd5, 0x24, 0x01, 0x00, 0xf3, 0xcd, 0xf0,
+ 0x03, 0xba, 0xcd, 0xd6, 0xb9, 0xad, 0xee, 0x03,
+ 0xc9, 0x28, 0x09, 0xce, 0xd6, 0xb9, 0xa7, 0xee,
+ 0x06, 0x0a, 0xce, 0xd6, 0x90, 0xda, 0xd5, 0xcd,
+ 0x38, 0xe2, 0x00, 0x00, 0x00, 0x42, 0xaa, 0x01,
+ 0x00, 0x00, 0xd6, 0x24, 0x01, 0x00, 0xba, 0xa2,
+ 0xcf, 0xcb, 0xb9, 0xaa, 0xee, 0x14, 0xc9, 0xc9,
+ 0x9e, 0xcd, 0xd6, 0xcb, 0xa5, 0xba, 0xb1, 0xee,
+ 0x05, 0xc9, 0xd5, 0x9e, 0xcd, 0x96, 0x02, 0xf0,
+ 0xe9, 0xca, 0xee, 0x1a, 0xc9, 0x41, 0xfd, 0x00,
+ 0x00, 0x00, 0xf8, 0xef, 0x07, 0x04, 0xab, 0x01,
+ 0x00, 0x00, 0x2f, 0xc9, 0x42, 0xfd, 0x00, 0x00,
+ 0x00, 0x24, 0x00, 0x00, 0xcd, 0xc9, 0x28, 0xd6,
+ 0x04, 0x5d, 0x18, 0x04, 0x58, 0x59, 0x8a, 0x35,
+ 0x6c, 0x0d, 0x0e, 0x1c, 0x0d, 0x0d, 0x1c, 0x0d,
+ 0x13, 0x0d, 0x71, 0x17, 0x26, 0x17, 0x17, 0x12,
+ 0x30, 0x21, 0x36, 0x0e, 0x43, 0x06, 0x05, 0xe0,
+ 0x04, 0x02, 0x06, 0x02, 0x05, 0x01, 0x00, 0x72,
+ 0x08, 0xd8, 0x06, 0x00, 0x01, 0x00, 0xda, 0x06,
+ 0x00, 0x01, 0x00, 0xdc, 0x06, 0x00, 0x00, 0x00,
+ 0xd0, 0x06, 0x00, 0x01, 0x00, 0xde, 0x06, 0x00,
+ 0x02, 0x00, 0xa8, 0x06, 0x00, 0x03, 0x00, 0xbc,
+ 0x06, 0x00, 0x04, 0x00, 0xba, 0x06, 0x00, 0x05,
+ 0x00, 0xde, 0x04, 0x03, 0x01, 0xd5, 0xba, 0xa2,
+ 0xcd, 0xb9, 0xcf, 0xc9, 0xba, 0xb1, 0xb9, 0xad,
+ 0xee, 0x09, 0xc9, 0xba, 0xa5, 0xcd, 0x97, 0x02,
+ 0xf0, 0xf2, 0xe1, 0xed, 0xd6, 0xa7, 0xee, 0x04,
+ 0xe1, 0xed, 0xda, 0xb9, 0xc7, 0x04, 0xc6, 0x04,
+ 0xd6, 0xa7, 0xee, 0x4a, 0xe1, 0xc6, 0x04, 0x47,
+ 0xc7, 0x05, 0x38, 0xe2, 0x00, 0x00, 0x00, 0x42,
+ 0xf2, 0x00, 0x00, 0x00, 0xc6, 0x05, 0xc9, 0xd5,
+ 0x24, 0x03, 0x00, 0xd2, 0xba, 0xad, 0x11, 0xef,
+ 0x07, 0x0e, 0xca, 0xd5, 0xba, 0xa2, 0xad, 0xef,
+ 0x21, 0xba, 0xd0, 0xcc, 0xcb, 0xa7, 0xee, 0x18,
+ 0xca, 0xca, 0x9e, 0xd5, 0xb6, 0xd2, 0xba, 0xad,
+ 0xee, 0x03, 0x09, 0x28, 0xca, 0xd5, 0xba, 0xa2,
+ 0xad, 0xef, 0x07, 0x97, 0x03, 0xf0, 0xe5, 0x09,
+ 0x28, 0x97, 0x04, 0xf0, 0xb2, 0x0a, 0x28, 0xd6,
+ 0x04, 0x7f, 0x17, 0x04, 0x17, 0x0d, 0x26, 0x17,
+ 0x0d, 0x0d, 0x21, 0x12, 0x30, 0x21, 0x5d, 0x3a,
+ 0x0d, 0x26, 0x21, 0x17, 0x0d, 0x1c, 0x0d, 0x17,
+ 0x08, 0x1c, 0x0e, 0x43, 0x06, 0x05, 0xe2, 0x04,
+ 0x02, 0x02, 0x02, 0x04, 0x01, 0x00, 0x2e, 0x04,
+ 0xba, 0x06, 0x00, 0x01, 0x00, 0xbe, 0x06, 0x00,
+ 0x01, 0x00, 0xa8, 0x06, 0x00, 0x00, 0x00, 0xd0,
+ 0x06, 0x00, 0x01, 0x00, 0xe2, 0x04, 0x05, 0x01,
+ 0xd6, 0xd5, 0xa2, 0xbe, 0xa8, 0xee, 0x16, 0xd5,
+ 0xce, 0xd5, 0xba, 0xa1, 0xcd, 0xc9, 0xd6, 0xa8,
+ 0xee, 0x09, 0xca, 0xc9, 0x9e, 0xce, 0x97, 0x00,
+ 0xf0, 0xf4, 0xca, 0x28, 0xd5, 0xd6, 0xa1, 0xba,
+ 0xa5, 0xcd, 0xe1, 0xd5, 0xc9, 0xf4, 0xe1, 0xc9,
+ 0xba, 0xa1, 0xd6, 0xf4, 0x9e, 0x28, 0xd6, 0x04,
+ 0x9a, 0x01, 0x08, 0x04, 0x26, 0x0d, 0x30, 0x2b,
+ 0x08, 0x0a, 0x21, 0x0e, 0x42, 0x07, 0x05, 0x00,
+ 0x02, 0x00, 0x02, 0x04, 0x00, 0x00, 0x26, 0x02,
+ 0xba, 0x06, 0x00, 0x01, 0x00, 0xbe, 0x06, 0x00,
+ 0x01, 0x00, 0x38, 0x72, 0x01, 0x00, 0x00, 0xee,
+ 0x10, 0x38, 0xe4, 0x00, 0x00, 0x00, 0x42, 0x80,
+ 0x01, 0x00, 0x00, 0xd5, 0xd6, 0x25, 0x02, 0x00,
+ 0x38, 0xe3, 0x00, 0x00, 0x00, 0xd5, 0xf3, 0x38,
+ 0xe3, 0x00, 0x00, 0x00, 0xd6, 0xf3, 0x9f, 0x28,
+ 0xd6, 0x04, 0xac, 0x01, 0x03, 0x03, 0x26, 0x4f,
+ 0x0e, 0x42, 0x07, 0x05, 0x00, 0x02, 0x00, 0x02,
+ 0x03, 0x01, 0x00, 0x1d, 0x02, 0xba, 0x06, 0x00,
+ 0x01, 0x00, 0xbe, 0x06, 0x00, 0x01, 0x00, 0xdc,
+ 0x04, 0x02, 0x01, 0x38, 0x72, 0x01, 0x00, 0x00,
+ 0xee, 0x07, 0xe1, 0xd5, 0xd6, 0x23, 0x02, 0x00,
+ 0x38, 0xe3, 0x00, 0x00, 0x00, 0xd5, 0xf3, 0x38,
+ 0xe3, 0x00, 0x00, 0x00, 0xd6, 0xf3, 0xa3, 0x28,
+ 0xd6, 0x04, 0xb3, 0x01, 0x03, 0x03, 0x26, 0x22,
+ 0x0e, 0x42, 0x07, 0x05, 0x00, 0x01, 0x00, 0x01,
+ 0x03, 0x00, 0x00, 0x27, 0x01, 0xba, 0x06, 0x00,
+ 0x01, 0x00, 0xd5, 0x9b, 0x04, 0x8a, 0x00, 0x00,
+ 0x00, 0xaf, 0x11, 0xef, 0x1c, 0x0e, 0xd5, 0x9b,
+ 0x04, 0x46, 0x00, 0x00, 0x00, 0xaf, 0x11, 0xee,
+ 0x10, 0x0e, 0x38, 0x97, 0x00, 0x00, 0x00, 0x42,
+ 0xb0, 0x01, 0x00, 0x00, 0xd5, 0x24, 0x01, 0x00,
+ 0x28, 0xd6, 0x04, 0xbd, 0x01, 0x02, 0x04, 0x3f,
+ 0x0e, 0x42, 0x07, 0x05, 0x00, 0x02, 0x01, 0x02,
+ 0x02, 0x00, 0x00, 0x11, 0x03, 0xba, 0x06, 0x00,
+ 0x01, 0x00, 0xbe, 0x06, 0x00, 0x01, 0x00, 0xd0,
+ 0x06, 0x00, 0x00, 0x00, 0xd6, 0xb9, 0xae, 0xee,
+ 0x0b, 0xd5, 0xd6, 0xb6, 0xcd, 0xd6, 0xd9, 0xc9,
+ 0xda, 0xf0, 0xf2, 0xd5, 0x28, 0xd6, 0x04, 0xc2,
+ 0x01, 0x06, 0x04, 0x1c, 0x17, 0x0d, 0x0d, 0x0d,
+ 0x0e, 0x42, 0x07, 0x05, 0x00, 0x01, 0x00, 0x01,
+ 0x03, 0x01, 0x00, 0x0c, 0x01, 0xd8, 0x06, 0x00,
+ 0x01, 0x00, 0xe2, 0x04, 0x05, 0x01, 0xd5, 0xb9,
+ 0xa8, 0xee, 0x03, 0xba, 0x28, 0xe1, 0xba, 0xd5,
+ 0xf4, 0x28, 0xd6, 0x04, 0xcb, 0x01, 0x01, 0x03,
+ 0x0e, 0x42, 0x07, 0x05, 0x00, 0x02, 0x00, 0x02,
+ 0x06, 0x01, 0x00, 0x39, 0x02, 0xd8, 0x06, 0x00,
+ 0x01, 0x00, 0xc0, 0x06, 0x00, 0x01, 0x00, 0xe2,
+ 0x04, 0x05, 0x01, 0xd6, 0xb9, 0xa7, 0x11, 0xef,
+ 0x05, 0x0e, 0xd6, 0xd5, 0xa9, 0xee, 0x03, 0xb9,
+ 0x28, 0xd6, 0xd5, 0xd6, 0xa2, 0xa9, 0xee, 0x05,
+ 0xd5, 0xd6, 0xa2, 0xda, 0xd6, 0xb9, 0xad, 0xee,
+ 0x03, 0xba, 0x28, 0x38, 0xe2, 0x00, 0x00, 0x00,
+ 0x42, 0xb1, 0x01, 0x00, 0x00, 0xe1, 0xd5, 0xd6,
+ 0xa2, 0xba, 0xa1, 0xd5, 0xf4, 0xe1, 0xba, 0xd6,
+ 0xf4, 0x25, 0x02, 0x00, 0xd6, 0x04, 0xcf, 0x01,
+ 0x07, 0x03, 0x3f, 0x0d, 0x26, 0x17, 0x1c, 0x0d,
+ 0x0e, 0x42, 0x07, 0x05, 0x00, 0x02, 0x06, 0x02,
+ 0x04, 0x00, 0x00, 0x4f, 0x08, 0xe4, 0x06, 0x00,
+ 0x01, 0x00, 0xe6, 0x06, 0x00, 0x01, 0x00, 0xe8,
+ 0x06, 0x00, 0x00, 0x00, 0xea, 0x06, 0x00, 0x01,
+ 0x00, 0xec, 0x06, 0x00, 0x02, 0x00, 0xba, 0x06,
+ 0x00, 0x03, 0x00, 0xee, 0x06, 0x00, 0x04, 0x00,
+ 0xda, 0x06, 0x00, 0x05, 0x00, 0xd5, 0xce, 0xd6,
+ 0xcf, 0xba, 0xc7, 0x04, 0xb9, 0xd0, 0xca, 0xb9,
+ 0xae, 0xee, 0x2d, 0x38, 0xe2, 0x00, 0x00, 0x00,
+ 0x42, 0xb8, 0x01, 0x00, 0x00, 0xcb, 0xca, 0x24,
+ 0x02, 0x00, 0xc8, 0x05, 0xb9, 0x47, 0xcd, 0xca,
+ 0xcf, 0xc6, 0x05, 0xba, 0x47, 0xce, 0xc6, 0x04,
+ 0xc7, 0x05, 0xcc, 0xc9, 0xc6, 0x04, 0x9e, 0xa2,
+ 0xc7, 0x04, 0xc6, 0x05, 0xd0, 0xf0, 0xd0, 0xcb,
+ 0xba, 0xae, 0xee, 0x0d, 0x38, 0xcd, 0x00, 0x00,
+ 0x00, 0x04, 0xb9, 0x01, 0x00, 0x00, 0xf3, 0x2f,
+ 0xcc, 0xd6, 0xb6, 0x28, 0xd6, 0x04, 0xd9, 0x01,
+ 0x10, 0x04, 0x0d, 0x0d, 0x12, 0x0d, 0x1c, 0x58,
+ 0x12, 0x0d, 0x1c, 0x17, 0x2b, 0x12, 0x0e, 0x1c,
+ 0x3f, 0x0e, 0x42, 0x07, 0x05, 0x00, 0x03, 0x01,
+ 0x03, 0x04, 0x00, 0x00, 0x3e, 0x04, 0xba, 0x06,
+ 0x00, 0x01, 0x00, 0xbe, 0x06, 0x00, 0x01, 0x00,
+ 0xf4, 0x06, 0x00, 0x01, 0x00, 0xd0, 0x06, 0x00,
+ 0x00, 0x00, 0xd6, 0xb9, 0xad, 0xee, 0x03, 0xba,
+ 0x28, 0xd6, 0xb9, 0xa7, 0xee, 0x14, 0x38, 0xe2,
+ 0x00, 0x00, 0x00, 0x42, 0xf3, 0x00, 0x00, 0x00,
+ 0xd5, 0xd7, 0x24, 0x02, 0x00, 0xd9, 0xd6, 0x90,
+ 0xda, 0xba, 0xcd, 0xd6, 0xba, 0xb1, 0xee, 0x07,
+ 0xc9, 0xd5, 0x9e, 0xd7, 0xb6, 0xcd, 0xd6, 0xba,
+ 0xa5, 0xde, 0xb9, 0xad, 0xef, 0x09, 0xd5, 0xd5,
+ 0x9e, 0xd7, 0xb6, 0xd9, 0xf0, 0xe6, 0xc9, 0x28,
+ 0xd6, 0x04, 0xee, 0x01, 0x0e, 0x04, 0x1c, 0x0d,
+ 0x1c, 0x53, 0x13, 0x0e, 0x1c, 0x22, 0x17, 0x0d,
+ 0x0d, 0x21, 0x0d, 0x0e, 0x42, 0x07, 0x05, 0x00,
+ 0x02, 0x03, 0x02, 0x03, 0x02, 0x00, 0x62, 0x05,
+ 0xd8, 0x06, 0x00, 0x01, 0x00, 0xda, 0x06, 0x00,
+ 0x01, 0x00, 0xa8, 0x06, 0x00, 0x00, 0x00, 0xdc,
+ 0x06, 0x00, 0x01, 0x00, 0xf6, 0x06, 0x00, 0x02,
+ 0x00, 0xde, 0x04, 0x03, 0x01, 0xe0, 0x04, 0x04,
+ 0x01, 0x38, 0xe2, 0x00, 0x00, 0x00, 0x42, 0x76,
+ 0x01, 0x00, 0x00, 0xd5, 0x24, 0x01, 0x00, 0x9a,
+ 0xee, 0x0d, 0x38, 0xd0, 0x00, 0x00, 0x00, 0x04,
+ 0xbc, 0x01, 0x00, 0x00, 0xf3, 0x2f, 0xd5, 0xba,
+ 0xa8, 0xee, 0x03, 0x09, 0x28, 0xe1, 0xed, 0xcf,
+ 0xb9, 0xcd, 0xc9, 0xcb, 0xa7, 0xee, 0x1f, 0xe1,
+ 0xc9, 0x47, 0xd2, 0xd5, 0xad, 0xee, 0x03, 0x0a,
+ 0x28, 0xca, 0xd5, 0xa9, 0xee, 0x03, 0x09, 0x28,
+ 0xd5, 0xca, 0xb6, 0xb9, 0xad, 0xee, 0x03, 0x09,
+ 0x28, 0x97, 0x00, 0xf0, 0xde, 0xd5, 0xca, 0xca,
+ 0x9e, 0xa7, 0xee, 0x03, 0x0a, 0x28, 0xd6, 0xf6,
+ 0xee, 0x04, 0xc1, 0x40, 0xda, 0xe2, 0xd5, 0xd6,
+ 0x23, 0x02, 0x00, 0xd6, 0x04, 0x85, 0x02, 0x13,
+ 0x04, 0x58, 0x3f, 0x1c, 0x0d, 0x13, 0x26, 0x17,
+ 0x17, 0x0d, 0x1c, 0x0d, 0x26, 0x0d, 0x17, 0x26,
+ 0x0d, 0x17, 0x12, 0x0e, 0x42, 0x07, 0x05, 0x00,
+ 0x01, 0x00, 0x01, 0x03, 0x00, 0x00, 0x39, 0x01,
+ 0xd8, 0x06, 0x00, 0x01, 0x00, 0x38, 0xe2, 0x00,
+ 0x00, 0x00, 0x42, 0x76, 0x01, 0x00, 0x00, 0xd5,
+ 0x24, 0x01, 0x00, 0x9a, 0xee, 0x0d, 0x38, 0xd0,
+ 0x00, 0x00, 0x00, 0x04, 0xbc, 0x01, 0x00, 0x00,
+ 0xf3, 0x2f, 0xd5, 0xba, 0xa7, 0xee, 0x03, 0xba,
+ 0xd9, 0xd5, 0x93, 0xd9, 0x38, 0xe2, 0x00, 0x00,
+ 0x00, 0x42, 0x28, 0x01, 0x00, 0x00, 0xd5, 0x24,
+ 0x01, 0x00, 0xee, 0xee, 0xd5, 0x28, 0xd6, 0x04,
+ 0x9c, 0x02, 0x08, 0x03, 0x58, 0x3f, 0x1c, 0x0e,
+ 0x12, 0x53, 0x08, 0x0e, 0x42, 0x07, 0x05, 0x00,
+ 0x01, 0x02, 0x01, 0x04, 0x00, 0x00, 0xbb, 0x01,
+ 0x03, 0xd8, 0x06, 0x00, 0x01, 0x00, 0xd0, 0x06,
+ 0x00, 0x00, 0x00, 0xdc, 0x06, 0x00, 0x01, 0x00,
+ 0x38, 0xe2, 0x00, 0x00, 0x00, 0x42, 0x76, 0x01,
+ 0x00, 0x00, 0xd5, 0x24, 0x01, 0x00, 0x9a, 0xee,
+ 0x0d, 0x38, 0xd0, 0x00, 0x00, 0x00, 0x04, 0xbc,
+ 0x01, 0x00, 0x00, 0xf3, 0x2f, 0x26, 0x00, 0x00,
+ 0xcd, 0x38, 0xfa, 0x00, 0x00, 0x00, 0xd5, 0xf3,
+ 0xba, 0xa8, 0xee, 0x0e, 0xc9, 0x42, 0xa4, 0x01,
+ 0x00, 0x00, 0xd5, 0x24, 0x01, 0x00, 0x0e, 0xc9,
+ 0x28, 0xd5, 0xb9, 0xa7, 0xee, 0x0f, 0xc9, 0x42,
+ 0xa4, 0x01, 0x00, 0x00, 0xb8, 0x24, 0x01, 0x00,
+ 0x0e, 0xd5, 0x90, 0xd9, 0xd5, 0xbb, 0xb6, 0xb9,
+ 0xad, 0xee, 0x12, 0xd5, 0xba, 0xa5, 0xd9, 0xc9,
+ 0x42, 0xa4, 0x01, 0x00, 0x00, 0xbb, 0x24, 0x01,
+ 0x00, 0x0e, 0xf0, 0xe9, 0xbc, 0xce, 0xd5, 0xba,
+ 0xae, 0xee, 0x4f, 0x38, 0xe2, 0x00, 0x00, 0x00,
+ 0x42, 0x28, 0x01, 0x00, 0x00, 0xd5, 0x24, 0x01,
+ 0x00, 0xee, 0x0e, 0xc9, 0x42, 0xa4, 0x01, 0x00,
+ 0x00, 0xd5, 0x24, 0x01, 0x00, 0x0e, 0xf0, 0x32,
+ 0xd5, 0xca, 0xb6, 0xb9, 0xad, 0xef, 0x06, 0xbb,
+ 0x98, 0x01, 0xf0, 0xf5, 0xc9, 0x42, 0xa4, 0x01,
+ 0x00, 0x00, 0xca, 0x24, 0x01, 0x00, 0x0e, 0x38,
+ 0xe2, 0x00, 0x00, 0x00, 0x42, 0xb1, 0x01, 0x00,
+ 0x00, 0xd5, 0xca, 0x24, 0x02, 0x00, 0xdd, 0xca,
+ 0xb6, 0xb9, 0xae, 0xef, 0x03, 0xf0, 0xde, 0xf0,
+ 0xae, 0xc9, 0x28, 0xd6, 0x04, 0xa7, 0x02, 0x20,
+ 0x04, 0x58, 0x3f, 0x17, 0x3a, 0x3a, 0x08, 0x08,
+ 0x1c, 0x3a, 0x14, 0x26, 0x17, 0x3a, 0x0e, 0x0d,
+ 0x1c, 0x53, 0x3a, 0x00, 0x02, 0x08, 0x1c, 0x0d,
+ 0x12, 0x0e, 0x3a, 0x53, 0x17, 0x0d, 0x0d, 0x0d,
+ 0x0e, 0x42, 0x07, 0x05, 0x00, 0x00, 0x01, 0x00,
+ 0x02, 0x00, 0x00, 0x06, 0x01, 0x10, 0x00, 0x01,
+ 0x00, 0x08, 0xcd, 0xba, 0xc9, 0x9f, 0x28, 0xd6,
+ 0x04, 0xd2, 0x02, 0x01, 0x0d, 0x0e, 0x42, 0x07,
+ 0x05, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x00,
+ 0x06, 0x01, 0x10, 0x00, 0x01, 0x00, 0x08, 0xcd,
+ 0xc9, 0xc9, 0x9e, 0x28, 0xd6, 0x04, 0xd5, 0x02,
+ 0x01, 0x0d, 0x0e, 0x42, 0x07, 0x05, 0x00, 0x00,
+ 0x02, 0x00, 0x02, 0x00, 0x00, 0x0d, 0x02, 0xec,
+ 0x06, 0x00, 0x00, 0x00, 0x10, 0x00, 0x01, 0x00,
+ 0x08, 0xce, 0xca, 0xd1, 0xb9, 0xa7, 0xee, 0x04,
+ 0xc9, 0x90, 0xcd, 0xc9, 0x28, 0xd6, 0x04, 0xd8,
+ 0x02, 0x04, 0x0d, 0x0d, 0x17, 0x12, 0x0e, 0x42,
+ 0x07, 0x05, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00,
+ 0x00, 0x04, 0x01, 0x10, 0x00, 0x01, 0x00, 0x08,
+ 0xcd, 0xc9, 0x28, 0xd6, 0x04, 0xde, 0x02, 0x01,
+ 0x0d, 0x0e, 0x42, 0x07, 0x05, 0x00, 0x00, 0x01,
+ 0x00, 0x02, 0x00, 0x00, 0x14, 0x01, 0x10, 0x00,
+ 0x01, 0x00, 0x08, 0xcd, 0xc9, 0xb9, 0xaa, 0xee,
+ 0x03, 0xb9, 0x28, 0x38, 0xe3, 0x00, 0x00, 0x00,
+ 0x41, 0x27, 0x01, 0x00, 0x00, 0x28, 0xd6, 0x04,
+ 0xe1, 0x02, 0x04, 0x0d, 0x1c, 0x08, 0x08, 0x0e,
+ 0x42, 0x07, 0x05, 0x00, 0x00, 0x01, 0x00, 0x03,
+ 0x00, 0x00, 0x17, 0x01, 0x10, 0x00, 0x01, 0x00,
+ 0x08, 0xcd, 0xc9, 0xb9, 0xad, 0xee, 0x03, 0xba,
+ 0x28, 0x38, 0xe3, 0x00, 0x00, 0x00, 0x42, 0x02,
+ 0x01, 0x00, 0x00, 0xc9, 0x25, 0x01, 0x00, 0xd6,
+ 0x04, 0xe7, 0x02, 0x04, 0x0d, 0x1c, 0x08, 0x08,
+ 0x0e, 0x42, 0x07, 0x05, 0x00, 0x00, 0x01, 0x00,
+ 0x02, 0x00, 0x00, 0x18, 0x01, 0x10, 0x00, 0x01,
+ 0x00, 0x08, 0xcd, 0xc9, 0xba, 0xad, 0xee, 0x03,
+ 0xb9, 0x28, 0x38, 0xe3, 0x00, 0x00, 0x00, 0xc9,
+ 0xf3, 0x42, 0x03, 0x01, 0x00, 0x00, 0x25, 0x00,
+ 0x00, 0xd6, 0x04, 0xed, 0x02, 0x04, 0x0d, 0x1c,
+ 0x08, 0x08, 0x0e, 0x43, 0x06, 0x05, 0xc8, 0x03,
+ 0x02, 0x05, 0x02, 0x04, 0x00, 0x00, 0xd4, 0x01,
+ 0x07, 0xba, 0x06, 0x00, 0x01, 0x00, 0xbe, 0x06,
+ 0x00, 0x01, 0x00, 0xdc, 0x06, 0x00, 0x00, 0x00,
+ 0xd0, 0x06, 0x00, 0x01, 0x00, 0xa4, 0x06, 0x00,
+ 0x02, 0x00, 0xe0, 0x01, 0x00, 0x01, 0x00, 0xc8,
+ 0x03, 0x00, 0x01, 0x30, 0x0c, 0x03, 0xd0, 0x0c,
+ 0x02, 0xc7, 0x04, 0xcc, 0xee, 0x0d, 0x38, 0xd0,
+ 0x00, 0x00, 0x00, 0x04, 0xbd, 0x01, 0x00, 0x00,
+ 0xf3, 0x2f, 0xd5, 0xc6, 0x04, 0xab, 0xee, 0x03,
+ 0xd5, 0x28, 0x38, 0xe2, 0x00, 0x00, 0x00, 0x42,
+ 0x76, 0x01, 0x00, 0x00, 0xd5, 0x24, 0x01, 0x00,
+ 0x9a, 0xee, 0x0d, 0x38, 0xd0, 0x00, 0x00, 0x00,
+ 0x04, 0xbe, 0x01, 0x00, 0x00, 0xf3, 0x2f, 0xd6,
+ 0xf6, 0xee, 0x05, 0xba, 0xda, 0xf0, 0x6e, 0x38,
+ 0xe2, 0x00, 0x00, 0x00, 0x42, 0x76, 0x01, 0x00,
+ 0x00, 0xd6, 0x24, 0x01, 0x00, 0x9a, 0xee, 0x0d,
+ 0x38, 0xd0, 0x00, 0x00, 0x00, 0x04, 0xbe, 0x01,
+ 0x00, 0x00, 0xf3, 0x2f, 0xd6, 0xb9, 0xad, 0xee,
+ 0x0d, 0x38, 0xcd, 0x00, 0x00, 0x00, 0x04, 0xbf,
+ 0x01, 0x00, 0x00, 0xf3, 0x2f, 0x38, 0xe2, 0x00,
+ 0x00, 0x00, 0x42, 0xef, 0x00, 0x00, 0x00, 0xd5,
+ 0xd6, 0x24, 0x02, 0x00, 0xd1, 0xba, 0xae, 0xee,
+ 0x21, 0x38, 0xe2, 0x00, 0x00, 0x00, 0x42, 0xb1,
+ 0x01, 0x00, 0x00, 0xd5, 0xc9, 0x24, 0x02, 0x00,
+ 0xd9, 0x38, 0xe2, 0x00, 0x00, 0x00, 0x42, 0xb1,
+ 0x01, 0x00, 0x00, 0xd6, 0xc9, 0x24, 0x02, 0x00,
+ 0xda, 0xd6, 0xb9, 0xa7, 0xee, 0x07, 0xd5, 0x90,
+ 0xd9, 0xd6, 0x90, 0xda, 0x38, 0x94, 0x00, 0x00,
+ 0x00, 0x42, 0xa6, 0x01, 0x00, 0x00, 0xc6, 0x04,
+ 0x41, 0x3b, 0x00, 0x00, 0x00, 0x24, 0x01, 0x00,
+ 0xd3, 0xd5, 0x43, 0xc0, 0x01, 0x00, 0x00, 0xcb,
+ 0xd6, 0x43, 0xc1, 0x01, 0x00, 0x00, 0xcb, 0x28,
+ 0xd6, 0x04, 0xf7, 0x02, 0x1c, 0x00, 0x07, 0x08,
+ 0x12, 0x3f, 0x21, 0x0d, 0x58, 0x3f, 0x17, 0x0d,
+ 0x0d, 0x58, 0x3f, 0x1c, 0x3f, 0x53, 0x17, 0x53,
+ 0x00, 0x10, 0x08, 0x1c, 0x12, 0x14, 0x6c, 0x21,
+ 0x26, 0x0e, 0x43, 0x06, 0x05, 0xe4, 0x04, 0x02,
+ 0x00, 0x02, 0x05, 0x00, 0x00, 0x45, 0x02, 0xba,
+ 0x06, 0x00, 0x01, 0x00, 0xbe, 0x06, 0x00, 0x01,
+ 0x00, 0x38, 0xe4, 0x00, 0x00, 0x00, 0xd5, 0xf3,
+ 0xd9, 0x38, 0xe4, 0x00, 0x00, 0x00, 0xd6, 0xf3,
+ 0xda, 0x38, 0xe4, 0x00, 0x00, 0x00, 0x42, 0x80,
+ 0x01, 0x00, 0x00, 0xd5, 0x41, 0xc0, 0x01, 0x00,
+ 0x00, 0xd6, 0x41, 0xc1, 0x01, 0x00, 0x00, 0x9e,
+ 0xd5, 0x41, 0xc1, 0x01, 0x00, 0x00, 0xd6, 0x41,
+ 0xc0, 0x01, 0x00, 0x00, 0x9e, 0xa1, 0xd5, 0x41,
+ 0xc1, 0x01, 0x00, 0x00, 0xd6, 0x41, 0xc1, 0x01,
+ 0x00, 0x00, 0x9e, 0x25, 0x02, 0x00, 0xd6, 0x04,
+ 0x9a, 0x03, 0x03, 0x03, 0x2b, 0x2b, 0x0e, 0x43,
+ 0x06, 0x05, 0xe6, 0x04, 0x02, 0x00, 0x02, 0x05,
+ 0x00, 0x00, 0x45, 0x02, 0xba, 0x06, 0x00, 0x01,
+ 0x00, 0xbe, 0x06, 0x00, 0x01, 0x00, 0x38, 0xe4,
+ 0x00, 0x00, 0x00, 0xd5, 0xf3, 0xd9, 0x38, 0xe4,
+ 0x00, 0x00, 0x00, 0xd6, 0xf3, 0xda, 0x38, 0xe4,
+ 0x00, 0x00, 0x00, 0x42, 0x80, 0x01, 0x00, 0x00,
+ 0xd5, 0x41, 0xc0, 0x01, 0x00, 0x00, 0xd6, 0x41,
+ 0xc1, 0x01, 0x00, 0x00, 0x9e, 0xd5, 0x41, 0xc1,
+ 0x01, 0x00, 0x00, 0xd6, 0x41, 0xc0, 0x01, 0x00,
+ 0x00, 0x9e, 0xa2, 0xd5, 0x41, 0xc1, 0x01, 0x00,
+ 0x00, 0xd6, 0x41, 0xc1, 0x01, 0x00, 0x00, 0x9e,
+ 0x25, 0x02, 0x00, 0xd6, 0x04, 0x9f, 0x03, 0x03,
+ 0x03, 0x2b, 0x2b, 0x0e, 0x43, 0x06, 0x05, 0xe8,
+ 0x04, 0x02, 0x00, 0x02, 0x05, 0x00, 0x00, 0x37,
+ 0x02, 0xba, 0x06, 0x00, 0x01, 0x00, 0xbe, 0x06,
+ 0x00, 0x01, 0x00, 0x38, 0xe4, 0x00, 0x00, 0x00,
+ 0xd5, 0xf3, 0xd9, 0x38, 0xe4, 0x00, 0x00, 0x00,
+ 0xd6, 0xf3, 0xda, 0x38, 0xe4, 0x00, 0x00, 0x00,
+ 0x42, 0x80, 0x01, 0x00, 0x00, 0xd5, 0x41, 0xc0,
+ 0x01, 0x00, 0x00, 0xd6, 0x41, 0xc0, 0x01, 0x00,
+ 0x00, 0x9e, 0xd5, 0x41, 0xc1, 0x01, 0x00, 0x00,
+ 0xd6, 0x41, 0xc1, 0x01, 0x00, 0x00, 0x9e, 0x25,
+ 0x02, 0x00, 0xd6, 0x04, 0xa4, 0x03, 0x03, 0x03,
+ 0x2b, 0x2b, 0x0e, 0x43, 0x06, 0x05, 0xea, 0x04,
+ 0x02, 0x00, 0x02, 0x05, 0x00, 0x00, 0x37, 0x02,
+ 0xba, 0x06, 0x00, 0x01, 0x00, 0xbe, 0x06, 0x00,
+ 0x01, 0x00, 0x38, 0xe4, 0x00, 0x00, 0x00, 0xd5,
+ 0xf3, 0xd9, 0x38, 0xe4, 0x00, 0x00, 0x00, 0xd6,
+ 0xf3, 0xda, 0x38, 0xe4, 0x00, 0x00, 0x00, 0x42,
+ 0x80, 0x01, 0x00, 0x00, 0xd5, 0x41, 0xc0, 0x01,
+ 0x00, 0x00, 0xd6, 0x41, 0xc1, 0x01, 0x00, 0x00,
+ 0x9e, 0xd5, 0x41, 0xc1, 0x01, 0x00, 0x00, 0xd6,
+ 0x41, 0xc0, 0x01, 0x00, 0x00, 0x9e, 0x25, 0x02,
+ 0x00, 0xd6, 0x04, 0xa9, 0x03, 0x03, 0x03, 0x2b,
+ 0x2b, 0x0e, 0x43, 0x06, 0x05, 0xec, 0x04, 0x02,
+ 0x02, 0x02, 0x06, 0x00, 0x00, 0x3c, 0x04, 0xba,
+ 0x06, 0x00, 0x01, 0x00, 0xbe, 0x06, 0x00, 0x01,
+ 0x00, 0x84, 0x07, 0x00, 0x00, 0x00, 0x86, 0x07,
+ 0x00, 0x01, 0x00, 0x38, 0xe4, 0x00, 0x00, 0x00,
+ 0xd5, 0xf3, 0xcd, 0x38, 0xe4, 0x00, 0x00, 0x00,
+ 0xd6, 0xf3, 0xce, 0xd5, 0x38, 0xe2, 0x00, 0x00,
+ 0x00, 0x42, 0xc4, 0x01, 0x00, 0x00, 0xc9, 0x41,
+ 0xc0, 0x01, 0x00, 0x00, 0xca, 0x41, 0xc1, 0x01,
+ 0x00, 0x00, 0x9e, 0xc9, 0x41, 0xc1, 0x01, 0x00,
+ 0x00, 0xca, 0x41, 0xc0, 0x01, 0x00, 0x00, 0x9e,
+ 0x24, 0x02, 0x00, 0xd6, 0x9e, 0xa2, 0x28, 0xd6,
+ 0x04, 0xae, 0x03, 0x03, 0x03, 0x2b, 0x2b, 0x0e,
+ 0x43, 0x06, 0x05, 0xee, 0x04, 0x02, 0x00, 0x02,
+ 0x02, 0x00, 0x00, 0x2f, 0x02, 0xba, 0x06, 0x00,
+ 0x01, 0x00, 0xbe, 0x06, 0x00, 0x01, 0x00, 0x38,
+ 0xe4, 0x00, 0x00, 0x00, 0xd5, 0xf3, 0xd9, 0x38,
+ 0xe4, 0x00, 0x00, 0x00, 0xd6, 0xf3, 0xda, 0xd5,
+ 0x41, 0xc0, 0x01, 0x00, 0x00, 0xd6, 0x41, 0xc0,
+ 0x01, 0x00, 0x00, 0xad, 0x11, 0xee, 0x0f, 0x0e,
+ 0xd5, 0x41, 0xc1, 0x01, 0x00, 0x00, 0xd6, 0x41,
+ 0xc1, 0x01, 0x00, 0x00, 0xad, 0x28, 0xd6, 0x04,
+ 0xb3, 0x03, 0x03, 0x03, 0x2b, 0x2c, 0x0e, 0x43,
+ 0x06, 0x05, 0xf0, 0x04, 0x02, 0x00, 0x02, 0x03,
+ 0x00, 0x00, 0x2c, 0x02, 0xba, 0x06, 0x00, 0x01,
+ 0x00, 0xbe, 0x06, 0x00, 0x01, 0x00, 0x38, 0xe4,
+ 0x00, 0x00, 0x00, 0xd5, 0xf3, 0xd9, 0x38, 0xe4,
+ 0x00, 0x00, 0x00, 0xd6, 0xf3, 0xda, 0xd5, 0x41,
+ 0xc0, 0x01, 0x00, 0x00, 0xd6, 0x41, 0xc1, 0x01,
+ 0x00, 0x00, 0x9e, 0xd6, 0x41, 0xc0, 0x01, 0x00,
+ 0x00, 0xd5, 0x41, 0xc1, 0x01, 0x00, 0x00, 0x9e,
+ 0xa7, 0x28, 0xd6, 0x04, 0xb9, 0x03, 0x03, 0x03,
+ 0x2b, 0x2b, 0x0e, 0x43, 0x06, 0x05, 0xf2, 0x04,
+ 0x02, 0x00, 0x02, 0x03, 0x00, 0x00, 0x10, 0x02,
+ 0xba, 0x06, 0x00, 0x01, 0x00, 0xbe, 0x06, 0x00,
+ 0x01, 0x00, 0x38, 0xe3, 0x00, 0x00, 0x00, 0xd5,
+ 0xf3, 0x38, 0xe3, 0x00, 0x00, 0x00, 0xd6, 0xf3,
+ 0xa1, 0x28, 0xd6, 0x04, 0xc0, 0x03, 0x01, 0x03,
+ 0x0e, 0x43, 0x06, 0x05, 0xf4, 0x04, 0x02, 0x00,
+ 0x02, 0x03, 0x00, 0x00, 0x10, 0x02, 0xba, 0x06,
+ 0x00, 0x01, 0x00, 0xbe, 0x06, 0x00, 0x01, 0x00,
+ 0x38, 0xe3, 0x00, 0x00, 0x00, 0xd5, 0xf3, 0x38,
+ 0xe3, 0x00, 0x00, 0x00, 0xd6, 0xf3, 0xa2, 0x28,
+ 0xd6, 0x04, 0xc3, 0x03, 0x01, 0x03, 0x0e, 0x43,
+ 0x06, 0x05, 0xf6, 0x04, 0x02, 0x00, 0x02, 0x03,
+ 0x00, 0x00, 0x10, 0x02, 0xba, 0x06, 0x00, 0x01,
+ 0x00, 0xbe, 0x06, 0x00, 0x01, 0x00, 0x38, 0xe3,
+ 0x00, 0x00, 0x00, 0xd5, 0xf3, 0x38, 0xe3, 0x00,
+ 0x00, 0x00, 0xd6, 0xf3, 0x9e, 0x28, 0xd6, 0x04,
+ 0xc6, 0x03, 0x01, 0x03, 0x0e, 0x43, 0x06, 0x05,
+ 0xf8, 0x04, 0x02, 0x00, 0x02, 0x03, 0x00, 0x00,
+ 0x10, 0x02, 0xba, 0x06, 0x00, 0x01, 0x00, 0xbe,
+ 0x06, 0x00, 0x01, 0x00, 0x38, 0xe3, 0x00, 0x00,
+ 0x00, 0xd5, 0xf3, 0x38, 0xe3, 0x00, 0x00, 0x00,
+ 0xd6, 0xf3, 0x9f, 0x28, 0xd6, 0x04, 0xc9, 0x03,
+ 0x01, 0x03, 0x0e, 0x43, 0x06, 0x05, 0xfa, 0x04,
+ 0x02, 0x00, 0x02, 0x03, 0x00, 0x00, 0x10, 0x02,
+ 0xba, 0x06, 0x00, 0x01, 0x00, 0xbe, 0x06, 0x00,
+ 0x01, 0x00, 0x38, 0xe3, 0x00, 0x00, 0x00, 0xd5,
+ 0xf3, 0x38, 0xe3, 0x00, 0x00, 0x00, 0xd6, 0xf3,
+ 0xb6, 0x28, 0xd6, 0x04, 0xcc, 0x03, 0x01, 0x03,
+ 0x0e, 0x43, 0x06, 0x05, 0xfc, 0x04, 0x02, 0x00,
+ 0x02, 0x03, 0x00, 0x00, 0x10, 0x02, 0xba, 0x06,
+ 0x00, 0x01, 0x00, 0xbe, 0x06, 0x00, 0x01, 0x00,
+ 0x38, 0xe3, 0x00, 0x00, 0x00, 0xd5, 0xf3, 0x38,
+ 0xe3, 0x00, 0x00, 0x00, 0xd6, 0xf3, 0xa3, 0x28,
+ 0xd6, 0x04, 0xcf, 0x03, 0x01, 0x03, 0x0e, 0x43,
+ 0x06, 0x05, 0xfe, 0x04, 0x02, 0x00, 0x02, 0x03,
+ 0x00, 0x00, 0x10, 0x02, 0xba, 0x06, 0x00, 0x01,
+ 0x00, 0xbe, 0x06, 0x00, 0x01, 0x00, 0x38, 0xe3,
+ 0x00, 0x00, 0x00, 0xd5, 0xf3, 0x38, 0xe3, 0x00,
+ 0x00, 0x00, 0xd6, 0xf3, 0xaf, 0x28, 0xd6, 0x04,
+ 0xd2, 0x03, 0x01, 0x04, 0x0e, 0x43, 0x06, 0x05,
+ 0x80, 0x05, 0x02, 0x00, 0x02, 0x03, 0x00, 0x00,
+ 0x3c, 0x02, 0xba, 0x06, 0x00, 0x01, 0x00, 0xbe,
+ 0x06, 0x00, 0x01, 0x00, 0x38, 0xe3, 0x00, 0x00,
+ 0x00, 0xd5, 0xf3, 0xd9, 0x38, 0xe3, 0x00, 0x00,
+ 0x00, 0xd6, 0xf3, 0xda, 0x38, 0xe3, 0x00, 0x00,
+ 0x00, 0x42, 0xc5, 0x01, 0x00, 0x00, 0xd5, 0x24,
+ 0x01, 0x00, 0x11, 0xef, 0x10, 0x0e, 0x38, 0xe3,
+ 0x00, 0x00, 0x00, 0x42, 0xc5, 0x01, 0x00, 0x00,
+ 0xd6, 0x24, 0x01, 0x00, 0xee, 0x07, 0x38, 0x45,
+ 0x00, 0x00, 0x00, 0x28, 0xd5, 0xd6, 0xa7, 0x28,
+ 0xd6, 0x04, 0xd6, 0x03, 0x06, 0x03, 0x2b, 0x2c,
+ 0xad, 0x1c, 0x08, 0x0e, 0x42, 0x07, 0x05, 0x00,
+ 0x01, 0x00, 0x01, 0x01, 0x00, 0x00, 0x02, 0x01,
+ 0xba, 0x06, 0x00, 0x01, 0x00, 0xd5, 0x28, 0xd6,
+ 0x04, 0xea, 0x03, 0x01, 0x03, 0x0e, 0x42, 0x07,
+ 0x05, 0x00, 0x01, 0x00, 0x01, 0x03, 0x00, 0x00,
+ 0x15, 0x01, 0xba, 0x06, 0x00, 0x01, 0x00, 0x38,
+ 0xe4, 0x00, 0x00, 0x00, 0xd5, 0x41, 0xc0, 0x01,
+ 0x00, 0x00, 0x90, 0xd5, 0x41, 0xc1, 0x01, 0x00,
+ 0x00, 0x23, 0x02, 0x00, 0xd6, 0x04, 0xed, 0x03,
+ 0x01, 0x03, 0x0e, 0x42, 0x07, 0x05, 0x00, 0x02,
+ 0x01, 0x02, 0x03, 0x00, 0x00, 0x23, 0x03, 0xba,
+ 0x06, 0x00, 0x01, 0x00, 0xbe, 0x06, 0x00, 0x01,
+ 0x00, 0xd0, 0x06, 0x00, 0x00, 0x00, 0x38, 0xe4,
+ 0x00, 0x00, 0x00, 0xd5, 0xd6, 0xf4, 0xcd, 0x38,
+ 0x72, 0x01, 0x00, 0x00, 0xee, 0x12, 0xc9, 0x41,
+ 0xc1, 0x01, 0x00, 0x00, 0xba, 0xad, 0xee, 0x08,
+ 0xc9, 0x41, 0xc0, 0x01, 0x00, 0x00, 0x28, 0xc9,
+ 0x28, 0xd6, 0x04, 0x8c, 0x04, 0x05, 0x03, 0x30,
+ 0x58, 0x21, 0x08, 0x0e, 0x42, 0x07, 0x05, 0x00,
+ 0x01, 0x01, 0x01, 0x02, 0x00, 0x00, 0x28, 0x02,
+ 0x8c, 0x07, 0x00, 0x01, 0x00, 0x10, 0x00, 0x01,
+ 0x00, 0x08, 0xcd, 0xd5, 0x04, 0x48, 0x00, 0x00,
+ 0x00, 0xaf, 0xee, 0x0a, 0xc9, 0x42, 0x37, 0x00,
+ 0x00, 0x00, 0x25, 0x00, 0x00, 0x38, 0xe3, 0x00,
+ 0x00, 0x00, 0xc9, 0x41, 0xc0, 0x01, 0x00, 0x00,
+ 0xf3, 0xc9, 0x41, 0xc1, 0x01, 0x00, 0x00, 0x9f,
+ 0x28, 0xd6, 0x04, 0x96, 0x04, 0x03, 0x0d, 0x30,
+ 0x31, 0x0e, 0x42, 0x07, 0x05, 0x00, 0x00, 0x01,
+ 0x00, 0x03, 0x00, 0x00, 0x16, 0x01, 0x10, 0x00,
+ 0x01, 0x00, 0x08, 0xcd, 0x38, 0xe4, 0x00, 0x00,
+ 0x00, 0xc9, 0x41, 0xc1, 0x01, 0x00, 0x00, 0xc9,
+ 0x41, 0xc0, 0x01, 0x00, 0x00, 0x23, 0x02, 0x00,
+ 0xd6, 0x04, 0x9d, 0x04, 0x01, 0x0d, 0x0e, 0x42,
+ 0x07, 0x05, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00,
+ 0x00, 0x16, 0x01, 0x10, 0x00, 0x01, 0x00, 0x08,
+ 0xcd, 0xc9, 0x41, 0xc0, 0x01, 0x00, 0x00, 0x04,
+ 0x74, 0x01, 0x00, 0x00, 0xa1, 0xc9, 0x41, 0xc1,
+ 0x01, 0x00, 0x00, 0xa1, 0x28, 0xd6, 0x04, 0xa0,
+ 0x04, 0x01, 0x0d, 0x0e, 0x42, 0x07, 0x05, 0x00,
+ 0x00, 0x01, 0x00, 0x02, 0x00, 0x00, 0x06, 0x01,
+ 0x10, 0x00, 0x01, 0x00, 0x08, 0xcd, 0xc9, 0xc9,
+ 0x9e, 0x28, 0xd6, 0x04, 0xa3, 0x04, 0x01, 0x0d,
+ 0x0e, 0x42, 0x07, 0x05, 0x00, 0x00, 0x01, 0x00,
+ 0x02, 0x00, 0x00, 0x11, 0x01, 0x10, 0x00, 0x01,
+ 0x00, 0x08, 0xcd, 0xc9, 0x41, 0xc0, 0x01, 0x00,
+ 0x00, 0xb9, 0xa7, 0xee, 0x04, 0xc9, 0x90, 0x28,
+ 0xc9, 0x28, 0xd6, 0x04, 0xa6, 0x04, 0x04, 0x0d,
+ 0x35, 0x0d, 0x08, 0x0e, 0x42, 0x07, 0x05, 0x00,
+ 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x04, 0x01,
+ 0x10, 0x00, 0x01, 0x00, 0x08, 0xcd, 0xc9, 0x28,
+ 0xd6, 0x04, 0xac, 0x04, 0x01, 0x0d, 0x0e, 0x42,
+ 0x07, 0x05, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00,
+ 0x00, 0x19, 0x01, 0x10, 0x00, 0x01, 0x00, 0x08,
+ 0xcd, 0xc9, 0x41, 0xc0, 0x01, 0x00, 0x00, 0xb9,
+ 0xaa, 0xee, 0x03, 0xb9, 0x28, 0x38, 0xe3, 0x00,
+ 0x00, 0x00, 0x41, 0x27, 0x01, 0x00, 0x00, 0x28,
+ 0xd6, 0x04, 0xaf, 0x04, 0x04, 0x0d, 0x35, 0x08,
+ 0x08, 0x0e, 0x42, 0x07, 0x05, 0x00, 0x00, 0x01,
+ 0x00, 0x04, 0x00, 0x00, 0x16, 0x01, 0x10, 0x00,
+ 0x01, 0x00, 0x08, 0xcd, 0x38, 0xe3, 0x00, 0x00,
+ 0x00, 0x42, 0x02, 0x01, 0x00, 0x00, 0x38, 0xe3,
+ 0x00, 0x00, 0x00, 0xc9, 0xf3, 0x25, 0x01, 0x00,
+ 0xd6, 0x04, 0xb5, 0x04, 0x01, 0x0d, 0x0e, 0x42,
+ 0x07, 0x05, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00,
+ 0x00, 0x11, 0x01, 0x10, 0x00, 0x01, 0x00, 0x08,
+ 0xcd, 0x38, 0xe3, 0x00, 0x00, 0x00, 0xc9, 0xf3,
+ 0x42, 0x03, 0x01, 0x00, 0x00, 0x25, 0x00, 0x00,
+ 0xd6, 0x04, 0xb8, 0x04, 0x01, 0x0d, 0x0e, 0x42,
+ 0x07, 0x05, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00,
+ 0x00, 0x06, 0x01, 0x10, 0x00, 0x01, 0x00, 0x08,
+ 0xcd, 0xba, 0xc9, 0x9f, 0x28, 0xd6, 0x04, 0xc0,
+ 0x04, 0x01, 0x0d, 0x0e, 0x42, 0x07, 0x05, 0x00,
+ 0x00, 0x01, 0x00, 0x02, 0x00, 0x00, 0x06, 0x01,
+ 0x10, 0x00, 0x01, 0x00, 0x08, 0xcd, 0xc9, 0xc9,
+ 0x9e, 0x28, 0xd6, 0x04, 0xc3, 0x04, 0x01, 0x0d,
+ 0x0e, 0x42, 0x07, 0x05, 0x00, 0x00, 0x01, 0x00,
+ 0x03, 0x00, 0x00, 0x10, 0x01, 0x10, 0x00, 0x01,
+ 0x00, 0x08, 0xcd, 0x38, 0x9c, 0x00, 0x00, 0x00,
+ 0x42, 0xfa, 0x00, 0x00, 0x00, 0xc9, 0x25, 0x01,
+ 0x00, 0xd6, 0x04, 0xc6, 0x04, 0x01, 0x0d, 0x0e,
+ 0x42, 0x07, 0x05, 0x00, 0x00, 0x01, 0x00, 0x01,
+ 0x00, 0x00, 0x04, 0x01, 0x10, 0x00, 0x01, 0x00,
+ 0x08, 0xcd, 0xc9, 0x28, 0xd6, 0x04, 0xc9, 0x04,
+ 0x01, 0x0d, 0x0e, 0x42, 0x07, 0x05, 0x00, 0x00,
+ 0x01, 0x00, 0x02, 0x00, 0x00, 0x14, 0x01, 0x10,
+ 0x00, 0x01, 0x00, 0x08, 0xcd, 0xc9, 0xb9, 0xaa,
+ 0xee, 0x03, 0xb9, 0x28, 0x38, 0xe3, 0x00, 0x00,
+ 0x00, 0x41, 0x27, 0x01, 0x00, 0x00, 0x28, 0xd6,
+ 0x04, 0xcc, 0x04, 0x04, 0x0d, 0x1c, 0x08, 0x08,
+ 0x0e, 0x42, 0x07, 0x05, 0x00, 0x00, 0x01, 0x00,
+ 0x03, 0x00, 0x00, 0x10, 0x01, 0x10, 0x00, 0x01,
+ 0x00, 0x08, 0xcd, 0x38, 0xe3, 0x00, 0x00, 0x00,
+ 0x42, 0x02, 0x01, 0x00, 0x00, 0xc9, 0x25, 0x01,
+ 0x00, 0xd6, 0x04, 0xd2, 0x04, 0x01, 0x0d, 0x0e,
+ 0x42, 0x07, 0x05, 0x00, 0x00, 0x01, 0x00, 0x03,
+ 0x00, 0x00, 0x24, 0x01, 0x10, 0x00, 0x01, 0x00,
+ 0x08, 0xcd, 0xc9, 0xb9, 0xa7, 0xee, 0x10, 0x38,
+ 0xe5, 0x00, 0x00, 0x00, 0xc9, 0xf3, 0x42, 0x03,
+ 0x01, 0x00, 0x00, 0x25, 0x00, 0x00, 0x38, 0xe3,
+ 0x00, 0x00, 0x00, 0x42, 0x03, 0x01, 0x00, 0x00,
+ 0xc9, 0x25, 0x01, 0x00, 0xd6, 0x04, 0xd5, 0x04,
+ 0x03, 0x0d, 0x1c, 0x4f, 0x0e, 0x43, 0x06, 0x05,
+ 0x84, 0x05, 0x01, 0x03, 0x01, 0x05, 0x01, 0x01,
+ 0xcb, 0x01, 0x04, 0xd8, 0x06, 0x00, 0x01, 0x00,
+ 0xda, 0x06, 0x00, 0x00, 0x00, 0xee, 0x06, 0x00,
+ 0x01, 0x00, 0x8e, 0x07, 0x00, 0x02, 0x00, 0x82,
+ 0x05, 0x15, 0x01, 0xe1, 0xd5, 0x47, 0xcd, 0x38,
+ 0xb3, 0x00, 0x00, 0x00, 0x41, 0xc8, 0x01, 0x00,
+ 0x00, 0xcf, 0xc9, 0xee, 0x12, 0xc9, 0x41, 0xc8,
+ 0x01, 0x00, 0x00, 0xcb, 0xad, 0xee, 0x08, 0xc9,
+ 0x41, 0x95, 0x01, 0x00, 0x00, 0x28, 0xd5, 0x11,
+ 0xb9, 0xaf, 0xee, 0x12, 0x38, 0xe3, 0x00, 0x00,
+ 0x00, 0x42, 0x02, 0x01, 0x00, 0x00, 0xba, 0x24,
+ 0x01, 0x00, 0xce, 0xf0, 0x77, 0x11, 0xba, 0xaf,
+ 0xee, 0x13, 0x38, 0xe3, 0x00, 0x00, 0x00, 0x42,
+ 0x03, 0x01, 0x00, 0x00, 0xc1, 0x0a, 0x24, 0x01,
+ 0x00, 0xce, 0xf0, 0x60, 0x11, 0xbc, 0xaf, 0xee,
+ 0x14, 0xba, 0x38, 0xe3, 0x00, 0x00, 0x00, 0x42,
+ 0x03, 0x01, 0x00, 0x00, 0xbb, 0x24, 0x01, 0x00,
+ 0x9f, 0xce, 0xf0, 0x48, 0x11, 0xbd, 0xaf, 0xee,
+ 0x15, 0xba, 0x38, 0xe3, 0x00, 0x00, 0x00, 0x42,
+ 0x03, 0x01, 0x00, 0x00, 0xc1, 0x0a, 0x24, 0x01,
+ 0x00, 0x9f, 0xce, 0xf0, 0x2f, 0x11, 0xbf, 0xaf,
+ 0xee, 0x16, 0x38, 0xe3, 0x00, 0x00, 0x00, 0x42,
+ 0x01, 0x01, 0x00, 0x00, 0xc3, 0x00, 0xc1, 0xed,
+ 0xb5, 0x24, 0x01, 0x00, 0xce, 0xf0, 0x15, 0x11,
+ 0xc0, 0xaf, 0xee, 0x10, 0x38, 0xe3, 0x00, 0x00,
+ 0x00, 0x42, 0x01, 0x01, 0x00, 0x00, 0xbb, 0x24,
+ 0x01, 0x00, 0xce, 0x0e, 0xcb, 0xc2, 0x00, 0x04,
+ 0xa8, 0xee, 0x12, 0xe1, 0xd5, 0x74, 0x0b, 0xcb,
+ 0x4c, 0xc8, 0x01, 0x00, 0x00, 0xca, 0x4c, 0x95,
+ 0x01, 0x00, 0x00, 0x49, 0xca, 0x28, 0xd6, 0x04,
+ 0xe3, 0x04, 0x10, 0x04, 0x17, 0x3a, 0x44, 0x21,
+ 0x08, 0x08, 0x71, 0x77, 0x7b, 0x81, 0x85, 0x67,
+ 0x08, 0x26, 0x59, 0x0b, 0x88, 0x02, 0x06, 0xe8,
+ 0x89, 0x04, 0x23, 0xc7, 0x8a, 0x0e, 0x42, 0x07,
+ 0x05, 0x00, 0x01, 0x00, 0x01, 0x02, 0x00, 0x00,
+ 0x15, 0x01, 0xba, 0x06, 0x00, 0x01, 0x00, 0xd5,
+ 0x9b, 0x04, 0x46, 0x00, 0x00, 0x00, 0xaf, 0x11,
+ 0xef, 0x0a, 0x0e, 0xd5, 0x9b, 0x04, 0x8b, 0x00,
+ 0x00, 0x00, 0xaf, 0x28, 0xd6, 0x04, 0xfc, 0x04,
+ 0x01, 0x03, 0x0e, 0x42, 0x07, 0x05, 0x00, 0x02,
+ 0x07, 0x02, 0x04, 0x00, 0x01, 0x61, 0x09, 0xea,
+ 0x06, 0x00, 0x01, 0x00, 0xbe, 0x06, 0x00, 0x01,
+ 0x00, 0x92, 0x07, 0x00, 0x00, 0x00, 0x94, 0x07,
+ 0x00, 0x01, 0x00, 0x96, 0x07, 0x00, 0x02, 0x00,
+ 0x98, 0x07, 0x00, 0x03, 0x00, 0x80, 0x07, 0x00,
+ 0x04, 0x00, 0x82, 0x07, 0x00, 0x05, 0x00, 0xd8,
+ 0x06, 0x00, 0x06, 0x00, 0xd6, 0xf6, 0xee, 0x0d,
+ 0x38, 0xd0, 0x00, 0x00, 0x00, 0x04, 0xcd, 0x01,
+ 0x00, 0x00, 0xf3, 0x2f, 0xba, 0xcd, 0xb9, 0xce,
+ 0xb9, 0xcf, 0xba, 0xd0, 0x38, 0xe2, 0x00, 0x00,
+ 0x00, 0x38, 0xe3, 0x00, 0x00, 0x00, 0x42, 0xff,
+ 0x00, 0x00, 0x00, 0xd5, 0x24, 0x01, 0x00, 0xf3,
+ 0xc8, 0x06, 0xc9, 0x9e, 0xca, 0xa1, 0xc7, 0x04,
+ 0xc6, 0x06, 0xcb, 0x9e, 0xcc, 0xa1, 0xc8, 0x05,
+ 0xd6, 0xa9, 0xef, 0x18, 0xc3, 0x00, 0xc1, 0xee,
+ 0xb5, 0xd5, 0xc6, 0x06, 0xa2, 0x9f, 0xd9, 0xc9,
+ 0xce, 0xc6, 0x04, 0xcd, 0xcb, 0xd0, 0xc6, 0x05,
+ 0xcf, 0xf0, 0xc2, 0x38, 0xe4, 0x00, 0x00, 0x00,
+ 0xc9, 0xcb, 0x23, 0x02, 0x00, 0xd6, 0x04, 0xff,
+ 0x04, 0x12, 0x05, 0x17, 0x3f, 0x0d, 0x0d, 0x0d,
+ 0x0e, 0x71, 0x21, 0x2b, 0x0d, 0x0d, 0x3a, 0x0d,
+ 0x12, 0x0d, 0x12, 0x0d, 0x0b, 0xfc, 0x01, 0x06,
+ 0x40, 0x76, 0x3a, 0x6b, 0x0b, 0xde, 0x0e, 0x42,
+ 0x07, 0x05, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01,
+ 0x00, 0x05, 0x00, 0x84, 0x05, 0x16, 0x01, 0xe1,
+ 0xb9, 0x23, 0x01, 0x00, 0xd6, 0x04, 0x97, 0x05,
+ 0x00, 0x0e, 0x42, 0x07, 0x05, 0x00, 0x00, 0x00,
+ 0x00, 0x02, 0x01, 0x00, 0x05, 0x00, 0x84, 0x05,
+ 0x16, 0x01, 0xe1, 0xba, 0x23, 0x01, 0x00, 0xd6,
+ 0x04, 0x98, 0x05, 0x00, 0x0e, 0x42, 0x07, 0x05,
+ 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x05,
+ 0x00, 0x84, 0x05, 0x16, 0x01, 0xe1, 0xbc, 0x23,
+ 0x01, 0x00, 0xd6, 0x04, 0x9a, 0x05, 0x00, 0x0e,
+ 0x42, 0x07, 0x05, 0x00, 0x00, 0x00, 0x00, 0x02,
+ 0x01, 0x00, 0x05, 0x00, 0x84, 0x05, 0x16, 0x01,
+ 0xe1, 0xbd, 0x23, 0x01, 0x00, 0xd6, 0x04, 0x9b,
+ 0x05, 0x00, 0x0e, 0x42, 0x07, 0x05, 0x00, 0x00,
+ 0x00, 0x00, 0x02, 0x01, 0x00, 0x05, 0x00, 0x84,
+ 0x05, 0x16, 0x01, 0xe1, 0xbf, 0x23, 0x01, 0x00,
+ 0xd6, 0x04, 0x9d, 0x05, 0x00, 0x0e, 0x42, 0x07,
+ 0x05, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00,
+ 0x05, 0x00, 0x84, 0x05, 0x16, 0x01, 0xe1, 0xc0,
+ 0x23, 0x01, 0x00, 0xd6, 0x04, 0x9e, 0x05, 0x00,
+ 0x0e, 0x42, 0x07, 0x05, 0x00, 0x00, 0x01, 0x00,
+ 0x02, 0x00, 0x01, 0x0a, 0x01, 0x10, 0x00, 0x01,
+ 0x00, 0x08, 0xcd, 0xc3, 0x00, 0xc1, 0xee, 0xb5,
+ 0xc9, 0x9f, 0x28, 0xd6, 0x04, 0xa2, 0x05, 0x01,
+ 0x0d, 0x0b, 0xfc, 0x01, 0x06, 0x40, 0x76, 0x3a,
+ 0x6b, 0x0b, 0xde, 0x0e, 0x42, 0x07, 0x05, 0x00,
+ 0x00, 0x01, 0x00, 0x02, 0x00, 0x00, 0x06, 0x01,
+ 0x10, 0x00, 0x01, 0x00, 0x08, 0xcd, 0xc9, 0xc9,
+ 0x9e, 0x28, 0xd6, 0x04, 0xa5, 0x05, 0x01, 0x0d,
+ 0x0e, 0x42, 0x07, 0x05, 0x00, 0x00, 0x01, 0x00,
+ 0x03, 0x00, 0x00, 0x10, 0x01, 0x10, 0x00, 0x01,
+ 0x00, 0x08, 0xcd, 0x38, 0xe3, 0x00, 0x00, 0x00,
+ 0x42, 0xfa, 0x00, 0x00, 0x00, 0xc9, 0x25, 0x01,
+ 0x00, 0xd6, 0x04, 0xa8, 0x05, 0x01, 0x0d, 0x0e,
+ 0x42, 0x07, 0x05, 0x00, 0x00, 0x01, 0x00, 0x01,
+ 0x00, 0x00, 0x04, 0x01, 0x10, 0x00, 0x01, 0x00,
+ 0x08, 0xcd, 0xc9, 0x28, 0xd6, 0x04, 0xab, 0x05,
+ 0x01, 0x0d, 0x0e, 0x42, 0x07, 0x05, 0x00, 0x00,
+ 0x01, 0x00, 0x02, 0x00, 0x00, 0x14, 0x01, 0x10,
+ 0x00, 0x01, 0x00, 0x08, 0xcd, 0xc9, 0xb9, 0xaa,
+ 0xee, 0x03, 0xb9, 0x28, 0x38, 0xe3, 0x00, 0x00,
+ 0x00, 0x41, 0x27, 0x01, 0x00, 0x00, 0x28, 0xd6,
+ 0x04, 0xae, 0x05, 0x04, 0x0d, 0x1c, 0x08, 0x08,
+ 0x0e, 0x42, 0x07, 0x05, 0x00, 0x00, 0x01, 0x00,
+ 0x03, 0x00, 0x00, 0x10, 0x01, 0x10, 0x00, 0x01,
+ 0x00, 0x08, 0xcd, 0x38, 0xe3, 0x00, 0x00, 0x00,
+ 0x42, 0x02, 0x01, 0x00, 0x00, 0xc9, 0x25, 0x01,
+ 0x00, 0xd6, 0x04, 0xb4, 0x05, 0x01, 0x0d, 0x0e,
+ 0x42, 0x07, 0x05, 0x00, 0x00, 0x01, 0x00, 0x03,
+ 0x00, 0x00, 0x24, 0x01, 0x10, 0x00, 0x01, 0x00,
+ 0x08, 0xcd, 0xc9, 0xb9, 0xa7, 0xee, 0x10, 0x38,
+ 0xe5, 0x00, 0x00, 0x00, 0xc9, 0xf3, 0x42, 0x03,
+ 0x01, 0x00, 0x00, 0x25, 0x00, 0x00, 0x38, 0xe3,
+ 0x00, 0x00, 0x00, 0x42, 0x03, 0x01, 0x00, 0x00,
+ 0xc9, 0x25, 0x01, 0x00, 0xd6, 0x04, 0xb7, 0x05,
+ 0x03, 0x0d, 0x1c, 0x4f, 0x0e, 0x43, 0x06, 0x05,
+ 0xca, 0x03, 0x02, 0x03, 0x02, 0x03, 0x00, 0x00,
+ 0x45, 0x05, 0x9c, 0x07, 0x00, 0x01, 0x00, 0x9e,
+ 0x07, 0x00, 0x01, 0x00, 0xa4, 0x06, 0x00, 0x00,
+ 0x00, 0xe0, 0x01, 0x00, 0x01, 0x00, 0xca, 0x03,
+ 0x00, 0x01, 0x30, 0x0c, 0x03, 0xce, 0x0c, 0x02,
+ 0xcf, 0xca, 0xee, 0x0d, 0x38, 0xd0, 0x00, 0x00,
+ 0x00, 0x04, 0xbd, 0x01, 0x00, 0x00, 0xf3, 0x2f,
+ 0xd5, 0xcb, 0xab, 0xee, 0x03, 0xd5, 0x28, 0xd6,
+ 0xf6, 0xee, 0x03, 0xb9, 0xda, 0x38, 0x94, 0x00,
+ 0x00, 0x00, 0x42, 0xa6, 0x01, 0x00, 0x00, 0xcb,
+ 0x41, 0x3b, 0x00, 0x00, 0x00, 0x24, 0x01, 0x00,
+ 0xd1, 0xd5, 0x43, 0xce, 0x01, 0x00, 0x00, 0xc9,
+ 0xd6, 0x43, 0xcf, 0x01, 0x00, 0x00, 0xc9, 0x28,
+ 0xd6, 0x04, 0xc2, 0x05, 0x0a, 0x23, 0x12, 0x3f,
+ 0x1c, 0x0d, 0x17, 0x0e, 0x67, 0x21, 0x26, 0x0e,
+ 0x43, 0x06, 0x05, 0x86, 0x05, 0x02, 0x00, 0x02,
+ 0x05, 0x00, 0x00, 0x37, 0x02, 0xba, 0x06, 0x00,
+ 0x01, 0x00, 0xbe, 0x06, 0x00, 0x01, 0x00, 0x38,
+ 0xe5, 0x00, 0x00, 0x00, 0xd5, 0xf3, 0xd9, 0x38,
+ 0xe5, 0x00, 0x00, 0x00, 0xd6, 0xf3, 0xda, 0x38,
+ 0xe5, 0x00, 0x00, 0x00, 0x42, 0x89, 0x01, 0x00,
+ 0x00, 0xd5, 0x41, 0xce, 0x01, 0x00, 0x00, 0xd6,
+ 0x41, 0xce, 0x01, 0x00, 0x00, 0xa1, 0xd5, 0x41,
+ 0xcf, 0x01, 0x00, 0x00, 0xd6, 0x41, 0xcf, 0x01,
+ 0x00, 0x00, 0xa1, 0x25, 0x02, 0x00, 0xd6, 0x04,
+ 0xd3, 0x05, 0x03, 0x03, 0x2b, 0x2b, 0x0e, 0x43,
+ 0x06, 0x05, 0x88, 0x05, 0x02, 0x00, 0x02, 0x05,
+ 0x00, 0x00, 0x37, 0x02, 0xba, 0x06, 0x00, 0x01,
+ 0x00, 0xbe, 0x06, 0x00, 0x01, 0x00, 0x38, 0xe5,
+ 0x00, 0x00, 0x00, 0xd5, 0xf3, 0xd9, 0x38, 0xe5,
+ 0x00, 0x00, 0x00, 0xd6, 0xf3, 0xda, 0x38, 0xe5,
+ 0x00, 0x00, 0x00, 0x42, 0x89, 0x01, 0x00, 0x00,
+ 0xd5, 0x41, 0xce, 0x01, 0x00, 0x00, 0xd6, 0x41,
+ 0xce, 0x01, 0x00, 0x00, 0xa2, 0xd5, 0x41, 0xcf,
+ 0x01, 0x00, 0x00, 0xd6, 0x41, 0xcf, 0x01, 0x00,
+ 0x00, 0xa2, 0x25, 0x02, 0x00, 0xd6, 0x04, 0xd8,
+ 0x05, 0x03, 0x03, 0x2b, 0x2b, 0x0e, 0x43, 0x06,
+ 0x05, 0x8a, 0x05, 0x02, 0x00, 0x02, 0x06, 0x00,
+ 0x00, 0x53, 0x02, 0xba, 0x06, 0x00, 0x01, 0x00,
+ 0xbe, 0x06, 0x00, 0x01, 0x00, 0x38, 0xe5, 0x00,
+ 0x00, 0x00, 0xd5, 0xf3, 0xd9, 0x38, 0xe5, 0x00,
+ 0x00, 0x00, 0xd6, 0xf3, 0xda, 0x38, 0xe5, 0x00,
+ 0x00, 0x00, 0x42, 0x89, 0x01, 0x00, 0x00, 0xd5,
+ 0x41, 0xce, 0x01, 0x00, 0x00, 0xd6, 0x41, 0xce,
+ 0x01, 0x00, 0x00, 0x9e, 0xd5, 0x41, 0xcf, 0x01,
+ 0x00, 0x00, 0xd6, 0x41, 0xcf, 0x01, 0x00, 0x00,
+ 0x9e, 0xa2, 0xd5, 0x41, 0xce, 0x01, 0x00, 0x00,
+ 0xd6, 0x41, 0xcf, 0x01, 0x00, 0x00, 0x9e, 0xd5,
+ 0x41, 0xcf, 0x01, 0x00, 0x00, 0xd6, 0x41, 0xce,
+ 0x01, 0x00, 0x00, 0x9e, 0xa1, 0x25, 0x02, 0x00,
+ 0xd6, 0x04, 0xdd, 0x05, 0x04, 0x03, 0x2b, 0x2b,
+ 0xbc, 0x0e, 0x43, 0x06, 0x05, 0x8c, 0x05, 0x02,
+ 0x00, 0x02, 0x03, 0x00, 0x00, 0x1c, 0x02, 0xba,
+ 0x06, 0x00, 0x01, 0x00, 0xbe, 0x06, 0x00, 0x01,
+ 0x00, 0x38, 0xe5, 0x00, 0x00, 0x00, 0xd5, 0xf3,
+ 0xd9, 0x38, 0xe5, 0x00, 0x00, 0x00, 0xd6, 0xf3,
+ 0xda, 0xd5, 0xd6, 0x42, 0xfd, 0x00, 0x00, 0x00,
+ 0x24, 0x00, 0x00, 0x9e, 0x28, 0xd6, 0x04, 0xe3,
+ 0x05, 0x03, 0x03, 0x2b, 0x2b, 0x0e, 0x43, 0x06,
+ 0x05, 0x8e, 0x05, 0x02, 0x00, 0x02, 0x02, 0x00,
+ 0x00, 0x2f, 0x02, 0xba, 0x06, 0x00, 0x01, 0x00,
+ 0xbe, 0x06, 0x00, 0x01, 0x00, 0x38, 0xe5, 0x00,
+ 0x00, 0x00, 0xd5, 0xf3, 0xd9, 0x38, 0xe5, 0x00,
+ 0x00, 0x00, 0xd6, 0xf3, 0xda, 0xd5, 0x41, 0xce,
+ 0x01, 0x00, 0x00, 0xd6, 0x41, 0xce, 0x01, 0x00,
+ 0x00, 0xad, 0x11, 0xee, 0x0f, 0x0e, 0xd5, 0x41,
+ 0xcf, 0x01, 0x00, 0x00, 0xd6, 0x41, 0xcf, 0x01,
+ 0x00, 0x00, 0xad, 0x28, 0xd6, 0x04, 0xe8, 0x05,
+ 0x03, 0x03, 0x2b, 0x2b, 0x0e, 0x42, 0x07, 0x05,
+ 0x00, 0x01, 0x00, 0x01, 0x01, 0x00, 0x00, 0x02,
+ 0x01, 0xba, 0x06, 0x00, 0x01, 0x00, 0xd5, 0x28,
+ 0xd6, 0x04, 0xf6, 0x05, 0x01, 0x03, 0x0e, 0x42,
+ 0x07, 0x05, 0x00, 0x01, 0x00, 0x01, 0x03, 0x00,
+ 0x00, 0x16, 0x01, 0xba, 0x06, 0x00, 0x01, 0x00,
+ 0x38, 0xe5, 0x00, 0x00, 0x00, 0xd5, 0x41, 0xce,
+ 0x01, 0x00, 0x00, 0x90, 0xd5, 0x41, 0xcf, 0x01,
+ 0x00, 0x00, 0x90, 0x23, 0x02, 0x00, 0xd6, 0x04,
+ 0xf9, 0x05, 0x01, 0x03, 0x0e, 0x42, 0x07, 0x05,
+ 0x00, 0x02, 0x00, 0x02, 0x03, 0x00, 0x00, 0x18,
+ 0x02, 0x9c, 0x07, 0x00, 0x01, 0x00, 0x9e, 0x07,
+ 0x00, 0x01, 0x00, 0x38, 0x72, 0x01, 0x00, 0x00,
+ 0xee, 0x08, 0xd6, 0xb9, 0xad, 0xee, 0x03, 0xd5,
+ 0x28, 0x38, 0xe5, 0x00, 0x00, 0x00, 0xd5, 0xd6,
+ 0x23, 0x02, 0x00, 0xd6, 0x04, 0x8a, 0x06, 0x04,
+ 0x03, 0x3f, 0x08, 0x08, 0x0e, 0x42, 0x07, 0x05,
+ 0x00, 0x00, 0x02, 0x00, 0x04, 0x00, 0x00, 0x25,
+ 0x02, 0xee, 0x06, 0x00, 0x00, 0x00, 0x10, 0x00,
+ 0x01, 0x00, 0x08, 0xce, 0xca, 0x42, 0xf9, 0x00,
+ 0x00, 0x00, 0x24, 0x00, 0x00, 0xcd, 0x38, 0xe5,
+ 0x00, 0x00, 0x00, 0xca, 0x41, 0xce, 0x01, 0x00,
+ 0x00, 0xc9, 0x9f, 0xca, 0x41, 0xcf, 0x01, 0x00,
+ 0x00, 0x90, 0xc9, 0x9f, 0x23, 0x02, 0x00, 0xd6,
+ 0x04, 0x93, 0x06, 0x02, 0x0d, 0x35, 0x0e, 0x42,
+ 0x07, 0x05, 0x00, 0x00, 0x04, 0x00, 0x03, 0x00,
+ 0x00, 0x83, 0x01, 0x04, 0xec, 0x06, 0x00, 0x00,
+ 0x00, 0xde, 0x06, 0x00, 0x01, 0x00, 0xba, 0x06,
+ 0x00, 0x02, 0x00, 0x10, 0x00, 0x01, 0x00, 0x08,
+ 0xd0, 0xc5, 0xce, 0xcc, 0xd3, 0x41, 0xce, 0x01,
+ 0x00, 0x00, 0xb9, 0xae, 0xee, 0x12, 0xca, 0xcb,
+ 0x41, 0xce, 0x01, 0x00, 0x00, 0x42, 0x37, 0x00,
+ 0x00, 0x00, 0x24, 0x00, 0x00, 0xa1, 0xce, 0xcb,
+ 0x41, 0xcf, 0x01, 0x00, 0x00, 0xba, 0xad, 0xee,
+ 0x16, 0xca, 0xc5, 0xae, 0xee, 0x08, 0x04, 0x77,
+ 0x01, 0x00, 0x00, 0x98, 0x01, 0x04, 0xec, 0x00,
+ 0x00, 0x00, 0x98, 0x01, 0xf0, 0x43, 0xcb, 0x41,
+ 0xcf, 0x01, 0x00, 0x00, 0xb8, 0xad, 0xee, 0x0a,
+ 0x04, 0xd0, 0x01, 0x00, 0x00, 0x98, 0x01, 0xf0,
+ 0x30, 0xcb, 0x41, 0xcf, 0x01, 0x00, 0x00, 0x42,
+ 0x37, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0xd1,
+ 0xb9, 0x47, 0x04, 0x78, 0x01, 0x00, 0x00, 0xae,
+ 0xee, 0x0d, 0xca, 0xc5, 0xae, 0xee, 0x08, 0x04,
+ 0x77, 0x01, 0x00, 0x00, 0x98, 0x01, 0xca, 0xc9,
+ 0x04, 0xd1, 0x01, 0x00, 0x00, 0xa1, 0xa1, 0xce,
+ 0xca, 0x28, 0xd6, 0x04, 0x97, 0x06, 0x0f, 0x0d,
+ 0x17, 0x30, 0x58, 0x35, 0x1c, 0x26, 0x26, 0x3f,
+ 0x26, 0x0d, 0x4e, 0x4e, 0x26, 0x36, 0x0e, 0x42,
+ 0x07, 0x05, 0x00, 0x00, 0x01, 0x00, 0x03, 0x00,
+ 0x00, 0x1e, 0x01, 0x10, 0x00, 0x01, 0x00, 0x08,
+ 0xcd, 0xc9, 0x41, 0xce, 0x01, 0x00, 0x00, 0xc9,
+ 0x41, 0xce, 0x01, 0x00, 0x00, 0x9e, 0xc9, 0x41,
+ 0xcf, 0x01, 0x00, 0x00, 0xc9, 0x41, 0xcf, 0x01,
+ 0x00, 0x00, 0x9e, 0xa1, 0x28, 0xd6, 0x04, 0xa9,
+ 0x06, 0x01, 0x0d, 0x0e, 0x42, 0x07, 0x05, 0x00,
+ 0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0x16, 0x01,
+ 0x10, 0x00, 0x01, 0x00, 0x08, 0xcd, 0x38, 0xe3,
+ 0x00, 0x00, 0x00, 0x42, 0x01, 0x01, 0x00, 0x00,
+ 0x38, 0xf9, 0x00, 0x00, 0x00, 0xc9, 0xf3, 0x25,
+ 0x01, 0x00, 0xd6, 0x04, 0xac, 0x06, 0x01, 0x0d,
+ 0x0e, 0x42, 0x07, 0x05, 0x00, 0x00, 0x01, 0x00,
+ 0x03, 0x00, 0x00, 0x17, 0x01, 0x10, 0x00, 0x01,
+ 0x00, 0x08, 0xcd, 0x38, 0xe5, 0x00, 0x00, 0x00,
+ 0xc9, 0x41, 0xce, 0x01, 0x00, 0x00, 0xc9, 0x41,
+ 0xcf, 0x01, 0x00, 0x00, 0x90, 0x23, 0x02, 0x00,
+ 0xd6, 0x04, 0xaf, 0x06, 0x01, 0x0d, 0x0e, 0x42,
+ 0x07, 0x05, 0x00, 0x00, 0x01, 0x00, 0x04, 0x00,
+ 0x00, 0x1b, 0x01, 0x10, 0x00, 0x01, 0x00, 0x08,
+ 0xcd, 0x38, 0xe3, 0x00, 0x00, 0x00, 0x42, 0x0e,
+ 0x01, 0x00, 0x00, 0xc9, 0x41, 0xcf, 0x01, 0x00,
+ 0x00, 0xc9, 0x41, 0xce, 0x01, 0x00, 0x00, 0x25,
+ 0x02, 0x00, 0xd6, 0x04, 0xb2, 0x06, 0x01, 0x0d,
+ 0x0e, 0x42, 0x07, 0x05, 0x00, 0x00, 0x03, 0x00,
+ 0x05, 0x00, 0x00, 0x32, 0x03, 0xf8, 0x03, 0x00,
+ 0x00, 0x00, 0xd0, 0x06, 0x00, 0x01, 0x00, 0x10,
+ 0x00, 0x01, 0x00, 0x08, 0xcf, 0xcb, 0x41, 0xcf,
+ 0x01, 0x00, 0x00, 0xcd, 0xcb, 0x41, 0xce, 0x01,
+ 0x00, 0x00, 0x42, 0x02, 0x01, 0x00, 0x00, 0x24,
+ 0x00, 0x00, 0xce, 0x38, 0xe5, 0x00, 0x00, 0x00,
+ 0xca, 0x38, 0x09, 0x01, 0x00, 0x00, 0xc9, 0xf3,
+ 0x9e, 0xca, 0x38, 0x08, 0x01, 0x00, 0x00, 0xc9,
+ 0xf3, 0x9e, 0x23, 0x02, 0x00, 0xd6, 0x04, 0xb5,
+ 0x06, 0x02, 0x0d, 0x71, 0x0e, 0x42, 0x07, 0x05,
+ 0x00, 0x00, 0x01, 0x00, 0x05, 0x00, 0x00, 0x2b,
+ 0x01, 0x10, 0x00, 0x01, 0x00, 0x08, 0xcd, 0x38,
+ 0xe5, 0x00, 0x00, 0x00, 0x38, 0xfa, 0x00, 0x00,
+ 0x00, 0xc9, 0xf3, 0x42, 0x03, 0x01, 0x00, 0x00,
+ 0x24, 0x00, 0x00, 0x38, 0x0e, 0x01, 0x00, 0x00,
+ 0xc9, 0x41, 0xcf, 0x01, 0x00, 0x00, 0xc9, 0x41,
+ 0xce, 0x01, 0x00, 0x00, 0xf4, 0x23, 0x02, 0x00,
+ 0xd6, 0x04, 0xb9, 0x06, 0x01, 0x0d, 0x0e, 0x43,
+ 0x06, 0x05, 0xcc, 0x03, 0x02, 0x04, 0x02, 0x03,
+ 0x00, 0x00, 0xa2, 0x01, 0x06, 0xba, 0x06, 0x00,
+ 0x01, 0x00, 0xf4, 0x06, 0x00, 0x01, 0x00, 0xa4,
+ 0x06, 0x00, 0x00, 0x00, 0xda, 0x06, 0x00, 0x01,
+ 0x00, 0xe0, 0x01, 0x00, 0x01, 0x00, 0xcc, 0x03,
+ 0x00, 0x01, 0x30, 0x0c, 0x03, 0xcf, 0x0c, 0x02,
+ 0xd0, 0xcb, 0xee, 0x0d, 0x38, 0xd0, 0x00, 0x00,
+ 0x00, 0x04, 0xbd, 0x01, 0x00, 0x00, 0xf3, 0x2f,
+ 0x38, 0x94, 0x00, 0x00, 0x00, 0x42, 0xa6, 0x01,
+ 0x00, 0x00, 0xcc, 0x41, 0x3b, 0x00, 0x00, 0x00,
+ 0x24, 0x01, 0x00, 0xcd, 0x38, 0xe2, 0x00, 0x00,
+ 0x00, 0x42, 0x76, 0x01, 0x00, 0x00, 0xd6, 0x24,
+ 0x01, 0x00, 0xee, 0x4e, 0xd6, 0xb9, 0xa8, 0xee,
+ 0x0d, 0x38, 0xcd, 0x00, 0x00, 0x00, 0x04, 0xd2,
+ 0x01, 0x00, 0x00, 0xf3, 0x2f, 0x38, 0xe2, 0x00,
+ 0x00, 0x00, 0x42, 0x76, 0x01, 0x00, 0x00, 0xd5,
+ 0x24, 0x01, 0x00, 0xee, 0x07, 0xd5, 0xd6, 0xb6,
+ 0xd9, 0xf0, 0x33, 0xd5, 0x38, 0xe4, 0x00, 0x00,
+ 0x00, 0xab, 0xee, 0x12, 0xcc, 0xd5, 0x41, 0xc0,
+ 0x01, 0x00, 0x00, 0xd6, 0xf4, 0xd5, 0x41, 0xc1,
+ 0x01, 0x00, 0x00, 0x9f, 0x28, 0x38, 0xd0, 0x00,
+ 0x00, 0x00, 0x04, 0xd3, 0x01, 0x00, 0x00, 0xf3,
+ 0x2f, 0x38, 0xd0, 0x00, 0x00, 0x00, 0x04, 0xd3,
+ 0x01, 0x00, 0x00, 0xf3, 0x2f, 0xc9, 0xd5, 0x43,
+ 0xd4, 0x01, 0x00, 0x00, 0xc9, 0xd6, 0x43, 0xd5,
+ 0x01, 0x00, 0x00, 0xc9, 0x28, 0xd6, 0x04, 0xc0,
+ 0x06, 0x12, 0x22, 0x12, 0x3f, 0x67, 0x53, 0x1c,
+ 0x3f, 0x53, 0x17, 0x3a, 0x53, 0x08, 0x3b, 0x08,
+ 0x3a, 0x08, 0x26, 0x26, 0x0e, 0x43, 0x06, 0x05,
+ 0x90, 0x05, 0x02, 0x00, 0x02, 0x03, 0x00, 0x00,
+ 0x76, 0x02, 0xba, 0x06, 0x00, 0x01, 0x00, 0xbe,
+ 0x06, 0x00, 0x01, 0x00, 0xd5, 0x38, 0xe6, 0x00,
+ 0x00, 0x00, 0xab, 0x9a, 0xee, 0x17, 0x38, 0xe6,
+ 0x00, 0x00, 0x00, 0xd5, 0xd6, 0x41, 0xd4, 0x01,
+ 0x00, 0x00, 0xa1, 0xd6, 0x41, 0xd5, 0x01, 0x00,
+ 0x00, 0x23, 0x02, 0x00, 0xd6, 0x38, 0xe6, 0x00,
+ 0x00, 0x00, 0xab, 0x9a, 0xee, 0x17, 0x38, 0xe6,
+ 0x00, 0x00, 0x00, 0xd5, 0x41, 0xd4, 0x01, 0x00,
+ 0x00, 0xd6, 0xa1, 0xd5, 0x41, 0xd5, 0x01, 0x00,
+ 0x00, 0x23, 0x02, 0x00, 0xd5, 0x41, 0xd5, 0x01,
+ 0x00, 0x00, 0xd6, 0x41, 0xd5, 0x01, 0x00, 0x00,
+ 0xae, 0xee, 0x0d, 0x38, 0xd0, 0x00, 0x00, 0x00,
+ 0x04, 0xd6, 0x01, 0x00, 0x00, 0xf3, 0x2f, 0x38,
+ 0xe6, 0x00, 0x00, 0x00, 0xd5, 0x41, 0xd4, 0x01,
+ 0x00, 0x00, 0xd6, 0x41, 0xd4, 0x01, 0x00, 0x00,
+ 0xa1, 0xd5, 0x41, 0xd5, 0x01, 0x00, 0x00, 0x23,
+ 0x02, 0x00, 0xd6, 0x04, 0xd7, 0x06, 0x07, 0x03,
+ 0x35, 0x71, 0x35, 0x72, 0x4e, 0x3f, 0x0e, 0x43,
+ 0x06, 0x05, 0x92, 0x05, 0x02, 0x00, 0x02, 0x03,
+ 0x00, 0x00, 0x76, 0x02, 0xba, 0x06, 0x00, 0x01,
+ 0x00, 0xbe, 0x06, 0x00, 0x01, 0x00, 0xd5, 0x38,
+ 0xe6, 0x00, 0x00, 0x00, 0xab, 0x9a, 0xee, 0x17,
+ 0x38, 0xe6, 0x00, 0x00, 0x00, 0xd5, 0xd6, 0x41,
+ 0xd4, 0x01, 0x00, 0x00, 0xa2, 0xd6, 0x41, 0xd5,
+ 0x01, 0x00, 0x00, 0x23, 0x02, 0x00, 0xd6, 0x38,
+ 0xe6, 0x00, 0x00, 0x00, 0xab, 0x9a, 0xee, 0x17,
+ 0x38, 0xe6, 0x00, 0x00, 0x00, 0xd5, 0x41, 0xd4,
+ 0x01, 0x00, 0x00, 0xd6, 0xa2, 0xd5, 0x41, 0xd5,
+ 0x01, 0x00, 0x00, 0x23, 0x02, 0x00, 0xd5, 0x41,
+ 0xd5, 0x01, 0x00, 0x00, 0xd6, 0x41, 0xd5, 0x01,
+ 0x00, 0x00, 0xae, 0xee, 0x0d, 0x38, 0xd0, 0x00,
+ 0x00, 0x00, 0x04, 0xd6, 0x01, 0x00, 0x00, 0xf3,
+ 0x2f, 0x38, 0xe6, 0x00, 0x00, 0x00, 0xd5, 0x41,
+ 0xd4, 0x01, 0x00, 0x00, 0xd6, 0x41, 0xd4, 0x01,
+ 0x00, 0x00, 0xa2, 0xd5, 0x41, 0xd5, 0x01, 0x00,
+ 0x00, 0x23, 0x02, 0x00, 0xd6, 0x04, 0xe2, 0x06,
+ 0x07, 0x03, 0x35, 0x71, 0x35, 0x72, 0x4e, 0x3f,
+ 0x0e, 0x43, 0x06, 0x05, 0x94, 0x05, 0x02, 0x00,
+ 0x02, 0x03, 0x00, 0x00, 0x76, 0x02, 0xba, 0x06,
+ 0x00, 0x01, 0x00, 0xbe, 0x06, 0x00, 0x01, 0x00,
+ 0xd5, 0x38, 0xe6, 0x00, 0x00, 0x00, 0xab, 0x9a,
+ 0xee, 0x17, 0x38, 0xe6, 0x00, 0x00, 0x00, 0xd5,
+ 0xd6, 0x41, 0xd4, 0x01, 0x00, 0x00, 0x9e, 0xd6,
+ 0x41, 0xd5, 0x01, 0x00, 0x00, 0x23, 0x02, 0x00,
+ 0xd6, 0x38, 0xe6, 0x00, 0x00, 0x00, 0xab, 0x9a,
+ 0xee, 0x17, 0x38, 0xe6, 0x00, 0x00, 0x00, 0xd5,
+ 0x41, 0xd4, 0x01, 0x00, 0x00, 0xd6, 0x9e, 0xd5,
+ 0x41, 0xd5, 0x01, 0x00, 0x00, 0x23, 0x02, 0x00,
+ 0xd5, 0x41, 0xd5, 0x01, 0x00, 0x00, 0xd6, 0x41,
+ 0xd5, 0x01, 0x00, 0x00, 0xae, 0xee, 0x0d, 0x38,
+ 0xd0, 0x00, 0x00, 0x00, 0x04, 0xd6, 0x01, 0x00,
+ 0x00, 0xf3, 0x2f, 0x38, 0xe6, 0x00, 0x00, 0x00,
+ 0xd5, 0x41, 0xd4, 0x01, 0x00, 0x00, 0xd6, 0x41,
+ 0xd4, 0x01, 0x00, 0x00, 0x9e, 0xd5, 0x41, 0xd5,
+ 0x01, 0x00, 0x00, 0x23, 0x02, 0x00, 0xd6, 0x04,
+ 0xed, 0x06, 0x07, 0x03, 0x35, 0x71, 0x35, 0x72,
+ 0x4e, 0x3f, 0x0e, 0x43, 0x06, 0x05, 0x96, 0x05,
+ 0x02, 0x00, 0x02, 0x04, 0x01, 0x00, 0x26, 0x02,
+ 0xba, 0x06, 0x00, 0x01, 0x00, 0xbe, 0x06, 0x00,
+ 0x01, 0x00, 0x94, 0x05, 0x1e, 0x01, 0xd6, 0x38,
+ 0xe6, 0x00, 0x00, 0x00, 0xab, 0x9a, 0xee, 0x0f,
+ 0x38, 0xe6, 0x00, 0x00, 0x00, 0xd6, 0xd5, 0x41,
+ 0xd5, 0x01, 0x00, 0x00, 0xf4, 0xda, 0xe1, 0xd5,
+ 0xd6, 0x42, 0xfd, 0x00, 0x00, 0x00, 0x24, 0x00,
+ 0x00, 0x23, 0x02, 0x00, 0xd6, 0x04, 0xf8, 0x06,
+ 0x03, 0x03, 0x35, 0x49, 0x0e, 0x43, 0x06, 0x05,
+ 0x98, 0x05, 0x02, 0x00, 0x02, 0x02, 0x00, 0x00,
+ 0x1f, 0x02, 0xba, 0x06, 0x00, 0x01, 0x00, 0xbe,
+ 0x06, 0x00, 0x01, 0x00, 0xd5, 0x41, 0xd5, 0x01,
+ 0x00, 0x00, 0xd6, 0x41, 0xd5, 0x01, 0x00, 0x00,
+ 0xad, 0x11, 0xee, 0x0f, 0x0e, 0xd5, 0x41, 0xd4,
+ 0x01, 0x00, 0x00, 0xd6, 0x41, 0xd4, 0x01, 0x00,
+ 0x00, 0xad, 0x28, 0xd6, 0x04, 0xfd, 0x06, 0x01,
+ 0x03, 0x0e, 0x42, 0x07, 0x05, 0x00, 0x01, 0x00,
+ 0x01, 0x01, 0x00, 0x00, 0x02, 0x01, 0xba, 0x06,
+ 0x00, 0x01, 0x00, 0xd5, 0x28, 0xd6, 0x04, 0x89,
+ 0x07, 0x01, 0x03, 0x0e, 0x42, 0x07, 0x05, 0x00,
+ 0x01, 0x00, 0x01, 0x03, 0x00, 0x00, 0x15, 0x01,
+ 0xba, 0x06, 0x00, 0x01, 0x00, 0x38, 0xe6, 0x00,
+ 0x00, 0x00, 0xd5, 0x41, 0xd4, 0x01, 0x00, 0x00,
+ 0x90, 0xd5, 0x41, 0xd5, 0x01, 0x00, 0x00, 0x23,
+ 0x02, 0x00, 0xd6, 0x04, 0x8c, 0x07, 0x01, 0x03,
+ 0x0e, 0x42, 0x07, 0x05, 0x00, 0x00, 0x03, 0x00,
+ 0x05, 0x00, 0x00, 0x43, 0x03, 0xba, 0x06, 0x00,
+ 0x00, 0x00, 0xf4, 0x06, 0x00, 0x01, 0x00, 0x10,
+ 0x00, 0x01, 0x00, 0x08, 0xcf, 0xcb, 0xd1, 0x41,
+ 0xd5, 0x01, 0x00, 0x00, 0xce, 0x38, 0xe2, 0x00,
+ 0x00, 0x00, 0x42, 0x76, 0x01, 0x00, 0x00, 0xca,
+ 0x24, 0x01, 0x00, 0xee, 0x1e, 0x38, 0xe6, 0x00,
+ 0x00, 0x00, 0x38, 0xe2, 0x00, 0x00, 0x00, 0x42,
+ 0xf3, 0x00, 0x00, 0x00, 0xc9, 0x41, 0xd4, 0x01,
+ 0x00, 0x00, 0xca, 0x24, 0x02, 0x00, 0xca, 0x23,
+ 0x02, 0x00, 0x38, 0xd0, 0x00, 0x00, 0x00, 0x04,
+ 0xd7, 0x01, 0x00, 0x00, 0xf3, 0x2f, 0xd6, 0x04,
+ 0x9b, 0x07, 0x04, 0x0d, 0x2b, 0x53, 0x95, 0x0e,
+ 0x42, 0x07, 0x05, 0x00, 0x00, 0x01, 0x00, 0x02,
+ 0x00, 0x00, 0x22, 0x01, 0x10, 0x00, 0x01, 0x00,
+ 0x08, 0xcd, 0x04, 0xd8, 0x01, 0x00, 0x00, 0xc9,
+ 0x41, 0xd4, 0x01, 0x00, 0x00, 0xa1, 0x04, 0xd9,
+ 0x01, 0x00, 0x00, 0xa1, 0xc9, 0x41, 0xd5, 0x01,
+ 0x00, 0x00, 0xa1, 0x04, 0xda, 0x01, 0x00, 0x00,
+ 0xa1, 0x28, 0xd6, 0x04, 0xa3, 0x07, 0x01, 0x0d,
+ 0x0e, 0x43, 0x06, 0x05, 0x9a, 0x05, 0x01, 0x00,
+ 0x01, 0x02, 0x00, 0x00, 0x47, 0x01, 0xba, 0x06,
+ 0x00, 0x01, 0x00, 0xd5, 0x9b, 0x04, 0x46, 0x00,
+ 0x00, 0x00, 0xaf, 0x11, 0xef, 0x16, 0x0e, 0xd5,
+ 0x9b, 0x04, 0x8a, 0x00, 0x00, 0x00, 0xaf, 0x11,
+ 0xef, 0x0a, 0x0e, 0xd5, 0x9b, 0x04, 0x8b, 0x00,
+ 0x00, 0x00, 0xaf, 0xee, 0x03, 0x0a, 0x28, 0xd5,
+ 0x38, 0xe4, 0x00, 0x00, 0x00, 0xab, 0x11, 0xef,
+ 0x14, 0x0e, 0xd5, 0x38, 0xe5, 0x00, 0x00, 0x00,
+ 0xab, 0x11, 0xef, 0x09, 0x0e, 0xd5, 0x38, 0xe6,
+ 0x00, 0x00, 0x00, 0xab, 0xee, 0x03, 0x0a, 0x28,
+ 0x09, 0x28, 0xd6, 0x04, 0xaa, 0x07, 0x09, 0x04,
+ 0x3f, 0x3f, 0x35, 0x0d, 0x3a, 0x3a, 0x30, 0x0d,
+ 0x0e, 0x43, 0x06, 0x05, 0xce, 0x03, 0x01, 0x02,
+ 0x01, 0x04, 0x01, 0x00, 0x82, 0x01, 0x03, 0xba,
+ 0x06, 0x00, 0x01, 0x00, 0xe0, 0x01, 0x00, 0x01,
+ 0x00, 0xce, 0x03, 0x00, 0x01, 0x30, 0x9a, 0x05,
+ 0x21, 0x01, 0x0c, 0x03, 0xcd, 0x0c, 0x02, 0xce,
+ 0xc9, 0xee, 0x0d, 0x38, 0xd0, 0x00, 0x00, 0x00,
+ 0x04, 0xbd, 0x01, 0x00, 0x00, 0xf3, 0x2f, 0xd5,
+ 0xca, 0xab, 0xee, 0x03, 0xd5, 0x28, 0x38, 0x95,
+ 0x00, 0x00, 0x00, 0x42, 0xa2, 0x01, 0x00, 0x00,
+ 0xd5, 0x24, 0x01, 0x00, 0xee, 0x2a, 0xd5, 0xed,
+ 0xb9, 0xad, 0xee, 0x06, 0xb9, 0x26, 0x01, 0x00,
+ 0xd9, 0x38, 0x94, 0x00, 0x00, 0x00, 0x42, 0x5f,
+ 0x00, 0x00, 0x00, 0xd5, 0xca, 0x41, 0x3b, 0x00,
+ 0x00, 0x00, 0x24, 0x02, 0x00, 0x0e, 0xd5, 0x42,
+ 0x8a, 0x01, 0x00, 0x00, 0x25, 0x00, 0x00, 0xe1,
+ 0xd5, 0xf3, 0xee, 0x1d, 0xd5, 0x26, 0x01, 0x00,
+ 0xd9, 0x38, 0x94, 0x00, 0x00, 0x00, 0x42, 0x5f,
+ 0x00, 0x00, 0x00, 0xd5, 0xca, 0x41, 0x3b, 0x00,
+ 0x00, 0x00, 0x24, 0x02, 0x00, 0x0e, 0xd5, 0x28,
+ 0x38, 0xd0, 0x00, 0x00, 0x00, 0x04, 0xbc, 0x01,
+ 0x00, 0x00, 0xf3, 0x2f, 0xd6, 0x04, 0xb7, 0x07,
+ 0x0f, 0x22, 0x12, 0x3f, 0x1c, 0x08, 0x58, 0x21,
+ 0x1c, 0x6c, 0x30, 0x1c, 0x1c, 0x6c, 0x08, 0x08,
+ 0x0e, 0x43, 0x06, 0x05, 0x9c, 0x05, 0x01, 0x00,
+ 0x01, 0x03, 0x00, 0x00, 0x44, 0x01, 0xee, 0x06,
+ 0x00, 0x01, 0x00, 0x38, 0xe2, 0x00, 0x00, 0x00,
+ 0x42, 0x76, 0x01, 0x00, 0x00, 0xd5, 0x24, 0x01,
+ 0x00, 0x11, 0xef, 0x32, 0x0e, 0x38, 0xe3, 0x00,
+ 0x00, 0x00, 0x42, 0x82, 0x01, 0x00, 0x00, 0xd5,
+ 0x24, 0x01, 0x00, 0x11, 0xef, 0x20, 0x0e, 0xd5,
+ 0x38, 0xe4, 0x00, 0x00, 0x00, 0xab, 0x11, 0xef,
+ 0x15, 0x0e, 0xd5, 0x38, 0xe5, 0x00, 0x00, 0x00,
+ 0xab, 0x11, 0xee, 0x0a, 0x0e, 0xd5, 0x41, 0xce,
+ 0x01, 0x00, 0x00, 0xb9, 0xad, 0x9a, 0x28, 0xd6,
+ 0x04, 0xcb, 0x07, 0x04, 0x04, 0x5d, 0x5d, 0x3a,
+ 0x0e, 0x43, 0x06, 0x05, 0x9e, 0x05, 0x02, 0x01,
+ 0x02, 0x03, 0x01, 0x00, 0x63, 0x03, 0xee, 0x06,
+ 0x00, 0x01, 0x00, 0xa8, 0x06, 0x00, 0x01, 0x00,
+ 0xb6, 0x07, 0x00, 0x00, 0x00, 0x9c, 0x05, 0x22,
+ 0x01, 0xd6, 0xb9, 0xad, 0xee, 0x0d, 0xd5, 0x42,
+ 0x37, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0xcd,
+ 0xf0, 0x51, 0xd5, 0xba, 0xad, 0xee, 0x05, 0xc5,
+ 0xcd, 0xf0, 0x32, 0xd5, 0xb8, 0xad, 0xee, 0x09,
+ 0x04, 0x78, 0x01, 0x00, 0x00, 0xcd, 0xf0, 0x25,
+ 0xe1, 0xd5, 0xf3, 0xee, 0x11, 0x04, 0xdc, 0x01,
+ 0x00, 0x00, 0xd5, 0xa1, 0x04, 0xda, 0x01, 0x00,
+ 0x00, 0xa1, 0xcd, 0xf0, 0x09, 0x38, 0x98, 0x00,
+ 0x00, 0x00, 0xd5, 0xf3, 0xcd, 0x04, 0x7c, 0x00,
+ 0x00, 0x00, 0x98, 0x00, 0x04, 0xed, 0x00, 0x00,
+ 0x00, 0x98, 0x00, 0xd6, 0xba, 0xae, 0xee, 0x0b,
+ 0xc9, 0x04, 0xdd, 0x01, 0x00, 0x00, 0xd6, 0xa1,
+ 0xa1, 0xcd, 0xc9, 0x28, 0xd6, 0x04, 0xd4, 0x07,
+ 0x11, 0x05, 0x1c, 0x35, 0x0d, 0x1c, 0x0d, 0x26,
+ 0x21, 0x0d, 0x1c, 0x49, 0x0d, 0x2c, 0x27, 0x26,
+ 0x1c, 0x37, 0x0e, 0x43, 0x06, 0x05, 0xa0, 0x05,
+ 0x03, 0x0e, 0x03, 0x04, 0x00, 0x06, 0xb2, 0x02,
+ 0x11, 0x8e, 0x07, 0x00, 0x01, 0x00, 0xbc, 0x07,
+ 0x00, 0x01, 0x00, 0xbe, 0x07, 0x00, 0x01, 0x00,
+ 0xc0, 0x07, 0x00, 0x00, 0x00, 0xc2, 0x07, 0x00,
+ 0x01, 0x00, 0xa8, 0x06, 0x00, 0x02, 0x00, 0xc4,
+ 0x07, 0x00, 0x03, 0x00, 0xc6, 0x07, 0x00, 0x04,
+ 0x00, 0xc8, 0x07, 0x00, 0x05, 0x00, 0xdc, 0x06,
+ 0x00, 0x06, 0x00, 0xca, 0x07, 0x00, 0x07, 0x00,
+ 0xcc, 0x07, 0x00, 0x08, 0x00, 0xce, 0x07, 0x00,
+ 0x09, 0x00, 0xd0, 0x07, 0x00, 0x0a, 0x00, 0xd2,
+ 0x07, 0x00, 0x0b, 0x00, 0xd4, 0x07, 0x00, 0x0c,
+ 0x00, 0xd6, 0x07, 0x00, 0x0d, 0x00, 0xd5, 0x42,
+ 0x8b, 0x01, 0x00, 0x00, 0x24, 0x00, 0x00, 0xc8,
+ 0x06, 0xba, 0xad, 0xee, 0x0a, 0xd5, 0xb9, 0x47,
+ 0x90, 0xd5, 0xba, 0x47, 0x9f, 0x28, 0xd5, 0xb9,
+ 0x47, 0xb9, 0xad, 0xee, 0x07, 0xc3, 0x00, 0xc1,
+ 0xed, 0xb5, 0x28, 0xd5, 0x42, 0xf7, 0x00, 0x00,
+ 0x00, 0x24, 0x00, 0x00, 0xd1, 0x42, 0xf7, 0x00,
+ 0x00, 0x00, 0x24, 0x00, 0x00, 0xce, 0xc3, 0x01,
+ 0xc1, 0xed, 0xb5, 0xc7, 0x0c, 0xc3, 0x02, 0xc1,
+ 0xed, 0xb5, 0xc7, 0x0d, 0xb9, 0xcf, 0xcb, 0xd7,
+ 0xa7, 0x6c, 0xe4, 0x00, 0x00, 0x00, 0xd5, 0x42,
+ 0x59, 0x00, 0x00, 0x00, 0xd6, 0x24, 0x01, 0x00,
+ 0xd4, 0xb9, 0xad, 0xee, 0x03, 0xd6, 0x28, 0x38,
+ 0xfa, 0x00, 0x00, 0x00, 0xd6, 0xc6, 0x0d, 0xa2,
+ 0xf3, 0xc7, 0x0b, 0xcb, 0xbb, 0xaa, 0xee, 0x3b,
+ 0xc6, 0x0b, 0xc6, 0x0c, 0xaa, 0xee, 0x34, 0x38,
+ 0xfa, 0x00, 0x00, 0x00, 0xc6, 0x0d, 0xf3, 0xc3,
+ 0x03, 0xc1, 0xea, 0xb5, 0xa7, 0xee, 0x0e, 0xc6,
+ 0x0b, 0xc3, 0x04, 0xc1, 0xe7, 0xb5, 0xa7, 0xee,
+ 0x1a, 0xc6, 0x0d, 0x28, 0xc6, 0x0b, 0x38, 0xfa,
+ 0x00, 0x00, 0x00, 0xc6, 0x0d, 0xf3, 0xc3, 0x05,
+ 0xc1, 0xeb, 0xb5, 0x9e, 0xa7, 0xee, 0x04, 0xc6,
+ 0x0d, 0x28, 0xc6, 0x0b, 0xc7, 0x0c, 0xd6, 0xc7,
+ 0x0d, 0xc9, 0x42, 0x59, 0x00, 0x00, 0x00, 0xd6,
+ 0x24, 0x01, 0x00, 0xc7, 0x04, 0xca, 0x42, 0x59,
+ 0x00, 0x00, 0x00, 0xd6, 0x24, 0x01, 0x00, 0xc7,
+ 0x05, 0xc6, 0x06, 0xba, 0xa2, 0xc6, 0x04, 0x9e,
+ 0xc8, 0x07, 0xc6, 0x07, 0x9e, 0xc7, 0x07, 0xc6,
+ 0x06, 0xc6, 0x06, 0xba, 0xa2, 0x9e, 0xcc, 0x9e,
+ 0xc6, 0x05, 0x9e, 0xc7, 0x08, 0x38, 0x01, 0x01,
+ 0x00, 0x00, 0xc6, 0x07, 0xc6, 0x08, 0xa2, 0xf3,
+ 0xc7, 0x07, 0xc6, 0x04, 0xc6, 0x07, 0xa1, 0xc7,
+ 0x09, 0xc6, 0x04, 0xc6, 0x07, 0xa2, 0xc7, 0x0a,
+ 0x38, 0xf9, 0x00, 0x00, 0x00, 0xc6, 0x0a, 0xf3,
+ 0x38, 0xf9, 0x00, 0x00, 0x00, 0xc6, 0x09, 0xf3,
+ 0xa9, 0xee, 0x05, 0xc6, 0x0a, 0xc7, 0x09, 0xc6,
+ 0x09, 0xb9, 0xad, 0xee, 0x03, 0x07, 0x28, 0xd6,
+ 0xc6, 0x06, 0xcc, 0x9e, 0xc6, 0x09, 0x9f, 0xa2,
+ 0xda, 0x97, 0x02, 0xf1, 0x1a, 0xff, 0x07, 0x28,
+ 0xd6, 0x04, 0xf0, 0x07, 0x29, 0x00, 0x00, 0x08,
+ 0x3a, 0x18, 0x2b, 0x09, 0x26, 0x22, 0x35, 0x30,
+ 0x26, 0x26, 0x35, 0x3a, 0x17, 0x0f, 0x40, 0x3f,
+ 0x53, 0x35, 0x0d, 0x08, 0x62, 0x14, 0x17, 0x13,
+ 0x3f, 0x3f, 0x30, 0x1c, 0x49, 0x44, 0x26, 0x26,
+ 0x62, 0x17, 0x21, 0x0d, 0x35, 0x1c, 0x0b, 0x00,
+ 0x0b, 0x00, 0x0b, 0x00, 0x0b, 0xfc, 0x01, 0x06,
+ 0x40, 0x76, 0x3a, 0x6b, 0x0b, 0xde, 0x0b, 0xfc,
+ 0x01, 0x06, 0x40, 0x76, 0x3a, 0x6b, 0x0b, 0xde,
+ 0x0b, 0xfc, 0x01, 0x06, 0x40, 0x76, 0x3a, 0x6b,
+ 0x0b, 0xde, 0x0e, 0x43, 0x06, 0x05, 0xa2, 0x05,
+ 0x01, 0x07, 0x01, 0x05, 0x01, 0x04, 0xab, 0x01,
+ 0x08, 0x8e, 0x07, 0x00, 0x01, 0x00, 0xdc, 0x06,
+ 0x00, 0x00, 0x00, 0xa8, 0x06, 0x00, 0x01, 0x00,
+ 0xd4, 0x04, 0x00, 0x02, 0x00, 0xbc, 0x06, 0x00,
+ 0x03, 0x00, 0xbc, 0x07, 0x00, 0x04, 0x00, 0xd8,
+ 0x07, 0x00, 0x05, 0x00, 0xda, 0x07, 0x00, 0x06,
+ 0x00, 0xa0, 0x05, 0x24, 0x01, 0xc3, 0x00, 0xc1,
+ 0xed, 0xb5, 0xc3, 0x01, 0xc1, 0xee, 0xb5, 0x90,
+ 0xc3, 0x02, 0xc1, 0xee, 0xb5, 0x26, 0x03, 0x00,
+ 0xc7, 0x06, 0xd5, 0x38, 0xe7, 0x00, 0x00, 0x00,
+ 0xab, 0x9a, 0xee, 0x0d, 0x38, 0xd0, 0x00, 0x00,
+ 0x00, 0x04, 0xee, 0x01, 0x00, 0x00, 0xf3, 0x2f,
+ 0xd5, 0x42, 0x8b, 0x01, 0x00, 0x00, 0x24, 0x00,
+ 0x00, 0xd1, 0xb9, 0xa8, 0xee, 0x05, 0x26, 0x00,
+ 0x00, 0x28, 0xc3, 0x03, 0xc1, 0xee, 0xb5, 0x38,
+ 0xb3, 0x00, 0x00, 0x00, 0x41, 0xc8, 0x01, 0x00,
+ 0x00, 0x90, 0xa3, 0xc7, 0x05, 0x26, 0x00, 0x00,
+ 0xcf, 0xb9, 0xce, 0xca, 0xc9, 0xa7, 0xee, 0x4f,
+ 0xb9, 0xd0, 0xcc, 0xbc, 0xa7, 0xee, 0x15, 0xe1,
+ 0xd5, 0xc6, 0x06, 0xcc, 0x47, 0xc1, 0x64, 0xf5,
+ 0xc8, 0x04, 0xf7, 0xef, 0x03, 0xf0, 0x05, 0x97,
+ 0x03, 0xf0, 0xe8, 0xcc, 0xbc, 0xad, 0xee, 0x0d,
+ 0x38, 0xcd, 0x00, 0x00, 0x00, 0x04, 0xef, 0x01,
+ 0x00, 0x00, 0xf3, 0x2f, 0xcb, 0xca, 0xc6, 0x04,
+ 0x49, 0x38, 0xe7, 0x00, 0x00, 0x00, 0x42, 0x8c,
+ 0x01, 0x00, 0x00, 0xd5, 0x38, 0xed, 0x00, 0x00,
+ 0x00, 0xc6, 0x04, 0xa2, 0x24, 0x02, 0x00, 0xb9,
+ 0x47, 0xd9, 0x97, 0x01, 0xf0, 0xae, 0xcb, 0x28,
+ 0xd6, 0x04, 0xa6, 0x08, 0x14, 0x05, 0x6d, 0x35,
+ 0x3f, 0x35, 0x17, 0x17, 0x62, 0x17, 0x27, 0x26,
+ 0x3a, 0x12, 0x0d, 0x17, 0x1c, 0x3f, 0x1c, 0x80,
+ 0x17, 0x0b, 0xfc, 0x01, 0x06, 0x40, 0x76, 0x3a,
+ 0x6b, 0x0b, 0xde, 0x0b, 0x80, 0x02, 0x06, 0x60,
+ 0xec, 0xa8, 0x64, 0x6e, 0x9b, 0x0b, 0x80, 0x02,
+ 0x06, 0x50, 0xb1, 0xf1, 0xe7, 0xbc, 0xbc, 0x0b,
+ 0x80, 0x02, 0x06, 0x40, 0x76, 0x3a, 0x6b, 0x0b,
+ 0xde, 0x0e, 0x42, 0x07, 0x05, 0x00, 0x00, 0x03,
+ 0x00, 0x03, 0x00, 0x00, 0x21, 0x03, 0xba, 0x06,
+ 0x00, 0x00, 0x00, 0xa8, 0x06, 0x00, 0x01, 0x00,
+ 0x10, 0x00, 0x01, 0x00, 0x08, 0xcf, 0xcb, 0xd1,
+ 0xed, 0xce, 0xca, 0xba, 0xa9, 0xee, 0x0e, 0xc9,
+ 0xca, 0xba, 0xa2, 0x47, 0xb9, 0xad, 0xee, 0x05,
+ 0x96, 0x01, 0xf0, 0xef, 0xc9, 0xca, 0x43, 0x30,
+ 0x00, 0x00, 0x00, 0xc9, 0x28, 0xd6, 0x04, 0xc2,
+ 0x08, 0x06, 0x0d, 0x0d, 0x0d, 0x49, 0x17, 0x26,
+ 0x0e, 0x42, 0x07, 0x05, 0x00, 0x00, 0x05, 0x00,
+ 0x04, 0x00, 0x00, 0x2f, 0x05, 0xd0, 0x06, 0x00,
+ 0x00, 0x00, 0xa8, 0x06, 0x00, 0x01, 0x00, 0xd8,
+ 0x06, 0x00, 0x02, 0x00, 0xba, 0x06, 0x00, 0x03,
+ 0x00, 0x10, 0x00, 0x01, 0x00, 0x08, 0xc7, 0x04,
+ 0xc6, 0x04, 0xd4, 0xed, 0xcf, 0x26, 0x00, 0x00,
+ 0xcd, 0xb9, 0xce, 0xca, 0xcb, 0xa7, 0xee, 0x14,
+ 0xc9, 0xca, 0x74, 0xcc, 0xca, 0x47, 0x42, 0xfb,
+ 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x49, 0x97,
+ 0x01, 0xf0, 0xe9, 0x38, 0xe7, 0x00, 0x00, 0x00,
+ 0xc9, 0x23, 0x01, 0x00, 0xd6, 0x04, 0xca, 0x08,
+ 0x06, 0x13, 0x12, 0x0d, 0x17, 0x26, 0x62, 0x0e,
+ 0x42, 0x07, 0x05, 0x00, 0x00, 0x01, 0x00, 0x03,
+ 0x00, 0x00, 0x15, 0x01, 0x10, 0x00, 0x01, 0x00,
+ 0x08, 0xcd, 0x38, 0xe9, 0x00, 0x00, 0x00, 0x38,
+ 0xe7, 0x00, 0x00, 0x00, 0xba, 0x26, 0x01, 0x00,
+ 0xf3, 0xc9, 0x23, 0x02, 0x00, 0xd6, 0x04, 0xd3,
+ 0x08, 0x01, 0x0d, 0x0e, 0x42, 0x07, 0x05, 0x00,
+ 0x00, 0x06, 0x00, 0x03, 0x01, 0x00, 0x67, 0x06,
+ 0xa8, 0x06, 0x00, 0x00, 0x00, 0xe0, 0x07, 0x00,
+ 0x01, 0x00, 0xb6, 0x07, 0x00, 0x02, 0x00, 0xee,
+ 0x06, 0x00, 0x03, 0x00, 0xba, 0x06, 0x00, 0x04,
+ 0x00, 0x10, 0x00, 0x01, 0x00, 0x9e, 0x05, 0x23,
+ 0x01, 0x08, 0xc7, 0x05, 0xc6, 0x05, 0xc8, 0x04,
+ 0xed, 0xba, 0xad, 0xee, 0x0d, 0xc6, 0x04, 0xb9,
+ 0x47, 0x42, 0x37, 0x00, 0x00, 0x00, 0x25, 0x00,
+ 0x00, 0xc5, 0xce, 0xc6, 0x04, 0xed, 0xba, 0xa2,
+ 0xcd, 0xc9, 0xb9, 0xaa, 0xee, 0x41, 0xc6, 0x04,
+ 0xc9, 0x47, 0xd4, 0xb9, 0xad, 0x11, 0xef, 0x13,
+ 0x0e, 0xcc, 0x38, 0xe6, 0x00, 0x00, 0x00, 0xab,
+ 0xee, 0x0b, 0xcc, 0x41, 0xd4, 0x01, 0x00, 0x00,
+ 0xb9, 0xad, 0xef, 0x1f, 0xe1, 0xcc, 0xc9, 0xf4,
+ 0xd3, 0xb9, 0x47, 0x04, 0x78, 0x01, 0x00, 0x00,
+ 0xae, 0xee, 0x0d, 0xca, 0xc5, 0xae, 0xee, 0x08,
+ 0x04, 0x77, 0x01, 0x00, 0x00, 0x98, 0x01, 0xcb,
+ 0x98, 0x01, 0x96, 0x00, 0xf0, 0xbc, 0xca, 0x28,
+ 0xd6, 0x04, 0xd6, 0x08, 0x10, 0x12, 0x17, 0x1c,
+ 0x40, 0x0d, 0x3a, 0x1c, 0x21, 0x58, 0x0d, 0x1c,
+ 0x35, 0x1c, 0x27, 0x12, 0x17, 0x0e, 0x42, 0x07,
+ 0x05, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x00,
+ 0x1b, 0x01, 0x10, 0x00, 0x01, 0x00, 0x08, 0xcd,
+ 0xc9, 0xed, 0xba, 0xad, 0xee, 0x0f, 0xc9, 0xb9,
+ 0x47, 0xb9, 0xad, 0xee, 0x08, 0x38, 0xf1, 0x01,
+ 0x00, 0x00, 0x90, 0x28, 0xc9, 0xed, 0xba, 0xa2,
+ 0x28, 0xd6, 0x04, 0xea, 0x08, 0x04, 0x0d, 0x44,
+ 0x21, 0x08, 0x0e, 0x42, 0x07, 0x05, 0x00, 0x01,
+ 0x05, 0x01, 0x03, 0x00, 0x00, 0x21, 0x06, 0xbe,
+ 0x06, 0x00, 0x01, 0x00, 0xa8, 0x06, 0x00, 0x00,
+ 0x00, 0xd8, 0x06, 0x00, 0x01, 0x00, 0xd0, 0x06,
+ 0x00, 0x02, 0x00, 0xba, 0x06, 0x00, 0x03, 0x00,
+ 0x10, 0x00, 0x01, 0x00, 0x08, 0xc7, 0x04, 0xc6,
+ 0x04, 0xd4, 0xed, 0xba, 0xa2, 0xce, 0xcc, 0xca,
+ 0x47, 0xcf, 0xca, 0xb9, 0xa9, 0xee, 0x0d, 0x96,
+ 0x01, 0xcb, 0xd5, 0x9e, 0xcc, 0xca, 0x47, 0xa1,
+ 0xcf, 0xf0, 0xf0, 0xcb, 0x28, 0xd6, 0x04, 0xf0,
+ 0x08, 0x08, 0x12, 0x12, 0x17, 0x17, 0x1c, 0x0d,
+ 0x2b, 0x0d, 0x0e, 0x42, 0x07, 0x05, 0x00, 0x00,
+ 0x05, 0x00, 0x05, 0x00, 0x00, 0x38, 0x05, 0xba,
+ 0x06, 0x00, 0x00, 0x00, 0xd8, 0x06, 0x00, 0x01,
+ 0x00, 0xd0, 0x06, 0x00, 0x02, 0x00, 0xa8, 0x06,
+ 0x00, 0x03, 0x00, 0x10, 0x00, 0x01, 0x00, 0x08,
+ 0xc7, 0x04, 0xc6, 0x04, 0xd1, 0xed, 0xd2, 0xba,
+ 0xad, 0xee, 0x0a, 0x38, 0xe7, 0x00, 0x00, 0x00,
+ 0xb9, 0x23, 0x01, 0x00, 0x26, 0x00, 0x00, 0xcf,
+ 0xba, 0xd0, 0xcc, 0xca, 0xa7, 0xee, 0x10, 0xcb,
+ 0xcc, 0xba, 0xa2, 0x74, 0xcc, 0xc9, 0xcc, 0x47,
+ 0x9e, 0x49, 0x97, 0x03, 0xf0, 0xed, 0x38, 0xe7,
+ 0x00, 0x00, 0x00, 0xcb, 0x23, 0x01, 0x00, 0xd6,
+ 0x04, 0xfa, 0x08, 0x09, 0x12, 0x12, 0x0d, 0x17,
+ 0x31, 0x17, 0x26, 0x3a, 0x17, 0x0e, 0x42, 0x07,
+ 0x05, 0x00, 0x00, 0x05, 0x00, 0x05, 0x00, 0x00,
+ 0x2e, 0x05, 0xba, 0x06, 0x00, 0x00, 0x00, 0xd8,
+ 0x06, 0x00, 0x01, 0x00, 0xd0, 0x06, 0x00, 0x02,
+ 0x00, 0xa8, 0x06, 0x00, 0x03, 0x00, 0x10, 0x00,
+ 0x01, 0x00, 0x08, 0xc7, 0x04, 0xc6, 0x04, 0xd1,
+ 0xed, 0xce, 0xb9, 0x26, 0x01, 0x00, 0xcf, 0xb9,
+ 0xd0, 0xcc, 0xca, 0xa7, 0xee, 0x12, 0xcb, 0xcc,
+ 0xba, 0xa1, 0x74, 0xc9, 0xcc, 0x47, 0xcc, 0xba,
+ 0xa1, 0x9f, 0x49, 0x97, 0x03, 0xf0, 0xeb, 0x38,
+ 0xe7, 0x00, 0x00, 0x00, 0xcb, 0x23, 0x01, 0x00,
+ 0xd6, 0x04, 0x87, 0x09, 0x07, 0x12, 0x12, 0x0d,
+ 0x1c, 0x26, 0x44, 0x17, 0x0e, 0x42, 0x07, 0x05,
+ 0x00, 0x00, 0x05, 0x00, 0x03, 0x00, 0x00, 0x25,
+ 0x05, 0xba, 0x06, 0x00, 0x00, 0x00, 0xd8, 0x06,
+ 0x00, 0x01, 0x00, 0xd0, 0x06, 0x00, 0x02, 0x00,
+ 0xa8, 0x06, 0x00, 0x03, 0x00, 0x10, 0x00, 0x01,
+ 0x00, 0x08, 0xc7, 0x04, 0xc6, 0x04, 0xd1, 0xed,
+ 0xce, 0xb9, 0xcf, 0xb9, 0xd0, 0xcc, 0xca, 0xa7,
+ 0xee, 0x13, 0xcb, 0xc9, 0xcc, 0x47, 0x42, 0xf9,
+ 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0xa1, 0xcf,
+ 0x97, 0x03, 0xf0, 0xea, 0xcb, 0x28, 0xd6, 0x04,
+ 0x90, 0x09, 0x07, 0x12, 0x12, 0x0d, 0x0d, 0x26,
+ 0x49, 0x17, 0x0e, 0x43, 0x06, 0x05, 0xa4, 0x05,
+ 0x02, 0x05, 0x02, 0x05, 0x00, 0x00, 0x5a, 0x07,
+ 0xba, 0x06, 0x00, 0x01, 0x00, 0xbe, 0x06, 0x00,
+ 0x01, 0x00, 0xe4, 0x07, 0x00, 0x00, 0x00, 0xd0,
+ 0x06, 0x00, 0x01, 0x00, 0xa8, 0x06, 0x00, 0x02,
+ 0x00, 0xf6, 0x06, 0x00, 0x03, 0x00, 0xe6, 0x07,
+ 0x00, 0x04, 0x00, 0x38, 0xe7, 0x00, 0x00, 0x00,
+ 0xd5, 0xf3, 0xd9, 0x38, 0xe7, 0x00, 0x00, 0x00,
+ 0xd6, 0xf3, 0xda, 0xd5, 0xed, 0xd6, 0xed, 0xa7,
+ 0xee, 0x07, 0xd5, 0xcd, 0xd6, 0xd9, 0xc9, 0xda,
+ 0xd6, 0xed, 0xd0, 0xd5, 0xed, 0xc7, 0x04, 0x26,
+ 0x00, 0x00, 0xce, 0xb9, 0xcf, 0xcb, 0xcc, 0xa7,
+ 0xee, 0x10, 0xca, 0xcb, 0x74, 0xd5, 0xcb, 0x47,
+ 0xd6, 0xcb, 0x47, 0xa1, 0x49, 0x97, 0x02, 0xf0,
+ 0xed, 0xcc, 0xcf, 0xcb, 0xc6, 0x04, 0xa7, 0xee,
+ 0x0c, 0xca, 0xcb, 0x74, 0xd5, 0xcb, 0x47, 0x49,
+ 0x97, 0x02, 0xf0, 0xf0, 0x38, 0xe7, 0x00, 0x00,
+ 0x00, 0xca, 0x23, 0x01, 0x00, 0xd6, 0x04, 0x9c,
+ 0x09, 0x0e, 0x04, 0x2b, 0x2b, 0x26, 0x0d, 0x0d,
+ 0x0e, 0x12, 0x17, 0x17, 0x26, 0x4e, 0x2b, 0x3a,
+ 0x0e, 0x43, 0x06, 0x05, 0xa6, 0x05, 0x02, 0x00,
+ 0x02, 0x03, 0x01, 0x00, 0x07, 0x02, 0xba, 0x06,
+ 0x00, 0x01, 0x00, 0xbe, 0x06, 0x00, 0x01, 0x00,
+ 0xa4, 0x05, 0x26, 0x01, 0xe1, 0xd5, 0xd6, 0x90,
+ 0x23, 0x02, 0x00, 0xd6, 0x04, 0xae, 0x09, 0x01,
+ 0x03, 0x0e, 0x43, 0x06, 0x05, 0xa8, 0x05, 0x02,
+ 0x06, 0x02, 0x06, 0x00, 0x00, 0x64, 0x08, 0xba,
+ 0x06, 0x00, 0x01, 0x00, 0xbe, 0x06, 0x00, 0x01,
+ 0x00, 0xa8, 0x06, 0x00, 0x00, 0x00, 0xbc, 0x06,
+ 0x00, 0x01, 0x00, 0xf6, 0x06, 0x00, 0x02, 0x00,
+ 0xe6, 0x07, 0x00, 0x03, 0x00, 0xd8, 0x06, 0x00,
+ 0x04, 0x00, 0xd0, 0x06, 0x00, 0x05, 0x00, 0x38,
+ 0xe7, 0x00, 0x00, 0x00, 0xd5, 0xf3, 0xd9, 0x38,
+ 0xe7, 0x00, 0x00, 0x00, 0xd6, 0xf3, 0xda, 0xd5,
+ 0xed, 0xcf, 0xd6, 0xed, 0xd0, 0xcb, 0xcc, 0xa1,
+ 0xba, 0xa2, 0xc7, 0x04, 0x26, 0x00, 0x00, 0xc7,
+ 0x05, 0xb9, 0xcd, 0xc9, 0xc6, 0x04, 0xa7, 0xee,
+ 0x0a, 0xc6, 0x05, 0xc9, 0xb9, 0x49, 0x97, 0x00,
+ 0xf0, 0xf2, 0xb9, 0xcd, 0xc9, 0xcb, 0xa7, 0xee,
+ 0x21, 0xb9, 0xce, 0xca, 0xcc, 0xa7, 0xee, 0x16,
+ 0xc6, 0x05, 0xc9, 0xca, 0xa1, 0x74, 0x13, 0x47,
+ 0xd5, 0xc9, 0x47, 0xd6, 0xca, 0x47, 0x9e, 0xa1,
+ 0x49, 0x97, 0x01, 0xf0, 0xe7, 0x97, 0x00, 0xf0,
+ 0xdc, 0x38, 0xe7, 0x00, 0x00, 0x00, 0xc6, 0x05,
+ 0x23, 0x01, 0x00, 0xd6, 0x04, 0xb1, 0x09, 0x0e,
+ 0x04, 0x2b, 0x2b, 0x12, 0x12, 0x26, 0x1c, 0x2b,
+ 0x30, 0x26, 0x26, 0x58, 0x17, 0x17, 0x0e, 0x43,
+ 0x06, 0x05, 0xaa, 0x05, 0x02, 0x00, 0x02, 0x03,
+ 0x00, 0x00, 0x06, 0x02, 0xba, 0x06, 0x00, 0x01,
+ 0x00, 0xbe, 0x06, 0x00, 0x01, 0x00, 0xd5, 0xba,
+ 0xd6, 0x9f, 0x9e, 0x28, 0xd6, 0x04, 0xc2, 0x09,
+ 0x01, 0x03, 0x0e, 0x43, 0x06, 0x05, 0xac, 0x05,
+ 0x02, 0x00, 0x02, 0x04, 0x00, 0x00, 0x16, 0x02,
+ 0xba, 0x06, 0x00, 0x01, 0x00, 0xbe, 0x06, 0x00,
+ 0x01, 0x00, 0x38, 0xe9, 0x00, 0x00, 0x00, 0x38,
+ 0xe7, 0x00, 0x00, 0x00, 0xd5, 0xf3, 0x38, 0xe7,
+ 0x00, 0x00, 0x00, 0xd6, 0xf3, 0x23, 0x02, 0x00,
+ 0xd6, 0x04, 0xc5, 0x09, 0x02, 0x04, 0x3f, 0x0e,
+ 0x43, 0x06, 0x05, 0xae, 0x05, 0x02, 0x00, 0x02,
+ 0x04, 0x00, 0x00, 0x12, 0x02, 0xba, 0x06, 0x00,
+ 0x01, 0x00, 0xbe, 0x06, 0x00, 0x01, 0x00, 0x38,
+ 0xe7, 0x00, 0x00, 0x00, 0x42, 0x8c, 0x01, 0x00,
+ 0x00, 0xd5, 0xd6, 0x24, 0x02, 0x00, 0xba, 0x47,
+ 0x28, 0xd6, 0x04, 0xca, 0x09, 0x01, 0x03, 0x0e,
+ 0x43, 0x06, 0x05, 0xb0, 0x05, 0x02, 0x02, 0x02,
+ 0x03, 0x00, 0x00, 0x22, 0x04, 0xba, 0x06, 0x00,
+ 0x01, 0x00, 0xbe, 0x06, 0x00, 0x01, 0x00, 0xd8,
+ 0x06, 0x00, 0x00, 0x00, 0xa8, 0x06, 0x00, 0x01,
+ 0x00, 0xd5, 0xed, 0xd1, 0xd6, 0xed, 0xae, 0xee,
+ 0x03, 0x09, 0x28, 0xb9, 0xce, 0xca, 0xc9, 0xa7,
+ 0xee, 0x10, 0xd5, 0xca, 0x47, 0xd6, 0xca, 0x47,
+ 0xae, 0xee, 0x03, 0x09, 0x28, 0x97, 0x01, 0xf0,
+ 0xed, 0x0a, 0x28, 0xd6, 0x04, 0xcd, 0x09, 0x08,
+ 0x04, 0x12, 0x1c, 0x0d, 0x26, 0x30, 0x0d, 0x17,
+ 0x0e, 0x42, 0x07, 0x05, 0x00, 0x01, 0x00, 0x01,
+ 0x01, 0x00, 0x00, 0x02, 0x01, 0xba, 0x06, 0x00,
+ 0x01, 0x00, 0xd5, 0x28, 0xd6, 0x04, 0xe1, 0x09,
+ 0x01, 0x03, 0x0e, 0x42, 0x07, 0x05, 0x00, 0x01,
+ 0x03, 0x01, 0x04, 0x00, 0x00, 0x23, 0x04, 0xba,
+ 0x06, 0x00, 0x01, 0x00, 0xd0, 0x06, 0x00, 0x00,
+ 0x00, 0xa8, 0x06, 0x00, 0x01, 0x00, 0xd8, 0x06,
+ 0x00, 0x02, 0x00, 0xd5, 0xed, 0xcf, 0x26, 0x00,
+ 0x00, 0xcd, 0xb9, 0xce, 0xca, 0xcb, 0xa7, 0xee,
+ 0x0d, 0xc9, 0xca, 0x74, 0xd5, 0xca, 0x47, 0x90,
+ 0x49, 0x97, 0x01, 0xf0, 0xf0, 0x38, 0xe7, 0x00,
+ 0x00, 0x00, 0xc9, 0x23, 0x01, 0x00, 0xd6, 0x04,
+ 0xe4, 0x09, 0x05, 0x04, 0x12, 0x17, 0x26, 0x3f,
+ 0x0e, 0x42, 0x07, 0x05, 0x00, 0x02, 0x08, 0x02,
+ 0x05, 0x00, 0x00, 0xc8, 0x01, 0x0a, 0xba, 0x06,
+ 0x00, 0x01, 0x00, 0xbe, 0x06, 0x00, 0x01, 0x00,
+ 0xf6, 0x06, 0x00, 0x00, 0x00, 0xe6, 0x07, 0x00,
+ 0x01, 0x00, 0xa8, 0x06, 0x00, 0x02, 0x00, 0xbc,
+ 0x06, 0x00, 0x03, 0x00, 0xe8, 0x06, 0x00, 0x04,
+ 0x00, 0xd0, 0x06, 0x00, 0x05, 0x00, 0xd8, 0x06,
+ 0x00, 0x06, 0x00, 0xee, 0x06, 0x00, 0x07, 0x00,
+ 0xd6, 0x42, 0x8b, 0x01, 0x00, 0x00, 0x24, 0x00,
+ 0x00, 0xb9, 0xa7, 0xee, 0x0d, 0x38, 0xcd, 0x00,
+ 0x00, 0x00, 0x04, 0xbf, 0x01, 0x00, 0x00, 0xf3,
+ 0x2f, 0xd5, 0xed, 0xcd, 0xd6, 0xed, 0xce, 0xc9,
+ 0xca, 0xa7, 0xee, 0x10, 0x38, 0xe7, 0x00, 0x00,
+ 0x00, 0xb9, 0x26, 0x01, 0x00, 0xf3, 0xd5, 0x26,
+ 0x02, 0x00, 0x28, 0x38, 0x95, 0x00, 0x00, 0x00,
+ 0x41, 0x3b, 0x00, 0x00, 0x00, 0x41, 0x91, 0x01,
+ 0x00, 0x00, 0x42, 0xa7, 0x01, 0x00, 0x00, 0xd5,
+ 0x24, 0x01, 0x00, 0xc7, 0x05, 0x26, 0x00, 0x00,
+ 0xc7, 0x04, 0x96, 0x01, 0xc9, 0xca, 0xa2, 0xc7,
+ 0x06, 0xb9, 0xcf, 0xcb, 0xc6, 0x06, 0xa7, 0xee,
+ 0x0a, 0xc6, 0x04, 0xcb, 0xb9, 0x49, 0x97, 0x02,
+ 0xf0, 0xf2, 0xc6, 0x06, 0xba, 0xa2, 0xcf, 0xcb,
+ 0xb9, 0xaa, 0xee, 0x41, 0xc6, 0x05, 0xcb, 0xca,
+ 0xa1, 0x47, 0xc8, 0x07, 0xb9, 0xae, 0xee, 0x31,
+ 0xc6, 0x07, 0xd6, 0xca, 0x47, 0x9f, 0xc7, 0x07,
+ 0xc6, 0x05, 0xcb, 0xca, 0xa1, 0xb9, 0x49, 0xb9,
+ 0xd0, 0xcc, 0xca, 0xa7, 0xee, 0x15, 0xc6, 0x05,
+ 0xcb, 0xcc, 0xa1, 0x74, 0x13, 0x47, 0xd6, 0xcc,
+ 0x47, 0xc6, 0x07, 0x9e, 0xa2, 0x49, 0x97, 0x03,
+ 0xf0, 0xe8, 0xc6, 0x04, 0xcb, 0xc6, 0x07, 0x49,
+ 0x96, 0x02, 0xf0, 0xbc, 0x38, 0xe7, 0x00, 0x00,
+ 0x00, 0xc6, 0x04, 0xf3, 0x38, 0xe7, 0x00, 0x00,
+ 0x00, 0xc6, 0x05, 0xf3, 0x26, 0x02, 0x00, 0x28,
+ 0xd6, 0x04, 0xff, 0x09, 0x17, 0x04, 0x44, 0x3f,
+ 0x12, 0x12, 0x1c, 0x4e, 0x85, 0x1c, 0x0d, 0x1c,
+ 0x2b, 0x30, 0x35, 0x2b, 0x17, 0x2b, 0x26, 0x26,
+ 0x53, 0x17, 0x22, 0x17, 0x0e, 0x42, 0x07, 0x05,
+ 0x00, 0x02, 0x01, 0x02, 0x04, 0x00, 0x00, 0x2e,
+ 0x03, 0xba, 0x06, 0x00, 0x01, 0x00, 0xbe, 0x06,
+ 0x00, 0x01, 0x00, 0xda, 0x06, 0x00, 0x00, 0x00,
+ 0xd6, 0x42, 0x8b, 0x01, 0x00, 0x00, 0x24, 0x00,
+ 0x00, 0xb9, 0xaa, 0xee, 0x19, 0x38, 0xe7, 0x00,
+ 0x00, 0x00, 0x42, 0x8c, 0x01, 0x00, 0x00, 0xd5,
+ 0xd6, 0x24, 0x02, 0x00, 0xcd, 0xd6, 0xd9, 0xc9,
+ 0xba, 0x47, 0xda, 0xf0, 0xdc, 0xd5, 0xd5, 0xd5,
+ 0xed, 0xba, 0xa2, 0x47, 0x9f, 0x28, 0xd6, 0x04,
+ 0x9a, 0x0a, 0x06, 0x04, 0x44, 0x53, 0x0d, 0x17,
+ 0x0e, 0x0e, 0x42, 0x07, 0x05, 0x00, 0x02, 0x06,
+ 0x02, 0x04, 0x00, 0x00, 0x7f, 0x08, 0xe4, 0x06,
+ 0x00, 0x01, 0x00, 0xe6, 0x06, 0x00, 0x01, 0x00,
+ 0xe8, 0x06, 0x00, 0x00, 0x00, 0xea, 0x06, 0x00,
+ 0x01, 0x00, 0xec, 0x06, 0x00, 0x02, 0x00, 0xba,
+ 0x06, 0x00, 0x03, 0x00, 0xee, 0x06, 0x00, 0x04,
+ 0x00, 0xda, 0x06, 0x00, 0x05, 0x00, 0xd5, 0xce,
+ 0xd6, 0xcf, 0x38, 0xe7, 0x00, 0x00, 0x00, 0xba,
+ 0x26, 0x01, 0x00, 0xf3, 0xc7, 0x04, 0x38, 0xe7,
+ 0x00, 0x00, 0x00, 0xb9, 0x26, 0x01, 0x00, 0xf3,
+ 0xd0, 0xca, 0x42, 0x8b, 0x01, 0x00, 0x00, 0x24,
+ 0x00, 0x00, 0xb9, 0xaa, 0xee, 0x2d, 0x38, 0xe7,
+ 0x00, 0x00, 0x00, 0x42, 0x8c, 0x01, 0x00, 0x00,
+ 0xcb, 0xca, 0x24, 0x02, 0x00, 0xc8, 0x05, 0xb9,
+ 0x47, 0xcd, 0xca, 0xcf, 0xc6, 0x05, 0xba, 0x47,
+ 0xce, 0xc6, 0x04, 0xc7, 0x05, 0xcc, 0xc9, 0xc6,
+ 0x04, 0x9e, 0xa2, 0xc7, 0x04, 0xc6, 0x05, 0xd0,
+ 0xf0, 0xc8, 0xcb, 0x42, 0x8b, 0x01, 0x00, 0x00,
+ 0x24, 0x00, 0x00, 0xb9, 0xa9, 0xee, 0x0d, 0x38,
+ 0xcd, 0x00, 0x00, 0x00, 0x04, 0xb9, 0x01, 0x00,
+ 0x00, 0xf3, 0x2f, 0x38, 0xe7, 0x00, 0x00, 0x00,
+ 0x42, 0x8c, 0x01, 0x00, 0x00, 0xcc, 0xd6, 0x24,
+ 0x02, 0x00, 0xba, 0x47, 0x28, 0xd6, 0x04, 0xa4,
+ 0x0a, 0x10, 0x04, 0x0d, 0x0d, 0x3f, 0x3a, 0x44,
+ 0x58, 0x12, 0x0d, 0x1c, 0x17, 0x2b, 0x12, 0x0e,
+ 0x44, 0x3f, 0x0e, 0x42, 0x07, 0x05, 0x00, 0x01,
+ 0x00, 0x01, 0x02, 0x01, 0x00, 0x05, 0x01, 0x8e,
+ 0x07, 0x00, 0x01, 0x00, 0xa2, 0x05, 0x25, 0x01,
+ 0xe1, 0xd5, 0x23, 0x01, 0x00, 0xd6, 0x04, 0xb8,
+ 0x0a, 0x01, 0x03, 0x0e, 0x43, 0x06, 0x05, 0xd0,
+ 0x03, 0x02, 0x04, 0x02, 0x04, 0x00, 0x00, 0x9e,
+ 0x01, 0x06, 0xba, 0x06, 0x00, 0x01, 0x00, 0xf4,
+ 0x06, 0x00, 0x01, 0x00, 0xa4, 0x06, 0x00, 0x00,
+ 0x00, 0xda, 0x06, 0x00, 0x01, 0x00, 0xe0, 0x01,
+ 0x00, 0x01, 0x00, 0xd0, 0x03, 0x00, 0x01, 0x30,
+ 0x0c, 0x03, 0xcf, 0x0c, 0x02, 0xd0, 0xcb, 0xee,
+ 0x0d, 0x38, 0xd0, 0x00, 0x00, 0x00, 0x04, 0xbd,
+ 0x01, 0x00, 0x00, 0xf3, 0x2f, 0x38, 0x94, 0x00,
+ 0x00, 0x00, 0x42, 0xa6, 0x01, 0x00, 0x00, 0xcc,
+ 0x41, 0x3b, 0x00, 0x00, 0x00, 0x24, 0x01, 0x00,
+ 0xcd, 0xd6, 0x38, 0xe7, 0x00, 0x00, 0x00, 0xab,
+ 0xee, 0x51, 0xd6, 0x42, 0x8b, 0x01, 0x00, 0x00,
+ 0x24, 0x00, 0x00, 0xb9, 0xa8, 0xee, 0x0d, 0x38,
+ 0xcd, 0x00, 0x00, 0x00, 0x04, 0xf4, 0x01, 0x00,
+ 0x00, 0xf3, 0x2f, 0xd5, 0x38, 0xe9, 0x00, 0x00,
+ 0x00, 0xab, 0xee, 0x12, 0xcc, 0xd5, 0x41, 0xc0,
+ 0x01, 0x00, 0x00, 0xd6, 0xf4, 0xd5, 0x41, 0xc1,
+ 0x01, 0x00, 0x00, 0x9f, 0x28, 0x38, 0xe7, 0x00,
+ 0x00, 0x00, 0xd5, 0xf3, 0xd9, 0x38, 0xe7, 0x00,
+ 0x00, 0x00, 0x42, 0x8c, 0x01, 0x00, 0x00, 0xd5,
+ 0xd6, 0x24, 0x02, 0x00, 0xd2, 0xba, 0x47, 0xd9,
+ 0xf0, 0x0d, 0x38, 0xd0, 0x00, 0x00, 0x00, 0x04,
+ 0xd3, 0x01, 0x00, 0x00, 0xf3, 0x2f, 0xc9, 0xd5,
+ 0x43, 0xd4, 0x01, 0x00, 0x00, 0xc9, 0xd6, 0x43,
+ 0xd5, 0x01, 0x00, 0x00, 0xc9, 0x28, 0xd6, 0x04,
+ 0xbf, 0x0a, 0x12, 0x22, 0x12, 0x3f, 0x67, 0x30,
+ 0x44, 0x3f, 0x30, 0x53, 0x08, 0x2b, 0x53, 0x13,
+ 0x0d, 0x3a, 0x08, 0x26, 0x26, 0x0e, 0x43, 0x06,
+ 0x05, 0xb2, 0x05, 0x02, 0x00, 0x02, 0x03, 0x00,
+ 0x00, 0x76, 0x02, 0xba, 0x06, 0x00, 0x01, 0x00,
+ 0xbe, 0x06, 0x00, 0x01, 0x00, 0xd5, 0x38, 0xe8,
+ 0x00, 0x00, 0x00, 0xab, 0x9a, 0xee, 0x17, 0x38,
+ 0xe8, 0x00, 0x00, 0x00, 0xd5, 0xd6, 0x41, 0xd4,
+ 0x01, 0x00, 0x00, 0xa1, 0xd6, 0x41, 0xd5, 0x01,
+ 0x00, 0x00, 0x23, 0x02, 0x00, 0xd6, 0x38, 0xe8,
+ 0x00, 0x00, 0x00, 0xab, 0x9a, 0xee, 0x17, 0x38,
+ 0xe8, 0x00, 0x00, 0x00, 0xd5, 0x41, 0xd4, 0x01,
+ 0x00, 0x00, 0xd6, 0xa1, 0xd5, 0x41, 0xd5, 0x01,
+ 0x00, 0x00, 0x23, 0x02, 0x00, 0xd5, 0x41, 0xd5,
+ 0x01, 0x00, 0x00, 0xd6, 0x41, 0xd5, 0x01, 0x00,
+ 0x00, 0xae, 0xee, 0x0d, 0x38, 0xd0, 0x00, 0x00,
+ 0x00, 0x04, 0xd6, 0x01, 0x00, 0x00, 0xf3, 0x2f,
+ 0x38, 0xe8, 0x00, 0x00, 0x00, 0xd5, 0x41, 0xd4,
+ 0x01, 0x00, 0x00, 0xd6, 0x41, 0xd4, 0x01, 0x00,
+ 0x00, 0xa1, 0xd5, 0x41, 0xd5, 0x01, 0x00, 0x00,
+ 0x23, 0x02, 0x00, 0xd6, 0x04, 0xd6, 0x0a, 0x07,
+ 0x03, 0x35, 0x71, 0x35, 0x72, 0x4e, 0x3f, 0x0e,
+ 0x43, 0x06, 0x05, 0xb4, 0x05, 0x02, 0x00, 0x02,
+ 0x03, 0x01, 0x00, 0x07, 0x02, 0xba, 0x06, 0x00,
+ 0x01, 0x00, 0xbe, 0x06, 0x00, 0x01, 0x00, 0xb2,
+ 0x05, 0x2d, 0x01, 0xe1, 0xd5, 0xd6, 0x90, 0x23,
+ 0x02, 0x00, 0xd6, 0x04, 0xe1, 0x0a, 0x01, 0x03,
+ 0x0e, 0x43, 0x06, 0x05, 0xb6, 0x05, 0x02, 0x00,
+ 0x02, 0x03, 0x00, 0x00, 0x76, 0x02, 0xba, 0x06,
+ 0x00, 0x01, 0x00, 0xbe, 0x06, 0x00, 0x01, 0x00,
+ 0xd5, 0x38, 0xe8, 0x00, 0x00, 0x00, 0xab, 0x9a,
+ 0xee, 0x17, 0x38, 0xe8, 0x00, 0x00, 0x00, 0xd5,
+ 0xd6, 0x41, 0xd4, 0x01, 0x00, 0x00, 0x9e, 0xd6,
+ 0x41, 0xd5, 0x01, 0x00, 0x00, 0x23, 0x02, 0x00,
+ 0xd6, 0x38, 0xe8, 0x00, 0x00, 0x00, 0xab, 0x9a,
+ 0xee, 0x17, 0x38, 0xe8, 0x00, 0x00, 0x00, 0xd5,
+ 0x41, 0xd4, 0x01, 0x00, 0x00, 0xd6, 0x9e, 0xd5,
+ 0x41, 0xd5, 0x01, 0x00, 0x00, 0x23, 0x02, 0x00,
+ 0xd5, 0x41, 0xd5, 0x01, 0x00, 0x00, 0xd6, 0x41,
+ 0xd5, 0x01, 0x00, 0x00, 0xae, 0xee, 0x0d, 0x38,
+ 0xd0, 0x00, 0x00, 0x00, 0x04, 0xd6, 0x01, 0x00,
+ 0x00, 0xf3, 0x2f, 0x38, 0xe8, 0x00, 0x00, 0x00,
+ 0xd5, 0x41, 0xd4, 0x01, 0x00, 0x00, 0xd6, 0x41,
+ 0xd4, 0x01, 0x00, 0x00, 0x9e, 0xd5, 0x41, 0xd5,
+ 0x01, 0x00, 0x00, 0x23, 0x02, 0x00, 0xd6, 0x04,
+ 0xe4, 0x0a, 0x07, 0x03, 0x35, 0x71, 0x35, 0x72,
+ 0x4e, 0x3f, 0x0e, 0x43, 0x06, 0x05, 0xb8, 0x05,
+ 0x02, 0x00, 0x02, 0x04, 0x01, 0x00, 0x26, 0x02,
+ 0xba, 0x06, 0x00, 0x01, 0x00, 0xbe, 0x06, 0x00,
+ 0x01, 0x00, 0xb6, 0x05, 0x2f, 0x01, 0xd6, 0x38,
+ 0xe8, 0x00, 0x00, 0x00, 0xab, 0x9a, 0xee, 0x0f,
+ 0x38, 0xe8, 0x00, 0x00, 0x00, 0xd6, 0xd5, 0x41,
+ 0xd5, 0x01, 0x00, 0x00, 0xf4, 0xda, 0xe1, 0xd5,
+ 0xd6, 0x42, 0xfd, 0x00, 0x00, 0x00, 0x24, 0x00,
+ 0x00, 0x23, 0x02, 0x00, 0xd6, 0x04, 0xef, 0x0a,
+ 0x03, 0x03, 0x35, 0x49, 0x0e, 0x43, 0x06, 0x05,
+ 0xba, 0x05, 0x02, 0x00, 0x02, 0x02, 0x00, 0x00,
+ 0x1f, 0x02, 0xba, 0x06, 0x00, 0x01, 0x00, 0xbe,
+ 0x06, 0x00, 0x01, 0x00, 0xd5, 0x41, 0xd5, 0x01,
+ 0x00, 0x00, 0xd6, 0x41, 0xd5, 0x01, 0x00, 0x00,
+ 0xad, 0x11, 0xee, 0x0f, 0x0e, 0xd5, 0x41, 0xd4,
+ 0x01, 0x00, 0x00, 0xd6, 0x41, 0xd4, 0x01, 0x00,
+ 0x00, 0xad, 0x28, 0xd6, 0x04, 0xf4, 0x0a, 0x01,
+ 0x03, 0x0e, 0x42, 0x07, 0x05, 0x00, 0x01, 0x00,
+ 0x01, 0x01, 0x00, 0x00, 0x02, 0x01, 0xba, 0x06,
+ 0x00, 0x01, 0x00, 0xd5, 0x28, 0xd6, 0x04, 0x80,
+ 0x0b, 0x01, 0x03, 0x0e, 0x42, 0x07, 0x05, 0x00,
+ 0x01, 0x00, 0x01, 0x03, 0x00, 0x00, 0x15, 0x01,
+ 0xba, 0x06, 0x00, 0x01, 0x00, 0x38, 0xe8, 0x00,
+ 0x00, 0x00, 0xd5, 0x41, 0xd4, 0x01, 0x00, 0x00,
+ 0x90, 0xd5, 0x41, 0xd5, 0x01, 0x00, 0x00, 0x23,
+ 0x02, 0x00, 0xd6, 0x04, 0x83, 0x0b, 0x01, 0x03,
+ 0x0e, 0x42, 0x07, 0x05, 0x00, 0x00, 0x03, 0x00,
+ 0x05, 0x00, 0x00, 0x3b, 0x03, 0xba, 0x06, 0x00,
+ 0x00, 0x00, 0xf4, 0x06, 0x00, 0x01, 0x00, 0x10,
+ 0x00, 0x01, 0x00, 0x08, 0xcf, 0xcb, 0xd1, 0x41,
+ 0xd5, 0x01, 0x00, 0x00, 0xd2, 0x38, 0xe7, 0x00,
+ 0x00, 0x00, 0xab, 0xee, 0x1e, 0x38, 0xe8, 0x00,
+ 0x00, 0x00, 0x38, 0xe7, 0x00, 0x00, 0x00, 0x42,
+ 0xf3, 0x00, 0x00, 0x00, 0xc9, 0x41, 0xd4, 0x01,
+ 0x00, 0x00, 0xca, 0x24, 0x02, 0x00, 0xca, 0x23,
+ 0x02, 0x00, 0x38, 0xd0, 0x00, 0x00, 0x00, 0x04,
+ 0xd7, 0x01, 0x00, 0x00, 0xf3, 0x2f, 0xd6, 0x04,
+ 0x92, 0x0b, 0x04, 0x0d, 0x2b, 0x2b, 0x95, 0x0e,
+ 0x42, 0x07, 0x05, 0x00, 0x00, 0x01, 0x00, 0x02,
+ 0x00, 0x00, 0x22, 0x01, 0x10, 0x00, 0x01, 0x00,
+ 0x08, 0xcd, 0x04, 0xf5, 0x01, 0x00, 0x00, 0xc9,
+ 0x41, 0xd4, 0x01, 0x00, 0x00, 0xa1, 0x04, 0xd9,
+ 0x01, 0x00, 0x00, 0xa1, 0xc9, 0x41, 0xd5, 0x01,
+ 0x00, 0x00, 0xa1, 0x04, 0xda, 0x01, 0x00, 0x00,
+ 0xa1, 0x28, 0xd6, 0x04, 0x9a, 0x0b, 0x01, 0x0d,
+ 0x0e, 0x43, 0x06, 0x05, 0xd2, 0x03, 0x02, 0x06,
+ 0x02, 0x04, 0x00, 0x00, 0xc1, 0x01, 0x08, 0xba,
+ 0x06, 0x00, 0x01, 0x00, 0xbe, 0x06, 0x00, 0x01,
+ 0x00, 0xda, 0x06, 0x00, 0x00, 0x00, 0xd0, 0x06,
+ 0x00, 0x01, 0x00, 0xdc, 0x06, 0x00, 0x02, 0x00,
+ 0xa4, 0x06, 0x00, 0x03, 0x00, 0xe0, 0x01, 0x00,
+ 0x01, 0x00, 0xd2, 0x03, 0x00, 0x01, 0x30, 0x0c,
+ 0x03, 0xc7, 0x04, 0x0c, 0x02, 0xc7, 0x05, 0xc6,
+ 0x04, 0xee, 0x0d, 0x38, 0xd0, 0x00, 0x00, 0x00,
+ 0x04, 0xbd, 0x01, 0x00, 0x00, 0xf3, 0x2f, 0xd5,
+ 0x38, 0xe7, 0x00, 0x00, 0x00, 0xab, 0x9a, 0x11,
+ 0xef, 0x0a, 0x0e, 0xd6, 0x38, 0xe7, 0x00, 0x00,
+ 0x00, 0xab, 0x9a, 0xee, 0x0d, 0x38, 0xd0, 0x00,
+ 0x00, 0x00, 0x04, 0xee, 0x01, 0x00, 0x00, 0xf3,
+ 0x2f, 0x38, 0xe7, 0x00, 0x00, 0x00, 0x42, 0x8c,
+ 0x01, 0x00, 0x00, 0xd5, 0xd6, 0x24, 0x02, 0x00,
+ 0xd1, 0xba, 0x47, 0xd2, 0x42, 0x8b, 0x01, 0x00,
+ 0x00, 0x24, 0x00, 0x00, 0xb9, 0xa7, 0xee, 0x05,
+ 0xc9, 0xb9, 0x47, 0x28, 0x38, 0xe7, 0x00, 0x00,
+ 0x00, 0x42, 0xef, 0x00, 0x00, 0x00, 0xd6, 0xca,
+ 0x24, 0x02, 0x00, 0xd3, 0x42, 0x8b, 0x01, 0x00,
+ 0x00, 0x24, 0x00, 0x00, 0xb9, 0xa9, 0xee, 0x25,
+ 0x38, 0xe7, 0x00, 0x00, 0x00, 0x42, 0x8c, 0x01,
+ 0x00, 0x00, 0xd5, 0xcb, 0x24, 0x02, 0x00, 0xb9,
+ 0x47, 0xd9, 0x38, 0xe7, 0x00, 0x00, 0x00, 0x42,
+ 0x8c, 0x01, 0x00, 0x00, 0xd6, 0xcb, 0x24, 0x02,
+ 0x00, 0xb9, 0x47, 0xda, 0x38, 0x94, 0x00, 0x00,
+ 0x00, 0x42, 0xa6, 0x01, 0x00, 0x00, 0xc6, 0x05,
+ 0x41, 0x3b, 0x00, 0x00, 0x00, 0x24, 0x01, 0x00,
+ 0xd4, 0xd5, 0x43, 0xc0, 0x01, 0x00, 0x00, 0xcc,
+ 0xd6, 0x43, 0xc1, 0x01, 0x00, 0x00, 0xcc, 0x28,
+ 0xd6, 0x04, 0xa1, 0x0b, 0x11, 0x2d, 0x17, 0x3f,
+ 0x3f, 0x35, 0x3f, 0x53, 0x12, 0x3f, 0x17, 0x53,
+ 0x3f, 0x5d, 0x5e, 0x6c, 0x21, 0x26, 0x0e, 0x42,
+ 0x07, 0x05, 0x00, 0x00, 0x01, 0x00, 0x03, 0x00,
+ 0x00, 0x16, 0x01, 0x10, 0x00, 0x01, 0x00, 0x08,
+ 0xcd, 0x38, 0xe9, 0x00, 0x00, 0x00, 0xc9, 0x41,
+ 0xc1, 0x01, 0x00, 0x00, 0xc9, 0x41, 0xc0, 0x01,
+ 0x00, 0x00, 0x23, 0x02, 0x00, 0xd6, 0x04, 0xb9,
+ 0x0b, 0x01, 0x0d, 0x0e, 0x42, 0x07, 0x05, 0x00,
+ 0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0x26, 0x01,
+ 0x10, 0x00, 0x01, 0x00, 0x08, 0xcd, 0x38, 0xe9,
+ 0x00, 0x00, 0x00, 0xc9, 0x41, 0xc0, 0x01, 0x00,
+ 0x00, 0x42, 0xfb, 0x00, 0x00, 0x00, 0x24, 0x00,
+ 0x00, 0xc9, 0x41, 0xc1, 0x01, 0x00, 0x00, 0x42,
+ 0xfb, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x23,
+ 0x02, 0x00, 0xd6, 0x04, 0xbc, 0x0b, 0x01, 0x0d,
+ 0x0e, 0x42, 0x07, 0x05, 0x00, 0x00, 0x02, 0x00,
+ 0x04, 0x01, 0x00, 0x6b, 0x02, 0xe0, 0x07, 0x00,
+ 0x00, 0x00, 0x10, 0x00, 0x01, 0x00, 0x9c, 0x05,
+ 0x22, 0x01, 0x08, 0xce, 0xca, 0x41, 0xc0, 0x01,
+ 0x00, 0x00, 0x42, 0x8b, 0x01, 0x00, 0x00, 0x24,
+ 0x00, 0x00, 0xb9, 0xa8, 0xee, 0x1f, 0xe1, 0xca,
+ 0x41, 0xc0, 0x01, 0x00, 0x00, 0xb9, 0x47, 0xf3,
+ 0x9a, 0xee, 0x12, 0xca, 0x41, 0xc0, 0x01, 0x00,
+ 0x00, 0x42, 0x37, 0x00, 0x00, 0x00, 0x24, 0x00,
+ 0x00, 0xcd, 0xf0, 0x1c, 0x04, 0xdc, 0x01, 0x00,
+ 0x00, 0xca, 0x41, 0xc0, 0x01, 0x00, 0x00, 0x42,
+ 0x37, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0xa1,
+ 0x04, 0xda, 0x01, 0x00, 0x00, 0xa1, 0xcd, 0xc9,
+ 0x04, 0xf6, 0x01, 0x00, 0x00, 0xca, 0x41, 0xc1,
+ 0x01, 0x00, 0x00, 0x42, 0x37, 0x00, 0x00, 0x00,
+ 0x24, 0x00, 0x00, 0xa1, 0x04, 0xda, 0x01, 0x00,
+ 0x00, 0xa1, 0xa1, 0xd1, 0x28, 0xd6, 0x04, 0xbf,
+ 0x0b, 0x06, 0x0e, 0x5d, 0x44, 0x59, 0x8a, 0x94,
+ 0x0e, 0x42, 0x07, 0x05, 0x00, 0x01, 0x01, 0x01,
+ 0x04, 0x00, 0x00, 0x22, 0x02, 0xbe, 0x06, 0x00,
+ 0x01, 0x00, 0x10, 0x00, 0x01, 0x00, 0x08, 0xcd,
+ 0xc9, 0x41, 0xc0, 0x01, 0x00, 0x00, 0x42, 0x59,
+ 0x00, 0x00, 0x00, 0xd5, 0x24, 0x01, 0x00, 0xc9,
+ 0x41, 0xc1, 0x01, 0x00, 0x00, 0x42, 0x59, 0x00,
+ 0x00, 0x00, 0xd5, 0x24, 0x01, 0x00, 0x9f, 0x28,
+ 0xd6, 0x04, 0xc9, 0x0b, 0x01, 0x0d, 0x0e, 0x42,
+ 0x07, 0x05, 0x00, 0x00, 0x03, 0x00, 0x05, 0x00,
+ 0x00, 0x32, 0x03, 0xd8, 0x06, 0x00, 0x00, 0x00,
+ 0xdc, 0x06, 0x00, 0x01, 0x00, 0x10, 0x00, 0x01,
+ 0x00, 0x08, 0xcf, 0xcb, 0x41, 0xc0, 0x01, 0x00,
+ 0x00, 0xcd, 0xcb, 0x41, 0xc1, 0x01, 0x00, 0x00,
+ 0xce, 0x38, 0xe9, 0x00, 0x00, 0x00, 0xc9, 0x42,
+ 0xf7, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0xca,
+ 0x9e, 0xc9, 0xca, 0x42, 0xf7, 0x00, 0x00, 0x00,
+ 0x24, 0x00, 0x00, 0x9e, 0xa2, 0xca, 0xca, 0x9e,
+ 0x23, 0x02, 0x00, 0xd6, 0x04, 0xcc, 0x0b, 0x02,
+ 0x0d, 0x49, 0x0e, 0x43, 0x06, 0x05, 0xbc, 0x05,
+ 0x02, 0x00, 0x02, 0x04, 0x00, 0x00, 0x4e, 0x02,
+ 0xba, 0x06, 0x00, 0x01, 0x00, 0xbe, 0x06, 0x00,
+ 0x01, 0x00, 0x38, 0xe9, 0x00, 0x00, 0x00, 0x42,
+ 0x8d, 0x01, 0x00, 0x00, 0xd5, 0x24, 0x01, 0x00,
+ 0xd9, 0x38, 0xe9, 0x00, 0x00, 0x00, 0x42, 0x8d,
+ 0x01, 0x00, 0x00, 0xd6, 0x24, 0x01, 0x00, 0xda,
+ 0x38, 0xe9, 0x00, 0x00, 0x00, 0xd5, 0x41, 0xc0,
+ 0x01, 0x00, 0x00, 0xd6, 0x41, 0xc1, 0x01, 0x00,
+ 0x00, 0x9e, 0xd5, 0x41, 0xc1, 0x01, 0x00, 0x00,
+ 0xd6, 0x41, 0xc0, 0x01, 0x00, 0x00, 0x9e, 0xa1,
+ 0xd5, 0x41, 0xc1, 0x01, 0x00, 0x00, 0xd6, 0x41,
+ 0xc1, 0x01, 0x00, 0x00, 0x9e, 0x23, 0x02, 0x00,
+ 0xd6, 0x04, 0xd2, 0x0b, 0x03, 0x03, 0x4e, 0x4e,
+ 0x0e, 0x43, 0x06, 0x05, 0xbe, 0x05, 0x02, 0x00,
+ 0x02, 0x04, 0x00, 0x00, 0x4e, 0x02, 0xba, 0x06,
+ 0x00, 0x01, 0x00, 0xbe, 0x06, 0x00, 0x01, 0x00,
+ 0x38, 0xe9, 0x00, 0x00, 0x00, 0x42, 0x8d, 0x01,
+ 0x00, 0x00, 0xd5, 0x24, 0x01, 0x00, 0xd9, 0x38,
+ 0xe9, 0x00, 0x00, 0x00, 0x42, 0x8d, 0x01, 0x00,
+ 0x00, 0xd6, 0x24, 0x01, 0x00, 0xda, 0x38, 0xe9,
+ 0x00, 0x00, 0x00, 0xd5, 0x41, 0xc0, 0x01, 0x00,
+ 0x00, 0xd6, 0x41, 0xc1, 0x01, 0x00, 0x00, 0x9e,
+ 0xd5, 0x41, 0xc1, 0x01, 0x00, 0x00, 0xd6, 0x41,
+ 0xc0, 0x01, 0x00, 0x00, 0x9e, 0xa2, 0xd5, 0x41,
+ 0xc1, 0x01, 0x00, 0x00, 0xd6, 0x41, 0xc1, 0x01,
+ 0x00, 0x00, 0x9e, 0x23, 0x02, 0x00, 0xd6, 0x04,
+ 0xd7, 0x0b, 0x03, 0x03, 0x4e, 0x4e, 0x0e, 0x43,
+ 0x06, 0x05, 0xc0, 0x05, 0x02, 0x00, 0x02, 0x04,
+ 0x00, 0x00, 0x40, 0x02, 0xba, 0x06, 0x00, 0x01,
+ 0x00, 0xbe, 0x06, 0x00, 0x01, 0x00, 0x38, 0xe9,
+ 0x00, 0x00, 0x00, 0x42, 0x8d, 0x01, 0x00, 0x00,
+ 0xd5, 0x24, 0x01, 0x00, 0xd9, 0x38, 0xe9, 0x00,
+ 0x00, 0x00, 0x42, 0x8d, 0x01, 0x00, 0x00, 0xd6,
+ 0x24, 0x01, 0x00, 0xda, 0x38, 0xe9, 0x00, 0x00,
+ 0x00, 0xd5, 0x41, 0xc0, 0x01, 0x00, 0x00, 0xd6,
+ 0x41, 0xc0, 0x01, 0x00, 0x00, 0x9e, 0xd5, 0x41,
+ 0xc1, 0x01, 0x00, 0x00, 0xd6, 0x41, 0xc1, 0x01,
+ 0x00, 0x00, 0x9e, 0x23, 0x02, 0x00, 0xd6, 0x04,
+ 0xdc, 0x0b, 0x03, 0x03, 0x4e, 0x4e, 0x0e, 0x43,
+ 0x06, 0x05, 0xc2, 0x05, 0x02, 0x00, 0x02, 0x04,
+ 0x00, 0x00, 0x40, 0x02, 0xba, 0x06, 0x00, 0x01,
+ 0x00, 0xbe, 0x06, 0x00, 0x01, 0x00, 0x38, 0xe9,
+ 0x00, 0x00, 0x00, 0x42, 0x8d, 0x01, 0x00, 0x00,
+ 0xd5, 0x24, 0x01, 0x00, 0xd9, 0x38, 0xe9, 0x00,
+ 0x00, 0x00, 0x42, 0x8d, 0x01, 0x00, 0x00, 0xd6,
+ 0x24, 0x01, 0x00, 0xda, 0x38, 0xe9, 0x00, 0x00,
+ 0x00, 0xd5, 0x41, 0xc0, 0x01, 0x00, 0x00, 0xd6,
+ 0x41, 0xc1, 0x01, 0x00, 0x00, 0x9e, 0xd5, 0x41,
+ 0xc1, 0x01, 0x00, 0x00, 0xd6, 0x41, 0xc0, 0x01,
+ 0x00, 0x00, 0x9e, 0x23, 0x02, 0x00, 0xd6, 0x04,
+ 0xe1, 0x0b, 0x03, 0x03, 0x4e, 0x4e, 0x0e, 0x43,
+ 0x06, 0x05, 0xc4, 0x05, 0x02, 0x00, 0x02, 0x03,
+ 0x00, 0x00, 0x3d, 0x02, 0xba, 0x06, 0x00, 0x01,
+ 0x00, 0xbe, 0x06, 0x00, 0x01, 0x00, 0x38, 0xe9,
+ 0x00, 0x00, 0x00, 0x42, 0x8d, 0x01, 0x00, 0x00,
+ 0xd5, 0x24, 0x01, 0x00, 0xd9, 0x38, 0xe9, 0x00,
+ 0x00, 0x00, 0x42, 0x8d, 0x01, 0x00, 0x00, 0xd6,
+ 0x24, 0x01, 0x00, 0xda, 0xd5, 0x41, 0xc0, 0x01,
+ 0x00, 0x00, 0xd6, 0x41, 0xc0, 0x01, 0x00, 0x00,
+ 0xad, 0x11, 0xee, 0x0f, 0x0e, 0xd5, 0x41, 0xc1,
+ 0x01, 0x00, 0x00, 0xd6, 0x41, 0xc1, 0x01, 0x00,
+ 0x00, 0xad, 0x28, 0xd6, 0x04, 0xe6, 0x0b, 0x03,
+ 0x03, 0x4e, 0x4f, 0x0e, 0x42, 0x07, 0x05, 0x00,
+ 0x01, 0x00, 0x01, 0x01, 0x00, 0x00, 0x02, 0x01,
+ 0xba, 0x06, 0x00, 0x01, 0x00, 0xd5, 0x28, 0xd6,
+ 0x04, 0xf5, 0x0b, 0x01, 0x03, 0x0e, 0x42, 0x07,
+ 0x05, 0x00, 0x01, 0x01, 0x01, 0x03, 0x00, 0x00,
+ 0x17, 0x02, 0xba, 0x06, 0x00, 0x01, 0x00, 0x10,
+ 0x00, 0x01, 0x00, 0x08, 0xcd, 0x38, 0xe9, 0x00,
+ 0x00, 0x00, 0xc9, 0x41, 0xc0, 0x01, 0x00, 0x00,
+ 0x90, 0xc9, 0x41, 0xc1, 0x01, 0x00, 0x00, 0x23,
+ 0x02, 0x00, 0xd6, 0x04, 0xf8, 0x0b, 0x01, 0x0d,
+ 0x0e, 0x42, 0x07, 0x05, 0x00, 0x01, 0x01, 0x01,
+ 0x03, 0x00, 0x00, 0x3e, 0x02, 0xba, 0x06, 0x00,
+ 0x01, 0x00, 0xa4, 0x06, 0x00, 0x00, 0x00, 0xd5,
+ 0x38, 0xe9, 0x00, 0x00, 0x00, 0xab, 0xee, 0x03,
+ 0xd5, 0x28, 0x38, 0x94, 0x00, 0x00, 0x00, 0x42,
+ 0xa6, 0x01, 0x00, 0x00, 0x38, 0xe9, 0x00, 0x00,
+ 0x00, 0x41, 0x3b, 0x00, 0x00, 0x00, 0x24, 0x01,
+ 0x00, 0xd1, 0x38, 0xe7, 0x00, 0x00, 0x00, 0xd5,
+ 0xf3, 0x43, 0xc0, 0x01, 0x00, 0x00, 0xc9, 0x38,
+ 0xe7, 0x00, 0x00, 0x00, 0xba, 0xf3, 0x43, 0xc1,
+ 0x01, 0x00, 0x00, 0xc9, 0x28, 0xd6, 0x04, 0x8a,
+ 0x0c, 0x07, 0x04, 0x30, 0x08, 0x08, 0x7b, 0x3f,
+ 0x44, 0x0e, 0x43, 0x06, 0x05, 0xc6, 0x05, 0x01,
+ 0x02, 0x01, 0x02, 0x00, 0x00, 0x19, 0x03, 0xba,
+ 0x06, 0x00, 0x01, 0x00, 0xa8, 0x06, 0x00, 0x00,
+ 0x00, 0xd8, 0x06, 0x00, 0x01, 0x00, 0xd5, 0xed,
+ 0xce, 0xb9, 0xcd, 0xc9, 0xca, 0xa7, 0xee, 0x0e,
+ 0xd5, 0xc9, 0x47, 0xb9, 0xae, 0xee, 0x03, 0xc9,
+ 0x28, 0x97, 0x00, 0xf0, 0xef, 0xca, 0x28, 0xd6,
+ 0x04, 0x9a, 0x0c, 0x06, 0x04, 0x12, 0x26, 0x26,
+ 0x0d, 0x17, 0x0e, 0x43, 0x06, 0x05, 0xc8, 0x05,
+ 0x01, 0x00, 0x01, 0x02, 0x01, 0x00, 0x0f, 0x01,
+ 0xba, 0x06, 0x00, 0x01, 0x00, 0x9a, 0x05, 0x21,
+ 0x01, 0xe1, 0xd5, 0xf3, 0x11, 0xef, 0x09, 0x0e,
+ 0xd5, 0x38, 0xe7, 0x00, 0x00, 0x00, 0xab, 0x28,
+ 0xd6, 0x04, 0xa4, 0x0c, 0x02, 0x04, 0x26, 0x0e,
+ 0x43, 0x06, 0x05, 0xd4, 0x03, 0x02, 0x04, 0x02,
+ 0x05, 0x02, 0x00, 0x86, 0x01, 0x06, 0xba, 0x06,
+ 0x00, 0x01, 0x00, 0xd8, 0x06, 0x00, 0x01, 0x00,
+ 0xee, 0x07, 0x00, 0x00, 0x00, 0xd0, 0x06, 0x00,
+ 0x01, 0x00, 0xa8, 0x06, 0x00, 0x02, 0x00, 0xd4,
+ 0x03, 0x00, 0x01, 0x30, 0xc8, 0x05, 0x38, 0x01,
+ 0xc6, 0x05, 0x37, 0x01, 0x0c, 0x02, 0xd0, 0xd5,
+ 0xcc, 0xab, 0xee, 0x03, 0xd5, 0x28, 0xe1, 0xd5,
+ 0xf3, 0xee, 0x52, 0xd6, 0xb9, 0xa8, 0xee, 0x0c,
+ 0xcc, 0x42, 0x8e, 0x01, 0x00, 0x00, 0xb9, 0xb9,
+ 0x25, 0x02, 0x00, 0x38, 0xe7, 0x00, 0x00, 0x00,
+ 0xd5, 0xf3, 0xd9, 0xe2, 0xd5, 0xf3, 0xcd, 0xcc,
+ 0x42, 0x8e, 0x01, 0x00, 0x00, 0xd6, 0xc9, 0x24,
+ 0x02, 0x00, 0xce, 0x38, 0x9c, 0x00, 0x00, 0x00,
+ 0x42, 0xf8, 0x01, 0x00, 0x00, 0xd5, 0xed, 0xc9,
+ 0xa2, 0xd6, 0x24, 0x02, 0x00, 0xda, 0xb9, 0xcf,
+ 0xcb, 0xd6, 0xa7, 0xee, 0x0e, 0xca, 0xcb, 0x74,
+ 0xd5, 0xcb, 0xc9, 0xa1, 0x47, 0x49, 0x97, 0x02,
+ 0xf0, 0xef, 0xca, 0x28, 0xd5, 0x38, 0xe9, 0x00,
+ 0x00, 0x00, 0xab, 0xee, 0x12, 0xcc, 0xd5, 0x41,
+ 0xc0, 0x01, 0x00, 0x00, 0xd6, 0xf4, 0xd5, 0x41,
+ 0xc1, 0x01, 0x00, 0x00, 0x9f, 0x28, 0x38, 0xd0,
+ 0x00, 0x00, 0x00, 0x04, 0xbc, 0x01, 0x00, 0x00,
+ 0xf3, 0x2f, 0xd6, 0x04, 0xab, 0x0c, 0x10, 0x14,
+ 0x1c, 0x08, 0x21, 0x1d, 0x3b, 0x2b, 0x17, 0x3f,
+ 0x62, 0x26, 0x44, 0x09, 0x35, 0x53, 0x08, 0x0e,
+ 0x43, 0x06, 0x05, 0xca, 0x05, 0x02, 0x0a, 0x02,
+ 0x05, 0x02, 0x00, 0x95, 0x02, 0x0c, 0xf2, 0x07,
+ 0x00, 0x01, 0x00, 0xf4, 0x07, 0x00, 0x01, 0x00,
+ 0xe4, 0x07, 0x00, 0x00, 0x00, 0xdc, 0x06, 0x00,
+ 0x01, 0x00, 0xee, 0x07, 0x00, 0x02, 0x00, 0xd8,
+ 0x06, 0x00, 0x03, 0x00, 0xd0, 0x06, 0x00, 0x04,
+ 0x00, 0xa8, 0x06, 0x00, 0x05, 0x00, 0xbc, 0x06,
+ 0x00, 0x06, 0x00, 0xf6, 0x07, 0x00, 0x07, 0x00,
+ 0xf8, 0x07, 0x00, 0x08, 0x00, 0xfa, 0x07, 0x00,
+ 0x09, 0x00, 0xc8, 0x05, 0x38, 0x01, 0xc6, 0x05,
+ 0x37, 0x01, 0xd5, 0x38, 0xea, 0x00, 0x00, 0x00,
+ 0xab, 0x9a, 0xee, 0x07, 0xd5, 0xcd, 0xd6, 0xd9,
+ 0xc9, 0xda, 0xd5, 0x41, 0xf7, 0x01, 0x00, 0x00,
+ 0xd5, 0xed, 0xa1, 0xce, 0xe1, 0xd6, 0xf3, 0xee,
+ 0x15, 0x38, 0xe7, 0x00, 0x00, 0x00, 0xd6, 0xf3,
+ 0xda, 0xca, 0xb9, 0xa8, 0xee, 0x03, 0xd5, 0x28,
+ 0xb9, 0xc7, 0x07, 0xf0, 0x56, 0xd6, 0x38, 0xe9,
+ 0x00, 0x00, 0x00, 0xab, 0xee, 0x31, 0xe2, 0xd6,
+ 0x41, 0xc0, 0x01, 0x00, 0x00, 0xf3, 0xe2, 0xd6,
+ 0x41, 0xc1, 0x01, 0x00, 0x00, 0xf3, 0xa2, 0xc7,
+ 0x05, 0xca, 0xc6, 0x05, 0xa8, 0xee, 0x03, 0xd5,
+ 0x28, 0x38, 0xea, 0x00, 0x00, 0x00, 0xd6, 0xca,
+ 0xc6, 0x05, 0xa2, 0xf4, 0xde, 0x41, 0xf7, 0x01,
+ 0x00, 0x00, 0xc7, 0x07, 0xf0, 0x1d, 0xd6, 0x41,
+ 0xf7, 0x01, 0x00, 0x00, 0xc7, 0x07, 0x38, 0x9c,
+ 0x00, 0x00, 0x00, 0x42, 0xf8, 0x01, 0x00, 0x00,
+ 0xca, 0xc6, 0x07, 0xd6, 0xed, 0xa1, 0x24, 0x02,
+ 0x00, 0xce, 0x38, 0x9c, 0x00, 0x00, 0x00, 0x42,
+ 0xf8, 0x01, 0x00, 0x00, 0xd5, 0x41, 0xf7, 0x01,
+ 0x00, 0x00, 0xc6, 0x07, 0x24, 0x02, 0x00, 0xcf,
+ 0xca, 0xcb, 0xa2, 0xd0, 0x38, 0xea, 0x00, 0x00,
+ 0x00, 0x42, 0x8e, 0x01, 0x00, 0x00, 0xcc, 0xcb,
+ 0x24, 0x02, 0x00, 0xc7, 0x04, 0xcb, 0xc7, 0x05,
+ 0xc6, 0x05, 0xca, 0xa7, 0xee, 0x50, 0xc6, 0x05,
+ 0xd5, 0x41, 0xf7, 0x01, 0x00, 0x00, 0xa2, 0xc8,
+ 0x06, 0xb9, 0xaa, 0xee, 0x10, 0xc6, 0x06, 0xd5,
+ 0xed, 0xa7, 0xee, 0x09, 0xd5, 0xc6, 0x06, 0x47,
+ 0xc7, 0x08, 0xf0, 0x04, 0xb9, 0xc7, 0x08, 0xc6,
+ 0x05, 0xc6, 0x07, 0xa2, 0xc8, 0x06, 0xb9, 0xaa,
+ 0xee, 0x10, 0xc6, 0x06, 0xd6, 0xed, 0xa7, 0xee,
+ 0x09, 0xd6, 0xc6, 0x06, 0x47, 0xc7, 0x09, 0xf0,
+ 0x04, 0xb9, 0xc7, 0x09, 0xc6, 0x04, 0xc6, 0x05,
+ 0xcb, 0xa2, 0x74, 0xc6, 0x08, 0xc6, 0x09, 0xa1,
+ 0x49, 0x97, 0x05, 0xf0, 0xac, 0xc6, 0x04, 0x42,
+ 0x8a, 0x01, 0x00, 0x00, 0x25, 0x00, 0x00, 0xd6,
+ 0x04, 0xc4, 0x0c, 0x22, 0x04, 0x35, 0x0d, 0x0d,
+ 0x0e, 0x35, 0x1c, 0x2b, 0x1c, 0x0d, 0x12, 0x3b,
+ 0x62, 0x21, 0x0e, 0x3f, 0x26, 0x0d, 0x2b, 0x68,
+ 0x71, 0x17, 0x59, 0x30, 0x3a, 0x3a, 0x2c, 0x12,
+ 0x26, 0x3a, 0x2c, 0x12, 0x44, 0x17, 0x0e, 0x43,
+ 0x06, 0x05, 0xcc, 0x05, 0x02, 0x00, 0x02, 0x03,
+ 0x01, 0x00, 0x07, 0x02, 0xba, 0x06, 0x00, 0x01,
+ 0x00, 0xbe, 0x06, 0x00, 0x01, 0x00, 0xca, 0x05,
+ 0x39, 0x01, 0xe1, 0xd5, 0xd6, 0x90, 0x23, 0x02,
+ 0x00, 0xd6, 0x04, 0xf0, 0x0c, 0x01, 0x03, 0x0e,
+ 0x43, 0x06, 0x05, 0xce, 0x05, 0x02, 0x08, 0x02,
+ 0x06, 0x00, 0x00, 0xa9, 0x01, 0x0a, 0xf2, 0x07,
+ 0x00, 0x01, 0x00, 0xf4, 0x07, 0x00, 0x01, 0x00,
+ 0xd8, 0x06, 0x00, 0x00, 0x00, 0xa8, 0x06, 0x00,
+ 0x01, 0x00, 0xbc, 0x06, 0x00, 0x02, 0x00, 0xd0,
+ 0x06, 0x00, 0x03, 0x00, 0xee, 0x07, 0x00, 0x04,
+ 0x00, 0xf6, 0x06, 0x00, 0x05, 0x00, 0xe6, 0x07,
+ 0x00, 0x06, 0x00, 0xc0, 0x06, 0x00, 0x07, 0x00,
+ 0xd5, 0x38, 0xea, 0x00, 0x00, 0x00, 0xab, 0x9a,
+ 0xee, 0x0d, 0x38, 0xea, 0x00, 0x00, 0x00, 0xd5,
+ 0xd6, 0xed, 0xf4, 0xd9, 0xf0, 0x15, 0xd6, 0x38,
+ 0xea, 0x00, 0x00, 0x00, 0xab, 0x9a, 0xee, 0x0b,
+ 0x38, 0xea, 0x00, 0x00, 0x00, 0xd6, 0xd5, 0xed,
+ 0xf4, 0xda, 0xd5, 0x41, 0xf7, 0x01, 0x00, 0x00,
+ 0xd6, 0x41, 0xf7, 0x01, 0x00, 0x00, 0xa1, 0xc7,
+ 0x04, 0x38, 0x9c, 0x00, 0x00, 0x00, 0x42, 0xf8,
+ 0x01, 0x00, 0x00, 0xd5, 0xed, 0xd6, 0xed, 0x24,
+ 0x02, 0x00, 0xcd, 0xd5, 0xed, 0xc7, 0x05, 0xd6,
+ 0xed, 0xc7, 0x06, 0x38, 0xea, 0x00, 0x00, 0x00,
+ 0x42, 0x8e, 0x01, 0x00, 0x00, 0xc9, 0xc6, 0x04,
+ 0x24, 0x02, 0x00, 0xd0, 0xb9, 0xce, 0xca, 0xc6,
+ 0x05, 0xa7, 0xee, 0x35, 0x38, 0x9c, 0x00, 0x00,
+ 0x00, 0x42, 0xf8, 0x01, 0x00, 0x00, 0xc6, 0x06,
+ 0xc9, 0xca, 0xa2, 0x24, 0x02, 0x00, 0xc7, 0x07,
+ 0xb9, 0xcf, 0xcb, 0xc6, 0x07, 0xa7, 0xee, 0x15,
+ 0xcc, 0xca, 0xcb, 0xa1, 0x74, 0x13, 0x47, 0xd5,
+ 0xca, 0x47, 0xd6, 0xcb, 0x47, 0x9e, 0xa1, 0x49,
+ 0x97, 0x02, 0xf0, 0xe7, 0x97, 0x01, 0xf0, 0xc7,
+ 0xcc, 0x42, 0x8a, 0x01, 0x00, 0x00, 0x25, 0x00,
+ 0x00, 0xd6, 0x04, 0xf3, 0x0c, 0x10, 0x04, 0x35,
+ 0x3f, 0x35, 0x35, 0x4e, 0x5d, 0x17, 0x17, 0x58,
+ 0x2b, 0x67, 0x2b, 0x53, 0x17, 0x17, 0x0e, 0x43,
+ 0x06, 0x05, 0xd0, 0x05, 0x02, 0x00, 0x02, 0x04,
+ 0x01, 0x00, 0x22, 0x02, 0xf2, 0x07, 0x00, 0x01,
+ 0x00, 0xf4, 0x07, 0x00, 0x01, 0x00, 0xce, 0x05,
+ 0x3b, 0x01, 0xd6, 0x38, 0xea, 0x00, 0x00, 0x00,
+ 0xab, 0x9a, 0xee, 0x0b, 0x38, 0xea, 0x00, 0x00,
+ 0x00, 0xd6, 0xd5, 0xed, 0xf4, 0xda, 0xe1, 0xd5,
+ 0xd6, 0x42, 0xfd, 0x00, 0x00, 0x00, 0x24, 0x00,
+ 0x00, 0x23, 0x02, 0x00, 0xd6, 0x04, 0x86, 0x0d,
+ 0x03, 0x03, 0x35, 0x35, 0x0e, 0x43, 0x06, 0x05,
+ 0xd2, 0x05, 0x02, 0x00, 0x02, 0x03, 0x01, 0x00,
+ 0x3b, 0x02, 0xba, 0x06, 0x00, 0x01, 0x00, 0xbe,
+ 0x06, 0x00, 0x01, 0x00, 0xdc, 0x04, 0x02, 0x01,
+ 0x38, 0xe2, 0x00, 0x00, 0x00, 0x42, 0x76, 0x01,
+ 0x00, 0x00, 0xd6, 0x24, 0x01, 0x00, 0xee, 0x07,
+ 0xe1, 0xd5, 0xd6, 0x23, 0x02, 0x00, 0xd5, 0x38,
+ 0xea, 0x00, 0x00, 0x00, 0xab, 0x9a, 0xee, 0x0b,
+ 0x38, 0xea, 0x00, 0x00, 0x00, 0xd5, 0xd6, 0xed,
+ 0xf4, 0xd9, 0x38, 0x02, 0x01, 0x00, 0x00, 0x38,
+ 0x03, 0x01, 0x00, 0x00, 0xd5, 0xf3, 0xd6, 0x9e,
+ 0x23, 0x01, 0x00, 0xd6, 0x04, 0x8b, 0x0d, 0x05,
+ 0x03, 0x53, 0x22, 0x35, 0x35, 0x0e, 0x43, 0x06,
+ 0x05, 0xd4, 0x05, 0x02, 0x02, 0x02, 0x03, 0x00,
+ 0x00, 0x33, 0x04, 0xba, 0x06, 0x00, 0x01, 0x00,
+ 0xbe, 0x06, 0x00, 0x01, 0x00, 0xd8, 0x06, 0x00,
+ 0x00, 0x00, 0xa8, 0x06, 0x00, 0x01, 0x00, 0xd5,
+ 0x41, 0xf7, 0x01, 0x00, 0x00, 0xd6, 0x41, 0xf7,
+ 0x01, 0x00, 0x00, 0xae, 0xee, 0x03, 0x09, 0x28,
+ 0xd5, 0xed, 0xd1, 0xd6, 0xed, 0xae, 0xee, 0x03,
+ 0x09, 0x28, 0xb9, 0xce, 0xca, 0xc9, 0xa7, 0xee,
+ 0x10, 0xd5, 0xca, 0x47, 0xd6, 0xca, 0x47, 0xae,
+ 0xee, 0x03, 0x09, 0x28, 0x97, 0x01, 0xf0, 0xed,
+ 0x0a, 0x28, 0xd6, 0x04, 0x94, 0x0d, 0x0a, 0x04,
+ 0x4e, 0x0d, 0x12, 0x1c, 0x0d, 0x26, 0x30, 0x0d,
+ 0x17, 0x0e, 0x42, 0x07, 0x05, 0x00, 0x01, 0x00,
+ 0x01, 0x01, 0x00, 0x00, 0x02, 0x01, 0xba, 0x06,
+ 0x00, 0x01, 0x00, 0xd5, 0x28, 0xd6, 0x04, 0xaa,
+ 0x0d, 0x01, 0x03, 0x0e, 0x42, 0x07, 0x05, 0x00,
+ 0x01, 0x03, 0x01, 0x04, 0x00, 0x00, 0x2e, 0x04,
+ 0xba, 0x06, 0x00, 0x01, 0x00, 0xa4, 0x06, 0x00,
+ 0x00, 0x00, 0xd8, 0x06, 0x00, 0x01, 0x00, 0xa8,
+ 0x06, 0x00, 0x02, 0x00, 0xd5, 0xed, 0xce, 0x38,
+ 0xea, 0x00, 0x00, 0x00, 0x42, 0x8e, 0x01, 0x00,
+ 0x00, 0xd5, 0xed, 0xd5, 0x41, 0xf7, 0x01, 0x00,
+ 0x00, 0x24, 0x02, 0x00, 0xcd, 0xb9, 0xcf, 0xcb,
+ 0xca, 0xa7, 0xee, 0x0d, 0xc9, 0xcb, 0x74, 0xd5,
+ 0xcb, 0x47, 0x90, 0x49, 0x97, 0x02, 0xf0, 0xf0,
+ 0xc9, 0x28, 0xd6, 0x04, 0xad, 0x0d, 0x06, 0x04,
+ 0x12, 0x71, 0x26, 0x2b, 0x17, 0x0e, 0x42, 0x07,
+ 0x05, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00,
+ 0x37, 0x04, 0xa4, 0x06, 0x00, 0x00, 0x00, 0xd8,
+ 0x06, 0x00, 0x01, 0x00, 0xa8, 0x06, 0x00, 0x02,
+ 0x00, 0x10, 0x00, 0x01, 0x00, 0x08, 0xd0, 0xcc,
+ 0xed, 0xce, 0x38, 0xea, 0x00, 0x00, 0x00, 0x42,
+ 0x8e, 0x01, 0x00, 0x00, 0xcc, 0xed, 0xcc, 0x41,
+ 0xf7, 0x01, 0x00, 0x00, 0x24, 0x02, 0x00, 0xcd,
+ 0xb9, 0xcf, 0xcb, 0xca, 0xa7, 0xee, 0x14, 0xc9,
+ 0xcb, 0x74, 0xcc, 0xcb, 0x47, 0x42, 0xfb, 0x00,
+ 0x00, 0x00, 0x24, 0x00, 0x00, 0x49, 0x97, 0x02,
+ 0xf0, 0xe9, 0xc9, 0x28, 0xd6, 0x04, 0xc2, 0x0d,
+ 0x06, 0x0e, 0x12, 0x71, 0x26, 0x4e, 0x17, 0x0e,
+ 0x42, 0x07, 0x05, 0x00, 0x00, 0x07, 0x00, 0x05,
+ 0x00, 0x00, 0x6e, 0x07, 0xd0, 0x06, 0x00, 0x00,
+ 0x00, 0xd8, 0x06, 0x00, 0x01, 0x00, 0xa8, 0x06,
+ 0x00, 0x02, 0x00, 0xbc, 0x06, 0x00, 0x03, 0x00,
+ 0xfc, 0x07, 0x00, 0x04, 0x00, 0xf2, 0x07, 0x00,
+ 0x05, 0x00, 0x10, 0x00, 0x01, 0x00, 0x08, 0xc7,
+ 0x06, 0xc6, 0x06, 0xc8, 0x05, 0xed, 0xd2, 0xb9,
+ 0xad, 0xee, 0x0d, 0x38, 0xcd, 0x00, 0x00, 0x00,
+ 0x04, 0xbf, 0x01, 0x00, 0x00, 0xf3, 0x2f, 0x38,
+ 0xea, 0x00, 0x00, 0x00, 0x42, 0x8e, 0x01, 0x00,
+ 0x00, 0xca, 0xc6, 0x05, 0x41, 0xf7, 0x01, 0x00,
+ 0x00, 0x90, 0x24, 0x02, 0x00, 0xd1, 0xb9, 0x74,
+ 0xba, 0xc6, 0x05, 0xb9, 0x47, 0x9f, 0x49, 0xba,
+ 0xcf, 0xcb, 0xca, 0xa7, 0xee, 0x2d, 0xb9, 0xc7,
+ 0x04, 0xba, 0xd0, 0xcc, 0xcb, 0xa8, 0xee, 0x14,
+ 0xc6, 0x04, 0xc6, 0x05, 0xcc, 0x47, 0xc9, 0xcb,
+ 0xcc, 0xa2, 0x47, 0x9e, 0xa1, 0xc7, 0x04, 0x97,
+ 0x03, 0xf0, 0xe9, 0xc9, 0xcb, 0x74, 0xc6, 0x04,
+ 0x90, 0xc9, 0xb9, 0x47, 0x9e, 0x49, 0x97, 0x02,
+ 0xf0, 0xd0, 0xc9, 0x28, 0xd6, 0x04, 0xcb, 0x0d,
+ 0x0e, 0x12, 0x17, 0x0d, 0x17, 0x3f, 0x76, 0x30,
+ 0x26, 0x12, 0x26, 0x4e, 0x17, 0x3a, 0x17, 0x0e,
+ 0x42, 0x07, 0x05, 0x00, 0x00, 0x06, 0x00, 0x04,
+ 0x00, 0x00, 0x5a, 0x06, 0xa8, 0x06, 0x00, 0x00,
+ 0x00, 0xbc, 0x06, 0x00, 0x01, 0x00, 0xd8, 0x06,
+ 0x00, 0x02, 0x00, 0xd0, 0x06, 0x00, 0x03, 0x00,
+ 0xf2, 0x07, 0x00, 0x04, 0x00, 0x10, 0x00, 0x01,
+ 0x00, 0x08, 0xc7, 0x05, 0xc6, 0x05, 0xc8, 0x04,
+ 0xed, 0xcf, 0xb9, 0xcd, 0xc9, 0xcb, 0xa7, 0xee,
+ 0x0d, 0xc6, 0x04, 0xc9, 0x47, 0xb9, 0xad, 0xee,
+ 0x05, 0x97, 0x00, 0xf0, 0xf0, 0xc9, 0xb9, 0xad,
+ 0xee, 0x04, 0xc6, 0x04, 0x28, 0xc9, 0xce, 0xca,
+ 0xcb, 0xa7, 0xee, 0x10, 0xc6, 0x04, 0xca, 0xc9,
+ 0xa2, 0x74, 0xc6, 0x04, 0xca, 0x47, 0x49, 0x97,
+ 0x01, 0xf0, 0xed, 0xc6, 0x04, 0xcb, 0xc9, 0xa2,
+ 0x43, 0x30, 0x00, 0x00, 0x00, 0xc6, 0x04, 0x41,
+ 0x44, 0x00, 0x00, 0x00, 0x42, 0xf7, 0x01, 0x00,
+ 0x00, 0xc9, 0xa1, 0x43, 0xf7, 0x01, 0x00, 0x00,
+ 0xc6, 0x04, 0x28, 0xd6, 0x04, 0xdc, 0x0d, 0x0c,
+ 0x12, 0x17, 0x0d, 0x0d, 0x44, 0x17, 0x1c, 0x12,
+ 0x26, 0x4e, 0x35, 0x62, 0x0e, 0x42, 0x07, 0x05,
+ 0x00, 0x00, 0x09, 0x00, 0x06, 0x01, 0x00, 0x75,
+ 0x09, 0xa8, 0x06, 0x00, 0x00, 0x00, 0xbc, 0x06,
+ 0x00, 0x01, 0x00, 0xe0, 0x07, 0x00, 0x02, 0x00,
+ 0xb6, 0x07, 0x00, 0x03, 0x00, 0xee, 0x06, 0x00,
+ 0x04, 0x00, 0xba, 0x06, 0x00, 0x05, 0x00, 0xee,
+ 0x07, 0x00, 0x06, 0x00, 0xd8, 0x06, 0x00, 0x07,
+ 0x00, 0x10, 0x00, 0x01, 0x00, 0x9e, 0x05, 0x23,
+ 0x01, 0x08, 0xc7, 0x08, 0xc6, 0x08, 0xc7, 0x05,
+ 0xc5, 0xcf, 0xc6, 0x08, 0x41, 0xf7, 0x01, 0x00,
+ 0x00, 0xc7, 0x06, 0xc6, 0x08, 0xed, 0xc7, 0x07,
+ 0xb9, 0xce, 0xca, 0xc6, 0x07, 0xa7, 0xee, 0x33,
+ 0xca, 0xc6, 0x06, 0xa1, 0xcd, 0xc6, 0x05, 0xca,
+ 0x47, 0xc8, 0x04, 0xb9, 0xae, 0xee, 0x20, 0xe1,
+ 0xc6, 0x04, 0xc9, 0xf4, 0xd4, 0xb9, 0x47, 0x04,
+ 0x78, 0x01, 0x00, 0x00, 0xae, 0xee, 0x0d, 0xcb,
+ 0xc5, 0xae, 0xee, 0x08, 0x04, 0x77, 0x01, 0x00,
+ 0x00, 0x98, 0x02, 0xcc, 0x98, 0x02, 0x97, 0x01,
+ 0xf0, 0xc9, 0xcb, 0xc5, 0xae, 0xee, 0x08, 0x04,
+ 0x77, 0x01, 0x00, 0x00, 0x98, 0x02, 0xcb, 0x04,
+ 0xff, 0x01, 0x00, 0x00, 0xe1, 0xba, 0xc6, 0x07,
+ 0xc6, 0x06, 0xa1, 0xf4, 0xa1, 0x04, 0xda, 0x01,
+ 0x00, 0x00, 0xa1, 0xa1, 0xd3, 0x28, 0xd6, 0x04,
+ 0xea, 0x0d, 0x12, 0x12, 0x17, 0x0d, 0x30, 0x1c,
+ 0x2b, 0x1c, 0x21, 0x17, 0x21, 0x35, 0x1c, 0x27,
+ 0x13, 0x17, 0x1c, 0x26, 0x76, 0x0e, 0x42, 0x07,
+ 0x05, 0x00, 0x01, 0x05, 0x01, 0x03, 0x00, 0x00,
+ 0x3c, 0x06, 0xbe, 0x06, 0x00, 0x01, 0x00, 0xa8,
+ 0x06, 0x00, 0x00, 0x00, 0xd8, 0x06, 0x00, 0x01,
+ 0x00, 0xd0, 0x06, 0x00, 0x02, 0x00, 0xba, 0x06,
+ 0x00, 0x03, 0x00, 0x10, 0x00, 0x01, 0x00, 0x08,
+ 0xc7, 0x04, 0xc6, 0x04, 0xd4, 0xed, 0xd2, 0xb9,
+ 0xad, 0xee, 0x03, 0xb9, 0x28, 0xcc, 0xca, 0x92,
+ 0xd2, 0x47, 0xcf, 0xca, 0xb9, 0xa9, 0xee, 0x0d,
+ 0x96, 0x01, 0xcb, 0xd5, 0x9e, 0xcc, 0xca, 0x47,
+ 0xa1, 0xcf, 0xf0, 0xf0, 0xcc, 0x41, 0xf7, 0x01,
+ 0x00, 0x00, 0xb9, 0xae, 0xee, 0x0c, 0xcb, 0xd5,
+ 0xcc, 0x41, 0xf7, 0x01, 0x00, 0x00, 0xa3, 0x9e,
+ 0xcf, 0xcb, 0x28, 0xd6, 0x04, 0x80, 0x0e, 0x0c,
+ 0x12, 0x12, 0x0d, 0x17, 0x0d, 0x21, 0x1c, 0x0d,
+ 0x2b, 0x0d, 0x35, 0x3a, 0x0e, 0x42, 0x07, 0x05,
+ 0x00, 0x00, 0x07, 0x00, 0x05, 0x00, 0x00, 0x6d,
+ 0x07, 0xba, 0x06, 0x00, 0x00, 0x00, 0xd8, 0x06,
+ 0x00, 0x01, 0x00, 0xee, 0x07, 0x00, 0x02, 0x00,
+ 0xd0, 0x06, 0x00, 0x03, 0x00, 0xa8, 0x06, 0x00,
+ 0x04, 0x00, 0xbc, 0x06, 0x00, 0x05, 0x00, 0x10,
+ 0x00, 0x01, 0x00, 0x08, 0xc7, 0x06, 0xc6, 0x06,
+ 0xd1, 0xed, 0xce, 0xc9, 0x41, 0xf7, 0x01, 0x00,
+ 0x00, 0xcf, 0xca, 0xb9, 0xad, 0xee, 0x15, 0xcb,
+ 0xb9, 0xad, 0xee, 0x10, 0x38, 0xea, 0x00, 0x00,
+ 0x00, 0x42, 0x8e, 0x01, 0x00, 0x00, 0xb9, 0xb9,
+ 0x25, 0x02, 0x00, 0x38, 0xea, 0x00, 0x00, 0x00,
+ 0x42, 0x8e, 0x01, 0x00, 0x00, 0xca, 0xcb, 0xba,
+ 0xa2, 0x24, 0x02, 0x00, 0xd0, 0xb9, 0xc7, 0x04,
+ 0xc6, 0x04, 0xca, 0xa7, 0xee, 0x22, 0xcb, 0xc6,
+ 0x04, 0xa1, 0xc8, 0x05, 0xb9, 0xad, 0xee, 0x08,
+ 0xcc, 0xc6, 0x04, 0xb9, 0x49, 0xf0, 0x0d, 0xcc,
+ 0xc6, 0x04, 0x74, 0xc6, 0x05, 0xc9, 0xc6, 0x04,
+ 0x47, 0x9e, 0x49, 0x97, 0x04, 0xf0, 0xda, 0xcc,
+ 0x42, 0x8a, 0x01, 0x00, 0x00, 0x25, 0x00, 0x00,
+ 0xd6, 0x04, 0x8e, 0x0e, 0x0b, 0x12, 0x3f, 0x35,
+ 0x4f, 0x5d, 0x30, 0x21, 0x17, 0x27, 0x3f, 0x17,
+ 0x0e, 0x42, 0x07, 0x05, 0x00, 0x00, 0x07, 0x00,
+ 0x05, 0x00, 0x00, 0x60, 0x07, 0xba, 0x06, 0x00,
+ 0x00, 0x00, 0xd8, 0x06, 0x00, 0x01, 0x00, 0xee,
+ 0x07, 0x00, 0x02, 0x00, 0xa8, 0x06, 0x00, 0x03,
+ 0x00, 0xbc, 0x06, 0x00, 0x04, 0x00, 0xd0, 0x06,
+ 0x00, 0x05, 0x00, 0x10, 0x00, 0x01, 0x00, 0x08,
+ 0xc7, 0x06, 0xc6, 0x06, 0xd1, 0xed, 0xce, 0xc9,
+ 0x41, 0xf7, 0x01, 0x00, 0x00, 0xcf, 0x38, 0xea,
+ 0x00, 0x00, 0x00, 0x42, 0x8e, 0x01, 0x00, 0x00,
+ 0xca, 0xcb, 0xba, 0xa1, 0x24, 0x02, 0x00, 0xc7,
+ 0x05, 0xb9, 0xd0, 0xcc, 0xca, 0xa7, 0xee, 0x2e,
+ 0xcb, 0xcc, 0xa1, 0xc8, 0x04, 0xb8, 0xad, 0xee,
+ 0x14, 0xc9, 0xcc, 0x47, 0xb9, 0xae, 0xee, 0x1a,
+ 0x38, 0x00, 0x02, 0x00, 0x00, 0x04, 0x01, 0x02,
+ 0x00, 0x00, 0xf3, 0x2f, 0xc6, 0x05, 0xcc, 0x74,
+ 0xc9, 0xcc, 0x47, 0xc6, 0x04, 0xba, 0xa1, 0x9f,
+ 0x49, 0x97, 0x03, 0xf0, 0xcf, 0xc6, 0x05, 0x42,
+ 0x8a, 0x01, 0x00, 0x00, 0x25, 0x00, 0x00, 0xd6,
+ 0x04, 0x9e, 0x0e, 0x0b, 0x12, 0x3f, 0x62, 0x26,
+ 0x1c, 0x17, 0x26, 0x3a, 0x08, 0x45, 0x17, 0x0e,
+ 0x42, 0x07, 0x05, 0x00, 0x00, 0x06, 0x00, 0x05,
+ 0x01, 0x00, 0x8b, 0x01, 0x06, 0xee, 0x06, 0x00,
+ 0x00, 0x00, 0xa8, 0x06, 0x00, 0x01, 0x00, 0xd0,
+ 0x06, 0x00, 0x02, 0x00, 0xd8, 0x06, 0x00, 0x03,
+ 0x00, 0xba, 0x06, 0x00, 0x04, 0x00, 0x10, 0x00,
+ 0x01, 0x00, 0xda, 0x01, 0x00, 0x03, 0x08, 0xc7,
+ 0x05, 0xc6, 0x05, 0xc8, 0x04, 0x41, 0xf7, 0x01,
+ 0x00, 0x00, 0xb9, 0xa7, 0xee, 0x0d, 0x38, 0xcd,
+ 0x00, 0x00, 0x00, 0x04, 0x02, 0x02, 0x00, 0x00,
+ 0xf3, 0x2f, 0xc6, 0x04, 0x41, 0xf7, 0x01, 0x00,
+ 0x00, 0xc6, 0x04, 0xed, 0xa1, 0xd0, 0xc6, 0x04,
+ 0x41, 0xf7, 0x01, 0x00, 0x00, 0xb9, 0xa9, 0x11,
+ 0xef, 0x08, 0x0e, 0xc6, 0x04, 0xb9, 0x47, 0xb9,
+ 0xad, 0xee, 0x05, 0xba, 0xcd, 0xf0, 0x18, 0xe1,
+ 0x42, 0x02, 0x01, 0x00, 0x00, 0xc6, 0x04, 0xb9,
+ 0x47, 0x24, 0x01, 0x00, 0xcd, 0xc6, 0x04, 0xc6,
+ 0x04, 0xb9, 0x47, 0xa2, 0xc7, 0x04, 0x38, 0xea,
+ 0x00, 0x00, 0x00, 0x42, 0x8e, 0x01, 0x00, 0x00,
+ 0xcc, 0xb9, 0x24, 0x02, 0x00, 0xcf, 0xb9, 0xce,
+ 0xca, 0xcc, 0xa7, 0xee, 0x12, 0xcb, 0xca, 0x74,
+ 0xc9, 0x38, 0xf0, 0x00, 0x00, 0x00, 0xca, 0xf3,
+ 0x9f, 0x49, 0x97, 0x01, 0xf0, 0xeb, 0xcb, 0x42,
+ 0x59, 0x00, 0x00, 0x00, 0xc6, 0x04, 0x25, 0x01,
+ 0x00, 0xd6, 0x04, 0xac, 0x0e, 0x0e, 0x12, 0x17,
+ 0x30, 0x3f, 0x3f, 0x6c, 0x0d, 0x0d, 0x49, 0x31,
+ 0x53, 0x26, 0x44, 0x17, 0x0e, 0x42, 0x07, 0x05,
+ 0x00, 0x00, 0x03, 0x00, 0x05, 0x01, 0x00, 0x38,
+ 0x03, 0xba, 0x06, 0x00, 0x00, 0x00, 0xd0, 0x06,
+ 0x00, 0x01, 0x00, 0x10, 0x00, 0x01, 0x00, 0xda,
+ 0x01, 0x00, 0x03, 0x08, 0xcf, 0xcb, 0xd1, 0x41,
+ 0xf7, 0x01, 0x00, 0x00, 0xb9, 0xae, 0xee, 0x0d,
+ 0x38, 0x03, 0x02, 0x00, 0x00, 0x04, 0x04, 0x02,
+ 0x00, 0x00, 0xf3, 0x2f, 0x38, 0xf8, 0x00, 0x00,
+ 0x00, 0x38, 0xf7, 0x00, 0x00, 0x00, 0xc9, 0xf3,
+ 0xc9, 0x9f, 0xf3, 0xd2, 0xe1, 0x42, 0x03, 0x01,
+ 0x00, 0x00, 0xc9, 0xb9, 0x47, 0x24, 0x01, 0x00,
+ 0xa1, 0xd2, 0x28, 0xd6, 0x04, 0xbd, 0x0e, 0x06,
+ 0x0d, 0x0d, 0x30, 0x3f, 0x54, 0x49, 0x0e, 0x42,
+ 0x07, 0x05, 0x00, 0x02, 0x03, 0x02, 0x04, 0x00,
+ 0x00, 0x43, 0x05, 0xd8, 0x06, 0x00, 0x01, 0x00,
+ 0xee, 0x07, 0x00, 0x01, 0x00, 0xd0, 0x06, 0x00,
+ 0x00, 0x00, 0xa8, 0x06, 0x00, 0x01, 0x00, 0xa4,
+ 0x06, 0x00, 0x02, 0x00, 0x26, 0x00, 0x00, 0xcd,
+ 0xb9, 0xce, 0xca, 0xd5, 0xa7, 0xee, 0x09, 0xc9,
+ 0xca, 0xb9, 0x49, 0x97, 0x01, 0xf0, 0xf4, 0x38,
+ 0x94, 0x00, 0x00, 0x00, 0x42, 0xa6, 0x01, 0x00,
+ 0x00, 0x38, 0xea, 0x00, 0x00, 0x00, 0x41, 0x3b,
+ 0x00, 0x00, 0x00, 0x24, 0x01, 0x00, 0xd3, 0xd6,
+ 0x43, 0xf7, 0x01, 0x00, 0x00, 0x38, 0x94, 0x00,
+ 0x00, 0x00, 0x42, 0x5f, 0x00, 0x00, 0x00, 0xc9,
+ 0xcb, 0x24, 0x02, 0x00, 0x0e, 0xc9, 0x28, 0xd6,
+ 0x04, 0xca, 0x0e, 0x07, 0x05, 0x17, 0x26, 0x2c,
+ 0x7b, 0x21, 0x53, 0x0e, 0x42, 0x07, 0x05, 0x00,
+ 0x01, 0x02, 0x01, 0x04, 0x01, 0x01, 0x6b, 0x03,
+ 0xba, 0x06, 0x00, 0x01, 0x00, 0x8a, 0x08, 0x00,
+ 0x00, 0x00, 0xd8, 0x06, 0x00, 0x01, 0x00, 0xc8,
+ 0x05, 0x38, 0x01, 0xc4, 0x00, 0xcd, 0xe1, 0xd5,
+ 0xf3, 0xee, 0x19, 0x38, 0xe7, 0x00, 0x00, 0x00,
+ 0xd5, 0xf3, 0xdd, 0x42, 0x8b, 0x01, 0x00, 0x00,
+ 0x24, 0x00, 0x00, 0xd2, 0xb9, 0xa7, 0xee, 0x40,
+ 0xc9, 0xf2, 0x2f, 0xd5, 0x38, 0xe9, 0x00, 0x00,
+ 0x00, 0xab, 0xee, 0x31, 0xd5, 0x41, 0xc0, 0x01,
+ 0x00, 0x00, 0x42, 0x8b, 0x01, 0x00, 0x00, 0x24,
+ 0x00, 0x00, 0xb9, 0xae, 0xee, 0x04, 0xc9, 0xf2,
+ 0x2f, 0xd5, 0x41, 0xc1, 0x01, 0x00, 0x00, 0x42,
+ 0x8b, 0x01, 0x00, 0x00, 0x24, 0x00, 0x00, 0xd2,
+ 0xb9, 0xa7, 0xee, 0x04, 0xc9, 0xf2, 0x2f, 0xca,
+ 0x90, 0xce, 0xf0, 0x04, 0xc9, 0xf2, 0x2f, 0x38,
+ 0xea, 0x00, 0x00, 0x00, 0x42, 0x8e, 0x01, 0x00,
+ 0x00, 0xb9, 0xca, 0x25, 0x02, 0x00, 0xd6, 0x04,
+ 0xd6, 0x0e, 0x11, 0x00, 0x03, 0x0a, 0x1c, 0x2b,
+ 0x30, 0x17, 0x0d, 0x35, 0x5d, 0x12, 0x4e, 0x17,
+ 0x12, 0x12, 0x0d, 0x12, 0x0e, 0x43, 0x06, 0x05,
+ 0x8a, 0x08, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+ 0x0d, 0x00, 0x38, 0xd0, 0x00, 0x00, 0x00, 0x04,
+ 0x06, 0x02, 0x00, 0x00, 0x23, 0x01, 0x00, 0xd6,
+ 0x04, 0xd7, 0x0e, 0x01, 0x03, 0x0e, 0x43, 0x06,
+ 0x05, 0xd6, 0x03, 0x02, 0x04, 0x02, 0x03, 0x00,
+ 0x00, 0x2e, 0x06, 0x8e, 0x08, 0x00, 0x01, 0x00,
+ 0x90, 0x08, 0x00, 0x01, 0x00, 0xa8, 0x06, 0x00,
+ 0x00, 0x00, 0xbc, 0x06, 0x00, 0x01, 0x00, 0xd0,
+ 0x06, 0x00, 0x02, 0x00, 0x92, 0x08, 0x00, 0x03,
+ 0x00, 0xd6, 0xf6, 0xee, 0x03, 0xd5, 0xda, 0x26,
+ 0x00, 0x00, 0xcf, 0xb9, 0xcd, 0xc9, 0xd5, 0xa7,
+ 0xee, 0x1c, 0x26, 0x00, 0x00, 0xd0, 0xb9, 0xce,
+ 0xca, 0xd6, 0xa7, 0xee, 0x09, 0xcc, 0xca, 0xb9,
+ 0x49, 0x97, 0x01, 0xf0, 0xf4, 0xcb, 0xc9, 0xcc,
+ 0x49, 0x97, 0x00, 0xf0, 0xe1, 0xcb, 0x28, 0xd6,
+ 0x04, 0xef, 0x0e, 0x0a, 0x04, 0x17, 0x0d, 0x17,
+ 0x26, 0x17, 0x26, 0x2b, 0x17, 0x17, 0x0e, 0x42,
+ 0x07, 0x05, 0x00, 0x01, 0x02, 0x01, 0x03, 0x00,
+ 0x00, 0x1c, 0x03, 0xd8, 0x06, 0x00, 0x01, 0x00,
+ 0xd0, 0x06, 0x00, 0x00, 0x00, 0xa8, 0x06, 0x00,
+ 0x01, 0x00, 0x38, 0xeb, 0x00, 0x00, 0x00, 0xd5,
+ 0xd5, 0xf4, 0xcd, 0xb9, 0xce, 0xca, 0xd5, 0xa7,
+ 0xee, 0x0b, 0xc9, 0xca, 0x47, 0xca, 0xba, 0x49,
+ 0x97, 0x01, 0xf0, 0xf2, 0xc9, 0x28, 0xd6, 0x04,
+ 0xfe, 0x0e, 0x04, 0x04, 0x30, 0x26, 0x35, 0x0e,
+ 0x42, 0x07, 0x05, 0x00, 0x01, 0x03, 0x01, 0x04,
+ 0x00, 0x00, 0x22, 0x04, 0xba, 0x06, 0x00, 0x01,
+ 0x00, 0xd0, 0x06, 0x00, 0x00, 0x00, 0xa8, 0x06,
+ 0x00, 0x01, 0x00, 0xd8, 0x06, 0x00, 0x02, 0x00,
+ 0xd5, 0xed, 0xcf, 0x38, 0xeb, 0x00, 0x00, 0x00,
+ 0xcb, 0xcb, 0xf4, 0xcd, 0xb9, 0xce, 0xca, 0xcb,
+ 0xa7, 0xee, 0x0e, 0xc9, 0xca, 0x47, 0xca, 0x74,
+ 0xd5, 0xca, 0x47, 0x49, 0x97, 0x01, 0xf0, 0xef,
+ 0xc9, 0x28, 0xd6, 0x04, 0x85, 0x0f, 0x05, 0x04,
+ 0x12, 0x30, 0x26, 0x44, 0x0e, 0x42, 0x07, 0x05,
+ 0x00, 0x01, 0x03, 0x01, 0x05, 0x00, 0x00, 0x2d,
+ 0x04, 0xd8, 0x06, 0x00, 0x01, 0x00, 0xa8, 0x06,
+ 0x00, 0x00, 0x00, 0xbc, 0x06, 0x00, 0x01, 0x00,
+ 0xd0, 0x06, 0x00, 0x02, 0x00, 0x38, 0xeb, 0x00,
+ 0x00, 0x00, 0xd5, 0xf3, 0xcf, 0xb9, 0xcd, 0xc9,
+ 0xd5, 0xa7, 0xee, 0x1d, 0xb9, 0xce, 0xca, 0xd5,
+ 0xa7, 0xee, 0x12, 0xcb, 0xc9, 0x47, 0xca, 0x74,
+ 0xba, 0xba, 0xc9, 0xa1, 0xca, 0xa1, 0x9f, 0x49,
+ 0x97, 0x01, 0xf0, 0xeb, 0x97, 0x00, 0xf0, 0xe0,
+ 0xcb, 0x28, 0xd6, 0x04, 0x8d, 0x0f, 0x07, 0x04,
+ 0x2b, 0x26, 0x26, 0x44, 0x17, 0x17, 0x0e, 0x42,
+ 0x07, 0x05, 0x00, 0x01, 0x05, 0x01, 0x04, 0x00,
+ 0x00, 0x87, 0x01, 0x06, 0xba, 0x06, 0x00, 0x01,
+ 0x00, 0x8e, 0x08, 0x00, 0x00, 0x00, 0x90, 0x08,
+ 0x00, 0x01, 0x00, 0xd0, 0x06, 0x00, 0x02, 0x00,
+ 0xa8, 0x06, 0x00, 0x03, 0x00, 0xbc, 0x06, 0x00,
+ 0x04, 0x00, 0x38, 0x95, 0x00, 0x00, 0x00, 0x42,
+ 0xa2, 0x01, 0x00, 0x00, 0xd5, 0x24, 0x01, 0x00,
+ 0x9a, 0xee, 0x0d, 0x38, 0xd0, 0x00, 0x00, 0x00,
+ 0x04, 0x0a, 0x02, 0x00, 0x00, 0xf3, 0x2f, 0xd5,
+ 0xed, 0xcd, 0x38, 0x95, 0x00, 0x00, 0x00, 0x42,
+ 0xa2, 0x01, 0x00, 0x00, 0xd5, 0xb9, 0x47, 0x24,
+ 0x01, 0x00, 0x9a, 0xee, 0x20, 0xba, 0xce, 0x38,
+ 0xeb, 0x00, 0x00, 0x00, 0xca, 0xc9, 0xf4, 0xcf,
+ 0xb9, 0xd0, 0xcc, 0xc9, 0xa7, 0xee, 0x41, 0xcb,
+ 0xb9, 0x47, 0xcc, 0x74, 0xd5, 0xcc, 0x47, 0x49,
+ 0x97, 0x03, 0xf0, 0xef, 0xd5, 0xb9, 0x47, 0xed,
+ 0xce, 0x38, 0xeb, 0x00, 0x00, 0x00, 0xca, 0xc9,
+ 0xf4, 0xcf, 0xb9, 0xd0, 0xcc, 0xc9, 0xa7, 0xee,
+ 0x1f, 0xb9, 0xc7, 0x04, 0xc6, 0x04, 0xca, 0xa7,
+ 0xee, 0x12, 0xcb, 0xc6, 0x04, 0x47, 0xcc, 0x74,
+ 0xd5, 0xcc, 0x47, 0xc6, 0x04, 0x47, 0x49, 0x97,
+ 0x04, 0xf0, 0xea, 0x97, 0x03, 0xf0, 0xde, 0xcb,
+ 0x28, 0xd6, 0x04, 0x97, 0x0f, 0x11, 0x04, 0x58,
+ 0x3f, 0x12, 0x62, 0x0d, 0x30, 0x26, 0x30, 0x18,
+ 0x1c, 0x30, 0x26, 0x30, 0x44, 0x17, 0x18, 0x0e,
+ 0x42, 0x07, 0x05, 0x00, 0x01, 0x01, 0x01, 0x04,
+ 0x00, 0x00, 0x4b, 0x02, 0xba, 0x06, 0x00, 0x01,
+ 0x00, 0xd8, 0x06, 0x00, 0x00, 0x00, 0x38, 0x95,
+ 0x00, 0x00, 0x00, 0x42, 0xa2, 0x01, 0x00, 0x00,
+ 0xd5, 0x24, 0x01, 0x00, 0x9a, 0xee, 0x0d, 0x38,
+ 0xd0, 0x00, 0x00, 0x00, 0x04, 0x0b, 0x02, 0x00,
+ 0x00, 0xf3, 0x2f, 0xd5, 0xed, 0xcd, 0x38, 0x95,
+ 0x00, 0x00, 0x00, 0x42, 0xa2, 0x01, 0x00, 0x00,
+ 0xd5, 0xb9, 0x47, 0x24, 0x01, 0x00, 0x9a, 0x11,
+ 0xef, 0x08, 0x0e, 0xc9, 0xd5, 0xb9, 0x47, 0xed,
+ 0xae, 0xee, 0x0d, 0x38, 0xd0, 0x00, 0x00, 0x00,
+ 0x04, 0x0c, 0x02, 0x00, 0x00, 0xf3, 0x2f, 0xc9,
+ 0x28, 0xd6, 0x04, 0xad, 0x0f, 0x06, 0x04, 0x58,
+ 0x3f, 0x12, 0x94, 0x3f, 0x0e, 0x42, 0x07, 0x05,
+ 0x00, 0x01, 0x03, 0x01, 0x03, 0x00, 0x00, 0x2a,
+ 0x04, 0xba, 0x06, 0x00, 0x01, 0x00, 0xd8, 0x06,
+ 0x00, 0x00, 0x00, 0xd0, 0x06, 0x00, 0x01, 0x00,
+ 0xa8, 0x06, 0x00, 0x02, 0x00, 0x38, 0xeb, 0x00,
+ 0x00, 0x00, 0x42, 0x90, 0x01, 0x00, 0x00, 0xd5,
+ 0x24, 0x01, 0x00, 0xcd, 0xd5, 0xb9, 0x47, 0xb9,
+ 0x47, 0xce, 0xba, 0xcf, 0xcb, 0xc9, 0xa7, 0xee,
+ 0x0d, 0xca, 0xd5, 0xcb, 0x47, 0xcb, 0x47, 0xa1,
+ 0xce, 0x97, 0x02, 0xf0, 0xf0, 0xca, 0x28, 0xd6,
+ 0x04, 0xb6, 0x0f, 0x06, 0x04, 0x4e, 0x21, 0x26,
+ 0x2b, 0x17, 0x0e, 0x42, 0x07, 0x05, 0x00, 0x01,
+ 0x06, 0x01, 0x04, 0x00, 0x00, 0x80, 0x01, 0x07,
+ 0xba, 0x06, 0x00, 0x01, 0x00, 0xd8, 0x06, 0x00,
+ 0x00, 0x00, 0x8e, 0x07, 0x00, 0x01, 0x00, 0xee,
+ 0x06, 0x00, 0x02, 0x00, 0xa8, 0x06, 0x00, 0x03,
+ 0x00, 0xbc, 0x06, 0x00, 0x04, 0x00, 0x9a, 0x08,
+ 0x00, 0x05, 0x00, 0x38, 0xeb, 0x00, 0x00, 0x00,
+ 0x42, 0x90, 0x01, 0x00, 0x00, 0xd5, 0x24, 0x01,
+ 0x00, 0xcd, 0x26, 0x00, 0x00, 0xce, 0xb9, 0xd0,
+ 0xcc, 0xc9, 0xba, 0xa1, 0xa7, 0xee, 0x09, 0xca,
+ 0xcc, 0xb9, 0x49, 0x97, 0x03, 0xf0, 0xf2, 0xca,
+ 0xc9, 0xba, 0x49, 0x38, 0xeb, 0x00, 0x00, 0x00,
+ 0x42, 0x18, 0x01, 0x00, 0x00, 0xc9, 0x24, 0x01,
+ 0x00, 0xcf, 0xb9, 0xd0, 0xcc, 0xc9, 0xa7, 0xee,
+ 0x3a, 0xcb, 0xd5, 0x9e, 0xcf, 0x38, 0x1b, 0x01,
+ 0x00, 0x00, 0xcb, 0xf3, 0x90, 0xcc, 0xba, 0xa1,
+ 0x9f, 0xc7, 0x05, 0xca, 0xc9, 0xcc, 0xa2, 0xba,
+ 0xa2, 0xc6, 0x05, 0x49, 0xb9, 0xc7, 0x04, 0xc6,
+ 0x04, 0xc9, 0xa7, 0xee, 0x12, 0xcb, 0xc6, 0x04,
+ 0x47, 0xc6, 0x04, 0x74, 0x13, 0x47, 0xc6, 0x05,
+ 0xa1, 0x49, 0x97, 0x04, 0xf0, 0xea, 0x97, 0x03,
+ 0xf0, 0xc3, 0x38, 0xe7, 0x00, 0x00, 0x00, 0xca,
+ 0x23, 0x01, 0x00, 0xd6, 0x04, 0xbf, 0x0f, 0x0e,
+ 0x04, 0x4e, 0x17, 0x30, 0x2b, 0x17, 0x4e, 0x26,
+ 0x17, 0x49, 0x30, 0x30, 0x58, 0x17, 0x0e, 0x42,
+ 0x07, 0x05, 0x00, 0x01, 0x00, 0x01, 0x05, 0x00,
+ 0x00, 0x1b, 0x01, 0xba, 0x06, 0x00, 0x01, 0x00,
+ 0x38, 0xe7, 0x00, 0x00, 0x00, 0x42, 0x2a, 0x01,
+ 0x00, 0x00, 0x38, 0xeb, 0x00, 0x00, 0x00, 0x42,
+ 0x1c, 0x01, 0x00, 0x00, 0xd5, 0x24, 0x01, 0x00,
+ 0x25, 0x01, 0x00, 0xd6, 0x04, 0xd0, 0x0f, 0x01,
+ 0x03, 0x0e, 0x42, 0x07, 0x05, 0x00, 0x01, 0x08,
+ 0x01, 0x05, 0x00, 0x00, 0xdd, 0x01, 0x09, 0xba,
+ 0x06, 0x00, 0x01, 0x00, 0xd8, 0x06, 0x00, 0x00,
+ 0x00, 0xa8, 0x06, 0x00, 0x01, 0x00, 0xbc, 0x06,
+ 0x00, 0x02, 0x00, 0xc0, 0x06, 0x00, 0x03, 0x00,
+ 0xde, 0x06, 0x00, 0x04, 0x00, 0x9c, 0x08, 0x00,
+ 0x05, 0x00, 0xec, 0x06, 0x00, 0x06, 0x00, 0xee,
+ 0x06, 0x00, 0x07, 0x00, 0x38, 0xeb, 0x00, 0x00,
+ 0x00, 0x42, 0x90, 0x01, 0x00, 0x00, 0xd5, 0x24,
+ 0x01, 0x00, 0xcd, 0xba, 0xc7, 0x04, 0xd5, 0x42,
+ 0x91, 0x01, 0x00, 0x00, 0x24, 0x00, 0x00, 0xc7,
+ 0x05, 0xb9, 0xce, 0xca, 0xc9, 0xa7, 0x6c, 0x9d,
+ 0x00, 0x00, 0x00, 0xca, 0xcf, 0xcb, 0xc9, 0xa7,
+ 0xee, 0x0f, 0xc6, 0x05, 0xcb, 0x47, 0xca, 0x47,
+ 0xb9, 0xae, 0xef, 0x05, 0x97, 0x02, 0xf0, 0xee,
+ 0xcb, 0xc9, 0xad, 0xee, 0x03, 0xb9, 0x28, 0xcb,
+ 0xca, 0xae, 0xee, 0x2e, 0xb9, 0xd0, 0xcc, 0xc9,
+ 0xa7, 0xee, 0x22, 0xc6, 0x05, 0xcb, 0x47, 0xcc,
+ 0x47, 0xc7, 0x06, 0xc6, 0x05, 0xcb, 0x47, 0xcc,
+ 0x74, 0xc6, 0x05, 0xca, 0x47, 0xcc, 0x47, 0x49,
+ 0xc6, 0x05, 0xca, 0x47, 0xcc, 0xc6, 0x06, 0x49,
+ 0x97, 0x03, 0xf0, 0xdb, 0xc6, 0x04, 0x90, 0xc7,
+ 0x04, 0xc6, 0x05, 0xca, 0x47, 0xca, 0x47, 0x42,
+ 0xfd, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0xc7,
+ 0x07, 0xca, 0xba, 0xa1, 0xcf, 0xcb, 0xc9, 0xa7,
+ 0xee, 0x2e, 0xc6, 0x07, 0xc6, 0x05, 0xcb, 0x47,
+ 0xca, 0x47, 0x9e, 0xc7, 0x06, 0xb9, 0xd0, 0xcc,
+ 0xc9, 0xa7, 0xee, 0x18, 0xc6, 0x05, 0xcb, 0x47,
+ 0xcc, 0x74, 0x13, 0x47, 0xc6, 0x05, 0xca, 0x47,
+ 0xcc, 0x47, 0xc6, 0x06, 0x9e, 0xa2, 0x49, 0x97,
+ 0x03, 0xf0, 0xe5, 0x97, 0x02, 0xf0, 0xcf, 0x97,
+ 0x01, 0xf1, 0x61, 0xff, 0xc6, 0x04, 0xc7, 0x07,
+ 0xb9, 0xce, 0xca, 0xc9, 0xa7, 0xee, 0x10, 0xc6,
+ 0x07, 0xc6, 0x05, 0xca, 0x47, 0xca, 0x47, 0x9e,
+ 0xc7, 0x07, 0x97, 0x01, 0xf0, 0xed, 0xc6, 0x07,
+ 0x28, 0xd6, 0x04, 0xd3, 0x0f, 0x1d, 0x05, 0x4e,
+ 0x12, 0x3a, 0x35, 0x26, 0x2b, 0x0d, 0x17, 0x1c,
+ 0x0d, 0x1c, 0x26, 0x2b, 0x44, 0x2b, 0x17, 0x1d,
+ 0x53, 0x30, 0x3a, 0x26, 0x62, 0x17, 0x17, 0x1c,
+ 0x17, 0x26, 0x4e, 0x0e, 0x42, 0x07, 0x05, 0x00,
+ 0x01, 0x0a, 0x01, 0x05, 0x00, 0x00, 0x9f, 0x02,
+ 0x0b, 0xba, 0x06, 0x00, 0x01, 0x00, 0xd8, 0x06,
+ 0x00, 0x00, 0x00, 0x9e, 0x08, 0x00, 0x01, 0x00,
+ 0x9c, 0x08, 0x00, 0x02, 0x00, 0xa8, 0x06, 0x00,
+ 0x03, 0x00, 0xbc, 0x06, 0x00, 0x04, 0x00, 0xc0,
+ 0x06, 0x00, 0x05, 0x00, 0xe6, 0x07, 0x00, 0x06,
+ 0x00, 0xd0, 0x06, 0x00, 0x07, 0x00, 0xee, 0x06,
+ 0x00, 0x08, 0x00, 0xec, 0x06, 0x00, 0x09, 0x00,
+ 0x38, 0xeb, 0x00, 0x00, 0x00, 0x42, 0x90, 0x01,
+ 0x00, 0x00, 0xd5, 0x24, 0x01, 0x00, 0xcd, 0xd5,
+ 0x42, 0x91, 0x01, 0x00, 0x00, 0x24, 0x00, 0x00,
+ 0xcf, 0x38, 0xeb, 0x00, 0x00, 0x00, 0x42, 0x18,
+ 0x01, 0x00, 0x00, 0xc9, 0x24, 0x01, 0x00, 0xce,
+ 0xb9, 0xd0, 0xcc, 0xc9, 0xa7, 0x6c, 0xef, 0x00,
+ 0x00, 0x00, 0xcc, 0xc7, 0x04, 0xc6, 0x04, 0xc9,
+ 0xa7, 0xee, 0x0f, 0xcb, 0xc6, 0x04, 0x47, 0xcc,
+ 0x47, 0xb9, 0xae, 0xef, 0x05, 0x97, 0x04, 0xf0,
+ 0xed, 0xc6, 0x04, 0xc9, 0xad, 0xee, 0x0d, 0x38,
+ 0xcd, 0x00, 0x00, 0x00, 0x04, 0x10, 0x02, 0x00,
+ 0x00, 0xf3, 0x2f, 0xc6, 0x04, 0xcc, 0xae, 0xee,
+ 0x27, 0xcb, 0xc6, 0x04, 0x47, 0xc7, 0x09, 0xcb,
+ 0xc6, 0x04, 0x74, 0xcb, 0xcc, 0x47, 0x49, 0xcb,
+ 0xcc, 0xc6, 0x09, 0x49, 0xca, 0xc6, 0x04, 0x47,
+ 0xc7, 0x09, 0xca, 0xc6, 0x04, 0x74, 0xca, 0xcc,
+ 0x47, 0x49, 0xca, 0xcc, 0xc6, 0x09, 0x49, 0xcb,
+ 0xcc, 0x47, 0xcc, 0x47, 0x42, 0xfd, 0x00, 0x00,
+ 0x00, 0x24, 0x00, 0x00, 0xc7, 0x08, 0xb9, 0xc7,
+ 0x05, 0xc6, 0x05, 0xc9, 0xa7, 0xee, 0x1d, 0xcb,
+ 0xcc, 0x47, 0xc6, 0x05, 0x74, 0x13, 0x47, 0xc6,
+ 0x08, 0x9e, 0x49, 0xca, 0xcc, 0x47, 0xc6, 0x05,
+ 0x74, 0x13, 0x47, 0xc6, 0x08, 0x9e, 0x49, 0x97,
+ 0x05, 0xf0, 0xdf, 0xb9, 0xc7, 0x04, 0xc6, 0x04,
+ 0xc9, 0xa7, 0xee, 0x55, 0xc6, 0x04, 0xcc, 0xae,
+ 0xee, 0x4b, 0xcb, 0xc6, 0x04, 0x47, 0xcc, 0x47,
+ 0xc7, 0x08, 0xcc, 0xc7, 0x05, 0xc6, 0x05, 0xc9,
+ 0xa7, 0xee, 0x19, 0xcb, 0xc6, 0x04, 0x47, 0xc6,
+ 0x05, 0x74, 0x13, 0x47, 0xcb, 0xcc, 0x47, 0xc6,
+ 0x05, 0x47, 0xc6, 0x08, 0x9e, 0xa2, 0x49, 0x97,
+ 0x05, 0xf0, 0xe3, 0xb9, 0xc7, 0x05, 0xc6, 0x05,
+ 0xc9, 0xa7, 0xee, 0x19, 0xca, 0xc6, 0x04, 0x47,
+ 0xc6, 0x05, 0x74, 0x13, 0x47, 0xca, 0xcc, 0x47,
+ 0xc6, 0x05, 0x47, 0xc6, 0x08, 0x9e, 0xa2, 0x49,
+ 0x97, 0x05, 0xf0, 0xe3, 0x97, 0x04, 0xf0, 0xa7,
+ 0x97, 0x03, 0xf1, 0x0f, 0xff, 0xca, 0x28, 0xd6,
+ 0x04, 0xf5, 0x0f, 0x22, 0x04, 0x4e, 0x35, 0x4e,
+ 0x35, 0x30, 0x2b, 0x0d, 0x17, 0x21, 0x3f, 0x22,
+ 0x21, 0x2b, 0x1c, 0x21, 0x2b, 0x1e, 0x4e, 0x30,
+ 0x3f, 0x3f, 0x18, 0x30, 0x21, 0x2b, 0x30, 0x67,
+ 0x17, 0x30, 0x67, 0x18, 0x17, 0x1c, 0x0e, 0x42,
+ 0x07, 0x05, 0x00, 0x01, 0x08, 0x01, 0x05, 0x00,
+ 0x00, 0x92, 0x02, 0x09, 0xba, 0x06, 0x00, 0x01,
+ 0x00, 0x9c, 0x08, 0x00, 0x00, 0x00, 0xa8, 0x06,
+ 0x00, 0x01, 0x00, 0xbc, 0x06, 0x00, 0x02, 0x00,
+ 0xc0, 0x06, 0x00, 0x03, 0x00, 0x90, 0x08, 0x00,
+ 0x04, 0x00, 0x8e, 0x08, 0x00, 0x05, 0x00, 0xa2,
+ 0x08, 0x00, 0x06, 0x00, 0xee, 0x06, 0x00, 0x07,
+ 0x00, 0x38, 0x95, 0x00, 0x00, 0x00, 0x42, 0xa2,
+ 0x01, 0x00, 0x00, 0xd5, 0x24, 0x01, 0x00, 0x9a,
+ 0x11, 0xef, 0x13, 0x0e, 0x38, 0x95, 0x00, 0x00,
+ 0x00, 0x42, 0xa2, 0x01, 0x00, 0x00, 0xd5, 0xb9,
+ 0x47, 0x24, 0x01, 0x00, 0x9a, 0xee, 0x0d, 0x38,
+ 0xd0, 0x00, 0x00, 0x00, 0x04, 0x0a, 0x02, 0x00,
+ 0x00, 0xf3, 0x2f, 0xd5, 0xed, 0xc7, 0x05, 0xd5,
+ 0xb9, 0x47, 0xed, 0xc7, 0x04, 0xd5, 0x42, 0x91,
+ 0x01, 0x00, 0x00, 0x24, 0x00, 0x00, 0xcd, 0xb9,
+ 0xc7, 0x06, 0xb9, 0xce, 0xca, 0xc6, 0x04, 0xa7,
+ 0x6c, 0xbf, 0x00, 0x00, 0x00, 0xc6, 0x06, 0xcf,
+ 0xcb, 0xc6, 0x05, 0xa7, 0xee, 0x0e, 0xc9, 0xcb,
+ 0x47, 0xca, 0x47, 0xb9, 0xae, 0xef, 0x05, 0x97,
+ 0x02, 0xf0, 0xee, 0xcb, 0xc6, 0x05, 0xad, 0x6d,
+ 0x9b, 0x00, 0x00, 0x00, 0xcb, 0xc6, 0x06, 0xae,
+ 0xee, 0x34, 0xb9, 0xd0, 0xcc, 0xc6, 0x04, 0xa7,
+ 0xee, 0x2c, 0x36, 0xb6, 0x01, 0x00, 0x00, 0xc9,
+ 0xcb, 0x47, 0xcc, 0x47, 0x3b, 0xb6, 0x01, 0x00,
+ 0x00, 0xc9, 0xcb, 0x47, 0xcc, 0x74, 0xc9, 0xc6,
+ 0x06, 0x47, 0xcc, 0x47, 0x49, 0xc9, 0xc6, 0x06,
+ 0x47, 0xcc, 0x74, 0x38, 0xb6, 0x01, 0x00, 0x00,
+ 0x49, 0x97, 0x03, 0xf0, 0xd0, 0xc9, 0xc6, 0x06,
+ 0x47, 0xca, 0x47, 0x42, 0xfd, 0x00, 0x00, 0x00,
+ 0x24, 0x00, 0x00, 0xc7, 0x07, 0xb9, 0xd0, 0xcc,
+ 0xc6, 0x04, 0xa7, 0xee, 0x11, 0xc9, 0xc6, 0x06,
+ 0x47, 0xcc, 0x74, 0x13, 0x47, 0xc6, 0x07, 0x9e,
+ 0x49, 0x97, 0x03, 0xf0, 0xeb, 0xc6, 0x06, 0xba,
+ 0xa1, 0xcf, 0xcb, 0xc6, 0x05, 0xa7, 0xee, 0x2a,
+ 0xc9, 0xcb, 0x47, 0xca, 0x47, 0xc7, 0x07, 0xca,
+ 0xd0, 0xcc, 0xc6, 0x04, 0xa7, 0xee, 0x17, 0xc9,
+ 0xcb, 0x47, 0xcc, 0x74, 0x13, 0x47, 0xc9, 0xc6,
+ 0x06, 0x47, 0xcc, 0x47, 0xc6, 0x07, 0x9e, 0xa2,
+ 0x49, 0x97, 0x03, 0xf0, 0xe5, 0x97, 0x02, 0xf0,
+ 0xd2, 0x97, 0x06, 0x97, 0x01, 0xf1, 0x3e, 0xff,
+ 0xc6, 0x06, 0x28, 0xd6, 0x04, 0x9f, 0x10, 0x21,
+ 0x05, 0x62, 0x62, 0x3f, 0x17, 0x21, 0x35, 0x12,
+ 0x3a, 0x30, 0x26, 0x0d, 0x17, 0x17, 0x1c, 0x22,
+ 0x2b, 0x4e, 0x3f, 0x3f, 0x19, 0x53, 0x2b, 0x3f,
+ 0x18, 0x3a, 0x26, 0x2b, 0x5d, 0x17, 0x17, 0x0d,
+ 0x1c, 0x0e, 0x42, 0x07, 0x05, 0x00, 0x01, 0x0c,
+ 0x01, 0x05, 0x00, 0x00, 0x90, 0x03, 0x0d, 0xba,
+ 0x06, 0x00, 0x01, 0x00, 0x9c, 0x08, 0x00, 0x00,
+ 0x00, 0xa8, 0x06, 0x00, 0x01, 0x00, 0xbc, 0x06,
+ 0x00, 0x02, 0x00, 0xc0, 0x06, 0x00, 0x03, 0x00,
+ 0x90, 0x08, 0x00, 0x04, 0x00, 0x8e, 0x08, 0x00,
+ 0x05, 0x00, 0xa2, 0x08, 0x00, 0x06, 0x00, 0xf4,
+ 0x06, 0x00, 0x07, 0x00, 0xd0, 0x06, 0x00, 0x08,
+ 0x00, 0xa4, 0x08, 0x00, 0x09, 0x00, 0xa6, 0x08,
+ 0x00, 0x0a, 0x00, 0xee, 0x06, 0x00, 0x0b, 0x00,
+ 0x38, 0x95, 0x00, 0x00, 0x00, 0x42, 0xa2, 0x01,
+ 0x00, 0x00, 0xd5, 0x24, 0x01, 0x00, 0x9a, 0x11,
+ 0xef, 0x13, 0x0e, 0x38, 0x95, 0x00, 0x00, 0x00,
+ 0x42, 0xa2, 0x01, 0x00, 0x00, 0xd5, 0xb9, 0x47,
+ 0x24, 0x01, 0x00, 0x9a, 0xee, 0x0d, 0x38, 0xd0,
+ 0x00, 0x00, 0x00, 0x04, 0x0a, 0x02, 0x00, 0x00,
+ 0xf3, 0x2f, 0xd5, 0xed, 0xc7, 0x05, 0xd5, 0xb9,
+ 0x47, 0xed, 0xc7, 0x04, 0xd5, 0x42, 0x91, 0x01,
+ 0x00, 0x00, 0x24, 0x00, 0x00, 0xcd, 0x26, 0x00,
+ 0x00, 0xc7, 0x09, 0xb9, 0xc7, 0x06, 0xb9, 0xce,
+ 0xca, 0xc6, 0x04, 0xa7, 0x6c, 0xcc, 0x00, 0x00,
+ 0x00, 0xc6, 0x09, 0xca, 0x09, 0x49, 0xc6, 0x06,
+ 0xcf, 0xcb, 0xc6, 0x05, 0xa7, 0xee, 0x0e, 0xc9,
+ 0xcb, 0x47, 0xca, 0x47, 0xb9, 0xae, 0xef, 0x05,
+ 0x97, 0x02, 0xf0, 0xee, 0xcb, 0xc6, 0x05, 0xad,
+ 0x6d, 0xa3, 0x00, 0x00, 0x00, 0xc6, 0x09, 0xca,
+ 0x0a, 0x49, 0xcb, 0xc6, 0x06, 0xae, 0xee, 0x34,
+ 0xb9, 0xd0, 0xcc, 0xc6, 0x04, 0xa7, 0xee, 0x2c,
+ 0x36, 0xb6, 0x01, 0x00, 0x00, 0xc9, 0xcb, 0x47,
+ 0xcc, 0x47, 0x3b, 0xb6, 0x01, 0x00, 0x00, 0xc9,
+ 0xcb, 0x47, 0xcc, 0x74, 0xc9, 0xc6, 0x06, 0x47,
+ 0xcc, 0x47, 0x49, 0xc9, 0xc6, 0x06, 0x47, 0xcc,
+ 0x74, 0x38, 0xb6, 0x01, 0x00, 0x00, 0x49, 0x97,
+ 0x03, 0xf0, 0xd0, 0xc9, 0xc6, 0x06, 0x47, 0xca,
+ 0x47, 0x42, 0xfd, 0x00, 0x00, 0x00, 0x24, 0x00,
+ 0x00, 0xc7, 0x0b, 0xb9, 0xd0, 0xcc, 0xc6, 0x04,
+ 0xa7, 0xee, 0x11, 0xc9, 0xc6, 0x06, 0x47, 0xcc,
+ 0x74, 0x13, 0x47, 0xc6, 0x0b, 0x9e, 0x49, 0x97,
+ 0x03, 0xf0, 0xeb, 0xb9, 0xcf, 0xcb, 0xc6, 0x05,
+ 0xa7, 0xee, 0x30, 0xcb, 0xc6, 0x06, 0xae, 0xee,
+ 0x26, 0xc9, 0xcb, 0x47, 0xca, 0x47, 0xc7, 0x0b,
+ 0xca, 0xd0, 0xcc, 0xc6, 0x04, 0xa7, 0xee, 0x17,
+ 0xc9, 0xcb, 0x47, 0xcc, 0x74, 0x13, 0x47, 0xc9,
+ 0xc6, 0x06, 0x47, 0xcc, 0x47, 0xc6, 0x0b, 0x9e,
+ 0xa2, 0x49, 0x97, 0x03, 0xf0, 0xe5, 0x97, 0x02,
+ 0xf0, 0xcc, 0x97, 0x06, 0x97, 0x01, 0xf1, 0x31,
+ 0xff, 0xc6, 0x04, 0xc6, 0x06, 0xa2, 0xc7, 0x0a,
+ 0x38, 0xeb, 0x00, 0x00, 0x00, 0xc6, 0x04, 0xc6,
+ 0x0a, 0xf4, 0xc7, 0x08, 0xb9, 0xd0, 0xb9, 0xce,
+ 0xca, 0xc6, 0x04, 0xa7, 0xee, 0x50, 0xc6, 0x09,
+ 0xca, 0x47, 0x9a, 0xee, 0x45, 0xb9, 0xc7, 0x06,
+ 0xb9, 0xc7, 0x07, 0xb9, 0xcf, 0xcb, 0xc6, 0x04,
+ 0xa7, 0xee, 0x35, 0xc6, 0x09, 0xcb, 0x47, 0xee,
+ 0x13, 0xc6, 0x08, 0xcb, 0x47, 0xcc, 0x74, 0xc9,
+ 0xc6, 0x07, 0x47, 0xca, 0x47, 0x90, 0x49, 0x97,
+ 0x07, 0xf0, 0x19, 0xc6, 0x06, 0xcc, 0xad, 0xee,
+ 0x0a, 0xc6, 0x08, 0xcb, 0x47, 0xcc, 0xba, 0x49,
+ 0xf0, 0x08, 0xc6, 0x08, 0xcb, 0x47, 0xcc, 0xb9,
+ 0x49, 0x97, 0x06, 0x97, 0x02, 0xf0, 0xc7, 0x97,
+ 0x03, 0x97, 0x01, 0xf0, 0xac, 0xc6, 0x08, 0x28,
+ 0xd6, 0x04, 0xc8, 0x10, 0x3b, 0x05, 0x62, 0x62,
+ 0x3f, 0x17, 0x21, 0x35, 0x1c, 0x12, 0x3a, 0x1c,
+ 0x30, 0x26, 0x0d, 0x17, 0x17, 0x1c, 0x1c, 0x22,
+ 0x2b, 0x4e, 0x3f, 0x3f, 0x19, 0x53, 0x2b, 0x3f,
+ 0x18, 0x2b, 0x21, 0x26, 0x2b, 0x5d, 0x18, 0x17,
+ 0x0e, 0x00, 0x05, 0x08, 0x26, 0x3f, 0x0d, 0x2b,
+ 0x27, 0x12, 0x12, 0x2b, 0x21, 0x49, 0x0d, 0x0d,
+ 0x21, 0x26, 0x0d, 0x27, 0x0e, 0x17, 0x0e, 0x17,
+ 0x0e, 0x42, 0x07, 0x05, 0x00, 0x02, 0x03, 0x02,
+ 0x04, 0x00, 0x00, 0x2d, 0x05, 0xba, 0x06, 0x00,
+ 0x01, 0x00, 0xbe, 0x06, 0x00, 0x01, 0x00, 0xa8,
+ 0x06, 0x00, 0x00, 0x00, 0xd8, 0x06, 0x00, 0x01,
+ 0x00, 0xd0, 0x06, 0x00, 0x02, 0x00, 0xd5, 0xed,
+ 0xd2, 0xd6, 0xed, 0xae, 0xee, 0x0d, 0x38, 0xd0,
+ 0x00, 0x00, 0x00, 0x04, 0x14, 0x02, 0x00, 0x00,
+ 0xf3, 0x2f, 0xb9, 0xcf, 0xb9, 0xcd, 0xc9, 0xca,
+ 0xa7, 0xee, 0x0f, 0xcb, 0xd5, 0xc9, 0x47, 0xd6,
+ 0xc9, 0x47, 0x9e, 0xa1, 0xcf, 0x97, 0x00, 0xf0,
+ 0xee, 0xcb, 0x28, 0xd6, 0x04, 0x92, 0x11, 0x08,
+ 0x04, 0x12, 0x1c, 0x40, 0x0d, 0x26, 0x35, 0x17,
+ 0x0e, 0x42, 0x07, 0x05, 0x00, 0x02, 0x01, 0x02,
+ 0x06, 0x00, 0x00, 0x58, 0x03, 0xf2, 0x07, 0x00,
+ 0x01, 0x00, 0xf4, 0x07, 0x00, 0x01, 0x00, 0xd0,
+ 0x06, 0x00, 0x00, 0x00, 0xd5, 0xed, 0xbc, 0xae,
+ 0x11, 0xef, 0x06, 0x0e, 0xd6, 0xed, 0xbc, 0xae,
+ 0xee, 0x0d, 0x38, 0xd0, 0x00, 0x00, 0x00, 0x04,
+ 0x15, 0x02, 0x00, 0x00, 0xf3, 0x2f, 0x26, 0x00,
+ 0x00, 0xd1, 0xb9, 0x74, 0xd5, 0xba, 0x47, 0xd6,
+ 0xbb, 0x47, 0x9e, 0xd5, 0xbb, 0x47, 0xd6, 0xba,
+ 0x47, 0x9e, 0xa2, 0x49, 0xc9, 0xba, 0x74, 0xd5,
+ 0xbb, 0x47, 0xd6, 0xb9, 0x47, 0x9e, 0xd5, 0xb9,
+ 0x47, 0xd6, 0xbb, 0x47, 0x9e, 0xa2, 0x49, 0xc9,
+ 0xbb, 0x74, 0xd5, 0xb9, 0x47, 0xd6, 0xba, 0x47,
+ 0x9e, 0xd5, 0xba, 0x47, 0xd6, 0xb9, 0x47, 0x9e,
+ 0xa2, 0x49, 0xc9, 0x28, 0xd6, 0x04, 0x9f, 0x11,
+ 0x07, 0x04, 0x49, 0x3f, 0x17, 0x5d, 0x62, 0x62,
+ 0x0e, 0x43, 0x06, 0x05, 0xd6, 0x05, 0x02, 0x03,
+ 0x02, 0x05, 0x00, 0x00, 0x30, 0x05, 0xba, 0x06,
+ 0x00, 0x01, 0x00, 0xbe, 0x06, 0x00, 0x01, 0x00,
+ 0xd0, 0x06, 0x00, 0x00, 0x00, 0xa8, 0x06, 0x00,
+ 0x01, 0x00, 0xd8, 0x06, 0x00, 0x02, 0x00, 0xd5,
+ 0xed, 0xd3, 0xd6, 0xed, 0xae, 0xee, 0x0d, 0x38,
+ 0xd0, 0x00, 0x00, 0x00, 0x04, 0x16, 0x02, 0x00,
+ 0x00, 0xf3, 0x2f, 0x26, 0x00, 0x00, 0xcd, 0xb9,
+ 0xce, 0xca, 0xcb, 0xa7, 0xee, 0x10, 0xc9, 0xca,
+ 0x74, 0xd5, 0xca, 0x47, 0xd6, 0xca, 0x47, 0xa1,
+ 0x49, 0x97, 0x01, 0xf0, 0xed, 0xc9, 0x28, 0xd6,
+ 0x04, 0xab, 0x11, 0x07, 0x04, 0x12, 0x1c, 0x3f,
+ 0x17, 0x26, 0x4e, 0x0e, 0x43, 0x06, 0x05, 0xd8,
+ 0x05, 0x02, 0x03, 0x02, 0x05, 0x00, 0x00, 0x30,
+ 0x05, 0xba, 0x06, 0x00, 0x01, 0x00, 0xbe, 0x06,
+ 0x00, 0x01, 0x00, 0xd0, 0x06, 0x00, 0x00, 0x00,
+ 0xa8, 0x06, 0x00, 0x01, 0x00, 0xd8, 0x06, 0x00,
+ 0x02, 0x00, 0xd5, 0xed, 0xd3, 0xd6, 0xed, 0xae,
+ 0xee, 0x0d, 0x38, 0xd0, 0x00, 0x00, 0x00, 0x04,
+ 0x16, 0x02, 0x00, 0x00, 0xf3, 0x2f, 0x26, 0x00,
+ 0x00, 0xcd, 0xb9, 0xce, 0xca, 0xcb, 0xa7, 0xee,
+ 0x10, 0xc9, 0xca, 0x74, 0xd5, 0xca, 0x47, 0xd6,
+ 0xca, 0x47, 0xa2, 0x49, 0x97, 0x01, 0xf0, 0xed,
+ 0xc9, 0x28, 0xd6, 0x04, 0xb5, 0x11, 0x07, 0x04,
+ 0x12, 0x1c, 0x3f, 0x17, 0x26, 0x4e, 0x0e, 0x43,
+ 0x06, 0x05, 0xda, 0x05, 0x02, 0x03, 0x02, 0x04,
+ 0x00, 0x00, 0x1d, 0x05, 0xba, 0x06, 0x00, 0x01,
+ 0x00, 0xbe, 0x06, 0x00, 0x01, 0x00, 0xd0, 0x06,
+ 0x00, 0x00, 0x00, 0xa8, 0x06, 0x00, 0x01, 0x00,
+ 0xd8, 0x06, 0x00, 0x02, 0x00, 0xd5, 0xed, 0xcf,
+ 0x26, 0x00, 0x00, 0xcd, 0xb9, 0xce, 0xca, 0xcb,
+ 0xa7, 0xee, 0x0e, 0xc9, 0xca, 0x74, 0xd5, 0xca,
+ 0x47, 0xd6, 0x9e, 0x49, 0x97, 0x01, 0xf0, 0xef,
+ 0xc9, 0x28, 0xd6, 0x04, 0xbf, 0x11, 0x05, 0x04,
+ 0x12, 0x17, 0x26, 0x44, 0x0e, 0x43, 0x06, 0x05,
+ 0xdc, 0x05, 0x02, 0x0b, 0x02, 0x05, 0x00, 0x00,
+ 0xbf, 0x02, 0x0d, 0xba, 0x06, 0x00, 0x01, 0x00,
+ 0xbe, 0x06, 0x00, 0x01, 0x00, 0x8e, 0x08, 0x00,
+ 0x00, 0x00, 0x90, 0x08, 0x00, 0x01, 0x00, 0xa2,
+ 0x08, 0x00, 0x02, 0x00, 0xa8, 0x06, 0x00, 0x03,
+ 0x00, 0xbc, 0x06, 0x00, 0x04, 0x00, 0xc0, 0x06,
+ 0x00, 0x05, 0x00, 0xd0, 0x06, 0x00, 0x06, 0x00,
+ 0x92, 0x08, 0x00, 0x07, 0x00, 0xfc, 0x07, 0x00,
+ 0x08, 0x00, 0xae, 0x08, 0x00, 0x09, 0x00, 0xb0,
+ 0x08, 0x00, 0x0a, 0x00, 0xd5, 0xed, 0xcd, 0x38,
+ 0x95, 0x00, 0x00, 0x00, 0x42, 0xa2, 0x01, 0x00,
+ 0x00, 0xd5, 0xb9, 0x47, 0x24, 0x01, 0x00, 0xc8,
+ 0x09, 0xee, 0x08, 0xd5, 0xb9, 0x47, 0xed, 0xcf,
+ 0xf0, 0x03, 0xba, 0xcf, 0xcb, 0xd6, 0xed, 0xae,
+ 0xee, 0x0d, 0x38, 0xcd, 0x00, 0x00, 0x00, 0x04,
+ 0x19, 0x02, 0x00, 0x00, 0xf3, 0x2f, 0x38, 0x95,
+ 0x00, 0x00, 0x00, 0x42, 0xa2, 0x01, 0x00, 0x00,
+ 0xd6, 0xb9, 0x47, 0x24, 0x01, 0x00, 0xc8, 0x0a,
+ 0xee, 0x08, 0xd6, 0xb9, 0x47, 0xed, 0xce, 0xf0,
+ 0x03, 0xba, 0xce, 0x26, 0x00, 0x00, 0xc7, 0x06,
+ 0xc6, 0x09, 0xee, 0x55, 0xc6, 0x0a, 0xee, 0x51,
+ 0xb9, 0xd0, 0xcc, 0xc9, 0xa7, 0x6c, 0xda, 0x00,
+ 0x00, 0x00, 0x26, 0x00, 0x00, 0xc7, 0x07, 0xb9,
+ 0xc7, 0x04, 0xc6, 0x04, 0xca, 0xa7, 0xee, 0x2f,
+ 0xb9, 0xc7, 0x08, 0xb9, 0xc7, 0x05, 0xc6, 0x05,
+ 0xcb, 0xa7, 0xee, 0x18, 0xc6, 0x08, 0xd5, 0xcc,
+ 0x47, 0xc6, 0x05, 0x47, 0xd6, 0xc6, 0x05, 0x47,
+ 0xc6, 0x04, 0x47, 0x9e, 0xa1, 0xc7, 0x08, 0x97,
+ 0x05, 0xf0, 0xe4, 0xc6, 0x07, 0xc6, 0x04, 0xc6,
+ 0x08, 0x49, 0x97, 0x04, 0xf0, 0xcd, 0xc6, 0x06,
+ 0xcc, 0xc6, 0x07, 0x49, 0x97, 0x03, 0xf0, 0xb3,
+ 0xc6, 0x09, 0xee, 0x3a, 0xc6, 0x0a, 0x9a, 0xee,
+ 0x35, 0xb9, 0xd0, 0xcc, 0xc9, 0xa7, 0x6c, 0x81,
+ 0x00, 0x00, 0x00, 0xb9, 0xc7, 0x08, 0xb9, 0xc7,
+ 0x05, 0xc6, 0x05, 0xcb, 0xa7, 0xee, 0x15, 0xc6,
+ 0x08, 0xd5, 0xcc, 0x47, 0xc6, 0x05, 0x47, 0xd6,
+ 0xc6, 0x05, 0x47, 0x9e, 0xa1, 0xc7, 0x08, 0x97,
+ 0x05, 0xf0, 0xe7, 0xc6, 0x06, 0xcc, 0xc6, 0x08,
+ 0x49, 0x97, 0x03, 0xf0, 0xcf, 0xc6, 0x09, 0x9a,
+ 0xee, 0x38, 0xc6, 0x0a, 0xee, 0x34, 0xb9, 0xd0,
+ 0xcc, 0xc9, 0xa7, 0xee, 0x44, 0x26, 0x00, 0x00,
+ 0xc7, 0x07, 0xb9, 0xc7, 0x04, 0xc6, 0x04, 0xca,
+ 0xa7, 0xee, 0x15, 0xc6, 0x07, 0xc6, 0x04, 0x74,
+ 0xd5, 0xcc, 0x47, 0xd6, 0xb9, 0x47, 0xc6, 0x04,
+ 0x47, 0x9e, 0x49, 0x97, 0x04, 0xf0, 0xe7, 0xc6,
+ 0x06, 0xcc, 0xc6, 0x07, 0x49, 0x97, 0x03, 0xf0,
+ 0xd0, 0xb9, 0xd0, 0xcc, 0xc9, 0xa7, 0xee, 0x11,
+ 0xc6, 0x06, 0xcc, 0x74, 0xd5, 0xcc, 0x47, 0xd6,
+ 0xb9, 0x47, 0x9e, 0x49, 0x97, 0x03, 0xf0, 0xec,
+ 0xc6, 0x06, 0x28, 0xd6, 0x04, 0xc7, 0x11, 0x2d,
+ 0x04, 0x12, 0x5d, 0x0d, 0x1c, 0x0d, 0x0e, 0x21,
+ 0x3f, 0x5d, 0x0d, 0x27, 0x0d, 0x1c, 0x2b, 0x35,
+ 0x1c, 0x30, 0x12, 0x30, 0x62, 0x17, 0x26, 0x17,
+ 0x21, 0x17, 0x30, 0x35, 0x12, 0x30, 0x53, 0x17,
+ 0x21, 0x17, 0x30, 0x26, 0x1c, 0x30, 0x53, 0x17,
+ 0x21, 0x18, 0x26, 0x3f, 0x18, 0x0e, 0x43, 0x06,
+ 0x05, 0xde, 0x05, 0x02, 0x00, 0x02, 0x04, 0x01,
+ 0x00, 0x0e, 0x02, 0xba, 0x06, 0x00, 0x01, 0x00,
+ 0xbe, 0x06, 0x00, 0x01, 0x00, 0xdc, 0x05, 0x42,
+ 0x01, 0xe1, 0xd5, 0xd6, 0x42, 0xfd, 0x00, 0x00,
+ 0x00, 0x24, 0x00, 0x00, 0x23, 0x02, 0x00, 0xd6,
+ 0x04, 0xfb, 0x11, 0x01, 0x03, 0x0e, 0x43, 0x06,
+ 0x05, 0xe0, 0x05, 0x02, 0x00, 0x02, 0x03, 0x00,
+ 0x00, 0x0c, 0x02, 0xba, 0x06, 0x00, 0x01, 0x00,
+ 0xbe, 0x06, 0x00, 0x01, 0x00, 0xd5, 0xd6, 0x42,
+ 0xfd, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x9e,
+ 0x28, 0xd6, 0x04, 0xfe, 0x11, 0x01, 0x03, 0x0e,
+ 0x43, 0x06, 0x05, 0xe2, 0x05, 0x02, 0x02, 0x02,
+ 0x03, 0x00, 0x00, 0x22, 0x04, 0xba, 0x06, 0x00,
+ 0x01, 0x00, 0xbe, 0x06, 0x00, 0x01, 0x00, 0xd8,
+ 0x06, 0x00, 0x00, 0x00, 0xa8, 0x06, 0x00, 0x01,
+ 0x00, 0xd5, 0xed, 0xd1, 0xd6, 0xed, 0xae, 0xee,
+ 0x03, 0x09, 0x28, 0xb9, 0xce, 0xca, 0xc9, 0xa7,
+ 0xee, 0x10, 0xd5, 0xca, 0x47, 0xd6, 0xca, 0x47,
+ 0xae, 0xee, 0x03, 0x09, 0x28, 0x97, 0x01, 0xf0,
+ 0xed, 0x0a, 0x28, 0xd6, 0x04, 0x81, 0x12, 0x08,
+ 0x04, 0x12, 0x1c, 0x0d, 0x26, 0x30, 0x0d, 0x17,
+ 0x0e, 0x42, 0x07, 0x05, 0x00, 0x01, 0x00, 0x01,
+ 0x01, 0x00, 0x00, 0x02, 0x01, 0xba, 0x06, 0x00,
+ 0x01, 0x00, 0xd5, 0x28, 0xd6, 0x04, 0x94, 0x12,
+ 0x01, 0x03, 0x0e, 0x42, 0x07, 0x05, 0x00, 0x01,
+ 0x03, 0x01, 0x04, 0x00, 0x00, 0x1c, 0x04, 0xba,
+ 0x06, 0x00, 0x01, 0x00, 0xa8, 0x06, 0x00, 0x00,
+ 0x00, 0xd8, 0x06, 0x00, 0x01, 0x00, 0xd0, 0x06,
+ 0x00, 0x02, 0x00, 0xd5, 0xed, 0xce, 0x26, 0x00,
+ 0x00, 0xcf, 0xb9, 0xcd, 0xc9, 0xca, 0xa7, 0xee,
+ 0x0d, 0xcb, 0xc9, 0x74, 0xd5, 0xc9, 0x47, 0x90,
+ 0x49, 0x97, 0x00, 0xf0, 0xf0, 0xcb, 0x28, 0xd6,
+ 0x04, 0x97, 0x12, 0x05, 0x04, 0x12, 0x17, 0x26,
+ 0x3f, 0x0e, 0x42, 0x07, 0x05, 0x00, 0x02, 0x00,
+ 0x02, 0x03, 0x01, 0x00, 0x06, 0x02, 0xba, 0x06,
+ 0x00, 0x01, 0x00, 0xbe, 0x06, 0x00, 0x01, 0x00,
+ 0xda, 0x05, 0x41, 0x01, 0xe1, 0xd6, 0xd5, 0x23,
+ 0x02, 0x00, 0xd6, 0x04, 0xaa, 0x12, 0x00, 0x0e,
+ 0x42, 0x07, 0x05, 0x00, 0x02, 0x00, 0x02, 0x03,
+ 0x01, 0x00, 0x06, 0x02, 0xba, 0x06, 0x00, 0x01,
+ 0x00, 0xbe, 0x06, 0x00, 0x01, 0x00, 0xe0, 0x05,
+ 0x44, 0x01, 0xe1, 0xd6, 0xd5, 0x23, 0x02, 0x00,
+ 0xd6, 0x04, 0xab, 0x12, 0x00, 0x0e, 0x42, 0x07,
+ 0x05, 0x00, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00,
+ 0x25, 0x04, 0xa8, 0x06, 0x00, 0x00, 0x00, 0xd8,
+ 0x06, 0x00, 0x01, 0x00, 0xd0, 0x06, 0x00, 0x02,
+ 0x00, 0x10, 0x00, 0x01, 0x00, 0x08, 0xd0, 0xcc,
+ 0xed, 0xce, 0x26, 0x00, 0x00, 0xcf, 0xb9, 0xcd,
+ 0xc9, 0xca, 0xa7, 0xee, 0x14, 0xcb, 0xc9, 0x74,
+ 0xcc, 0xc9, 0x47, 0x42, 0xfb, 0x00, 0x00, 0x00,
+ 0x24, 0x00, 0x00, 0x49, 0x97, 0x00, 0xf0, 0xe9,
+ 0xcb, 0x28, 0xd6, 0x04, 0xaf, 0x12, 0x05, 0x0e,
+ 0x12, 0x17, 0x26, 0x62, 0x0e, 0x42, 0x07, 0x05,
+ 0x00, 0x00, 0x06, 0x00, 0x03, 0x00, 0x00, 0x3f,
+ 0x06, 0xd0, 0x06, 0x00, 0x00, 0x00, 0xa8, 0x06,
+ 0x00, 0x01, 0x00, 0xd8, 0x06, 0x00, 0x02, 0x00,
+ 0xd4, 0x07, 0x00, 0x03, 0x00, 0xba, 0x06, 0x00,
+ 0x04, 0x00, 0x10, 0x00, 0x01, 0x00, 0x08, 0xc7,
+ 0x05, 0xc6, 0x05, 0xc7, 0x04, 0x26, 0x00, 0x00,
+ 0xcd, 0xc6, 0x04, 0xed, 0xcf, 0xb9, 0xce, 0xca,
+ 0xcb, 0xa7, 0xee, 0x28, 0xc6, 0x04, 0xca, 0x47,
+ 0xd0, 0x38, 0x95, 0x00, 0x00, 0x00, 0x42, 0xa2,
+ 0x01, 0x00, 0x00, 0xcc, 0x24, 0x01, 0x00, 0xee,
+ 0x0b, 0xcc, 0x42, 0x91, 0x01, 0x00, 0x00, 0x24,
+ 0x00, 0x00, 0xd0, 0xc9, 0xca, 0xcc, 0x49, 0x97,
+ 0x01, 0xf0, 0xd5, 0xc9, 0x28, 0xd6, 0x04, 0xb7,
+ 0x12, 0x0a, 0x12, 0x17, 0x17, 0x17, 0x26, 0x1c,
+ 0x53, 0x35, 0x17, 0x17, 0x0e, 0x42, 0x07, 0x05,
+ 0x00, 0x00, 0x01, 0x00, 0x03, 0x00, 0x00, 0x10,
+ 0x01, 0x10, 0x00, 0x01, 0x00, 0x08, 0xcd, 0x38,
+ 0xeb, 0x00, 0x00, 0x00, 0x42, 0xfd, 0x00, 0x00,
+ 0x00, 0xc9, 0x25, 0x01, 0x00, 0xd6, 0x04, 0xc3,
+ 0x12, 0x01, 0x0d, 0x0e, 0x43, 0x06, 0x05, 0x00,
+ 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x0b, 0x00,
+ 0x38, 0xe3, 0x00, 0x00, 0x00, 0x41, 0x27, 0x01,
+ 0x00, 0x00, 0x28, 0xd6, 0x04, 0xd0, 0x12, 0x00,
+ 0x0e, 0x43, 0x06, 0x05, 0xee, 0x03, 0x01, 0x00,
+ 0x01, 0x02, 0x00, 0x00, 0x09, 0x01, 0xba, 0x06,
+ 0x00, 0x01, 0x00, 0xd5, 0x42, 0xf7, 0x00, 0x00,
+ 0x00, 0x25, 0x00, 0x00, 0xd6, 0x04, 0xdc, 0x12,
+ 0x01, 0x04, 0x0e, 0x43, 0x06, 0x05, 0xf0, 0x03,
+ 0x01, 0x00, 0x01, 0x02, 0x00, 0x00, 0x09, 0x01,
+ 0xba, 0x06, 0x00, 0x01, 0x00, 0xd5, 0x42, 0xf8,
+ 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0xd6, 0x04,
+ 0xe1, 0x12, 0x01, 0x04, 0x0e, 0x43, 0x06, 0x05,
+ 0xf2, 0x03, 0x01, 0x00, 0x01, 0x02, 0x00, 0x00,
+ 0x09, 0x01, 0xba, 0x06, 0x00, 0x01, 0x00, 0xd5,
+ 0x42, 0xf9, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00,
+ 0xd6, 0x04, 0xe6, 0x12, 0x01, 0x04, 0x0e, 0x43,
+ 0x06, 0x05, 0xf4, 0x03, 0x01, 0x00, 0x01, 0x02,
+ 0x00, 0x00, 0x09, 0x01, 0xba, 0x06, 0x00, 0x01,
+ 0x00, 0xd5, 0x42, 0xfa, 0x00, 0x00, 0x00, 0x25,
+ 0x00, 0x00, 0xd6, 0x04, 0xeb, 0x12, 0x01, 0x04,
+ 0x0e, 0x43, 0x06, 0x05, 0xf6, 0x03, 0x01, 0x00,
+ 0x01, 0x02, 0x00, 0x00, 0x09, 0x01, 0xba, 0x06,
+ 0x00, 0x01, 0x00, 0xd5, 0x42, 0xfb, 0x00, 0x00,
+ 0x00, 0x25, 0x00, 0x00, 0xd6, 0x04, 0xf0, 0x12,
+ 0x01, 0x04, 0x0e, 0x43, 0x06, 0x05, 0xf8, 0x03,
+ 0x01, 0x00, 0x01, 0x02, 0x00, 0x00, 0x09, 0x01,
+ 0xba, 0x06, 0x00, 0x01, 0x00, 0xd5, 0x42, 0xfc,
+ 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0xd6, 0x04,
+ 0xf5, 0x12, 0x01, 0x04, 0x0e, 0x43, 0x06, 0x05,
+ 0xfa, 0x03, 0x01, 0x00, 0x01, 0x02, 0x00, 0x00,
+ 0x09, 0x01, 0xba, 0x06, 0x00, 0x01, 0x00, 0xd5,
+ 0x42, 0xfd, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00,
+ 0xd6, 0x04, 0xfa, 0x12, 0x01, 0x04, 0x0e, 0x43,
+ 0x06, 0x05, 0xfc, 0x03, 0x01, 0x00, 0x01, 0x04,
+ 0x00, 0x00, 0x72, 0x01, 0xba, 0x06, 0x00, 0x01,
+ 0x00, 0x38, 0xe2, 0x00, 0x00, 0x00, 0x42, 0x76,
+ 0x01, 0x00, 0x00, 0xd5, 0x24, 0x01, 0x00, 0xee,
+ 0x03, 0xd5, 0x28, 0xd5, 0x38, 0xe4, 0x00, 0x00,
+ 0x00, 0xab, 0xee, 0x1a, 0x38, 0xe2, 0x00, 0x00,
+ 0x00, 0x42, 0xb1, 0x01, 0x00, 0x00, 0xd5, 0x41,
+ 0xc0, 0x01, 0x00, 0x00, 0xd5, 0x41, 0xc1, 0x01,
+ 0x00, 0x00, 0x25, 0x02, 0x00, 0xd5, 0x38, 0xe7,
+ 0x00, 0x00, 0x00, 0xab, 0xee, 0x03, 0xd5, 0x28,
+ 0xd5, 0x38, 0xe9, 0x00, 0x00, 0x00, 0xab, 0xee,
+ 0x1d, 0x38, 0xe7, 0x00, 0x00, 0x00, 0x42, 0x8c,
+ 0x01, 0x00, 0x00, 0xd5, 0x41, 0xc0, 0x01, 0x00,
+ 0x00, 0xd5, 0x41, 0xc1, 0x01, 0x00, 0x00, 0x24,
+ 0x02, 0x00, 0xb9, 0x47, 0x28, 0x38, 0xe3, 0x00,
+ 0x00, 0x00, 0x42, 0x00, 0x01, 0x00, 0x00, 0xd5,
+ 0x25, 0x01, 0x00, 0xd6, 0x04, 0xff, 0x12, 0x0a,
+ 0x04, 0x53, 0x08, 0x35, 0x80, 0x30, 0x08, 0x35,
+ 0x8a, 0x08, 0x0e, 0x43, 0x06, 0x05, 0xfe, 0x03,
+ 0x01, 0x00, 0x01, 0x04, 0x00, 0x00, 0x42, 0x01,
+ 0xba, 0x06, 0x00, 0x01, 0x00, 0x38, 0xe2, 0x00,
+ 0x00, 0x00, 0x42, 0x76, 0x01, 0x00, 0x00, 0xd5,
+ 0x24, 0x01, 0x00, 0xee, 0x03, 0xd5, 0x28, 0xd5,
+ 0x38, 0xe4, 0x00, 0x00, 0x00, 0xab, 0xee, 0x1a,
+ 0x38, 0xe2, 0x00, 0x00, 0x00, 0x42, 0x1a, 0x02,
+ 0x00, 0x00, 0xd5, 0x41, 0xc0, 0x01, 0x00, 0x00,
+ 0xd5, 0x41, 0xc1, 0x01, 0x00, 0x00, 0x25, 0x02,
+ 0x00, 0x38, 0xe3, 0x00, 0x00, 0x00, 0x42, 0xff,
+ 0x00, 0x00, 0x00, 0xd5, 0x25, 0x01, 0x00, 0xd6,
+ 0x04, 0x8e, 0x13, 0x05, 0x04, 0x53, 0x08, 0x35,
+ 0x81, 0x0e, 0x43, 0x06, 0x05, 0x80, 0x04, 0x01,
+ 0x00, 0x01, 0x04, 0x00, 0x00, 0x42, 0x01, 0xba,
+ 0x06, 0x00, 0x01, 0x00, 0x38, 0xe2, 0x00, 0x00,
+ 0x00, 0x42, 0x76, 0x01, 0x00, 0x00, 0xd5, 0x24,
+ 0x01, 0x00, 0xee, 0x03, 0xd5, 0x28, 0xd5, 0x38,
+ 0xe4, 0x00, 0x00, 0x00, 0xab, 0xee, 0x1a, 0x38,
+ 0xe2, 0x00, 0x00, 0x00, 0x42, 0x1b, 0x02, 0x00,
+ 0x00, 0xd5, 0x41, 0xc0, 0x01, 0x00, 0x00, 0xd5,
+ 0x41, 0xc1, 0x01, 0x00, 0x00, 0x25, 0x02, 0x00,
+ 0x38, 0xe3, 0x00, 0x00, 0x00, 0x42, 0x00, 0x01,
+ 0x00, 0x00, 0xd5, 0x25, 0x01, 0x00, 0xd6, 0x04,
+ 0x99, 0x13, 0x05, 0x04, 0x53, 0x08, 0x35, 0x81,
+ 0x0e, 0x43, 0x06, 0x05, 0x82, 0x04, 0x01, 0x04,
+ 0x01, 0x05, 0x00, 0x00, 0x8d, 0x01, 0x05, 0xba,
+ 0x06, 0x00, 0x01, 0x00, 0xda, 0x06, 0x00, 0x00,
+ 0x00, 0xea, 0x06, 0x00, 0x01, 0x00, 0x9c, 0x07,
+ 0x00, 0x02, 0x00, 0x9e, 0x07, 0x00, 0x03, 0x00,
+ 0xd5, 0x38, 0xea, 0x00, 0x00, 0x00, 0xab, 0xee,
+ 0x07, 0xd5, 0xba, 0xbb, 0x9f, 0xa3, 0x28, 0xd5,
+ 0x38, 0xe5, 0x00, 0x00, 0x00, 0xab, 0xee, 0x44,
+ 0x38, 0xfa, 0x00, 0x00, 0x00, 0xd5, 0xf3, 0xcd,
+ 0xd5, 0x41, 0xce, 0x01, 0x00, 0x00, 0xce, 0x38,
+ 0x01, 0x01, 0x00, 0x00, 0xc9, 0xca, 0xa1, 0xbb,
+ 0x9f, 0xf3, 0xcf, 0x38, 0x01, 0x01, 0x00, 0x00,
+ 0xc9, 0xca, 0xa2, 0xbb, 0x9f, 0xf3, 0xd0, 0xd5,
+ 0x41, 0xcf, 0x01, 0x00, 0x00, 0xb9, 0xa7, 0xee,
+ 0x04, 0xcc, 0x90, 0xd0, 0x38, 0xe5, 0x00, 0x00,
+ 0x00, 0x42, 0x89, 0x01, 0x00, 0x00, 0xcb, 0xcc,
+ 0x25, 0x02, 0x00, 0x38, 0xe3, 0x00, 0x00, 0x00,
+ 0xd5, 0xf3, 0xdd, 0xb9, 0xa7, 0xee, 0x19, 0x38,
+ 0xe5, 0x00, 0x00, 0x00, 0xb9, 0x38, 0xe3, 0x00,
+ 0x00, 0x00, 0x42, 0x01, 0x01, 0x00, 0x00, 0xd5,
+ 0x90, 0x24, 0x01, 0x00, 0x23, 0x02, 0x00, 0x38,
+ 0xe3, 0x00, 0x00, 0x00, 0x42, 0x01, 0x01, 0x00,
+ 0x00, 0xd5, 0x25, 0x01, 0x00, 0xd6, 0x04, 0xa4,
+ 0x13, 0x0e, 0x05, 0x30, 0x1c, 0x35, 0x2b, 0x26,
+ 0x3f, 0x3f, 0x35, 0x12, 0x4f, 0x2b, 0x17, 0x7c,
+ 0x0e, 0x43, 0x06, 0x05, 0x84, 0x04, 0x01, 0x00,
+ 0x01, 0x02, 0x00, 0x00, 0x09, 0x01, 0xba, 0x06,
+ 0x00, 0x01, 0x00, 0xd5, 0x42, 0x02, 0x01, 0x00,
+ 0x00, 0x25, 0x00, 0x00, 0xd6, 0x04, 0xbb, 0x13,
+ 0x01, 0x04, 0x0e, 0x43, 0x06, 0x05, 0x86, 0x04,
+ 0x01, 0x00, 0x01, 0x02, 0x00, 0x00, 0x09, 0x01,
+ 0xba, 0x06, 0x00, 0x01, 0x00, 0xd5, 0x42, 0x03,
+ 0x01, 0x00, 0x00, 0x25, 0x00, 0x00, 0xd6, 0x04,
+ 0xc0, 0x13, 0x01, 0x04, 0x0e, 0x43, 0x06, 0x05,
+ 0x88, 0x04, 0x01, 0x00, 0x01, 0x02, 0x00, 0x00,
+ 0x13, 0x01, 0xba, 0x06, 0x00, 0x01, 0x00, 0x38,
+ 0x03, 0x01, 0x00, 0x00, 0xd5, 0xf3, 0x38, 0xe3,
+ 0x00, 0x00, 0x00, 0x41, 0x85, 0x01, 0x00, 0x00,
+ 0x9e, 0x28, 0xd6, 0x04, 0xc5, 0x13, 0x01, 0x04,
+ 0x0e, 0x43, 0x06, 0x05, 0x8a, 0x04, 0x01, 0x00,
+ 0x01, 0x02, 0x00, 0x00, 0x13, 0x01, 0xba, 0x06,
+ 0x00, 0x01, 0x00, 0x38, 0x03, 0x01, 0x00, 0x00,
+ 0xd5, 0xf3, 0x38, 0xe3, 0x00, 0x00, 0x00, 0x41,
+ 0x86, 0x01, 0x00, 0x00, 0x9e, 0x28, 0xd6, 0x04,
+ 0xca, 0x13, 0x01, 0x04, 0x0e, 0x43, 0x06, 0x05,
+ 0x8c, 0x04, 0x01, 0x00, 0x01, 0x02, 0x00, 0x00,
+ 0x0b, 0x01, 0xba, 0x06, 0x00, 0x01, 0x00, 0x38,
+ 0x05, 0x01, 0x00, 0x00, 0xd5, 0xf3, 0xc1, 0x0a,
+ 0x9e, 0x28, 0xd6, 0x04, 0xcf, 0x13, 0x01, 0x04,
+ 0x0e, 0x43, 0x06, 0x05, 0x8e, 0x04, 0x01, 0x00,
+ 0x01, 0x03, 0x00, 0x00, 0x08, 0x01, 0xba, 0x06,
+ 0x00, 0x01, 0x00, 0xc1, 0x0a, 0xd5, 0xc1, 0x0a,
+ 0x9f, 0xa3, 0x28, 0xd6, 0x04, 0xd4, 0x13, 0x01,
+ 0x04, 0x0e, 0x43, 0x06, 0x05, 0x90, 0x04, 0x01,
+ 0x01, 0x01, 0x04, 0x00, 0x00, 0x43, 0x02, 0xba,
+ 0x06, 0x00, 0x01, 0x00, 0xda, 0x06, 0x00, 0x00,
+ 0x00, 0xd5, 0x38, 0xe5, 0x00, 0x00, 0x00, 0xab,
+ 0x11, 0xef, 0x09, 0x0e, 0xd5, 0x38, 0xea, 0x00,
+ 0x00, 0x00, 0xab, 0xee, 0x1c, 0x38, 0x02, 0x01,
+ 0x00, 0x00, 0xd5, 0x38, 0xec, 0x00, 0x00, 0x00,
+ 0x9e, 0xf3, 0xd1, 0xba, 0xc9, 0x9f, 0xa2, 0xbb,
+ 0x38, 0xec, 0x00, 0x00, 0x00, 0x9e, 0x9f, 0x28,
+ 0x38, 0xe3, 0x00, 0x00, 0x00, 0x42, 0x08, 0x01,
+ 0x00, 0x00, 0x38, 0xe3, 0x00, 0x00, 0x00, 0xd5,
+ 0xf3, 0x25, 0x01, 0x00, 0xd6, 0x04, 0xd9, 0x13,
+ 0x05, 0x05, 0x67, 0x49, 0x3f, 0x08, 0x0e, 0x43,
+ 0x06, 0x05, 0x92, 0x04, 0x01, 0x01, 0x01, 0x04,
+ 0x00, 0x00, 0x3d, 0x02, 0xba, 0x06, 0x00, 0x01,
+ 0x00, 0xda, 0x06, 0x00, 0x00, 0x00, 0xd5, 0x38,
+ 0xe5, 0x00, 0x00, 0x00, 0xab, 0x11, 0xef, 0x09,
+ 0x0e, 0xd5, 0x38, 0xea, 0x00, 0x00, 0x00, 0xab,
+ 0xee, 0x16, 0x38, 0x02, 0x01, 0x00, 0x00, 0xd5,
+ 0x38, 0xec, 0x00, 0x00, 0x00, 0x9e, 0xf3, 0xd1,
+ 0xba, 0xc9, 0x9f, 0xa1, 0xbb, 0x9f, 0x28, 0x38,
+ 0xe3, 0x00, 0x00, 0x00, 0x42, 0x09, 0x01, 0x00,
+ 0x00, 0x38, 0xe3, 0x00, 0x00, 0x00, 0xd5, 0xf3,
+ 0x25, 0x01, 0x00, 0xd6, 0x04, 0xe4, 0x13, 0x05,
+ 0x05, 0x67, 0x49, 0x21, 0x08, 0x0e, 0x43, 0x06,
+ 0x05, 0x94, 0x04, 0x01, 0x00, 0x01, 0x04, 0x00,
+ 0x00, 0x38, 0x01, 0xba, 0x06, 0x00, 0x01, 0x00,
+ 0xd5, 0x38, 0xe5, 0x00, 0x00, 0x00, 0xab, 0x11,
+ 0xef, 0x09, 0x0e, 0xd5, 0x38, 0xea, 0x00, 0x00,
+ 0x00, 0xab, 0xee, 0x11, 0x38, 0x08, 0x01, 0x00,
+ 0x00, 0xd5, 0xf3, 0x38, 0x09, 0x01, 0x00, 0x00,
+ 0xd5, 0xf3, 0x9f, 0x28, 0x38, 0xe3, 0x00, 0x00,
+ 0x00, 0x42, 0x0a, 0x01, 0x00, 0x00, 0x38, 0xe3,
+ 0x00, 0x00, 0x00, 0xd5, 0xf3, 0x25, 0x01, 0x00,
+ 0xd6, 0x04, 0xef, 0x13, 0x04, 0x04, 0x67, 0x4e,
+ 0x08, 0x0e, 0x43, 0x06, 0x05, 0x96, 0x04, 0x01,
+ 0x00, 0x01, 0x04, 0x00, 0x00, 0x14, 0x01, 0xba,
+ 0x06, 0x00, 0x01, 0x00, 0x38, 0xe3, 0x00, 0x00,
+ 0x00, 0x42, 0x0b, 0x01, 0x00, 0x00, 0x38, 0xe3,
+ 0x00, 0x00, 0x00, 0xd5, 0xf3, 0x25, 0x01, 0x00,
+ 0xd6, 0x04, 0xf8, 0x13, 0x01, 0x04, 0x0e, 0x43,
+ 0x06, 0x05, 0x98, 0x04, 0x01, 0x00, 0x01, 0x04,
+ 0x00, 0x00, 0x14, 0x01, 0xba, 0x06, 0x00, 0x01,
+ 0x00, 0x38, 0xe3, 0x00, 0x00, 0x00, 0x42, 0x0c,
+ 0x01, 0x00, 0x00, 0x38, 0xe3, 0x00, 0x00, 0x00,
+ 0xd5, 0xf3, 0x25, 0x01, 0x00, 0xd6, 0x04, 0xfd,
+ 0x13, 0x01, 0x04, 0x0e, 0x43, 0x06, 0x05, 0x9a,
+ 0x04, 0x01, 0x00, 0x01, 0x04, 0x00, 0x00, 0x14,
+ 0x01, 0xba, 0x06, 0x00, 0x01, 0x00, 0x38, 0xe3,
+ 0x00, 0x00, 0x00, 0x42, 0x0d, 0x01, 0x00, 0x00,
+ 0x38, 0xe3, 0x00, 0x00, 0x00, 0xd5, 0xf3, 0x25,
+ 0x01, 0x00, 0xd6, 0x04, 0x82, 0x14, 0x01, 0x04,
+ 0x0e, 0x43, 0x06, 0x05, 0x9c, 0x04, 0x02, 0x00,
+ 0x02, 0x05, 0x00, 0x00, 0x1b, 0x02, 0xba, 0x06,
+ 0x00, 0x01, 0x00, 0xbe, 0x06, 0x00, 0x01, 0x00,
+ 0x38, 0xe3, 0x00, 0x00, 0x00, 0x42, 0x0e, 0x01,
+ 0x00, 0x00, 0x38, 0xe3, 0x00, 0x00, 0x00, 0xd5,
+ 0xf3, 0x38, 0xe3, 0x00, 0x00, 0x00, 0xd6, 0xf3,
+ 0x25, 0x02, 0x00, 0xd6, 0x04, 0x87, 0x14, 0x01,
+ 0x04, 0x0e, 0x43, 0x06, 0x05, 0x9e, 0x04, 0x01,
+ 0x00, 0x01, 0x02, 0x00, 0x00, 0x1e, 0x01, 0xba,
+ 0x06, 0x00, 0x01, 0x00, 0xd5, 0xb9, 0xad, 0xee,
+ 0x03, 0xba, 0x28, 0xd5, 0x38, 0xe3, 0x00, 0x00,
+ 0x00, 0x41, 0x27, 0x01, 0x00, 0x00, 0x9e, 0xd9,
+ 0x38, 0x08, 0x01, 0x00, 0x00, 0xd5, 0xf3, 0xd5,
+ 0x9f, 0x28, 0xd6, 0x04, 0x8c, 0x14, 0x05, 0x04,
+ 0x1c, 0x08, 0x08, 0x44, 0x0e, 0x43, 0x06, 0x05,
+ 0xa0, 0x04, 0x01, 0x00, 0x01, 0x02, 0x00, 0x00,
+ 0x11, 0x01, 0xba, 0x06, 0x00, 0x01, 0x00, 0xd5,
+ 0xc2, 0xb4, 0x00, 0x9e, 0x38, 0xe3, 0x00, 0x00,
+ 0x00, 0x41, 0x27, 0x01, 0x00, 0x00, 0x9f, 0x28,
+ 0xd6, 0x04, 0x96, 0x14, 0x01, 0x04, 0x0e, 0x43,
+ 0x06, 0x05, 0xa2, 0x04, 0x01, 0x00, 0x01, 0x02,
+ 0x00, 0x00, 0x11, 0x01, 0xba, 0x06, 0x00, 0x01,
+ 0x00, 0xd5, 0x38, 0xe3, 0x00, 0x00, 0x00, 0x41,
+ 0x27, 0x01, 0x00, 0x00, 0x9e, 0xc2, 0xb4, 0x00,
+ 0x9f, 0x28, 0xd6, 0x04, 0x9b, 0x14, 0x01, 0x04,
+ 0x0e, 0x43, 0x06, 0x05, 0xa4, 0x04, 0x01, 0x01,
+ 0x01, 0x04, 0x00, 0x01, 0x20, 0x02, 0xba, 0x06,
+ 0x00, 0x01, 0x00, 0xd2, 0x07, 0x00, 0x00, 0x00,
+ 0x38, 0xe3, 0x00, 0x00, 0x00, 0x42, 0x02, 0x01,
+ 0x00, 0x00, 0x38, 0xe3, 0x00, 0x00, 0x00, 0xd5,
+ 0xf3, 0x24, 0x01, 0x00, 0xd1, 0xba, 0xc9, 0x9f,
+ 0xa2, 0xc3, 0x00, 0xc1, 0xed, 0xb5, 0x9e, 0x28,
+ 0xd6, 0x04, 0xa0, 0x14, 0x02, 0x04, 0x6c, 0x0b,
+ 0x88, 0x02, 0x06, 0xe8, 0x89, 0x04, 0x23, 0xc7,
+ 0x8a, 0x0e, 0x43, 0x06, 0x05, 0xa6, 0x04, 0x01,
+ 0x01, 0x01, 0x04, 0x00, 0x01, 0x20, 0x02, 0xba,
+ 0x06, 0x00, 0x01, 0x00, 0xd2, 0x07, 0x00, 0x00,
+ 0x00, 0x38, 0xe3, 0x00, 0x00, 0x00, 0x42, 0x02,
+ 0x01, 0x00, 0x00, 0x38, 0xe3, 0x00, 0x00, 0x00,
+ 0xd5, 0xf3, 0x24, 0x01, 0x00, 0xd1, 0xba, 0xc9,
+ 0x9f, 0xa1, 0xc3, 0x00, 0xc1, 0xed, 0xb5, 0x9e,
+ 0x28, 0xd6, 0x04, 0xa6, 0x14, 0x02, 0x04, 0x6c,
+ 0x0b, 0x88, 0x02, 0x06, 0xe8, 0x89, 0x04, 0x23,
+ 0xc7, 0x8a, 0x0e, 0x43, 0x06, 0x05, 0xa8, 0x04,
+ 0x01, 0x01, 0x01, 0x04, 0x00, 0x00, 0x1e, 0x02,
+ 0xba, 0x06, 0x00, 0x01, 0x00, 0xd2, 0x07, 0x00,
+ 0x00, 0x00, 0x38, 0xe3, 0x00, 0x00, 0x00, 0x42,
+ 0x02, 0x01, 0x00, 0x00, 0x38, 0xe3, 0x00, 0x00,
+ 0x00, 0xd5, 0xf3, 0xbb, 0x9e, 0x24, 0x01, 0x00,
+ 0xd1, 0xba, 0xa2, 0xc9, 0xba, 0xa1, 0x9f, 0x28,
+ 0xd6, 0x04, 0xac, 0x14, 0x02, 0x04, 0x76, 0x0e,
+ 0x43, 0x06, 0x05, 0xaa, 0x04, 0x01, 0x01, 0x01,
+ 0x04, 0x00, 0x00, 0x1d, 0x02, 0xba, 0x06, 0x00,
+ 0x01, 0x00, 0xe4, 0x06, 0x00, 0x00, 0x00, 0x38,
+ 0xe3, 0x00, 0x00, 0x00, 0xd5, 0xf3, 0xcd, 0x38,
+ 0x03, 0x01, 0x00, 0x00, 0x38, 0x01, 0x01, 0x00,
+ 0x00, 0xc9, 0xc9, 0x9e, 0xba, 0xa1, 0xf3, 0xc9,
+ 0xa1, 0x23, 0x01, 0x00, 0xd6, 0x04, 0xb2, 0x14,
+ 0x02, 0x04, 0x2b, 0x0e, 0x43, 0x06, 0x05, 0xac,
+ 0x04, 0x01, 0x01, 0x01, 0x04, 0x00, 0x00, 0x1d,
+ 0x02, 0xba, 0x06, 0x00, 0x01, 0x00, 0xe4, 0x06,
+ 0x00, 0x00, 0x00, 0x38, 0xe3, 0x00, 0x00, 0x00,
+ 0xd5, 0xf3, 0xcd, 0x38, 0x03, 0x01, 0x00, 0x00,
+ 0x38, 0x01, 0x01, 0x00, 0x00, 0xc9, 0xc9, 0x9e,
+ 0xba, 0xa2, 0xf3, 0xc9, 0xa1, 0x23, 0x01, 0x00,
+ 0xd6, 0x04, 0xb8, 0x14, 0x02, 0x04, 0x2b, 0x0e,
+ 0x43, 0x06, 0x05, 0xae, 0x04, 0x01, 0x01, 0x01,
+ 0x05, 0x00, 0x01, 0x1c, 0x02, 0xba, 0x06, 0x00,
+ 0x01, 0x00, 0xe4, 0x06, 0x00, 0x00, 0x00, 0x38,
+ 0xe3, 0x00, 0x00, 0x00, 0xd5, 0xf3, 0xcd, 0xc3,
+ 0x00, 0xc1, 0xed, 0xb5, 0x38, 0x03, 0x01, 0x00,
+ 0x00, 0xba, 0xc9, 0xa1, 0xba, 0xc9, 0xa2, 0x9f,
+ 0xf3, 0x9e, 0x28, 0xd6, 0x04, 0xbe, 0x14, 0x02,
+ 0x04, 0x2b, 0x0b, 0x88, 0x02, 0x06, 0xe8, 0x89,
+ 0x04, 0x23, 0xc7, 0x8a,
+};
+
@@ -242,6 +242,8 @@ DEF(AsyncFunctionResolve, "AsyncFunctionResolve")
 DEF(AsyncFunctionReject, "AsyncFunctionReject")
 DEF(AsyncGeneratorFunction, "AsyncGeneratorFunction")
 DEF(AsyncGenerator, "AsyncGenerator")
+DEF(WeakRef, "WeakRef")
+DEF(FinalizationRegistry, "FinalizationRegistry")
 DEF(EvalError, "EvalError")
 DEF(RangeError, "RangeError")
 DEF(ReferenceError, "ReferenceError")
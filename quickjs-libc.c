@@ -46,6 +46,10 @@
 #include <termios.h>
 #include <sys/ioctl.h>
 #include <sys/wait.h>
+#include <poll.h>
+#if defined(__linux__)
+#include <sys/syscall.h>
+#endif
 
 #if defined(__APPLE__)
 typedef sig_t sighandler_t;
@@ -67,6 +71,13 @@ typedef sig_t sighandler_t;
 #include <stdatomic.h>
 #endif
 
+#if defined(__linux__) && defined(USE_WORKER)
+/* enable js_std_scheduler_*(). It relies on epoll and POSIX threads */
+#define USE_SCHEDULER
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#endif
+
 #include "cutils.h"
 #include "list.h"
 #include "quickjs-libc.h"
@@ -89,11 +100,23 @@ typedef struct {
 
 typedef struct {
     struct list_head link;
-    BOOL has_object;
+    int timer_id;
     int64_t timeout;
     JSValue func;
 } JSOSTimer;
 
+typedef struct {
+    struct list_head link;
+    int pid;
+    int pidfd; /* -1 if not available */
+    BOOL exited : 8;
+    BOOL status_unknown : 8;
+    int status;
+    int out_fds[2]; /* stdout/stderr pipes, -1 if none or closed */
+    DynBuf out_bufs[2];
+    JSValue resolving_funcs[2];
+} JSOSChild;
+
 typedef struct {
     struct list_head link;
     uint8_t *data;
@@ -123,10 +146,16 @@ typedef struct JSThreadState {
     struct list_head os_rw_handlers; /* list of JSOSRWHandler.link */
     struct list_head os_signal_handlers; /* list JSOSSignalHandler.link */
     struct list_head os_timers; /* list of JSOSTimer.link */
+    int next_timer_id; /* for os.setTimeout() */
     struct list_head port_list; /* list of JSWorkerMessageHandler.link */
+    struct list_head os_children; /* list of JSOSChild.link */
     int eval_script_recurse; /* only used in the main thread */
     /* not used in the main thread */
     JSWorkerMessagePipe *recv_pipe, *send_pipe;
+#ifndef _WIN32
+    struct pollfd *poll_fds; /* used by js_os_poll_internal() */
+    int poll_fd_size;
+#endif
 } JSThreadState;
 
 static uint64_t os_pending_signals;
@@ -361,9 +390,10 @@ fail:
 uint8_t *js_load_file(JSContext *ctx, size_t *pbuf_len, const char *filename)
 {
     FILE *f;
-    uint8_t *buf;
-    size_t buf_len;
+    uint8_t *buf, *new_buf;
+    size_t buf_len, buf_size, n;
     long lret;
+    int c;
     
     f = fopen(filename, "rb");
     if (!f)
@@ -378,17 +408,44 @@ uint8_t *js_load_file(JSContext *ctx, size_t *pbuf_len, const char *filename)
         errno = EISDIR;
         goto fail;
     }
-    buf_len = lret;
     if (fseek(f, 0, SEEK_SET) < 0)
         goto fail;
+    /* the size is only a hint: it is 0 for the files of /proc and the
+       file may grow while it is read */
+    buf_size = lret;
     if (ctx)
-        buf = js_malloc(ctx, buf_len + 1);
+        buf = js_malloc(ctx, buf_size + 1);
     else
-        buf = malloc(buf_len + 1);
+        buf = malloc(buf_size + 1);
     if (!buf)
         goto fail;
-    if (fread(buf, 1, buf_len, f) != buf_len) {
+    buf_len = 0;
+    for(;;) {
+        if (buf_len == buf_size) {
+            c = fgetc(f);
+            if (c == EOF)
+                break;
+            if (buf_size < 8192)
+                buf_size += 4096;
+            else
+                buf_size += buf_size / 2;
+            if (ctx)
+                new_buf = js_realloc(ctx, buf, buf_size + 1);
+            else
+                new_buf = realloc(buf, buf_size + 1);
+            if (!new_buf)
+                goto fail_free;
+            buf = new_buf;
+            buf[buf_len++] = c;
+        }
+        n = fread(buf + buf_len, 1, buf_size - buf_len, f);
+        if (n == 0)
+            break;
+        buf_len += n;
+    }
+    if (ferror(f)) {
         errno = EIO;
+    fail_free:
         if (ctx)
             js_free(ctx, buf);
         else
@@ -694,11 +751,17 @@ static JSValue js_evalScript(JSContext *ctx, JSValueConst this_val,
 }
 
 static JSClassID js_std_file_class_id;
+static JSClassID js_std_file_lines_class_id;
+static JSClassID js_std_json_parser_class_id;
 
 typedef struct {
     FILE *f;
     BOOL close_in_finalizer;
     BOOL is_popen;
+    /* line buffer reused by getline() and lines() (allocated by the
+       libc) */
+    char *line_buf;
+    size_t line_buf_size;
 } JSSTDFile;
 
 static void js_std_file_finalizer(JSRuntime *rt, JSValue val)
@@ -711,6 +774,7 @@ static void js_std_file_finalizer(JSRuntime *rt, JSValue val)
             else
                 fclose(s->f);
         }
+        free(s->line_buf);
         js_free_rt(rt, s);
     }
 }
@@ -903,7 +967,7 @@ static JSValue js_std_printf(JSContext *ctx, JSValueConst this_val,
     return js_printf_internal(ctx, argc, argv, stdout);
 }
 
-static FILE *js_std_file_get(JSContext *ctx, JSValueConst obj)
+static JSSTDFile *js_std_file_get_state(JSContext *ctx, JSValueConst obj)
 {
     JSSTDFile *s = JS_GetOpaque2(ctx, obj, js_std_file_class_id);
     if (!s)
@@ -912,6 +976,14 @@ static FILE *js_std_file_get(JSContext *ctx, JSValueConst obj)
         JS_ThrowTypeError(ctx, "invalid file handle");
         return NULL;
     }
+    return s;
+}
+
+static FILE *js_std_file_get(JSContext *ctx, JSValueConst obj)
+{
+    JSSTDFile *s = js_std_file_get_state(ctx, obj);
+    if (!s)
+        return NULL;
     return s->f;
 }
 
@@ -955,6 +1027,9 @@ static JSValue js_std_file_close(JSContext *ctx, JSValueConst this_val,
     else
         err = js_get_errno(fclose(s->f));
     s->f = NULL;
+    free(s->line_buf);
+    s->line_buf = NULL;
+    s->line_buf_size = 0;
     return JS_NewInt32(ctx, err);
 }
 
@@ -1080,53 +1155,88 @@ static JSValue js_std_file_read_write(JSContext *ctx, JSValueConst this_val,
     return JS_NewInt64(ctx, ret);
 }
 
-/* XXX: could use less memory and go faster */
-static JSValue js_std_file_getline(JSContext *ctx, JSValueConst this_val,
-                                   int argc, JSValueConst *argv)
+#if defined(_WIN32)
+static ssize_t getline(char **pbuf, size_t *psize, FILE *f)
 {
-    FILE *f = js_std_file_get(ctx, this_val);
+    char *buf = *pbuf, *new_buf;
+    size_t len = 0, size = *psize;
     int c;
-    DynBuf dbuf;
-    JSValue obj;
-    
-    if (!f)
-        return JS_EXCEPTION;
 
-    js_std_dbuf_init(ctx, &dbuf);
     for(;;) {
         c = fgetc(f);
         if (c == EOF) {
-            if (dbuf.size == 0) {
-                /* EOF */
-                dbuf_free(&dbuf);
-                return JS_NULL;
-            } else {
-                break;
+            if (len == 0)
+                return -1;
+            break;
+        }
+        if (len + 2 > size) {
+            size = max_int(size * 3 / 2, len + 128);
+            new_buf = realloc(buf, size);
+            if (!new_buf) {
+                errno = ENOMEM;
+                return -1;
             }
+            *pbuf = buf = new_buf;
+            *psize = size;
         }
+        buf[len++] = c;
         if (c == '\n')
             break;
-        if (dbuf_putc(&dbuf, c)) {
-            dbuf_free(&dbuf);
-            return JS_ThrowOutOfMemory(ctx);
+    }
+    buf[len] = '\0';
+    return len;
+}
+#endif
+
+/* read the next line in the line buffer of the file, excluding the
+   trailing line feed. Return its length, -1 at the end of the file or
+   -2 if exception. The libc getline() scans its stdio buffer with
+   memchr() so there is no per byte call. */
+static ssize_t js_std_file_read_line(JSContext *ctx, JSSTDFile *s)
+{
+    ssize_t len;
+
+    errno = 0;
+    len = getline(&s->line_buf, &s->line_buf_size, s->f);
+    if (len < 0) {
+        if (errno == ENOMEM) {
+            JS_ThrowOutOfMemory(ctx);
+            return -2;
         }
+        return -1;
     }
-    obj = JS_NewStringLen(ctx, (const char *)dbuf.buf, dbuf.size);
-    dbuf_free(&dbuf);
-    return obj;
+    if (len > 0 && s->line_buf[len - 1] == '\n')
+        len--;
+    return len;
+}
+
+static JSValue js_std_file_getline(JSContext *ctx, JSValueConst this_val,
+                                   int argc, JSValueConst *argv)
+{
+    JSSTDFile *s = js_std_file_get_state(ctx, this_val);
+    ssize_t len;
+    
+    if (!s)
+        return JS_EXCEPTION;
+    len = js_std_file_read_line(ctx, s);
+    if (len == -2)
+        return JS_EXCEPTION;
+    if (len < 0)
+        return JS_NULL;
+    return JS_NewStringLen(ctx, s->line_buf, len);
 }
 
-/* XXX: could use less memory and go faster */
 static JSValue js_std_file_readAsString(JSContext *ctx, JSValueConst this_val,
                                         int argc, JSValueConst *argv)
 {
     FILE *f = js_std_file_get(ctx, this_val);
-    int c;
     DynBuf dbuf;
     JSValue obj;
     uint64_t max_size64;
-    size_t max_size;
+    size_t max_size, size_hint, n;
     JSValueConst max_size_val;
+    struct stat st;
+    int64_t pos;
     
     if (!f)
         return JS_EXCEPTION;
@@ -1143,22 +1253,152 @@ static JSValue js_std_file_readAsString(JSContext *ctx, JSValueConst this_val,
             max_size = max_size64;
     }
 
+    /* for regular files, the remaining size gives the buffer size so
+       that the content is read with a single allocation. It is only a
+       hint: it is 0 for the files of /proc. */
+    size_hint = 4096;
+    if (fstat(fileno(f), &st) == 0 && S_ISREG(st.st_mode)) {
+#if defined(__linux__)
+        pos = ftello(f);
+#else
+        pos = ftell(f);
+#endif
+        if (pos >= 0 && st.st_size > pos)
+            size_hint = st.st_size - pos + 1;
+    }
+    if (size_hint > max_size)
+        size_hint = max_size;
+
     js_std_dbuf_init(ctx, &dbuf);
     while (max_size != 0) {
-        c = fgetc(f);
-        if (c == EOF)
-            break;
-        if (dbuf_putc(&dbuf, c)) {
-            dbuf_free(&dbuf);
-            return JS_EXCEPTION;
+        if (dbuf.allocated_size == dbuf.size) {
+            if (dbuf_realloc(&dbuf, dbuf.size + size_hint)) {
+                dbuf_free(&dbuf);
+                return JS_ThrowOutOfMemory(ctx);
+            }
         }
-        max_size--;
+        n = dbuf.allocated_size - dbuf.size;
+        if (n > max_size)
+            n = max_size;
+        n = fread(dbuf.buf + dbuf.size, 1, n, f);
+        if (n == 0)
+            break;
+        dbuf.size += n;
+        max_size -= n;
+        /* the file was longer than expected: grow geometrically */
+        size_hint = dbuf.size / 2;
+        if (size_hint < 4096)
+            size_hint = 4096;
     }
     obj = JS_NewStringLen(ctx, (const char *)dbuf.buf, dbuf.size);
     dbuf_free(&dbuf);
     return obj;
 }
 
+/* readInto(typed_array): fill the typed array with the next bytes of
+   the file. Return the number of read bytes. */
+static JSValue js_std_file_readInto(JSContext *ctx, JSValueConst this_val,
+                                    int argc, JSValueConst *argv)
+{
+    FILE *f = js_std_file_get(ctx, this_val);
+    size_t byte_offset, byte_length, size;
+    JSValue buffer;
+    uint8_t *buf;
+    
+    if (!f)
+        return JS_EXCEPTION;
+    buffer = JS_GetTypedArrayBuffer(ctx, argv[0], &byte_offset,
+                                    &byte_length, NULL);
+    if (JS_IsException(buffer))
+        return JS_EXCEPTION;
+    buf = JS_GetArrayBuffer(ctx, &size, buffer);
+    JS_FreeValue(ctx, buffer);
+    if (!buf)
+        return JS_EXCEPTION;
+    if (byte_offset + byte_length > size)
+        return JS_ThrowRangeError(ctx, "out-of-bound typed array");
+    return JS_NewInt64(ctx, fread(buf + byte_offset, 1, byte_length, f));
+}
+
+/* line iterator: holds a reference to the file object */
+
+static void js_std_file_lines_finalizer(JSRuntime *rt, JSValue val)
+{
+    JSValue *pfile = JS_GetOpaque(val, js_std_file_lines_class_id);
+    if (pfile) {
+        JS_FreeValueRT(rt, *pfile);
+        js_free_rt(rt, pfile);
+    }
+}
+
+static void js_std_file_lines_mark(JSRuntime *rt, JSValueConst val,
+                                   JS_MarkFunc *mark_func)
+{
+    JSValue *pfile = JS_GetOpaque(val, js_std_file_lines_class_id);
+    if (pfile)
+        JS_MarkValue(rt, *pfile, mark_func);
+}
+
+static JSValue js_std_file_lines(JSContext *ctx, JSValueConst this_val,
+                                 int argc, JSValueConst *argv)
+{
+    JSValue obj, *pfile;
+    
+    if (!js_std_file_get(ctx, this_val))
+        return JS_EXCEPTION;
+    obj = JS_NewObjectClass(ctx, js_std_file_lines_class_id);
+    if (JS_IsException(obj))
+        return obj;
+    pfile = js_malloc(ctx, sizeof(*pfile));
+    if (!pfile) {
+        JS_FreeValue(ctx, obj);
+        return JS_EXCEPTION;
+    }
+    *pfile = JS_DupValue(ctx, this_val);
+    JS_SetOpaque(obj, pfile);
+    return obj;
+}
+
+static JSValue js_std_file_lines_next(JSContext *ctx, JSValueConst this_val,
+                                      int argc, JSValueConst *argv)
+{
+    JSValue *pfile, obj, val;
+    JSSTDFile *s;
+    ssize_t len;
+    
+    pfile = JS_GetOpaque2(ctx, this_val, js_std_file_lines_class_id);
+    if (!pfile)
+        return JS_EXCEPTION;
+    s = js_std_file_get_state(ctx, *pfile);
+    if (!s)
+        return JS_EXCEPTION;
+    len = js_std_file_read_line(ctx, s);
+    if (len == -2)
+        return JS_EXCEPTION;
+    if (len < 0) {
+        val = JS_UNDEFINED;
+    } else {
+        val = JS_NewStringLen(ctx, s->line_buf, len);
+        if (JS_IsException(val))
+            return val;
+    }
+    obj = JS_NewObject(ctx);
+    if (JS_IsException(obj)) {
+        JS_FreeValue(ctx, val);
+        return obj;
+    }
+    JS_DefinePropertyValueStr(ctx, obj, "value", val, JS_PROP_C_W_E);
+    JS_DefinePropertyValueStr(ctx, obj, "done", JS_NewBool(ctx, len < 0),
+                              JS_PROP_C_W_E);
+    return obj;
+}
+
+static JSValue js_std_file_lines_iterator(JSContext *ctx, JSValueConst this_val,
+                                          int argc, JSValueConst *argv)
+{
+    return JS_DupValue(ctx, this_val);
+}
+
 static JSValue js_std_file_getByte(JSContext *ctx, JSValueConst this_val,
                                    int argc, JSValueConst *argv)
 {
@@ -1367,11 +1607,153 @@ static JSValue js_std_urlGet(JSContext *ctx, JSValueConst this_val,
     return JS_EXCEPTION;
 }
 
+/* streaming JSON parser */
+
+static void js_std_json_parser_finalizer(JSRuntime *rt, JSValue val)
+{
+    JSJSONParser *p = JS_GetOpaque(val, js_std_json_parser_class_id);
+    JS_FreeJSONParser(rt, p);
+}
+
+static JSValue js_std_json_parser_ctor(JSContext *ctx, JSValueConst new_target,
+                                       int argc, JSValueConst *argv)
+{
+    JSValue obj, proto, val;
+    JSValueConst options = argv[0];
+    JSJSONParser *p;
+    int depth, flags, ret;
+
+    depth = 0;
+    flags = 0;
+    if (JS_IsObject(options)) {
+        val = JS_GetPropertyStr(ctx, options, "depth");
+        if (JS_IsException(val))
+            return JS_EXCEPTION;
+        ret = JS_ToInt32(ctx, &depth, val);
+        JS_FreeValue(ctx, val);
+        if (ret)
+            return JS_EXCEPTION;
+        val = JS_GetPropertyStr(ctx, options, "ndjson");
+        if (JS_IsException(val))
+            return JS_EXCEPTION;
+        if (JS_ToBool(ctx, val))
+            flags |= JS_PARSE_JSON_NDJSON;
+        JS_FreeValue(ctx, val);
+        val = JS_GetPropertyStr(ctx, options, "ext");
+        if (JS_IsException(val))
+            return JS_EXCEPTION;
+        if (JS_ToBool(ctx, val))
+            flags |= JS_PARSE_JSON_EXT;
+        JS_FreeValue(ctx, val);
+    }
+    p = JS_NewJSONParser(ctx, depth, flags);
+    if (!p)
+        return JS_EXCEPTION;
+    proto = JS_GetPropertyStr(ctx, new_target, "prototype");
+    if (JS_IsException(proto))
+        goto fail;
+    obj = JS_NewObjectProtoClass(ctx, proto, js_std_json_parser_class_id);
+    JS_FreeValue(ctx, proto);
+    if (JS_IsException(obj))
+        goto fail;
+    JS_SetOpaque(obj, p);
+    return obj;
+ fail:
+    JS_FreeJSONParser(JS_GetRuntime(ctx), p);
+    return JS_EXCEPTION;
+}
+
+/* return the available values in an array */
+static JSValue js_std_json_parser_get_values(JSContext *ctx, JSJSONParser *p)
+{
+    JSValue arr, val;
+    uint32_t i;
+
+    arr = JS_NewArray(ctx);
+    if (JS_IsException(arr))
+        return arr;
+    for(i = 0;; i++) {
+        val = JS_JSONParserNext(p);
+        if (JS_IsException(val))
+            goto fail;
+        if (JS_IsUndefined(val))
+            break;
+        if (JS_SetPropertyUint32(ctx, arr, i, val) < 0)
+            goto fail;
+    }
+    return arr;
+ fail:
+    JS_FreeValue(ctx, arr);
+    return JS_EXCEPTION;
+}
+
+/* write(str) or write(buffer, position = 0, length = buffer.byteLength - position) */
+static JSValue js_std_json_parser_write(JSContext *ctx, JSValueConst this_val,
+                                        int argc, JSValueConst *argv)
+{
+    JSJSONParser *p = JS_GetOpaque2(ctx, this_val, js_std_json_parser_class_id);
+    const char *str;
+    uint64_t pos, len;
+    size_t size;
+    uint8_t *buf;
+    int ret;
+
+    if (!p)
+        return JS_EXCEPTION;
+    if (JS_IsString(argv[0])) {
+        str = JS_ToCStringLen(ctx, &size, argv[0]);
+        if (!str)
+            return JS_EXCEPTION;
+        ret = JS_JSONParserWrite(p, (const uint8_t *)str, size);
+        JS_FreeCString(ctx, str);
+    } else {
+        buf = JS_GetArrayBuffer(ctx, &size, argv[0]);
+        if (!buf)
+            return JS_EXCEPTION;
+        pos = 0;
+        if (argc > 1 && JS_ToIndex(ctx, &pos, argv[1]))
+            return JS_EXCEPTION;
+        if (pos > size)
+            return JS_ThrowRangeError(ctx, "array buffer overflow");
+        len = size - pos;
+        if (argc > 2 && !JS_IsUndefined(argv[2]) &&
+            JS_ToIndex(ctx, &len, argv[2]))
+            return JS_EXCEPTION;
+        if (pos + len > size)
+            return JS_ThrowRangeError(ctx, "array buffer overflow");
+        ret = JS_JSONParserWrite(p, buf + pos, len);
+    }
+    if (ret < 0)
+        return JS_EXCEPTION;
+    return js_std_json_parser_get_values(ctx, p);
+}
+
+static JSValue js_std_json_parser_end(JSContext *ctx, JSValueConst this_val,
+                                      int argc, JSValueConst *argv)
+{
+    JSJSONParser *p = JS_GetOpaque2(ctx, this_val, js_std_json_parser_class_id);
+    if (!p)
+        return JS_EXCEPTION;
+    JS_JSONParserEnd(p);
+    return js_std_json_parser_get_values(ctx, p);
+}
+
+static JSClassDef js_std_json_parser_class = {
+    "JSONParser",
+    .finalizer = js_std_json_parser_finalizer,
+};
+
 static JSClassDef js_std_file_class = {
     "FILE",
     .finalizer = js_std_file_finalizer,
 }; 
 
+static JSClassDef js_std_file_lines_class = {
+    "FILE Lines Iterator",
+    .finalizer = js_std_file_lines_finalizer,
+    .gc_mark = js_std_file_lines_mark,
+}; 
+
 static const JSCFunctionListEntry js_std_error_props[] = {
     /* various errno values */
 #define DEF(x) JS_PROP_INT32_DEF(#x, x, JS_PROP_CONFIGURABLE )
@@ -1431,14 +1813,27 @@ static const JSCFunctionListEntry js_std_file_proto_funcs[] = {
     JS_CFUNC_MAGIC_DEF("write", 3, js_std_file_read_write, 1 ),
     JS_CFUNC_DEF("getline", 0, js_std_file_getline ),
     JS_CFUNC_DEF("readAsString", 0, js_std_file_readAsString ),
+    JS_CFUNC_DEF("readInto", 1, js_std_file_readInto ),
+    JS_CFUNC_DEF("lines", 0, js_std_file_lines ),
     JS_CFUNC_DEF("getByte", 0, js_std_file_getByte ),
     JS_CFUNC_DEF("putByte", 1, js_std_file_putByte ),
     /* setvbuf, ...  */
 };
 
+static const JSCFunctionListEntry js_std_file_lines_proto_funcs[] = {
+    JS_CFUNC_DEF("next", 0, js_std_file_lines_next ),
+    JS_CFUNC_DEF("[Symbol.iterator]", 0, js_std_file_lines_iterator ),
+};
+
+static const JSCFunctionListEntry js_std_json_parser_proto_funcs[] = {
+    JS_CFUNC_DEF("write", 1, js_std_json_parser_write ),
+    JS_CFUNC_DEF("end", 0, js_std_json_parser_end ),
+    JS_PROP_STRING_DEF("[Symbol.toStringTag]", "JSONParser", JS_PROP_CONFIGURABLE ),
+};
+
 static int js_std_init(JSContext *ctx, JSModuleDef *m)
 {
-    JSValue proto;
+    JSValue proto, obj;
     
     /* FILE class */
     /* the class ID is created once */
@@ -1450,6 +1845,26 @@ static int js_std_init(JSContext *ctx, JSModuleDef *m)
                                countof(js_std_file_proto_funcs));
     JS_SetClassProto(ctx, js_std_file_class_id, proto);
 
+    JS_NewClassID(&js_std_file_lines_class_id);
+    JS_NewClass(JS_GetRuntime(ctx), js_std_file_lines_class_id,
+                &js_std_file_lines_class);
+    proto = JS_NewObject(ctx);
+    JS_SetPropertyFunctionList(ctx, proto, js_std_file_lines_proto_funcs,
+                               countof(js_std_file_lines_proto_funcs));
+    JS_SetClassProto(ctx, js_std_file_lines_class_id, proto);
+
+    JS_NewClassID(&js_std_json_parser_class_id);
+    JS_NewClass(JS_GetRuntime(ctx), js_std_json_parser_class_id,
+                &js_std_json_parser_class);
+    proto = JS_NewObject(ctx);
+    JS_SetPropertyFunctionList(ctx, proto, js_std_json_parser_proto_funcs,
+                               countof(js_std_json_parser_proto_funcs));
+    obj = JS_NewCFunction2(ctx, js_std_json_parser_ctor, "JSONParser", 1,
+                           JS_CFUNC_constructor, 0);
+    JS_SetConstructor(ctx, obj, proto);
+    JS_SetClassProto(ctx, js_std_json_parser_class_id, proto);
+    JS_SetModuleExport(ctx, m, "JSONParser", obj);
+
     JS_SetModuleExportList(ctx, m, js_std_funcs,
                            countof(js_std_funcs));
     JS_SetModuleExport(ctx, m, "in", js_new_std_file(ctx, stdin, FALSE, FALSE));
@@ -1468,6 +1883,7 @@ JSModuleDef *js_init_module_std(JSContext *ctx, const char *module_name)
     JS_AddModuleExport(ctx, m, "in");
     JS_AddModuleExport(ctx, m, "out");
     JS_AddModuleExport(ctx, m, "err");
+    JS_AddModuleExport(ctx, m, "JSONParser");
     return m;
 }
 
@@ -1867,39 +2283,64 @@ static int64_t get_time_ms(void)
 }
 #endif
 
-static void unlink_timer(JSRuntime *rt, JSOSTimer *th)
+static void free_timer(JSRuntime *rt, JSOSTimer *th)
+{
+    list_del(&th->link);
+    JS_FreeValueRT(rt, th->func);
+    js_free_rt(rt, th);
+}
+
+static JSOSTimer *find_timer_by_id(JSThreadState *ts, int timer_id)
 {
-    if (th->link.prev) {
-        list_del(&th->link);
-        th->link.prev = th->link.next = NULL;
+    struct list_head *el;
+    list_for_each(el, &ts->os_timers) {
+        JSOSTimer *th = list_entry(el, JSOSTimer, link);
+        if (th->timer_id == timer_id)
+            return th;
     }
+    return NULL;
 }
 
-static void free_timer(JSRuntime *rt, JSOSTimer *th)
+/* The timers are identified by an integer so that they can be saved
+   with the global variables (see js_std_hibernate_context()). The
+   OSTimer handles contain the identifier. */
+static JSOSTimer *add_timer(JSContext *ctx, JSThreadState *ts, int timer_id,
+                            int64_t delay, JSValueConst func)
 {
-    JS_FreeValueRT(rt, th->func);
-    js_free_rt(rt, th);
+    JSOSTimer *th;
+
+    th = js_malloc(ctx, sizeof(*th));
+    if (!th)
+        return NULL;
+    th->timer_id = timer_id;
+    th->timeout = get_time_ms() + delay;
+    th->func = JS_DupValue(ctx, func);
+    list_add_tail(&th->link, &ts->os_timers);
+    if (timer_id >= ts->next_timer_id)
+        ts->next_timer_id = timer_id == INT32_MAX ? 1 : timer_id + 1;
+    return th;
 }
 
 static JSClassID js_os_timer_class_id;
 
-static void js_os_timer_finalizer(JSRuntime *rt, JSValue val)
+static JSValue js_os_timer_save(JSContext *ctx, JSValueConst obj)
 {
-    JSOSTimer *th = JS_GetOpaque(val, js_os_timer_class_id);
-    if (th) {
-        th->has_object = FALSE;
-        if (!th->link.prev)
-            free_timer(rt, th);
-    }
+    return JS_NewInt32(ctx, (intptr_t)JS_GetOpaque(obj, js_os_timer_class_id));
 }
 
-static void js_os_timer_mark(JSRuntime *rt, JSValueConst val,
-                             JS_MarkFunc *mark_func)
+static int js_os_timer_restore(JSContext *ctx, JSValueConst obj,
+                               JSValueConst data)
 {
-    JSOSTimer *th = JS_GetOpaque(val, js_os_timer_class_id);
-    if (th) {
-        JS_MarkValue(rt, th->func, mark_func);
+    int timer_id;
+
+    if (JS_ToInt32(ctx, &timer_id, data))
+        return -1;
+    if (timer_id <= 0) {
+        JS_ThrowTypeError(ctx, "invalid timer");
+        return -1;
     }
+    JS_SetOpaque(obj, (void *)(intptr_t)timer_id);
+    return 0;
 }
 
 static JSValue js_os_setTimeout(JSContext *ctx, JSValueConst this_val,
@@ -1911,6 +2352,7 @@ static JSValue js_os_setTimeout(JSContext *ctx, JSValueConst this_val,
     JSValueConst func;
     JSOSTimer *th;
     JSValue obj;
+    int timer_id;
 
     func = argv[0];
     if (!JS_IsFunction(ctx, func))
@@ -1920,34 +2362,42 @@ static JSValue js_os_setTimeout(JSContext *ctx, JSValueConst this_val,
     obj = JS_NewObjectClass(ctx, js_os_timer_class_id);
     if (JS_IsException(obj))
         return obj;
-    th = js_mallocz(ctx, sizeof(*th));
+    /* skip the identifiers still in use after a wrap around */
+    timer_id = ts->next_timer_id;
+    while (find_timer_by_id(ts, timer_id))
+        timer_id = timer_id == INT32_MAX ? 1 : timer_id + 1;
+    th = add_timer(ctx, ts, timer_id, delay, func);
     if (!th) {
         JS_FreeValue(ctx, obj);
         return JS_EXCEPTION;
     }
-    th->has_object = TRUE;
-    th->timeout = get_time_ms() + delay;
-    th->func = JS_DupValue(ctx, func);
-    list_add_tail(&th->link, &ts->os_timers);
-    JS_SetOpaque(obj, th);
+    JS_SetOpaque(obj, (void *)(intptr_t)timer_id);
     return obj;
 }
 
 static JSValue js_os_clearTimeout(JSContext *ctx, JSValueConst this_val,
                                   int argc, JSValueConst *argv)
 {
-    JSOSTimer *th = JS_GetOpaque2(ctx, argv[0], js_os_timer_class_id);
-    if (!th)
+    JSRuntime *rt = JS_GetRuntime(ctx);
+    JSThreadState *ts = JS_GetRuntimeOpaque(rt);
+    JSOSTimer *th;
+    void *opaque;
+
+    opaque = JS_GetOpaque2(ctx, argv[0], js_os_timer_class_id);
+    if (!opaque)
         return JS_EXCEPTION;
-    unlink_timer(JS_GetRuntime(ctx), th);
+    /* nothing to do if the timer already expired */
+    th = find_timer_by_id(ts, (intptr_t)opaque);
+    if (th)
+        free_timer(rt, th);
     return JS_UNDEFINED;
 }
 
 static JSClassDef js_os_timer_class = {
     "OSTimer",
-    .finalizer = js_os_timer_finalizer,
-    .gc_mark = js_os_timer_mark,
-}; 
+    .save = js_os_timer_save,
+    .restore = js_os_timer_restore,
+};
 
 static void call_handler(JSContext *ctx, JSValueConst func)
 {
@@ -1990,9 +2440,7 @@ static int js_os_poll(JSContext *ctx)
                 /* the timer expired */
                 func = th->func;
                 th->func = JS_UNDEFINED;
-                unlink_timer(rt, th);
-                if (!th->has_object)
-                    free_timer(rt, th);
+                free_timer(rt, th);
                 call_handler(ctx, func);
                 JS_FreeValue(ctx, func);
                 return 0;
@@ -2013,6 +2461,9 @@ static int js_os_poll(JSContext *ctx)
         }
     }
 
+    /* the program is going idle: make the buffered output visible */
+    fflush(stdout);
+
     if (console_fd >= 0) {
         DWORD ti, ret;
         HANDLE handle;
@@ -2039,6 +2490,9 @@ static int js_os_poll(JSContext *ctx)
 }
 #else
 
+static BOOL js_os_poll_children(JSContext *ctx, JSThreadState *ts,
+                                struct pollfd *pfd);
+
 #ifdef USE_WORKER
 
 static void js_free_message(JSWorkerMessage *msg);
@@ -2116,16 +2570,18 @@ static int handle_posted_message(JSRuntime *rt, JSContext *ctx,
 }
 #endif
 
-static int js_os_poll(JSContext *ctx)
+/* Handle at most one event. If 'can_block' is FALSE, return 1 if no
+   event was ready instead of waiting. Return -1 if there are no more
+   event sources. */
+static int js_os_poll_internal(JSContext *ctx, BOOL can_block)
 {
     JSRuntime *rt = JS_GetRuntime(ctx);
     JSThreadState *ts = JS_GetRuntimeOpaque(rt);
-    int ret, fd_max, min_delay;
+    int ret, nfds, min_delay, timeout, i;
     int64_t cur_time, delay;
-    fd_set rfds, wfds;
+    struct pollfd *pfd;
     JSOSRWHandler *rh;
     struct list_head *el;
-    struct timeval tv, *tvp;
 
     /* only check signals in the main thread */
     if (!ts->recv_pipe &&
@@ -2145,7 +2601,7 @@ static int js_os_poll(JSContext *ctx)
     }
 
     if (list_empty(&ts->os_rw_handlers) && list_empty(&ts->os_timers) &&
-        list_empty(&ts->port_list))
+        list_empty(&ts->port_list) && list_empty(&ts->os_children))
         return -1; /* no more events */
     
     if (!list_empty(&ts->os_timers)) {
@@ -2159,9 +2615,7 @@ static int js_os_poll(JSContext *ctx)
                 /* the timer expired */
                 func = th->func;
                 th->func = JS_UNDEFINED;
-                unlink_timer(rt, th);
-                if (!th->has_object)
-                    free_timer(rt, th);
+                free_timer(rt, th);
                 call_handler(ctx, func);
                 JS_FreeValue(ctx, func);
                 return 0;
@@ -2169,66 +2623,126 @@ static int js_os_poll(JSContext *ctx)
                 min_delay = delay;
             }
         }
-        tv.tv_sec = min_delay / 1000;
-        tv.tv_usec = (min_delay % 1000) * 1000;
-        tvp = &tv;
+        timeout = min_delay;
     } else {
-        tvp = NULL;
+        timeout = -1;
     }
-    
-    FD_ZERO(&rfds);
-    FD_ZERO(&wfds);
-    fd_max = -1;
+
+    /* poll() is used instead of select() so that there is no limit on
+       the descriptor values. The descriptors are added in the order in
+       which the handlers are checked below. */
+    nfds = 0;
+    list_for_each(el, &ts->os_rw_handlers)
+        nfds++;
+    list_for_each(el, &ts->port_list)
+        nfds++;
+    list_for_each(el, &ts->os_children)
+        nfds += 3;
+    if (nfds > ts->poll_fd_size) {
+        int new_size = max_int(nfds, ts->poll_fd_size * 3 / 2);
+        pfd = js_realloc_rt(rt, ts->poll_fds, sizeof(pfd[0]) * new_size);
+        if (!pfd)
+            return -1;
+        ts->poll_fds = pfd;
+        ts->poll_fd_size = new_size;
+    }
+    pfd = ts->poll_fds;
+
     list_for_each(el, &ts->os_rw_handlers) {
         rh = list_entry(el, JSOSRWHandler, link);
-        fd_max = max_int(fd_max, rh->fd);
+        pfd->fd = rh->fd;
+        pfd->events = 0;
         if (!JS_IsNull(rh->rw_func[0]))
-            FD_SET(rh->fd, &rfds);
+            pfd->events |= POLLIN;
         if (!JS_IsNull(rh->rw_func[1]))
-            FD_SET(rh->fd, &wfds);
+            pfd->events |= POLLOUT;
+        pfd++;
     }
 
     list_for_each(el, &ts->port_list) {
         JSWorkerMessageHandler *port = list_entry(el, JSWorkerMessageHandler, link);
-        if (!JS_IsNull(port->on_message_func)) {
-            JSWorkerMessagePipe *ps = port->recv_pipe;
-            fd_max = max_int(fd_max, ps->read_fd);
-            FD_SET(ps->read_fd, &rfds);
+        pfd->fd = -1; /* ignored */
+        if (!JS_IsNull(port->on_message_func))
+            pfd->fd = port->recv_pipe->read_fd;
+        pfd->events = POLLIN;
+        pfd++;
+    }
+
+    list_for_each(el, &ts->os_children) {
+        JSOSChild *ch = list_entry(el, JSOSChild, link);
+        for(i = 0; i < 2; i++) {
+            if (ch->out_fds[i] >= 0) {
+                pfd->fd = ch->out_fds[i];
+                pfd->events = POLLIN;
+                pfd++;
+            }
+        }
+        if (ch->exited) {
+            if (ch->out_fds[0] < 0 && ch->out_fds[1] < 0) {
+                /* complete: its promise is resolved without waiting */
+                timeout = 0;
+            }
+        } else if (ch->pidfd >= 0) {
+            pfd->fd = ch->pidfd;
+            pfd->events = POLLIN;
+            pfd++;
+        } else if (timeout < 0 || timeout > 10) {
+            /* no process descriptor: check the child periodically */
+            timeout = 10;
         }
     }
+    nfds = pfd - ts->poll_fds;
 
-    ret = select(fd_max + 1, &rfds, &wfds, NULL, tvp);
-    if (ret > 0) {
+    if (!can_block) {
+        timeout = 0;
+    } else {
+        /* the program is going idle: make the buffered output visible */
+        fflush(stdout);
+    }
+    
+    ret = poll(ts->poll_fds, nfds, timeout);
+    pfd = ts->poll_fds;
+    if (ret > 0) {
         list_for_each(el, &ts->os_rw_handlers) {
             rh = list_entry(el, JSOSRWHandler, link);
             if (!JS_IsNull(rh->rw_func[0]) &&
-                FD_ISSET(rh->fd, &rfds)) {
+                (pfd->revents & (POLLIN | POLLHUP | POLLERR))) {
                 call_handler(ctx, rh->rw_func[0]);
                 /* must stop because the list may have been modified */
                 goto done;
             }
             if (!JS_IsNull(rh->rw_func[1]) &&
-                FD_ISSET(rh->fd, &wfds)) {
+                (pfd->revents & (POLLOUT | POLLERR))) {
                 call_handler(ctx, rh->rw_func[1]);
                 /* must stop because the list may have been modified */
                 goto done;
             }
+            pfd++;
         }
 
         list_for_each(el, &ts->port_list) {
             JSWorkerMessageHandler *port = list_entry(el, JSWorkerMessageHandler, link);
-            if (!JS_IsNull(port->on_message_func)) {
-                JSWorkerMessagePipe *ps = port->recv_pipe;
-                if (FD_ISSET(ps->read_fd, &rfds)) {
-                    if (handle_posted_message(rt, ctx, port))
-                        goto done;
-                }
+            if (!JS_IsNull(port->on_message_func) &&
+                (pfd->revents & POLLIN)) {
+                if (handle_posted_message(rt, ctx, port))
+                    goto done;
             }
+            pfd++;
         }
     }
+    if (ret >= 0 && !list_empty(&ts->os_children)) {
+        if (js_os_poll_children(ctx, ts, ret > 0 ? pfd : NULL))
+            goto done;
+    }
+    return 1;
     done:
     return 0;
 }
+
+static int js_os_poll(JSContext *ctx)
+{
+    return js_os_poll_internal(ctx, TRUE) < 0 ? -1 : 0;
+}
 #endif /* !_WIN32 */
 
 static JSValue make_obj_error(JSContext *ctx,
@@ -2678,125 +3192,263 @@ static int my_execvpe(const char *filename, char **argv, char **envp)
     return -1;
 }
 
-/* exec(args[, options]) -> exitcode */
-static JSValue js_os_exec(JSContext *ctx, JSValueConst this_val,
-                          int argc, JSValueConst *argv)
+/* child process parameters shared by exec() and spawn() */
+typedef struct {
+    const char **exec_argv;
+    uint32_t exec_argc;
+    const char *file;
+    const char *cwd;
+    char **envp;
+    /* -1 means a pipe to the parent (only with spawn()) */
+    int std_fds[3];
+    uint32_t uid, gid;
+    BOOL block_flag, use_path;
+} JSOSExecParams;
+
+static void js_os_exec_params_free(JSContext *ctx, JSOSExecParams *ep)
+{
+    uint32_t i;
+    
+    JS_FreeCString(ctx, ep->file);
+    JS_FreeCString(ctx, ep->cwd);
+    if (ep->exec_argv) {
+        for(i = 0; i < ep->exec_argc; i++)
+            JS_FreeCString(ctx, ep->exec_argv[i]);
+        js_free(ctx, ep->exec_argv);
+    }
+    if (ep->envp != environ) {
+        char **p;
+        p = ep->envp;
+        while (*p != NULL) {
+            js_free(ctx, *p);
+            p++;
+        }
+        js_free(ctx, ep->envp);
+    }
+}
+
+/* if 'allow_pipe' is true, the "pipe" value is accepted for the
+   stdin/stdout/stderr options */
+static int js_os_exec_params_init(JSContext *ctx, JSOSExecParams *ep,
+                                  int argc, JSValueConst *argv,
+                                  BOOL allow_pipe)
 {
     JSValueConst options, args = argv[0];
-    JSValue val, ret_val;
-    const char **exec_argv, *file = NULL, *str, *cwd = NULL;
-    char **envp = environ;
-    uint32_t exec_argc, i;
-    int ret, pid, status;
-    BOOL block_flag = TRUE, use_path = TRUE;
+    JSValue val;
+    const char *str;
+    uint32_t i;
+    int ret;
     static const char *std_name[3] = { "stdin", "stdout", "stderr" };
-    int std_fds[3];
-    uint32_t uid = -1, gid = -1;
     
+    memset(ep, 0, sizeof(*ep));
+    ep->envp = environ;
+    ep->uid = -1;
+    ep->gid = -1;
+    ep->block_flag = TRUE;
+    ep->use_path = TRUE;
+    /* spawn() captures stdout and stderr by default */
+    for(i = 0; i < 3; i++)
+        ep->std_fds[i] = (allow_pipe && i != 0) ? -1 : i;
+
     val = JS_GetPropertyStr(ctx, args, "length");
     if (JS_IsException(val))
-        return JS_EXCEPTION;
-    ret = JS_ToUint32(ctx, &exec_argc, val);
+        return -1;
+    ret = JS_ToUint32(ctx, &ep->exec_argc, val);
     JS_FreeValue(ctx, val);
     if (ret)
-        return JS_EXCEPTION;
+        return -1;
     /* arbitrary limit to avoid overflow */
-    if (exec_argc < 1 || exec_argc > 65535) {
-        return JS_ThrowTypeError(ctx, "invalid number of arguments");
+    if (ep->exec_argc < 1 || ep->exec_argc > 65535) {
+        ep->exec_argc = 0;
+        JS_ThrowTypeError(ctx, "invalid number of arguments");
+        return -1;
     }
-    exec_argv = js_mallocz(ctx, sizeof(exec_argv[0]) * (exec_argc + 1));
-    if (!exec_argv)
-        return JS_EXCEPTION;
-    for(i = 0; i < exec_argc; i++) {
+    ep->exec_argv = js_mallocz(ctx, sizeof(ep->exec_argv[0]) * (ep->exec_argc + 1));
+    if (!ep->exec_argv)
+        return -1;
+    for(i = 0; i < ep->exec_argc; i++) {
         val = JS_GetPropertyUint32(ctx, args, i);
         if (JS_IsException(val))
-            goto exception;
+            return -1;
         str = JS_ToCString(ctx, val);
         JS_FreeValue(ctx, val);
         if (!str)
-            goto exception;
-        exec_argv[i] = str;
+            return -1;
+        ep->exec_argv[i] = str;
     }
-    exec_argv[exec_argc] = NULL;
+    ep->exec_argv[ep->exec_argc] = NULL;
 
-    for(i = 0; i < 3; i++)
-        std_fds[i] = i;
-    
     /* get the options, if any */
     if (argc >= 2) {
         options = argv[1];
 
-        if (get_bool_option(ctx, &block_flag, options, "block"))
-            goto exception;
-        if (get_bool_option(ctx, &use_path, options, "usePath"))
-            goto exception;
+        if (get_bool_option(ctx, &ep->block_flag, options, "block"))
+            return -1;
+        if (get_bool_option(ctx, &ep->use_path, options, "usePath"))
+            return -1;
         
         val = JS_GetPropertyStr(ctx, options, "file");
         if (JS_IsException(val))
-            goto exception;
+            return -1;
         if (!JS_IsUndefined(val)) {
-            file = JS_ToCString(ctx, val);
+            ep->file = JS_ToCString(ctx, val);
             JS_FreeValue(ctx, val);
-            if (!file)
-                goto exception;
+            if (!ep->file)
+                return -1;
         }
 
         val = JS_GetPropertyStr(ctx, options, "cwd");
         if (JS_IsException(val))
-            goto exception;
+            return -1;
         if (!JS_IsUndefined(val)) {
-            cwd = JS_ToCString(ctx, val);
+            ep->cwd = JS_ToCString(ctx, val);
             JS_FreeValue(ctx, val);
-            if (!cwd)
-                goto exception;
+            if (!ep->cwd)
+                return -1;
         }
 
         /* stdin/stdout/stderr handles */
         for(i = 0; i < 3; i++) {
             val = JS_GetPropertyStr(ctx, options, std_name[i]);
             if (JS_IsException(val))
-                goto exception;
+                return -1;
             if (!JS_IsUndefined(val)) {
                 int fd;
-                ret = JS_ToInt32(ctx, &fd, val);
-                JS_FreeValue(ctx, val);
-                if (ret)
-                    goto exception;
-                std_fds[i] = fd;
+                if (allow_pipe && JS_IsString(val)) {
+                    str = JS_ToCString(ctx, val);
+                    JS_FreeValue(ctx, val);
+                    if (!str)
+                        return -1;
+                    ret = strcmp(str, "pipe");
+                    JS_FreeCString(ctx, str);
+                    if (ret) {
+                        JS_ThrowTypeError(ctx, "invalid %s option",
+                                          std_name[i]);
+                        return -1;
+                    }
+                    fd = -1;
+                } else {
+                    ret = JS_ToInt32(ctx, &fd, val);
+                    JS_FreeValue(ctx, val);
+                    if (ret)
+                        return -1;
+                }
+                ep->std_fds[i] = fd;
             }
         }
 
         val = JS_GetPropertyStr(ctx, options, "env");
         if (JS_IsException(val))
-            goto exception;
+            return -1;
         if (!JS_IsUndefined(val)) {
-            envp = build_envp(ctx, val);
+            ep->envp = build_envp(ctx, val);
             JS_FreeValue(ctx, val);
-            if (!envp)
-                goto exception;
+            if (!ep->envp) {
+                ep->envp = environ;
+                return -1;
+            }
         }
         
         val = JS_GetPropertyStr(ctx, options, "uid");
         if (JS_IsException(val))
-            goto exception;
+            return -1;
         if (!JS_IsUndefined(val)) {
-            ret = JS_ToUint32(ctx, &uid, val);
+            ret = JS_ToUint32(ctx, &ep->uid, val);
             JS_FreeValue(ctx, val);
             if (ret)
-                goto exception;
+                return -1;
         }
 
         val = JS_GetPropertyStr(ctx, options, "gid");
         if (JS_IsException(val))
-            goto exception;
+            return -1;
         if (!JS_IsUndefined(val)) {
-            ret = JS_ToUint32(ctx, &gid, val);
+            ret = JS_ToUint32(ctx, &ep->gid, val);
             JS_FreeValue(ctx, val);
             if (ret)
-                goto exception;
+                return -1;
+        }
+    }
+    return 0;
+}
+
+/* executed in the child after fork() or vfork(): only async-signal-safe
+   calls and no memory allocation. 'std_fds' gives the descriptors to
+   install as stdin/stdout/stderr. The set*id() calls are only
+   allowed after fork() (see js_os_spawn()). */
+static void __attribute__((noreturn))
+js_os_exec_child(const JSOSExecParams *ep, const int *std_fds)
+{
+    const char *file;
+    int i, fd_max;
+
+    /* remap the stdin/stdout/stderr handles if necessary */
+    for(i = 0; i < 3; i++) {
+        if (std_fds[i] != i) {
+            if (dup2(std_fds[i], i) < 0)
+                _exit(127);
         }
     }
 
+#if defined(__linux__) && defined(SYS_close_range)
+    /* a single system call instead of one per possible descriptor */
+    if (syscall(SYS_close_range, 3, ~0U, 0) < 0)
+#endif
+    {
+        fd_max = sysconf(_SC_OPEN_MAX);
+        for(i = 3; i < fd_max; i++)
+            close(i);
+    }
+    if (ep->cwd) {
+        if (chdir(ep->cwd) < 0)
+            _exit(127);
+    }
+    /* the group must be changed while the process is still privileged */
+    if (ep->gid != -1) {
+        if (setgid(ep->gid) < 0)
+            _exit(127);
+    }
+    if (ep->uid != -1) {
+        if (setuid(ep->uid) < 0)
+            _exit(127);
+    }
+
+    file = ep->file;
+    if (!file)
+        file = ep->exec_argv[0];
+    if (ep->use_path)
+        my_execvpe(file, (char **)ep->exec_argv, ep->envp);
+    else
+        execve(file, (char **)ep->exec_argv, ep->envp);
+    _exit(127);
+}
+
+/* convert a waitpid() status to the exit code or the negated signal
+   number. Return FALSE if the process has not terminated. */
+static BOOL js_os_exit_status(int status, int *pret)
+{
+    if (WIFEXITED(status)) {
+        *pret = WEXITSTATUS(status);
+        return TRUE;
+    } else if (WIFSIGNALED(status)) {
+        *pret = -WTERMSIG(status);
+        return TRUE;
+    } else {
+        return FALSE;
+    }
+}
+
+/* exec(args[, options]) -> exitcode */
+static JSValue js_os_exec(JSContext *ctx, JSValueConst this_val,
+                          int argc, JSValueConst *argv)
+{
+    JSOSExecParams ep_s, *ep = &ep_s;
+    JSValue ret_val;
+    int ret, pid, status;
+    
+    if (js_os_exec_params_init(ctx, ep, argc, argv, FALSE))
+        goto exception;
+
     pid = fork();
     if (pid < 0) {
         JS_ThrowTypeError(ctx, "fork error");
@@ -2804,78 +3456,248 @@ static JSValue js_os_exec(JSContext *ctx, JSValueConst this_val,
     }
     if (pid == 0) {
         /* child */
-        int fd_max = sysconf(_SC_OPEN_MAX);
-
-        /* remap the stdin/stdout/stderr handles if necessary */
-        for(i = 0; i < 3; i++) {
-            if (std_fds[i] != i) {
-                if (dup2(std_fds[i], i) < 0)
-                    _exit(127);
-            }
-        }
-
-        for(i = 3; i < fd_max; i++)
-            close(i);
-        if (cwd) {
-            if (chdir(cwd) < 0)
-                _exit(127);
-        }
-        if (uid != -1) {
-            if (setuid(uid) < 0)
-                _exit(127);
-        }
-        if (gid != -1) {
-            if (setgid(gid) < 0)
-                _exit(127);
-        }
-
-        if (!file)
-            file = exec_argv[0];
-        if (use_path)
-            ret = my_execvpe(file, (char **)exec_argv, envp);
-        else
-            ret = execve(file, (char **)exec_argv, envp);
-        _exit(127);
+        js_os_exec_child(ep, ep->std_fds);
     }
     /* parent */
-    if (block_flag) {
+    if (ep->block_flag) {
         for(;;) {
             ret = waitpid(pid, &status, 0);
-            if (ret == pid) {
-                if (WIFEXITED(status)) {
-                    ret = WEXITSTATUS(status);
-                    break;
-                } else if (WIFSIGNALED(status)) {
-                    ret = -WTERMSIG(status);
-                    break;
-                }
-            }
+            if (ret == pid && js_os_exit_status(status, &ret))
+                break;
         }
     } else {
         ret = pid;
     }
     ret_val = JS_NewInt32(ctx, ret);
  done:
-    JS_FreeCString(ctx, file);
-    JS_FreeCString(ctx, cwd);
-    for(i = 0; i < exec_argc; i++)
-        JS_FreeCString(ctx, exec_argv[i]);
-    js_free(ctx, exec_argv);
-    if (envp != environ) {
-        char **p;
-        p = envp;
-        while (*p != NULL) {
-            js_free(ctx, *p);
-            p++;
-        }
-        js_free(ctx, envp);
-    }
+    js_os_exec_params_free(ctx, ep);
     return ret_val;
  exception:
     ret_val = JS_EXCEPTION;
     goto done;
 }
 
+static void js_os_child_free(JSRuntime *rt, JSOSChild *ch)
+{
+    int i;
+    
+    list_del(&ch->link);
+    for(i = 0; i < 2; i++) {
+        if (ch->out_fds[i] >= 0)
+            close(ch->out_fds[i]);
+        dbuf_free(&ch->out_bufs[i]);
+        JS_FreeValueRT(rt, ch->resolving_funcs[i]);
+    }
+    if (ch->pidfd >= 0)
+        close(ch->pidfd);
+    js_free_rt(rt, ch);
+}
+
+static void js_os_free_array_buffer(JSRuntime *rt, void *opaque, void *ptr)
+{
+    js_free_rt(rt, ptr);
+}
+
+/* spawn(args[, options]) -> promise. The child is started with vfork()
+   so that the cost does not depend on the size of the parent, unless
+   the uid or gid is changed: glibc implements set*id() by signalling
+   all the threads of the process, which the vfork() child shares. Its
+   output is collected by the event loop and the promise is resolved
+   with { pid, status, stdout, stderr } once it has terminated. */
+static JSValue js_os_spawn(JSContext *ctx, JSValueConst this_val,
+                           int argc, JSValueConst *argv)
+{
+    JSRuntime *rt = JS_GetRuntime(ctx);
+    JSThreadState *ts = JS_GetRuntimeOpaque(rt);
+    JSOSExecParams ep_s, *ep = &ep_s;
+    JSOSChild *ch = NULL;
+    JSValue promise = JS_UNDEFINED;
+    int i, pid, pipe_fds[3][2], child_fds[3];
+    
+    for(i = 0; i < 3; i++) {
+        pipe_fds[i][0] = -1;
+        pipe_fds[i][1] = -1;
+    }
+    if (js_os_exec_params_init(ctx, ep, argc, argv, TRUE))
+        goto exception;
+
+    ch = js_mallocz(ctx, sizeof(*ch));
+    if (!ch)
+        goto exception;
+    ch->pidfd = -1;
+    for(i = 0; i < 2; i++) {
+        ch->out_fds[i] = -1;
+        js_std_dbuf_init(ctx, &ch->out_bufs[i]);
+        ch->resolving_funcs[i] = JS_UNDEFINED;
+    }
+    
+    for(i = 0; i < 3; i++) {
+        child_fds[i] = ep->std_fds[i];
+        if (child_fds[i] == -1) {
+            if (pipe(pipe_fds[i]) < 0) {
+                JS_ThrowTypeError(ctx, "pipe error");
+                goto exception;
+            }
+            /* the child keeps the end it uses as stdin/stdout/stderr */
+            child_fds[i] = pipe_fds[i][i == 0 ? 0 : 1];
+            fcntl(pipe_fds[i][0], F_SETFD, FD_CLOEXEC);
+            fcntl(pipe_fds[i][1], F_SETFD, FD_CLOEXEC);
+        }
+    }
+    
+    promise = JS_NewPromiseCapability(ctx, ch->resolving_funcs);
+    if (JS_IsException(promise))
+        goto exception;
+
+#if defined(__linux__)
+    if (ep->uid == -1 && ep->gid == -1)
+        pid = vfork();
+    else
+#endif
+        pid = fork();
+    if (pid < 0) {
+        JS_ThrowTypeError(ctx, "fork error");
+        goto exception;
+    }
+    if (pid == 0) {
+        /* child */
+        js_os_exec_child(ep, child_fds);
+    }
+    /* parent */
+    ch->pid = pid;
+    if (pipe_fds[0][0] >= 0) {
+        /* no input is provided: the child reads end of file */
+        close(pipe_fds[0][0]);
+        close(pipe_fds[0][1]);
+    }
+    for(i = 1; i < 3; i++) {
+        if (pipe_fds[i][0] >= 0) {
+            close(pipe_fds[i][1]);
+            ch->out_fds[i - 1] = pipe_fds[i][0];
+        }
+    }
+#if defined(__linux__) && defined(SYS_pidfd_open)
+    /* the descriptor becomes readable when the child terminates */
+    ch->pidfd = syscall(SYS_pidfd_open, pid, 0);
+#endif
+    list_add_tail(&ch->link, &ts->os_children);
+    js_os_exec_params_free(ctx, ep);
+    return promise;
+ exception:
+    for(i = 0; i < 3; i++) {
+        if (pipe_fds[i][0] >= 0) {
+            close(pipe_fds[i][0]);
+            close(pipe_fds[i][1]);
+        }
+    }
+    if (ch) {
+        for(i = 0; i < 2; i++) {
+            dbuf_free(&ch->out_bufs[i]);
+            JS_FreeValue(ctx, ch->resolving_funcs[i]);
+        }
+        js_free(ctx, ch);
+    }
+    JS_FreeValue(ctx, promise);
+    js_os_exec_params_free(ctx, ep);
+    return JS_EXCEPTION;
+}
+
+/* read the available output of the children, reap them and resolve the
+   promise of the first one which is complete. Return TRUE if a promise
+   was resolved. */
+static BOOL js_os_poll_children(JSContext *ctx, JSThreadState *ts,
+                                struct pollfd *pfd)
+{
+    JSRuntime *rt = JS_GetRuntime(ctx);
+    struct list_head *el;
+    JSOSChild *ch;
+    JSValue obj, ret;
+    DynBuf *b;
+    ssize_t len;
+    int i, status, ret1;
+    
+    /* 'pfd' is NULL if no descriptor is ready. Otherwise it follows the
+       order used by js_os_poll_internal() */
+    list_for_each(el, &ts->os_children) {
+        ch = list_entry(el, JSOSChild, link);
+        for(i = 0; i < 2; i++) {
+            if (ch->out_fds[i] < 0)
+                continue;
+            if (!pfd || !((pfd++)->revents & (POLLIN | POLLHUP | POLLERR)))
+                continue;
+            b = &ch->out_bufs[i];
+            if (dbuf_realloc(b, b->size + 65536)) {
+                len = -1;
+            } else {
+                len = read(ch->out_fds[i], b->buf + b->size, 65536);
+                if (len < 0 && (errno == EINTR || errno == EAGAIN))
+                    continue;
+            }
+            if (len <= 0) {
+                close(ch->out_fds[i]);
+                ch->out_fds[i] = -1;
+            } else {
+                b->size += len;
+            }
+        }
+        if (!ch->exited &&
+            (ch->pidfd < 0 ||
+             (pfd && ((pfd++)->revents & (POLLIN | POLLHUP | POLLERR))))) {
+            ret1 = waitpid(ch->pid, &status, WNOHANG);
+            if (ret1 == ch->pid) {
+                ch->exited = js_os_exit_status(status, &ch->status);
+            } else if (ret1 < 0 && errno == ECHILD) {
+                /* already reaped by the program with waitpid() */
+                ch->exited = TRUE;
+                ch->status_unknown = TRUE;
+            }
+        }
+    }
+
+    list_for_each(el, &ts->os_children) {
+        ch = list_entry(el, JSOSChild, link);
+        if (ch->exited && ch->out_fds[0] < 0 && ch->out_fds[1] < 0)
+            goto found;
+    }
+    return FALSE;
+ found:
+    /* unlink it first because the resolution may spawn new children */
+    list_del(&ch->link);
+    init_list_head(&ch->link);
+    obj = JS_NewObject(ctx);
+    if (!JS_IsException(obj)) {
+        JS_DefinePropertyValueStr(ctx, obj, "pid", JS_NewInt32(ctx, ch->pid),
+                                  JS_PROP_C_W_E);
+        JS_DefinePropertyValueStr(ctx, obj, "status",
+                                  ch->status_unknown ? JS_NULL :
+                                  JS_NewInt32(ctx, ch->status),
+                                  JS_PROP_C_W_E);
+        for(i = 0; i < 2; i++) {
+            JSValue buf = JS_UNDEFINED;
+            b = &ch->out_bufs[i];
+            if (b->buf) {
+                /* the output buffer is transferred to the ArrayBuffer */
+                buf = JS_NewArrayBuffer(ctx, b->buf, b->size,
+                                        js_os_free_array_buffer, NULL, FALSE);
+                if (!JS_IsException(buf))
+                    dbuf_init2(b, rt, (DynBufReallocFunc *)js_realloc_rt);
+            }
+            JS_DefinePropertyValueStr(ctx, obj, i == 0 ? "stdout" : "stderr",
+                                      buf, JS_PROP_C_W_E);
+        }
+        ret = JS_Call(ctx, ch->resolving_funcs[0], JS_UNDEFINED,
+                      1, (JSValueConst *)&obj);
+        JS_FreeValue(ctx, obj);
+    } else {
+        ret = JS_EXCEPTION;
+    }
+    if (JS_IsException(ret))
+        js_std_dump_error(ctx);
+    JS_FreeValue(ctx, ret);
+    js_os_child_free(rt, ch);
+    return TRUE;
+}
+
 /* waitpid(pid, block) -> [pid, status] */
 static JSValue js_os_waitpid(JSContext *ctx, JSValueConst this_val,
                              int argc, JSValueConst *argv)
@@ -3501,6 +4323,7 @@ static const JSCFunctionListEntry js_os_funcs[] = {
     JS_CFUNC_DEF("symlink", 2, js_os_symlink ),
     JS_CFUNC_DEF("readlink", 1, js_os_readlink ),
     JS_CFUNC_DEF("exec", 1, js_os_exec ),
+    JS_CFUNC_DEF("spawn", 1, js_os_spawn ),
     JS_CFUNC_DEF("waitpid", 2, js_os_waitpid ),
     OS_FLAG(WNOHANG),
     JS_CFUNC_DEF("pipe", 0, js_os_pipe ),
@@ -3566,23 +4389,41 @@ JSModuleDef *js_init_module_os(JSContext *ctx, const char *module_name)
 
 /**********************************************************/
 
+/* the line is assembled in a local buffer so that there is a single
+   stdio call (and lock) per print() in the common case. ASCII strings
+   are not copied by JS_ToCStringLen(). */
 static JSValue js_print(JSContext *ctx, JSValueConst this_val,
                               int argc, JSValueConst *argv)
 {
-    int i;
+    char buf[1024];
+    size_t pos, len;
     const char *str;
-    size_t len;
+    int i;
 
+    pos = 0;
     for(i = 0; i < argc; i++) {
-        if (i != 0)
-            putchar(' ');
         str = JS_ToCStringLen(ctx, &len, argv[i]);
-        if (!str)
+        if (!str) {
+            fwrite(buf, 1, pos, stdout);
             return JS_EXCEPTION;
-        fwrite(str, 1, len, stdout);
+        }
+        /* keep room for the separator or the final line feed */
+        if (pos + len + 1 > sizeof(buf)) {
+            fwrite(buf, 1, pos, stdout);
+            pos = 0;
+            if (len + 1 > sizeof(buf)) {
+                fwrite(str, 1, len, stdout);
+                len = 0;
+            }
+        }
+        memcpy(buf + pos, str, len);
+        pos += len;
         JS_FreeCString(ctx, str);
+        if (i != argc - 1)
+            buf[pos++] = ' ';
     }
-    putchar('\n');
+    buf[pos++] = '\n';
+    fwrite(buf, 1, pos, stdout);
     return JS_UNDEFINED;
 }
 
@@ -3629,7 +4470,9 @@ void js_std_init_handlers(JSRuntime *rt)
     init_list_head(&ts->os_rw_handlers);
     init_list_head(&ts->os_signal_handlers);
     init_list_head(&ts->os_timers);
+    ts->next_timer_id = 1;
     init_list_head(&ts->port_list);
+    init_list_head(&ts->os_children);
 
     JS_SetRuntimeOpaque(rt, ts);
 
@@ -3663,10 +4506,16 @@ void js_std_free_handlers(JSRuntime *rt)
     
     list_for_each_safe(el, el1, &ts->os_timers) {
         JSOSTimer *th = list_entry(el, JSOSTimer, link);
-        unlink_timer(rt, th);
-        if (!th->has_object)
-            free_timer(rt, th);
+        free_timer(rt, th);
+    }
+
+#ifndef _WIN32
+    list_for_each_safe(el, el1, &ts->os_children) {
+        JSOSChild *ch = list_entry(el, JSOSChild, link);
+        js_os_child_free(rt, ch);
     }
+    js_free_rt(rt, ts->poll_fds);
+#endif
 
     free(ts);
     JS_SetRuntimeOpaque(rt, NULL); /* fail safe */
@@ -3690,6 +4539,8 @@ static void js_std_dump_error1(JSContext *ctx, JSValueConst exception_val)
     JSValue val;
     BOOL is_error;
     
+    /* keep the error after the output which preceded it */
+    fflush(stdout);
     is_error = JS_IsError(ctx, exception_val);
     js_dump_obj(ctx, stderr, exception_val);
     if (is_error) {
@@ -3743,6 +4594,677 @@ void js_std_loop(JSContext *ctx)
     }
 }
 
+#ifdef USE_SCHEDULER
+
+/* The scheduler runs the event loops of many runtimes on a few
+   threads. The idle runtimes wait in a shared epoll instance and in a
+   heap of timer deadlines. The ready runtimes are queued on the
+   thread which last ran them and an idle thread steals from the other
+   queues. A runtime runs a whole slice on the same thread. All the
+   scheduler state is protected by its mutex. */
+
+typedef enum {
+    JS_SCHED_READY, /* in a ready queue */
+    JS_SCHED_RUNNING,
+    JS_SCHED_IDLE, /* waiting for an event or a timer */
+} JSSchedStateEnum;
+
+/* result of js_sched_run_slice() */
+typedef enum {
+    JS_SCHED_SLICE_IDLE,
+    JS_SCHED_SLICE_YIELD, /* the slice expired */
+    JS_SCHED_SLICE_DONE, /* no more jobs nor event sources */
+} JSSchedSliceEnum;
+
+typedef struct {
+    int fd;
+    uint32_t events;
+} JSSchedFd;
+
+typedef struct JSSchedEntry {
+    struct list_head link; /* in a ready queue */
+    struct list_head entry_link; /* in JSScheduler.entry_list */
+    JSScheduler *s;
+    JSContext *ctx;
+    JSSchedStateEnum state;
+    int worker; /* thread which last ran it */
+    int64_t slice_start; /* in ms */
+    int time_limit_ms; /* of the current slice */
+    BOOL interrupt_requested; /* by the watchdog */
+    BOOL interrupted; /* the slice was interrupted */
+    /* when idle */
+    int64_t deadline; /* next timer in ms, INT64_MAX if none */
+    int heap_index; /* index in the timer heap, -1 if none */
+    JSSchedFd *fds; /* registered in the epoll instance */
+    int fd_count;
+    int fd_size;
+} JSSchedEntry;
+
+typedef struct {
+    JSScheduler *s;
+    int index;
+    pthread_t thread;
+    BOOL thread_started;
+    struct list_head ready_list; /* list of JSSchedEntry.link */
+    JSSchedEntry *running;
+} JSSchedWorker;
+
+struct JSScheduler {
+    pthread_mutex_t mutex;
+    pthread_cond_t cond; /* signaled when a runtime is ready */
+    int epoll_fd;
+    int wake_fd; /* eventfd interrupting epoll_wait() */
+    int thread_count;
+    int slice_ms;
+    int time_limit_ms; /* 0 = no limit */
+    JSSchedulerDoneFunc *done_func;
+    void *done_opaque;
+    JSSchedWorker *workers;
+    struct list_head entry_list; /* list of JSSchedEntry.entry_link */
+    int entry_count; /* runtimes which are not done */
+    int next_worker;
+    BOOL polling; /* a thread is in epoll_wait() */
+    int64_t poll_deadline;
+    JSSchedEntry **timer_heap; /* min heap on the deadline */
+    int timer_count;
+    int timer_size; /* >= entry_count, so that insertions cannot fail */
+    /* time limit watchdog */
+    pthread_t watchdog_thread;
+    pthread_cond_t watchdog_cond;
+    BOOL watchdog_started;
+    BOOL watchdog_stop;
+};
+
+static void js_sched_heap_set(JSScheduler *s, int i, JSSchedEntry *e)
+{
+    s->timer_heap[i] = e;
+    e->heap_index = i;
+}
+
+static void js_sched_heap_up(JSScheduler *s, int i)
+{
+    JSSchedEntry *e = s->timer_heap[i];
+    int parent;
+
+    while (i > 0) {
+        parent = (i - 1) / 2;
+        if (s->timer_heap[parent]->deadline <= e->deadline)
+            break;
+        js_sched_heap_set(s, i, s->timer_heap[parent]);
+        i = parent;
+    }
+    js_sched_heap_set(s, i, e);
+}
+
+static void js_sched_heap_down(JSScheduler *s, int i)
+{
+    JSSchedEntry *e = s->timer_heap[i];
+    int child;
+
+    for(;;) {
+        child = 2 * i + 1;
+        if (child >= s->timer_count)
+            break;
+        if (child + 1 < s->timer_count &&
+            s->timer_heap[child + 1]->deadline < s->timer_heap[child]->deadline)
+            child++;
+        if (e->deadline <= s->timer_heap[child]->deadline)
+            break;
+        js_sched_heap_set(s, i, s->timer_heap[child]);
+        i = child;
+    }
+    js_sched_heap_set(s, i, e);
+}
+
+/* make room for 'count' runtimes in the heap. Return -1 if no memory */
+static int js_sched_heap_reserve(JSScheduler *s, int count)
+{
+    int new_size;
+    JSSchedEntry **new_heap;
+
+    if (count <= s->timer_size)
+        return 0;
+    new_size = max_int(count, max_int(16, s->timer_size * 3 / 2));
+    new_heap = realloc(s->timer_heap, sizeof(new_heap[0]) * new_size);
+    if (!new_heap)
+        return -1;
+    s->timer_heap = new_heap;
+    s->timer_size = new_size;
+    return 0;
+}
+
+/* a runtime is at most once in the heap, which has room for all of
+   them (see js_std_scheduler_add()) */
+static void js_sched_heap_insert(JSScheduler *s, JSSchedEntry *e)
+{
+    assert(s->timer_count < s->timer_size);
+    js_sched_heap_set(s, s->timer_count++, e);
+    js_sched_heap_up(s, e->heap_index);
+}
+
+static void js_sched_heap_remove(JSScheduler *s, JSSchedEntry *e)
+{
+    int i = e->heap_index;
+    JSSchedEntry *last;
+
+    e->heap_index = -1;
+    last = s->timer_heap[--s->timer_count];
+    if (last != e) {
+        js_sched_heap_set(s, i, last);
+        js_sched_heap_up(s, i);
+        js_sched_heap_down(s, last->heap_index);
+    }
+}
+
+static int js_sched_add_fd(JSSchedEntry *e, int fd, uint32_t events)
+{
+    int i;
+
+    for(i = 0; i < e->fd_count; i++) {
+        if (e->fds[i].fd == fd) {
+            e->fds[i].events |= events;
+            return 0;
+        }
+    }
+    if (e->fd_count >= e->fd_size) {
+        int new_size = max_int(4, e->fd_size * 3 / 2);
+        JSSchedFd *new_fds;
+        new_fds = realloc(e->fds, sizeof(new_fds[0]) * new_size);
+        if (!new_fds)
+            return -1;
+        e->fds = new_fds;
+        e->fd_size = new_size;
+    }
+    e->fds[e->fd_count].fd = fd;
+    e->fds[e->fd_count].events = events;
+    e->fd_count++;
+    return 0;
+}
+
+/* compute what the event loop of the runtime waits for. Same sources
+   as js_os_poll_internal(). */
+static int js_sched_get_wait_set(JSSchedEntry *e)
+{
+    JSThreadState *ts = JS_GetRuntimeOpaque(JS_GetRuntime(e->ctx));
+    struct list_head *el;
+    int i;
+
+    e->fd_count = 0;
+    e->deadline = INT64_MAX;
+    list_for_each(el, &ts->os_timers) {
+        JSOSTimer *th = list_entry(el, JSOSTimer, link);
+        if (th->timeout < e->deadline)
+            e->deadline = th->timeout;
+    }
+    list_for_each(el, &ts->os_rw_handlers) {
+        JSOSRWHandler *rh = list_entry(el, JSOSRWHandler, link);
+        if (!JS_IsNull(rh->rw_func[0]) && js_sched_add_fd(e, rh->fd, EPOLLIN))
+            return -1;
+        if (!JS_IsNull(rh->rw_func[1]) && js_sched_add_fd(e, rh->fd, EPOLLOUT))
+            return -1;
+    }
+    list_for_each(el, &ts->port_list) {
+        JSWorkerMessageHandler *port = list_entry(el, JSWorkerMessageHandler, link);
+        if (!JS_IsNull(port->on_message_func) &&
+            js_sched_add_fd(e, port->recv_pipe->read_fd, EPOLLIN))
+            return -1;
+    }
+    list_for_each(el, &ts->os_children) {
+        JSOSChild *ch = list_entry(el, JSOSChild, link);
+        for(i = 0; i < 2; i++) {
+            if (ch->out_fds[i] >= 0 &&
+                js_sched_add_fd(e, ch->out_fds[i], EPOLLIN))
+                return -1;
+        }
+        if (ch->exited) {
+            if (ch->out_fds[0] < 0 && ch->out_fds[1] < 0)
+                e->deadline = 0;
+        } else if (ch->pidfd >= 0) {
+            if (js_sched_add_fd(e, ch->pidfd, EPOLLIN))
+                return -1;
+        } else {
+            /* no process descriptor: check the child periodically */
+            e->deadline = min_int64(e->deadline, get_time_ms() + 10);
+        }
+    }
+    return 0;
+}
+
+static void js_sched_wake_poller(JSScheduler *s)
+{
+    uint64_t v = 1;
+    int ret;
+    ret = write(s->wake_fd, &v, sizeof(v));
+    (void)ret;
+}
+
+/* put the runtime in the idle state */
+static void js_sched_wait(JSScheduler *s, JSSchedEntry *e)
+{
+    struct epoll_event ev;
+    int i;
+
+    if (js_sched_get_wait_set(e)) {
+        /* no memory: poll the runtime */
+        e->fd_count = 0;
+        e->deadline = get_time_ms() + 10;
+    }
+    for(i = 0; i < e->fd_count;) {
+        memset(&ev, 0, sizeof(ev));
+        ev.events = e->fds[i].events;
+        ev.data.ptr = e;
+        if (epoll_ctl(s->epoll_fd, EPOLL_CTL_ADD, e->fds[i].fd, &ev) < 0) {
+            /* regular files are always ready. Other failures (e.g. a
+               file descriptor shared with another runtime) are
+               handled by polling. */
+            e->deadline = min_int64(e->deadline, errno == EPERM ? 0 :
+                                    get_time_ms() + 10);
+            e->fds[i] = e->fds[--e->fd_count];
+        } else {
+            i++;
+        }
+    }
+    e->state = JS_SCHED_IDLE;
+    if (e->deadline != INT64_MAX) {
+        js_sched_heap_insert(s, e);
+        if (s->polling && e->deadline < s->poll_deadline)
+            js_sched_wake_poller(s);
+    }
+}
+
+static void js_sched_make_ready(JSScheduler *s, JSSchedEntry *e)
+{
+    int i;
+
+    for(i = 0; i < e->fd_count; i++)
+        epoll_ctl(s->epoll_fd, EPOLL_CTL_DEL, e->fds[i].fd, NULL);
+    e->fd_count = 0;
+    if (e->heap_index >= 0)
+        js_sched_heap_remove(s, e);
+    e->state = JS_SCHED_READY;
+    list_add_tail(&e->link, &s->workers[e->worker].ready_list);
+    pthread_cond_signal(&s->cond);
+}
+
+/* take a ready runtime, stealing it from another thread if needed */
+static JSSchedEntry *js_sched_take(JSScheduler *s, int index)
+{
+    JSSchedWorker *w;
+    JSSchedEntry *e;
+    int i;
+
+    for(i = 0; i < s->thread_count; i++) {
+        w = &s->workers[(index + i) % s->thread_count];
+        if (!list_empty(&w->ready_list)) {
+            e = list_entry(w->ready_list.next, JSSchedEntry, link);
+            list_del(&e->link);
+            return e;
+        }
+    }
+    return NULL;
+}
+
+static int js_sched_interrupt_handler(JSRuntime *rt, void *opaque)
+{
+    JSSchedEntry *e = opaque;
+    /* only called in the thread running the slice. Only the callback
+       running at the time limit is terminated, then the slice ends. */
+    if (e->time_limit_ms == 0 || e->state != JS_SCHED_RUNNING ||
+        e->interrupted ||
+        get_time_ms() - e->slice_start < e->time_limit_ms)
+        return FALSE;
+    e->interrupted = TRUE;
+    return TRUE;
+}
+
+/* Run the pending jobs and the ready events of a runtime until it is
+   idle or its slice expired. Called without the mutex. */
+static JSSchedSliceEnum js_sched_run_slice(JSScheduler *s, JSSchedEntry *e)
+{
+    JSContext *ctx = e->ctx, *ctx1;
+    JSRuntime *rt = JS_GetRuntime(ctx);
+    int64_t end = e->slice_start + s->slice_ms;
+    int err, ret;
+
+    JS_UpdateStackTop(rt);
+    for(;;) {
+        err = JS_ExecutePendingJob(rt, &ctx1);
+        if (err < 0) {
+            js_std_dump_error(ctx1);
+        } else if (err == 0) {
+            ret = js_os_poll_internal(ctx, FALSE);
+            if (ret < 0)
+                return JS_SCHED_SLICE_DONE;
+            if (ret > 0 && !JS_IsJobPending(rt))
+                return JS_SCHED_SLICE_IDLE;
+        }
+        if (e->interrupted || get_time_ms() >= end)
+            return JS_SCHED_SLICE_YIELD;
+    }
+}
+
+/* wait for events until a runtime is ready. Called with the mutex
+   held by a single thread at a time. */
+static void js_sched_poll(JSScheduler *s)
+{
+    struct epoll_event events[64];
+    JSSchedEntry *e;
+    int64_t now;
+    int i, n, timeout;
+    uint64_t v;
+
+    s->polling = TRUE;
+    now = get_time_ms();
+    if (s->timer_count > 0) {
+        s->poll_deadline = s->timer_heap[0]->deadline;
+        timeout = min_int64(max_int64(s->poll_deadline - now, 0), INT32_MAX);
+    } else {
+        s->poll_deadline = INT64_MAX;
+        timeout = -1;
+    }
+    pthread_mutex_unlock(&s->mutex);
+    /* the runtimes are idle: make the buffered output visible */
+    fflush(stdout);
+    n = epoll_wait(s->epoll_fd, events, countof(events), timeout);
+    pthread_mutex_lock(&s->mutex);
+    s->polling = FALSE;
+    for(i = 0; i < n; i++) {
+        e = events[i].data.ptr;
+        if (!e) {
+            if (read(s->wake_fd, &v, sizeof(v)) < 0) {
+                /* ignore */
+            }
+        } else if (e->state == JS_SCHED_IDLE) {
+            js_sched_make_ready(s, e);
+        }
+    }
+    now = get_time_ms();
+    while (s->timer_count > 0 && s->timer_heap[0]->deadline <= now)
+        js_sched_make_ready(s, s->timer_heap[0]);
+}
+
+static void js_sched_worker(JSSchedWorker *w)
+{
+    JSScheduler *s = w->s;
+    JSSchedEntry *e;
+    JSSchedSliceEnum res;
+
+    pthread_mutex_lock(&s->mutex);
+    while (s->entry_count > 0) {
+        e = js_sched_take(s, w->index);
+        if (!e) {
+            if (!s->polling)
+                js_sched_poll(s);
+            else
+                pthread_cond_wait(&s->cond, &s->mutex);
+            continue;
+        }
+        e->state = JS_SCHED_RUNNING;
+        e->worker = w->index;
+        e->slice_start = get_time_ms();
+        e->time_limit_ms = s->time_limit_ms;
+        e->interrupt_requested = FALSE;
+        e->interrupted = FALSE;
+        w->running = e;
+        pthread_mutex_unlock(&s->mutex);
+
+        res = js_sched_run_slice(s, e);
+
+        pthread_mutex_lock(&s->mutex);
+        w->running = NULL;
+        if (res == JS_SCHED_SLICE_DONE) {
+            list_del(&e->entry_link);
+            if (--s->entry_count == 0) {
+                pthread_cond_broadcast(&s->cond);
+                if (s->polling)
+                    js_sched_wake_poller(s);
+            }
+            pthread_mutex_unlock(&s->mutex);
+            JS_SetInterruptHandler(JS_GetRuntime(e->ctx), NULL, NULL);
+            if (s->done_func)
+                s->done_func(e->ctx, s->done_opaque);
+            free(e->fds);
+            free(e);
+            pthread_mutex_lock(&s->mutex);
+        } else if (res == JS_SCHED_SLICE_YIELD) {
+            /* let the other ready runtimes run first */
+            e->state = JS_SCHED_READY;
+            list_add_tail(&e->link, &w->ready_list);
+            pthread_cond_signal(&s->cond);
+        } else {
+            js_sched_wait(s, e);
+        }
+    }
+    pthread_mutex_unlock(&s->mutex);
+}
+
+static void *js_sched_worker_thread(void *opaque)
+{
+    js_sched_worker(opaque);
+    return NULL;
+}
+
+/* interrupt the slices which exceed the time limit */
+static void *js_sched_watchdog_thread(void *opaque)
+{
+    JSScheduler *s = opaque;
+    JSSchedEntry *e;
+    struct timespec ts;
+    int64_t now, next, end;
+    int i;
+
+    pthread_mutex_lock(&s->mutex);
+    while (!s->watchdog_stop) {
+        if (s->time_limit_ms == 0) {
+            pthread_cond_wait(&s->watchdog_cond, &s->mutex);
+            continue;
+        }
+        now = get_time_ms();
+        next = now + s->time_limit_ms;
+        for(i = 0; i < s->thread_count; i++) {
+            e = s->workers[i].running;
+            if (!e || e->interrupt_requested || e->time_limit_ms == 0)
+                continue;
+            end = e->slice_start + e->time_limit_ms;
+            if (now >= end) {
+                JS_RequestInterrupt(JS_GetRuntime(e->ctx));
+                e->interrupt_requested = TRUE;
+            } else if (end < next) {
+                next = end;
+            }
+        }
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        next = (int64_t)ts.tv_sec * 1000 + ts.tv_nsec / 1000000 + (next - now);
+        ts.tv_sec = next / 1000;
+        ts.tv_nsec = (next % 1000) * 1000000;
+        pthread_cond_timedwait(&s->watchdog_cond, &s->mutex, &ts);
+    }
+    pthread_mutex_unlock(&s->mutex);
+    return NULL;
+}
+
+/* 'thread_count' threads run the event loops. A runtime yields to
+   the others between two callbacks once it ran for 'slice_ms'
+   milliseconds. 'done_func' is called when a runtime has no more jobs
+   nor event sources. */
+JSScheduler *js_std_scheduler_new(int thread_count, int slice_ms,
+                                  JSSchedulerDoneFunc *done_func,
+                                  void *opaque)
+{
+    JSScheduler *s;
+    struct epoll_event ev;
+    pthread_condattr_t attr;
+    int i;
+
+    s = malloc(sizeof(*s));
+    if (!s)
+        return NULL;
+    memset(s, 0, sizeof(*s));
+    s->thread_count = max_int(thread_count, 1);
+    s->slice_ms = max_int(slice_ms, 1);
+    s->done_func = done_func;
+    s->done_opaque = opaque;
+    init_list_head(&s->entry_list);
+    s->epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+    s->wake_fd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    s->workers = malloc(sizeof(s->workers[0]) * s->thread_count);
+    if (s->epoll_fd < 0 || s->wake_fd < 0 || !s->workers)
+        goto fail;
+    memset(&ev, 0, sizeof(ev));
+    ev.events = EPOLLIN;
+    ev.data.ptr = NULL;
+    if (epoll_ctl(s->epoll_fd, EPOLL_CTL_ADD, s->wake_fd, &ev) < 0)
+        goto fail;
+    for(i = 0; i < s->thread_count; i++) {
+        JSSchedWorker *w = &s->workers[i];
+        memset(w, 0, sizeof(*w));
+        w->s = s;
+        w->index = i;
+        init_list_head(&w->ready_list);
+    }
+    pthread_mutex_init(&s->mutex, NULL);
+    pthread_cond_init(&s->cond, NULL);
+    pthread_condattr_init(&attr);
+    pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+    pthread_cond_init(&s->watchdog_cond, &attr);
+    pthread_condattr_destroy(&attr);
+    return s;
+ fail:
+    if (s->epoll_fd >= 0)
+        close(s->epoll_fd);
+    if (s->wake_fd >= 0)
+        close(s->wake_fd);
+    free(s->workers);
+    free(s);
+    return NULL;
+}
+
+/* Terminate the callbacks of the slices which run for more than
+   'time_limit_ms' milliseconds (0 = no limit). */
+void js_std_scheduler_set_time_limit(JSScheduler *s, int time_limit_ms)
+{
+    pthread_mutex_lock(&s->mutex);
+    s->time_limit_ms = max_int(time_limit_ms, 0);
+    pthread_cond_signal(&s->watchdog_cond);
+    pthread_mutex_unlock(&s->mutex);
+}
+
+/* Let the scheduler run the jobs and the events of the runtime of
+   'ctx'. The runtime must not be used by another thread until
+   'done_func' is called. Its interrupt handler is replaced. Can be
+   called while the scheduler is running. Return -1 if no memory. */
+int js_std_scheduler_add(JSScheduler *s, JSContext *ctx)
+{
+    JSSchedEntry *e;
+
+    e = malloc(sizeof(*e));
+    if (!e)
+        return -1;
+    memset(e, 0, sizeof(*e));
+    e->s = s;
+    e->ctx = ctx;
+    e->heap_index = -1;
+    pthread_mutex_lock(&s->mutex);
+    if (js_sched_heap_reserve(s, s->entry_count + 1)) {
+        pthread_mutex_unlock(&s->mutex);
+        free(e);
+        return -1;
+    }
+    JS_SetInterruptHandler(JS_GetRuntime(ctx), js_sched_interrupt_handler, e);
+    e->worker = s->next_worker;
+    s->next_worker = (s->next_worker + 1) % s->thread_count;
+    list_add_tail(&e->entry_link, &s->entry_list);
+    s->entry_count++;
+    e->state = JS_SCHED_READY;
+    list_add_tail(&e->link, &s->workers[e->worker].ready_list);
+    pthread_cond_signal(&s->cond);
+    if (s->polling)
+        js_sched_wake_poller(s);
+    pthread_mutex_unlock(&s->mutex);
+    return 0;
+}
+
+/* Run the scheduler threads, the calling thread being one of them,
+   until all the runtimes are done. */
+void js_std_scheduler_run(JSScheduler *s)
+{
+    int i;
+
+    for(i = 1; i < s->thread_count; i++) {
+        JSSchedWorker *w = &s->workers[i];
+        w->thread_started = (pthread_create(&w->thread, NULL,
+                                            js_sched_worker_thread, w) == 0);
+    }
+    s->watchdog_stop = FALSE;
+    s->watchdog_started = (pthread_create(&s->watchdog_thread, NULL,
+                                          js_sched_watchdog_thread, s) == 0);
+    js_sched_worker(&s->workers[0]);
+    for(i = 1; i < s->thread_count; i++) {
+        JSSchedWorker *w = &s->workers[i];
+        if (w->thread_started) {
+            pthread_join(w->thread, NULL);
+            w->thread_started = FALSE;
+        }
+    }
+    if (s->watchdog_started) {
+        pthread_mutex_lock(&s->mutex);
+        s->watchdog_stop = TRUE;
+        pthread_cond_signal(&s->watchdog_cond);
+        pthread_mutex_unlock(&s->mutex);
+        pthread_join(s->watchdog_thread, NULL);
+        s->watchdog_started = FALSE;
+    }
+}
+
+/* The runtimes which are not done are left to the caller. */
+void js_std_scheduler_free(JSScheduler *s)
+{
+    struct list_head *el, *el1;
+
+    list_for_each_safe(el, el1, &s->entry_list) {
+        JSSchedEntry *e = list_entry(el, JSSchedEntry, entry_link);
+        JS_SetInterruptHandler(JS_GetRuntime(e->ctx), NULL, NULL);
+        free(e->fds);
+        free(e);
+    }
+    close(s->epoll_fd);
+    close(s->wake_fd);
+    pthread_mutex_destroy(&s->mutex);
+    pthread_cond_destroy(&s->cond);
+    pthread_cond_destroy(&s->watchdog_cond);
+    free(s->timer_heap);
+    free(s->workers);
+    free(s);
+}
+
+#else
+
+JSScheduler *js_std_scheduler_new(int thread_count, int slice_ms,
+                                  JSSchedulerDoneFunc *done_func,
+                                  void *opaque)
+{
+    return NULL;
+}
+
+void js_std_scheduler_set_time_limit(JSScheduler *s, int time_limit_ms)
+{
+}
+
+int js_std_scheduler_add(JSScheduler *s, JSContext *ctx)
+{
+    return -1;
+}
+
+void js_std_scheduler_run(JSScheduler *s)
+{
+}
+
+void js_std_scheduler_free(JSScheduler *s)
+{
+}
+
+#endif /* !USE_SCHEDULER */
+
 void js_std_eval_binary(JSContext *ctx, const uint8_t *buf, size_t buf_len,
                         int load_only)
 {
@@ -3771,3 +5293,128 @@ void js_std_eval_binary(JSContext *ctx, const uint8_t *buf, size_t buf_len,
         JS_FreeValue(ctx, val);
     }
 }
+
+/* Context hibernation: the pending timers of the runtime are saved
+   with the global variables as an array of [delay, func, timer_id].
+   They keep their identifier so that the saved handles can still be
+   passed to os.clearTimeout(). */
+
+int js_std_hibernate_context(JSContext *ctx, const char *filename)
+{
+    JSRuntime *rt = JS_GetRuntime(ctx);
+    JSThreadState *ts = JS_GetRuntimeOpaque(rt);
+    struct list_head *el;
+    JSOSTimer *th;
+    JSValue timers, item;
+    uint8_t *buf;
+    size_t buf_len;
+    int64_t now, delay;
+    uint32_t i;
+    FILE *f;
+    int ret;
+
+    timers = JS_NewArray(ctx);
+    if (JS_IsException(timers))
+        return -1;
+    now = get_time_ms();
+    i = 0;
+    list_for_each(el, &ts->os_timers) {
+        th = list_entry(el, JSOSTimer, link);
+        delay = th->timeout - now;
+        if (delay < 0)
+            delay = 0;
+        item = JS_NewArray(ctx);
+        if (JS_IsException(item) ||
+            JS_SetPropertyUint32(ctx, item, 0, JS_NewInt64(ctx, delay)) < 0 ||
+            JS_SetPropertyUint32(ctx, item, 1,
+                                 JS_DupValue(ctx, th->func)) < 0 ||
+            JS_SetPropertyUint32(ctx, item, 2,
+                                 JS_NewInt32(ctx, th->timer_id)) < 0) {
+            JS_FreeValue(ctx, item);
+            goto fail;
+        }
+        if (JS_SetPropertyUint32(ctx, timers, i++, item) < 0)
+            goto fail;
+    }
+    buf = JS_HibernateContext(ctx, &buf_len, timers);
+    JS_FreeValue(ctx, timers);
+    if (!buf)
+        return -1;
+    ret = -1;
+    f = fopen(filename, "wb");
+    if (f) {
+        if (fwrite(buf, 1, buf_len, f) == buf_len)
+            ret = 0;
+        if (fclose(f) != 0)
+            ret = -1;
+    }
+    js_free(ctx, buf);
+    if (ret < 0)
+        JS_ThrowReferenceError(ctx, "could not write '%s'", filename);
+    return ret;
+ fail:
+    JS_FreeValue(ctx, timers);
+    return -1;
+}
+
+int js_std_restore_context(JSContext *ctx, const char *filename)
+{
+    JSRuntime *rt = JS_GetRuntime(ctx);
+    JSThreadState *ts = JS_GetRuntimeOpaque(rt);
+    JSValue timers, item, func, val;
+    uint8_t *buf;
+    size_t buf_len;
+    int64_t delay, len, i;
+    int ret, res, timer_id;
+
+    buf = js_load_file(ctx, &buf_len, filename);
+    if (!buf) {
+        JS_ThrowReferenceError(ctx, "could not load '%s'", filename);
+        return -1;
+    }
+    timers = JS_RestoreContext(ctx, buf, buf_len);
+    js_free(ctx, buf);
+    if (JS_IsException(timers))
+        return -1;
+    ret = -1;
+    val = JS_GetPropertyStr(ctx, timers, "length");
+    res = JS_ToInt64(ctx, &len, val);
+    JS_FreeValue(ctx, val);
+    if (res)
+        goto done;
+    for(i = 0; i < len; i++) {
+        item = JS_GetPropertyUint32(ctx, timers, i);
+        if (JS_IsException(item))
+            goto done;
+        val = JS_GetPropertyUint32(ctx, item, 0);
+        res = JS_ToInt64(ctx, &delay, val);
+        JS_FreeValue(ctx, val);
+        if (!res) {
+            val = JS_GetPropertyUint32(ctx, item, 2);
+            res = JS_ToInt32(ctx, &timer_id, val);
+            JS_FreeValue(ctx, val);
+        }
+        func = JS_GetPropertyUint32(ctx, item, 1);
+        JS_FreeValue(ctx, item);
+        if (res || timer_id <= 0 || !JS_IsFunction(ctx, func)) {
+            if (!res)
+                JS_ThrowTypeError(ctx, "invalid timer");
+            JS_FreeValue(ctx, func);
+            goto done;
+        }
+        if (find_timer_by_id(ts, timer_id)) {
+            JS_ThrowInternalError(ctx, "timer %d is already in use",
+                                  timer_id);
+            JS_FreeValue(ctx, func);
+            goto done;
+        }
+        res = (add_timer(ctx, ts, timer_id, delay, func) == NULL);
+        JS_FreeValue(ctx, func);
+        if (res)
+            goto done;
+    }
+    ret = 0;
+ done:
+    JS_FreeValue(ctx, timers);
+    return ret;
+}
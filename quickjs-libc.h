@@ -51,6 +51,25 @@ void js_std_promise_rejection_tracker(JSContext *ctx, JSValueConst promise,
                                       JSValueConst reason,
                                       JS_BOOL is_handled, void *opaque);
 
+/* run the event loops of many runtimes on a few threads (Linux only,
+   js_std_scheduler_new() returns NULL otherwise) */
+typedef struct JSScheduler JSScheduler;
+/* called when the runtime of 'ctx' has no more work */
+typedef void JSSchedulerDoneFunc(JSContext *ctx, void *opaque);
+JSScheduler *js_std_scheduler_new(int thread_count, int slice_ms,
+                                  JSSchedulerDoneFunc *done_func,
+                                  void *opaque);
+void js_std_scheduler_set_time_limit(JSScheduler *s, int time_limit_ms);
+int js_std_scheduler_add(JSScheduler *s, JSContext *ctx);
+void js_std_scheduler_run(JSScheduler *s);
+void js_std_scheduler_free(JSScheduler *s);
+
+/* save the global variables and the pending timers to 'filename', and
+   restore them in a context set up like the original one (see
+   JS_HibernateContext()) */
+int js_std_hibernate_context(JSContext *ctx, const char *filename);
+int js_std_restore_context(JSContext *ctx, const char *filename);
+
 #ifdef __cplusplus
 } /* extern "C" { */
 #endif
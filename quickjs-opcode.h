@@ -176,6 +176,9 @@ DEF(get_var_ref_check, 3, 0, 1, var_ref)
 DEF(put_var_ref_check, 3, 1, 0, var_ref) /* must come after get_var_ref_check */
 DEF(put_var_ref_check_init, 3, 1, 0, var_ref)
 DEF(      close_loc, 3, 0, 0, loc)
+DEF(  get_arguments, 3, 0, 1, loc) /* 'arguments' object, built on first use */
+DEF(get_arguments_length, 3, 0, 1, loc) /* arguments.length */
+DEF(get_arguments_el, 3, 1, 1, loc) /* key -> arguments[key] */
 DEF(       if_false, 5, 1, 0, label)
 DEF(        if_true, 5, 1, 0, label) /* must come after if_false */
 DEF(           goto, 5, 0, 0, label) /* must come after if_true */
@@ -72,6 +72,18 @@
 #define CONFIG_ATOMICS
 #endif
 
+/* define to allow freeing memory in a background thread
+   (JS_SetBackgroundFree()) */
+#if !defined(EMSCRIPTEN)
+#define CONFIG_BACKGROUND_FREE
+#endif
+
+/* define to support per-thread CPU time limits
+   (JS_SetCPUTimeLimit()) */
+#if defined(CONFIG_ATOMICS) && !defined(_WIN32) && !defined(__APPLE__)
+#define CONFIG_CPU_TIME_LIMIT
+#endif
+
 #if !defined(EMSCRIPTEN)
 /* enable stack limitation */
 #define CONFIG_STACK_CHECK
@@ -108,8 +120,10 @@
 /* test the GC by forcing it before each object allocation */
 //#define FORCE_GC_AT_MALLOC
 
-#ifdef CONFIG_ATOMICS
+#if defined(CONFIG_ATOMICS) || defined(CONFIG_BACKGROUND_FREE)
 #include <pthread.h>
+#endif
+#ifdef CONFIG_ATOMICS
 #include <stdatomic.h>
 #include <errno.h>
 #endif
@@ -177,6 +191,8 @@ enum {
     JS_CLASS_ASYNC_FROM_SYNC_ITERATOR,  /* u.async_from_sync_iterator_data */
     JS_CLASS_ASYNC_GENERATOR_FUNCTION,  /* u.func */
     JS_CLASS_ASYNC_GENERATOR,   /* u.async_generator_data */
+    JS_CLASS_WEAK_REF,          /* u.weak_ref */
+    JS_CLASS_FINALIZATION_REGISTRY, /* u.finrec_state */
 
     JS_CLASS_INIT_COUNT, /* last entry for predefined classes */
 };
@@ -237,18 +253,124 @@ typedef struct {
 } JSNumericOperations;
 #endif
 
+#define JS_INSTANCEOF_CACHE_SIZE 128 /* must be a power of two */
+
+/* result of the prototype chain walk of 'instanceof' starting from
+   'proto' and looking for 'target_proto' */
+typedef struct JSInstanceofCacheEntry {
+    JSObject *proto;
+    JSObject *target_proto;
+    uint32_t epoch;
+    BOOL result;
+} JSInstanceofCacheEntry;
+
+#ifdef CONFIG_BIGNUM
+#define JS_OPERATOR_SET_CACHE_SIZE 64 /* must be a power of two */
+#define JS_OPERATOR_CACHE_SIZE 64 /* must be a power of two */
+
+/* The operator caches are keyed by hashed shapes. A hashed shape is
+   not modified in place while it is in the shape hash table. The
+   shapes are not referenced: the entries using a shape are removed
+   when it leaves the shape hash table (see
+   js_operator_cache_remove_shape()). */
+
+/* location of the Symbol.operatorSet data property for the objects of
+   shape 'shape'. It is held by the object itself (depth = 0), its
+   prototype (depth = 1) or the prototype of its prototype (depth = 2,
+   'mid_shape' is the shape of its prototype). */
+typedef struct JSOperatorSetCacheEntry {
+    JSShape *shape;
+    JSShape *mid_shape;
+    JSShape *holder_shape;
+    uint32_t prop_idx;
+    int depth;
+} JSOperatorSetCacheEntry;
+
+/* binary operator function for the operands of shapes 'shape1' and
+   'shape2'. The operator sets are identified by their counter
+   because their address may be reused. 'method' is owned by them. */
+typedef struct JSOperatorCacheEntry {
+    JSShape *shape1;
+    JSShape *shape2;
+    JSObject *method;
+    uint32_t operator_counter1;
+    uint32_t operator_counter2;
+    uint8_t ovop;
+    uint8_t is_primitive1;
+    uint8_t is_primitive2;
+} JSOperatorCacheEntry;
+#endif
+
+/* set of objects (see js_object_list_add()) */
+typedef struct {
+    JSObject *obj;
+    uint32_t hash_next; /* -1 if no next entry */
+} JSObjectListEntry;
+
+/* XXX: reuse it to optimize weak references */
+typedef struct {
+    JSObjectListEntry *object_tab;
+    int object_count;
+    int object_size;
+    uint32_t *hash_table;
+    uint32_t hash_size;
+} JSObjectList;
+
+typedef struct JSArenaChunk {
+    struct JSArenaChunk *next;
+    uint64_t dummy; /* keeps the blocks 16 byte aligned */
+} JSArenaChunk;
+
+/* per-context memory account (JS_RUNTIME_CONTEXT_MEMORY) */
+typedef struct JSMemoryAccount {
+    /* includes the block headers. The arena blocks are not counted:
+       their chunks are. */
+    int64_t malloc_size;
+    int64_t malloc_count;
+    size_t soft_limit;
+    size_t hard_limit;
+    /* FALSE once the context is freed. The account is released when
+       its last block is freed. */
+    BOOL in_use : 8;
+    int next_free; /* next free account index if !in_use */
+    /* arena mode: the small blocks are bump allocated in chunks which
+       are all freed when the account is released */
+    size_t arena_chunk_size; /* 0 if no arena */
+    JSArenaChunk *arena_chunks;
+    uint8_t *arena_ptr;
+    uint8_t *arena_end;
+} JSMemoryAccount;
+
 struct JSRuntime {
     JSMallocFunctions mf;
     JSMallocState malloc_state;
     const char *rt_info;
 
+    /* per-context memory accounting. NULL if disabled. Account 0
+       collects the allocations not made on behalf of a context. */
+    JSMemoryAccount *mem_accounts;
+    int mem_account_count;
+    int mem_account_free_index; /* 0 = none */
+    int malloc_account; /* account charged by the allocations */
+#ifdef CONFIG_BACKGROUND_FREE
+    struct JSBackgroundFree *bg_free; /* NULL if disabled */
+#endif
+
     int atom_hash_size; /* power of two */
     int atom_count;
     int atom_size;
     int atom_count_resize; /* resize hash table at this count */
     uint32_t *atom_hash;
+    /* during a resize, the atoms are incrementally moved from
+       atom_hash_old. Its buckets < atom_hash_old_pos are empty. */
+    uint32_t *atom_hash_old;
+    int atom_hash_old_size;
+    int atom_hash_old_pos;
     JSAtomStruct **atom_array;
     int atom_free_index; /* 0 = none */
+    uint8_t *atom_init_buf; /* symbols of the predefined atoms */
+    /* string values of the shared predefined atoms, allocated on first use */
+    JSString **atom_init_values;
 
     int class_count;    /* size of class_array */
     JSClass *class_array;
@@ -277,11 +399,26 @@ struct JSRuntime {
 
     JSInterruptHandler *interrupt_handler;
     void *interrupt_opaque;
+    /* JS_INTERRUPT_REQUEST_x bits. May be set from another thread. */
+#ifdef CONFIG_ATOMICS
+    _Atomic int interrupt_request;
+#else
+    int interrupt_request;
+#endif
+#ifdef CONFIG_CPU_TIME_LIMIT
+    struct JSCPUTimer *cpu_timer; /* NULL if no CPU time limit was set */
+#endif
 
     JSHostPromiseRejectionTracker *host_promise_rejection_tracker;
     void *host_promise_rejection_tracker_opaque;
     
     struct list_head job_list; /* list of JSJobEntry.link */
+    /* list of JSFinRecState.pending_link: FinalizationRegistry objects
+       whose cleanup job must be queued */
+    struct list_head finrec_pending_list;
+    /* objects kept alive by WeakRef until the current job sequence
+       ends. Each object holds a reference. */
+    JSObjectList kept_objects;
 
     JSModuleNormalizeFunc *module_normalize_func;
     JSModuleLoaderFunc *module_loader_func;
@@ -291,12 +428,20 @@ struct JSRuntime {
     /* used to allocate, free and clone SharedArrayBuffers */
     JSSharedArrayBufferFunctions sab_funcs;
     
+    /* random seed of the atom, shape and Map hashes */
+    uint64_t hash_seed;
     /* Shape hash table */
     int shape_hash_bits;
     int shape_hash_size;
     int shape_hash_count; /* number of hashed shapes */
     JSShape **shape_hash;
+    /* instanceof cache. The entries are valid only if their epoch is
+       the current one. */
+    uint32_t instanceof_cache_epoch;
+    JSInstanceofCacheEntry instanceof_cache[JS_INSTANCEOF_CACHE_SIZE];
 #ifdef CONFIG_BIGNUM
+    JSOperatorSetCacheEntry operator_set_cache[JS_OPERATOR_SET_CACHE_SIZE];
+    JSOperatorCacheEntry operator_cache[JS_OPERATOR_CACHE_SIZE];
     bf_context_t bf_ctx;
     JSNumericOperations bigint_ops;
     JSNumericOperations bigfloat_ops;
@@ -316,6 +461,8 @@ struct JSClass {
     JSClassCall *call;
     /* pointers for exotic behavior, can be NULL if none are present */
     const JSClassExoticMethods *exotic;
+    JSClassSave *save;
+    JSClassRestore *restore;
 };
 
 #define JS_MODE_STRICT (1 << 0)
@@ -404,16 +551,22 @@ typedef enum {
     JS_AUTOINIT_ID_PROTOTYPE,
     JS_AUTOINIT_ID_MODULE_NS,
     JS_AUTOINIT_ID_PROP,
+    JS_AUTOINIT_ID_BOUND_FUNCTION_NAME,
 } JSAutoInitIDEnum;
 
 /* must be large enough to have a negligible runtime cost and small
    enough to call the interrupt callback often. */
 #define JS_INTERRUPT_COUNTER_INIT 10000
 
+/* JSRuntime.interrupt_request bits */
+#define JS_INTERRUPT_REQUEST_HANDLER  (1 << 0) /* call the interrupt handler */
+#define JS_INTERRUPT_REQUEST_CPU_TIME (1 << 1) /* CPU time limit exceeded */
+
 struct JSContext {
     JSGCObjectHeader header; /* must come first */
     JSRuntime *rt;
     struct list_head link;
+    int malloc_account; /* index in rt->mem_accounts */
 
     uint16_t binary_object_count;
     int binary_object_size;
@@ -435,6 +588,9 @@ struct JSContext {
 
     JSValue global_obj; /* global object */
     JSValue global_var_obj; /* contains the global let/const definitions */
+    /* global properties considered as built-in by JS_HibernateContext() */
+    JSAtom *hibernation_baseline;
+    int hibernation_baseline_count;
 
     uint64_t random_state;
 #ifdef CONFIG_BIGNUM
@@ -477,6 +633,14 @@ enum {
     JS_ATOM_HASH_PRIVATE,
 };
 
+/* For JS_ATOM_TYPE_SYMBOL atoms, the low bit of JSString.hash is
+   JS_ATOM_HASH_x. For private symbols, the other bits contain the
+   property index where the symbol was last found in an object shape,
+   which is used as a lookup hint (see find_private_property()). */
+#define JS_ATOM_HASH_KIND_MASK   1
+#define JS_ATOM_HASH_SLOT_SHIFT  1
+#define JS_ATOM_HASH_SLOT_MAX    ((1 << (30 - JS_ATOM_HASH_SLOT_SHIFT)) - 1)
+
 typedef enum {
     JS_ATOM_KIND_STRING,
     JS_ATOM_KIND_SYMBOL,
@@ -487,11 +651,11 @@ typedef enum {
 
 struct JSString {
     JSRefCountHeader header; /* must come first, 32-bit */
-    uint32_t len : 31;
+    uint32_t len : 30;
+    uint8_t is_slice : 1; /* characters are in a parent string, see JSStringSlice */
     uint8_t is_wide_char : 1; /* 0 = 8 bits, 1 = 16 bits characters */
     /* for JS_ATOM_TYPE_SYMBOL: hash = 0, atom_type = 3,
-       for JS_ATOM_TYPE_PRIVATE: hash = 1, atom_type = 3
-       XXX: could change encoding to have one more bit in hash */
+       for JS_ATOM_TYPE_PRIVATE: (hash & 1) = 1, atom_type = 3 */
     uint32_t hash : 30;
     uint8_t atom_type : 2; /* != 0 if atom, JS_ATOM_TYPE_x */
     uint32_t hash_next; /* atom_index for JS_ATOM_TYPE_SYMBOL */
@@ -504,6 +668,46 @@ struct JSString {
     } u;
 };
 
+/* A string slice references the characters of a flat parent string
+   instead of copying them. It is stored in the 'u' area of the
+   JSString. A slice is never an atom and has no null terminator. */
+typedef struct JSStringSlice {
+    JSString *parent; /* NULL for an external string */
+    void *ptr; /* first character in the parent */
+} JSStringSlice;
+
+/* string whose characters are owned by the embedder */
+typedef struct JSStringExternal {
+    JSStringSlice slice; /* slice.parent = NULL */
+    JSFreeStringDataFunc *free_func;
+    void *opaque;
+} JSStringExternal;
+
+/* minimum length of a sliced substring */
+#define JS_STRING_SLICE_MIN_LEN 16
+/* a sliced substring covers at least 1/JS_STRING_SLICE_MIN_RATIO of
+   its parent */
+#define JS_STRING_SLICE_MIN_RATIO 4
+
+static inline JSStringSlice *js_str_slice(const JSString *p)
+{
+    return (JSStringSlice *)p->u.str8;
+}
+
+static inline const uint8_t *js_str8(const JSString *p)
+{
+    if (unlikely(p->is_slice))
+        return js_str_slice(p)->ptr;
+    return p->u.str8;
+}
+
+static inline const uint16_t *js_str16(const JSString *p)
+{
+    if (unlikely(p->is_slice))
+        return js_str_slice(p)->ptr;
+    return p->u.str16;
+}
+
 typedef struct JSClosureVar {
     uint8_t is_local : 1;
     uint8_t is_arg : 1;
@@ -612,6 +816,11 @@ typedef struct JSFunctionBytecode {
 typedef struct JSBoundFunction {
     JSValue func_obj;
     JSValue this_val;
+    /* bound function whose target, 'this' and arguments were merged
+       into this one, JS_UNDEFINED otherwise */
+    JSValue inner_func_obj;
+    /* name of the target until the 'name' property is instantiated */
+    JSValue name;
     int argc;
     JSValue argv[0];
 } JSBoundFunction;
@@ -634,11 +843,36 @@ typedef struct JSRegExp {
     JSString *bytecode; /* also contains the flags */
 } JSRegExp;
 
+typedef enum {
+    JS_PROXY_TRAP_getPrototypeOf,
+    JS_PROXY_TRAP_setPrototypeOf,
+    JS_PROXY_TRAP_isExtensible,
+    JS_PROXY_TRAP_preventExtensions,
+    JS_PROXY_TRAP_getOwnPropertyDescriptor,
+    JS_PROXY_TRAP_defineProperty,
+    JS_PROXY_TRAP_has,
+    JS_PROXY_TRAP_get,
+    JS_PROXY_TRAP_set,
+    JS_PROXY_TRAP_deleteProperty,
+    JS_PROXY_TRAP_ownKeys,
+    JS_PROXY_TRAP_apply,
+    JS_PROXY_TRAP_construct,
+    JS_PROXY_TRAP_COUNT,
+} JSProxyTrapEnum;
+
 typedef struct JSProxyData {
     JSValue target;
     JSValue handler;
     uint8_t is_func;
     uint8_t is_revoked;
+    /* trap lookup cache. It is valid as long as the handler and its
+       prototype keep the shapes 'handler_shape' and 'proto_shape'.
+       Holding a reference to these (hashed) shapes ensures that any
+       modification of the handler or of its prototype allocates a new
+       shape. */
+    JSShape *handler_shape; /* NULL if the cache is empty */
+    JSShape *proto_shape; /* NULL if the handler has no prototype */
+    uint32_t trap_cache[JS_PROXY_TRAP_COUNT]; /* JS_PROXY_TRAP_CACHE_x */
 } JSProxyData;
 
 typedef struct JSArrayBuffer {
@@ -839,6 +1073,10 @@ struct JSShape {
        <= n <= 2^31-1. If false, the shape is guaranteed not to have
        small array index properties */
     uint8_t has_small_array_index;
+#ifdef CONFIG_BIGNUM
+    /* true if the shape may be used in the operator caches */
+    uint8_t in_operator_cache;
+#endif
     uint32_t hash; /* current hash value */
     uint32_t prop_hash_mask;
     int prop_size; /* allocated properties */
@@ -849,6 +1087,35 @@ struct JSShape {
     JSShapeProperty prop[0]; /* prop_size elements */
 };
 
+typedef enum {
+    JS_WEAK_REF_KIND_MAP, /* WeakMap/WeakSet record */
+    JS_WEAK_REF_KIND_WEAK_REF, /* WeakRef object or JSWeakRef handle */
+    JS_WEAK_REF_KIND_FINREC_TARGET, /* FinalizationRegistry target */
+    JS_WEAK_REF_KIND_FINREC_TOKEN, /* FinalizationRegistry unregister token */
+} JSWeakRefKindEnum;
+
+/* embedded in the structures referencing an object weakly */
+typedef struct JSWeakRefHeader {
+    JSWeakRefKindEnum kind;
+    struct JSWeakRefHeader *next_weak_ref; /* in JSObject.first_weak_ref list */
+} JSWeakRefHeader;
+
+/* WeakRef object data, also exported as a weak handle in the C API */
+struct JSWeakRef {
+    JSWeakRefHeader header;
+    JSValue target; /* JS_UNDEFINED once the target is freed */
+};
+
+typedef struct JSFinRecEntry {
+    struct list_head link; /* in JSFinRecState.entries or dead_entries */
+    JSWeakRefHeader target_ref;
+    JSWeakRefHeader token_ref;
+    struct JSFinRecState *frs;
+    JSValue target; /* weak reference, JS_UNDEFINED once freed */
+    JSValue token; /* weak reference, JS_UNDEFINED if none or freed */
+    JSValue held_val;
+} JSFinRecEntry;
+
 struct JSObject {
     union {
         JSGCObjectHeader header;
@@ -863,6 +1130,7 @@ struct JSObject {
             uint8_t is_constructor : 1; /* TRUE if object is a constructor function */
             uint8_t is_uncatchable_error : 1; /* if TRUE, error is not catchable */
             uint8_t tmp_mark : 1; /* used in JS_WriteObjectRec() */
+            uint8_t in_instanceof_cache : 1; /* TRUE if used as key in JSRuntime.instanceof_cache */
             uint16_t class_id; /* see JS_CLASS_x */
         };
     };
@@ -870,7 +1138,7 @@ struct JSObject {
     JSShape *shape; /* prototype and property names + flag */
     JSProperty *prop; /* array of properties */
     /* byte offsets: 24/40 */
-    struct JSMapRecord *first_weak_ref; /* XXX: use a bit and an external hash table? */
+    JSWeakRefHeader *first_weak_ref; /* XXX: use a bit and an external hash table? */
     /* byte offsets: 28/48 */
     union {
         void *opaque;
@@ -894,6 +1162,8 @@ struct JSObject {
         struct JSAsyncFunctionData *async_function_data; /* JS_CLASS_ASYNC_FUNCTION_RESOLVE, JS_CLASS_ASYNC_FUNCTION_REJECT */
         struct JSAsyncFromSyncIteratorData *async_from_sync_iterator_data; /* JS_CLASS_ASYNC_FROM_SYNC_ITERATOR */
         struct JSAsyncGeneratorData *async_generator_data; /* JS_CLASS_ASYNC_GENERATOR */
+        struct JSWeakRef *weak_ref; /* JS_CLASS_WEAK_REF */
+        struct JSFinRecState *finrec_state; /* JS_CLASS_FINALIZATION_REGISTRY */
         struct { /* JS_CLASS_BYTECODE_FUNCTION: 12/24 bytes */
             /* also used by JS_CLASS_GENERATOR_FUNCTION, JS_CLASS_ASYNC_FUNCTION and JS_CLASS_ASYNC_GENERATOR_FUNCTION */
             struct JSFunctionBytecode *function_bytecode;
@@ -984,6 +1254,8 @@ static int JS_InitAtoms(JSRuntime *rt);
 static JSAtom __JS_NewAtomInit(JSRuntime *rt, const char *str, int len,
                                int atom_type);
 static void JS_FreeAtomStruct(JSRuntime *rt, JSAtomStruct *p);
+static inline BOOL js_atom_is_shared(JSAtom v);
+static uint64_t js_new_hash_seed(const void *ptr);
 static void free_function_bytecode(JSRuntime *rt, JSFunctionBytecode *b);
 static JSValue js_call_c_function(JSContext *ctx, JSValueConst func_obj,
                                   JSValueConst this_obj,
@@ -1125,6 +1397,7 @@ static inline bf_t *JS_GetBigInt(JSValueConst val)
 static JSValue JS_CompactBigInt1(JSContext *ctx, JSValue val,
                                  BOOL convert_to_safe_integer);
 static JSValue JS_CompactBigInt(JSContext *ctx, JSValue val);
+static void js_operator_cache_remove_shape(JSRuntime *rt, JSShape *sh);
 static int JS_ToBigInt64Free(JSContext *ctx, int64_t *pres, JSValue val);
 static bf_t *JS_ToBigInt(JSContext *ctx, bf_t *buf, JSValueConst val);
 static void JS_FreeBigInt(JSContext *ctx, bf_t *a, bf_t *buf);
@@ -1147,6 +1420,8 @@ static int JS_CreateProperty(JSContext *ctx, JSObject *p,
                              int flags);
 static int js_string_memcmp(const JSString *p1, const JSString *p2, int len);
 static void reset_weak_ref(JSRuntime *rt, JSObject *p);
+static void js_clear_kept_objects(JSRuntime *rt);
+static int js_finrec_queue_jobs(JSRuntime *rt, JSContext **pctx);
 static JSValue js_array_buffer_constructor3(JSContext *ctx,
                                             JSValueConst new_target,
                                             uint64_t len, JSClassID class_id,
@@ -1202,6 +1477,14 @@ static void js_free_desc(JSContext *ctx, JSPropertyDescriptor *desc);
 static void async_func_mark(JSRuntime *rt, JSAsyncFunctionState *s,
                             JS_MarkFunc *mark_func);
 static void JS_AddIntrinsicBasicObjects(JSContext *ctx);
+static void js_free_hibernation_baseline(JSContext *ctx);
+#define MAGIC_SET (1 << 0)
+#define MAGIC_WEAK (1 << 1)
+static JSValue js_map_constructor(JSContext *ctx, JSValueConst new_target,
+                                  int argc, JSValueConst *argv, int magic);
+static JSValue js_map_set(JSContext *ctx, JSValueConst this_val,
+                          int argc, JSValueConst *argv, int magic);
+static JSValue js_map_to_array(JSContext *ctx, JSValueConst obj);
 static void js_free_shape(JSRuntime *rt, JSShape *sh);
 static void js_free_shape_null(JSRuntime *rt, JSShape *sh);
 static int js_shape_prepare_update(JSContext *ctx, JSObject *p,
@@ -1234,6 +1517,8 @@ static int js_module_ns_autoinit(JSContext *ctx, JSObject *p, JSAtom atom,
                                  void *opaque);
 static int JS_InstantiateFunctionListItem(JSContext *ctx, JSObject *p,
                                           JSAtom atom, void *opaque);
+static int js_bound_function_name_autoinit(JSContext *ctx, JSObject *p,
+                                           JSAtom atom, void *opaque);
 void JS_SetUncatchableError(JSContext *ctx, JSValueConst val, BOOL flag);
 
 static const JSClassExoticMethods js_arguments_exotic_methods;
@@ -1241,15 +1526,26 @@ static const JSClassExoticMethods js_string_exotic_methods;
 static const JSClassExoticMethods js_proxy_exotic_methods;
 static const JSClassExoticMethods js_module_ns_exotic_methods;
 static JSClassID js_class_id_alloc = JS_CLASS_INIT_COUNT;
+static const JSMallocFunctions def_malloc_funcs;
+#ifdef CONFIG_BACKGROUND_FREE
+static void js_bg_free(JSRuntime *rt, void *ptr);
+static void js_bg_free_flush(JSRuntime *rt, BOOL to_thread);
+#endif
 
-static void js_trigger_gc(JSRuntime *rt, size_t size)
+static void js_trigger_gc(JSContext *ctx, size_t size)
 {
+    JSRuntime *rt = ctx->rt;
     BOOL force_gc;
 #ifdef FORCE_GC_AT_MALLOC
     force_gc = TRUE;
 #else
     force_gc = ((rt->malloc_state.malloc_size + size) >
                 rt->malloc_gc_threshold);
+    if (rt->mem_accounts && !force_gc) {
+        /* collect before the context reaches its soft limit */
+        JSMemoryAccount *a = &rt->mem_accounts[ctx->malloc_account];
+        force_gc = (a->malloc_size + size > a->soft_limit);
+    }
 #endif
     if (force_gc) {
 #ifdef DUMP_GC
@@ -1267,23 +1563,260 @@ static size_t js_malloc_usable_size_unknown(const void *ptr)
     return 0;
 }
 
+/* With per-context accounting, each block is preceded by a header
+   word containing the index of the charged account (high 16 bits), an
+   arena flag and the requested size. The blocks allocated with
+   malloc() reserve JS_MEM_HEADER_SIZE bytes so that the data keeps the
+   alignment of malloc(). The arena blocks only reserve the header word
+   and are aligned on JS_MEM_ARENA_ALIGN bytes. */
+#define JS_MEM_HEADER_SIZE      16
+#define JS_MEM_ARENA_HEADER_SIZE 8
+#define JS_MEM_ACCOUNT_SHIFT    48
+#define JS_MEM_ARENA            ((uint64_t)1 << 47)
+#define JS_MEM_SIZE_MASK        (JS_MEM_ARENA - 1)
+#define JS_MEM_ACCOUNT_MAX      0xffff
+#define JS_MEM_ARENA_ALIGN      16
+#define JS_MEM_ARENA_CHUNK_SIZE (256 * 1024)
+
+static inline void js_free_block(JSRuntime *rt, void *ptr)
+{
+#ifdef CONFIG_BACKGROUND_FREE
+    if (unlikely(rt->bg_free)) {
+        js_bg_free(rt, ptr);
+        return;
+    }
+#endif
+    rt->mf.js_free(&rt->malloc_state, ptr);
+}
+
+/* size taken by an arena block of 'size' bytes, including its header */
+static inline size_t js_arena_block_size(size_t size)
+{
+    return (size + JS_MEM_ARENA_HEADER_SIZE + JS_MEM_ARENA_ALIGN - 1) &
+        ~(size_t)(JS_MEM_ARENA_ALIGN - 1);
+}
+
+static void js_free_arena_chunks(JSRuntime *rt, JSMemoryAccount *a)
+{
+    JSArenaChunk *c, *c_next;
+    for(c = a->arena_chunks; c != NULL; c = c_next) {
+        c_next = c->next;
+        js_free_block(rt, c);
+        a->malloc_size -= sizeof(JSArenaChunk) + a->arena_chunk_size;
+    }
+    a->arena_chunks = NULL;
+    a->arena_ptr = NULL;
+    a->arena_end = NULL;
+}
+
+static void js_release_memory_account(JSRuntime *rt, int idx)
+{
+    JSMemoryAccount *a = &rt->mem_accounts[idx];
+    js_free_arena_chunks(rt, a);
+    a->next_free = rt->mem_account_free_index;
+    rt->mem_account_free_index = idx;
+    if (rt->malloc_account == idx)
+        rt->malloc_account = 0;
+}
+
+/* return the block header */
+static uint64_t *js_arena_alloc(JSRuntime *rt, JSMemoryAccount *a,
+                                size_t size)
+{
+    JSArenaChunk *c;
+    uint64_t *hdr;
+    size_t block_size;
+
+    block_size = js_arena_block_size(size);
+    if (unlikely(a->arena_ptr + block_size > a->arena_end)) {
+        /* the rest of the current chunk is lost */
+        if (a->malloc_size + sizeof(JSArenaChunk) + a->arena_chunk_size >
+            a->hard_limit)
+            return NULL;
+        c = rt->mf.js_malloc(&rt->malloc_state,
+                             sizeof(JSArenaChunk) + a->arena_chunk_size);
+        if (!c)
+            return NULL;
+        a->malloc_size += sizeof(JSArenaChunk) + a->arena_chunk_size;
+        c->next = a->arena_chunks;
+        a->arena_chunks = c;
+        /* the header is just before an aligned address */
+        a->arena_ptr = (uint8_t *)(c + 1) + JS_MEM_ARENA_ALIGN -
+            JS_MEM_ARENA_HEADER_SIZE;
+        a->arena_end = (uint8_t *)(c + 1) + a->arena_chunk_size;
+    }
+    hdr = (uint64_t *)a->arena_ptr;
+    a->arena_ptr += block_size;
+    return hdr;
+}
+
+static void *js_account_malloc2(JSRuntime *rt, int idx, size_t size)
+{
+    JSMemoryAccount *a;
+    uint64_t *hdr, flags;
+    uint8_t *base;
+
+    a = &rt->mem_accounts[idx];
+    if (unlikely(size > JS_MEM_SIZE_MASK - JS_MEM_ARENA_ALIGN))
+        return NULL;
+    if (a->arena_chunk_size != 0 && size <= a->arena_chunk_size / 4) {
+        hdr = js_arena_alloc(rt, a, size);
+        if (!hdr)
+            return NULL;
+        flags = JS_MEM_ARENA;
+    } else {
+        if (a->malloc_size + size + JS_MEM_HEADER_SIZE > a->hard_limit)
+            return NULL;
+        base = rt->mf.js_malloc(&rt->malloc_state, size + JS_MEM_HEADER_SIZE);
+        if (!base)
+            return NULL;
+        hdr = (uint64_t *)(base + JS_MEM_HEADER_SIZE) - 1;
+        a->malloc_size += size + JS_MEM_HEADER_SIZE;
+        flags = 0;
+    }
+    *hdr = ((uint64_t)idx << JS_MEM_ACCOUNT_SHIFT) | flags | size;
+    a->malloc_count++;
+    return hdr + 1;
+}
+
+/* the account selected by js_malloc_account() only applies to the
+   next allocation. The other allocations are charged to the runtime
+   account. */
+static no_inline void *js_account_malloc(JSRuntime *rt, size_t size)
+{
+    int idx = rt->malloc_account;
+    rt->malloc_account = 0;
+    return js_account_malloc2(rt, idx, size);
+}
+
+static no_inline void js_account_free(JSRuntime *rt, void *ptr)
+{
+    JSMemoryAccount *a;
+    uint64_t *hdr;
+    size_t size;
+    int idx;
+
+    if (!ptr)
+        return;
+    hdr = (uint64_t *)ptr - 1;
+    idx = *hdr >> JS_MEM_ACCOUNT_SHIFT;
+    size = *hdr & JS_MEM_SIZE_MASK;
+    a = &rt->mem_accounts[idx];
+    a->malloc_count--;
+    if (*hdr & JS_MEM_ARENA) {
+        /* the memory is reclaimed with the arena, except for the
+           last allocated block */
+        if ((uint8_t *)hdr + js_arena_block_size(size) == a->arena_ptr)
+            a->arena_ptr = (uint8_t *)hdr;
+    } else {
+        a->malloc_size -= size + JS_MEM_HEADER_SIZE;
+        js_free_block(rt, (uint8_t *)ptr - JS_MEM_HEADER_SIZE);
+    }
+    if (a->malloc_count == 0 && !a->in_use && idx != 0)
+        js_release_memory_account(rt, idx);
+}
+
+static no_inline void *js_account_realloc(JSRuntime *rt, void *ptr,
+                                          size_t size)
+{
+    JSMemoryAccount *a;
+    uint64_t *hdr;
+    size_t old_size;
+    void *new_ptr;
+    uint8_t *base;
+    int idx;
+
+    if (!ptr) {
+        if (size == 0)
+            return NULL;
+        return js_account_malloc(rt, size);
+    }
+    rt->malloc_account = 0;
+    if (size == 0) {
+        js_account_free(rt, ptr);
+        return NULL;
+    }
+    /* the block stays charged to its account */
+    hdr = (uint64_t *)ptr - 1;
+    idx = *hdr >> JS_MEM_ACCOUNT_SHIFT;
+    old_size = *hdr & JS_MEM_SIZE_MASK;
+    a = &rt->mem_accounts[idx];
+    if (unlikely(size > JS_MEM_SIZE_MASK - JS_MEM_ARENA_ALIGN))
+        return NULL;
+    if (*hdr & JS_MEM_ARENA) {
+        uint8_t *block_end = (uint8_t *)hdr + js_arena_block_size(old_size);
+        if (js_arena_block_size(size) <= js_arena_block_size(old_size) ||
+            (block_end == a->arena_ptr &&
+             (uint8_t *)hdr + js_arena_block_size(size) <= a->arena_end &&
+             size <= a->arena_chunk_size / 4)) {
+            /* resize in place */
+            if (block_end == a->arena_ptr)
+                a->arena_ptr = (uint8_t *)hdr + js_arena_block_size(size);
+            *hdr = (*hdr & ~JS_MEM_SIZE_MASK) | size;
+            return hdr + 1;
+        }
+        new_ptr = js_account_malloc2(rt, idx, size);
+        if (!new_ptr)
+            return NULL;
+        /* the slack space of the block may be used */
+        old_size = js_arena_block_size(old_size) - JS_MEM_ARENA_HEADER_SIZE;
+        memcpy(new_ptr, ptr, min_int(old_size, size));
+        js_account_free(rt, ptr);
+        return new_ptr;
+    }
+    if (size > old_size && a->malloc_size + size - old_size > a->hard_limit)
+        return NULL;
+    base = rt->mf.js_realloc(&rt->malloc_state,
+                             (uint8_t *)ptr - JS_MEM_HEADER_SIZE,
+                             size + JS_MEM_HEADER_SIZE);
+    if (!base)
+        return NULL;
+    hdr = (uint64_t *)(base + JS_MEM_HEADER_SIZE) - 1;
+    *hdr = (*hdr & ~JS_MEM_SIZE_MASK) | size;
+    a->malloc_size += (int64_t)size - (int64_t)old_size;
+    return hdr + 1;
+}
+
 void *js_malloc_rt(JSRuntime *rt, size_t size)
 {
+    if (unlikely(rt->mem_accounts))
+        return js_account_malloc(rt, size);
     return rt->mf.js_malloc(&rt->malloc_state, size);
 }
 
 void js_free_rt(JSRuntime *rt, void *ptr)
 {
-    rt->mf.js_free(&rt->malloc_state, ptr);
+    if (unlikely(rt->mem_accounts)) {
+        js_account_free(rt, ptr);
+        return;
+    }
+    js_free_block(rt, ptr);
 }
 
 void *js_realloc_rt(JSRuntime *rt, void *ptr, size_t size)
 {
+    if (unlikely(rt->mem_accounts))
+        return js_account_realloc(rt, ptr, size);
     return rt->mf.js_realloc(&rt->malloc_state, ptr, size);
 }
 
+static inline BOOL js_is_arena_block(JSRuntime *rt, const void *ptr)
+{
+    return rt->mem_accounts && (((const uint64_t *)ptr)[-1] & JS_MEM_ARENA);
+}
+
 size_t js_malloc_usable_size_rt(JSRuntime *rt, const void *ptr)
 {
+    size_t size;
+    if (unlikely(rt->mem_accounts)) {
+        const uint64_t *hdr = (const uint64_t *)ptr - 1;
+        if (*hdr & JS_MEM_ARENA)
+            return js_arena_block_size(*hdr & JS_MEM_SIZE_MASK) -
+                JS_MEM_ARENA_HEADER_SIZE;
+        size = rt->mf.js_malloc_usable_size((const uint8_t *)ptr -
+                                            JS_MEM_HEADER_SIZE);
+        return size ? size - JS_MEM_HEADER_SIZE : 0;
+    }
     return rt->mf.js_malloc_usable_size(ptr);
 }
 
@@ -1305,10 +1838,41 @@ static void *js_bf_realloc(void *opaque, void *ptr, size_t size)
 }
 #endif /* CONFIG_BIGNUM */
 
+/* Charge the next allocation to 'ctx'. Return FALSE if allocating
+   'size' more bytes would exceed its soft memory limit. The limit is
+   not checked while throwing the out of memory error so that it can
+   be allocated. */
+static inline BOOL js_malloc_account(JSContext *ctx, size_t size)
+{
+    JSRuntime *rt = ctx->rt;
+    JSMemoryAccount *a;
+
+    if (likely(!rt->mem_accounts))
+        return TRUE;
+    a = &rt->mem_accounts[ctx->malloc_account];
+    if (a->malloc_size + size > a->soft_limit && !rt->in_out_of_memory)
+        return FALSE;
+    rt->malloc_account = ctx->malloc_account;
+    return TRUE;
+}
+
+static inline BOOL js_realloc_account(JSContext *ctx, void *ptr, size_t size)
+{
+    size_t old_size;
+    if (likely(!ctx->rt->mem_accounts))
+        return TRUE;
+    old_size = ptr ? ((uint64_t *)ptr)[-1] & JS_MEM_SIZE_MASK : 0;
+    return js_malloc_account(ctx, size > old_size ? size - old_size : 0);
+}
+
 /* Throw out of memory in case of error */
 void *js_malloc(JSContext *ctx, size_t size)
 {
     void *ptr;
+    if (unlikely(!js_malloc_account(ctx, size))) {
+        JS_ThrowOutOfMemory(ctx);
+        return NULL;
+    }
     ptr = js_malloc_rt(ctx->rt, size);
     if (unlikely(!ptr)) {
         JS_ThrowOutOfMemory(ctx);
@@ -1321,6 +1885,10 @@ void *js_malloc(JSContext *ctx, size_t size)
 void *js_mallocz(JSContext *ctx, size_t size)
 {
     void *ptr;
+    if (unlikely(!js_malloc_account(ctx, size))) {
+        JS_ThrowOutOfMemory(ctx);
+        return NULL;
+    }
     ptr = js_mallocz_rt(ctx->rt, size);
     if (unlikely(!ptr)) {
         JS_ThrowOutOfMemory(ctx);
@@ -1329,6 +1897,26 @@ void *js_mallocz(JSContext *ctx, size_t size)
     return ptr;
 }
 
+/* Allocate a block which can be shared with the other contexts, such
+   as a shape. In an arena context, it is charged to the runtime
+   account so that it does not keep the arena alive. Throw out of
+   memory in case of error. */
+static void *js_malloc_shared(JSContext *ctx, size_t size)
+{
+    JSRuntime *rt = ctx->rt;
+    void *ptr;
+
+    if (likely(!rt->mem_accounts) ||
+        rt->mem_accounts[ctx->malloc_account].arena_chunk_size == 0)
+        return js_malloc(ctx, size);
+    ptr = js_malloc_rt(rt, size);
+    if (unlikely(!ptr)) {
+        JS_ThrowOutOfMemory(ctx);
+        return NULL;
+    }
+    return ptr;
+}
+
 void js_free(JSContext *ctx, void *ptr)
 {
     js_free_rt(ctx->rt, ptr);
@@ -1338,6 +1926,10 @@ void js_free(JSContext *ctx, void *ptr)
 void *js_realloc(JSContext *ctx, void *ptr, size_t size)
 {
     void *ret;
+    if (unlikely(!js_realloc_account(ctx, ptr, size))) {
+        JS_ThrowOutOfMemory(ctx);
+        return NULL;
+    }
     ret = js_realloc_rt(ctx->rt, ptr, size);
     if (unlikely(!ret && size != 0)) {
         JS_ThrowOutOfMemory(ctx);
@@ -1350,6 +1942,10 @@ void *js_realloc(JSContext *ctx, void *ptr, size_t size)
 void *js_realloc2(JSContext *ctx, void *ptr, size_t size, size_t *pslack)
 {
     void *ret;
+    if (unlikely(!js_realloc_account(ctx, ptr, size))) {
+        JS_ThrowOutOfMemory(ctx);
+        return NULL;
+    }
     ret = js_realloc_rt(ctx->rt, ptr, size);
     if (unlikely(!ret && size != 0)) {
         JS_ThrowOutOfMemory(ctx);
@@ -1582,10 +2178,19 @@ static inline BOOL js_check_stack_overflow(JSRuntime *rt, size_t alloca_size)
 #endif
 
 JSRuntime *JS_NewRuntime2(const JSMallocFunctions *mf, void *opaque)
+{
+    return JS_NewRuntime3(mf, opaque, 0);
+}
+
+JSRuntime *JS_NewRuntime3(const JSMallocFunctions *mf, void *opaque,
+                          int flags)
 {
     JSRuntime *rt;
     JSMallocState ms;
 
+    if (!mf)
+        mf = &def_malloc_funcs;
+
     memset(&ms, 0, sizeof(ms));
     ms.opaque = opaque;
     ms.malloc_limit = -1;
@@ -1601,6 +2206,21 @@ JSRuntime *JS_NewRuntime2(const JSMallocFunctions *mf, void *opaque)
     }
     rt->malloc_state = ms;
     rt->malloc_gc_threshold = 256 * 1024;
+    if (flags & JS_RUNTIME_CONTEXT_MEMORY) {
+        JSMemoryAccount *a;
+        a = rt->mf.js_malloc(&rt->malloc_state, sizeof(*a));
+        if (!a) {
+            rt->mf.js_free(&rt->malloc_state, rt);
+            return NULL;
+        }
+        memset(a, 0, sizeof(*a));
+        a->soft_limit = -1;
+        a->hard_limit = -1;
+        a->in_use = TRUE;
+        rt->mem_accounts = a;
+        rt->mem_account_count = 1;
+    }
+    rt->instanceof_cache_epoch = 1;
 
 #ifdef CONFIG_BIGNUM
     bf_context_init(&rt->bf_ctx, js_bf_realloc, rt);
@@ -1618,7 +2238,9 @@ JSRuntime *JS_NewRuntime2(const JSMallocFunctions *mf, void *opaque)
     init_list_head(&rt->string_list);
 #endif
     init_list_head(&rt->job_list);
+    init_list_head(&rt->finrec_pending_list);
 
+    rt->hash_seed = js_new_hash_seed(rt);
     if (JS_InitAtoms(rt))
         goto fail;
 
@@ -1758,12 +2380,355 @@ void JS_SetMemoryLimit(JSRuntime *rt, size_t limit)
     rt->malloc_state.malloc_limit = limit;
 }
 
+/* Above 'soft_limit', a GC is forced and the allocations made by the
+   context throw an out of memory error. 'hard_limit' bounds all the
+   allocations charged to the context, including the ones needed to
+   throw the error. Use -1 to disable a limit. Return -1 if the
+   runtime was not created with JS_RUNTIME_CONTEXT_MEMORY. */
+int JS_SetContextMemoryLimit(JSContext *ctx, size_t soft_limit,
+                             size_t hard_limit)
+{
+    JSMemoryAccount *a;
+    if (!ctx->rt->mem_accounts || ctx->malloc_account == 0)
+        return -1;
+    a = &ctx->rt->mem_accounts[ctx->malloc_account];
+    a->soft_limit = soft_limit < hard_limit ? soft_limit : hard_limit;
+    a->hard_limit = hard_limit;
+    return 0;
+}
+
+/* Return the number of bytes currently allocated on behalf of the
+   context (for an arena context, its chunks are counted instead of
+   its small blocks) or -1 if the runtime was not created with
+   JS_RUNTIME_CONTEXT_MEMORY. */
+int64_t JS_GetContextMemoryUsage(JSContext *ctx)
+{
+    if (!ctx->rt->mem_accounts)
+        return -1;
+    return ctx->rt->mem_accounts[ctx->malloc_account].malloc_size;
+}
+
 /* use -1 to disable automatic GC */
 void JS_SetGCThreshold(JSRuntime *rt, size_t gc_threshold)
 {
     rt->malloc_gc_threshold = gc_threshold;
 }
 
+#ifdef CONFIG_BACKGROUND_FREE
+
+#define JS_FREE_BATCH_SIZE   4096
+/* smaller batches are freed by the JS thread */
+#define JS_FREE_INLINE_MAX   256
+/* larger blocks are always freed in the background */
+#define JS_FREE_LARGE_SIZE   (256 * 1024)
+
+typedef struct JSFreeBatch {
+    struct JSFreeBatch *next;
+    int count;
+    BOOL has_large_block;
+    void *ptrs[JS_FREE_BATCH_SIZE];
+} JSFreeBatch;
+
+typedef struct JSBackgroundFree {
+    pthread_mutex_t mutex;
+    pthread_cond_t cond;
+    pthread_t thread;
+    BOOL thread_started;
+    /* protected by mutex */
+    BOOL stop;
+    JSFreeBatch *pending;
+    /* batch filled by the JS thread */
+    JSFreeBatch *cur;
+} JSBackgroundFree;
+
+static void *js_bg_free_thread(void *opaque)
+{
+    JSBackgroundFree *bf = opaque;
+    JSFreeBatch *b, *b_next;
+    int i;
+
+#if defined(__linux__) && defined(SCHED_IDLE)
+    {
+        /* only use otherwise idle CPU time */
+        struct sched_param param;
+        memset(&param, 0, sizeof(param));
+        pthread_setschedparam(pthread_self(), SCHED_IDLE, &param);
+    }
+#endif
+    for(;;) {
+        pthread_mutex_lock(&bf->mutex);
+        while (!bf->pending && !bf->stop)
+            pthread_cond_wait(&bf->cond, &bf->mutex);
+        b = bf->pending;
+        bf->pending = NULL;
+        pthread_mutex_unlock(&bf->mutex);
+        if (!b)
+            break;
+        for(; b != NULL; b = b_next) {
+            b_next = b->next;
+            for(i = 0; i < b->count; i++)
+                free(b->ptrs[i]);
+            free(b);
+        }
+    }
+    return NULL;
+}
+
+static void js_free_batch_inline(JSFreeBatch *b)
+{
+    int i;
+    for(i = 0; i < b->count; i++)
+        free(b->ptrs[i]);
+    b->count = 0;
+    b->has_large_block = FALSE;
+}
+
+/* Free the blocks queued by the JS thread. Small batches are freed
+   directly unless 'to_thread' is TRUE. */
+static void js_bg_free_flush(JSRuntime *rt, BOOL to_thread)
+{
+    JSBackgroundFree *bf = rt->bg_free;
+    JSFreeBatch *b = bf->cur;
+
+    if (!b || b->count == 0)
+        return;
+    if (!to_thread && b->count <= JS_FREE_INLINE_MAX &&
+        !b->has_large_block) {
+        js_free_batch_inline(b);
+        return;
+    }
+    if (!bf->thread_started) {
+        if (pthread_create(&bf->thread, NULL, js_bg_free_thread, bf) != 0) {
+            js_free_batch_inline(b);
+            return;
+        }
+        bf->thread_started = TRUE;
+    }
+    pthread_mutex_lock(&bf->mutex);
+    b->next = bf->pending;
+    bf->pending = b;
+    pthread_cond_signal(&bf->cond);
+    pthread_mutex_unlock(&bf->mutex);
+    bf->cur = NULL;
+}
+
+/* Queue a block allocated by js_def_malloc(). The accounting is done
+   now so that JSMallocState stays exact. The blocks are only queued
+   while freeing object graphs or if they are large. */
+static void js_bg_free(JSRuntime *rt, void *ptr)
+{
+    JSBackgroundFree *bf = rt->bg_free;
+    JSMallocState *s = &rt->malloc_state;
+    size_t size;
+
+    if (!ptr)
+        return;
+    size = js_def_malloc_usable_size(ptr);
+    if (rt->gc_phase == JS_GC_PHASE_NONE && size < JS_FREE_LARGE_SIZE) {
+        js_def_free(s, ptr);
+        return;
+    }
+    s->malloc_count--;
+    s->malloc_size -= size + MALLOC_OVERHEAD;
+    if (!bf->cur) {
+        bf->cur = malloc(sizeof(JSFreeBatch));
+        if (!bf->cur) {
+            free(ptr);
+            return;
+        }
+        bf->cur->count = 0;
+        bf->cur->has_large_block = FALSE;
+    }
+    bf->cur->ptrs[bf->cur->count++] = ptr;
+    if (size >= JS_FREE_LARGE_SIZE)
+        bf->cur->has_large_block = TRUE;
+    if (bf->cur->count == JS_FREE_BATCH_SIZE ||
+        rt->gc_phase == JS_GC_PHASE_NONE)
+        js_bg_free_flush(rt, TRUE);
+}
+
+#endif /* CONFIG_BACKGROUND_FREE */
+
+/* When enabled, the memory of large object graphs and large blocks
+   (ArrayBuffer data, long strings) is released by a background thread
+   so that dropping a big structure does not stall the JS thread. The
+   finalizers still run in the JS thread. Only supported with the
+   default allocator. Return -1 if not supported. */
+int JS_SetBackgroundFree(JSRuntime *rt, BOOL enable)
+{
+#ifdef CONFIG_BACKGROUND_FREE
+    JSBackgroundFree *bf = rt->bg_free;
+
+    if (enable) {
+        if (rt->mf.js_free != js_def_free)
+            return -1;
+        if (bf)
+            return 0;
+        bf = malloc(sizeof(*bf));
+        if (!bf)
+            return -1;
+        memset(bf, 0, sizeof(*bf));
+        pthread_mutex_init(&bf->mutex, NULL);
+        pthread_cond_init(&bf->cond, NULL);
+        rt->bg_free = bf;
+    } else if (bf) {
+        js_bg_free_flush(rt, FALSE);
+        if (bf->thread_started) {
+            pthread_mutex_lock(&bf->mutex);
+            bf->stop = TRUE;
+            pthread_cond_signal(&bf->cond);
+            pthread_mutex_unlock(&bf->mutex);
+            pthread_join(bf->thread, NULL);
+        }
+        free(bf->cur);
+        pthread_mutex_destroy(&bf->mutex);
+        pthread_cond_destroy(&bf->cond);
+        free(bf);
+        rt->bg_free = NULL;
+    }
+    return 0;
+#else
+    return enable ? -1 : 0;
+#endif
+}
+
+#ifdef CONFIG_CPU_TIME_LIMIT
+
+typedef struct JSCPUTimer {
+    JSRuntime *rt;
+    pthread_mutex_t mutex;
+    pthread_cond_t cond; /* signaled when the limit changes */
+    pthread_t thread;
+    /* protected by mutex */
+    BOOL stop;
+    clockid_t clock_id; /* CPU time clock of the thread running JS */
+    int64_t deadline; /* in ns of clock_id, 0 = no limit */
+} JSCPUTimer;
+
+/* return -1 if the clock is no longer valid */
+static int64_t js_clock_ns(clockid_t clock_id)
+{
+    struct timespec ts;
+    if (clock_gettime(clock_id, &ts))
+        return -1;
+    return (int64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+/* The thread sleeps until the deadline would be reached if the JS
+   thread used all the CPU time, then checks its actual CPU time. */
+static void *js_cpu_timer_thread(void *opaque)
+{
+    JSCPUTimer *t = opaque;
+    struct timespec ts;
+    int64_t now, wake;
+
+    pthread_mutex_lock(&t->mutex);
+    while (!t->stop) {
+        if (t->deadline == 0) {
+            pthread_cond_wait(&t->cond, &t->mutex);
+            continue;
+        }
+        now = js_clock_ns(t->clock_id);
+        if (now < 0 || now >= t->deadline) {
+            if (now >= 0) {
+                atomic_fetch_or(&t->rt->interrupt_request,
+                                JS_INTERRUPT_REQUEST_CPU_TIME);
+            }
+            t->deadline = 0;
+            continue;
+        }
+        wake = js_clock_ns(CLOCK_MONOTONIC) + (t->deadline - now);
+        ts.tv_sec = wake / 1000000000;
+        ts.tv_nsec = wake % 1000000000;
+        pthread_cond_timedwait(&t->cond, &t->mutex, &ts);
+    }
+    pthread_mutex_unlock(&t->mutex);
+    return NULL;
+}
+
+static JSCPUTimer *js_cpu_timer_new(JSRuntime *rt)
+{
+    JSCPUTimer *t;
+    pthread_condattr_t attr;
+
+    t = malloc(sizeof(*t));
+    if (!t)
+        return NULL;
+    memset(t, 0, sizeof(*t));
+    t->rt = rt;
+    pthread_mutex_init(&t->mutex, NULL);
+    pthread_condattr_init(&attr);
+    pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+    pthread_cond_init(&t->cond, &attr);
+    pthread_condattr_destroy(&attr);
+    if (pthread_create(&t->thread, NULL, js_cpu_timer_thread, t) != 0) {
+        pthread_cond_destroy(&t->cond);
+        pthread_mutex_destroy(&t->mutex);
+        free(t);
+        return NULL;
+    }
+    return t;
+}
+
+static void js_cpu_timer_free(JSCPUTimer *t)
+{
+    pthread_mutex_lock(&t->mutex);
+    t->stop = TRUE;
+    pthread_cond_signal(&t->cond);
+    pthread_mutex_unlock(&t->mutex);
+    pthread_join(t->thread, NULL);
+    pthread_cond_destroy(&t->cond);
+    pthread_mutex_destroy(&t->mutex);
+    free(t);
+}
+
+#endif /* CONFIG_CPU_TIME_LIMIT */
+
+/* Interrupt the running scripts once the calling thread has used
+   'usec' microseconds of CPU time from now. The JS code is then
+   terminated with an uncatchable error at its next interrupt check
+   until the limit is set again. A timer thread is used so that the
+   JS thread never reads a clock. 'usec' <= 0 removes the
+   limit. Return -1 if not supported. */
+int JS_SetCPUTimeLimit(JSRuntime *rt, int64_t usec)
+{
+#ifdef CONFIG_CPU_TIME_LIMIT
+    JSCPUTimer *t = rt->cpu_timer;
+    clockid_t clock_id;
+    int64_t now;
+
+    if (usec > 0) {
+        if (pthread_getcpuclockid(pthread_self(), &clock_id))
+            return -1;
+        now = js_clock_ns(clock_id);
+        if (now < 0)
+            return -1;
+        if (!t) {
+            t = js_cpu_timer_new(rt);
+            if (!t)
+                return -1;
+            rt->cpu_timer = t;
+        }
+    }
+    if (t) {
+        pthread_mutex_lock(&t->mutex);
+        atomic_fetch_and(&rt->interrupt_request,
+                         ~JS_INTERRUPT_REQUEST_CPU_TIME);
+        if (usec > 0) {
+            t->clock_id = clock_id;
+            t->deadline = now + usec * 1000;
+        } else {
+            t->deadline = 0;
+        }
+        pthread_cond_signal(&t->cond);
+        pthread_mutex_unlock(&t->mutex);
+    }
+    return 0;
+#else
+    return usec > 0 ? -1 : 0;
+#endif
+}
+
 #define malloc(s) malloc_is_forbidden(s)
 #define free(p) free_is_forbidden(p)
 #define realloc(p,s) realloc_is_forbidden(p,s)
@@ -1774,6 +2739,18 @@ void JS_SetInterruptHandler(JSRuntime *rt, JSInterruptHandler *cb, void *opaque)
     rt->interrupt_opaque = opaque;
 }
 
+/* Can be called from any thread or from a signal handler: the
+   interrupt handler is called at the next interrupt check instead of
+   waiting for the interrupt counter to expire. */
+void JS_RequestInterrupt(JSRuntime *rt)
+{
+#ifdef CONFIG_ATOMICS
+    atomic_fetch_or(&rt->interrupt_request, JS_INTERRUPT_REQUEST_HANDLER);
+#else
+    rt->interrupt_request |= JS_INTERRUPT_REQUEST_HANDLER;
+#endif
+}
+
 void JS_SetCanBlock(JSRuntime *rt, BOOL can_block)
 {
     rt->can_block = can_block;
@@ -1808,7 +2785,8 @@ int JS_EnqueueJob(JSContext *ctx, JSJobFunc *job_func,
 
 BOOL JS_IsJobPending(JSRuntime *rt)
 {
-    return !list_empty(&rt->job_list);
+    return !list_empty(&rt->job_list) ||
+        !list_empty(&rt->finrec_pending_list);
 }
 
 /* return < 0 if exception, 0 if no job pending, 1 if a job was
@@ -1821,8 +2799,15 @@ int JS_ExecutePendingJob(JSRuntime *rt, JSContext **pctx)
     int i, ret;
 
     if (list_empty(&rt->job_list)) {
-        *pctx = NULL;
-        return 0;
+        /* end of the job sequence: release the objects kept alive by
+           WeakRef and queue the FinalizationRegistry cleanups */
+        js_clear_kept_objects(rt);
+        if (js_finrec_queue_jobs(rt, pctx) < 0)
+            return -1;
+        if (list_empty(&rt->job_list)) {
+            *pctx = NULL;
+            return 0;
+        }
     }
 
     /* get the first pending job and execute it */
@@ -1865,6 +2850,7 @@ static JSString *js_alloc_string_rt(JSRuntime *rt, int max_len, int is_wide_char
     if (unlikely(!str))
         return NULL;
     str->header.ref_count = 1;
+    str->is_slice = 0;
     str->is_wide_char = is_wide_char;
     str->len = max_len;
     str->atom_type = 0;
@@ -1879,6 +2865,11 @@ static JSString *js_alloc_string_rt(JSRuntime *rt, int max_len, int is_wide_char
 static JSString *js_alloc_string(JSContext *ctx, int max_len, int is_wide_char)
 {
     JSString *p;
+    if (unlikely(!js_malloc_account(ctx, sizeof(JSString) +
+                                    ((size_t)max_len << is_wide_char)))) {
+        JS_ThrowOutOfMemory(ctx);
+        return NULL;
+    }
     p = js_alloc_string_rt(ctx->rt, max_len, is_wide_char);
     if (unlikely(!p)) {
         JS_ThrowOutOfMemory(ctx);
@@ -1887,6 +2878,8 @@ static JSString *js_alloc_string(JSContext *ctx, int max_len, int is_wide_char)
     return p;
 }
 
+static void js_free_string_slice(JSRuntime *rt, JSString *p);
+
 /* same as JS_FreeValueRT() but faster */
 static inline void js_free_string(JSRuntime *rt, JSString *str)
 {
@@ -1894,6 +2887,8 @@ static inline void js_free_string(JSRuntime *rt, JSString *str)
         if (str->atom_type) {
             JS_FreeAtomStruct(rt, str);
         } else {
+            if (str->is_slice)
+                js_free_string_slice(rt, str);
 #ifdef DUMP_LEAKS
             list_del(&str->link);
 #endif
@@ -1902,6 +2897,21 @@ static inline void js_free_string(JSRuntime *rt, JSString *str)
     }
 }
 
+/* release the characters referenced by a slice or an external string */
+static void js_free_string_slice(JSRuntime *rt, JSString *p)
+{
+    JSStringSlice *sl = js_str_slice(p);
+    JSStringExternal *ext;
+
+    if (sl->parent) {
+        js_free_string(rt, sl->parent);
+    } else {
+        ext = (JSStringExternal *)sl;
+        if (ext->free_func)
+            ext->free_func(rt, ext->opaque, sl->ptr);
+    }
+}
+
 void JS_SetRuntimeInfo(JSRuntime *rt, const char *s)
 {
     if (rt)
@@ -1924,9 +2934,18 @@ void JS_FreeRuntime(JSRuntime *rt)
         js_free_rt(rt, e);
     }
     init_list_head(&rt->job_list);
+    js_clear_kept_objects(rt);
 
     JS_RunGC(rt);
 
+    if (rt->atom_init_values) {
+        for(i = 0; i < JS_ATOM_Private_brand; i++) {
+            if (rt->atom_init_values[i])
+                js_free_string(rt, rt->atom_init_values[i]);
+        }
+        js_free_rt(rt, rt->atom_init_values);
+    }
+
 #ifdef DUMP_LEAKS
     /* leaking objects */
     {
@@ -1988,7 +3007,7 @@ void JS_FreeRuntime(JSRuntime *rt)
 
         for(i = 0; i < rt->atom_size; i++) {
             JSAtomStruct *p = rt->atom_array[i];
-            if (!atom_is_free(p) /* && p->str*/) {
+            if (!atom_is_free(p) && !js_atom_is_shared(i)) {
                 if (i >= JS_ATOM_END || p->header.ref_count != 1) {
                     if (!header_done) {
                         header_done = TRUE;
@@ -2015,7 +3034,7 @@ void JS_FreeRuntime(JSRuntime *rt)
                         printf(")");
                         break;
                     case JS_ATOM_TYPE_SYMBOL:
-                        if (p->hash == JS_ATOM_HASH_SYMBOL) {
+                        if ((p->hash & JS_ATOM_HASH_KIND_MASK) == JS_ATOM_HASH_SYMBOL) {
                             printf("Symbol(");
                             JS_DumpString(rt, p);
                             printf(")");
@@ -2042,15 +3061,18 @@ void JS_FreeRuntime(JSRuntime *rt)
     /* free the atoms */
     for(i = 0; i < rt->atom_size; i++) {
         JSAtomStruct *p = rt->atom_array[i];
-        if (!atom_is_free(p)) {
+        if (!atom_is_free(p) && !js_atom_is_shared(i)) {
 #ifdef DUMP_LEAKS
             list_del(&p->link);
 #endif
-            js_free_rt(rt, p);
+            if (i >= JS_ATOM_END)
+                js_free_rt(rt, p);
         }
     }
+    js_free_rt(rt, rt->atom_init_buf);
     js_free_rt(rt, rt->atom_array);
     js_free_rt(rt, rt->atom_hash);
+    js_free_rt(rt, rt->atom_hash_old);
     js_free_rt(rt, rt->shape_hash);
 #ifdef DUMP_LEAKS
     if (!list_empty(&rt->string_list)) {
@@ -2092,26 +3114,77 @@ void JS_FreeRuntime(JSRuntime *rt)
     }
 #endif
 
+    JS_SetBackgroundFree(rt, FALSE);
+#ifdef CONFIG_CPU_TIME_LIMIT
+    if (rt->cpu_timer)
+        js_cpu_timer_free(rt->cpu_timer);
+#endif
     {
         JSMallocState ms = rt->malloc_state;
+        if (rt->mem_accounts)
+            rt->mf.js_free(&ms, rt->mem_accounts);
         rt->mf.js_free(&ms, rt);
     }
 }
 
-JSContext *JS_NewContextRaw(JSRuntime *rt)
+/* return the index of a new memory account or -1 if none is left */
+static int js_new_memory_account(JSRuntime *rt)
+{
+    JSMemoryAccount *a;
+    int idx;
+
+    idx = rt->mem_account_free_index;
+    if (idx != 0) {
+        rt->mem_account_free_index = rt->mem_accounts[idx].next_free;
+    } else {
+        if (rt->mem_account_count > JS_MEM_ACCOUNT_MAX)
+            return -1;
+        a = rt->mf.js_realloc(&rt->malloc_state, rt->mem_accounts,
+                              sizeof(*a) * (rt->mem_account_count + 1));
+        if (!a)
+            return -1;
+        rt->mem_accounts = a;
+        idx = rt->mem_account_count++;
+    }
+    a = &rt->mem_accounts[idx];
+    memset(a, 0, sizeof(*a));
+    a->soft_limit = -1;
+    a->hard_limit = -1;
+    a->in_use = TRUE;
+    return idx;
+}
+
+/* 'arena_chunk_size' = 0 means no arena */
+static JSContext *js_new_context_raw(JSRuntime *rt, size_t arena_chunk_size)
 {
     JSContext *ctx;
-    int i;
+    int i, account;
 
+    account = 0;
+    if (rt->mem_accounts) {
+        account = js_new_memory_account(rt);
+        if (account < 0)
+            return NULL;
+        rt->mem_accounts[account].arena_chunk_size = arena_chunk_size;
+        /* the context structures are charged to the context */
+        rt->malloc_account = account;
+    }
     ctx = js_mallocz_rt(rt, sizeof(JSContext));
-    if (!ctx)
+    if (!ctx) {
+        if (account != 0)
+            js_release_memory_account(rt, account);
         return NULL;
+    }
+    ctx->malloc_account = account;
     ctx->header.ref_count = 1;
     add_gc_object(rt, &ctx->header, JS_GC_OBJ_TYPE_JS_CONTEXT);
 
+    rt->malloc_account = account;
     ctx->class_proto = js_malloc_rt(rt, sizeof(ctx->class_proto[0]) *
                                     rt->class_count);
     if (!ctx->class_proto) {
+        if (account != 0)
+            rt->mem_accounts[account].in_use = FALSE;
         js_free_rt(rt, ctx);
         return NULL;
     }
@@ -2136,11 +3209,16 @@ JSContext *JS_NewContextRaw(JSRuntime *rt)
     return ctx;
 }
 
-JSContext *JS_NewContext(JSRuntime *rt)
+JSContext *JS_NewContextRaw(JSRuntime *rt)
+{
+    return js_new_context_raw(rt, 0);
+}
+
+static JSContext *js_new_context(JSRuntime *rt, size_t arena_chunk_size)
 {
     JSContext *ctx;
 
-    ctx = JS_NewContextRaw(rt);
+    ctx = js_new_context_raw(rt, arena_chunk_size);
     if (!ctx)
         return NULL;
 
@@ -2152,6 +3230,7 @@ JSContext *JS_NewContext(JSRuntime *rt)
     JS_AddIntrinsicJSON(ctx);
     JS_AddIntrinsicProxy(ctx);
     JS_AddIntrinsicMapSet(ctx);
+    JS_AddIntrinsicWeakRef(ctx);
     JS_AddIntrinsicTypedArrays(ctx);
     JS_AddIntrinsicPromise(ctx);
 #ifdef CONFIG_BIGNUM
@@ -2160,6 +3239,28 @@ JSContext *JS_NewContext(JSRuntime *rt)
     return ctx;
 }
 
+JSContext *JS_NewContext(JSRuntime *rt)
+{
+    return js_new_context(rt, 0);
+}
+
+/* Create a context whose small blocks are bump allocated in chunks of
+   'chunk_size' bytes (0 = default size). Freeing such a block is
+   almost free: all the chunks are released at once when the context
+   and every block charged to it are freed, so values outliving the
+   context keep its arena alive. Return NULL if the runtime was not
+   created with JS_RUNTIME_CONTEXT_MEMORY. */
+JSContext *JS_NewArenaContext(JSRuntime *rt, size_t chunk_size)
+{
+    if (!rt->mem_accounts)
+        return NULL;
+    if (chunk_size == 0)
+        chunk_size = JS_MEM_ARENA_CHUNK_SIZE;
+    else if (chunk_size < 4096)
+        chunk_size = 4096;
+    return js_new_context(rt, chunk_size);
+}
+
 void *JS_GetContextOpaque(JSContext *ctx)
 {
     return ctx->user_opaque;
@@ -2301,6 +3402,7 @@ void JS_FreeContext(JSContext *ctx)
 
     JS_FreeValue(ctx, ctx->global_obj);
     JS_FreeValue(ctx, ctx->global_var_obj);
+    js_free_hibernation_baseline(ctx);
 
     JS_FreeValue(ctx, ctx->throw_type_error);
     JS_FreeValue(ctx, ctx->eval_obj);
@@ -2325,6 +3427,10 @@ void JS_FreeContext(JSContext *ctx)
 
     list_del(&ctx->link);
     remove_gc_object(&ctx->header);
+    if (ctx->rt->mem_accounts && ctx->malloc_account != 0) {
+        /* the account is released with the last block charged to it */
+        ctx->rt->mem_accounts[ctx->malloc_account].in_use = FALSE;
+    }
     js_free_rt(ctx->rt, ctx);
 }
 
@@ -2338,6 +3444,13 @@ void JS_SetMaxStackSize(JSRuntime *rt, size_t stack_size)
     rt->stack_size = stack_size;
 }
 
+/* Must be called when the runtime is used from another thread than
+   the one which created it. */
+void JS_UpdateStackTop(JSRuntime *rt)
+{
+    rt->stack_top = js_get_stack_pointer();
+}
+
 static inline BOOL is_strict_mode(JSContext *ctx)
 {
     JSStackFrame *sf = ctx->rt->current_stack_frame;
@@ -2364,12 +3477,19 @@ static inline BOOL is_math_mode(JSContext *ctx)
 static inline BOOL __JS_AtomIsConst(JSAtom v)
 {
 #if defined(DUMP_LEAKS) && DUMP_LEAKS > 1
-        return (int32_t)v <= 0;
+        return (int32_t)v <= 0 || js_atom_is_shared(v);
 #else
         return (int32_t)v < JS_ATOM_END;
 #endif
 }
 
+/* the predefined string atoms are shared by all the runtimes (see
+   JS_InitAtoms()) */
+static inline BOOL js_atom_is_shared(JSAtom v)
+{
+    return v > JS_ATOM_NULL && v < JS_ATOM_Private_brand;
+}
+
 static inline BOOL __JS_AtomIsTaggedInt(JSAtom v)
 {
     return (v & JS_ATOM_TAG_INT) != 0;
@@ -2401,9 +3521,9 @@ static inline BOOL is_num_string(uint32_t *pval, const JSString *p)
     if (len == 0 || len > 10)
         return FALSE;
     if (p->is_wide_char)
-        c = p->u.str16[0];
+        c = js_str16(p)[0];
     else
-        c = p->u.str8[0];
+        c = js_str8(p)[0];
     if (is_num(c)) {
         if (c == '0') {
             if (len != 1)
@@ -2413,9 +3533,9 @@ static inline BOOL is_num_string(uint32_t *pval, const JSString *p)
             n = c - '0';
             for(i = 1; i < len; i++) {
                 if (p->is_wide_char)
-                    c = p->u.str16[i];
+                    c = js_str16(p)[i];
                 else
-                    c = p->u.str8[i];
+                    c = js_str8(p)[i];
                 if (!is_num(c))
                     return FALSE;
                 n64 = (uint64_t)n * 10 + (c - '0');
@@ -2431,32 +3551,137 @@ static inline BOOL is_num_string(uint32_t *pval, const JSString *p)
     }
 }
 
-/* XXX: could use faster version ? */
-static inline uint32_t hash_string8(const uint8_t *str, size_t len, uint32_t h)
+/* Keyed hash in the style of wyhash: the input is read 64 bits at a
+   time and mixed with a 64x64->128 bit multiplication. The seed is
+   random for each runtime so that collisions cannot be precomputed. */
+#define JS_HASH_K0 UINT64_C(0xa0761d6478bd642f)
+#define JS_HASH_K1 UINT64_C(0xe7037ed1a0b428db)
+#define JS_HASH_K2 UINT64_C(0x8ebc6af09c88c6e3)
+
+static inline uint64_t js_hash_mix(uint64_t a, uint64_t b)
 {
-    size_t i;
+#if defined(__SIZEOF_INT128__)
+    __uint128_t r = (__uint128_t)a * b;
+    return (uint64_t)r ^ (uint64_t)(r >> 64);
+#else
+    uint64_t ha = a >> 32, hb = b >> 32, la = (uint32_t)a, lb = (uint32_t)b;
+    uint64_t rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb;
+    uint64_t t = rl + (rm0 << 32), lo, hi;
+    hi = rh + (rm0 >> 32) + (rm1 >> 32) + (t < rl);
+    lo = t + (rm1 << 32);
+    hi += (lo < t);
+    return lo ^ hi;
+#endif
+}
 
-    for(i = 0; i < len; i++)
-        h = h * 263 + str[i];
+static inline uint64_t js_hash_word(uint64_t h, uint64_t w, uint64_t seed)
+{
+    return js_hash_mix(w ^ seed ^ JS_HASH_K1, h ^ JS_HASH_K2);
+}
+
+static inline uint32_t js_hash_final(uint64_t h, uint64_t len)
+{
+    h = js_hash_mix(h ^ JS_HASH_K0, len ^ JS_HASH_K1);
+    return h ^ (h >> 32);
+}
+
+static inline uint32_t js_hash_u64(uint64_t seed, uint64_t v)
+{
+    return js_hash_final(js_hash_word(seed, v, seed), 8);
+}
+
+/* 'ptr' is an address specific to the user of the seed */
+static uint64_t js_new_hash_seed(const void *ptr)
+{
+    struct timeval tv;
+    uint64_t h;
+    int dummy;
+
+    /* not cryptographically secure, but not predictable from JS code */
+    gettimeofday(&tv, NULL);
+    h = js_hash_mix(((uint64_t)tv.tv_sec * 1000000 + tv.tv_usec) ^ JS_HASH_K0,
+                    (uintptr_t)ptr ^ JS_HASH_K1);
+    h = js_hash_mix(h ^ JS_HASH_K2, (uintptr_t)&dummy ^ JS_HASH_K0);
     return h;
 }
 
-static inline uint32_t hash_string16(const uint16_t *str,
-                                     size_t len, uint32_t h)
+static uint32_t hash_string8(const uint8_t *str, size_t len, uint64_t seed)
 {
+    uint64_t h = seed, w;
     size_t i;
 
+    for(i = 0; i + 8 <= len; i += 8)
+        h = js_hash_word(h, get_u64(str + i), seed);
+    if (i < len) {
+        w = 0;
+        memcpy(&w, str + i, len - i);
+        h = js_hash_word(h, w, seed);
+    }
+    return js_hash_final(h, len);
+}
+
+/* 16 bit strings containing only 8 bit characters have the same hash
+   as the corresponding 8 bit strings */
+static uint32_t hash_string16(const uint16_t *str, size_t len, uint64_t seed)
+{
+    uint64_t h = seed, w;
+    uint8_t buf[8];
+    size_t i, j, n;
+    uint16_t c;
+
+    c = 0;
     for(i = 0; i < len; i++)
-        h = h * 263 + str[i];
-    return h;
+        c |= str[i];
+    if (c < 0x100) {
+        for(i = 0; i < len; i += 8) {
+            n = min_int(8, len - i);
+            for(j = 0; j < n; j++)
+                buf[j] = str[i + j];
+            for(; j < 8; j++)
+                buf[j] = 0;
+            h = js_hash_word(h, get_u64(buf), seed);
+        }
+    } else {
+        for(i = 0; i + 4 <= len; i += 4)
+            h = js_hash_word(h, get_u64((const uint8_t *)(str + i)), seed);
+        if (i < len) {
+            w = 0;
+            memcpy(&w, str + i, (len - i) * 2);
+            h = js_hash_word(h, w, seed);
+        }
+    }
+    return js_hash_final(h, len);
 }
 
-static uint32_t hash_string(const JSString *str, uint32_t h)
+static uint32_t hash_string(JSRuntime *rt, const JSString *str, int atom_type)
 {
+    uint64_t seed = rt->hash_seed + atom_type;
     if (str->is_wide_char)
-        h = hash_string16(str->u.str16, str->len, h);
+        return hash_string16(js_str16(str), str->len, seed);
     else
-        h = hash_string8(str->u.str8, str->len, h);
+        return hash_string8(js_str8(str), str->len, seed);
+}
+
+/* TRUE if 'hash' is the value returned by js_string_get_hash(). A
+   zero hash in a non atom string means it is not computed yet. */
+static inline BOOL js_string_has_hash(const JSString *p)
+{
+    return p->atom_type == JS_ATOM_TYPE_STRING ||
+        (p->atom_type == 0 && p->hash != 0);
+}
+
+/* Return the same hash as the corresponding JS_ATOM_TYPE_STRING
+   atom. It is cached in non atom strings, whose content is
+   immutable. */
+static uint32_t js_string_get_hash(JSRuntime *rt, JSString *p)
+{
+    uint32_t h;
+
+    if (js_string_has_hash(p))
+        return p->hash;
+    h = hash_string(rt, p, JS_ATOM_TYPE_STRING) & JS_ATOM_HASH_MASK;
+    if (p->atom_type == 0)
+        p->hash = h;
     return h;
 }
 
@@ -2474,9 +3699,9 @@ static __maybe_unused void JS_DumpString(JSRuntime *rt,
     putchar(sep);
     for(i = 0; i < p->len; i++) {
         if (p->is_wide_char)
-            c = p->u.str16[i];
+            c = js_str16(p)[i];
         else
-            c = p->u.str8[i];
+            c = js_str8(p)[i];
         if (c == sep || c == '\\') {
             putchar('\\');
             putchar(c);
@@ -2514,6 +3739,23 @@ static __maybe_unused void JS_DumpAtoms(JSRuntime *rt)
         }
     }
     printf("}\n");
+    if (rt->atom_hash_old) {
+        printf("JSAtom old hash table: {\n");
+        for(i = rt->atom_hash_old_pos; i < rt->atom_hash_old_size; i++) {
+            h = rt->atom_hash_old[i];
+            if (h) {
+                printf("  %d:", i);
+                while (h) {
+                    p = rt->atom_array[h];
+                    printf(" ");
+                    JS_DumpString(rt, p);
+                    h = p->hash_next;
+                }
+                printf("\n");
+            }
+        }
+        printf("}\n");
+    }
     printf("JSAtom table: {\n");
     for(i = 0; i < rt->atom_size; i++) {
         p = rt->atom_array[i];
@@ -2527,65 +3769,237 @@ static __maybe_unused void JS_DumpAtoms(JSRuntime *rt)
     printf("}\n");
 }
 
-static int JS_ResizeAtomHash(JSRuntime *rt, int new_hash_size)
+/* move 'n' buckets of the old hash table to the current one */
+static void js_atom_hash_migrate(JSRuntime *rt, int n)
 {
     JSAtomStruct *p;
-    uint32_t new_hash_mask, h, i, hash_next1, j, *new_hash;
+    uint32_t h, j, hash_next1, new_hash_mask;
 
-    assert((new_hash_size & (new_hash_size - 1)) == 0); /* power of two */
-    new_hash_mask = new_hash_size - 1;
-    new_hash = js_mallocz_rt(rt, sizeof(rt->atom_hash[0]) * new_hash_size);
-    if (!new_hash)
-        return -1;
-    for(i = 0; i < rt->atom_hash_size; i++) {
-        h = rt->atom_hash[i];
+    new_hash_mask = rt->atom_hash_size - 1;
+    while (n-- > 0 && rt->atom_hash_old_pos < rt->atom_hash_old_size) {
+        h = rt->atom_hash_old[rt->atom_hash_old_pos++];
         while (h != 0) {
             p = rt->atom_array[h];
             hash_next1 = p->hash_next;
             /* add in new hash table */
             j = p->hash & new_hash_mask;
-            p->hash_next = new_hash[j];
-            new_hash[j] = h;
+            p->hash_next = rt->atom_hash[j];
+            rt->atom_hash[j] = h;
             h = hash_next1;
         }
     }
-    js_free_rt(rt, rt->atom_hash);
+    if (rt->atom_hash_old_pos == rt->atom_hash_old_size) {
+        js_free_rt(rt, rt->atom_hash_old);
+        rt->atom_hash_old = NULL;
+    }
+}
+
+/* return the head of the hash chain of the atoms with hash 'h' */
+static inline uint32_t *js_atom_hash_bucket(JSRuntime *rt, uint32_t h)
+{
+    uint32_t h1;
+    if (unlikely(rt->atom_hash_old)) {
+        h1 = h & (rt->atom_hash_old_size - 1);
+        if (h1 >= rt->atom_hash_old_pos)
+            return &rt->atom_hash_old[h1];
+    }
+    return &rt->atom_hash[h & (rt->atom_hash_size - 1)];
+}
+
+/* The atoms are not all rehashed at once to avoid latency spikes: the
+   old hash table is kept and a few of its buckets are moved each time
+   an atom is added. */
+static int JS_ResizeAtomHash(JSRuntime *rt, int new_hash_size)
+{
+    uint32_t *new_hash;
+
+    assert((new_hash_size & (new_hash_size - 1)) == 0); /* power of two */
+    /* finish the previous resize */
+    if (rt->atom_hash_old)
+        js_atom_hash_migrate(rt, rt->atom_hash_old_size);
+    new_hash = js_mallocz_rt(rt, sizeof(rt->atom_hash[0]) *
+                             new_hash_size);
+    if (!new_hash)
+        return -1;
+    rt->atom_hash_old = rt->atom_hash;
+    rt->atom_hash_old_size = rt->atom_hash_size;
+    rt->atom_hash_old_pos = 0;
     rt->atom_hash = new_hash;
     rt->atom_hash_size = new_hash_size;
-    rt->atom_count_resize = JS_ATOM_COUNT_RESIZE(new_hash_size);
+    rt->atom_count_resize = JS_ATOM_END + JS_ATOM_COUNT_RESIZE(new_hash_size);
     //    JS_DumpAtoms(rt);
     return 0;
 }
 
+/* The predefined atoms are the same in every runtime. Their strings
+   and hash table are built once per process, with a per-process hash
+   seed which is only used to look up this table: the hash of the
+   other atoms and of the strings uses the seed of the runtime. The
+   string atoms are shared read-only by all the runtimes:
+   they are never modified and never used directly as values (see
+   js_shared_atom_to_value()). Only the few predefined symbols are
+   copied by JS_InitAtoms(). */
+#define JS_ATOM_INIT_HASH_SIZE 256 /* there are at least 195 predefined atoms */
+#define JS_ATOM_RT_HASH_SIZE 64    /* initial size of the runtime atom hash */
+
+typedef struct JSAtomInitTable {
+    uint64_t hash_seed;
+    uint32_t offset[JS_ATOM_END]; /* offset of each string in buf */
+    uint32_t hash[JS_ATOM_INIT_HASH_SIZE]; /* hash chains of the strings */
+    size_t size;
+    uint64_t buf[(JS_ATOM_END * (sizeof(JSString) + 8) +
+                  sizeof(js_atom_init)) / 8];
+} JSAtomInitTable;
+
+static JSAtomInitTable js_atom_init_table;
+#ifdef CONFIG_ATOMICS
+static pthread_once_t js_atom_init_once = PTHREAD_ONCE_INIT;
+#else
+static BOOL js_atom_init_done;
+#endif
+
+static void js_atom_init_table_init(void)
+{
+    JSAtomInitTable *t = &js_atom_init_table;
+    const char *str;
+    JSString *p;
+    size_t pos;
+    uint32_t h;
+    int i, len;
+
+    t->hash_seed = js_new_hash_seed(t);
+    str = js_atom_init;
+    pos = 0;
+    for(i = 0; i < JS_ATOM_END; i++) {
+        p = (JSString *)((uint8_t *)t->buf + pos);
+        t->offset[i] = pos;
+        /* JS_ATOM_NULL is an empty symbol */
+        len = (i == JS_ATOM_NULL) ? 0 : strlen(str);
+        p->header.ref_count = 1;
+        p->is_slice = 0;
+        p->is_wide_char = 0;
+        p->len = len;
+        memcpy(p->u.str8, str, len);
+        p->u.str8[len] = '\0';
+        if (i == JS_ATOM_NULL) {
+            p->atom_type = JS_ATOM_TYPE_SYMBOL;
+            p->hash = 0;
+            p->hash_next = i;
+        } else if (i == JS_ATOM_Private_brand) {
+            p->atom_type = JS_ATOM_TYPE_SYMBOL;
+            p->hash = JS_ATOM_HASH_PRIVATE;
+            p->hash_next = i;   /* atom_index */
+        } else if (i >= JS_ATOM_Symbol_toPrimitive) {
+            p->atom_type = JS_ATOM_TYPE_SYMBOL;
+            p->hash = JS_ATOM_HASH_SYMBOL;
+            p->hash_next = i;   /* atom_index */
+        } else {
+            p->atom_type = JS_ATOM_TYPE_STRING;
+            h = hash_string8(p->u.str8, len,
+                             t->hash_seed + JS_ATOM_TYPE_STRING);
+            h &= JS_ATOM_HASH_MASK;
+            p->hash = h;
+            p->hash_next = t->hash[h & (JS_ATOM_INIT_HASH_SIZE - 1)];
+            t->hash[h & (JS_ATOM_INIT_HASH_SIZE - 1)] = i;
+        }
+        pos += (sizeof(JSString) + len + 1 + 7) & ~7;
+        assert(pos <= sizeof(t->buf));
+        if (i != JS_ATOM_NULL)
+            str += len + 1;
+    }
+    t->size = pos;
+}
+
 static int JS_InitAtoms(JSRuntime *rt)
 {
-    int i, len, atom_type;
-    const char *p;
+    const JSAtomInitTable *t = &js_atom_init_table;
+    size_t sym_offset, sym_size;
+    int i, size;
 
     rt->atom_hash_size = 0;
     rt->atom_hash = NULL;
+    rt->atom_hash_old = NULL;
     rt->atom_count = 0;
     rt->atom_size = 0;
     rt->atom_free_index = 0;
-    if (JS_ResizeAtomHash(rt, 256))     /* there are at least 195 predefined atoms */
-        return -1;
 
-    p = js_atom_init;
-    for(i = 1; i < JS_ATOM_END; i++) {
-        if (i == JS_ATOM_Private_brand)
-            atom_type = JS_ATOM_TYPE_PRIVATE;
-        else if (i >= JS_ATOM_Symbol_toPrimitive)
-            atom_type = JS_ATOM_TYPE_SYMBOL;
-        else
-            atom_type = JS_ATOM_TYPE_STRING;
-        len = strlen(p);
-        if (__JS_NewAtomInit(rt, p, len, atom_type) == JS_ATOM_NULL)
-            return -1;
-        p = p + len + 1;
+#ifdef CONFIG_ATOMICS
+    pthread_once(&js_atom_init_once, js_atom_init_table_init);
+#else
+    if (!js_atom_init_done) {
+        js_atom_init_table_init();
+        js_atom_init_done = TRUE;
     }
+#endif
+    /* the symbols (JS_ATOM_NULL and the atoms from
+       JS_ATOM_Private_brand) are copied because their reference
+       count is used */
+    sym_offset = t->offset[JS_ATOM_Private_brand];
+    sym_size = t->size - sym_offset;
+    size = JS_ATOM_END * 3 / 2;
+    rt->atom_hash = js_mallocz_rt(rt, sizeof(rt->atom_hash[0]) *
+                                  JS_ATOM_RT_HASH_SIZE);
+    rt->atom_array = js_malloc_rt(rt, sizeof(rt->atom_array[0]) * size);
+    rt->atom_init_buf = js_malloc_rt(rt, t->offset[1] + sym_size);
+    if (!rt->atom_hash || !rt->atom_array || !rt->atom_init_buf)
+        return -1;
+    memcpy(rt->atom_init_buf, t->buf, t->offset[1]);
+    memcpy(rt->atom_init_buf + t->offset[1],
+           (const uint8_t *)t->buf + sym_offset, sym_size);
+    for(i = 0; i < JS_ATOM_END; i++) {
+        if (js_atom_is_shared(i)) {
+            rt->atom_array[i] = (JSAtomStruct *)((uint8_t *)t->buf +
+                                                 t->offset[i]);
+        } else {
+            JSAtomStruct *p;
+            if (i == JS_ATOM_NULL) {
+                p = (JSAtomStruct *)rt->atom_init_buf;
+            } else {
+                p = (JSAtomStruct *)(rt->atom_init_buf + t->offset[1] +
+                                     t->offset[i] - sym_offset);
+            }
+#ifdef DUMP_LEAKS
+            list_add_tail(&p->link, &rt->string_list);
+#endif
+            rt->atom_array[i] = p;
+        }
+    }
+    for(i = JS_ATOM_END; i < size; i++) {
+        rt->atom_array[i] = atom_set_free(i == (size - 1) ? 0 : i + 1);
+    }
+    rt->atom_hash_size = JS_ATOM_RT_HASH_SIZE;
+    rt->atom_count_resize = JS_ATOM_END +
+        JS_ATOM_COUNT_RESIZE(JS_ATOM_RT_HASH_SIZE);
+    rt->atom_count = JS_ATOM_END;
+    rt->atom_size = size;
+    rt->atom_free_index = JS_ATOM_END;
     return 0;
 }
 
+/* return the index of the shared atom matching 'str' or JS_ATOM_NULL */
+static JSAtom js_find_shared_atom(JSString *str)
+{
+    const JSAtomInitTable *t = &js_atom_init_table;
+    const JSAtomStruct *p;
+    uint64_t seed = t->hash_seed + JS_ATOM_TYPE_STRING;
+    uint32_t h, i;
+
+    if (str->is_wide_char)
+        h = hash_string16(js_str16(str), str->len, seed);
+    else
+        h = hash_string8(js_str8(str), str->len, seed);
+    h &= JS_ATOM_HASH_MASK;
+    i = t->hash[h & (JS_ATOM_INIT_HASH_SIZE - 1)];
+    while (i != 0) {
+        p = (const JSAtomStruct *)((const uint8_t *)t->buf + t->offset[i]);
+        if (p->hash == h && p->len == str->len &&
+            js_string_memcmp(p, str, str->len) == 0)
+            return i;
+        i = p->hash_next;
+    }
+    return JS_ATOM_NULL;
+}
+
 static JSAtom JS_DupAtomRT(JSRuntime *rt, JSAtom v)
 {
     JSAtomStruct *p;
@@ -2625,7 +4039,7 @@ static JSAtomKindEnum JS_AtomGetKind(JSContext *ctx, JSAtom v)
     case JS_ATOM_TYPE_GLOBAL_SYMBOL:
         return JS_ATOM_KIND_SYMBOL;
     case JS_ATOM_TYPE_SYMBOL:
-        switch(p->hash) {
+        switch(p->hash & JS_ATOM_HASH_KIND_MASK) {
         case JS_ATOM_HASH_SYMBOL:
             return JS_ATOM_KIND_SYMBOL;
         case JS_ATOM_HASH_PRIVATE:
@@ -2649,7 +4063,7 @@ static JSAtom js_get_atom_index(JSRuntime *rt, JSAtomStruct *p)
     if (p->atom_type != JS_ATOM_TYPE_SYMBOL) {
         JSAtomStruct *p1;
 
-        i = rt->atom_hash[p->hash & (rt->atom_hash_size - 1)];
+        i = *js_atom_hash_bucket(rt, p->hash);
         p1 = rt->atom_array[i];
         while (p1 != p) {
             assert(i != 0);
@@ -2664,7 +4078,7 @@ static JSAtom js_get_atom_index(JSRuntime *rt, JSAtomStruct *p)
    freed. */
 static JSAtom __JS_NewAtom(JSRuntime *rt, JSString *str, int atom_type)
 {
-    uint32_t h, h1, i;
+    uint32_t h, *ph, i;
     JSAtomStruct *p;
     int len;
 
@@ -2683,10 +4097,14 @@ static JSAtom __JS_NewAtom(JSRuntime *rt, JSString *str, int atom_type)
         }
         /* try and locate an already registered atom */
         len = str->len;
-        h = hash_string(str, atom_type);
-        h &= JS_ATOM_HASH_MASK;
-        h1 = h & (rt->atom_hash_size - 1);
-        i = rt->atom_hash[h1];
+        if (atom_type == JS_ATOM_TYPE_STRING) {
+            h = js_string_get_hash(rt, str);
+        } else {
+            h = hash_string(rt, str, atom_type);
+            h &= JS_ATOM_HASH_MASK;
+        }
+        ph = js_atom_hash_bucket(rt, h);
+        i = *ph;
         while (i != 0) {
             p = rt->atom_array[i];
             if (p->hash == h &&
@@ -2699,8 +4117,13 @@ static JSAtom __JS_NewAtom(JSRuntime *rt, JSString *str, int atom_type)
             }
             i = p->hash_next;
         }
+        if (atom_type == JS_ATOM_TYPE_STRING) {
+            i = js_find_shared_atom(str);
+            if (i != JS_ATOM_NULL)
+                goto done;
+        }
     } else {
-        h1 = 0; /* avoid warning */
+        ph = NULL; /* avoid warning */
         if (atom_type == JS_ATOM_TYPE_SYMBOL) {
             h = JS_ATOM_HASH_SYMBOL;
         } else {
@@ -2757,23 +4180,28 @@ static JSAtom __JS_NewAtom(JSRuntime *rt, JSString *str, int atom_type)
     }
 
     if (str) {
-        if (str->atom_type == 0) {
+        if (str->atom_type == 0 && !str->is_slice &&
+            !js_is_arena_block(rt, str)) {
             p = str;
             p->atom_type = atom_type;
         } else {
+            /* atoms are always flat strings. They are shared by the
+               contexts so they are not allocated in an arena. */
             p = js_malloc_rt(rt, sizeof(JSString) +
                              (str->len << str->is_wide_char) +
                              1 - str->is_wide_char);
             if (unlikely(!p))
                 goto fail;
             p->header.ref_count = 1;
+            p->is_slice = 0;
             p->is_wide_char = str->is_wide_char;
             p->len = str->len;
 #ifdef DUMP_LEAKS
             list_add_tail(&p->link, &rt->string_list);
 #endif
-            memcpy(p->u.str8, str->u.str8, (str->len << str->is_wide_char) +
-                   1 - str->is_wide_char);
+            memcpy(p->u.str8, js_str8(str), str->len << str->is_wide_char);
+            if (!str->is_wide_char)
+                p->u.str8[str->len] = '\0';
             js_free_string(rt, str);
         }
     } else {
@@ -2781,6 +4209,7 @@ static JSAtom __JS_NewAtom(JSRuntime *rt, JSString *str, int atom_type)
         if (!p)
             return JS_ATOM_NULL;
         p->header.ref_count = 1;
+        p->is_slice = 0;
         p->is_wide_char = 1;    /* Hack to represent NULL as a JSString */
         p->len = 0;
 #ifdef DUMP_LEAKS
@@ -2800,8 +4229,10 @@ static JSAtom __JS_NewAtom(JSRuntime *rt, JSString *str, int atom_type)
     rt->atom_count++;
 
     if (atom_type != JS_ATOM_TYPE_SYMBOL) {
-        p->hash_next = rt->atom_hash[h1];
-        rt->atom_hash[h1] = i;
+        p->hash_next = *ph;
+        *ph = i;
+        if (unlikely(rt->atom_hash_old))
+            js_atom_hash_migrate(rt, 2);
         if (unlikely(rt->atom_count >= rt->atom_count_resize))
             JS_ResizeAtomHash(rt, rt->atom_hash_size * 2);
     }
@@ -2833,13 +4264,13 @@ static JSAtom __JS_NewAtomInit(JSRuntime *rt, const char *str, int len,
 static JSAtom __JS_FindAtom(JSRuntime *rt, const char *str, size_t len,
                             int atom_type)
 {
-    uint32_t h, h1, i;
+    uint32_t h, i;
     JSAtomStruct *p;
 
-    h = hash_string8((const uint8_t *)str, len, JS_ATOM_TYPE_STRING);
+    h = hash_string8((const uint8_t *)str, len,
+                     rt->hash_seed + JS_ATOM_TYPE_STRING);
     h &= JS_ATOM_HASH_MASK;
-    h1 = h & (rt->atom_hash_size - 1);
-    i = rt->atom_hash[h1];
+    i = *js_atom_hash_bucket(rt, h);
     while (i != 0) {
         p = rt->atom_array[i];
         if (p->hash == h &&
@@ -2853,6 +4284,18 @@ static JSAtom __JS_FindAtom(JSRuntime *rt, const char *str, size_t len,
         }
         i = p->hash_next;
     }
+    /* the shared atoms use the per-process seed */
+    h = hash_string8((const uint8_t *)str, len,
+                     js_atom_init_table.hash_seed + JS_ATOM_TYPE_STRING);
+    h &= JS_ATOM_HASH_MASK;
+    i = js_atom_init_table.hash[h & (JS_ATOM_INIT_HASH_SIZE - 1)];
+    while (i != 0) {
+        p = rt->atom_array[i];
+        if (p->hash == h && p->len == len &&
+            memcmp(p->u.str8, str, len) == 0)
+            return i;
+        i = p->hash_next;
+    }
     return JS_ATOM_NULL;
 }
 
@@ -2867,13 +4310,13 @@ static void JS_FreeAtomStruct(JSRuntime *rt, JSAtomStruct *p)
     uint32_t i = p->hash_next;  /* atom_index */
     if (p->atom_type != JS_ATOM_TYPE_SYMBOL) {
         JSAtomStruct *p0, *p1;
-        uint32_t h0;
+        uint32_t *ph;
 
-        h0 = p->hash & (rt->atom_hash_size - 1);
-        i = rt->atom_hash[h0];
+        ph = js_atom_hash_bucket(rt, p->hash);
+        i = *ph;
         p1 = rt->atom_array[i];
         if (p1 == p) {
-            rt->atom_hash[h0] = p1->hash_next;
+            *ph = p1->hash_next;
         } else {
             for(;;) {
                 assert(i != 0);
@@ -2997,7 +4440,17 @@ static JSValue JS_NewSymbolFromAtom(JSContext *ctx, JSAtom descr,
     assert(!__JS_AtomIsTaggedInt(descr));
     assert(descr < rt->atom_size);
     p = rt->atom_array[descr];
-    JS_DupValue(ctx, JS_MKPTR(JS_TAG_STRING, p));
+    if (js_atom_is_shared(descr)) {
+        /* the shared string cannot become the symbol */
+        JSString *p1;
+        p1 = js_alloc_string(ctx, p->len, 0);
+        if (!p1)
+            return JS_EXCEPTION;
+        memcpy(p1->u.str8, p->u.str8, p->len + 1);
+        p = p1;
+    } else {
+        JS_DupValue(ctx, JS_MKPTR(JS_TAG_STRING, p));
+    }
     return JS_NewSymbol(ctx, p, atom_type);
 }
 
@@ -3058,6 +4511,35 @@ static const char *JS_AtomGetStr(JSContext *ctx, char *buf, int buf_size, JSAtom
     return JS_AtomGetStrRT(ctx->rt, buf, buf_size, atom);
 }
 
+/* The shared atoms are never used as values because their reference
+   count cannot be modified. A copy is made on first use. */
+static JSValue js_shared_atom_to_value(JSContext *ctx, JSAtom atom)
+{
+    JSRuntime *rt = ctx->rt;
+    JSAtomStruct *p;
+    JSString *str;
+
+    if (unlikely(!rt->atom_init_values)) {
+        rt->atom_init_values = js_mallocz_rt(rt, sizeof(rt->atom_init_values[0]) *
+                                             JS_ATOM_Private_brand);
+        if (!rt->atom_init_values)
+            return JS_ThrowOutOfMemory(ctx);
+    }
+    str = rt->atom_init_values[atom];
+    if (!str) {
+        p = rt->atom_array[atom];
+        str = js_alloc_string(ctx, p->len, 0);
+        if (!str)
+            return JS_EXCEPTION;
+        memcpy(str->u.str8, p->u.str8, p->len + 1);
+        /* 'p' is hashed with the per-process seed */
+        str->hash = hash_string(rt, str, JS_ATOM_TYPE_STRING) &
+            JS_ATOM_HASH_MASK;
+        rt->atom_init_values[atom] = str;
+    }
+    return JS_DupValue(ctx, JS_MKPTR(JS_TAG_STRING, str));
+}
+
 static JSValue __JS_AtomToValue(JSContext *ctx, JSAtom atom, BOOL force_string)
 {
     char buf[ATOM_GET_STR_BUF_SIZE];
@@ -3075,9 +4557,11 @@ static JSValue __JS_AtomToValue(JSContext *ctx, JSAtom atom, BOOL force_string)
         } else if (force_string) {
             if (p->len == 0 && p->is_wide_char != 0) {
                 /* no description string */
-                p = rt->atom_array[JS_ATOM_empty_string];
+                atom = JS_ATOM_empty_string;
             }
         ret_string:
+            if (js_atom_is_shared(atom))
+                return js_shared_atom_to_value(ctx, atom);
             return JS_DupValue(ctx, JS_MKPTR(JS_TAG_STRING, p));
         } else {
             return JS_DupValue(ctx, JS_MKPTR(JS_TAG_SYMBOL, p));
@@ -3186,7 +4670,12 @@ static JSValue JS_AtomIsNumericIndex1(JSContext *ctx, JSAtom atom)
     /* XXX: bignum: would be better to only accept integer to avoid
        relying on current floating point precision */
     /* this is ECMA CanonicalNumericIndexString primitive */
-    num = JS_ToNumber(ctx, JS_MKPTR(JS_TAG_STRING, p));
+    /* the atom string may be shared: use a value copy */
+    str = JS_AtomToString(ctx, atom);
+    if (JS_IsException(str))
+        return str;
+    num = JS_ToNumber(ctx, str);
+    JS_FreeValue(ctx, str);
     if (JS_IsException(num))
         return num;
     str = JS_ToString(ctx, num);
@@ -3240,7 +4729,7 @@ static BOOL JS_AtomSymbolHasDescription(JSContext *ctx, JSAtom v)
         return FALSE;
     p = rt->atom_array[v];
     return (((p->atom_type == JS_ATOM_TYPE_SYMBOL &&
-              p->hash == JS_ATOM_HASH_SYMBOL) ||
+              (p->hash & JS_ATOM_HASH_KIND_MASK) == JS_ATOM_HASH_SYMBOL) ||
              p->atom_type == JS_ATOM_TYPE_GLOBAL_SYMBOL) &&
             !(p->len == 0 && p->is_wide_char != 0));
 }
@@ -3409,6 +4898,8 @@ static int JS_NewClass1(JSRuntime *rt, JSClassID class_id,
     cl->gc_mark = class_def->gc_mark;
     cl->call = class_def->call;
     cl->exotic = class_def->exotic;
+    cl->save = class_def->save;
+    cl->restore = class_def->restore;
     return 0;
 }
 
@@ -3465,32 +4956,107 @@ static JSValue js_new_string_char(JSContext *ctx, uint16_t c)
     }
 }
 
+/* Note: the slice fields are uninitialized */
+static JSString *js_alloc_string_slice_rt(JSRuntime *rt, size_t size,
+                                          int len, int is_wide_char)
+{
+    JSString *str;
+    str = js_malloc_rt(rt, sizeof(JSString) + size);
+    if (unlikely(!str))
+        return NULL;
+    str->header.ref_count = 1;
+    str->is_slice = 1;
+    str->is_wide_char = is_wide_char;
+    str->len = len;
+    str->atom_type = 0;
+    str->hash = 0;
+    str->hash_next = 0;
+#ifdef DUMP_LEAKS
+    list_add_tail(&str->link, &rt->string_list);
+#endif
+    return str;
+}
+
+/* Return a slice of 'p' referencing its characters or JS_UNDEFINED
+   if the substring should be copied. Slicing is only done if the
+   substring covers a significant part of the parent, so that a slice
+   never keeps alive much more memory than its own characters. */
+static JSValue js_new_string_slice(JSContext *ctx, JSString *p,
+                                   int start, int len)
+{
+    JSString *parent, *str;
+    JSStringSlice *sl;
+    size_t ptr_offset;
+
+    if (len < JS_STRING_SLICE_MIN_LEN)
+        return JS_UNDEFINED;
+    if (p->is_slice && js_str_slice(p)->parent) {
+        sl = js_str_slice(p);
+        parent = sl->parent;
+        ptr_offset = ((const uint8_t *)sl->ptr - js_str8(parent)) >>
+            p->is_wide_char;
+        start += ptr_offset;
+    } else {
+        parent = p;
+    }
+    /* the predefined atoms are shared by the runtimes */
+    if (parent->atom_type != 0)
+        return JS_UNDEFINED;
+    /* the characters of external strings are not in the JS heap */
+    if (!parent->is_slice &&
+        (uint64_t)len * JS_STRING_SLICE_MIN_RATIO < parent->len)
+        return JS_UNDEFINED;
+    if (unlikely(!js_malloc_account(ctx, sizeof(JSString) +
+                                    sizeof(JSStringSlice))))
+        return JS_UNDEFINED;
+    str = js_alloc_string_slice_rt(ctx->rt, sizeof(JSStringSlice), len,
+                                   parent->is_wide_char);
+    if (unlikely(!str))
+        return JS_UNDEFINED;
+    sl = js_str_slice(str);
+    parent->header.ref_count++;
+    sl->parent = parent;
+    sl->ptr = (uint8_t *)js_str8(parent) +
+        ((size_t)start << parent->is_wide_char);
+    return JS_MKPTR(JS_TAG_STRING, str);
+}
+
 static JSValue js_sub_string(JSContext *ctx, JSString *p, int start, int end)
 {
     int len = end - start;
+    JSValue ret;
+
     if (start == 0 && end == p->len) {
         return JS_DupValue(ctx, JS_MKPTR(JS_TAG_STRING, p));
     }
     if (p->is_wide_char && len > 0) {
         JSString *str;
+        const uint16_t *src = js_str16(p);
         int i;
         uint16_t c = 0;
         for (i = start; i < end; i++) {
-            c |= p->u.str16[i];
+            c |= src[i];
+        }
+        if (c > 0xFF) {
+            ret = js_new_string_slice(ctx, p, start, len);
+            if (!JS_IsUndefined(ret))
+                return ret;
+            return js_new_string16(ctx, src + start, len);
         }
-        if (c > 0xFF)
-            return js_new_string16(ctx, p->u.str16 + start, len);
 
         str = js_alloc_string(ctx, len, 0);
         if (!str)
             return JS_EXCEPTION;
         for (i = 0; i < len; i++) {
-            str->u.str8[i] = p->u.str16[start + i];
+            str->u.str8[i] = src[start + i];
         }
         str->u.str8[len] = '\0';
         return JS_MKPTR(JS_TAG_STRING, str);
     } else {
-        return js_new_string8(ctx, p->u.str8 + start, len);
+        ret = js_new_string_slice(ctx, p, start, len);
+        if (!JS_IsUndefined(ret))
+            return ret;
+        return js_new_string8(ctx, js_str8(p) + start, len);
     }
 }
 
@@ -3596,6 +5162,32 @@ static no_inline int string_buffer_realloc(StringBuffer *s, int new_len, int c)
     return 0;
 }
 
+/* size hint: make room for 'count' more characters so that the
+   following appends do not reallocate. If 'is_wide' is set, the buffer
+   is widened now instead of in the middle of the appends. */
+static int string_buffer_reserve(StringBuffer *s, int64_t count, int is_wide)
+{
+    int64_t new_len;
+
+    if (s->error_status)
+        return -1;
+    new_len = s->len + count;
+    if (new_len > s->size) {
+        if (new_len > JS_STRING_LEN_MAX) {
+            JS_ThrowInternalError(s->ctx, "string too long");
+            return string_buffer_set_error(s);
+        }
+        if (string_buffer_realloc(s, new_len, is_wide ? 0x100 : 0))
+            return -1;
+        /* widening adds no room: the size may still be too small */
+        if (new_len > s->size)
+            return string_buffer_realloc(s, new_len, 0);
+    } else if (is_wide && !s->is_wide_char) {
+        return string_buffer_widen(s, s->size);
+    }
+    return 0;
+}
+
 static no_inline int string_buffer_putc_slow(StringBuffer *s, uint32_t c)
 {
     if (unlikely(s->len >= s->size)) {
@@ -3658,7 +5250,7 @@ static int string_buffer_putc(StringBuffer *s, uint32_t c)
 }
 
 static int string_get(const JSString *p, int idx) {
-    return p->is_wide_char ? p->u.str16[idx] : p->u.str8[idx];
+    return p->is_wide_char ? js_str16(p)[idx] : js_str8(p)[idx];
 }
 
 static int string_getc(const JSString *p, int *pidx)
@@ -3666,16 +5258,17 @@ static int string_getc(const JSString *p, int *pidx)
     int idx, c, c1;
     idx = *pidx;
     if (p->is_wide_char) {
-        c = p->u.str16[idx++];
+        const uint16_t *src = js_str16(p);
+        c = src[idx++];
         if (c >= 0xd800 && c < 0xdc00 && idx < p->len) {
-            c1 = p->u.str16[idx];
+            c1 = src[idx];
             if (c1 >= 0xdc00 && c1 < 0xe000) {
                 c = (((c & 0x3ff) << 10) | (c1 & 0x3ff)) + 0x10000;
                 idx++;
             }
         }
     } else {
-        c = p->u.str8[idx++];
+        c = js_str8(p)[idx++];
     }
     *pidx = idx;
     return c;
@@ -3739,9 +5332,9 @@ static int string_buffer_concat(StringBuffer *s, const JSString *p,
     if (to <= from)
         return 0;
     if (p->is_wide_char)
-        return string_buffer_write16(s, p->u.str16 + from, to - from);
+        return string_buffer_write16(s, js_str16(p) + from, to - from);
     else
-        return string_buffer_write8(s, p->u.str8 + from, to - from);
+        return string_buffer_write8(s, js_str8(p) + from, to - from);
 }
 
 static int string_buffer_concat_value(StringBuffer *s, JSValueConst v)
@@ -3788,17 +5381,50 @@ static int string_buffer_concat_value_free(StringBuffer *s, JSValue v)
     return res;
 }
 
+/* 0 <= c <= 0xffff */
 static int string_buffer_fill(StringBuffer *s, int c, int count)
 {
-    /* XXX: optimize */
-    if (s->len + count > s->size) {
-        if (string_buffer_realloc(s, s->len + count, c))
-            return -1;
+    int i;
+
+    if (count <= 0)
+        return 0;
+    if (string_buffer_reserve(s, count, c >= 0x100))
+        return -1;
+    if (s->is_wide_char) {
+        for(i = 0; i < count; i++)
+            s->str->u.str16[s->len + i] = c;
+    } else {
+        memset(&s->str->u.str8[s->len], c, count);
     }
-    while (count-- > 0) {
-        if (string_buffer_putc16(s, c))
-            return -1;
+    s->len += count;
+    return 0;
+}
+
+/* append 'count' copies of 'p': the buffer is sized once and the first
+   copy is then doubled in place */
+static int string_buffer_concat_repeat(StringBuffer *s, const JSString *p,
+                                       int count)
+{
+    int start, len, total, chunk;
+
+    if (count <= 0 || p->len == 0)
+        return 0;
+    if (string_buffer_reserve(s, (int64_t)p->len * count, p->is_wide_char))
+        return -1;
+    start = s->len;
+    string_buffer_concat(s, p, 0, p->len);
+    total = p->len * count;
+    for(len = p->len; len < total; len += chunk) {
+        chunk = min_int(len, total - len);
+        if (s->is_wide_char) {
+            memcpy(&s->str->u.str16[start + len], &s->str->u.str16[start],
+                   chunk << 1);
+        } else {
+            memcpy(&s->str->u.str8[start + len], &s->str->u.str8[start],
+                   chunk);
+        }
     }
+    s->len = start + total;
     return 0;
 }
 
@@ -3931,6 +5557,46 @@ JSValue JS_NewString(JSContext *ctx, const char *str)
     return JS_NewStringLen(ctx, str, strlen(str));
 }
 
+static JSValue js_new_external_string(JSContext *ctx, const void *buf,
+                                      size_t len, int is_wide_char,
+                                      JSFreeStringDataFunc *free_func,
+                                      void *opaque)
+{
+    JSString *str;
+    JSStringExternal *ext;
+
+    if (len > JS_STRING_LEN_MAX)
+        return JS_ThrowInternalError(ctx, "string too long");
+    if (unlikely(!js_malloc_account(ctx, sizeof(JSString) +
+                                    sizeof(JSStringExternal))))
+        return JS_ThrowOutOfMemory(ctx);
+    str = js_alloc_string_slice_rt(ctx->rt, sizeof(JSStringExternal), len,
+                                   is_wide_char);
+    if (unlikely(!str))
+        return JS_ThrowOutOfMemory(ctx);
+    ext = (JSStringExternal *)js_str_slice(str);
+    ext->slice.parent = NULL;
+    ext->slice.ptr = (void *)buf;
+    ext->free_func = free_func;
+    ext->opaque = opaque;
+    return JS_MKPTR(JS_TAG_STRING, str);
+}
+
+/* Create a string referencing 'len' Latin-1 characters owned by the
+   caller. 'buf' must not be modified until 'free_func' is called. */
+JSValue JS_NewExternalString8(JSContext *ctx, const uint8_t *buf, size_t len,
+                              JSFreeStringDataFunc *free_func, void *opaque)
+{
+    return js_new_external_string(ctx, buf, len, 0, free_func, opaque);
+}
+
+/* same as JS_NewExternalString8() with UTF-16 characters */
+JSValue JS_NewExternalString16(JSContext *ctx, const uint16_t *buf, size_t len,
+                               JSFreeStringDataFunc *free_func, void *opaque)
+{
+    return js_new_external_string(ctx, buf, len, 1, free_func, opaque);
+}
+
 JSValue JS_NewAtomString(JSContext *ctx, const char *str)
 {
     JSAtom atom = JS_NewAtom(ctx, str);
@@ -3962,7 +5628,7 @@ const char *JS_ToCStringLen2(JSContext *ctx, size_t *plen, JSValueConst val1, BO
     str = JS_VALUE_GET_STRING(val);
     len = str->len;
     if (!str->is_wide_char) {
-        const uint8_t *src = str->u.str8;
+        const uint8_t *src = js_str8(str);
         int count;
 
         /* count the number of non-ASCII characters */
@@ -3975,7 +5641,7 @@ const char *JS_ToCStringLen2(JSContext *ctx, size_t *plen, JSValueConst val1, BO
         for (pos = 0; pos < len; pos++) {
             count += src[pos] >> 7;
         }
-        if (count == 0) {
+        if (count == 0 && !str->is_slice) {
             if (plen)
                 *plen = len;
             return (const char *)src;
@@ -3994,7 +5660,7 @@ const char *JS_ToCStringLen2(JSContext *ctx, size_t *plen, JSValueConst val1, BO
             }
         }
     } else {
-        const uint16_t *src = str->u.str16;
+        const uint16_t *src = js_str16(str);
         /* Allocate 3 bytes per 16 bit code point. Surrogate pairs may
            produce 4 bytes but use 2 code points.
          */
@@ -4079,14 +5745,14 @@ static int js_string_memcmp(const JSString *p1, const JSString *p2, int len)
 
     if (likely(!p1->is_wide_char)) {
         if (likely(!p2->is_wide_char))
-            res = memcmp(p1->u.str8, p2->u.str8, len);
+            res = memcmp(js_str8(p1), js_str8(p2), len);
         else
-            res = -memcmp16_8(p2->u.str16, p1->u.str8, len);
+            res = -memcmp16_8(js_str16(p2), js_str8(p1), len);
     } else {
         if (!p2->is_wide_char)
-            res = memcmp16_8(p1->u.str16, p2->u.str8, len);
+            res = memcmp16_8(js_str16(p1), js_str8(p2), len);
         else
-            res = memcmp16(p1->u.str16, p2->u.str16, len);
+            res = memcmp16(js_str16(p1), js_str16(p2), len);
     }
     return res;
 }
@@ -4096,6 +5762,8 @@ static int js_string_compare(JSContext *ctx,
                              const JSString *p1, const JSString *p2)
 {
     int res, len;
+    if (p1 == p2)
+        return 0;
     len = min_int(p1->len, p2->len);
     res = js_string_memcmp(p1, p2, len);
     if (res == 0) {
@@ -4109,12 +5777,26 @@ static int js_string_compare(JSContext *ctx,
     return res;
 }
 
+/* return TRUE if the strings have the same content. The cached hashes
+   are used to quickly reject different strings. */
+static BOOL js_string_eq(const JSString *p1, const JSString *p2)
+{
+    if (p1 == p2)
+        return TRUE;
+    if (p1->len != p2->len)
+        return FALSE;
+    if (js_string_has_hash(p1) && js_string_has_hash(p2) &&
+        p1->hash != p2->hash)
+        return FALSE;
+    return js_string_memcmp(p1, p2, p1->len) == 0;
+}
+
 static void copy_str16(uint16_t *dst, const JSString *p, int offset, int len)
 {
     if (p->is_wide_char) {
-        memcpy(dst, p->u.str16 + offset, len * 2);
+        memcpy(dst, js_str16(p) + offset, len * 2);
     } else {
-        const uint8_t *src1 = p->u.str8 + offset;
+        const uint8_t *src1 = js_str8(p) + offset;
         int i;
 
         for(i = 0; i < len; i++)
@@ -4137,8 +5819,8 @@ static JSValue JS_ConcatString1(JSContext *ctx,
     if (!p)
         return JS_EXCEPTION;
     if (!is_wide_char) {
-        memcpy(p->u.str8, p1->u.str8, p1->len);
-        memcpy(p->u.str8 + p1->len, p2->u.str8, p2->len);
+        memcpy(p->u.str8, js_str8(p1), p1->len);
+        memcpy(p->u.str8 + p1->len, js_str8(p2), p2->len);
         p->u.str8[len] = '\0';
     } else {
         copy_str16(p->u.str16, p1, 0, p1->len);
@@ -4176,13 +5858,15 @@ static JSValue JS_ConcatString(JSContext *ctx, JSValue op1, JSValue op2)
         goto ret_op1;
     }
     if (p1->header.ref_count == 1 && p1->is_wide_char == p2->is_wide_char
+    &&  p1->atom_type == 0 && !p1->is_slice
     &&  js_malloc_usable_size(ctx, p1) >= sizeof(*p1) + ((p1->len + p2->len) << p2->is_wide_char) + 1 - p1->is_wide_char) {
         /* Concatenate in place in available space at the end of p1 */
+        p1->hash = 0; /* invalidate the cached hash */
         if (p1->is_wide_char) {
-            memcpy(p1->u.str16 + p1->len, p2->u.str16, p2->len << 1);
+            memcpy(p1->u.str16 + p1->len, js_str16(p2), p2->len << 1);
             p1->len += p2->len;
         } else {
-            memcpy(p1->u.str8 + p1->len, p2->u.str8, p2->len);
+            memcpy(p1->u.str8 + p1->len, js_str8(p2), p2->len);
             p1->len += p2->len;
             p1->u.str8[p1->len] = '\0';
         }
@@ -4231,10 +5915,12 @@ static int init_shape_hash(JSRuntime *rt)
     return 0;
 }
 
-/* same magic hash multiplier as the Linux kernel */
+/* same magic hash multiplier as the Linux kernel. The shift makes the
+   hash depend on the random initial value. */
 static uint32_t shape_hash(uint32_t h, uint32_t val)
 {
-    return (h + val) * 0x9e370001;
+    h = (h + val) * 0x9e370001;
+    return h ^ (h >> 15);
 }
 
 /* truncate the shape hash to 'hash_bits' bits */
@@ -4243,13 +5929,9 @@ static uint32_t get_shape_hash(uint32_t h, int hash_bits)
     return h >> (32 - hash_bits);
 }
 
-static uint32_t shape_initial_hash(JSObject *proto)
+static uint32_t shape_initial_hash(JSRuntime *rt, JSObject *proto)
 {
-    uint32_t h;
-    h = shape_hash(1, (uintptr_t)proto);
-    if (sizeof(proto) > 4)
-        h = shape_hash(h, (uint64_t)(uintptr_t)proto >> 32);
-    return h;
+    return js_hash_u64(rt->hash_seed, (uintptr_t)proto);
 }
 
 static int resize_shape_hash(JSRuntime *rt, int new_shape_hash_bits)
@@ -4298,6 +5980,11 @@ static void js_shape_hash_unlink(JSRuntime *rt, JSShape *sh)
         psh = &(*psh)->shape_hash_next;
     *psh = sh->shape_hash_next;
     rt->shape_hash_count--;
+#ifdef CONFIG_BIGNUM
+    /* the shape is about to be modified or freed */
+    if (unlikely(sh->in_operator_cache))
+        js_operator_cache_remove_shape(rt, sh);
+#endif
 }
 
 /* create a new empty shape with prototype 'proto' */
@@ -4313,7 +6000,7 @@ static no_inline JSShape *js_new_shape2(JSContext *ctx, JSObject *proto,
         resize_shape_hash(rt, rt->shape_hash_bits + 1);
     }
 
-    sh_alloc = js_malloc(ctx, get_shape_size(hash_size, prop_size));
+    sh_alloc = js_malloc_shared(ctx, get_shape_size(hash_size, prop_size));
     if (!sh_alloc)
         return NULL;
     sh = get_shape_from_alloc(sh_alloc, hash_size);
@@ -4330,9 +6017,12 @@ static no_inline JSShape *js_new_shape2(JSContext *ctx, JSObject *proto,
     sh->deleted_prop_count = 0;
     
     /* insert in the hash table */
-    sh->hash = shape_initial_hash(proto);
+    sh->hash = shape_initial_hash(ctx->rt, proto);
     sh->is_hashed = TRUE;
     sh->has_small_array_index = FALSE;
+#ifdef CONFIG_BIGNUM
+    sh->in_operator_cache = FALSE;
+#endif
     js_shape_hash_link(ctx->rt, sh);
     return sh;
 }
@@ -4355,7 +6045,7 @@ static JSShape *js_clone_shape(JSContext *ctx, JSShape *sh1)
 
     hash_size = sh1->prop_hash_mask + 1;
     size = get_shape_size(hash_size, sh1->prop_size);
-    sh_alloc = js_malloc(ctx, size);
+    sh_alloc = js_malloc_shared(ctx, size);
     if (!sh_alloc)
         return NULL;
     sh_alloc1 = get_alloc_from_shape(sh1);
@@ -4364,6 +6054,9 @@ static JSShape *js_clone_shape(JSContext *ctx, JSShape *sh1)
     sh->header.ref_count = 1;
     add_gc_object(ctx->rt, &sh->header, JS_GC_OBJ_TYPE_SHAPE);
     sh->is_hashed = FALSE;
+#ifdef CONFIG_BIGNUM
+    sh->in_operator_cache = FALSE;
+#endif
     if (sh->proto) {
         JS_DupValue(ctx, JS_MKPTR(JS_TAG_OBJECT, sh->proto));
     }
@@ -4440,7 +6133,8 @@ static no_inline int resize_properties(JSContext *ctx, JSShape **psh,
         JSShape *old_sh;
         /* resize the hash table and the properties */
         old_sh = sh;
-        sh_alloc = js_malloc(ctx, get_shape_size(new_hash_size, new_size));
+        sh_alloc = js_malloc_shared(ctx, get_shape_size(new_hash_size,
+                                                        new_size));
         if (!sh_alloc)
             return -1;
         sh = get_shape_from_alloc(sh_alloc, new_hash_size);
@@ -4503,7 +6197,7 @@ static int compact_properties(JSContext *ctx, JSObject *p)
 
     /* resize the hash table and the properties */
     old_sh = sh;
-    sh_alloc = js_malloc(ctx, get_shape_size(new_hash_size, new_size));
+    sh_alloc = js_malloc_shared(ctx, get_shape_size(new_hash_size, new_size));
     if (!sh_alloc)
         return -1;
     sh = get_shape_from_alloc(sh_alloc, new_hash_size);
@@ -4598,7 +6292,7 @@ static JSShape *find_hashed_shape_proto(JSRuntime *rt, JSObject *proto)
     JSShape *sh1;
     uint32_t h, h1;
 
-    h = shape_initial_hash(proto);
+    h = shape_initial_hash(rt, proto);
     h1 = get_shape_hash(h, rt->shape_hash_bits);
     for(sh1 = rt->shape_hash[h1]; sh1 != NULL; sh1 = sh1->shape_hash_next) {
         if (sh1->hash == h &&
@@ -4692,7 +6386,7 @@ static JSValue JS_NewObjectFromShape(JSContext *ctx, JSShape *sh, JSClassID clas
 {
     JSObject *p;
 
-    js_trigger_gc(ctx->rt, sizeof(JSObject));
+    js_trigger_gc(ctx, sizeof(JSObject));
     p = js_malloc(ctx, sizeof(JSObject));
     if (unlikely(!p))
         goto fail;
@@ -4704,6 +6398,7 @@ static JSValue JS_NewObjectFromShape(JSContext *ctx, JSShape *sh, JSClassID clas
     p->is_constructor = 0;
     p->is_uncatchable_error = 0;
     p->tmp_mark = 0;
+    p->in_instanceof_cache = 0;
     p->first_weak_ref = NULL;
     p->u.opaque = NULL;
     p->shape = sh;
@@ -5312,6 +7007,8 @@ static void js_bound_function_finalizer(JSRuntime *rt, JSValue val)
 
     JS_FreeValueRT(rt, bf->func_obj);
     JS_FreeValueRT(rt, bf->this_val);
+    JS_FreeValueRT(rt, bf->inner_func_obj);
+    JS_FreeValueRT(rt, bf->name);
     for(i = 0; i < bf->argc; i++) {
         JS_FreeValueRT(rt, bf->argv[i]);
     }
@@ -5327,6 +7024,7 @@ static void js_bound_function_mark(JSRuntime *rt, JSValueConst val,
 
     JS_MarkValue(rt, bf->func_obj, mark_func);
     JS_MarkValue(rt, bf->this_val, mark_func);
+    JS_MarkValue(rt, bf->inner_func_obj, mark_func);
     for(i = 0; i < bf->argc; i++)
         JS_MarkValue(rt, bf->argv[i], mark_func);
 }
@@ -5347,6 +7045,15 @@ static void js_for_in_iterator_mark(JSRuntime *rt, JSValueConst val,
     JS_MarkValue(rt, it->obj, mark_func);
 }
 
+static void js_instanceof_cache_invalidate(JSRuntime *rt)
+{
+    if (unlikely(++rt->instanceof_cache_epoch == 0)) {
+        /* wrap around: the old entries could become valid again */
+        memset(rt->instanceof_cache, 0, sizeof(rt->instanceof_cache));
+        rt->instanceof_cache_epoch = 1;
+    }
+}
+
 static void free_object(JSRuntime *rt, JSObject *p)
 {
     int i;
@@ -5372,6 +7079,11 @@ static void free_object(JSRuntime *rt, JSObject *p)
     p->shape = NULL;
     p->prop = NULL;
 
+    if (unlikely(p->in_instanceof_cache)) {
+        /* the object address may be reused */
+        js_instanceof_cache_invalidate(rt);
+    }
+
     if (unlikely(p->first_weak_ref)) {
         reset_weak_ref(rt, p);
     }
@@ -5423,6 +7135,10 @@ static void free_zero_refcount(JSRuntime *rt)
         free_gc_object(rt, p);
     }
     rt->gc_phase = JS_GC_PHASE_NONE;
+#ifdef CONFIG_BACKGROUND_FREE
+    if (rt->bg_free)
+        js_bg_free_flush(rt, FALSE);
+#endif
 }
 
 /* called with the ref_count of 'v' reaches zero. */
@@ -5449,6 +7165,8 @@ void __JS_FreeValueRT(JSRuntime *rt, JSValue v)
             if (p->atom_type) {
                 JS_FreeAtomStruct(rt, p);
             } else {
+                if (p->is_slice)
+                    js_free_string_slice(rt, p);
 #ifdef DUMP_LEAKS
                 list_del(&p->link);
 #endif
@@ -5759,6 +7477,10 @@ void JS_RunGC(JSRuntime *rt)
 
     /* free the GC objects in a cycle */
     gc_free_cycles(rt);
+#ifdef CONFIG_BACKGROUND_FREE
+    if (rt->bg_free)
+        js_bg_free_flush(rt, FALSE);
+#endif
 }
 
 /* Return false if not an object or if the object has already been
@@ -5793,8 +7515,15 @@ static void compute_jsstring_size(JSString *str, JSMemoryUsage_helper *hp)
     if (!str->atom_type) {  /* atoms are handled separately */
         double s_ref_count = str->header.ref_count;
         hp->str_count += 1 / s_ref_count;
-        hp->str_size += ((sizeof(*str) + (str->len << str->is_wide_char) +
-                          1 - str->is_wide_char) / s_ref_count);
+        if (str->is_slice) {
+            if (js_str_slice(str)->parent)
+                hp->str_size += (sizeof(*str) + sizeof(JSStringSlice)) / s_ref_count;
+            else
+                hp->str_size += (sizeof(*str) + sizeof(JSStringExternal)) / s_ref_count;
+        } else {
+            hp->str_size += ((sizeof(*str) + (str->len << str->is_wide_char) +
+                              1 - str->is_wide_char) / s_ref_count);
+        }
     }
 }
 
@@ -6120,9 +7849,13 @@ void JS_ComputeMemoryUsage(JSRuntime *rt, JSMemoryUsage *s)
     s->atom_count = rt->atom_count;
     s->atom_size = sizeof(rt->atom_array[0]) * rt->atom_size +
         sizeof(rt->atom_hash[0]) * rt->atom_hash_size;
+    if (rt->atom_hash_old) {
+        s->memory_used_count++;
+        s->atom_size += sizeof(rt->atom_hash[0]) * rt->atom_hash_old_size;
+    }
     for(i = 0; i < rt->atom_size; i++) {
         JSAtomStruct *p = rt->atom_array[i];
-        if (!atom_is_free(p)) {
+        if (!atom_is_free(p) && !js_atom_is_shared(i)) {
             s->atom_size += (sizeof(*p) + (p->len << p->is_wide_char) +
                              1 - p->is_wide_char);
         }
@@ -6436,7 +8169,12 @@ static void build_backtrace(JSContext *ctx, JSValueConst error_obj,
     const char *str1;
     JSObject *p;
     BOOL backtrace_barrier;
-    
+    JSValue saved_exception;
+
+    /* 'error_obj' may be the pending exception: keep it while an
+       out of memory error is thrown */
+    saved_exception = ctx->rt->current_exception;
+    ctx->rt->current_exception = JS_NULL;
     js_dbuf_init(ctx, &dbuf);
     if (filename) {
         dbuf_printf(&dbuf, "    at %s", filename);
@@ -6501,6 +8239,8 @@ static void build_backtrace(JSContext *ctx, JSValueConst error_obj,
     dbuf_free(&dbuf);
     JS_DefinePropertyValue(ctx, error_obj, JS_ATOM_stack, str,
                            JS_PROP_WRITABLE | JS_PROP_CONFIGURABLE);
+    JS_FreeValue(ctx, ctx->rt->current_exception);
+    ctx->rt->current_exception = saved_exception;
 }
 
 /* Note: it is important that no exception is returned by this function */
@@ -6711,14 +8451,41 @@ static JSValue JS_ThrowTypeErrorInvalidClass(JSContext *ctx, int class_id)
     return JS_ThrowTypeErrorAtom(ctx, "%s object expected", name);
 }
 
+static inline int js_get_interrupt_request(JSRuntime *rt)
+{
+#ifdef CONFIG_ATOMICS
+    return atomic_load_explicit(&rt->interrupt_request, memory_order_relaxed);
+#else
+    return rt->interrupt_request;
+#endif
+}
+
 static no_inline __exception int __js_poll_interrupts(JSContext *ctx)
 {
     JSRuntime *rt = ctx->rt;
+    int req;
+
     ctx->interrupt_counter = JS_INTERRUPT_COUNTER_INIT;
+    req = js_get_interrupt_request(rt);
+    /* the calls made by the host outside of any JS function are
+       allowed so that it can still inspect the error */
+    if ((req & JS_INTERRUPT_REQUEST_CPU_TIME) && rt->current_stack_frame) {
+        JS_ThrowInternalError(ctx, "CPU time limit exceeded");
+        goto uncatchable;
+    }
+    if (req & JS_INTERRUPT_REQUEST_HANDLER) {
+#ifdef CONFIG_ATOMICS
+        atomic_fetch_and(&rt->interrupt_request,
+                         ~JS_INTERRUPT_REQUEST_HANDLER);
+#else
+        rt->interrupt_request &= ~JS_INTERRUPT_REQUEST_HANDLER;
+#endif
+    }
     if (rt->interrupt_handler) {
         if (rt->interrupt_handler(rt, rt->interrupt_opaque)) {
             /* XXX: should set a specific flag to avoid catching */
             JS_ThrowInternalError(ctx, "interrupted");
+        uncatchable:
             JS_SetUncatchableError(ctx, ctx->rt->current_exception, TRUE);
             return -1;
         }
@@ -6726,9 +8493,11 @@ static no_inline __exception int __js_poll_interrupts(JSContext *ctx)
     return 0;
 }
 
+/* Also called by the long running built-in functions. */
 static inline __exception int js_poll_interrupts(JSContext *ctx)
 {
-    if (unlikely(--ctx->interrupt_counter <= 0)) {
+    if (unlikely(--ctx->interrupt_counter <= 0 ||
+                 js_get_interrupt_request(ctx->rt))) {
         return __js_poll_interrupts(ctx);
     } else {
         return 0;
@@ -6797,6 +8566,8 @@ static int JS_SetPrototypeInternal(JSContext *ctx, JSValueConst obj,
         JS_DupValue(ctx, proto_val);
     }
 
+    js_instanceof_cache_invalidate(ctx->rt);
+
     if (js_shape_prepare_update(ctx, p, NULL))
         return -1;
     sh = p->shape;
@@ -6880,13 +8651,30 @@ static JSValue JS_GetPrototypeFree(JSContext *ctx, JSValue obj)
     return obj1;
 }
 
-/* return TRUE, FALSE or (-1) in case of exception */
+/* return the cache slot for the pair (proto, target_proto). Never
+   returns NULL: the slot may hold another pair or a result from a
+   previous epoch, so the caller must check 'epoch', 'proto' and
+   'target_proto' before using 'result'. */
+static inline JSInstanceofCacheEntry *
+js_instanceof_cache_find(JSRuntime *rt, JSObject *proto,
+                         JSObject *target_proto)
+{
+    uintptr_t h;
+    h = ((uintptr_t)proto >> 4) ^ ((uintptr_t)target_proto >> 3);
+    h ^= h >> 7;
+    return &rt->instanceof_cache[h & (JS_INSTANCEOF_CACHE_SIZE - 1)];
+}
+
 static int JS_OrdinaryIsInstanceOf(JSContext *ctx, JSValueConst val,
                                    JSValueConst obj)
 {
+    JSRuntime *rt = ctx->rt;
     JSValue obj_proto;
-    JSObject *proto;
+    JSObject *proto, *proto0;
     const JSObject *p, *proto1;
+    JSInstanceofCacheEntry *ce;
+    JSProperty *pr;
+    JSShapeProperty *prs;
     BOOL ret;
 
     if (!JS_IsFunction(ctx, obj))
@@ -6894,13 +8682,20 @@ static int JS_OrdinaryIsInstanceOf(JSContext *ctx, JSValueConst val,
     p = JS_VALUE_GET_OBJ(obj);
     if (p->class_id == JS_CLASS_BOUND_FUNCTION) {
         JSBoundFunction *s = p->u.bound_function;
+        /* the intermediate bound function may define Symbol.hasInstance */
+        if (!JS_IsUndefined(s->inner_func_obj))
+            return JS_IsInstanceOf(ctx, val, s->inner_func_obj);
         return JS_IsInstanceOf(ctx, val, s->func_obj);
     }
 
     /* Only explicitly boxed values are instances of constructors */
     if (JS_VALUE_GET_TAG(val) != JS_TAG_OBJECT)
         return FALSE;
-    obj_proto = JS_GetProperty(ctx, obj, JS_ATOM_prototype);
+    prs = find_own_property(&pr, (JSObject *)p, JS_ATOM_prototype);
+    if (prs && (prs->flags & JS_PROP_TMASK) == JS_PROP_NORMAL)
+        obj_proto = JS_DupValue(ctx, pr->u.value);
+    else
+        obj_proto = JS_GetProperty(ctx, obj, JS_ATOM_prototype);
     if (JS_VALUE_GET_TAG(obj_proto) != JS_TAG_OBJECT) {
         if (!JS_IsException(obj_proto))
             JS_ThrowTypeError(ctx, "operand 'prototype' property is not an object");
@@ -6909,12 +8704,25 @@ static int JS_OrdinaryIsInstanceOf(JSContext *ctx, JSValueConst val,
     }
     proto = JS_VALUE_GET_OBJ(obj_proto);
     p = JS_VALUE_GET_OBJ(val);
+    proto0 = p->shape->proto;
+    ce = NULL;
+    if (proto0) {
+        /* the result only depends on the prototype chain starting
+           at 'proto0' */
+        ce = js_instanceof_cache_find(rt, proto0, proto);
+        if (ce->epoch == rt->instanceof_cache_epoch &&
+            ce->proto == proto0 && ce->target_proto == proto) {
+            ret = ce->result;
+            goto done;
+        }
+    }
     for(;;) {
         proto1 = p->shape->proto;
         if (!proto1) {
             /* slow case if proxy in the prototype chain */
             if (unlikely(p->class_id == JS_CLASS_PROXY)) {
                 JSValue obj1;
+                ce = NULL;
                 obj1 = JS_DupValue(ctx, JS_MKPTR(JS_TAG_OBJECT, (JSObject *)p));
                 for(;;) {
                     obj1 = JS_GetPrototypeFree(ctx, obj1);
@@ -6949,11 +8757,37 @@ static int JS_OrdinaryIsInstanceOf(JSContext *ctx, JSValueConst val,
             break;
         }
     }
+    if (ce) {
+        ce->proto = proto0;
+        ce->target_proto = proto;
+        ce->epoch = rt->instanceof_cache_epoch;
+        ce->result = ret;
+        proto0->in_instanceof_cache = TRUE;
+    }
 done:
     JS_FreeValue(ctx, obj_proto);
     return ret;
 }
 
+/* return TRUE if the Symbol.hasInstance method of 'p' is
+   Function.prototype[Symbol.hasInstance]. It is not writable nor
+   configurable so no lookup is necessary once Function.prototype is
+   reached. */
+static BOOL js_has_ordinary_has_instance(JSContext *ctx, JSObject *p)
+{
+    JSObject *function_proto = JS_VALUE_GET_OBJ(ctx->function_proto);
+
+    for(;;) {
+        if (p == function_proto)
+            return TRUE;
+        if (p->is_exotic || find_own_property1(p, JS_ATOM_Symbol_hasInstance))
+            return FALSE;
+        p = p->shape->proto;
+        if (!p)
+            return FALSE;
+    }
+}
+
 /* return TRUE, FALSE or (-1) in case of exception */
 int JS_IsInstanceOf(JSContext *ctx, JSValueConst val, JSValueConst obj)
 {
@@ -6961,6 +8795,8 @@ int JS_IsInstanceOf(JSContext *ctx, JSValueConst val, JSValueConst obj)
 
     if (!JS_IsObject(obj))
         goto fail;
+    if (js_has_ordinary_has_instance(ctx, JS_VALUE_GET_OBJ(obj)))
+        return JS_OrdinaryIsInstanceOf(ctx, val, obj);
     method = JS_GetProperty(ctx, obj, JS_ATOM_Symbol_hasInstance);
     if (JS_IsException(method))
         return -1;
@@ -6985,6 +8821,7 @@ static JSAutoInitFunc *js_autoinit_func_table[] = {
     js_instantiate_prototype, /* JS_AUTOINIT_ID_PROTOTYPE */
     js_module_ns_autoinit, /* JS_AUTOINIT_ID_MODULE_NS */
     JS_InstantiateFunctionListItem, /* JS_AUTOINIT_ID_PROP */
+    js_bound_function_name_autoinit, /* JS_AUTOINIT_ID_BOUND_FUNCTION_NAME */
 };
 
 static int JS_AutoInitProperty(JSContext *ctx, JSObject *p, JSAtom prop,
@@ -7026,9 +8863,9 @@ JSValue JS_GetPropertyInternal(JSContext *ctx, JSValueConst obj,
                     idx = __JS_AtomToUInt32(prop);
                     if (idx < p1->len) {
                         if (p1->is_wide_char)
-                            ch = p1->u.str16[idx];
+                            ch = js_str16(p1)[idx];
                         else
-                            ch = p1->u.str8[idx];
+                            ch = js_str8(p1)[idx];
                         return js_new_string_char(ctx, ch);
                     }
                 } else if (prop == JS_ATOM_length) {
@@ -7155,6 +8992,40 @@ static JSValue JS_ThrowTypeErrorPrivateNotFound(JSContext *ctx, JSAtom atom)
                                  atom);
 }
 
+static inline void js_private_set_slot_hint(JSAtomStruct *ps, uint32_t idx)
+{
+    if (idx <= JS_ATOM_HASH_SLOT_MAX)
+        ps->hash = (idx << JS_ATOM_HASH_SLOT_SHIFT) | JS_ATOM_HASH_PRIVATE;
+}
+
+/* Find the private field or brand 'prop' in 'p'. The objects of a
+   given class usually have their private fields at the same
+   property index, so the index where the symbol was last found is
+   checked first. */
+static force_inline JSShapeProperty *find_private_property(JSRuntime *rt,
+                                                           JSProperty **ppr,
+                                                           JSObject *p,
+                                                           JSAtom prop)
+{
+    JSAtomStruct *ps = rt->atom_array[prop];
+    JSShape *sh = p->shape;
+    JSShapeProperty *prs;
+    uint32_t idx;
+
+    idx = ps->hash >> JS_ATOM_HASH_SLOT_SHIFT;
+    if (likely(idx < sh->prop_count)) {
+        prs = &get_shape_prop(sh)[idx];
+        if (likely(prs->atom == prop)) {
+            *ppr = &p->prop[idx];
+            return prs;
+        }
+    }
+    prs = find_own_property(ppr, p, prop);
+    if (prs)
+        js_private_set_slot_hint(ps, prs - get_shape_prop(sh));
+    return prs;
+}
+
 /* Private fields can be added even on non extensible objects or
    Proxies */
 static int JS_DefinePrivateField(JSContext *ctx, JSValueConst obj,
@@ -7189,6 +9060,7 @@ static int JS_DefinePrivateField(JSContext *ctx, JSValueConst obj,
         return -1;
     }
     pr->u.value = val;
+    js_private_set_slot_hint(ctx->rt->atom_array[prop], pr - p->prop);
     return 0;
 }
 
@@ -7207,7 +9079,7 @@ static JSValue JS_GetPrivateField(JSContext *ctx, JSValueConst obj,
         return JS_ThrowTypeErrorNotASymbol(ctx);
     prop = js_symbol_to_atom(ctx, (JSValue)name);
     p = JS_VALUE_GET_OBJ(obj);
-    prs = find_own_property(&pr, p, prop);
+    prs = find_private_property(ctx->rt, &pr, p, prop);
     if (!prs) {
         JS_ThrowTypeErrorPrivateNotFound(ctx, prop);
         return JS_EXCEPTION;
@@ -7234,7 +9106,7 @@ static int JS_SetPrivateField(JSContext *ctx, JSValueConst obj,
     }
     prop = js_symbol_to_atom(ctx, (JSValue)name);
     p = JS_VALUE_GET_OBJ(obj);
-    prs = find_own_property(&pr, p, prop);
+    prs = find_private_property(ctx->rt, &pr, p, prop);
     if (!prs) {
         JS_ThrowTypeErrorPrivateNotFound(ctx, prop);
     fail:
@@ -7282,10 +9154,13 @@ static int JS_AddBrand(JSContext *ctx, JSValueConst obj, JSValueConst home_obj)
     }
     p1 = JS_VALUE_GET_OBJ(obj);
     pr = add_property(ctx, p1, brand_atom, JS_PROP_C_W_E);
-    JS_FreeAtom(ctx, brand_atom);
-    if (!pr)
+    if (!pr) {
+        JS_FreeAtom(ctx, brand_atom);
         return -1;
+    }
     pr->u.value = JS_UNDEFINED;
+    js_private_set_slot_hint(ctx->rt->atom_array[brand_atom], pr - p1->prop);
+    JS_FreeAtom(ctx, brand_atom);
     return 0;
 }
 
@@ -7322,7 +9197,8 @@ static int JS_CheckBrand(JSContext *ctx, JSValueConst obj, JSValueConst func)
     if (unlikely(JS_VALUE_GET_TAG(obj) != JS_TAG_OBJECT))
         goto not_obj;
     p = JS_VALUE_GET_OBJ(obj);
-    prs = find_own_property(&pr, p, js_symbol_to_atom(ctx, (JSValue)brand));
+    prs = find_private_property(ctx->rt, &pr, p,
+                                js_symbol_to_atom(ctx, (JSValue)brand));
     if (!prs) {
         JS_ThrowTypeError(ctx, "invalid brand on object");
         return -1;
@@ -12283,6 +14159,196 @@ static int get_ovop_from_opcode(OPCodeEnum op)
     }
 }
 
+static void js_operator_cache_remove_shape(JSRuntime *rt, JSShape *sh)
+{
+    JSOperatorSetCacheEntry *ce;
+    JSOperatorCacheEntry *oe;
+    int i;
+
+    for(i = 0; i < JS_OPERATOR_SET_CACHE_SIZE; i++) {
+        ce = &rt->operator_set_cache[i];
+        if (ce->shape == sh || ce->mid_shape == sh || ce->holder_shape == sh)
+            ce->shape = NULL;
+    }
+    for(i = 0; i < JS_OPERATOR_CACHE_SIZE; i++) {
+        oe = &rt->operator_cache[i];
+        if (oe->shape1 == sh || oe->shape2 == sh)
+            oe->shape1 = NULL;
+    }
+    sh->in_operator_cache = FALSE;
+}
+
+/* return the object from which Symbol.operatorSet is looked up or
+   NULL if the generic lookup must be used */
+static JSObject *js_operator_set_start(JSContext *ctx, JSValueConst obj)
+{
+    JSValueConst proto;
+
+    if (JS_VALUE_GET_TAG(obj) == JS_TAG_OBJECT)
+        return JS_VALUE_GET_OBJ(obj);
+    /* the lookup starts from the prototype of the primitive type */
+    proto = JS_GetPrototypePrimitive(ctx, obj);
+    if (JS_VALUE_GET_TAG(proto) != JS_TAG_OBJECT)
+        return NULL;
+    return JS_VALUE_GET_OBJ(proto);
+}
+
+/* return the Symbol.operatorSet property of 'p' if its location is
+   in the cache, NULL otherwise */
+static JSValue *js_operator_set_cache_find(JSRuntime *rt, JSObject *p)
+{
+    JSOperatorSetCacheEntry *ce;
+    JSObject *holder;
+
+    ce = &rt->operator_set_cache[((uintptr_t)p->shape >> 4) &
+                                 (JS_OPERATOR_SET_CACHE_SIZE - 1)];
+    if (ce->shape != p->shape)
+        return NULL;
+    holder = p;
+    if (ce->depth >= 1) {
+        holder = ce->shape->proto;
+        if (ce->depth == 2) {
+            if (holder->shape != ce->mid_shape)
+                return NULL;
+            holder = ce->mid_shape->proto;
+        }
+    }
+    if (holder->shape != ce->holder_shape)
+        return NULL;
+    return &holder->prop[ce->prop_idx].u.value;
+}
+
+/* return obj[Symbol.operatorSet]. The location of the property is
+   cached by shape to avoid the prototype chain lookups. */
+static JSValue js_get_operator_set(JSContext *ctx, JSValueConst obj)
+{
+    JSRuntime *rt = ctx->rt;
+    JSOperatorSetCacheEntry *ce;
+    JSObject *p, *p1;
+    JSShape *shapes[3];
+    JSShapeProperty *prs;
+    JSProperty *pr;
+    JSValue *pval;
+    int depth;
+
+    p = js_operator_set_start(ctx, obj);
+    if (!p)
+        goto generic;
+    pval = js_operator_set_cache_find(rt, p);
+    if (pval)
+        return JS_DupValue(ctx, *pval);
+    /* look for a data property in ordinary objects with hashed shapes */
+    p1 = p;
+    for(depth = 0; depth < 3; depth++) {
+        if (p1->is_exotic || !p1->shape->is_hashed)
+            break;
+        shapes[depth] = p1->shape;
+        prs = find_own_property(&pr, p1, JS_ATOM_Symbol_operatorSet);
+        if (prs) {
+            if ((prs->flags & JS_PROP_TMASK) != JS_PROP_NORMAL)
+                break;
+            ce = &rt->operator_set_cache[((uintptr_t)p->shape >> 4) &
+                                         (JS_OPERATOR_SET_CACHE_SIZE - 1)];
+            ce->shape = shapes[0];
+            ce->mid_shape = (depth == 2) ? shapes[1] : NULL;
+            ce->holder_shape = shapes[depth];
+            ce->prop_idx = prs - get_shape_prop(p1->shape);
+            ce->depth = depth;
+            shapes[0]->in_operator_cache = TRUE;
+            shapes[depth]->in_operator_cache = TRUE;
+            if (depth == 2)
+                shapes[1]->in_operator_cache = TRUE;
+            return JS_DupValue(ctx, pr->u.value);
+        }
+        p1 = p1->shape->proto;
+        if (!p1)
+            break;
+    }
+ generic:
+    return JS_GetProperty(ctx, obj, JS_ATOM_Symbol_operatorSet);
+}
+
+static inline JSOperatorCacheEntry *js_operator_cache_entry(JSRuntime *rt,
+                                                            JSShape *sh1,
+                                                            JSShape *sh2,
+                                                            JSOverloadableOperatorEnum ovop)
+{
+    uintptr_t h;
+    h = ((uintptr_t)sh1 >> 4) ^ ((uintptr_t)sh2 >> 3) ^ ovop;
+    return &rt->operator_cache[h & (JS_OPERATOR_CACHE_SIZE - 1)];
+}
+
+/* return TRUE if the location of the operator set of 'p' is cached
+   and if it has the counter 'operator_counter' */
+static BOOL js_operator_cache_check_set(JSRuntime *rt, JSObject *p,
+                                        uint32_t operator_counter)
+{
+    JSValue *pval;
+    JSObject *opset_obj;
+
+    pval = js_operator_set_cache_find(rt, p);
+    if (!pval || JS_VALUE_GET_TAG(*pval) != JS_TAG_OBJECT)
+        return FALSE;
+    opset_obj = JS_VALUE_GET_OBJ(*pval);
+    return opset_obj->class_id == JS_CLASS_OPERATOR_SET &&
+        ((JSOperatorSetData *)opset_obj->u.opaque)->operator_counter ==
+        operator_counter;
+}
+
+/* return the cached operator function for 'op1' and 'op2' or NULL */
+static JSOperatorCacheEntry *js_operator_cache_find(JSContext *ctx,
+                                                    JSValueConst op1,
+                                                    JSValueConst op2,
+                                                    JSOverloadableOperatorEnum ovop)
+{
+    JSRuntime *rt = ctx->rt;
+    JSOperatorCacheEntry *oe;
+    JSObject *p1, *p2;
+
+    p1 = js_operator_set_start(ctx, op1);
+    p2 = js_operator_set_start(ctx, op2);
+    if (!p1 || !p2)
+        return NULL;
+    oe = js_operator_cache_entry(rt, p1->shape, p2->shape, ovop);
+    if (oe->shape1 != p1->shape || oe->shape2 != p2->shape ||
+        oe->ovop != ovop ||
+        !js_operator_cache_check_set(rt, p1, oe->operator_counter1) ||
+        !js_operator_cache_check_set(rt, p2, oe->operator_counter2))
+        return NULL;
+    return oe;
+}
+
+/* add the operator function 'method' to the cache if the locations
+   of the operator sets of 'op1' and 'op2' are cached */
+static void js_operator_cache_add(JSContext *ctx,
+                                  JSValueConst op1, JSOperatorSetData *opset1,
+                                  JSValueConst op2, JSOperatorSetData *opset2,
+                                  JSOverloadableOperatorEnum ovop,
+                                  JSObject *method)
+{
+    JSRuntime *rt = ctx->rt;
+    JSOperatorCacheEntry *oe;
+    JSObject *p1, *p2;
+
+    p1 = js_operator_set_start(ctx, op1);
+    p2 = js_operator_set_start(ctx, op2);
+    if (!p1 || !p2 ||
+        !js_operator_cache_check_set(rt, p1, opset1->operator_counter) ||
+        !js_operator_cache_check_set(rt, p2, opset2->operator_counter))
+        return;
+    oe = js_operator_cache_entry(rt, p1->shape, p2->shape, ovop);
+    oe->shape1 = p1->shape;
+    oe->shape2 = p2->shape;
+    oe->method = method;
+    oe->operator_counter1 = opset1->operator_counter;
+    oe->operator_counter2 = opset2->operator_counter;
+    oe->ovop = ovop;
+    oe->is_primitive1 = opset1->is_primitive;
+    oe->is_primitive2 = opset2->is_primitive;
+    p1->shape->in_operator_cache = TRUE;
+    p2->shape->in_operator_cache = TRUE;
+}
+
 /* return NULL if not present */
 static JSObject *find_binary_op(JSBinaryOperatorDef *def,
                                 uint32_t operator_index,
@@ -12311,14 +14377,26 @@ static __exception int js_call_binary_op_fallback(JSContext *ctx,
     JSValue opset1_obj, opset2_obj, method, ret, new_op1, new_op2;
     JSOperatorSetData *opset1, *opset2;
     JSOverloadableOperatorEnum ovop;
+    JSOperatorCacheEntry *oe;
     JSObject *p;
     JSValueConst args[2];
+    BOOL is_primitive1, is_primitive2;
     
     if (!ctx->allow_operator_overloading)
         return 0;
     
+    ovop = get_ovop_from_opcode(op);
+    opset1_obj = JS_UNDEFINED;
     opset2_obj = JS_UNDEFINED;
-    opset1_obj = JS_GetProperty(ctx, op1, JS_ATOM_Symbol_operatorSet);
+    oe = js_operator_cache_find(ctx, op1, op2, ovop);
+    if (oe) {
+        p = oe->method;
+        is_primitive1 = oe->is_primitive1;
+        is_primitive2 = oe->is_primitive2;
+        goto call;
+    }
+
+    opset1_obj = js_get_operator_set(ctx, op1);
     if (JS_IsException(opset1_obj))
         goto exception;
     if (JS_IsUndefined(opset1_obj))
@@ -12327,7 +14405,7 @@ static __exception int js_call_binary_op_fallback(JSContext *ctx,
     if (!opset1)
         goto exception;
 
-    opset2_obj = JS_GetProperty(ctx, op2, JS_ATOM_Symbol_operatorSet);
+    opset2_obj = js_get_operator_set(ctx, op2);
     if (JS_IsException(opset2_obj))
         goto exception;
     if (JS_IsUndefined(opset2_obj)) {
@@ -12344,8 +14422,6 @@ static __exception int js_call_binary_op_fallback(JSContext *ctx,
         return 0;
     }
 
-    ovop = get_ovop_from_opcode(op);
-    
     if (opset1->operator_counter == opset2->operator_counter) {
         p = opset1->self_ops[ovop];
     } else if (opset1->operator_counter > opset2->operator_counter) {
@@ -12358,20 +14434,28 @@ static __exception int js_call_binary_op_fallback(JSContext *ctx,
                           js_overloadable_operator_names[ovop]);
         goto exception;
     }
+    js_operator_cache_add(ctx, op1, opset1, op2, opset2, ovop, p);
+    is_primitive1 = opset1->is_primitive;
+    is_primitive2 = opset2->is_primitive;
 
-    if (opset1->is_primitive) {
+ call:
+    /* the method is referenced before calling user code */
+    method = JS_DupValue(ctx, JS_MKPTR(JS_TAG_OBJECT, p));
+    if (is_primitive1) {
         if (is_numeric) {
             new_op1 = JS_ToNumeric(ctx, op1);
         } else {
             new_op1 = JS_ToPrimitive(ctx, op1, hint);
         }
-        if (JS_IsException(new_op1))
+        if (JS_IsException(new_op1)) {
+            JS_FreeValue(ctx, method);
             goto exception;
+        }
     } else {
         new_op1 = JS_DupValue(ctx, op1);
     }
     
-    if (opset2->is_primitive) {
+    if (is_primitive2) {
         if (is_numeric) {
             new_op2 = JS_ToNumeric(ctx, op2);
         } else {
@@ -12379,6 +14463,7 @@ static __exception int js_call_binary_op_fallback(JSContext *ctx,
         }
         if (JS_IsException(new_op2)) {
             JS_FreeValue(ctx, new_op1);
+            JS_FreeValue(ctx, method);
             goto exception;
         }
     } else {
@@ -12388,7 +14473,6 @@ static __exception int js_call_binary_op_fallback(JSContext *ctx,
     /* XXX: could apply JS_ToPrimitive() if primitive type so that the
        operator function does not get a value object */
     
-    method = JS_DupValue(ctx, JS_MKPTR(JS_TAG_OBJECT, p));
     if (ovop == JS_OVOP_LESS && (op == OP_lte || op == OP_gt)) {
         args[0] = new_op2;
         args[1] = new_op1;
@@ -12442,7 +14526,7 @@ static __exception int js_call_binary_op_simple(JSContext *ctx,
     JSObject *p;
     JSValueConst args[2];
 
-    opset1_obj = JS_GetProperty(ctx, obj, JS_ATOM_Symbol_operatorSet);
+    opset1_obj = js_get_operator_set(ctx, obj);
     if (JS_IsException(opset1_obj))
         goto exception;
     if (JS_IsUndefined(opset1_obj))
@@ -12499,7 +14583,7 @@ static __exception int js_call_unary_op_fallback(JSContext *ctx,
     if (!ctx->allow_operator_overloading)
         return 0;
     
-    opset1_obj = JS_GetProperty(ctx, op1, JS_ATOM_Symbol_operatorSet);
+    opset1_obj = js_get_operator_set(ctx, op1);
     if (JS_IsException(opset1_obj))
         goto exception;
     if (JS_IsUndefined(opset1_obj))
@@ -14427,7 +16511,7 @@ static BOOL js_strict_eq2(JSContext *ctx, JSValue op1, JSValue op2,
             } else {
                 p1 = JS_VALUE_GET_STRING(op1);
                 p2 = JS_VALUE_GET_STRING(op2);
-                res = (js_string_compare(ctx, p1, p2) == 0);
+                res = js_string_eq(p1, p2);
             }
         }
         break;
@@ -14879,6 +16963,27 @@ static JSValue js_build_mapped_arguments(JSContext *ctx, int argc,
     return JS_EXCEPTION;
 }
 
+/* build the 'arguments' object of the current frame on first use and
+   store it in its variable slot (see can_defer_arguments()) */
+static int js_build_lazy_arguments(JSContext *ctx, JSStackFrame *sf,
+                                   int argc, JSValueConst *argv, int idx)
+{
+    JSFunctionBytecode *b;
+    JSValue val;
+
+    b = JS_VALUE_GET_OBJ(sf->cur_func)->u.func.function_bytecode;
+    if ((b->js_mode & JS_MODE_STRICT) || !b->has_simple_parameter_list) {
+        val = js_build_arguments(ctx, argc, argv);
+    } else {
+        val = js_build_mapped_arguments(ctx, argc, argv, sf,
+                                        min_int(argc, b->arg_count));
+    }
+    if (JS_IsException(val))
+        return -1;
+    sf->var_buf[idx] = val;
+    return 0;
+}
+
 static JSValue js_build_rest(JSContext *ctx, int first, int argc, JSValueConst *argv)
 {
     JSValue val;
@@ -15946,7 +18051,7 @@ static JSValue js_call_bound_function(JSContext *ctx, JSValueConst func_obj,
                                       JSValueConst this_obj,
                                       int argc, JSValueConst *argv, int flags)
 {
-    JSObject *p;
+    JSObject *p, *p1;
     JSBoundFunction *bf;
     JSValueConst *arg_buf, new_target;
     int arg_count, i;
@@ -15954,19 +18059,35 @@ static JSValue js_call_bound_function(JSContext *ctx, JSValueConst func_obj,
     p = JS_VALUE_GET_OBJ(func_obj);
     bf = p->u.bound_function;
     arg_count = bf->argc + argc;
-    if (js_check_stack_overflow(ctx->rt, sizeof(JSValue) * arg_count))
-        return JS_ThrowStackOverflow(ctx);
-    arg_buf = alloca(sizeof(JSValue) * arg_count);
-    for(i = 0; i < bf->argc; i++) {
-        arg_buf[i] = bf->argv[i];
-    }
-    for(i = 0; i < argc; i++) {
-        arg_buf[bf->argc + i] = argv[i];
+    if (bf->argc == 0) {
+        arg_buf = argv;
+    } else {
+        if (js_check_stack_overflow(ctx->rt, sizeof(JSValue) * arg_count))
+            return JS_ThrowStackOverflow(ctx);
+        arg_buf = alloca(sizeof(JSValue) * arg_count);
+        for(i = 0; i < bf->argc; i++) {
+            arg_buf[i] = bf->argv[i];
+        }
+        for(i = 0; i < argc; i++) {
+            arg_buf[bf->argc + i] = argv[i];
+        }
     }
     if (flags & JS_CALL_FLAG_CONSTRUCTOR) {
         new_target = this_obj;
-        if (js_same_value(ctx, func_obj, new_target))
-            new_target = bf->func_obj;
+        /* new.target is replaced by the target function if it is
+           this bound function or one of the bound functions merged
+           into it */
+        p1 = p;
+        for(;;) {
+            if (JS_VALUE_GET_TAG(new_target) == JS_TAG_OBJECT &&
+                JS_VALUE_GET_OBJ(new_target) == p1) {
+                new_target = bf->func_obj;
+                break;
+            }
+            if (JS_IsUndefined(p1->u.bound_function->inner_func_obj))
+                break;
+            p1 = JS_VALUE_GET_OBJ(p1->u.bound_function->inner_func_obj);
+        }
         return JS_CallConstructor2(ctx, bf->func_obj, new_target,
                                    arg_count, arg_buf);
     } else {
@@ -16070,6 +18191,16 @@ static JSValue JS_CallInternal(JSContext *caller_ctx, JSValueConst func_obj,
         }
     }
     p = JS_VALUE_GET_OBJ(func_obj);
+    if (unlikely(p->class_id == JS_CLASS_BOUND_FUNCTION) &&
+        p->u.bound_function->argc == 0 &&
+        !(flags & JS_CALL_FLAG_CONSTRUCTOR)) {
+        /* no bound arguments: directly call the target function. The
+           caller keeps the bound function alive during the call. */
+        JSBoundFunction *bf = p->u.bound_function;
+        func_obj = bf->func_obj;
+        this_obj = bf->this_val;
+        p = JS_VALUE_GET_OBJ(func_obj);
+    }
     if (unlikely(p->class_id != JS_CLASS_BYTECODE_FUNCTION)) {
         JSClassCall *call_func;
         call_func = rt->class_array[p->class_id].call;
@@ -17019,6 +19150,68 @@ static JSValue JS_CallInternal(JSContext *caller_ctx, JSValueConst func_obj,
             }
             BREAK;
 
+        CASE(OP_get_arguments):
+            {
+                int idx;
+                idx = get_u16(pc);
+                pc += 2;
+                if (unlikely(JS_IsUndefined(var_buf[idx]))) {
+                    if (js_build_lazy_arguments(ctx, sf, argc,
+                                                (JSValueConst *)argv, idx))
+                        goto exception;
+                }
+                sp[0] = JS_DupValue(ctx, var_buf[idx]);
+                sp++;
+            }
+            BREAK;
+
+        CASE(OP_get_arguments_length):
+            {
+                JSValue val;
+                int idx;
+                idx = get_u16(pc);
+                pc += 2;
+                if (likely(JS_IsUndefined(var_buf[idx]))) {
+                    val = JS_NewInt32(ctx, argc);
+                } else {
+                    val = JS_GetProperty(ctx, var_buf[idx], JS_ATOM_length);
+                    if (unlikely(JS_IsException(val)))
+                        goto exception;
+                }
+                *sp++ = val;
+            }
+            BREAK;
+
+        CASE(OP_get_arguments_el):
+            {
+                JSValue val;
+                uint32_t i;
+                int idx;
+                idx = get_u16(pc);
+                pc += 2;
+                /* while the object is not built, the parameters hold
+                   the mapped values and argv the other ones */
+                if (likely(JS_IsUndefined(var_buf[idx]) &&
+                           JS_VALUE_GET_TAG(sp[-1]) == JS_TAG_INT &&
+                           (i = JS_VALUE_GET_INT(sp[-1])) < argc)) {
+                    if (i < b->arg_count)
+                        sp[-1] = JS_DupValue(ctx, arg_buf[i]);
+                    else
+                        sp[-1] = JS_DupValue(ctx, argv[i]);
+                } else {
+                    if (JS_IsUndefined(var_buf[idx])) {
+                        if (js_build_lazy_arguments(ctx, sf, argc,
+                                                    (JSValueConst *)argv, idx))
+                            goto exception;
+                    }
+                    val = JS_GetPropertyValue(ctx, var_buf[idx], sp[-1]);
+                    sp[-1] = val;
+                    if (unlikely(JS_IsException(val)))
+                        goto exception;
+                }
+            }
+            BREAK;
+
         CASE(OP_make_loc_ref):
         CASE(OP_make_arg_ref):
         CASE(OP_make_var_ref_ref):
@@ -30873,10 +33066,54 @@ static void put_short_code(DynBuf *bc_out, int op, int idx)
     dbuf_put_u16(bc_out, idx);
 }
 
+/* return TRUE if the 'arguments' object can be built on first use
+   instead of at function entry. Its variable must only be read with
+   get_loc. For unmapped arguments, the parameters must also never be
+   modified because the object is then built from the current values. */
+static BOOL can_defer_arguments(JSFunctionDef *s)
+{
+    const uint8_t *bc_buf = s->byte_code.buf;
+    int pos, op, idx, i;
+    BOOL is_mapped;
+
+    idx = s->arguments_var_idx;
+    if (s->has_eval_call || s->vars[idx].is_captured)
+        return FALSE;
+    is_mapped = !(s->js_mode & JS_MODE_STRICT) && s->has_simple_parameter_list;
+    if (!is_mapped) {
+        for(i = 0; i < s->arg_count; i++) {
+            if (s->args[i].is_captured)
+                return FALSE;
+        }
+    }
+    for (pos = 0; pos < s->byte_code.size; pos += opcode_info[op].size) {
+        op = bc_buf[pos];
+        switch(opcode_info[op].fmt) {
+        case OP_FMT_loc:
+            if (op != OP_get_loc && get_u16(bc_buf + pos + 1) == idx)
+                return FALSE;
+            break;
+        case OP_FMT_arg:
+            if (!is_mapped && op != OP_get_arg)
+                return FALSE;
+            break;
+        case OP_FMT_atom_u16:
+            if ((op == OP_make_loc_ref && get_u16(bc_buf + pos + 5) == idx) ||
+                (op == OP_make_arg_ref && !is_mapped))
+                return FALSE;
+            break;
+        default:
+            break;
+        }
+    }
+    return TRUE;
+}
+
 /* peephole optimizations and resolve goto/labels */
 static __exception int resolve_labels(JSContext *ctx, JSFunctionDef *s)
 {
     int pos, pos_next, bc_len, op, op1, len, i, line_num;
+    int arguments_idx;
     const uint8_t *bc_buf;
     DynBuf bc_out;
     LabelSlot *label_slots, *ls;
@@ -30940,8 +33177,13 @@ static __exception int resolve_labels(JSContext *ctx, JSFunctionDef *s)
             put_short_code(&bc_out, OP_put_loc, s->this_var_idx);
         }
     }
-    /* initialize the 'arguments' variable if needed */
-    if (s->arguments_var_idx >= 0) {
+    /* initialize the 'arguments' variable if needed. When possible, it
+       is only built on first use by get_arguments and the
+       'arguments.length' and 'arguments[i]' reads do not build it. */
+    arguments_idx = -1;
+    if (s->arguments_var_idx >= 0 && can_defer_arguments(s)) {
+        arguments_idx = s->arguments_var_idx;
+    } else if (s->arguments_var_idx >= 0) {
         if ((s->js_mode & JS_MODE_STRICT) || !s->has_simple_parameter_list) {
             dbuf_putc(&bc_out, OP_special_object);
             dbuf_putc(&bc_out, OP_SPECIAL_OBJECT_ARGUMENTS);
@@ -31445,6 +33687,47 @@ static __exception int resolve_labels(JSContext *ctx, JSFunctionDef *s)
             goto no_change;
 
         case OP_get_loc:
+            if (get_u16(bc_buf + pos + 1) == arguments_idx) {
+                /* transformation:
+                   get_loc(a) get_field(length) -> get_arguments_length(a)
+                   get_loc(a) get_x(n) get_array_el -> get_x(n) get_arguments_el(a)
+                   get_loc(a) push_i32(x) get_array_el -> push_i32(x) get_arguments_el(a)
+                   get_loc(a) -> get_arguments(a)
+                 */
+                if (code_match(&cc, pos_next, OP_get_field, -1) &&
+                    cc.atom == JS_ATOM_length) {
+                    if (cc.line_num >= 0) line_num = cc.line_num;
+                    JS_FreeAtom(ctx, cc.atom);
+                    add_pc2line_info(s, bc_out.size, line_num);
+                    dbuf_putc(&bc_out, OP_get_arguments_length);
+                    dbuf_put_u16(&bc_out, arguments_idx);
+                    pos_next = cc.pos;
+                    break;
+                }
+                if (code_match(&cc, pos_next, M4(OP_get_loc, OP_get_loc_check, OP_get_arg, OP_get_var_ref), -1, OP_get_array_el, -1) &&
+                    !(cc.op == OP_get_loc && cc.idx == arguments_idx)) {
+                    if (cc.line_num >= 0) line_num = cc.line_num;
+                    add_pc2line_info(s, bc_out.size, line_num);
+                    put_short_code(&bc_out, cc.op, cc.idx);
+                    dbuf_putc(&bc_out, OP_get_arguments_el);
+                    dbuf_put_u16(&bc_out, arguments_idx);
+                    pos_next = cc.pos;
+                    break;
+                }
+                if (code_match(&cc, pos_next, OP_push_i32, OP_get_array_el, -1)) {
+                    if (cc.line_num >= 0) line_num = cc.line_num;
+                    add_pc2line_info(s, bc_out.size, line_num);
+                    push_short_int(&bc_out, cc.label);
+                    dbuf_putc(&bc_out, OP_get_arguments_el);
+                    dbuf_put_u16(&bc_out, arguments_idx);
+                    pos_next = cc.pos;
+                    break;
+                }
+                add_pc2line_info(s, bc_out.size, line_num);
+                dbuf_putc(&bc_out, OP_get_arguments);
+                dbuf_put_u16(&bc_out, arguments_idx);
+                break;
+            }
             if (OPTIMIZE) {
                 /* transformation:
                    get_loc(n) post_dec put_loc(n) drop -> dec_loc(n)
@@ -31503,7 +33786,8 @@ static __exception int resolve_labels(JSContext *ctx, JSFunctionDef *s)
                    get_loc(n) get_arg(x) add dup put_loc(n) drop -> get_arg(x) add_loc(n)
                    get_loc(n) get_var_ref(x) add dup put_loc(n) drop -> get_var_ref(x) add_loc(n)
                  */
-                if (code_match(&cc, pos_next, M3(OP_get_loc, OP_get_arg, OP_get_var_ref), -1, OP_add, OP_dup, OP_put_loc, idx, OP_drop, -1)) {
+                if (code_match(&cc, pos_next, M3(OP_get_loc, OP_get_arg, OP_get_var_ref), -1, OP_add, OP_dup, OP_put_loc, idx, OP_drop, -1) &&
+                    !(cc.op == OP_get_loc && cc.idx == arguments_idx)) {
                     if (cc.line_num >= 0) line_num = cc.line_num;
                     add_pc2line_info(s, bc_out.size, line_num);
                     put_short_code(&bc_out, cc.op, cc.idx);
@@ -33193,20 +35477,6 @@ int JS_ResolveModule(JSContext *ctx, JSValueConst obj)
 /*******************************************************************/
 /* object list */
 
-typedef struct {
-    JSObject *obj;
-    uint32_t hash_next; /* -1 if no next entry */
-} JSObjectListEntry;
-
-/* XXX: reuse it to optimize weak references */
-typedef struct {
-    JSObjectListEntry *object_tab;
-    int object_count;
-    int object_size;
-    uint32_t *hash_table;
-    uint32_t hash_size;
-} JSObjectList;
-
 static void js_object_list_init(JSObjectList *s)
 {
     memset(s, 0, sizeof(*s));
@@ -33319,12 +35589,20 @@ typedef enum BCTagEnum {
     BC_TAG_DATE,
     BC_TAG_OBJECT_VALUE,
     BC_TAG_OBJECT_REFERENCE,
+    BC_TAG_HEAP_OBJECT,
+    BC_TAG_HEAP_ARRAY,
+    BC_TAG_CLOSURE,
+    BC_TAG_MAP,
+    BC_TAG_REGEXP,
+    BC_TAG_INTRINSIC,
+    BC_TAG_HOST_OBJECT,
 } BCTagEnum;
 
+/* must be changed when the opcodes or the object encoding change */
 #ifdef CONFIG_BIGNUM
-#define BC_BASE_VERSION 2
+#define BC_BASE_VERSION 4
 #else
-#define BC_BASE_VERSION 1
+#define BC_BASE_VERSION 3
 #endif
 #define BC_BE_VERSION 0x40
 #ifdef WORDS_BIGENDIAN
@@ -33351,8 +35629,33 @@ typedef struct BCWriterState {
     int sab_tab_size;
     /* list of referenced objects (used if allow_reference = TRUE) */
     JSObjectList object_list;
+    BOOL allow_heap : 8;
+    /* the following lists are used if allow_heap = TRUE. The var refs
+       and function bytecodes are stored as JSObject pointers because
+       only their address is used. */
+    JSObjectList var_ref_list;
+    JSObjectList bytecode_list;
+    JSObjectList intrinsic_list;
+    struct BCIntrinsicPath *intrinsic_path; /* same index as intrinsic_list */
+    int intrinsic_path_size;
 } BCWriterState;
 
+typedef enum {
+    BC_PATH_ROOT,
+    BC_PATH_PROTO,
+    BC_PATH_VALUE,
+    BC_PATH_GETTER,
+    BC_PATH_SETTER,
+} BCPathKindEnum;
+
+/* how a built-in object was reached from the global object or from a
+   class prototype */
+typedef struct BCIntrinsicPath {
+    int parent; /* index in intrinsic_list, -1 for a root */
+    uint8_t kind; /* BC_PATH_x */
+    JSAtom atom; /* property name or root index */
+} BCIntrinsicPath;
+
 #ifdef DUMP_READ_OBJECT
 static const char * const bc_tag_str[] = {
     "invalid",
@@ -33377,6 +35680,13 @@ static const char * const bc_tag_str[] = {
     "Date",
     "ObjectValue",
     "ObjectReference",
+    "HeapObject",
+    "HeapArray",
+    "Closure",
+    "Map",
+    "RegExp",
+    "Intrinsic",
+    "HostObject",
 };
 #endif
 
@@ -33589,9 +35899,9 @@ static void JS_WriteString(BCWriterState *s, JSString *p)
     bc_put_leb128(s, ((uint32_t)p->len << 1) | p->is_wide_char);
     if (p->is_wide_char) {
         for(i = 0; i < p->len; i++)
-            bc_put_u16(s, p->u.str16[i]);
+            bc_put_u16(s, js_str16(p)[i]);
     } else {
-        dbuf_put(&s->dbuf, p->u.str8, p->len);
+        dbuf_put(&s->dbuf, js_str8(p), p->len);
     }
 }
 
@@ -33992,6 +36302,396 @@ static int JS_WriteSharedArrayBuffer(BCWriterState *s, JSValueConst obj)
     return 0;
 }
 
+static BOOL js_is_hibernation_baseline(JSContext *ctx, JSAtom atom,
+                                       int prop_flags)
+{
+    int i;
+
+    if (!ctx->hibernation_baseline)
+        return !(prop_flags & JS_PROP_ENUMERABLE);
+    for(i = 0; i < ctx->hibernation_baseline_count; i++) {
+        if (ctx->hibernation_baseline[i] == atom)
+            return TRUE;
+    }
+    return FALSE;
+}
+
+static int bc_add_intrinsic(BCWriterState *s, JSValueConst val,
+                            int parent, int kind, JSAtom atom)
+{
+    BCIntrinsicPath *ip;
+    JSObject *p;
+
+    if (JS_VALUE_GET_TAG(val) != JS_TAG_OBJECT)
+        return 0;
+    p = JS_VALUE_GET_OBJ(val);
+    if (js_object_list_find(s->ctx, &s->intrinsic_list, p) >= 0)
+        return 0;
+    if (js_resize_array(s->ctx, (void **)&s->intrinsic_path,
+                        sizeof(s->intrinsic_path[0]),
+                        &s->intrinsic_path_size,
+                        s->intrinsic_list.object_count + 1))
+        return -1;
+    ip = &s->intrinsic_path[s->intrinsic_list.object_count];
+    ip->parent = parent;
+    ip->kind = kind;
+    ip->atom = atom;
+    return js_object_list_add(s->ctx, &s->intrinsic_list, p);
+}
+
+/* list the objects reachable from the built-in global properties and
+   from the class prototypes. They are written as a path so that the
+   reader uses its own built-in objects. */
+static int bc_init_intrinsics(BCWriterState *s)
+{
+    JSContext *ctx = s->ctx;
+    JSObject *p, *global_obj;
+    JSShape *sh;
+    JSShapeProperty *prs;
+    JSProperty *pr;
+    int i, idx, ret;
+
+    if (bc_add_intrinsic(s, ctx->global_obj, -1, BC_PATH_ROOT, 0))
+        return -1;
+    for(i = 0; i < ctx->rt->class_count; i++) {
+        if (bc_add_intrinsic(s, ctx->class_proto[i], -1, BC_PATH_ROOT, i + 1))
+            return -1;
+    }
+    global_obj = JS_VALUE_GET_OBJ(ctx->global_obj);
+    for(idx = 0; idx < s->intrinsic_list.object_count; idx++) {
+        p = s->intrinsic_list.object_tab[idx].obj;
+        sh = p->shape;
+        if (sh->proto &&
+            bc_add_intrinsic(s, JS_MKPTR(JS_TAG_OBJECT, sh->proto), idx,
+                             BC_PATH_PROTO, JS_ATOM_NULL))
+            return -1;
+        for(i = 0, prs = get_shape_prop(sh); i < sh->prop_count; i++, prs++) {
+            if (prs->atom == JS_ATOM_NULL)
+                continue;
+            if (p == global_obj &&
+                !js_is_hibernation_baseline(ctx, prs->atom, prs->flags))
+                continue;
+            pr = &p->prop[i];
+            switch(prs->flags & JS_PROP_TMASK) {
+            case JS_PROP_NORMAL:
+                ret = bc_add_intrinsic(s, pr->u.value, idx,
+                                       BC_PATH_VALUE, prs->atom);
+                break;
+            case JS_PROP_GETSET:
+                ret = 0;
+                if (pr->u.getset.getter)
+                    ret = bc_add_intrinsic(s, JS_MKPTR(JS_TAG_OBJECT, pr->u.getset.getter),
+                                           idx, BC_PATH_GETTER, prs->atom);
+                if (!ret && pr->u.getset.setter)
+                    ret = bc_add_intrinsic(s, JS_MKPTR(JS_TAG_OBJECT, pr->u.getset.setter),
+                                           idx, BC_PATH_SETTER, prs->atom);
+                break;
+            case JS_PROP_VARREF:
+                ret = bc_add_intrinsic(s, *pr->u.var_ref->pvalue, idx,
+                                       BC_PATH_VALUE, prs->atom);
+                break;
+            default:
+                /* not instantiated yet, so not referenced */
+                ret = 0;
+                break;
+            }
+            if (ret)
+                return -1;
+        }
+    }
+    return 0;
+}
+
+static int bc_put_intrinsic_path(BCWriterState *s, int idx)
+{
+    BCIntrinsicPath *ip = &s->intrinsic_path[idx];
+
+    if (ip->parent < 0) {
+        bc_put_leb128(s, ip->atom);
+        return 0;
+    }
+    if (bc_put_intrinsic_path(s, ip->parent))
+        return -1;
+    bc_put_u8(s, ip->kind);
+    if (ip->kind != BC_PATH_PROTO)
+        return bc_put_atom(s, ip->atom);
+    return 0;
+}
+
+static int JS_WriteIntrinsic(BCWriterState *s, int idx)
+{
+    int i, depth;
+
+    depth = 0;
+    for(i = idx; s->intrinsic_path[i].parent >= 0; i = s->intrinsic_path[i].parent)
+        depth++;
+    bc_put_u8(s, BC_TAG_INTRINSIC);
+    bc_put_leb128(s, depth);
+    return bc_put_intrinsic_path(s, idx);
+}
+
+/* return 1 if the property must be written, 0 if it is skipped */
+static int bc_is_heap_property(BCWriterState *s, JSObject *p,
+                               JSShapeProperty *prs, JSProperty *pr)
+{
+    JSContext *ctx = s->ctx;
+
+    if (prs->atom == JS_ATOM_NULL || (prs->flags & JS_PROP_LENGTH))
+        return 0;
+    if (p == JS_VALUE_GET_OBJ(ctx->global_obj) &&
+        js_is_hibernation_baseline(ctx, prs->atom, prs->flags))
+        return 0;
+    if (p == JS_VALUE_GET_OBJ(ctx->global_var_obj) &&
+        JS_VALUE_GET_TAG(pr->u.value) == JS_TAG_UNINITIALIZED)
+        return 0;
+    if (prs->atom >= JS_ATOM_END && !JS_AtomIsString(ctx, prs->atom)) {
+        JS_ThrowTypeError(ctx, "unsupported symbol property");
+        return -1;
+    }
+    if ((prs->flags & JS_PROP_TMASK) == JS_PROP_AUTOINIT &&
+        (pr->u.init.realm_and_id & 3) != JS_AUTOINIT_ID_PROTOTYPE) {
+        JS_ThrowTypeError(ctx, "unsupported lazy property");
+        return -1;
+    }
+    return 1;
+}
+
+static int JS_WriteHeapProperties(BCWriterState *s, JSObject *p)
+{
+    JSShape *sh = p->shape;
+    JSShapeProperty *prs;
+    JSProperty *pr;
+    uint32_t i, prop_count;
+    int pass, ret, flags;
+
+    prop_count = 0;
+    for(pass = 0; pass < 2; pass++) {
+        if (pass == 1)
+            bc_put_leb128(s, prop_count);
+        for(i = 0, prs = get_shape_prop(sh); i < sh->prop_count; i++, prs++) {
+            pr = &p->prop[i];
+            ret = bc_is_heap_property(s, p, prs, pr);
+            if (ret < 0)
+                return -1;
+            if (!ret)
+                continue;
+            if (pass == 0) {
+                prop_count++;
+                continue;
+            }
+            flags = prs->flags & (JS_PROP_C_W_E | JS_PROP_TMASK);
+            if ((flags & JS_PROP_TMASK) == JS_PROP_VARREF)
+                flags &= ~JS_PROP_TMASK;
+            if (bc_put_atom(s, prs->atom))
+                return -1;
+            bc_put_u8(s, flags);
+            switch(prs->flags & JS_PROP_TMASK) {
+            case JS_PROP_NORMAL:
+                ret = JS_WriteObjectRec(s, pr->u.value);
+                break;
+            case JS_PROP_GETSET:
+                ret = JS_WriteObjectRec(s, pr->u.getset.getter ?
+                                        JS_MKPTR(JS_TAG_OBJECT, pr->u.getset.getter) :
+                                        JS_UNDEFINED);
+                if (!ret)
+                    ret = JS_WriteObjectRec(s, pr->u.getset.setter ?
+                                            JS_MKPTR(JS_TAG_OBJECT, pr->u.getset.setter) :
+                                            JS_UNDEFINED);
+                break;
+            case JS_PROP_VARREF:
+                ret = JS_WriteObjectRec(s, *pr->u.var_ref->pvalue);
+                break;
+            default:
+                /* the 'prototype' property of a function is created
+                   again when it is first accessed */
+                ret = 0;
+                break;
+            }
+            if (ret)
+                return -1;
+        }
+    }
+    return 0;
+}
+
+/* prototype, own properties and extensibility */
+static int JS_WriteHeapObjectTail(BCWriterState *s, JSObject *p)
+{
+    JSObject *proto = p->shape->proto;
+
+    if (JS_WriteObjectRec(s, proto ? JS_MKPTR(JS_TAG_OBJECT, proto) : JS_NULL))
+        return -1;
+    if (JS_WriteHeapProperties(s, p))
+        return -1;
+    bc_put_u8(s, p->extensible);
+    return 0;
+}
+
+static int JS_WriteHeapArray(BCWriterState *s, JSObject *p)
+{
+    JSShapeProperty *prs = get_shape_prop(p->shape);
+    uint32_t i, len;
+
+    bc_put_u8(s, BC_TAG_HEAP_ARRAY);
+    if (JS_ToUint32(s->ctx, &len, p->prop[0].u.value))
+        return -1;
+    bc_put_leb128(s, len);
+    if (p->fast_array) {
+        bc_put_leb128(s, p->u.array.count);
+        for(i = 0; i < p->u.array.count; i++) {
+            if (JS_WriteObjectRec(s, p->u.array.u.values[i]))
+                return -1;
+        }
+    } else {
+        /* the elements are written as properties */
+        bc_put_leb128(s, 0);
+    }
+    if (JS_WriteHeapObjectTail(s, p))
+        return -1;
+    bc_put_u8(s, (prs[0].flags & JS_PROP_WRITABLE) != 0);
+    return 0;
+}
+
+static int JS_WriteClosure(BCWriterState *s, JSObject *p)
+{
+    JSContext *ctx = s->ctx;
+    JSFunctionBytecode *b = p->u.func.function_bytecode;
+    JSObject *home_object = p->u.func.home_object;
+    JSVarRef *var_ref;
+    int i, idx;
+
+    bc_put_u8(s, BC_TAG_CLOSURE);
+    bc_put_u8(s, b->func_kind);
+    bc_put_u8(s, p->is_constructor);
+    /* the function bytecode is shared by the closures */
+    idx = js_object_list_find(ctx, &s->bytecode_list, (JSObject *)b);
+    if (idx >= 0) {
+        bc_put_leb128(s, idx);
+    } else {
+        bc_put_leb128(s, s->bytecode_list.object_count);
+        if (js_object_list_add(ctx, &s->bytecode_list, (JSObject *)b))
+            return -1;
+        if (JS_WriteFunctionTag(s, JS_MKPTR(JS_TAG_FUNCTION_BYTECODE, b)))
+            return -1;
+    }
+    /* so are the closure variables */
+    for(i = 0; i < b->closure_var_count; i++) {
+        var_ref = p->u.func.var_refs[i];
+        if (!var_ref->is_detached) {
+            JS_ThrowTypeError(ctx, "cannot save the variables of a running function");
+            return -1;
+        }
+        idx = js_object_list_find(ctx, &s->var_ref_list, (JSObject *)var_ref);
+        if (idx >= 0) {
+            bc_put_leb128(s, idx);
+        } else {
+            bc_put_leb128(s, s->var_ref_list.object_count);
+            if (js_object_list_add(ctx, &s->var_ref_list, (JSObject *)var_ref))
+                return -1;
+            if (JS_WriteObjectRec(s, var_ref->value))
+                return -1;
+        }
+    }
+    if (JS_WriteObjectRec(s, home_object ? JS_MKPTR(JS_TAG_OBJECT, home_object) :
+                          JS_UNDEFINED))
+        return -1;
+    return JS_WriteHeapObjectTail(s, p);
+}
+
+static int JS_WriteMap(BCWriterState *s, JSObject *p)
+{
+    JSContext *ctx = s->ctx;
+    JSValue tab;
+    JSObject *p1;
+    uint32_t i;
+    BOOL is_set;
+    int ret;
+
+    is_set = (p->class_id == JS_CLASS_SET);
+    tab = js_map_to_array(ctx, JS_MKPTR(JS_TAG_OBJECT, p));
+    if (JS_IsException(tab))
+        return -1;
+    p1 = JS_VALUE_GET_OBJ(tab);
+    bc_put_u8(s, BC_TAG_MAP);
+    bc_put_u8(s, is_set);
+    bc_put_leb128(s, p1->u.array.count / 2);
+    ret = 0;
+    for(i = 0; i < p1->u.array.count; i++) {
+        if (is_set && (i & 1))
+            continue;
+        ret = JS_WriteObjectRec(s, p1->u.array.u.values[i]);
+        if (ret)
+            break;
+    }
+    JS_FreeValue(ctx, tab);
+    if (ret)
+        return -1;
+    return JS_WriteHeapObjectTail(s, p);
+}
+
+static int JS_WriteRegExp(BCWriterState *s, JSObject *p)
+{
+    bc_put_u8(s, BC_TAG_REGEXP);
+    JS_WriteString(s, p->u.regexp.pattern);
+    JS_WriteString(s, p->u.regexp.bytecode);
+    return JS_WriteHeapObjectTail(s, p);
+}
+
+/* object of a class defined with a save function (see JSClassDef) */
+static int JS_WriteHostObject(BCWriterState *s, JSObject *p)
+{
+    JSContext *ctx = s->ctx;
+    JSClass *cl = &ctx->rt->class_array[p->class_id];
+    JSValue data;
+    int ret;
+
+    data = cl->save(ctx, JS_MKPTR(JS_TAG_OBJECT, p));
+    if (JS_IsException(data))
+        return -1;
+    bc_put_u8(s, BC_TAG_HOST_OBJECT);
+    ret = bc_put_atom(s, cl->class_name);
+    if (!ret)
+        ret = JS_WriteObjectRec(s, data);
+    JS_FreeValue(ctx, data);
+    if (ret)
+        return -1;
+    return JS_WriteHeapObjectTail(s, p);
+}
+
+/* return 1 if the object is not handled here */
+static int JS_WriteHeapObject(BCWriterState *s, JSObject *p)
+{
+    int idx;
+
+    idx = js_object_list_find(s->ctx, &s->intrinsic_list, p);
+    if (idx >= 0)
+        return JS_WriteIntrinsic(s, idx);
+    switch(p->class_id) {
+    case JS_CLASS_OBJECT:
+    case JS_CLASS_ERROR:
+        bc_put_u8(s, BC_TAG_HEAP_OBJECT);
+        bc_put_u8(s, p->class_id == JS_CLASS_ERROR);
+        return JS_WriteHeapObjectTail(s, p);
+    case JS_CLASS_ARRAY:
+        return JS_WriteHeapArray(s, p);
+    case JS_CLASS_BYTECODE_FUNCTION:
+    case JS_CLASS_GENERATOR_FUNCTION:
+    case JS_CLASS_ASYNC_FUNCTION:
+    case JS_CLASS_ASYNC_GENERATOR_FUNCTION:
+        return JS_WriteClosure(s, p);
+    case JS_CLASS_MAP:
+    case JS_CLASS_SET:
+        return JS_WriteMap(s, p);
+    case JS_CLASS_REGEXP:
+        return JS_WriteRegExp(s, p);
+    default:
+        if (p->class_id >= JS_CLASS_INIT_COUNT &&
+            s->ctx->rt->class_array[p->class_id].save)
+            return JS_WriteHostObject(s, p);
+        return 1;
+    }
+}
+
 static int JS_WriteObjectRec(BCWriterState *s, JSValueConst obj)
 {
     uint32_t tag;
@@ -34065,6 +36765,11 @@ static int JS_WriteObjectRec(BCWriterState *s, JSValueConst obj)
                 }
                 p->tmp_mark = 1;
             }
+            if (s->allow_heap) {
+                ret = JS_WriteHeapObject(s, p);
+                if (ret <= 0)
+                    goto done;
+            }
             switch(p->class_id) {
             case JS_CLASS_ARRAY:
                 ret = JS_WriteArray(s, obj);
@@ -34105,6 +36810,7 @@ static int JS_WriteObjectRec(BCWriterState *s, JSValueConst obj)
                 }
                 break;
             }
+        done:
             p->tmp_mark = 0;
             if (ret)
                 goto fail;
@@ -34169,8 +36875,36 @@ static int JS_WriteObjectAtoms(BCWriterState *s)
     return -1;
 }
 
-uint8_t *JS_WriteObject2(JSContext *ctx, size_t *psize, JSValueConst obj,
-                         int flags, uint8_t ***psab_tab, size_t *psab_tab_len)
+static void bc_writer_free(BCWriterState *s)
+{
+    JSContext *ctx = s->ctx;
+
+    js_object_list_end(ctx, &s->object_list);
+    js_object_list_end(ctx, &s->var_ref_list);
+    js_object_list_end(ctx, &s->bytecode_list);
+    js_object_list_end(ctx, &s->intrinsic_list);
+    js_free(ctx, s->intrinsic_path);
+    js_free(ctx, s->atom_to_idx);
+    js_free(ctx, s->idx_to_atom);
+}
+
+/* the global variables of the context followed by 'extra' */
+static int JS_WriteContextState(BCWriterState *s, JSValueConst extra)
+{
+    JSContext *ctx = s->ctx;
+
+    if (JS_WriteHeapProperties(s, JS_VALUE_GET_OBJ(ctx->global_obj)))
+        return -1;
+    if (JS_WriteHeapProperties(s, JS_VALUE_GET_OBJ(ctx->global_var_obj)))
+        return -1;
+    return JS_WriteObjectRec(s, extra);
+}
+
+static uint8_t *JS_WriteObjectInternal(JSContext *ctx, size_t *psize,
+                                       JSValueConst obj, int flags,
+                                       uint8_t ***psab_tab,
+                                       size_t *psab_tab_len,
+                                       BOOL is_context_state)
 {
     BCWriterState ss, *s = &ss;
 
@@ -34178,9 +36912,12 @@ uint8_t *JS_WriteObject2(JSContext *ctx, size_t *psize, JSValueConst obj,
     s->ctx = ctx;
     /* XXX: byte swapped output is untested */
     s->byte_swap = ((flags & JS_WRITE_OBJ_BSWAP) != 0);
-    s->allow_bytecode = ((flags & JS_WRITE_OBJ_BYTECODE) != 0);
+    s->allow_heap = ((flags & JS_WRITE_OBJ_HEAP) != 0);
+    s->allow_bytecode = ((flags & JS_WRITE_OBJ_BYTECODE) != 0) ||
+        s->allow_heap;
     s->allow_sab = ((flags & JS_WRITE_OBJ_SAB) != 0);
-    s->allow_reference = ((flags & JS_WRITE_OBJ_REFERENCE) != 0);
+    s->allow_reference = ((flags & JS_WRITE_OBJ_REFERENCE) != 0) ||
+        s->allow_heap;
     /* XXX: could use a different version when bytecode is included */
     if (s->allow_bytecode)
         s->first_atom = JS_ATOM_END;
@@ -34188,14 +36925,22 @@ uint8_t *JS_WriteObject2(JSContext *ctx, size_t *psize, JSValueConst obj,
         s->first_atom = 1;
     js_dbuf_init(ctx, &s->dbuf);
     js_object_list_init(&s->object_list);
-    
-    if (JS_WriteObjectRec(s, obj))
+    js_object_list_init(&s->var_ref_list);
+    js_object_list_init(&s->bytecode_list);
+    js_object_list_init(&s->intrinsic_list);
+    if (s->allow_heap && bc_init_intrinsics(s))
         goto fail;
+    
+    if (is_context_state) {
+        if (JS_WriteContextState(s, obj))
+            goto fail;
+    } else {
+        if (JS_WriteObjectRec(s, obj))
+            goto fail;
+    }
     if (JS_WriteObjectAtoms(s))
         goto fail;
-    js_object_list_end(ctx, &s->object_list);
-    js_free(ctx, s->atom_to_idx);
-    js_free(ctx, s->idx_to_atom);
+    bc_writer_free(s);
     *psize = s->dbuf.size;
     if (psab_tab)
         *psab_tab = s->sab_tab;
@@ -34203,9 +36948,7 @@ uint8_t *JS_WriteObject2(JSContext *ctx, size_t *psize, JSValueConst obj,
         *psab_tab_len = s->sab_tab_len;
     return s->dbuf.buf;
  fail:
-    js_object_list_end(ctx, &s->object_list);
-    js_free(ctx, s->atom_to_idx);
-    js_free(ctx, s->idx_to_atom);
+    bc_writer_free(s);
     dbuf_free(&s->dbuf);
     *psize = 0;
     if (psab_tab)
@@ -34215,6 +36958,13 @@ uint8_t *JS_WriteObject2(JSContext *ctx, size_t *psize, JSValueConst obj,
     return NULL;
 }
 
+uint8_t *JS_WriteObject2(JSContext *ctx, size_t *psize, JSValueConst obj,
+                         int flags, uint8_t ***psab_tab, size_t *psab_tab_len)
+{
+    return JS_WriteObjectInternal(ctx, psize, obj, flags,
+                                  psab_tab, psab_tab_len, FALSE);
+}
+
 uint8_t *JS_WriteObject(JSContext *ctx, size_t *psize, JSValueConst obj,
                         int flags)
 {
@@ -34232,10 +36982,19 @@ typedef struct BCReaderState {
     BOOL allow_bytecode : 8;
     BOOL is_rom_data : 8;
     BOOL allow_reference : 8;
+    BOOL allow_heap : 8;
     /* object references */
     JSObject **objects;
     int objects_count;
     int objects_size;
+    /* closure variables and function bytecodes shared by closures
+       (used if allow_heap = TRUE) */
+    JSVarRef **var_refs;
+    int var_refs_count;
+    int var_refs_size;
+    JSFunctionBytecode **bytecodes;
+    int bytecodes_count;
+    int bytecodes_size;
     
 #ifdef DUMP_READ_OBJECT
     const uint8_t *ptr_last;
@@ -35174,6 +37933,461 @@ static JSValue JS_ReadObjectValue(BCReaderState *s)
     return JS_EXCEPTION;
 }
 
+static JSValue JS_ReadIntrinsic(BCReaderState *s)
+{
+    JSContext *ctx = s->ctx;
+    JSPropertyDescriptor desc;
+    JSValue obj, val;
+    JSObject *proto;
+    uint32_t depth, root, i;
+    uint8_t kind;
+    JSAtom atom;
+    int ret;
+
+    if (bc_get_leb128(s, &depth) || bc_get_leb128(s, &root))
+        return JS_EXCEPTION;
+    if (root == 0) {
+        obj = ctx->global_obj;
+    } else if (root - 1 < ctx->rt->class_count) {
+        obj = ctx->class_proto[root - 1];
+    } else {
+        goto not_found;
+    }
+    obj = JS_DupValue(ctx, obj);
+    for(i = 0; i < depth; i++) {
+        if (!JS_IsObject(obj))
+            goto not_found;
+        if (bc_get_u8(s, &kind))
+            goto fail;
+        if (kind == BC_PATH_PROTO) {
+            proto = JS_VALUE_GET_OBJ(obj)->shape->proto;
+            val = proto ? JS_DupValue(ctx, JS_MKPTR(JS_TAG_OBJECT, proto)) : JS_NULL;
+        } else {
+            if (bc_get_atom(s, &atom))
+                goto fail;
+            ret = JS_GetOwnPropertyInternal(ctx, &desc, JS_VALUE_GET_OBJ(obj), atom);
+            JS_FreeAtom(ctx, atom);
+            if (ret < 0)
+                goto fail;
+            if (!ret)
+                goto not_found;
+            if (kind == BC_PATH_GETTER) {
+                val = JS_DupValue(ctx, desc.getter);
+            } else if (kind == BC_PATH_SETTER) {
+                val = JS_DupValue(ctx, desc.setter);
+            } else {
+                val = JS_DupValue(ctx, desc.value);
+            }
+            js_free_desc(ctx, &desc);
+        }
+        JS_FreeValue(ctx, obj);
+        obj = val;
+    }
+    if (!JS_IsObject(obj))
+        goto not_found;
+    if (BC_add_object_ref(s, obj))
+        goto fail;
+    return obj;
+ not_found:
+    JS_ThrowReferenceError(ctx, "built-in object not found");
+ fail:
+    JS_FreeValue(ctx, obj);
+    return JS_EXCEPTION;
+}
+
+static int JS_ReadHeapProperties(BCReaderState *s, JSValueConst obj)
+{
+    JSContext *ctx = s->ctx;
+    JSValue val, getter, setter;
+    JSProperty *pr;
+    uint32_t prop_count, i;
+    uint8_t flags;
+    JSAtom atom;
+    int ret;
+
+    if (bc_get_leb128(s, &prop_count))
+        return -1;
+    for(i = 0; i < prop_count; i++) {
+        if (bc_get_atom(s, &atom))
+            return -1;
+        if (bc_get_u8(s, &flags))
+            goto fail;
+#ifdef DUMP_READ_OBJECT
+        bc_read_trace(s, "propname: "); print_atom(s->ctx, atom); printf("\n");
+#endif
+        switch(flags & JS_PROP_TMASK) {
+        case JS_PROP_NORMAL:
+            val = JS_ReadObjectRec(s);
+            if (JS_IsException(val))
+                goto fail;
+            ret = JS_DefinePropertyValue(ctx, obj, atom, val,
+                                         (flags & JS_PROP_C_W_E) | JS_PROP_THROW);
+            break;
+        case JS_PROP_GETSET:
+            getter = JS_ReadObjectRec(s);
+            if (JS_IsException(getter))
+                goto fail;
+            setter = JS_ReadObjectRec(s);
+            if (JS_IsException(setter)) {
+                JS_FreeValue(ctx, getter);
+                goto fail;
+            }
+            if ((!JS_IsUndefined(getter) && !JS_IsFunction(ctx, getter)) ||
+                (!JS_IsUndefined(setter) && !JS_IsFunction(ctx, setter))) {
+                JS_ThrowSyntaxError(ctx, "invalid accessor");
+                ret = -1;
+            } else {
+                ret = JS_DefineProperty(ctx, obj, atom, JS_UNDEFINED,
+                                        getter, setter,
+                                        (flags & (JS_PROP_CONFIGURABLE | JS_PROP_ENUMERABLE)) |
+                                        JS_PROP_HAS_GET | JS_PROP_HAS_SET |
+                                        JS_PROP_HAS_CONFIGURABLE |
+                                        JS_PROP_HAS_ENUMERABLE | JS_PROP_THROW);
+            }
+            JS_FreeValue(ctx, getter);
+            JS_FreeValue(ctx, setter);
+            break;
+        case JS_PROP_AUTOINIT:
+            if (find_own_property(&pr, JS_VALUE_GET_OBJ(obj), atom)) {
+                JS_ThrowSyntaxError(ctx, "duplicate property");
+                goto fail;
+            }
+            ret = JS_DefineAutoInitProperty(ctx, obj, atom,
+                                            JS_AUTOINIT_ID_PROTOTYPE, NULL,
+                                            flags & JS_PROP_C_W_E);
+            break;
+        default:
+            JS_ThrowSyntaxError(ctx, "invalid property");
+            goto fail;
+        }
+        JS_FreeAtom(ctx, atom);
+        if (ret < 0)
+            return -1;
+    }
+    return 0;
+ fail:
+    JS_FreeAtom(ctx, atom);
+    return -1;
+}
+
+static int JS_ReadHeapObjectTail(BCReaderState *s, JSValueConst obj)
+{
+    JSContext *ctx = s->ctx;
+    JSValue proto;
+    uint8_t extensible;
+    int ret;
+
+    proto = JS_ReadObjectRec(s);
+    if (JS_IsException(proto))
+        return -1;
+    if (!JS_IsObject(proto) && !JS_IsNull(proto)) {
+        JS_FreeValue(ctx, proto);
+        JS_ThrowSyntaxError(ctx, "invalid prototype");
+        return -1;
+    }
+    ret = JS_SetPrototypeInternal(ctx, obj, proto, TRUE);
+    JS_FreeValue(ctx, proto);
+    if (ret < 0)
+        return -1;
+    if (JS_ReadHeapProperties(s, obj))
+        return -1;
+    if (bc_get_u8(s, &extensible))
+        return -1;
+    if (!extensible)
+        JS_PreventExtensions(ctx, obj);
+    return 0;
+}
+
+static JSValue JS_ReadHeapObject(BCReaderState *s)
+{
+    JSContext *ctx = s->ctx;
+    JSValue obj;
+    uint8_t is_error;
+
+    if (bc_get_u8(s, &is_error))
+        return JS_EXCEPTION;
+    obj = JS_NewObjectProtoClass(ctx, JS_NULL,
+                                 is_error ? JS_CLASS_ERROR : JS_CLASS_OBJECT);
+    if (JS_IsException(obj))
+        return obj;
+    if (BC_add_object_ref(s, obj))
+        goto fail;
+    if (JS_ReadHeapObjectTail(s, obj))
+        goto fail;
+    return obj;
+ fail:
+    JS_FreeValue(ctx, obj);
+    return JS_EXCEPTION;
+}
+
+static JSValue JS_ReadHeapArray(BCReaderState *s)
+{
+    JSContext *ctx = s->ctx;
+    JSValue obj, val;
+    uint32_t len, count, i;
+    uint8_t writable;
+
+    obj = JS_NewArray(ctx);
+    if (JS_IsException(obj))
+        return obj;
+    if (BC_add_object_ref(s, obj))
+        goto fail;
+    if (bc_get_leb128(s, &len) || bc_get_leb128(s, &count))
+        goto fail;
+    for(i = 0; i < count; i++) {
+        val = JS_ReadObjectRec(s);
+        if (JS_IsException(val))
+            goto fail;
+        if (JS_DefinePropertyValueUint32(ctx, obj, i, val, JS_PROP_C_W_E) < 0)
+            goto fail;
+    }
+    if (JS_SetProperty(ctx, obj, JS_ATOM_length, JS_NewUint32(ctx, len)) < 0)
+        goto fail;
+    if (JS_ReadHeapObjectTail(s, obj))
+        goto fail;
+    if (bc_get_u8(s, &writable))
+        goto fail;
+    if (!writable &&
+        JS_DefineProperty(ctx, obj, JS_ATOM_length, JS_UNDEFINED,
+                          JS_UNDEFINED, JS_UNDEFINED,
+                          JS_PROP_HAS_WRITABLE | JS_PROP_THROW) < 0)
+        goto fail;
+    return obj;
+ fail:
+    JS_FreeValue(ctx, obj);
+    return JS_EXCEPTION;
+}
+
+static JSValue JS_ReadClosure(BCReaderState *s)
+{
+    JSContext *ctx = s->ctx;
+    JSValue obj, val;
+    JSObject *p;
+    JSFunctionBytecode *b;
+    JSVarRef *var_ref;
+    uint8_t func_kind, is_constructor;
+    uint32_t idx;
+    int i;
+
+    if (bc_get_u8(s, &func_kind) || bc_get_u8(s, &is_constructor))
+        return JS_EXCEPTION;
+    if (func_kind > JS_FUNC_ASYNC_GENERATOR)
+        return JS_ThrowSyntaxError(ctx, "invalid function kind");
+    obj = JS_NewObjectProtoClass(ctx, JS_NULL, func_kind_to_class_id[func_kind]);
+    if (JS_IsException(obj))
+        return obj;
+    p = JS_VALUE_GET_OBJ(obj);
+    p->u.func.function_bytecode = NULL;
+    p->u.func.home_object = NULL;
+    p->u.func.var_refs = NULL;
+    p->is_constructor = is_constructor;
+    if (BC_add_object_ref(s, obj))
+        goto fail;
+
+    if (bc_get_leb128(s, &idx))
+        goto fail;
+    if (idx < s->bytecodes_count) {
+        b = s->bytecodes[idx];
+        JS_DupValue(ctx, JS_MKPTR(JS_TAG_FUNCTION_BYTECODE, b));
+    } else if (idx == s->bytecodes_count) {
+        val = JS_ReadObjectRec(s);
+        if (JS_IsException(val))
+            goto fail;
+        if (JS_VALUE_GET_TAG(val) != JS_TAG_FUNCTION_BYTECODE) {
+            JS_FreeValue(ctx, val);
+            goto invalid;
+        }
+        b = JS_VALUE_GET_PTR(val);
+        if (js_resize_array(ctx, (void **)&s->bytecodes,
+                            sizeof(s->bytecodes[0]),
+                            &s->bytecodes_size, s->bytecodes_count + 1)) {
+            JS_FreeValue(ctx, val);
+            goto fail;
+        }
+        s->bytecodes[s->bytecodes_count++] = b;
+    } else {
+        goto invalid;
+    }
+    p->u.func.function_bytecode = b;
+    if (b->func_kind != func_kind)
+        goto invalid;
+
+    if (b->closure_var_count != 0) {
+        p->u.func.var_refs = js_mallocz(ctx, sizeof(p->u.func.var_refs[0]) *
+                                        b->closure_var_count);
+        if (!p->u.func.var_refs)
+            goto fail;
+    }
+    for(i = 0; i < b->closure_var_count; i++) {
+        if (bc_get_leb128(s, &idx))
+            goto fail;
+        if (idx < s->var_refs_count) {
+            var_ref = s->var_refs[idx];
+            var_ref->header.ref_count++;
+            p->u.func.var_refs[i] = var_ref;
+        } else if (idx == s->var_refs_count) {
+            if (js_resize_array(ctx, (void **)&s->var_refs,
+                                sizeof(s->var_refs[0]),
+                                &s->var_refs_size, s->var_refs_count + 1))
+                goto fail;
+            var_ref = js_malloc(ctx, sizeof(JSVarRef));
+            if (!var_ref)
+                goto fail;
+            var_ref->header.ref_count = 1;
+            var_ref->is_detached = TRUE;
+            var_ref->is_arg = FALSE;
+            var_ref->var_idx = 0;
+            var_ref->value = JS_UNDEFINED;
+            var_ref->pvalue = &var_ref->value;
+            add_gc_object(ctx->rt, &var_ref->header, JS_GC_OBJ_TYPE_VAR_REF);
+            p->u.func.var_refs[i] = var_ref;
+            s->var_refs[s->var_refs_count++] = var_ref;
+            /* the value may reference this closure */
+            val = JS_ReadObjectRec(s);
+            if (JS_IsException(val))
+                goto fail;
+            var_ref->value = val;
+        } else {
+            goto invalid;
+        }
+    }
+
+    val = JS_ReadObjectRec(s);
+    if (JS_IsException(val))
+        goto fail;
+    if (JS_IsObject(val)) {
+        p->u.func.home_object = JS_VALUE_GET_OBJ(val);
+    } else if (!JS_IsUndefined(val)) {
+        JS_FreeValue(ctx, val);
+        goto invalid;
+    }
+    if (JS_ReadHeapObjectTail(s, obj))
+        goto fail;
+    return obj;
+ invalid:
+    JS_ThrowSyntaxError(ctx, "invalid closure");
+ fail:
+    JS_FreeValue(ctx, obj);
+    return JS_EXCEPTION;
+}
+
+static JSValue JS_ReadMap(BCReaderState *s)
+{
+    JSContext *ctx = s->ctx;
+    JSValue obj, ret;
+    JSValue args[2];
+    uint32_t count, i;
+    uint8_t is_set;
+    int magic;
+
+    if (bc_get_u8(s, &is_set) || bc_get_leb128(s, &count))
+        return JS_EXCEPTION;
+    magic = is_set ? MAGIC_SET : 0;
+    obj = js_map_constructor(ctx, JS_UNDEFINED, 0, NULL, magic);
+    if (JS_IsException(obj))
+        return obj;
+    if (BC_add_object_ref(s, obj))
+        goto fail;
+    for(i = 0; i < count; i++) {
+        args[0] = JS_ReadObjectRec(s);
+        if (JS_IsException(args[0]))
+            goto fail;
+        args[1] = JS_UNDEFINED;
+        if (!is_set) {
+            args[1] = JS_ReadObjectRec(s);
+            if (JS_IsException(args[1])) {
+                JS_FreeValue(ctx, args[0]);
+                goto fail;
+            }
+        }
+        ret = js_map_set(ctx, obj, 2, (JSValueConst *)args, magic);
+        JS_FreeValue(ctx, args[0]);
+        JS_FreeValue(ctx, args[1]);
+        if (JS_IsException(ret))
+            goto fail;
+        JS_FreeValue(ctx, ret);
+    }
+    if (JS_ReadHeapObjectTail(s, obj))
+        goto fail;
+    return obj;
+ fail:
+    JS_FreeValue(ctx, obj);
+    return JS_EXCEPTION;
+}
+
+static JSValue JS_ReadRegExp(BCReaderState *s)
+{
+    JSContext *ctx = s->ctx;
+    JSString *pattern, *bc;
+    JSValue obj;
+
+    pattern = JS_ReadString(s);
+    if (!pattern)
+        return JS_EXCEPTION;
+    bc = JS_ReadString(s);
+    if (!bc) {
+        js_free_string(ctx->rt, pattern);
+        return JS_EXCEPTION;
+    }
+    obj = js_regexp_constructor_internal(ctx, JS_UNDEFINED,
+                                         JS_MKPTR(JS_TAG_STRING, pattern),
+                                         JS_MKPTR(JS_TAG_STRING, bc));
+    if (JS_IsException(obj))
+        return obj;
+    if (BC_add_object_ref(s, obj))
+        goto fail;
+    if (JS_ReadHeapObjectTail(s, obj))
+        goto fail;
+    return obj;
+ fail:
+    JS_FreeValue(ctx, obj);
+    return JS_EXCEPTION;
+}
+
+static JSValue JS_ReadHostObject(BCReaderState *s)
+{
+    JSContext *ctx = s->ctx;
+    JSRuntime *rt = ctx->rt;
+    char buf[ATOM_GET_STR_BUF_SIZE];
+    JSValue obj, data;
+    JSAtom name;
+    int class_id, ret;
+
+    if (bc_get_atom(s, &name))
+        return JS_EXCEPTION;
+    for(class_id = JS_CLASS_INIT_COUNT; class_id < rt->class_count; class_id++) {
+        if (rt->class_array[class_id].class_id != 0 &&
+            rt->class_array[class_id].class_name == name &&
+            rt->class_array[class_id].restore)
+            break;
+    }
+    if (class_id >= rt->class_count) {
+        JS_ThrowSyntaxError(ctx, "cannot restore the objects of class '%s'",
+                            JS_AtomGetStr(ctx, buf, sizeof(buf), name));
+        JS_FreeAtom(ctx, name);
+        return JS_EXCEPTION;
+    }
+    JS_FreeAtom(ctx, name);
+    obj = JS_NewObjectProtoClass(ctx, JS_NULL, class_id);
+    if (JS_IsException(obj))
+        return obj;
+    if (BC_add_object_ref(s, obj))
+        goto fail;
+    data = JS_ReadObjectRec(s);
+    if (JS_IsException(data))
+        goto fail;
+    ret = rt->class_array[class_id].restore(ctx, obj, data);
+    JS_FreeValue(ctx, data);
+    if (ret < 0)
+        goto fail;
+    if (JS_ReadHeapObjectTail(s, obj))
+        goto fail;
+    return obj;
+ fail:
+    JS_FreeValue(ctx, obj);
+    return JS_EXCEPTION;
+}
+
 static JSValue JS_ReadObjectRec(BCReaderState *s)
 {
     JSContext *ctx = s->ctx;
@@ -35282,6 +38496,41 @@ static JSValue JS_ReadObjectRec(BCReaderState *s)
             obj = JS_DupValue(ctx, JS_MKPTR(JS_TAG_OBJECT, s->objects[val]));
         }
         break;
+    case BC_TAG_HEAP_OBJECT:
+        if (!s->allow_heap)
+            goto invalid_tag;
+        obj = JS_ReadHeapObject(s);
+        break;
+    case BC_TAG_HEAP_ARRAY:
+        if (!s->allow_heap)
+            goto invalid_tag;
+        obj = JS_ReadHeapArray(s);
+        break;
+    case BC_TAG_CLOSURE:
+        if (!s->allow_heap)
+            goto invalid_tag;
+        obj = JS_ReadClosure(s);
+        break;
+    case BC_TAG_MAP:
+        if (!s->allow_heap)
+            goto invalid_tag;
+        obj = JS_ReadMap(s);
+        break;
+    case BC_TAG_REGEXP:
+        if (!s->allow_heap)
+            goto invalid_tag;
+        obj = JS_ReadRegExp(s);
+        break;
+    case BC_TAG_INTRINSIC:
+        if (!s->allow_heap)
+            goto invalid_tag;
+        obj = JS_ReadIntrinsic(s);
+        break;
+    case BC_TAG_HOST_OBJECT:
+        if (!s->allow_heap)
+            goto invalid_tag;
+        obj = JS_ReadHostObject(s);
+        break;
     default:
     invalid_tag:
         return JS_ThrowSyntaxError(ctx, "invalid tag (tag=%d pos=%u)",
@@ -35342,10 +38591,13 @@ static void bc_reader_free(BCReaderState *s)
         js_free(s->ctx, s->idx_to_atom);
     }
     js_free(s->ctx, s->objects);
+    js_free(s->ctx, s->var_refs);
+    js_free(s->ctx, s->bytecodes);
 }
 
-JSValue JS_ReadObject(JSContext *ctx, const uint8_t *buf, size_t buf_len,
-                       int flags)
+static JSValue JS_ReadObjectInternal(JSContext *ctx, const uint8_t *buf,
+                                     size_t buf_len, int flags,
+                                     BOOL is_context_state)
 {
     BCReaderState ss, *s = &ss;
     JSValue obj;
@@ -35362,12 +38614,23 @@ JSValue JS_ReadObject(JSContext *ctx, const uint8_t *buf, size_t buf_len,
     s->is_rom_data = ((flags & JS_READ_OBJ_ROM_DATA) != 0);
     s->allow_sab = ((flags & JS_READ_OBJ_SAB) != 0);
     s->allow_reference = ((flags & JS_READ_OBJ_REFERENCE) != 0);
+    s->allow_heap = ((flags & JS_READ_OBJ_HEAP) != 0);
+    if (s->allow_heap) {
+        s->allow_bytecode = TRUE;
+        s->allow_reference = TRUE;
+    }
     if (s->allow_bytecode)
         s->first_atom = JS_ATOM_END;
     else
         s->first_atom = 1;
     if (JS_ReadObjectAtoms(s)) {
         obj = JS_EXCEPTION;
+    } else if (is_context_state) {
+        if (JS_ReadHeapProperties(s, ctx->global_obj) ||
+            JS_ReadHeapProperties(s, ctx->global_var_obj))
+            obj = JS_EXCEPTION;
+        else
+            obj = JS_ReadObjectRec(s);
     } else {
         obj = JS_ReadObjectRec(s);
     }
@@ -35375,6 +38638,61 @@ JSValue JS_ReadObject(JSContext *ctx, const uint8_t *buf, size_t buf_len,
     return obj;
 }
 
+JSValue JS_ReadObject(JSContext *ctx, const uint8_t *buf, size_t buf_len,
+                       int flags)
+{
+    return JS_ReadObjectInternal(ctx, buf, buf_len, flags, FALSE);
+}
+
+/* Context hibernation */
+
+static void js_free_hibernation_baseline(JSContext *ctx)
+{
+    int i;
+
+    if (ctx->hibernation_baseline) {
+        for(i = 0; i < ctx->hibernation_baseline_count; i++)
+            JS_FreeAtom(ctx, ctx->hibernation_baseline[i]);
+        js_free(ctx, ctx->hibernation_baseline);
+        ctx->hibernation_baseline = NULL;
+        ctx->hibernation_baseline_count = 0;
+    }
+}
+
+int JS_SetHibernationBaseline(JSContext *ctx)
+{
+    JSObject *p = JS_VALUE_GET_OBJ(ctx->global_obj);
+    JSShape *sh = p->shape;
+    JSShapeProperty *prs;
+    JSAtom *tab;
+    int i, n;
+
+    tab = js_malloc(ctx, sizeof(tab[0]) * max_int(sh->prop_count, 1));
+    if (!tab)
+        return -1;
+    n = 0;
+    for(i = 0, prs = get_shape_prop(sh); i < sh->prop_count; i++, prs++) {
+        if (prs->atom != JS_ATOM_NULL)
+            tab[n++] = JS_DupAtom(ctx, prs->atom);
+    }
+    js_free_hibernation_baseline(ctx);
+    ctx->hibernation_baseline = tab;
+    ctx->hibernation_baseline_count = n;
+    return 0;
+}
+
+uint8_t *JS_HibernateContext(JSContext *ctx, size_t *psize,
+                             JSValueConst extra)
+{
+    return JS_WriteObjectInternal(ctx, psize, extra, JS_WRITE_OBJ_HEAP,
+                                  NULL, NULL, TRUE);
+}
+
+JSValue JS_RestoreContext(JSContext *ctx, const uint8_t *buf, size_t buf_len)
+{
+    return JS_ReadObjectInternal(ctx, buf, buf_len, JS_READ_OBJ_HEAP, TRUE);
+}
+
 /*******************************************************************/
 /* runtime functions & objects */
 
@@ -35508,6 +38826,9 @@ static int JS_InstantiateFunctionListItem(JSContext *ctx, JSObject *p,
     default:
         abort();
     }
+    /* keep the property uninstantiated if out of memory */
+    if (JS_IsException(val))
+        return -1;
     JS_DefinePropertyValue(ctx, obj, atom, val, prop_flags);
     return 0;
 }
@@ -37093,50 +40414,104 @@ static JSValue js_function_call(JSContext *ctx, JSValueConst this_val,
     }
 }
 
+static int js_bound_function_name_autoinit(JSContext *ctx, JSObject *p,
+                                           JSAtom atom, void *opaque)
+{
+    JSBoundFunction *bf = p->u.bound_function;
+    JSValue name;
+
+    name = bf->name;
+    bf->name = JS_UNDEFINED;
+    name = JS_ConcatString3(ctx, "bound ", name, "");
+    if (JS_IsException(name))
+        return -1;
+    if (JS_DefinePropertyValue(ctx, JS_MKPTR(JS_TAG_OBJECT, p), atom, name,
+                               JS_PROP_CONFIGURABLE) < 0)
+        return -1;
+    return 0;
+}
+
 static JSValue js_function_bind(JSContext *ctx, JSValueConst this_val,
                                 int argc, JSValueConst *argv)
 {
-    JSBoundFunction *bf;
+    JSBoundFunction *bf, *bf1;
     JSValue func_obj, name1;
-    JSObject *p;
-    int arg_count, i;
+    JSValueConst target, target_this;
+    JSObject *p, *p1;
+    JSProperty *pr;
+    JSShapeProperty *prs;
+    int arg_count, inner_arg_count, i;
     uint32_t len1;
 
     if (check_function(ctx, this_val))
         return JS_EXCEPTION;
 
+    /* bound functions of bound functions directly reference the
+       final target */
+    p1 = JS_VALUE_GET_OBJ(this_val);
+    if (p1->class_id == JS_CLASS_BOUND_FUNCTION) {
+        bf1 = p1->u.bound_function;
+        target = bf1->func_obj;
+        target_this = bf1->this_val;
+        inner_arg_count = bf1->argc;
+    } else {
+        bf1 = NULL;
+        target = this_val;
+        target_this = argv[0];
+        inner_arg_count = 0;
+    }
+
     func_obj = JS_NewObjectProtoClass(ctx, ctx->function_proto,
                                  JS_CLASS_BOUND_FUNCTION);
     if (JS_IsException(func_obj))
         return JS_EXCEPTION;
     p = JS_VALUE_GET_OBJ(func_obj);
-    p->is_constructor = JS_IsConstructor(ctx, this_val);
+    p->is_constructor = p1->is_constructor;
     arg_count = max_int(0, argc - 1);
-    bf = js_malloc(ctx, sizeof(*bf) + arg_count * sizeof(JSValue));
+    bf = js_malloc(ctx, sizeof(*bf) +
+                   (inner_arg_count + arg_count) * sizeof(JSValue));
     if (!bf)
         goto exception;
-    bf->func_obj = JS_DupValue(ctx, this_val);
-    bf->this_val = JS_DupValue(ctx, argv[0]);
-    bf->argc = arg_count;
+    bf->func_obj = JS_DupValue(ctx, target);
+    bf->this_val = JS_DupValue(ctx, target_this);
+    bf->inner_func_obj = bf1 ? JS_DupValue(ctx, this_val) : JS_UNDEFINED;
+    bf->name = JS_UNDEFINED;
+    bf->argc = inner_arg_count + arg_count;
+    for(i = 0; i < inner_arg_count; i++) {
+        bf->argv[i] = JS_DupValue(ctx, bf1->argv[i]);
+    }
     for(i = 0; i < arg_count; i++) {
-        bf->argv[i] = JS_DupValue(ctx, argv[i + 1]);
+        bf->argv[inner_arg_count + i] = JS_DupValue(ctx, argv[i + 1]);
     }
     p->u.bound_function = bf;
 
-    name1 = JS_GetProperty(ctx, this_val, JS_ATOM_name);
-    if (JS_IsException(name1))
-        goto exception;
+    /* the 'name' and 'length' properties are read directly when they
+       are plain data properties. The "bound " prefix is only added
+       when the 'name' property is accessed. */
+    prs = find_own_property(&pr, p1, JS_ATOM_name);
+    if (prs && (prs->flags & JS_PROP_TMASK) == JS_PROP_NORMAL) {
+        name1 = JS_DupValue(ctx, pr->u.value);
+    } else {
+        name1 = JS_GetProperty(ctx, this_val, JS_ATOM_name);
+        if (JS_IsException(name1))
+            goto exception;
+    }
     if (!JS_IsString(name1)) {
         JS_FreeValue(ctx, name1);
         name1 = JS_AtomToString(ctx, JS_ATOM_empty_string);
     }
-    name1 = JS_ConcatString3(ctx, "bound ", name1, "");
-    if (JS_IsException(name1))
-        goto exception;
-    JS_DefinePropertyValue(ctx, func_obj, JS_ATOM_name, name1,
-                           JS_PROP_CONFIGURABLE);
-    if (js_get_length32(ctx, &len1, this_val))
-        goto exception;
+    bf->name = name1;
+    JS_DefineAutoInitProperty(ctx, func_obj, JS_ATOM_name,
+                              JS_AUTOINIT_ID_BOUND_FUNCTION_NAME, NULL,
+                              JS_PROP_CONFIGURABLE);
+    prs = find_own_property(&pr, p1, JS_ATOM_length);
+    if (prs && (prs->flags & JS_PROP_TMASK) == JS_PROP_NORMAL &&
+        JS_VALUE_GET_TAG(pr->u.value) == JS_TAG_INT) {
+        len1 = max_int(0, JS_VALUE_GET_INT(pr->u.value));
+    } else {
+        if (js_get_length32(ctx, &len1, this_val))
+            goto exception;
+    }
     if (len1 <= (uint32_t)arg_count)
         len1 = 0;
     else
@@ -38027,6 +41402,8 @@ static JSValue js_array_includes(JSContext *ctx, JSValueConst this_val,
             }
         }
         for (; n < len; n++) {
+            if (js_poll_interrupts(ctx))
+                goto exception;
             val = JS_GetPropertyInt64(ctx, obj, n);
             if (JS_IsException(val))
                 goto exception;
@@ -38075,7 +41452,10 @@ static JSValue js_array_indexOf(JSContext *ctx, JSValueConst this_val,
             }
         }
         for (; n < len; n++) {
-            int present = JS_TryGetPropertyInt64(ctx, obj, n, &val);
+            int present;
+            if (js_poll_interrupts(ctx))
+                goto exception;
+            present = JS_TryGetPropertyInt64(ctx, obj, n, &val);
             if (present < 0)
                 goto exception;
             if (present) {
@@ -38115,6 +41495,8 @@ static JSValue js_array_lastIndexOf(JSContext *ctx, JSValueConst this_val,
         }
         /* XXX: should special case fast arrays */
         for (; n >= 0; n--) {
+            if (js_poll_interrupts(ctx))
+                goto exception;
             present = JS_TryGetPropertyInt64(ctx, obj, n, &val);
             if (present < 0)
                 goto exception;
@@ -38222,11 +41604,12 @@ static JSValue js_array_toString(JSContext *ctx, JSValueConst this_val,
 static JSValue js_array_join(JSContext *ctx, JSValueConst this_val,
                              int argc, JSValueConst *argv, int toLocaleString)
 {
-    JSValue obj, sep = JS_UNDEFINED, el;
+    JSValue obj, sep = JS_UNDEFINED, el, *arrp;
     StringBuffer b_s, *b = &b_s;
     JSString *p = NULL;
-    int64_t i, n;
-    int c;
+    int64_t i, n, size;
+    uint32_t count32;
+    int c, is_wide;
 
     obj = JS_ToObject(ctx, this_val);
     if (js_get_length64(ctx, &n, obj))
@@ -38239,12 +41622,30 @@ static JSValue js_array_join(JSContext *ctx, JSValueConst this_val,
             goto exception;
         p = JS_VALUE_GET_STRING(sep);
         if (p->len == 1 && !p->is_wide_char)
-            c = p->u.str8[0];
+            c = js_str8(p)[0];
         else
             c = -1;
     }
     string_buffer_init(ctx, b, 0);
 
+    /* size hint from the string elements of a fast array. The elements
+       are read again below, so side effects of the conversions are
+       irrelevant here. */
+    if (!toLocaleString && n > 1 &&
+        js_get_fast_array(ctx, obj, &arrp, &count32) && count32 == n) {
+        size = (n - 1) * (p ? p->len : 1);
+        is_wide = p && p->is_wide_char;
+        for(i = 0; i < n; i++) {
+            if (JS_VALUE_GET_TAG(arrp[i]) == JS_TAG_STRING) {
+                JSString *p1 = JS_VALUE_GET_STRING(arrp[i]);
+                size += p1->len;
+                is_wide |= p1->is_wide_char;
+            }
+        }
+        if (size <= JS_STRING_LEN_MAX)
+            string_buffer_reserve(b, size, is_wide);
+    }
+
     for(i = 0; i < n; i++) {
         if (i > 0) {
             if (c >= 0) {
@@ -38726,6 +42127,8 @@ static int js_array_cmp_generic(const void *a, const void *b, void *opaque) {
             cmp = (val > 0) - (val < 0);
         }
     } else {
+        if (js_poll_interrupts(ctx))
+            goto exception;
         /* Not supposed to bypass ToString even for identical objects as
          * tested in test262/test/built-ins/Array/prototype/sort/bug_596_1.js
          */
@@ -38786,6 +42189,8 @@ static JSValue js_array_sort(JSContext *ctx, JSValueConst this_val,
             array = new_array;
             array_size = new_size;
         }
+        if (js_poll_interrupts(ctx))
+            goto exception;
         present = JS_TryGetPropertyInt64(ctx, obj, i, &array[pos].val);
         if (present < 0)
             goto exception;
@@ -39410,9 +42815,9 @@ static int js_string_get_own_property(JSContext *ctx,
             if (idx < p1->len) {
                 if (desc) {
                     if (p1->is_wide_char)
-                        ch = p1->u.str16[idx];
+                        ch = js_str16(p1)[idx];
                     else
-                        ch = p1->u.str8[idx];
+                        ch = js_str8(p1)[idx];
                     desc->flags = JS_PROP_ENUMERABLE;
                     desc->value = js_new_string_char(ctx, ch);
                     desc->getter = JS_UNDEFINED;
@@ -39720,9 +43125,9 @@ static JSValue js_string_charCodeAt(JSContext *ctx, JSValueConst this_val,
         ret = JS_NAN;
     } else {
         if (p->is_wide_char)
-            c = p->u.str16[idx];
+            c = js_str16(p)[idx];
         else
-            c = p->u.str8[idx];
+            c = js_str8(p)[idx];
         ret = JS_NewInt32(ctx, c);
     }
     JS_FreeValue(ctx, val);
@@ -39748,9 +43153,9 @@ static JSValue js_string_charAt(JSContext *ctx, JSValueConst this_val,
         ret = js_new_string8(ctx, NULL, 0);
     } else {
         if (p->is_wide_char)
-            c = p->u.str16[idx];
+            c = js_str16(p)[idx];
         else
-            c = p->u.str8[idx];
+            c = js_str8(p)[idx];
         ret = js_new_string_char(ctx, c);
     }
     JS_FreeValue(ctx, val);
@@ -39815,14 +43220,16 @@ static int string_indexof_char(JSString *p, int c, int from)
     /* assuming 0 <= from <= p->len */
     int i, len = p->len;
     if (p->is_wide_char) {
+        const uint16_t *str = js_str16(p);
         for (i = from; i < len; i++) {
-            if (p->u.str16[i] == c)
+            if (str[i] == c)
                 return i;
         }
     } else {
         if ((c & ~0xff) == 0) {
+            const uint8_t *str = js_str8(p);
             for (i = from; i < len; i++) {
-                if (p->u.str8[i] == (uint8_t)c)
+                if (str[i] == (uint8_t)c)
                     return i;
             }
         }
@@ -39905,6 +43312,8 @@ static JSValue js_string_indexOf(JSContext *ctx, JSValueConst this_val,
     ret = -1;
     if (len >= v_len && inc * (stop - start) >= 0) {
         for (i = start;; i += inc) {
+            if (js_poll_interrupts(ctx))
+                goto fail;
             if (!string_cmp(p, p1, i, 0, v_len)) {
                 ret = i;
                 break;
@@ -39971,6 +43380,8 @@ static JSValue js_string_includes(JSContext *ctx, JSValueConst this_val,
     }
     if (start >= 0 && start <= stop) {
         for (i = start;; i++) {
+            if (js_poll_interrupts(ctx))
+                goto fail;
             if (!string_cmp(p, p1, i, 0, v_len)) {
                 ret = 1;
                 break;
@@ -40093,7 +43504,7 @@ static JSValue js_string___GetSubstitution(JSContext *ctx, JSValueConst this_val
     sp = JS_VALUE_GET_STRING(str);
     rp = JS_VALUE_GET_STRING(rep);
 
-    string_buffer_init(ctx, b, 0);
+    string_buffer_init2(ctx, b, rp->len, rp->is_wide_char);
 
     captures_len = 0;
     if (!JS_IsUndefined(captures)) {
@@ -40183,10 +43594,10 @@ static JSValue js_string_replace(JSContext *ctx, JSValueConst this_val,
     JSValueConst O = this_val, searchValue = argv[0], replaceValue = argv[1];
     JSValueConst args[6];
     JSValue str, search_str, replaceValue_str, repl_str;
-    JSString *sp, *searchp;
+    JSString *sp, *searchp, *rp;
     StringBuffer b_s, *b = &b_s;
     int pos, functionalReplace, endOfLastMatch;
-    BOOL is_first;
+    BOOL is_first, has_dollar;
 
     if (JS_IsUndefined(O) || JS_IsNull(O))
         return JS_ThrowTypeError(ctx, "cannot convert to object");
@@ -40219,10 +43630,13 @@ static JSValue js_string_replace(JSContext *ctx, JSValueConst this_val,
     if (JS_IsException(search_str))
         goto exception;
     functionalReplace = JS_IsFunction(ctx, replaceValue);
+    has_dollar = FALSE;
     if (!functionalReplace) {
         replaceValue_str = JS_ToString(ctx, replaceValue);
         if (JS_IsException(replaceValue_str))
             goto exception;
+        has_dollar = (string_indexof_char(JS_VALUE_GET_STRING(replaceValue_str),
+                                          '$', 0) >= 0);
     }
 
     sp = JS_VALUE_GET_STRING(str);
@@ -40250,11 +43664,24 @@ static JSValue js_string_replace(JSContext *ctx, JSValueConst this_val,
                 break;
             }
         }
+        if (is_first) {
+            /* exact size for a single replacement by a plain string */
+            if (is_replaceAll || functionalReplace || has_dollar) {
+                string_buffer_reserve(b, sp->len, sp->is_wide_char);
+            } else {
+                rp = JS_VALUE_GET_STRING(replaceValue_str);
+                string_buffer_reserve(b, sp->len - searchp->len + rp->len,
+                                      sp->is_wide_char || rp->is_wide_char);
+            }
+        }
         if (functionalReplace) {
             args[0] = search_str;
             args[1] = JS_NewInt32(ctx, pos);
             args[2] = str;
             repl_str = JS_ToStringFree(ctx, JS_Call(ctx, replaceValue, JS_UNDEFINED, 3, args));
+        } else if (!has_dollar) {
+            /* no substitution pattern: the replacement is used as is */
+            repl_str = JS_DupValue(ctx, replaceValue_str);
         } else {
             args[0] = search_str;
             args[1] = str;
@@ -40503,7 +43930,9 @@ static JSValue js_string_pad(JSContext *ctx, JSValueConst this_val,
             p1 = NULL;
         }
     }
-    if (string_buffer_init(ctx, b, n))
+    /* the result length and width are known: allocate it once */
+    if (string_buffer_init2(ctx, b, n, p->is_wide_char ||
+                            (p1 ? p1->is_wide_char : c >= 0x100)))
         goto fail3;
     n -= len;
     if (padEnd) {
@@ -40511,12 +43940,9 @@ static JSValue js_string_pad(JSContext *ctx, JSValueConst this_val,
             goto fail;
     }
     if (p1) {
-        while (n > 0) {
-            int chunk = min_int(n, p1->len);
-            if (string_buffer_concat(b, p1, 0, chunk))
-                goto fail;
-            n -= chunk;
-        }
+        if (string_buffer_concat_repeat(b, p1, n / p1->len) ||
+            string_buffer_concat(b, p1, 0, n % p1->len))
+            goto fail;
     } else {
         if (string_buffer_fill(b, c, n))
             goto fail;
@@ -40571,9 +43997,7 @@ static JSValue js_string_repeat(JSContext *ctx, JSValueConst this_val,
     if (len == 1) {
         string_buffer_fill(b, string_get(p, 0), n);
     } else {
-        while (n-- > 0) {
-            string_buffer_concat(b, p, 0, len);
-        }
+        string_buffer_concat_repeat(b, p, n);
     }
     JS_FreeValue(ctx, str);
     return string_buffer_end(b);
@@ -40625,16 +44049,16 @@ static int string_prevc(JSString *p, int *pidx)
         return 0;
     idx--;
     if (p->is_wide_char) {
-        c = p->u.str16[idx];
+        c = js_str16(p)[idx];
         if (c >= 0xdc00 && c < 0xe000 && idx > 0) {
-            c1 = p->u.str16[idx - 1];
+            c1 = js_str16(p)[idx - 1];
             if (c1 >= 0xd800 && c1 <= 0xdc00) {
                 c = (((c1 & 0x3ff) << 10) | (c & 0x3ff)) + 0x10000;
                 idx--;
             }
         }
     } else {
-        c = p->u.str8[idx];
+        c = js_str8(p)[idx];
     }
     *pidx = idx;
     return c;
@@ -40914,7 +44338,7 @@ static JSValue js_string_iterator_next(JSContext *ctx, JSValueConst this_val,
     if (c <= 0xffff) {
         return js_new_string_char(ctx, c);
     } else {
-        return js_new_string16(ctx, p->u.str16 + start, 2);
+        return js_new_string16(ctx, js_str16(p) + start, 2);
     }
 }
 
@@ -41883,6 +45307,12 @@ BOOL lre_check_stack_overflow(void *opaque, size_t alloca_size)
     return js_check_stack_overflow(ctx->rt, alloca_size);
 }
 
+BOOL lre_check_timeout(void *opaque)
+{
+    JSContext *ctx = opaque;
+    return js_poll_interrupts(ctx) != 0;
+}
+
 void *lre_realloc(void *opaque, void *ptr, size_t size)
 {
     JSContext *ctx = opaque;
@@ -41898,7 +45328,8 @@ static JSValue js_regexp_exec(JSContext *ctx, JSValueConst this_val,
     JSValue str_val, obj, val, groups = JS_UNDEFINED;
     uint8_t *re_bytecode;
     int ret;
-    uint8_t **capture, *str_buf;
+    uint8_t **capture;
+    const uint8_t *str_buf;
     int capture_count, shift, i, re_flags;
     int64_t last_index;
     const char *group_name_ptr;
@@ -41930,7 +45361,7 @@ static JSValue js_regexp_exec(JSContext *ctx, JSValueConst this_val,
         }
     }
     shift = str->is_wide_char;
-    str_buf = str->u.str8;
+    str_buf = js_str8(str);
     if (last_index > str->len) {
         ret = 2;
     } else {
@@ -41947,7 +45378,8 @@ static JSValue js_regexp_exec(JSContext *ctx, JSValueConst this_val,
                     goto fail;
             }
         } else {
-            JS_ThrowInternalError(ctx, "out of memory in regexp execution");
+            if (ret != LRE_RET_TIMEOUT)
+                JS_ThrowInternalError(ctx, "out of memory in regexp execution");
             goto fail;
         }
         JS_FreeValue(ctx, str_val);
@@ -42027,7 +45459,8 @@ static JSValue JS_RegExpDelete(JSContext *ctx, JSValueConst this_val, JSValueCon
     JSValue str_val, val;
     uint8_t *re_bytecode;
     int ret;
-    uint8_t **capture, *str_buf;
+    uint8_t **capture;
+    const uint8_t *str_buf;
     int capture_count, shift, re_flags;
     int next_src_pos, start, end;
     int64_t last_index;
@@ -42059,7 +45492,7 @@ static JSValue JS_RegExpDelete(JSContext *ctx, JSValueConst this_val, JSValueCon
             goto fail;
     }
     shift = str->is_wide_char;
-    str_buf = str->u.str8;
+    str_buf = js_str8(str);
     next_src_pos = 0;
     for (;;) {
         if (last_index > str->len)
@@ -42075,7 +45508,8 @@ static JSValue JS_RegExpDelete(JSContext *ctx, JSValueConst this_val, JSValueCon
                         goto fail;
                 }
             } else {
-                JS_ThrowInternalError(ctx, "out of memory in regexp execution");
+                if (ret != LRE_RET_TIMEOUT)
+                    JS_ThrowInternalError(ctx, "out of memory in regexp execution");
                 goto fail;
             }
             break;
@@ -42502,6 +45936,8 @@ static JSValue js_regexp_Symbol_replace(JSContext *ctx, JSValueConst this_val,
         goto exception;
         
     sp = JS_VALUE_GET_STRING(str);
+    /* the result is usually about as long as the input */
+    string_buffer_reserve(b, sp->len, sp->is_wide_char);
     rp = NULL;
     functionalReplace = JS_IsFunction(ctx, rep);
     if (!functionalReplace) {
@@ -42909,6 +46345,8 @@ static JSValue json_parse_value(JSParseState *s)
     JSValue val = JS_NULL;
     int ret;
 
+    if (js_poll_interrupts(ctx))
+        goto fail;
     switch(s->token.val) {
     case '{':
         {
@@ -43060,6 +46498,470 @@ JSValue JS_ParseJSON(JSContext *ctx, const char *buf, size_t buf_len,
     return JS_ParseJSON2(ctx, buf, buf_len, filename, 0); 
 }
 
+/* Streaming JSON parser. The input is buffered until the next value
+   (or token) is complete, so only the value being parsed is kept in
+   memory. The containers up to 'depth' are walked token by token and
+   the values at 'depth' are parsed with json_parse_value(). */
+
+typedef enum {
+    JS_JSON_STATE_ARRAY_FIRST, /* value or ']' */
+    JS_JSON_STATE_ARRAY_VALUE, /* value after ',' */
+    JS_JSON_STATE_ARRAY_NEXT, /* ',' or ']' */
+    JS_JSON_STATE_OBJECT_FIRST, /* property name or '}' */
+    JS_JSON_STATE_OBJECT_NAME, /* property name after ',' */
+    JS_JSON_STATE_OBJECT_COLON, /* ':' */
+    JS_JSON_STATE_OBJECT_VALUE, /* value after ':' */
+    JS_JSON_STATE_OBJECT_NEXT, /* ',' or '}' */
+} JSJSONParserStateEnum;
+
+struct JSJSONParser {
+    JSContext *ctx;
+    DynBuf dbuf; /* pending input, followed by at least one free byte */
+    size_t pos; /* start of the unparsed input in dbuf */
+    int depth;
+    BOOL ext_json : 8;
+    BOOL ndjson : 8;
+    BOOL eof : 8;
+    BOOL error : 8;
+    BOOL need_newline : 8; /* NDJSON: a value ends on the current line */
+    int line_num;
+    int level_count; /* number of open containers */
+    uint8_t *levels; /* JSJSONParserStateEnum of each open container */
+    JSValue name; /* name of the object member being parsed */
+    /* scan of the value starting at 'pos', resumed with more input */
+    size_t scan_len;
+    int scan_depth;
+    uint8_t scan_quote; /* != 0 in a string */
+    BOOL scan_escape : 8;
+    uint8_t scan_comment; /* 1 = line comment, 2 = block comment */
+    uint8_t scan_prev; /* previous character outside strings */
+};
+
+JSJSONParser *JS_NewJSONParser(JSContext *ctx, int depth, int flags)
+{
+    JSJSONParser *p;
+
+    if (depth < 0 || depth > JS_MAX_LOCAL_VARS) {
+        JS_ThrowRangeError(ctx, "invalid depth");
+        return NULL;
+    }
+    p = js_mallocz(ctx, sizeof(*p));
+    if (!p)
+        return NULL;
+    p->levels = js_malloc(ctx, max_int(depth, 1));
+    if (!p->levels) {
+        js_free(ctx, p);
+        return NULL;
+    }
+    p->ctx = ctx;
+    js_dbuf_init(ctx, &p->dbuf);
+    p->name = JS_UNDEFINED;
+    p->depth = depth;
+    p->ext_json = ((flags & JS_PARSE_JSON_EXT) != 0);
+    p->ndjson = ((flags & JS_PARSE_JSON_NDJSON) != 0);
+    p->line_num = 1;
+    return p;
+}
+
+void JS_FreeJSONParser(JSRuntime *rt, JSJSONParser *p)
+{
+    if (!p)
+        return;
+    dbuf_free(&p->dbuf);
+    JS_FreeValueRT(rt, p->name);
+    js_free_rt(rt, p->levels);
+    js_free_rt(rt, p);
+}
+
+int JS_JSONParserWrite(JSJSONParser *p, const uint8_t *buf, size_t len)
+{
+    DynBuf *d = &p->dbuf;
+
+    if (p->eof) {
+        JS_ThrowTypeError(p->ctx, "JSON parser input ended");
+        return -1;
+    }
+    /* discard the parsed input when it is larger than the rest */
+    if (p->pos != 0 && p->pos >= d->size - p->pos) {
+        memmove(d->buf, d->buf + p->pos, d->size - p->pos);
+        d->size -= p->pos;
+        p->pos = 0;
+    }
+    if (dbuf_put(d, buf, len) || dbuf_putc(d, '\0')) {
+        JS_ThrowOutOfMemory(p->ctx);
+        return -1;
+    }
+    d->size--;
+    return 0;
+}
+
+void JS_JSONParserEnd(JSJSONParser *p)
+{
+    p->eof = TRUE;
+}
+
+static int js_json_parser_error(JSJSONParser *p, const char *msg)
+{
+    JSParseState s1, *s = &s1;
+
+    js_parse_init(p->ctx, s, "", 0, "<input>");
+    s->line_num = p->line_num;
+    p->error = TRUE;
+    return js_parse_error(s, "%s", msg);
+}
+
+static BOOL js_json_is_scalar_char(int c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') ||
+        is_digit(c) || c == '_' || c == '$' || c == '+' || c == '-' ||
+        c == '.';
+}
+
+/* Return the length of the value or token starting at 'pos' or 0 if
+   more input is needed. */
+static size_t js_json_parser_scan(JSJSONParser *p)
+{
+    const uint8_t *buf = p->dbuf.buf + p->pos;
+    size_t i, len = p->dbuf.size - p->pos;
+    int c;
+
+    i = p->scan_len;
+    if (js_json_is_scalar_char(buf[0])) {
+        while (i < len && js_json_is_scalar_char(buf[i]))
+            i++;
+        if (i < len)
+            goto done;
+    } else {
+        for(; i < len; i++) {
+            c = buf[i];
+            if (p->scan_quote) {
+                if (p->scan_escape) {
+                    p->scan_escape = FALSE;
+                } else if (c == '\\') {
+                    p->scan_escape = TRUE;
+                } else if (c == p->scan_quote) {
+                    p->scan_quote = 0;
+                    if (p->scan_depth == 0) {
+                        i++;
+                        goto done;
+                    }
+                }
+            } else if (p->scan_comment == 1) {
+                if (c == '\n' || c == '\r')
+                    p->scan_comment = 0;
+            } else if (p->scan_comment == 2) {
+                if (c == '/' && p->scan_prev == '*') {
+                    p->scan_comment = 0;
+                    c = 0;
+                }
+                p->scan_prev = c;
+            } else {
+                if (c == '\"' || (c == '\'' && p->ext_json)) {
+                    p->scan_quote = c;
+                } else if (c == '{' || c == '[') {
+                    p->scan_depth++;
+                } else if (c == '}' || c == ']') {
+                    if (--p->scan_depth <= 0) {
+                        i++;
+                        goto done;
+                    }
+                } else if (p->ext_json && p->scan_prev == '/' &&
+                           (c == '/' || c == '*')) {
+                    p->scan_comment = (c == '/') ? 1 : 2;
+                    c = 0; /* '/' + '*' + '/' is not a closed comment */
+                } else if (p->scan_depth == 0) {
+                    /* not a value: let the parser report the error */
+                    i++;
+                    goto done;
+                }
+                p->scan_prev = c;
+            }
+        }
+    }
+    if (!p->eof) {
+        p->scan_len = i;
+        return 0;
+    }
+ done:
+    p->scan_len = 0;
+    p->scan_depth = 0;
+    p->scan_quote = 0;
+    p->scan_escape = FALSE;
+    p->scan_comment = 0;
+    p->scan_prev = 0;
+    return i;
+}
+
+/* parse the value (or the property name if 'is_name' is TRUE) in the
+   next 'len' bytes of the input */
+static JSValue js_json_parser_parse(JSJSONParser *p, size_t len, BOOL is_name)
+{
+    JSParseState s1, *s = &s1;
+    uint8_t *buf = p->dbuf.buf + p->pos;
+    JSValue val = JS_UNDEFINED;
+    uint8_t c;
+
+    /* the tokenizer needs a null terminator */
+    c = buf[len];
+    buf[len] = '\0';
+    js_parse_init(p->ctx, s, (const char *)buf, len, "<input>");
+    s->line_num = p->line_num;
+    s->ext_json = p->ext_json;
+    if (json_next_token(s))
+        goto fail;
+    if (is_name) {
+        if (s->token.val == TOK_STRING) {
+            val = JS_DupValue(p->ctx, s->token.u.str.str);
+        } else if (s->ext_json && s->token.val == TOK_IDENT) {
+            val = JS_AtomToString(p->ctx, s->token.u.ident.atom);
+            if (JS_IsException(val))
+                goto fail;
+        } else {
+            js_parse_error(s, "expecting property name");
+            goto fail;
+        }
+        if (json_next_token(s))
+            goto fail;
+    } else {
+        val = json_parse_value(s);
+        if (JS_IsException(val))
+            goto fail;
+    }
+    if (s->token.val != TOK_EOF) {
+        js_parse_error(s, "unexpected data at the end");
+        goto fail;
+    }
+    buf[len] = c;
+    p->line_num = s->line_num;
+    p->pos += len;
+    return val;
+ fail:
+    buf[len] = c;
+    JS_FreeValue(p->ctx, val);
+    free_token(s, &s->token);
+    p->error = TRUE;
+    return JS_EXCEPTION;
+}
+
+/* skip the white space and comments. Return FALSE if more input is
+   needed. */
+static BOOL js_json_parser_skip_space(JSJSONParser *p)
+{
+    const uint8_t *buf = p->dbuf.buf;
+    size_t pos = p->pos, size = p->dbuf.size;
+    int c;
+
+    while (pos < size) {
+        c = buf[pos];
+        if (c == '\n') {
+            p->line_num++;
+            p->need_newline = FALSE;
+        } else if (c == ' ' || c == '\t' || c == '\r' ||
+                   (p->ext_json && (c == '\f' || c == '\v'))) {
+        } else if (c == '/' && p->ext_json) {
+            if (pos + 1 >= size) {
+                if (!p->eof)
+                    break;
+                goto done;
+            }
+            if (buf[pos + 1] == '/') {
+                pos += 2;
+                while (pos < size && buf[pos] != '\n' && buf[pos] != '\r')
+                    pos++;
+                if (pos >= size && !p->eof) {
+                    /* restart at the beginning of the comment */
+                    return FALSE;
+                }
+                continue;
+            } else if (buf[pos + 1] == '*') {
+                size_t pos1 = pos + 2;
+                int lines = 0;
+                for(;;) {
+                    if (pos1 + 1 >= size) {
+                        if (!p->eof)
+                            return FALSE;
+                        goto done;
+                    }
+                    if (buf[pos1] == '*' && buf[pos1 + 1] == '/')
+                        break;
+                    if (buf[pos1] == '\n')
+                        lines++;
+                    pos1++;
+                }
+                pos = pos1 + 2;
+                p->line_num += lines;
+                if (lines)
+                    p->need_newline = FALSE;
+                p->pos = pos;
+                continue;
+            } else {
+                goto done;
+            }
+        } else {
+            goto done;
+        }
+        pos++;
+        p->pos = pos;
+    }
+    p->pos = pos;
+    return p->eof;
+ done:
+    p->pos = pos;
+    return TRUE;
+}
+
+/* return the [name, value] array of an object member. 'val' is freed */
+static JSValue js_json_parser_member(JSJSONParser *p, JSValue val)
+{
+    JSValue name = p->name, arr;
+    JSValueConst tab[2];
+
+    p->name = JS_UNDEFINED;
+    if (JS_IsException(val)) {
+        arr = JS_EXCEPTION;
+    } else {
+        tab[0] = name;
+        tab[1] = val;
+        arr = js_create_array(p->ctx, 2, tab);
+        if (JS_IsException(arr))
+            p->error = TRUE;
+    }
+    JS_FreeValue(p->ctx, name);
+    JS_FreeValue(p->ctx, val);
+    return arr;
+}
+
+/* Return the next complete value, JS_UNDEFINED if more input is needed
+   (or at the end of the input) or JS_EXCEPTION. The members of an
+   object are returned as [name, value] arrays. */
+JSValue JS_JSONParserNext(JSJSONParser *p)
+{
+    JSContext *ctx = p->ctx;
+    const uint8_t *buf;
+    uint8_t *pstate;
+    size_t len;
+    JSValue val;
+    int c, state;
+
+    if (p->error)
+        return JS_ThrowTypeError(ctx, "JSON parser error");
+    for(;;) {
+        if (!js_json_parser_skip_space(p))
+            return JS_UNDEFINED;
+        buf = p->dbuf.buf;
+        if (p->pos >= p->dbuf.size) {
+            /* end of input */
+            if (p->level_count != 0) {
+                js_json_parser_error(p, "unexpected end of input");
+                return JS_EXCEPTION;
+            }
+            return JS_UNDEFINED;
+        }
+        c = buf[p->pos];
+        if (p->level_count == 0) {
+            pstate = NULL;
+            state = -1;
+        } else {
+            pstate = &p->levels[p->level_count - 1];
+            state = *pstate;
+        }
+        switch(state) {
+        case JS_JSON_STATE_ARRAY_FIRST:
+        case JS_JSON_STATE_ARRAY_VALUE:
+            if (c == ']' &&
+                (state == JS_JSON_STATE_ARRAY_FIRST || p->ext_json))
+                goto close;
+            /* fall thru */
+        case -1:
+        case JS_JSON_STATE_OBJECT_VALUE:
+            if (state == -1 && p->ndjson && p->need_newline) {
+                js_json_parser_error(p, "expecting newline");
+                return JS_EXCEPTION;
+            }
+            if (pstate) {
+                if (state == JS_JSON_STATE_OBJECT_VALUE)
+                    *pstate = JS_JSON_STATE_OBJECT_NEXT;
+                else
+                    *pstate = JS_JSON_STATE_ARRAY_NEXT;
+            }
+            if ((c == '{' || c == '[') && p->level_count < p->depth) {
+                if (js_poll_interrupts(ctx))
+                    goto fail;
+                /* the name of the member is not returned with the
+                   values of the nested container */
+                JS_FreeValue(ctx, p->name);
+                p->name = JS_UNDEFINED;
+                p->levels[p->level_count++] = (c == '{') ?
+                    JS_JSON_STATE_OBJECT_FIRST : JS_JSON_STATE_ARRAY_FIRST;
+                p->pos++;
+                break;
+            }
+            len = js_json_parser_scan(p);
+            if (len == 0) {
+                /* restore the state until the value is complete */
+                if (pstate)
+                    *pstate = state;
+                return JS_UNDEFINED;
+            }
+            val = js_json_parser_parse(p, len, FALSE);
+            if (state == JS_JSON_STATE_OBJECT_VALUE)
+                return js_json_parser_member(p, val);
+            if (!JS_IsException(val) && p->level_count == 0)
+                p->need_newline = TRUE;
+            return val;
+        case JS_JSON_STATE_OBJECT_FIRST:
+        case JS_JSON_STATE_OBJECT_NAME:
+            if (c == '}' &&
+                (state == JS_JSON_STATE_OBJECT_FIRST || p->ext_json))
+                goto close;
+            len = js_json_parser_scan(p);
+            if (len == 0)
+                return JS_UNDEFINED;
+            val = js_json_parser_parse(p, len, TRUE);
+            if (JS_IsException(val))
+                return val;
+            JS_FreeValue(ctx, p->name);
+            p->name = val;
+            *pstate = JS_JSON_STATE_OBJECT_COLON;
+            break;
+        case JS_JSON_STATE_OBJECT_COLON:
+            if (c != ':') {
+                js_json_parser_error(p, "expecting ':'");
+                return JS_EXCEPTION;
+            }
+            p->pos++;
+            *pstate = JS_JSON_STATE_OBJECT_VALUE;
+            break;
+        case JS_JSON_STATE_ARRAY_NEXT:
+        case JS_JSON_STATE_OBJECT_NEXT:
+            if (c == ',') {
+                p->pos++;
+                if (state == JS_JSON_STATE_ARRAY_NEXT)
+                    *pstate = JS_JSON_STATE_ARRAY_VALUE;
+                else
+                    *pstate = JS_JSON_STATE_OBJECT_NAME;
+                break;
+            }
+            if (c == (state == JS_JSON_STATE_ARRAY_NEXT ? ']' : '}'))
+                goto close;
+            js_json_parser_error(p, state == JS_JSON_STATE_ARRAY_NEXT ?
+                                 "expecting ',' or ']'" :
+                                 "expecting ',' or '}'");
+            return JS_EXCEPTION;
+        close:
+            p->pos++;
+            if (--p->level_count == 0)
+                p->need_newline = TRUE;
+            break;
+        default:
+            abort();
+        }
+    }
+ fail:
+    p->error = TRUE;
+    return JS_EXCEPTION;
+}
+
 static JSValue internalize_json_property(JSContext *ctx, JSValueConst holder,
                                          JSAtom name, JSValueConst reviver)
 {
@@ -43257,6 +47159,8 @@ static int js_json_to_str(JSContext *ctx, JSONStringifyContext *jsc,
     tab = JS_UNDEFINED;
     prop = JS_UNDEFINED;
 
+    if (js_poll_interrupts(ctx))
+        goto exception;
     switch (JS_VALUE_GET_NORM_TAG(val)) {
     case JS_TAG_OBJECT:
         p = JS_VALUE_GET_OBJ(val);
@@ -43762,12 +47666,21 @@ static const JSCFunctionListEntry js_reflect_obj[] = {
 
 /* Proxy */
 
+static void js_proxy_reset_trap_cache(JSRuntime *rt, JSProxyData *s)
+{
+    js_free_shape_null(rt, s->handler_shape);
+    js_free_shape_null(rt, s->proto_shape);
+    s->handler_shape = NULL;
+    s->proto_shape = NULL;
+}
+
 static void js_proxy_finalizer(JSRuntime *rt, JSValue val)
 {
     JSProxyData *s = JS_GetOpaque(val, JS_CLASS_PROXY);
     if (s) {
         JS_FreeValueRT(rt, s->target);
         JS_FreeValueRT(rt, s->handler);
+        js_proxy_reset_trap_cache(rt, s);
         js_free_rt(rt, s);
     }
 }
@@ -43779,6 +47692,10 @@ static void js_proxy_mark(JSRuntime *rt, JSValueConst val,
     if (s) {
         JS_MarkValue(rt, s->target, mark_func);
         JS_MarkValue(rt, s->handler, mark_func);
+        if (s->handler_shape)
+            mark_func(rt, &s->handler_shape->header);
+        if (s->proto_shape)
+            mark_func(rt, &s->proto_shape->header);
     }
 }
 
@@ -43787,8 +47704,106 @@ static JSValue JS_ThrowTypeErrorRevokedProxy(JSContext *ctx)
     return JS_ThrowTypeError(ctx, "revoked proxy");
 }
 
+static const JSAtom js_proxy_trap_atoms[JS_PROXY_TRAP_COUNT] = {
+    JS_ATOM_getPrototypeOf,
+    JS_ATOM_setPrototypeOf,
+    JS_ATOM_isExtensible,
+    JS_ATOM_preventExtensions,
+    JS_ATOM_getOwnPropertyDescriptor,
+    JS_ATOM_defineProperty,
+    JS_ATOM_has,
+    JS_ATOM_get,
+    JS_ATOM_set,
+    JS_ATOM_deleteProperty,
+    JS_ATOM_ownKeys,
+    JS_ATOM_apply,
+    JS_ATOM_construct,
+};
+
+/* JSProxyData.trap_cache[] entries: the low 3 bits give the kind of
+   entry, the other bits the property index for the OWN and PROTO
+   kinds */
+#define JS_PROXY_TRAP_CACHE_UNKNOWN 0 /* not looked up yet */
+#define JS_PROXY_TRAP_CACHE_GENERIC 1 /* use JS_GetProperty() */
+#define JS_PROXY_TRAP_CACHE_ABSENT  2 /* the handler has no such trap */
+#define JS_PROXY_TRAP_CACHE_OWN     3 /* data property of the handler */
+#define JS_PROXY_TRAP_CACHE_PROTO   4 /* data property of its prototype */
+
+/* Return FALSE if the cache cannot be used for this handler or
+   trap. Otherwise '*pmethod' is set to the trap or to JS_UNDEFINED if
+   the trap is not defined. */
+static BOOL js_proxy_get_cached_trap(JSContext *ctx, JSValue *pmethod,
+                                     JSProxyData *s, JSProxyTrapEnum trap)
+{
+    JSObject *p, *p1, *proto;
+    JSShape *sh;
+    JSShapeProperty *prs;
+    JSProperty *pr;
+    JSValue method;
+    uint32_t c;
+
+    p = JS_VALUE_GET_OBJ(s->handler);
+    sh = p->shape;
+    proto = sh->proto;
+    if (unlikely(sh != s->handler_shape ||
+                 (proto && proto->shape != s->proto_shape))) {
+        js_proxy_reset_trap_cache(ctx->rt, s);
+        /* only ordinary handlers whose prototype is an ordinary
+           object without prototype (usually Object.prototype) are
+           cached */
+        if (p->is_exotic || !sh->is_hashed)
+            return FALSE;
+        if (proto) {
+            if (proto->is_exotic || !proto->shape->is_hashed ||
+                proto->shape->proto)
+                return FALSE;
+            s->proto_shape = js_dup_shape(proto->shape);
+        }
+        s->handler_shape = js_dup_shape(sh);
+        memset(s->trap_cache, 0, sizeof(s->trap_cache));
+    }
+
+    c = s->trap_cache[trap];
+    if (c == JS_PROXY_TRAP_CACHE_UNKNOWN) {
+        JSAtom atom = js_proxy_trap_atoms[trap];
+        p1 = p;
+        c = JS_PROXY_TRAP_CACHE_OWN;
+        prs = find_own_property(&pr, p1, atom);
+        if (!prs && proto) {
+            p1 = proto;
+            c = JS_PROXY_TRAP_CACHE_PROTO;
+            prs = find_own_property(&pr, p1, atom);
+        }
+        if (!prs)
+            c = JS_PROXY_TRAP_CACHE_ABSENT;
+        else if ((prs->flags & JS_PROP_TMASK) != JS_PROP_NORMAL)
+            c = JS_PROXY_TRAP_CACHE_GENERIC;
+        else
+            c |= (pr - p1->prop) << 3;
+        s->trap_cache[trap] = c;
+    }
+
+    switch(c & 7) {
+    case JS_PROXY_TRAP_CACHE_ABSENT:
+        *pmethod = JS_UNDEFINED;
+        return TRUE;
+    case JS_PROXY_TRAP_CACHE_OWN:
+        method = p->prop[c >> 3].u.value;
+        break;
+    case JS_PROXY_TRAP_CACHE_PROTO:
+        method = proto->prop[c >> 3].u.value;
+        break;
+    default:
+        return FALSE;
+    }
+    if (JS_IsNull(method))
+        method = JS_UNDEFINED;
+    *pmethod = JS_DupValue(ctx, method);
+    return TRUE;
+}
+
 static JSProxyData *get_proxy_method(JSContext *ctx, JSValue *pmethod,
-                                     JSValueConst obj, JSAtom name)
+                                     JSValueConst obj, JSProxyTrapEnum trap)
 {
     JSProxyData *s = JS_GetOpaque(obj, JS_CLASS_PROXY);
     JSValue method;
@@ -43804,7 +47819,9 @@ static JSProxyData *get_proxy_method(JSContext *ctx, JSValue *pmethod,
         JS_ThrowTypeErrorRevokedProxy(ctx);
         return NULL;
     }
-    method = JS_GetProperty(ctx, s->handler, name);
+    if (js_proxy_get_cached_trap(ctx, pmethod, s, trap))
+        return s;
+    method = JS_GetProperty(ctx, s->handler, js_proxy_trap_atoms[trap]);
     if (JS_IsException(method))
         return NULL;
     if (JS_IsNull(method))
@@ -43813,13 +47830,27 @@ static JSProxyData *get_proxy_method(JSContext *ctx, JSValue *pmethod,
     return s;
 }
 
+/* Return TRUE if the invariants of the proxy traps must be checked
+   for the property 'atom' of the target, i.e. if the target may have
+   a non configurable own property 'atom'. */
+static BOOL js_proxy_has_fixed_property(JSObject *p, JSAtom atom)
+{
+    JSShapeProperty *prs;
+    JSProperty *pr;
+
+    if (p->is_exotic)
+        return TRUE;
+    prs = find_own_property(&pr, p, atom);
+    return prs && !(prs->flags & JS_PROP_CONFIGURABLE);
+}
+
 static JSValue js_proxy_getPrototypeOf(JSContext *ctx, JSValueConst obj)
 {
     JSProxyData *s;
     JSValue method, ret, proto1;
     int res;
 
-    s = get_proxy_method(ctx, &method, obj, JS_ATOM_getPrototypeOf);
+    s = get_proxy_method(ctx, &method, obj, JS_PROXY_TRAP_getPrototypeOf);
     if (!s)
         return JS_EXCEPTION;
     if (JS_IsUndefined(method))
@@ -43863,7 +47894,7 @@ static int js_proxy_setPrototypeOf(JSContext *ctx, JSValueConst obj,
     BOOL res;
     int res2;
 
-    s = get_proxy_method(ctx, &method, obj, JS_ATOM_setPrototypeOf);
+    s = get_proxy_method(ctx, &method, obj, JS_PROXY_TRAP_setPrototypeOf);
     if (!s)
         return -1;
     if (JS_IsUndefined(method))
@@ -43906,7 +47937,7 @@ static int js_proxy_isExtensible(JSContext *ctx, JSValueConst obj)
     BOOL res;
     int res2;
 
-    s = get_proxy_method(ctx, &method, obj, JS_ATOM_isExtensible);
+    s = get_proxy_method(ctx, &method, obj, JS_PROXY_TRAP_isExtensible);
     if (!s)
         return -1;
     if (JS_IsUndefined(method))
@@ -43932,7 +47963,7 @@ static int js_proxy_preventExtensions(JSContext *ctx, JSValueConst obj)
     BOOL res;
     int res2;
 
-    s = get_proxy_method(ctx, &method, obj, JS_ATOM_preventExtensions);
+    s = get_proxy_method(ctx, &method, obj, JS_PROXY_TRAP_preventExtensions);
     if (!s)
         return -1;
     if (JS_IsUndefined(method))
@@ -43962,7 +47993,7 @@ static int js_proxy_has(JSContext *ctx, JSValueConst obj, JSAtom atom)
     JSValueConst args[2];
     BOOL res2;
 
-    s = get_proxy_method(ctx, &method, obj, JS_ATOM_has);
+    s = get_proxy_method(ctx, &method, obj, JS_PROXY_TRAP_has);
     if (!s)
         return -1;
     if (JS_IsUndefined(method))
@@ -43982,6 +48013,8 @@ static int js_proxy_has(JSContext *ctx, JSValueConst obj, JSAtom atom)
     if (!ret) {
         JSPropertyDescriptor desc;
         p = JS_VALUE_GET_OBJ(s->target);
+        if (p->extensible && !js_proxy_has_fixed_property(p, atom))
+            return ret;
         res = JS_GetOwnPropertyInternal(ctx, &desc, p, atom);
         if (res < 0)
             return -1;
@@ -44006,7 +48039,7 @@ static JSValue js_proxy_get(JSContext *ctx, JSValueConst obj, JSAtom atom,
     JSValueConst args[3];
     JSPropertyDescriptor desc;
 
-    s = get_proxy_method(ctx, &method, obj, JS_ATOM_get);
+    s = get_proxy_method(ctx, &method, obj, JS_PROXY_TRAP_get);
     if (!s)
         return JS_EXCEPTION;
     /* Note: recursion is possible thru the prototype of s->target */
@@ -44024,6 +48057,8 @@ static JSValue js_proxy_get(JSContext *ctx, JSValueConst obj, JSAtom atom,
     JS_FreeValue(ctx, atom_val);
     if (JS_IsException(ret))
         return JS_EXCEPTION;
+    if (!js_proxy_has_fixed_property(JS_VALUE_GET_OBJ(s->target), atom))
+        return ret;
     res = JS_GetOwnPropertyInternal(ctx, &desc, JS_VALUE_GET_OBJ(s->target), atom);
     if (res < 0)
         return JS_EXCEPTION;
@@ -44053,7 +48088,7 @@ static int js_proxy_set(JSContext *ctx, JSValueConst obj, JSAtom atom,
     int ret, res;
     JSValueConst args[4];
 
-    s = get_proxy_method(ctx, &method, obj, JS_ATOM_set);
+    s = get_proxy_method(ctx, &method, obj, JS_PROXY_TRAP_set);
     if (!s)
         return -1;
     if (JS_IsUndefined(method)) {
@@ -44077,6 +48112,8 @@ static int js_proxy_set(JSContext *ctx, JSValueConst obj, JSAtom atom,
     ret = JS_ToBoolFree(ctx, ret1);
     if (ret) {
         JSPropertyDescriptor desc;
+        if (!js_proxy_has_fixed_property(JS_VALUE_GET_OBJ(s->target), atom))
+            return ret;
         res = JS_GetOwnPropertyInternal(ctx, &desc, JS_VALUE_GET_OBJ(s->target), atom);
         if (res < 0)
             return -1;
@@ -44151,7 +48188,7 @@ static int js_proxy_get_own_property(JSContext *ctx, JSPropertyDescriptor *pdesc
     JSValueConst args[2];
     JSPropertyDescriptor result_desc, target_desc;
 
-    s = get_proxy_method(ctx, &method, obj, JS_ATOM_getOwnPropertyDescriptor);
+    s = get_proxy_method(ctx, &method, obj, JS_PROXY_TRAP_getOwnPropertyDescriptor);
     if (!s)
         return -1;
     p = JS_VALUE_GET_OBJ(s->target);
@@ -44251,7 +48288,7 @@ static int js_proxy_define_own_property(JSContext *ctx, JSValueConst obj,
     JSPropertyDescriptor desc;
     BOOL setting_not_configurable;
 
-    s = get_proxy_method(ctx, &method, obj, JS_ATOM_defineProperty);
+    s = get_proxy_method(ctx, &method, obj, JS_PROXY_TRAP_defineProperty);
     if (!s)
         return -1;
     if (JS_IsUndefined(method)) {
@@ -44346,7 +48383,7 @@ static int js_proxy_delete_property(JSContext *ctx, JSValueConst obj,
     int res, res2, is_extensible;
     JSValueConst args[2];
 
-    s = get_proxy_method(ctx, &method, obj, JS_ATOM_deleteProperty);
+    s = get_proxy_method(ctx, &method, obj, JS_PROXY_TRAP_deleteProperty);
     if (!s)
         return -1;
     if (JS_IsUndefined(method)) {
@@ -44413,7 +48450,7 @@ static int js_proxy_get_own_property_names(JSContext *ctx,
     JSPropertyDescriptor desc;
     int res, is_extensible, idx;
 
-    s = get_proxy_method(ctx, &method, obj, JS_ATOM_ownKeys);
+    s = get_proxy_method(ctx, &method, obj, JS_PROXY_TRAP_ownKeys);
     if (!s)
         return -1;
     if (JS_IsUndefined(method)) {
@@ -44526,7 +48563,7 @@ static JSValue js_proxy_call_constructor(JSContext *ctx, JSValueConst func_obj,
     JSValue method, arg_array, ret;
     JSValueConst args[3];
 
-    s = get_proxy_method(ctx, &method, func_obj, JS_ATOM_construct);
+    s = get_proxy_method(ctx, &method, func_obj, JS_PROXY_TRAP_construct);
     if (!s)
         return JS_EXCEPTION;
     if (!JS_IsConstructor(ctx, s->target))
@@ -44563,7 +48600,7 @@ static JSValue js_proxy_call(JSContext *ctx, JSValueConst func_obj,
     if (flags & JS_CALL_FLAG_CONSTRUCTOR)
         return js_proxy_call_constructor(ctx, func_obj, this_obj, argc, argv);
     
-    s = get_proxy_method(ctx, &method, func_obj, JS_ATOM_apply);
+    s = get_proxy_method(ctx, &method, func_obj, JS_PROXY_TRAP_apply);
     if (!s)
         return JS_EXCEPTION;
     if (!s->is_func) {
@@ -44634,6 +48671,8 @@ static JSValue js_proxy_constructor(JSContext *ctx, JSValueConst this_val,
     s->handler = JS_DupValue(ctx, handler);
     s->is_func = JS_IsFunction(ctx, target);
     s->is_revoked = FALSE;
+    s->handler_shape = NULL;
+    s->proto_shape = NULL;
     JS_SetOpaque(obj, s);
     JS_SetConstructorBit(ctx, obj, JS_IsConstructor(ctx, target));
     return obj;
@@ -44830,7 +48869,7 @@ typedef struct JSMapRecord {
     int ref_count; /* used during enumeration to avoid freeing the record */
     BOOL empty; /* TRUE if the record is deleted */
     struct JSMapState *map;
-    struct JSMapRecord *next_weak_ref;
+    JSWeakRefHeader weak_ref; /* only used for WeakMap/WeakSet */
     struct list_head link;
     struct list_head hash_link;
     JSValue key;
@@ -44847,9 +48886,6 @@ typedef struct JSMapState {
                                         resize is needed */
 } JSMapState;
 
-#define MAGIC_SET (1 << 0)
-#define MAGIC_WEAK (1 << 1)
-
 static JSValue js_map_constructor(JSContext *ctx, JSValueConst new_target,
                                   int argc, JSValueConst *argv, int magic)
 {
@@ -44984,23 +49020,22 @@ static uint32_t map_hash_key(JSContext *ctx, JSValueConst key)
         h = JS_VALUE_GET_INT(key);
         break;
     case JS_TAG_STRING:
-        h = hash_string(JS_VALUE_GET_STRING(key), 0);
+        h = js_string_get_hash(ctx->rt, JS_VALUE_GET_STRING(key));
         break;
     case JS_TAG_OBJECT:
     case JS_TAG_SYMBOL:
-        h = (uintptr_t)JS_VALUE_GET_PTR(key) * 3163;
+        h = js_hash_u64(ctx->rt->hash_seed, (uintptr_t)JS_VALUE_GET_PTR(key));
         break;
     case JS_TAG_INT:
-        d = JS_VALUE_GET_INT(key) * 3163;
-        goto hash_float64;
+        h = js_hash_u64(ctx->rt->hash_seed, (uint32_t)JS_VALUE_GET_INT(key));
+        break;
     case JS_TAG_FLOAT64:
         d = JS_VALUE_GET_FLOAT64(key);
         /* normalize the NaN */
         if (isnan(d))
             d = JS_FLOAT64_NAN;
-    hash_float64:
         u.d = d;
-        h = (u.u32[0] ^ u.u32[1]) * 3163;
+        h = js_hash_u64(ctx->rt->hash_seed, u.u64);
         break;
     default:
         h = 0; /* XXX: bignum support */
@@ -45058,6 +49093,31 @@ static void map_hash_resize(JSContext *ctx, JSMapState *s)
     s->record_count_threshold = new_hash_size * 2;
 }
 
+static void add_weak_ref(JSObject *p, JSWeakRefHeader *wr)
+{
+    wr->next_weak_ref = p->first_weak_ref;
+    p->first_weak_ref = wr;
+}
+
+/* Remove the weak reference from the object weak
+   reference list. we don't use a doubly linked list to
+   save space, assuming a given object has few weak
+       references to it */
+static void delete_weak_ref(JSObject *p, JSWeakRefHeader *wr)
+{
+    JSWeakRefHeader **pwr, *wr1;
+
+    pwr = &p->first_weak_ref;
+    for(;;) {
+        wr1 = *pwr;
+        assert(wr1 != NULL);
+        if (wr1 == wr)
+            break;
+        pwr = &wr1->next_weak_ref;
+    }
+    *pwr = wr1->next_weak_ref;
+}
+
 static JSMapRecord *map_add_record(JSContext *ctx, JSMapState *s,
                                    JSValueConst key)
 {
@@ -45071,10 +49131,9 @@ static JSMapRecord *map_add_record(JSContext *ctx, JSMapState *s,
     mr->map = s;
     mr->empty = FALSE;
     if (s->is_weak) {
-        JSObject *p = JS_VALUE_GET_OBJ(key);
         /* Add the weak reference */
-        mr->next_weak_ref = p->first_weak_ref;
-        p->first_weak_ref = mr;
+        mr->weak_ref.kind = JS_WEAK_REF_KIND_MAP;
+        add_weak_ref(JS_VALUE_GET_OBJ(key), &mr->weak_ref);
     } else {
         JS_DupValue(ctx, key);
     }
@@ -45089,34 +49148,13 @@ static JSMapRecord *map_add_record(JSContext *ctx, JSMapState *s,
     return mr;
 }
 
-/* Remove the weak reference from the object weak
-   reference list. we don't use a doubly linked list to
-   save space, assuming a given object has few weak
-       references to it */
-static void delete_weak_ref(JSRuntime *rt, JSMapRecord *mr)
-{
-    JSMapRecord **pmr, *mr1;
-    JSObject *p;
-
-    p = JS_VALUE_GET_OBJ(mr->key);
-    pmr = &p->first_weak_ref;
-    for(;;) {
-        mr1 = *pmr;
-        assert(mr1 != NULL);
-        if (mr1 == mr)
-            break;
-        pmr = &mr1->next_weak_ref;
-    }
-    *pmr = mr1->next_weak_ref;
-}
-
 static void map_delete_record(JSRuntime *rt, JSMapState *s, JSMapRecord *mr)
 {
     if (mr->empty)
         return;
     list_del(&mr->hash_link);
     if (s->is_weak) {
-        delete_weak_ref(rt, mr);
+        delete_weak_ref(JS_VALUE_GET_OBJ(mr->key), &mr->weak_ref);
     } else {
         JS_FreeValueRT(rt, mr->key);
     }
@@ -45143,30 +49181,53 @@ static void map_decref_record(JSRuntime *rt, JSMapRecord *mr)
     }
 }
 
+static void js_finrec_entry_dead(JSRuntime *rt, JSFinRecEntry *fre);
+
 static void reset_weak_ref(JSRuntime *rt, JSObject *p)
 {
-    JSMapRecord *mr, *mr_next;
+    JSWeakRefHeader *wr;
+    JSMapRecord *mr;
     JSMapState *s;
+    struct list_head mr_list, *el, *el1;
     
     /* first pass to remove the records from the WeakMap/WeakSet
-       lists */
-    for(mr = p->first_weak_ref; mr != NULL; mr = mr->next_weak_ref) {
-        s = mr->map;
-        assert(s->is_weak);
-        assert(!mr->empty); /* no iterator on WeakMap/WeakSet */
-        list_del(&mr->hash_link);
-        list_del(&mr->link);
+       lists and to clear the other weak references. Nothing is
+       freed here because the finalizers may modify the weak
+       reference list. */
+    init_list_head(&mr_list);
+    for(wr = p->first_weak_ref; wr != NULL; wr = wr->next_weak_ref) {
+        switch(wr->kind) {
+        case JS_WEAK_REF_KIND_MAP:
+            mr = list_entry(wr, JSMapRecord, weak_ref);
+            s = mr->map;
+            assert(s->is_weak);
+            assert(!mr->empty); /* no iterator on WeakMap/WeakSet */
+            list_del(&mr->hash_link);
+            list_del(&mr->link);
+            list_add_tail(&mr->link, &mr_list);
+            s->record_count--;
+            break;
+        case JS_WEAK_REF_KIND_WEAK_REF:
+            list_entry(wr, JSWeakRef, header)->target = JS_UNDEFINED;
+            break;
+        case JS_WEAK_REF_KIND_FINREC_TARGET:
+            js_finrec_entry_dead(rt, list_entry(wr, JSFinRecEntry, target_ref));
+            break;
+        case JS_WEAK_REF_KIND_FINREC_TOKEN:
+            list_entry(wr, JSFinRecEntry, token_ref)->token = JS_UNDEFINED;
+            break;
+        default:
+            abort();
+        }
     }
+    p->first_weak_ref = NULL;
     
-    /* second pass to free the values to avoid modifying the weak
-       reference list while traversing it. */
-    for(mr = p->first_weak_ref; mr != NULL; mr = mr_next) {
-        mr_next = mr->next_weak_ref;
+    /* second pass to free the WeakMap/WeakSet values */
+    list_for_each_safe(el, el1, &mr_list) {
+        mr = list_entry(el, JSMapRecord, link);
         JS_FreeValueRT(rt, mr->value);
         js_free_rt(rt, mr);
     }
-
-    p->first_weak_ref = NULL; /* fail safe */
 }
 
 static JSValue js_map_set(JSContext *ctx, JSValueConst this_val,
@@ -45269,6 +49330,36 @@ static JSValue js_map_get_size(JSContext *ctx, JSValueConst this_val, int magic)
     return JS_NewUint32(ctx, s->record_count);
 }
 
+/* return the live records as [key0, value0, key1, value1, ...]. Used
+   by the object writer. */
+static JSValue js_map_to_array(JSContext *ctx, JSValueConst obj)
+{
+    JSObject *p = JS_VALUE_GET_OBJ(obj);
+    JSMapState *s = p->u.map_state;
+    struct list_head *el;
+    JSMapRecord *mr;
+    JSValue arr;
+    uint32_t i;
+
+    arr = JS_NewArray(ctx);
+    if (JS_IsException(arr))
+        return arr;
+    i = 0;
+    list_for_each(el, &s->records) {
+        mr = list_entry(el, JSMapRecord, link);
+        if (mr->empty)
+            continue;
+        if (JS_DefinePropertyValueUint32(ctx, arr, i++, JS_DupValue(ctx, mr->key),
+                                         JS_PROP_C_W_E) < 0 ||
+            JS_DefinePropertyValueUint32(ctx, arr, i++, JS_DupValue(ctx, mr->value),
+                                         JS_PROP_C_W_E) < 0) {
+            JS_FreeValue(ctx, arr);
+            return JS_EXCEPTION;
+        }
+    }
+    return arr;
+}
+
 static JSValue js_map_forEach(JSContext *ctx, JSValueConst this_val,
                               int argc, JSValueConst *argv, int magic)
 {
@@ -45333,7 +49424,7 @@ static void js_map_finalizer(JSRuntime *rt, JSValue val)
             mr = list_entry(el, JSMapRecord, link);
             if (!mr->empty) {
                 if (s->is_weak)
-                    delete_weak_ref(rt, mr);
+                    delete_weak_ref(JS_VALUE_GET_OBJ(mr->key), &mr->weak_ref);
                 else
                     JS_FreeValueRT(rt, mr->key);
                 JS_FreeValueRT(rt, mr->value);
@@ -45603,6 +49694,384 @@ void JS_AddIntrinsicMapSet(JSContext *ctx)
     }
 }
 
+/* WeakRef */
+
+/* WeakRef.prototype.deref() and the WeakRef constructor keep the
+   target alive until the end of the current job sequence (see
+   JS_ExecutePendingJob()). */
+static int js_keep_object(JSContext *ctx, JSValueConst obj)
+{
+    JSObjectList *s = &ctx->rt->kept_objects;
+    JSObject *p = JS_VALUE_GET_OBJ(obj);
+
+    /* each target is kept once, however many times it is accessed */
+    if (js_object_list_find(ctx, s, p) >= 0)
+        return 0;
+    if (js_object_list_add(ctx, s, p))
+        return -1;
+    JS_DupValue(ctx, obj);
+    return 0;
+}
+
+static void js_clear_kept_objects(JSRuntime *rt)
+{
+    JSObjectList s;
+    int i;
+
+    if (rt->kept_objects.object_count == 0)
+        return;
+    /* the finalizers may use the list */
+    s = rt->kept_objects;
+    js_object_list_init(&rt->kept_objects);
+    for(i = 0; i < s.object_count; i++)
+        JS_FreeValueRT(rt, JS_MKPTR(JS_TAG_OBJECT, s.object_tab[i].obj));
+    js_free_rt(rt, s.object_tab);
+    js_free_rt(rt, s.hash_table);
+}
+
+JSWeakRef *JS_NewWeakRef(JSContext *ctx, JSValueConst obj)
+{
+    JSWeakRef *wr;
+
+    if (!JS_IsObject(obj)) {
+        JS_ThrowTypeErrorNotAnObject(ctx);
+        return NULL;
+    }
+    wr = js_malloc(ctx, sizeof(*wr));
+    if (!wr)
+        return NULL;
+    wr->header.kind = JS_WEAK_REF_KIND_WEAK_REF;
+    wr->target = (JSValue)obj;
+    add_weak_ref(JS_VALUE_GET_OBJ(obj), &wr->header);
+    return wr;
+}
+
+void JS_FreeWeakRef(JSRuntime *rt, JSWeakRef *wr)
+{
+    if (JS_IsObject(wr->target))
+        delete_weak_ref(JS_VALUE_GET_OBJ(wr->target), &wr->header);
+    js_free_rt(rt, wr);
+}
+
+JSValue JS_GetWeakRefTarget(JSContext *ctx, JSWeakRef *wr)
+{
+    return JS_DupValue(ctx, wr->target);
+}
+
+static JSValue js_weakref_constructor(JSContext *ctx, JSValueConst new_target,
+                                      int argc, JSValueConst *argv)
+{
+    JSValueConst target = argv[0];
+    JSValue obj;
+    JSWeakRef *wr;
+
+    if (!JS_IsObject(target))
+        return JS_ThrowTypeError(ctx, "invalid target");
+    obj = js_create_from_ctor(ctx, new_target, JS_CLASS_WEAK_REF);
+    if (JS_IsException(obj))
+        return obj;
+    wr = JS_NewWeakRef(ctx, target);
+    if (!wr)
+        goto fail;
+    JS_SetOpaque(obj, wr);
+    if (js_keep_object(ctx, target))
+        goto fail;
+    return obj;
+ fail:
+    JS_FreeValue(ctx, obj);
+    return JS_EXCEPTION;
+}
+
+static void js_weakref_finalizer(JSRuntime *rt, JSValue val)
+{
+    JSWeakRef *wr = JS_GetOpaque(val, JS_CLASS_WEAK_REF);
+    if (wr)
+        JS_FreeWeakRef(rt, wr);
+}
+
+static JSValue js_weakref_deref(JSContext *ctx, JSValueConst this_val,
+                                int argc, JSValueConst *argv)
+{
+    JSWeakRef *wr = JS_GetOpaque2(ctx, this_val, JS_CLASS_WEAK_REF);
+    if (!wr)
+        return JS_EXCEPTION;
+    if (!JS_IsObject(wr->target))
+        return JS_UNDEFINED;
+    if (js_keep_object(ctx, wr->target))
+        return JS_EXCEPTION;
+    return JS_DupValue(ctx, wr->target);
+}
+
+static const JSCFunctionListEntry js_weakref_proto_funcs[] = {
+    JS_CFUNC_DEF("deref", 0, js_weakref_deref ),
+    JS_PROP_STRING_DEF("[Symbol.toStringTag]", "WeakRef", JS_PROP_CONFIGURABLE ),
+};
+
+/* FinalizationRegistry */
+
+/* The targets and the unregister tokens are weak references. When a
+   target is freed, its entry is moved to 'dead_entries' and the
+   registry is added to JSRuntime.finrec_pending_list. The cleanup
+   job is queued by JS_ExecutePendingJob() so that no JS code is
+   run from the GC. If the registry is freed first, the callbacks
+   are not called. */
+typedef struct JSFinRecState {
+    JSContext *ctx; /* realm of the cleanup job */
+    JSObject *obj; /* FinalizationRegistry object */
+    JSValue cb;
+    struct list_head entries; /* list of JSFinRecEntry.link */
+    struct list_head dead_entries; /* list of JSFinRecEntry.link */
+    BOOL is_pending; /* TRUE if in JSRuntime.finrec_pending_list */
+    struct list_head pending_link;
+} JSFinRecState;
+
+static void js_finrec_set_pending(JSRuntime *rt, JSFinRecState *frs)
+{
+    if (!frs->is_pending) {
+        list_add_tail(&frs->pending_link, &rt->finrec_pending_list);
+        frs->is_pending = TRUE;
+    }
+}
+
+/* called by reset_weak_ref() when the target is freed */
+static void js_finrec_entry_dead(JSRuntime *rt, JSFinRecEntry *fre)
+{
+    fre->target = JS_UNDEFINED;
+    list_del(&fre->link);
+    list_add_tail(&fre->link, &fre->frs->dead_entries);
+    js_finrec_set_pending(rt, fre->frs);
+}
+
+static void js_finrec_entry_free(JSRuntime *rt, JSFinRecEntry *fre)
+{
+    list_del(&fre->link);
+    if (JS_IsObject(fre->target))
+        delete_weak_ref(JS_VALUE_GET_OBJ(fre->target), &fre->target_ref);
+    if (JS_IsObject(fre->token))
+        delete_weak_ref(JS_VALUE_GET_OBJ(fre->token), &fre->token_ref);
+    JS_FreeValueRT(rt, fre->held_val);
+    js_free_rt(rt, fre);
+}
+
+static void js_finrec_finalizer(JSRuntime *rt, JSValue val)
+{
+    JSFinRecState *frs = JS_GetOpaque(val, JS_CLASS_FINALIZATION_REGISTRY);
+    struct list_head *el, *el1;
+
+    if (frs) {
+        if (frs->is_pending)
+            list_del(&frs->pending_link);
+        list_for_each_safe(el, el1, &frs->entries) {
+            js_finrec_entry_free(rt, list_entry(el, JSFinRecEntry, link));
+        }
+        list_for_each_safe(el, el1, &frs->dead_entries) {
+            js_finrec_entry_free(rt, list_entry(el, JSFinRecEntry, link));
+        }
+        JS_FreeValueRT(rt, frs->cb);
+        JS_FreeContext(frs->ctx);
+        js_free_rt(rt, frs);
+    }
+}
+
+static void js_finrec_mark(JSRuntime *rt, JSValueConst val,
+                           JS_MarkFunc *mark_func)
+{
+    JSFinRecState *frs = JS_GetOpaque(val, JS_CLASS_FINALIZATION_REGISTRY);
+    struct list_head *el;
+
+    if (frs) {
+        /* the targets and tokens are not marked */
+        list_for_each(el, &frs->entries) {
+            JS_MarkValue(rt, list_entry(el, JSFinRecEntry, link)->held_val,
+                         mark_func);
+        }
+        list_for_each(el, &frs->dead_entries) {
+            JS_MarkValue(rt, list_entry(el, JSFinRecEntry, link)->held_val,
+                         mark_func);
+        }
+        JS_MarkValue(rt, frs->cb, mark_func);
+        mark_func(rt, &frs->ctx->header);
+    }
+}
+
+static JSValue js_finrec_job(JSContext *ctx, int argc, JSValueConst *argv)
+{
+    JSFinRecState *frs = JS_GetOpaque(argv[0], JS_CLASS_FINALIZATION_REGISTRY);
+    JSFinRecEntry *fre;
+    JSValue held_val, ret;
+
+    while (!list_empty(&frs->dead_entries)) {
+        /* the entry is removed before the call because the callback
+           may unregister entries */
+        fre = list_entry(frs->dead_entries.next, JSFinRecEntry, link);
+        held_val = fre->held_val;
+        fre->held_val = JS_UNDEFINED;
+        js_finrec_entry_free(ctx->rt, fre);
+        ret = JS_Call(ctx, frs->cb, JS_UNDEFINED, 1,
+                      (JSValueConst *)&held_val);
+        JS_FreeValue(ctx, held_val);
+        if (JS_IsException(ret)) {
+            /* the remaining entries are cleaned up by another job */
+            if (!list_empty(&frs->dead_entries))
+                js_finrec_set_pending(ctx->rt, frs);
+            return ret;
+        }
+        JS_FreeValue(ctx, ret);
+    }
+    return JS_UNDEFINED;
+}
+
+/* queue a cleanup job for each registry having freed targets. Return
+   -1 and set '*pctx' if exception. */
+static int js_finrec_queue_jobs(JSRuntime *rt, JSContext **pctx)
+{
+    JSFinRecState *frs;
+    JSValueConst obj;
+
+    while (!list_empty(&rt->finrec_pending_list)) {
+        frs = list_entry(rt->finrec_pending_list.next, JSFinRecState,
+                         pending_link);
+        obj = JS_MKPTR(JS_TAG_OBJECT, frs->obj);
+        if (JS_EnqueueJob(frs->ctx, js_finrec_job, 1, &obj) < 0) {
+            *pctx = frs->ctx;
+            return -1;
+        }
+        list_del(&frs->pending_link);
+        frs->is_pending = FALSE;
+    }
+    return 0;
+}
+
+static JSValue js_finrec_constructor(JSContext *ctx, JSValueConst new_target,
+                                     int argc, JSValueConst *argv)
+{
+    JSValueConst cb = argv[0];
+    JSValue obj;
+    JSFinRecState *frs;
+
+    if (!JS_IsFunction(ctx, cb))
+        return JS_ThrowTypeError(ctx, "not a function");
+    obj = js_create_from_ctor(ctx, new_target, JS_CLASS_FINALIZATION_REGISTRY);
+    if (JS_IsException(obj))
+        return obj;
+    frs = js_mallocz(ctx, sizeof(*frs));
+    if (!frs) {
+        JS_FreeValue(ctx, obj);
+        return JS_EXCEPTION;
+    }
+    frs->ctx = JS_DupContext(ctx);
+    frs->obj = JS_VALUE_GET_OBJ(obj);
+    frs->cb = JS_DupValue(ctx, cb);
+    init_list_head(&frs->entries);
+    init_list_head(&frs->dead_entries);
+    JS_SetOpaque(obj, frs);
+    return obj;
+}
+
+static JSValue js_finrec_register(JSContext *ctx, JSValueConst this_val,
+                                  int argc, JSValueConst *argv)
+{
+    JSFinRecState *frs = JS_GetOpaque2(ctx, this_val, JS_CLASS_FINALIZATION_REGISTRY);
+    JSValueConst target = argv[0];
+    JSValueConst held_val = argv[1];
+    JSValueConst token = argc > 2 ? argv[2] : JS_UNDEFINED;
+    JSFinRecEntry *fre;
+
+    if (!frs)
+        return JS_EXCEPTION;
+    if (!JS_IsObject(target))
+        return JS_ThrowTypeError(ctx, "invalid target");
+    if (js_same_value(ctx, target, held_val))
+        return JS_ThrowTypeError(ctx, "held value cannot be the target");
+    if (!JS_IsObject(token) && !JS_IsUndefined(token))
+        return JS_ThrowTypeError(ctx, "invalid unregister token");
+    fre = js_malloc(ctx, sizeof(*fre));
+    if (!fre)
+        return JS_EXCEPTION;
+    fre->frs = frs;
+    fre->target = (JSValue)target;
+    fre->target_ref.kind = JS_WEAK_REF_KIND_FINREC_TARGET;
+    add_weak_ref(JS_VALUE_GET_OBJ(target), &fre->target_ref);
+    fre->token = (JSValue)token;
+    if (JS_IsObject(token)) {
+        fre->token_ref.kind = JS_WEAK_REF_KIND_FINREC_TOKEN;
+        add_weak_ref(JS_VALUE_GET_OBJ(token), &fre->token_ref);
+    }
+    fre->held_val = JS_DupValue(ctx, held_val);
+    list_add_tail(&fre->link, &frs->entries);
+    return JS_UNDEFINED;
+}
+
+static BOOL js_finrec_unregister_list(JSRuntime *rt, struct list_head *head,
+                                      JSValueConst token)
+{
+    struct list_head *el, *el1;
+    JSFinRecEntry *fre;
+    BOOL removed = FALSE;
+
+    list_for_each_safe(el, el1, head) {
+        fre = list_entry(el, JSFinRecEntry, link);
+        if (JS_IsObject(fre->token) &&
+            JS_VALUE_GET_OBJ(fre->token) == JS_VALUE_GET_OBJ(token)) {
+            js_finrec_entry_free(rt, fre);
+            removed = TRUE;
+        }
+    }
+    return removed;
+}
+
+static JSValue js_finrec_unregister(JSContext *ctx, JSValueConst this_val,
+                                    int argc, JSValueConst *argv)
+{
+    JSFinRecState *frs = JS_GetOpaque2(ctx, this_val, JS_CLASS_FINALIZATION_REGISTRY);
+    JSValueConst token = argv[0];
+    BOOL removed;
+
+    if (!frs)
+        return JS_EXCEPTION;
+    if (!JS_IsObject(token))
+        return JS_ThrowTypeError(ctx, "invalid unregister token");
+    removed = js_finrec_unregister_list(ctx->rt, &frs->entries, token);
+    removed |= js_finrec_unregister_list(ctx->rt, &frs->dead_entries, token);
+    return JS_NewBool(ctx, removed);
+}
+
+static const JSCFunctionListEntry js_finrec_proto_funcs[] = {
+    JS_CFUNC_DEF("register", 2, js_finrec_register ),
+    JS_CFUNC_DEF("unregister", 1, js_finrec_unregister ),
+    JS_PROP_STRING_DEF("[Symbol.toStringTag]", "FinalizationRegistry", JS_PROP_CONFIGURABLE ),
+};
+
+static JSClassShortDef const js_weakref_class_def[] = {
+    { JS_ATOM_WeakRef, js_weakref_finalizer, NULL }, /* JS_CLASS_WEAK_REF */
+    { JS_ATOM_FinalizationRegistry, js_finrec_finalizer, js_finrec_mark }, /* JS_CLASS_FINALIZATION_REGISTRY */
+};
+
+void JS_AddIntrinsicWeakRef(JSContext *ctx)
+{
+    JSRuntime *rt = ctx->rt;
+
+    if (!JS_IsRegisteredClass(rt, JS_CLASS_WEAK_REF)) {
+        init_class_range(rt, js_weakref_class_def, JS_CLASS_WEAK_REF,
+                         countof(js_weakref_class_def));
+    }
+
+    ctx->class_proto[JS_CLASS_WEAK_REF] = JS_NewObject(ctx);
+    JS_SetPropertyFunctionList(ctx, ctx->class_proto[JS_CLASS_WEAK_REF],
+                               js_weakref_proto_funcs,
+                               countof(js_weakref_proto_funcs));
+    JS_NewGlobalCConstructorOnly(ctx, "WeakRef", js_weakref_constructor, 1,
+                                 ctx->class_proto[JS_CLASS_WEAK_REF]);
+
+    ctx->class_proto[JS_CLASS_FINALIZATION_REGISTRY] = JS_NewObject(ctx);
+    JS_SetPropertyFunctionList(ctx, ctx->class_proto[JS_CLASS_FINALIZATION_REGISTRY],
+                               js_finrec_proto_funcs,
+                               countof(js_finrec_proto_funcs));
+    JS_NewGlobalCConstructorOnly(ctx, "FinalizationRegistry",
+                                 js_finrec_constructor, 1,
+                                 ctx->class_proto[JS_CLASS_FINALIZATION_REGISTRY]);
+}
+
 /* Generator */
 static const JSCFunctionListEntry js_generator_function_proto_funcs[] = {
     JS_PROP_STRING_DEF("[Symbol.toStringTag]", "GeneratorFunction", JS_PROP_CONFIGURABLE),
@@ -46138,6 +50607,67 @@ static __exception int remainingElementsCount_add(JSContext *ctx,
     return (remainingElementsCount == 0);
 }
 
+static JSValue js_promise_then(JSContext *ctx, JSValueConst this_val,
+                               int argc, JSValueConst *argv);
+
+/* return TRUE if 'promise.then(...)' is known to run the intrinsic
+   Promise.prototype.then with the intrinsic Promise as species
+   constructor. In this case the combinators can register the
+   reactions directly without looking up 'then' and without creating
+   the derived promise whose value is never used. Only plain data
+   properties and the intrinsic getter are accepted so that the check
+   itself has no observable side effect. */
+static BOOL js_promise_has_intrinsic_then(JSContext *ctx, JSValueConst promise)
+{
+    JSObject *p, *proto;
+    JSShapeProperty *prs;
+    JSProperty *pr;
+
+    if (JS_VALUE_GET_TAG(promise) != JS_TAG_OBJECT)
+        return FALSE;
+    p = JS_VALUE_GET_OBJ(promise);
+    proto = JS_VALUE_GET_OBJ(ctx->class_proto[JS_CLASS_PROMISE]);
+    if (p->class_id != JS_CLASS_PROMISE || p->shape->proto != proto ||
+        p->shape->prop_count != 0)
+        return FALSE;
+    prs = find_own_property(&pr, proto, JS_ATOM_then);
+    if (!prs || (prs->flags & JS_PROP_TMASK) != JS_PROP_NORMAL ||
+        !JS_IsCFunction(ctx, pr->u.value, (JSCFunction *)js_promise_then, 0))
+        return FALSE;
+    prs = find_own_property(&pr, proto, JS_ATOM_constructor);
+    if (!prs || (prs->flags & JS_PROP_TMASK) != JS_PROP_NORMAL ||
+        !js_same_value(ctx, pr->u.value, ctx->promise_ctor))
+        return FALSE;
+    prs = find_own_property(&pr, JS_VALUE_GET_OBJ(ctx->promise_ctor),
+                            JS_ATOM_Symbol_species);
+    if (!prs || (prs->flags & JS_PROP_TMASK) != JS_PROP_GETSET ||
+        !pr->u.getset.getter ||
+        !JS_IsCFunction(ctx, JS_MKPTR(JS_TAG_OBJECT, pr->u.getset.getter),
+                        (JSCFunction *)js_get_this, 0))
+        return FALSE;
+    return TRUE;
+}
+
+static __exception int js_promise_invoke_then(JSContext *ctx,
+                                              JSValue promise,
+                                              JSValueConst *resolve_reject)
+{
+    JSValueConst no_resolving_funcs[2];
+    JSValue ret;
+    int res;
+    
+    if (js_promise_has_intrinsic_then(ctx, promise)) {
+        no_resolving_funcs[0] = JS_UNDEFINED;
+        no_resolving_funcs[1] = JS_UNDEFINED;
+        res = perform_promise_then(ctx, promise, resolve_reject,
+                                   no_resolving_funcs);
+        JS_FreeValue(ctx, promise);
+        return res;
+    }
+    ret = JS_InvokeFree(ctx, promise, JS_ATOM_then, 2, resolve_reject);
+    return check_exception_free(ctx, ret);
+}
+
 #define PROMISE_MAGIC_all        0
 #define PROMISE_MAGIC_allSettled 1
 #define PROMISE_MAGIC_any        2
@@ -46222,7 +50752,7 @@ static JSValue js_promise_all(JSContext *ctx, JSValueConst this_val,
     JSValue promise_resolve = JS_UNDEFINED, iter = JS_UNDEFINED;
     JSValueConst then_args[2], resolve_element_data[5];
     BOOL done;
-    int index, is_zero, is_promise_any = (magic == PROMISE_MAGIC_any);
+    int index, is_zero, res, is_promise_any = (magic == PROMISE_MAGIC_any);
     
     if (!JS_IsObject(this_val))
         return JS_ThrowTypeErrorNotAnObject(ctx);
@@ -46289,6 +50819,14 @@ static JSValue js_promise_all(JSContext *ctx, JSValueConst this_val,
                 JS_FreeValue(ctx, next_promise);
                 goto fail_reject1;
             }
+            /* append the element now so that 'values' stays a fast
+               array whatever the order in which the promises settle */
+            if (JS_DefinePropertyValueUint32(ctx, values, index,
+                                             JS_UNDEFINED, JS_PROP_C_W_E) < 0) {
+                JS_FreeValue(ctx, next_promise);
+                JS_FreeValue(ctx, resolve_element);
+                goto fail_reject1;
+            }
             
             if (magic == PROMISE_MAGIC_allSettled) {
                 reject_element =
@@ -46299,9 +50837,6 @@ static JSValue js_promise_all(JSContext *ctx, JSValueConst this_val,
                     goto fail_reject1;
                 }
             } else if (magic == PROMISE_MAGIC_any) {
-                if (JS_DefinePropertyValueUint32(ctx, values, index,
-                                                 JS_UNDEFINED, JS_PROP_C_W_E) < 0)
-                    goto fail_reject1;
                 reject_element = resolve_element;
                 resolve_element = JS_DupValue(ctx, resolving_funcs[0]);
             } else {
@@ -46317,10 +50852,10 @@ static JSValue js_promise_all(JSContext *ctx, JSValueConst this_val,
 
             then_args[0] = resolve_element;
             then_args[1] = reject_element;
-            ret = JS_InvokeFree(ctx, next_promise, JS_ATOM_then, 2, then_args);
+            res = js_promise_invoke_then(ctx, next_promise, then_args);
             JS_FreeValue(ctx, resolve_element);
             JS_FreeValue(ctx, reject_element);
-            if (check_exception_free(ctx, ret))
+            if (res)
                 goto fail_reject1;
             index++;
         }
@@ -46407,9 +50942,8 @@ static JSValue js_promise_race(JSContext *ctx, JSValueConst this_val,
                 JS_IteratorClose(ctx, iter, TRUE);
                 goto fail_reject;
             }
-            ret = JS_InvokeFree(ctx, next_promise, JS_ATOM_then, 2,
-                                (JSValueConst *)resolving_funcs);
-            if (check_exception_free(ctx, ret))
+            if (js_promise_invoke_then(ctx, next_promise,
+                                       (JSValueConst *)resolving_funcs))
                 goto fail_reject1;
         }
     }
@@ -51639,7 +56173,7 @@ static JSValue js_typed_array_join(JSContext *ctx, JSValueConst this_val,
             goto exception;
         p = JS_VALUE_GET_STRING(sep);
         if (p->len == 1 && !p->is_wide_char)
-            c = p->u.str8[0];
+            c = js_str8(p)[0];
         else
             c = -1;
     }
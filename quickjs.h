@@ -333,8 +333,17 @@ JSRuntime *JS_NewRuntime(void);
 void JS_SetRuntimeInfo(JSRuntime *rt, const char *info);
 void JS_SetMemoryLimit(JSRuntime *rt, size_t limit);
 void JS_SetGCThreshold(JSRuntime *rt, size_t gc_threshold);
+int JS_SetBackgroundFree(JSRuntime *rt, JS_BOOL enable);
 void JS_SetMaxStackSize(JSRuntime *rt, size_t stack_size);
+/* call it when the runtime is used from another thread */
+void JS_UpdateStackTop(JSRuntime *rt);
 JSRuntime *JS_NewRuntime2(const JSMallocFunctions *mf, void *opaque);
+/* account the memory per context (JS_SetContextMemoryLimit(),
+   JS_GetContextMemoryUsage()). Each allocation gets an 8 byte header. */
+#define JS_RUNTIME_CONTEXT_MEMORY (1 << 0)
+/* 'mf' = NULL selects the default allocator */
+JSRuntime *JS_NewRuntime3(const JSMallocFunctions *mf, void *opaque,
+                          int flags);
 void JS_FreeRuntime(JSRuntime *rt);
 void *JS_GetRuntimeOpaque(JSRuntime *rt);
 void JS_SetRuntimeOpaque(JSRuntime *rt, void *opaque);
@@ -346,6 +355,10 @@ JS_BOOL JS_IsLiveObject(JSRuntime *rt, JSValueConst obj);
 JSContext *JS_NewContext(JSRuntime *rt);
 void JS_FreeContext(JSContext *s);
 JSContext *JS_DupContext(JSContext *ctx);
+JSContext *JS_NewArenaContext(JSRuntime *rt, size_t chunk_size);
+int JS_SetContextMemoryLimit(JSContext *ctx, size_t soft_limit,
+                             size_t hard_limit);
+int64_t JS_GetContextMemoryUsage(JSContext *ctx);
 void *JS_GetContextOpaque(JSContext *ctx);
 void JS_SetContextOpaque(JSContext *ctx, void *opaque);
 JSRuntime *JS_GetRuntime(JSContext *ctx);
@@ -364,6 +377,7 @@ void JS_AddIntrinsicRegExp(JSContext *ctx);
 void JS_AddIntrinsicJSON(JSContext *ctx);
 void JS_AddIntrinsicProxy(JSContext *ctx);
 void JS_AddIntrinsicMapSet(JSContext *ctx);
+void JS_AddIntrinsicWeakRef(JSContext *ctx);
 void JS_AddIntrinsicTypedArrays(JSContext *ctx);
 void JS_AddIntrinsicPromise(JSContext *ctx);
 void JS_AddIntrinsicBigInt(JSContext *ctx);
@@ -474,6 +488,13 @@ typedef void JSClassGCMark(JSRuntime *rt, JSValueConst val,
 typedef JSValue JSClassCall(JSContext *ctx, JSValueConst func_obj,
                             JSValueConst this_val, int argc, JSValueConst *argv,
                             int flags);
+/* return the value saved in place of the internal data of 'obj' or
+   JS_EXCEPTION */
+typedef JSValue JSClassSave(JSContext *ctx, JSValueConst obj);
+/* set the internal data of 'obj' from the value returned by the save
+   function. Return -1 if exception. */
+typedef int JSClassRestore(JSContext *ctx, JSValueConst obj,
+                           JSValueConst data);
 
 typedef struct JSClassDef {
     const char *class_name;
@@ -488,6 +509,11 @@ typedef struct JSClassDef {
     /* XXX: suppress this indirection ? It is here only to save memory
        because only a few classes need these methods */
     JSClassExoticMethods *exotic;
+    /* optional: used by JS_HibernateContext() and JS_RestoreContext()
+       to save the objects of this class. The class is found by its
+       name when restoring. */
+    JSClassSave *save;
+    JSClassRestore *restore;
 } JSClassDef;
 
 JSClassID JS_NewClassID(JSClassID *pclass_id);
@@ -688,6 +714,12 @@ int JS_ToInt64Ext(JSContext *ctx, int64_t *pres, JSValueConst val);
 
 JSValue JS_NewStringLen(JSContext *ctx, const char *str1, size_t len1);
 JSValue JS_NewString(JSContext *ctx, const char *str);
+typedef void JSFreeStringDataFunc(JSRuntime *rt, void *opaque, void *ptr);
+/* the characters are referenced, not copied */
+JSValue JS_NewExternalString8(JSContext *ctx, const uint8_t *buf, size_t len,
+                              JSFreeStringDataFunc *free_func, void *opaque);
+JSValue JS_NewExternalString16(JSContext *ctx, const uint16_t *buf, size_t len,
+                               JSFreeStringDataFunc *free_func, void *opaque);
 JSValue JS_NewAtomString(JSContext *ctx, const char *str);
 JSValue JS_ToString(JSContext *ctx, JSValueConst val);
 JSValue JS_ToPropertyKey(JSContext *ctx, JSValueConst val);
@@ -793,6 +825,13 @@ void JS_SetOpaque(JSValue obj, void *opaque);
 void *JS_GetOpaque(JSValueConst obj, JSClassID class_id);
 void *JS_GetOpaque2(JSContext *ctx, JSValueConst obj, JSClassID class_id);
 
+/* weak reference to an object: the handle does not keep the object
+   alive. JS_GetWeakRefTarget() returns JS_UNDEFINED once it is freed. */
+typedef struct JSWeakRef JSWeakRef;
+JSWeakRef *JS_NewWeakRef(JSContext *ctx, JSValueConst obj);
+void JS_FreeWeakRef(JSRuntime *rt, JSWeakRef *wr);
+JSValue JS_GetWeakRefTarget(JSContext *ctx, JSWeakRef *wr);
+
 /* 'buf' must be zero terminated i.e. buf[buf_len] = '\0'. */
 JSValue JS_ParseJSON(JSContext *ctx, const char *buf, size_t buf_len,
                      const char *filename);
@@ -802,6 +841,22 @@ JSValue JS_ParseJSON2(JSContext *ctx, const char *buf, size_t buf_len,
 JSValue JS_JSONStringify(JSContext *ctx, JSValueConst obj,
                          JSValueConst replacer, JSValueConst space0);
 
+/* streaming JSON parser */
+#define JS_PARSE_JSON_NDJSON (1 << 1) /* one value per line */
+typedef struct JSJSONParser JSJSONParser;
+/* the values at 'depth' (0 = top level) are returned separately. The
+   members of an object are returned as [name, value] arrays. */
+JSJSONParser *JS_NewJSONParser(JSContext *ctx, int depth, int flags);
+void JS_FreeJSONParser(JSRuntime *rt, JSJSONParser *p);
+/* append input data. Return -1 if exception */
+int JS_JSONParserWrite(JSJSONParser *p, const uint8_t *buf, size_t len);
+/* signal the end of the input */
+void JS_JSONParserEnd(JSJSONParser *p);
+/* return the next complete value (or [name, value] for an object
+   member), JS_UNDEFINED if more input is needed (or if the input
+   ended) or JS_EXCEPTION */
+JSValue JS_JSONParserNext(JSJSONParser *p);
+
 typedef void JSFreeArrayBufferDataFunc(JSRuntime *rt, void *opaque, void *ptr);
 JSValue JS_NewArrayBuffer(JSContext *ctx, uint8_t *buf, size_t len,
                           JSFreeArrayBufferDataFunc *free_func, void *opaque,
@@ -833,6 +888,12 @@ void JS_SetHostPromiseRejectionTracker(JSRuntime *rt, JSHostPromiseRejectionTrac
 /* return != 0 if the JS code needs to be interrupted */
 typedef int JSInterruptHandler(JSRuntime *rt, void *opaque);
 void JS_SetInterruptHandler(JSRuntime *rt, JSInterruptHandler *cb, void *opaque);
+/* thread safe: call the interrupt handler at the next interrupt check */
+void JS_RequestInterrupt(JSRuntime *rt);
+/* terminate the scripts once the calling thread has used 'usec'
+   microseconds of CPU time. usec <= 0 removes the limit. Return -1 if
+   not supported. */
+int JS_SetCPUTimeLimit(JSRuntime *rt, int64_t usec);
 /* if can_block is TRUE, Atomics.wait() can be used */
 void JS_SetCanBlock(JSRuntime *rt, JS_BOOL can_block);
 
@@ -870,6 +931,10 @@ int JS_ExecutePendingJob(JSRuntime *rt, JSContext **pctx);
 #define JS_WRITE_OBJ_REFERENCE (1 << 3) /* allow object references to
                                            encode arbitrary object
                                            graph */
+#define JS_WRITE_OBJ_HEAP      (1 << 4) /* allow closures, prototypes and
+                                           references to built-in
+                                           objects (implies BYTECODE and
+                                           REFERENCE) */
 uint8_t *JS_WriteObject(JSContext *ctx, size_t *psize, JSValueConst obj,
                         int flags);
 uint8_t *JS_WriteObject2(JSContext *ctx, size_t *psize, JSValueConst obj,
@@ -879,9 +944,22 @@ uint8_t *JS_WriteObject2(JSContext *ctx, size_t *psize, JSValueConst obj,
 #define JS_READ_OBJ_ROM_DATA  (1 << 1) /* avoid duplicating 'buf' data */
 #define JS_READ_OBJ_SAB       (1 << 2) /* allow SharedArrayBuffer */
 #define JS_READ_OBJ_REFERENCE (1 << 3) /* allow object references */
+#define JS_READ_OBJ_HEAP      (1 << 4) /* allow closures, prototypes and
+                                          references to built-in objects */
 JSValue JS_ReadObject(JSContext *ctx, const uint8_t *buf, size_t buf_len,
                       int flags);
 
+/* Context hibernation: save the global variables created after the
+   baseline with everything they reference, and restore them in a
+   context set up like the original one. The global properties present
+   when JS_SetHibernationBaseline() is called (or the non enumerable
+   ones if it is never called) are considered as built-in. 'extra' is
+   saved with them and returned by JS_RestoreContext(). */
+int JS_SetHibernationBaseline(JSContext *ctx);
+uint8_t *JS_HibernateContext(JSContext *ctx, size_t *psize,
+                             JSValueConst extra);
+JSValue JS_RestoreContext(JSContext *ctx, const uint8_t *buf, size_t buf_len);
+
 /* load the dependencies of the module 'obj'. Useful when JS_ReadObject()
    returns a module. */
 int JS_ResolveModule(JSContext *ctx, JSValueConst obj);
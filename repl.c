@@ -0,0 +1,2020 @@
+/* File generated automatically by the QuickJS compiler. */
+
+#include <inttypes.h>
+
+const uint32_t qjsc_repl_size = 16082;
+
+const uint8_t qjsc_repl[16082] = {
+ 0x04, 0xa1, 0x03, 0x0e, 0x72, 0x65, 0x70, 0x6c,
+ 0x2e, 0x6a, 0x73, 0x06, 0x73, 0x74, 0x64, 0x04,
+ 0x6f, 0x73, 0x10, 0x69, 0x73, 0x46, 0x69, 0x6e,
+ 0x69, 0x74, 0x65, 0x14, 0x70, 0x61, 0x72, 0x73,
+ 0x65, 0x46, 0x6c, 0x6f, 0x61, 0x74, 0x08, 0x6f,
+ 0x70, 0x65, 0x6e, 0x10, 0x46, 0x72, 0x61, 0x63,
+ 0x74, 0x69, 0x6f, 0x6e, 0x08, 0x1b, 0x5b, 0x30,
+ 0x6d, 0x08, 0x6e, 0x6f, 0x6e, 0x65, 0x0a, 0x1b,
+ 0x5b, 0x33, 0x30, 0x6d, 0x0a, 0x62, 0x6c, 0x61,
+ 0x63, 0x6b, 0x0a, 0x1b, 0x5b, 0x33, 0x31, 0x6d,
+ 0x06, 0x72, 0x65, 0x64, 0x0a, 0x1b, 0x5b, 0x33,
+ 0x32, 0x6d, 0x0a, 0x67, 0x72, 0x65, 0x65, 0x6e,
+ 0x0a, 0x1b, 0x5b, 0x33, 0x33, 0x6d, 0x0c, 0x79,
+ 0x65, 0x6c, 0x6c, 0x6f, 0x77, 0x0a, 0x1b, 0x5b,
+ 0x33, 0x34, 0x6d, 0x08, 0x62, 0x6c, 0x75, 0x65,
+ 0x0a, 0x1b, 0x5b, 0x33, 0x35, 0x6d, 0x0e, 0x6d,
+ 0x61, 0x67, 0x65, 0x6e, 0x74, 0x61, 0x0a, 0x1b,
+ 0x5b, 0x33, 0x36, 0x6d, 0x08, 0x63, 0x79, 0x61,
+ 0x6e, 0x0a, 0x1b, 0x5b, 0x33, 0x37, 0x6d, 0x0a,
+ 0x77, 0x68, 0x69, 0x74, 0x65, 0x0e, 0x1b, 0x5b,
+ 0x33, 0x30, 0x3b, 0x31, 0x6d, 0x08, 0x67, 0x72,
+ 0x61, 0x79, 0x08, 0x67, 0x72, 0x65, 0x79, 0x0e,
+ 0x1b, 0x5b, 0x33, 0x31, 0x3b, 0x31, 0x6d, 0x14,
+ 0x62, 0x72, 0x69, 0x67, 0x68, 0x74, 0x5f, 0x72,
+ 0x65, 0x64, 0x0e, 0x1b, 0x5b, 0x33, 0x32, 0x3b,
+ 0x31, 0x6d, 0x18, 0x62, 0x72, 0x69, 0x67, 0x68,
+ 0x74, 0x5f, 0x67, 0x72, 0x65, 0x65, 0x6e, 0x0e,
+ 0x1b, 0x5b, 0x33, 0x33, 0x3b, 0x31, 0x6d, 0x1a,
+ 0x62, 0x72, 0x69, 0x67, 0x68, 0x74, 0x5f, 0x79,
+ 0x65, 0x6c, 0x6c, 0x6f, 0x77, 0x0e, 0x1b, 0x5b,
+ 0x33, 0x34, 0x3b, 0x31, 0x6d, 0x16, 0x62, 0x72,
+ 0x69, 0x67, 0x68, 0x74, 0x5f, 0x62, 0x6c, 0x75,
+ 0x65, 0x0e, 0x1b, 0x5b, 0x33, 0x35, 0x3b, 0x31,
+ 0x6d, 0x1c, 0x62, 0x72, 0x69, 0x67, 0x68, 0x74,
+ 0x5f, 0x6d, 0x61, 0x67, 0x65, 0x6e, 0x74, 0x61,
+ 0x0e, 0x1b, 0x5b, 0x33, 0x36, 0x3b, 0x31, 0x6d,
+ 0x16, 0x62, 0x72, 0x69, 0x67, 0x68, 0x74, 0x5f,
+ 0x63, 0x79, 0x61, 0x6e, 0x0e, 0x1b, 0x5b, 0x33,
+ 0x37, 0x3b, 0x31, 0x6d, 0x18, 0x62, 0x72, 0x69,
+ 0x67, 0x68, 0x74, 0x5f, 0x77, 0x68, 0x69, 0x74,
+ 0x65, 0x0e, 0x63, 0x6f, 0x6d, 0x6d, 0x65, 0x6e,
+ 0x74, 0x0a, 0x72, 0x65, 0x67, 0x65, 0x78, 0x0e,
+ 0x6b, 0x65, 0x79, 0x77, 0x6f, 0x72, 0x64, 0x08,
+ 0x74, 0x79, 0x70, 0x65, 0x14, 0x69, 0x64, 0x65,
+ 0x6e, 0x74, 0x69, 0x66, 0x69, 0x65, 0x72, 0x0a,
+ 0x65, 0x72, 0x72, 0x6f, 0x72, 0x0c, 0x72, 0x65,
+ 0x73, 0x75, 0x6c, 0x74, 0x12, 0x65, 0x72, 0x72,
+ 0x6f, 0x72, 0x5f, 0x6d, 0x73, 0x67, 0x04, 0x3e,
+ 0x20, 0x0c, 0x71, 0x6a, 0x73, 0x20, 0x3e, 0x20,
+ 0x0c, 0x20, 0x20, 0x2e, 0x2e, 0x2e, 0x20, 0x02,
+ 0x01, 0x02, 0x02, 0x02, 0x03, 0x02, 0x04, 0x02,
+ 0x05, 0x02, 0x06, 0x02, 0x07, 0x02, 0x08, 0x02,
+ 0x09, 0x02, 0x0a, 0x02, 0x0b, 0x02, 0x0d, 0x02,
+ 0x0e, 0x02, 0x10, 0x02, 0x11, 0x02, 0x12, 0x02,
+ 0x13, 0x02, 0x14, 0x02, 0x18, 0x02, 0x19, 0x06,
+ 0x1b, 0x4f, 0x41, 0x06, 0x1b, 0x4f, 0x42, 0x06,
+ 0x1b, 0x4f, 0x43, 0x06, 0x1b, 0x4f, 0x44, 0x06,
+ 0x1b, 0x4f, 0x46, 0x06, 0x1b, 0x4f, 0x48, 0x0c,
+ 0x1b, 0x5b, 0x31, 0x3b, 0x35, 0x43, 0x0c, 0x1b,
+ 0x5b, 0x31, 0x3b, 0x35, 0x44, 0x08, 0x1b, 0x5b,
+ 0x31, 0x7e, 0x08, 0x1b, 0x5b, 0x33, 0x7e, 0x08,
+ 0x1b, 0x5b, 0x34, 0x7e, 0x08, 0x1b, 0x5b, 0x35,
+ 0x7e, 0x08, 0x1b, 0x5b, 0x36, 0x7e, 0x06, 0x1b,
+ 0x5b, 0x41, 0x06, 0x1b, 0x5b, 0x42, 0x06, 0x1b,
+ 0x5b, 0x43, 0x06, 0x1b, 0x5b, 0x44, 0x06, 0x1b,
+ 0x5b, 0x46, 0x06, 0x1b, 0x5b, 0x48, 0x04, 0x1b,
+ 0x7f, 0x04, 0x1b, 0x62, 0x04, 0x1b, 0x64, 0x04,
+ 0x1b, 0x66, 0x04, 0x1b, 0x6b, 0x04, 0x1b, 0x6c,
+ 0x04, 0x1b, 0x74, 0x04, 0x1b, 0x75, 0x02, 0x7f,
+ 0x0e, 0x65, 0x78, 0x65, 0x63, 0x43, 0x6d, 0x64,
+ 0x10, 0x74, 0x65, 0x72, 0x6d, 0x49, 0x6e, 0x69,
+ 0x74, 0x0c, 0x66, 0x69, 0x6c, 0x65, 0x6e, 0x6f,
+ 0x0c, 0x69, 0x73, 0x61, 0x74, 0x74, 0x79, 0x1a,
+ 0x74, 0x74, 0x79, 0x47, 0x65, 0x74, 0x57, 0x69,
+ 0x6e, 0x53, 0x69, 0x7a, 0x65, 0x12, 0x74, 0x74,
+ 0x79, 0x53, 0x65, 0x74, 0x52, 0x61, 0x77, 0x0c,
+ 0x73, 0x69, 0x67, 0x6e, 0x61, 0x6c, 0x0c, 0x53,
+ 0x49, 0x47, 0x49, 0x4e, 0x54, 0x1c, 0x73, 0x65,
+ 0x74, 0x52, 0x65, 0x61, 0x64, 0x48, 0x61, 0x6e,
+ 0x64, 0x6c, 0x65, 0x72, 0x1c, 0x73, 0x69, 0x67,
+ 0x69, 0x6e, 0x74, 0x5f, 0x68, 0x61, 0x6e, 0x64,
+ 0x6c, 0x65, 0x72, 0x16, 0x68, 0x61, 0x6e, 0x64,
+ 0x6c, 0x65, 0x5f, 0x62, 0x79, 0x74, 0x65, 0x22,
+ 0x74, 0x65, 0x72, 0x6d, 0x5f, 0x72, 0x65, 0x61,
+ 0x64, 0x5f, 0x68, 0x61, 0x6e, 0x64, 0x6c, 0x65,
+ 0x72, 0x08, 0x72, 0x65, 0x61, 0x64, 0x0c, 0x62,
+ 0x75, 0x66, 0x66, 0x65, 0x72, 0x10, 0x69, 0x73,
+ 0x5f, 0x61, 0x6c, 0x70, 0x68, 0x61, 0x02, 0x41,
+ 0x02, 0x5a, 0x02, 0x61, 0x02, 0x7a, 0x10, 0x69,
+ 0x73, 0x5f, 0x64, 0x69, 0x67, 0x69, 0x74, 0x0e,
+ 0x69, 0x73, 0x5f, 0x77, 0x6f, 0x72, 0x64, 0x02,
+ 0x5f, 0x02, 0x24, 0x14, 0x75, 0x63, 0x73, 0x5f,
+ 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x14, 0x63,
+ 0x68, 0x61, 0x72, 0x43, 0x6f, 0x64, 0x65, 0x41,
+ 0x74, 0x2a, 0x69, 0x73, 0x5f, 0x74, 0x72, 0x61,
+ 0x69, 0x6c, 0x69, 0x6e, 0x67, 0x5f, 0x73, 0x75,
+ 0x72, 0x72, 0x6f, 0x67, 0x61, 0x74, 0x65, 0x16,
+ 0x63, 0x6f, 0x64, 0x65, 0x50, 0x6f, 0x69, 0x6e,
+ 0x74, 0x41, 0x74, 0x16, 0x69, 0x73, 0x5f, 0x62,
+ 0x61, 0x6c, 0x61, 0x6e, 0x63, 0x65, 0x64, 0x04,
+ 0x28, 0x29, 0x04, 0x5b, 0x5d, 0x04, 0x7b, 0x7d,
+ 0x20, 0x70, 0x72, 0x69, 0x6e, 0x74, 0x5f, 0x63,
+ 0x6f, 0x6c, 0x6f, 0x72, 0x5f, 0x74, 0x65, 0x78,
+ 0x74, 0x08, 0x70, 0x75, 0x74, 0x73, 0x12, 0x73,
+ 0x75, 0x62, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67,
+ 0x12, 0x70, 0x72, 0x69, 0x6e, 0x74, 0x5f, 0x63,
+ 0x73, 0x69, 0x04, 0x1b, 0x5b, 0x16, 0x6d, 0x6f,
+ 0x76, 0x65, 0x5f, 0x63, 0x75, 0x72, 0x73, 0x6f,
+ 0x72, 0x06, 0x6d, 0x69, 0x6e, 0x02, 0x43, 0x02,
+ 0x44, 0x0c, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65,
+ 0x04, 0x20, 0x08, 0x06, 0x1b, 0x5b, 0x4a, 0x06,
+ 0x6f, 0x75, 0x74, 0x0a, 0x66, 0x6c, 0x75, 0x73,
+ 0x68, 0x0c, 0x69, 0x6e, 0x73, 0x65, 0x72, 0x74,
+ 0x1a, 0x71, 0x75, 0x6f, 0x74, 0x65, 0x64, 0x5f,
+ 0x69, 0x6e, 0x73, 0x65, 0x72, 0x74, 0x14, 0x71,
+ 0x75, 0x6f, 0x74, 0x65, 0x5f, 0x66, 0x6c, 0x61,
+ 0x67, 0x0a, 0x61, 0x62, 0x6f, 0x72, 0x74, 0x06,
+ 0x63, 0x6d, 0x64, 0x14, 0x63, 0x75, 0x72, 0x73,
+ 0x6f, 0x72, 0x5f, 0x70, 0x6f, 0x73, 0x0a, 0x61,
+ 0x6c, 0x65, 0x72, 0x74, 0x22, 0x62, 0x65, 0x67,
+ 0x69, 0x6e, 0x6e, 0x69, 0x6e, 0x67, 0x5f, 0x6f,
+ 0x66, 0x5f, 0x6c, 0x69, 0x6e, 0x65, 0x16, 0x65,
+ 0x6e, 0x64, 0x5f, 0x6f, 0x66, 0x5f, 0x6c, 0x69,
+ 0x6e, 0x65, 0x18, 0x66, 0x6f, 0x72, 0x77, 0x61,
+ 0x72, 0x64, 0x5f, 0x63, 0x68, 0x61, 0x72, 0x0c,
+ 0x63, 0x68, 0x61, 0x72, 0x41, 0x74, 0x1a, 0x62,
+ 0x61, 0x63, 0x6b, 0x77, 0x61, 0x72, 0x64, 0x5f,
+ 0x63, 0x68, 0x61, 0x72, 0x22, 0x73, 0x6b, 0x69,
+ 0x70, 0x5f, 0x77, 0x6f, 0x72, 0x64, 0x5f, 0x66,
+ 0x6f, 0x72, 0x77, 0x61, 0x72, 0x64, 0x24, 0x73,
+ 0x6b, 0x69, 0x70, 0x5f, 0x77, 0x6f, 0x72, 0x64,
+ 0x5f, 0x62, 0x61, 0x63, 0x6b, 0x77, 0x61, 0x72,
+ 0x64, 0x18, 0x66, 0x6f, 0x72, 0x77, 0x61, 0x72,
+ 0x64, 0x5f, 0x77, 0x6f, 0x72, 0x64, 0x1a, 0x62,
+ 0x61, 0x63, 0x6b, 0x77, 0x61, 0x72, 0x64, 0x5f,
+ 0x77, 0x6f, 0x72, 0x64, 0x16, 0x61, 0x63, 0x63,
+ 0x65, 0x70, 0x74, 0x5f, 0x6c, 0x69, 0x6e, 0x65,
+ 0x16, 0x68, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79,
+ 0x5f, 0x61, 0x64, 0x64, 0x08, 0x70, 0x75, 0x73,
+ 0x68, 0x20, 0x70, 0x72, 0x65, 0x76, 0x69, 0x6f,
+ 0x75, 0x73, 0x5f, 0x68, 0x69, 0x73, 0x74, 0x6f,
+ 0x72, 0x79, 0x1a, 0x68, 0x69, 0x73, 0x74, 0x6f,
+ 0x72, 0x79, 0x5f, 0x69, 0x6e, 0x64, 0x65, 0x78,
+ 0x0e, 0x68, 0x69, 0x73, 0x74, 0x6f, 0x72, 0x79,
+ 0x18, 0x6e, 0x65, 0x78, 0x74, 0x5f, 0x68, 0x69,
+ 0x73, 0x74, 0x6f, 0x72, 0x79, 0x1c, 0x68, 0x69,
+ 0x73, 0x74, 0x6f, 0x72, 0x79, 0x5f, 0x73, 0x65,
+ 0x61, 0x72, 0x63, 0x68, 0x2e, 0x68, 0x69, 0x73,
+ 0x74, 0x6f, 0x72, 0x79, 0x5f, 0x73, 0x65, 0x61,
+ 0x72, 0x63, 0x68, 0x5f, 0x62, 0x61, 0x63, 0x6b,
+ 0x77, 0x61, 0x72, 0x64, 0x2c, 0x68, 0x69, 0x73,
+ 0x74, 0x6f, 0x72, 0x79, 0x5f, 0x73, 0x65, 0x61,
+ 0x72, 0x63, 0x68, 0x5f, 0x66, 0x6f, 0x72, 0x77,
+ 0x61, 0x72, 0x64, 0x1e, 0x64, 0x65, 0x6c, 0x65,
+ 0x74, 0x65, 0x5f, 0x63, 0x68, 0x61, 0x72, 0x5f,
+ 0x64, 0x69, 0x72, 0x16, 0x64, 0x65, 0x6c, 0x65,
+ 0x74, 0x65, 0x5f, 0x63, 0x68, 0x61, 0x72, 0x12,
+ 0x63, 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x5f,
+ 0x64, 0x28, 0x62, 0x61, 0x63, 0x6b, 0x77, 0x61,
+ 0x72, 0x64, 0x5f, 0x64, 0x65, 0x6c, 0x65, 0x74,
+ 0x65, 0x5f, 0x63, 0x68, 0x61, 0x72, 0x1e, 0x74,
+ 0x72, 0x61, 0x6e, 0x73, 0x70, 0x6f, 0x73, 0x65,
+ 0x5f, 0x63, 0x68, 0x61, 0x72, 0x73, 0x1e, 0x74,
+ 0x72, 0x61, 0x6e, 0x73, 0x70, 0x6f, 0x73, 0x65,
+ 0x5f, 0x77, 0x6f, 0x72, 0x64, 0x73, 0x16, 0x75,
+ 0x70, 0x63, 0x61, 0x73, 0x65, 0x5f, 0x77, 0x6f,
+ 0x72, 0x64, 0x16, 0x74, 0x6f, 0x55, 0x70, 0x70,
+ 0x65, 0x72, 0x43, 0x61, 0x73, 0x65, 0x1a, 0x64,
+ 0x6f, 0x77, 0x6e, 0x63, 0x61, 0x73, 0x65, 0x5f,
+ 0x77, 0x6f, 0x72, 0x64, 0x16, 0x74, 0x6f, 0x4c,
+ 0x6f, 0x77, 0x65, 0x72, 0x43, 0x61, 0x73, 0x65,
+ 0x16, 0x6b, 0x69, 0x6c, 0x6c, 0x5f, 0x72, 0x65,
+ 0x67, 0x69, 0x6f, 0x6e, 0x12, 0x6b, 0x69, 0x6c,
+ 0x6c, 0x5f, 0x6c, 0x69, 0x6e, 0x65, 0x24, 0x62,
+ 0x61, 0x63, 0x6b, 0x77, 0x61, 0x72, 0x64, 0x5f,
+ 0x6b, 0x69, 0x6c, 0x6c, 0x5f, 0x6c, 0x69, 0x6e,
+ 0x65, 0x12, 0x6b, 0x69, 0x6c, 0x6c, 0x5f, 0x77,
+ 0x6f, 0x72, 0x64, 0x24, 0x62, 0x61, 0x63, 0x6b,
+ 0x77, 0x61, 0x72, 0x64, 0x5f, 0x6b, 0x69, 0x6c,
+ 0x6c, 0x5f, 0x77, 0x6f, 0x72, 0x64, 0x08, 0x79,
+ 0x61, 0x6e, 0x6b, 0x14, 0x63, 0x6c, 0x69, 0x70,
+ 0x5f, 0x62, 0x6f, 0x61, 0x72, 0x64, 0x12, 0x63,
+ 0x6f, 0x6e, 0x74, 0x72, 0x6f, 0x6c, 0x5f, 0x63,
+ 0x10, 0x6c, 0x61, 0x73, 0x74, 0x5f, 0x66, 0x75,
+ 0x6e, 0x2a, 0x72, 0x65, 0x61, 0x64, 0x6c, 0x69,
+ 0x6e, 0x65, 0x5f, 0x70, 0x72, 0x69, 0x6e, 0x74,
+ 0x5f, 0x70, 0x72, 0x6f, 0x6d, 0x70, 0x74, 0x08,
+ 0x65, 0x78, 0x69, 0x74, 0x3c, 0x0a, 0x28, 0x50,
+ 0x72, 0x65, 0x73, 0x73, 0x20, 0x43, 0x74, 0x72,
+ 0x6c, 0x2d, 0x43, 0x20, 0x61, 0x67, 0x61, 0x69,
+ 0x6e, 0x20, 0x74, 0x6f, 0x20, 0x71, 0x75, 0x69,
+ 0x74, 0x29, 0x0a, 0x0a, 0x72, 0x65, 0x73, 0x65,
+ 0x74, 0x20, 0x67, 0x65, 0x74, 0x5f, 0x63, 0x6f,
+ 0x6e, 0x74, 0x65, 0x78, 0x74, 0x5f, 0x77, 0x6f,
+ 0x72, 0x64, 0x24, 0x67, 0x65, 0x74, 0x5f, 0x63,
+ 0x6f, 0x6e, 0x74, 0x65, 0x78, 0x74, 0x5f, 0x6f,
+ 0x62, 0x6a, 0x65, 0x63, 0x74, 0x08, 0x6c, 0x69,
+ 0x6e, 0x65, 0x06, 0x70, 0x6f, 0x73, 0x06, 0x6f,
+ 0x62, 0x6a, 0x08, 0x62, 0x61, 0x73, 0x65, 0x02,
+ 0x63, 0x02, 0x67, 0x1c, 0x63, 0x6f, 0x6e, 0x66,
+ 0x69, 0x67, 0x5f, 0x6e, 0x75, 0x6d, 0x63, 0x61,
+ 0x6c, 0x63, 0x14, 0x68, 0x61, 0x73, 0x5f, 0x6a,
+ 0x73, 0x63, 0x61, 0x6c, 0x63, 0x14, 0x68, 0x61,
+ 0x73, 0x5f, 0x62, 0x69, 0x67, 0x6e, 0x75, 0x6d,
+ 0x0c, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x73, 0x0c,
+ 0x73, 0x74, 0x79, 0x6c, 0x65, 0x73, 0x08, 0x70,
+ 0x72, 0x65, 0x63, 0x0e, 0x65, 0x78, 0x70, 0x42,
+ 0x69, 0x74, 0x73, 0x0e, 0x6c, 0x6f, 0x67, 0x32,
+ 0x5f, 0x31, 0x30, 0x0c, 0x70, 0x73, 0x74, 0x61,
+ 0x74, 0x65, 0x0c, 0x70, 0x72, 0x6f, 0x6d, 0x70,
+ 0x74, 0x08, 0x70, 0x6c, 0x65, 0x6e, 0x06, 0x70,
+ 0x73, 0x31, 0x06, 0x70, 0x73, 0x32, 0x08, 0x75,
+ 0x74, 0x66, 0x38, 0x12, 0x73, 0x68, 0x6f, 0x77,
+ 0x5f, 0x74, 0x69, 0x6d, 0x65, 0x16, 0x73, 0x68,
+ 0x6f, 0x77, 0x5f, 0x63, 0x6f, 0x6c, 0x6f, 0x72,
+ 0x73, 0x12, 0x65, 0x76, 0x61, 0x6c, 0x5f, 0x74,
+ 0x69, 0x6d, 0x65, 0x0a, 0x6d, 0x65, 0x78, 0x70,
+ 0x72, 0x0a, 0x6c, 0x65, 0x76, 0x65, 0x6c, 0x10,
+ 0x6c, 0x61, 0x73, 0x74, 0x5f, 0x63, 0x6d, 0x64,
+ 0x1e, 0x6c, 0x61, 0x73, 0x74, 0x5f, 0x63, 0x75,
+ 0x72, 0x73, 0x6f, 0x72, 0x5f, 0x70, 0x6f, 0x73,
+ 0x10, 0x74, 0x68, 0x69, 0x73, 0x5f, 0x66, 0x75,
+ 0x6e, 0x14, 0x75, 0x74, 0x66, 0x38, 0x5f, 0x73,
+ 0x74, 0x61, 0x74, 0x65, 0x10, 0x75, 0x74, 0x66,
+ 0x38, 0x5f, 0x76, 0x61, 0x6c, 0x0e, 0x74, 0x65,
+ 0x72, 0x6d, 0x5f, 0x66, 0x64, 0x1a, 0x74, 0x65,
+ 0x72, 0x6d, 0x5f, 0x72, 0x65, 0x61, 0x64, 0x5f,
+ 0x62, 0x75, 0x66, 0x14, 0x74, 0x65, 0x72, 0x6d,
+ 0x5f, 0x77, 0x69, 0x64, 0x74, 0x68, 0x1a, 0x74,
+ 0x65, 0x72, 0x6d, 0x5f, 0x63, 0x75, 0x72, 0x73,
+ 0x6f, 0x72, 0x5f, 0x78, 0x1e, 0x67, 0x65, 0x74,
+ 0x5f, 0x63, 0x6f, 0x6d, 0x70, 0x6c, 0x65, 0x74,
+ 0x69, 0x6f, 0x6e, 0x73, 0x14, 0x63, 0x6f, 0x6d,
+ 0x70, 0x6c, 0x65, 0x74, 0x69, 0x6f, 0x6e, 0x10,
+ 0x63, 0x6f, 0x6d, 0x6d, 0x61, 0x6e, 0x64, 0x73,
+ 0x0c, 0x64, 0x75, 0x70, 0x73, 0x74, 0x72, 0x1a,
+ 0x72, 0x65, 0x61, 0x64, 0x6c, 0x69, 0x6e, 0x65,
+ 0x5f, 0x6b, 0x65, 0x79, 0x73, 0x1c, 0x72, 0x65,
+ 0x61, 0x64, 0x6c, 0x69, 0x6e, 0x65, 0x5f, 0x73,
+ 0x74, 0x61, 0x74, 0x65, 0x16, 0x72, 0x65, 0x61,
+ 0x64, 0x6c, 0x69, 0x6e, 0x65, 0x5f, 0x63, 0x62,
+ 0x1c, 0x72, 0x65, 0x61, 0x64, 0x6c, 0x69, 0x6e,
+ 0x65, 0x5f, 0x73, 0x74, 0x61, 0x72, 0x74, 0x16,
+ 0x68, 0x61, 0x6e, 0x64, 0x6c, 0x65, 0x5f, 0x63,
+ 0x68, 0x61, 0x72, 0x14, 0x68, 0x61, 0x6e, 0x64,
+ 0x6c, 0x65, 0x5f, 0x6b, 0x65, 0x79, 0x10, 0x68,
+ 0x65, 0x78, 0x5f, 0x6d, 0x6f, 0x64, 0x65, 0x12,
+ 0x65, 0x76, 0x61, 0x6c, 0x5f, 0x6d, 0x6f, 0x64,
+ 0x65, 0x20, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72,
+ 0x5f, 0x74, 0x6f, 0x5f, 0x73, 0x74, 0x72, 0x69,
+ 0x6e, 0x67, 0x24, 0x62, 0x69, 0x67, 0x66, 0x6c,
+ 0x6f, 0x61, 0x74, 0x5f, 0x74, 0x6f, 0x5f, 0x73,
+ 0x74, 0x72, 0x69, 0x6e, 0x67, 0x20, 0x62, 0x69,
+ 0x67, 0x69, 0x6e, 0x74, 0x5f, 0x74, 0x6f, 0x5f,
+ 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x0a, 0x70,
+ 0x72, 0x69, 0x6e, 0x74, 0x22, 0x65, 0x78, 0x74,
+ 0x72, 0x61, 0x63, 0x74, 0x5f, 0x64, 0x69, 0x72,
+ 0x65, 0x63, 0x74, 0x69, 0x76, 0x65, 0x20, 0x68,
+ 0x61, 0x6e, 0x64, 0x6c, 0x65, 0x5f, 0x64, 0x69,
+ 0x72, 0x65, 0x63, 0x74, 0x69, 0x76, 0x65, 0x08,
+ 0x68, 0x65, 0x6c, 0x70, 0x1c, 0x65, 0x76, 0x61,
+ 0x6c, 0x5f, 0x61, 0x6e, 0x64, 0x5f, 0x70, 0x72,
+ 0x69, 0x6e, 0x74, 0x12, 0x63, 0x6d, 0x64, 0x5f,
+ 0x73, 0x74, 0x61, 0x72, 0x74, 0x24, 0x63, 0x6d,
+ 0x64, 0x5f, 0x72, 0x65, 0x61, 0x64, 0x6c, 0x69,
+ 0x6e, 0x65, 0x5f, 0x73, 0x74, 0x61, 0x72, 0x74,
+ 0x26, 0x72, 0x65, 0x61, 0x64, 0x6c, 0x69, 0x6e,
+ 0x65, 0x5f, 0x68, 0x61, 0x6e, 0x64, 0x6c, 0x65,
+ 0x5f, 0x63, 0x6d, 0x64, 0x14, 0x68, 0x61, 0x6e,
+ 0x64, 0x6c, 0x65, 0x5f, 0x63, 0x6d, 0x64, 0x16,
+ 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x69, 0x7a, 0x65,
+ 0x5f, 0x6a, 0x73, 0x2a, 0x20, 0x7e, 0x21, 0x25,
+ 0x5e, 0x26, 0x2a, 0x28, 0x2d, 0x2b, 0x3d, 0x7b,
+ 0x5b, 0x7c, 0x3a, 0x3b, 0x2c, 0x3c, 0x3e, 0x3f,
+ 0x2f, 0x0e, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x4f,
+ 0x66, 0x02, 0x2e, 0x02, 0x27, 0x02, 0x22, 0x02,
+ 0x5d, 0x02, 0x7d, 0x02, 0x2f, 0x10, 0x69, 0x6e,
+ 0x63, 0x6c, 0x75, 0x64, 0x65, 0x73, 0x0a, 0x69,
+ 0x73, 0x4e, 0x61, 0x4e, 0x26, 0x67, 0x65, 0x74,
+ 0x4f, 0x77, 0x6e, 0x50, 0x72, 0x6f, 0x70, 0x65,
+ 0x72, 0x74, 0x79, 0x4e, 0x61, 0x6d, 0x65, 0x73,
+ 0x14, 0x73, 0x74, 0x61, 0x72, 0x74, 0x73, 0x57,
+ 0x69, 0x74, 0x68, 0x08, 0x73, 0x6f, 0x72, 0x74,
+ 0x06, 0x74, 0x61, 0x62, 0x06, 0x63, 0x74, 0x78,
+ 0x0c, 0x73, 0x79, 0x6d, 0x63, 0x6d, 0x70, 0x02,
+ 0x28, 0x02, 0x29, 0x06, 0x6d, 0x61, 0x78, 0x0a,
+ 0x66, 0x6c, 0x6f, 0x6f, 0x72, 0x08, 0x63, 0x65,
+ 0x69, 0x6c, 0x0c, 0x70, 0x61, 0x64, 0x45, 0x6e,
+ 0x64, 0x02, 0x20, 0x0a, 0x72, 0x6f, 0x75, 0x6e,
+ 0x64, 0x1a, 0x66, 0x72, 0x6f, 0x6d, 0x43, 0x6f,
+ 0x64, 0x65, 0x50, 0x6f, 0x69, 0x6e, 0x74, 0x02,
+ 0x1b, 0x02, 0x5b, 0x02, 0x4f, 0x02, 0x3b, 0x04,
+ 0x2d, 0x30, 0x02, 0x2d, 0x04, 0x30, 0x78, 0x08,
+ 0x6d, 0x61, 0x74, 0x68, 0x12, 0x42, 0x69, 0x67,
+ 0x46, 0x6c, 0x6f, 0x61, 0x74, 0x28, 0x02, 0x6c,
+ 0x02, 0x70, 0x02, 0x65, 0x04, 0x2e, 0x30, 0x02,
+ 0x6e, 0x12, 0x70, 0x72, 0x69, 0x6e, 0x74, 0x5f,
+ 0x72, 0x65, 0x63, 0x14, 0x5b, 0x63, 0x69, 0x72,
+ 0x63, 0x75, 0x6c, 0x61, 0x72, 0x5d, 0x0e, 0x43,
+ 0x6f, 0x6d, 0x70, 0x6c, 0x65, 0x78, 0x06, 0x4d,
+ 0x6f, 0x64, 0x14, 0x50, 0x6f, 0x6c, 0x79, 0x6e,
+ 0x6f, 0x6d, 0x69, 0x61, 0x6c, 0x0e, 0x50, 0x6f,
+ 0x6c, 0x79, 0x4d, 0x6f, 0x64, 0x20, 0x52, 0x61,
+ 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x46, 0x75,
+ 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x0c, 0x53,
+ 0x65, 0x72, 0x69, 0x65, 0x73, 0x0e, 0x69, 0x73,
+ 0x41, 0x72, 0x72, 0x61, 0x79, 0x04, 0x5b, 0x20,
+ 0x04, 0x2c, 0x20, 0x0e, 0x3c, 0x65, 0x6d, 0x70,
+ 0x74, 0x79, 0x3e, 0x06, 0x2e, 0x2e, 0x2e, 0x04,
+ 0x20, 0x5d, 0x14, 0x5f, 0x5f, 0x67, 0x65, 0x74,
+ 0x43, 0x6c, 0x61, 0x73, 0x73, 0x08, 0x6b, 0x65,
+ 0x79, 0x73, 0x04, 0x7b, 0x20, 0x04, 0x3a, 0x20,
+ 0x04, 0x20, 0x7d, 0x06, 0x70, 0x6f, 0x70, 0x0e,
+ 0x5f, 0x5f, 0x71, 0x75, 0x6f, 0x74, 0x65, 0x08,
+ 0x2e, 0x2e, 0x2e, 0x22, 0x02, 0x6d, 0x12, 0x66,
+ 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20,
+ 0x02, 0x5c, 0x02, 0x68, 0x02, 0x3f, 0x08, 0x6c,
+ 0x6f, 0x61, 0x64, 0x08, 0x74, 0x72, 0x69, 0x6d,
+ 0x16, 0x6c, 0x61, 0x73, 0x74, 0x49, 0x6e, 0x64,
+ 0x65, 0x78, 0x4f, 0x66, 0x06, 0x2e, 0x6a, 0x73,
+ 0x14, 0x6c, 0x6f, 0x61, 0x64, 0x53, 0x63, 0x72,
+ 0x69, 0x70, 0x74, 0x02, 0x78, 0x02, 0x64, 0x02,
+ 0x74, 0x26, 0x42, 0x69, 0x67, 0x46, 0x6c, 0x6f,
+ 0x61, 0x74, 0x20, 0x70, 0x72, 0x65, 0x63, 0x69,
+ 0x73, 0x69, 0x6f, 0x6e, 0x3d, 0x10, 0x20, 0x62,
+ 0x69, 0x74, 0x73, 0x20, 0x28, 0x7e, 0x30, 0x20,
+ 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x29, 0x2c,
+ 0x20, 0x65, 0x78, 0x70, 0x6f, 0x6e, 0x65, 0x6e,
+ 0x74, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x3d, 0x0c,
+ 0x20, 0x62, 0x69, 0x74, 0x73, 0x0a, 0x06, 0x66,
+ 0x31, 0x36, 0x06, 0x66, 0x33, 0x32, 0x06, 0x66,
+ 0x36, 0x34, 0x08, 0x66, 0x31, 0x32, 0x38, 0x10,
+ 0x70, 0x61, 0x72, 0x73, 0x65, 0x49, 0x6e, 0x74,
+ 0x14, 0x65, 0x78, 0x70, 0x42, 0x69, 0x74, 0x73,
+ 0x4d, 0x61, 0x78, 0x0e, 0x70, 0x72, 0x65, 0x63,
+ 0x4d, 0x69, 0x6e, 0x0e, 0x70, 0x72, 0x65, 0x63,
+ 0x4d, 0x61, 0x78, 0x24, 0x49, 0x6e, 0x76, 0x61,
+ 0x6c, 0x69, 0x64, 0x20, 0x70, 0x72, 0x65, 0x63,
+ 0x69, 0x73, 0x69, 0x6f, 0x6e, 0x0a, 0x14, 0x65,
+ 0x78, 0x70, 0x42, 0x69, 0x74, 0x73, 0x4d, 0x69,
+ 0x6e, 0x2c, 0x49, 0x6e, 0x76, 0x61, 0x6c, 0x69,
+ 0x64, 0x20, 0x65, 0x78, 0x70, 0x6f, 0x6e, 0x65,
+ 0x6e, 0x74, 0x20, 0x62, 0x69, 0x74, 0x73, 0x0a,
+ 0x0c, 0x64, 0x69, 0x67, 0x69, 0x74, 0x73, 0x08,
+ 0x6d, 0x6f, 0x64, 0x65, 0x1a, 0x52, 0x75, 0x6e,
+ 0x6e, 0x69, 0x6e, 0x67, 0x20, 0x6d, 0x6f, 0x64,
+ 0x65, 0x3d, 0x1a, 0x49, 0x6e, 0x76, 0x61, 0x6c,
+ 0x69, 0x64, 0x20, 0x6d, 0x6f, 0x64, 0x65, 0x0a,
+ 0x0a, 0x63, 0x6c, 0x65, 0x61, 0x72, 0x0c, 0x1b,
+ 0x5b, 0x48, 0x1b, 0x5b, 0x4a, 0x02, 0x71, 0x1a,
+ 0x61, 0x6c, 0x67, 0x65, 0x62, 0x72, 0x61, 0x69,
+ 0x63, 0x4d, 0x6f, 0x64, 0x65, 0x26, 0x55, 0x6e,
+ 0x6b, 0x6e, 0x6f, 0x77, 0x6e, 0x20, 0x64, 0x69,
+ 0x72, 0x65, 0x63, 0x74, 0x69, 0x76, 0x65, 0x3a,
+ 0x20, 0x06, 0x64, 0x65, 0x63, 0x06, 0x68, 0x65,
+ 0x78, 0x06, 0x6e, 0x75, 0x6d, 0x06, 0x61, 0x6c,
+ 0x67, 0x2c, 0x5c, 0x68, 0x20, 0x20, 0x20, 0x20,
+ 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x68,
+ 0x69, 0x73, 0x20, 0x68, 0x65, 0x6c, 0x70, 0x0a,
+ 0x16, 0x5c, 0x78, 0x20, 0x20, 0x20, 0x20, 0x20,
+ 0x20, 0x20, 0x20, 0x20, 0x36, 0x68, 0x65, 0x78,
+ 0x61, 0x64, 0x65, 0x63, 0x69, 0x6d, 0x61, 0x6c,
+ 0x20, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x20,
+ 0x64, 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x0a,
+ 0x16, 0x5c, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20,
+ 0x20, 0x20, 0x20, 0x20, 0x2e, 0x64, 0x65, 0x63,
+ 0x69, 0x6d, 0x61, 0x6c, 0x20, 0x6e, 0x75, 0x6d,
+ 0x62, 0x65, 0x72, 0x20, 0x64, 0x69, 0x73, 0x70,
+ 0x6c, 0x61, 0x79, 0x0a, 0x16, 0x5c, 0x74, 0x20,
+ 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+ 0x2c, 0x74, 0x6f, 0x67, 0x67, 0x6c, 0x65, 0x20,
+ 0x74, 0x69, 0x6d, 0x69, 0x6e, 0x67, 0x20, 0x64,
+ 0x69, 0x73, 0x70, 0x6c, 0x61, 0x79, 0x0a, 0x3e,
+ 0x5c, 0x63, 0x6c, 0x65, 0x61, 0x72, 0x20, 0x20,
+ 0x20, 0x20, 0x20, 0x20, 0x63, 0x6c, 0x65, 0x61,
+ 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 0x65,
+ 0x72, 0x6d, 0x69, 0x6e, 0x61, 0x6c, 0x0a, 0x16,
+ 0x5c, 0x61, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+ 0x20, 0x20, 0x20, 0x1e, 0x61, 0x6c, 0x67, 0x65,
+ 0x62, 0x72, 0x61, 0x69, 0x63, 0x20, 0x6d, 0x6f,
+ 0x64, 0x65, 0x0a, 0x16, 0x5c, 0x6e, 0x20, 0x20,
+ 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x1a,
+ 0x6e, 0x75, 0x6d, 0x65, 0x72, 0x69, 0x63, 0x20,
+ 0x6d, 0x6f, 0x64, 0x65, 0x0a, 0x66, 0x5c, 0x70,
+ 0x20, 0x5b, 0x6d, 0x20, 0x5b, 0x65, 0x5d, 0x5d,
+ 0x20, 0x20, 0x73, 0x65, 0x74, 0x20, 0x74, 0x68,
+ 0x65, 0x20, 0x42, 0x69, 0x67, 0x46, 0x6c, 0x6f,
+ 0x61, 0x74, 0x20, 0x70, 0x72, 0x65, 0x63, 0x69,
+ 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x74, 0x6f, 0x20,
+ 0x27, 0x6d, 0x27, 0x20, 0x62, 0x69, 0x74, 0x73,
+ 0x0a, 0x84, 0x01, 0x5c, 0x64, 0x69, 0x67, 0x69,
+ 0x74, 0x73, 0x20, 0x6e, 0x20, 0x20, 0x20, 0x73,
+ 0x65, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x42,
+ 0x69, 0x67, 0x46, 0x6c, 0x6f, 0x61, 0x74, 0x20,
+ 0x70, 0x72, 0x65, 0x63, 0x69, 0x73, 0x69, 0x6f,
+ 0x6e, 0x20, 0x74, 0x6f, 0x20, 0x27, 0x63, 0x65,
+ 0x69, 0x6c, 0x28, 0x6e, 0x2a, 0x6c, 0x6f, 0x67,
+ 0x32, 0x28, 0x31, 0x30, 0x29, 0x29, 0x27, 0x20,
+ 0x62, 0x69, 0x74, 0x73, 0x0a, 0x68, 0x5c, 0x6d,
+ 0x6f, 0x64, 0x65, 0x20, 0x5b, 0x73, 0x74, 0x64,
+ 0x7c, 0x6d, 0x61, 0x74, 0x68, 0x5d, 0x20, 0x63,
+ 0x68, 0x61, 0x6e, 0x67, 0x65, 0x20, 0x74, 0x68,
+ 0x65, 0x20, 0x72, 0x75, 0x6e, 0x6e, 0x69, 0x6e,
+ 0x67, 0x20, 0x6d, 0x6f, 0x64, 0x65, 0x20, 0x28,
+ 0x63, 0x75, 0x72, 0x72, 0x65, 0x6e, 0x74, 0x20,
+ 0x3d, 0x20, 0x04, 0x29, 0x0a, 0x22, 0x5c, 0x71,
+ 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+ 0x20, 0x20, 0x65, 0x78, 0x69, 0x74, 0x0a, 0x06,
+ 0x73, 0x65, 0x6c, 0x26, 0x22, 0x75, 0x73, 0x65,
+ 0x20, 0x6d, 0x61, 0x74, 0x68, 0x22, 0x3b, 0x20,
+ 0x76, 0x6f, 0x69, 0x64, 0x20, 0x30, 0x3b, 0x0e,
+ 0x67, 0x65, 0x74, 0x54, 0x69, 0x6d, 0x65, 0x14,
+ 0x65, 0x76, 0x61, 0x6c, 0x53, 0x63, 0x72, 0x69,
+ 0x70, 0x74, 0x22, 0x62, 0x61, 0x63, 0x6b, 0x74,
+ 0x72, 0x61, 0x63, 0x65, 0x5f, 0x62, 0x61, 0x72,
+ 0x72, 0x69, 0x65, 0x72, 0x0e, 0x63, 0x6f, 0x6e,
+ 0x73, 0x6f, 0x6c, 0x65, 0x06, 0x6c, 0x6f, 0x67,
+ 0x0e, 0x54, 0x68, 0x72, 0x6f, 0x77, 0x3a, 0x20,
+ 0x3a, 0x51, 0x4a, 0x53, 0x43, 0x61, 0x6c, 0x63,
+ 0x20, 0x2d, 0x20, 0x54, 0x79, 0x70, 0x65, 0x20,
+ 0x22, 0x5c, 0x68, 0x22, 0x20, 0x66, 0x6f, 0x72,
+ 0x20, 0x68, 0x65, 0x6c, 0x70, 0x0a, 0x3a, 0x51,
+ 0x75, 0x69, 0x63, 0x6b, 0x4a, 0x53, 0x20, 0x2d,
+ 0x20, 0x54, 0x79, 0x70, 0x65, 0x20, 0x22, 0x5c,
+ 0x68, 0x22, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x68,
+ 0x65, 0x6c, 0x70, 0x0a, 0x08, 0x20, 0x20, 0x20,
+ 0x20, 0x0e, 0x73, 0x65, 0x74, 0x50, 0x72, 0x65,
+ 0x63, 0x08, 0x62, 0x69, 0x6e, 0x64, 0x04, 0x67,
+ 0x63, 0x02, 0x7c, 0x6a, 0x62, 0x72, 0x65, 0x61,
+ 0x6b, 0x7c, 0x63, 0x61, 0x73, 0x65, 0x7c, 0x63,
+ 0x61, 0x74, 0x63, 0x68, 0x7c, 0x63, 0x6f, 0x6e,
+ 0x74, 0x69, 0x6e, 0x75, 0x65, 0x7c, 0x64, 0x65,
+ 0x62, 0x75, 0x67, 0x67, 0x65, 0x72, 0x7c, 0x64,
+ 0x65, 0x66, 0x61, 0x75, 0x6c, 0x74, 0x7c, 0x64,
+ 0x65, 0x6c, 0x65, 0x74, 0x65, 0x7c, 0x64, 0x6f,
+ 0x7c, 0x5e, 0x65, 0x6c, 0x73, 0x65, 0x7c, 0x66,
+ 0x69, 0x6e, 0x61, 0x6c, 0x6c, 0x79, 0x7c, 0x66,
+ 0x6f, 0x72, 0x7c, 0x66, 0x75, 0x6e, 0x63, 0x74,
+ 0x69, 0x6f, 0x6e, 0x7c, 0x69, 0x66, 0x7c, 0x69,
+ 0x6e, 0x7c, 0x69, 0x6e, 0x73, 0x74, 0x61, 0x6e,
+ 0x63, 0x65, 0x6f, 0x66, 0x7c, 0x6e, 0x65, 0x77,
+ 0x7c, 0x5e, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e,
+ 0x7c, 0x73, 0x77, 0x69, 0x74, 0x63, 0x68, 0x7c,
+ 0x74, 0x68, 0x69, 0x73, 0x7c, 0x74, 0x68, 0x72,
+ 0x6f, 0x77, 0x7c, 0x74, 0x72, 0x79, 0x7c, 0x74,
+ 0x79, 0x70, 0x65, 0x6f, 0x66, 0x7c, 0x77, 0x68,
+ 0x69, 0x6c, 0x65, 0x7c, 0x77, 0x69, 0x74, 0x68,
+ 0x7c, 0x5a, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x7c,
+ 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x7c, 0x65, 0x6e,
+ 0x75, 0x6d, 0x7c, 0x69, 0x6d, 0x70, 0x6f, 0x72,
+ 0x74, 0x7c, 0x65, 0x78, 0x70, 0x6f, 0x72, 0x74,
+ 0x7c, 0x65, 0x78, 0x74, 0x65, 0x6e, 0x64, 0x73,
+ 0x7c, 0x73, 0x75, 0x70, 0x65, 0x72, 0x7c, 0x66,
+ 0x69, 0x6d, 0x70, 0x6c, 0x65, 0x6d, 0x65, 0x6e,
+ 0x74, 0x73, 0x7c, 0x69, 0x6e, 0x74, 0x65, 0x72,
+ 0x66, 0x61, 0x63, 0x65, 0x7c, 0x6c, 0x65, 0x74,
+ 0x7c, 0x70, 0x61, 0x63, 0x6b, 0x61, 0x67, 0x65,
+ 0x7c, 0x70, 0x72, 0x69, 0x76, 0x61, 0x74, 0x65,
+ 0x7c, 0x70, 0x72, 0x6f, 0x74, 0x65, 0x63, 0x74,
+ 0x65, 0x64, 0x7c, 0x28, 0x70, 0x75, 0x62, 0x6c,
+ 0x69, 0x63, 0x7c, 0x73, 0x74, 0x61, 0x74, 0x69,
+ 0x63, 0x7c, 0x79, 0x69, 0x65, 0x6c, 0x64, 0x7c,
+ 0x4e, 0x75, 0x6e, 0x64, 0x65, 0x66, 0x69, 0x6e,
+ 0x65, 0x64, 0x7c, 0x6e, 0x75, 0x6c, 0x6c, 0x7c,
+ 0x74, 0x72, 0x75, 0x65, 0x7c, 0x66, 0x61, 0x6c,
+ 0x73, 0x65, 0x7c, 0x49, 0x6e, 0x66, 0x69, 0x6e,
+ 0x69, 0x74, 0x79, 0x7c, 0x4e, 0x61, 0x4e, 0x7c,
+ 0x1e, 0x65, 0x76, 0x61, 0x6c, 0x7c, 0x61, 0x72,
+ 0x67, 0x75, 0x6d, 0x65, 0x6e, 0x74, 0x73, 0x7c,
+ 0x0c, 0x61, 0x77, 0x61, 0x69, 0x74, 0x7c, 0x7a,
+ 0x7c, 0x74, 0x68, 0x69, 0x73, 0x7c, 0x73, 0x75,
+ 0x70, 0x65, 0x72, 0x7c, 0x75, 0x6e, 0x64, 0x65,
+ 0x66, 0x69, 0x6e, 0x65, 0x64, 0x7c, 0x6e, 0x75,
+ 0x6c, 0x6c, 0x7c, 0x74, 0x72, 0x75, 0x65, 0x7c,
+ 0x66, 0x61, 0x6c, 0x73, 0x65, 0x7c, 0x49, 0x6e,
+ 0x66, 0x69, 0x6e, 0x69, 0x74, 0x79, 0x7c, 0x4e,
+ 0x61, 0x4e, 0x7c, 0x61, 0x72, 0x67, 0x75, 0x6d,
+ 0x65, 0x6e, 0x74, 0x73, 0x7c, 0x14, 0x7c, 0x76,
+ 0x6f, 0x69, 0x64, 0x7c, 0x76, 0x61, 0x72, 0x7c,
+ 0x02, 0x2b, 0x02, 0x60, 0x02, 0x7b, 0x14, 0x70,
+ 0x75, 0x73, 0x68, 0x5f, 0x73, 0x74, 0x61, 0x74,
+ 0x65, 0x14, 0x6c, 0x61, 0x73, 0x74, 0x5f, 0x73,
+ 0x74, 0x61, 0x74, 0x65, 0x12, 0x70, 0x6f, 0x70,
+ 0x5f, 0x73, 0x74, 0x61, 0x74, 0x65, 0x26, 0x70,
+ 0x61, 0x72, 0x73, 0x65, 0x5f, 0x62, 0x6c, 0x6f,
+ 0x63, 0x6b, 0x5f, 0x63, 0x6f, 0x6d, 0x6d, 0x65,
+ 0x6e, 0x74, 0x0a, 0x73, 0x74, 0x79, 0x6c, 0x65,
+ 0x02, 0x69, 0x06, 0x73, 0x74, 0x72, 0x24, 0x70,
+ 0x61, 0x72, 0x73, 0x65, 0x5f, 0x6c, 0x69, 0x6e,
+ 0x65, 0x5f, 0x63, 0x6f, 0x6d, 0x6d, 0x65, 0x6e,
+ 0x74, 0x18, 0x70, 0x61, 0x72, 0x73, 0x65, 0x5f,
+ 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x16, 0x70,
+ 0x61, 0x72, 0x73, 0x65, 0x5f, 0x72, 0x65, 0x67,
+ 0x65, 0x78, 0x18, 0x70, 0x61, 0x72, 0x73, 0x65,
+ 0x5f, 0x6e, 0x75, 0x6d, 0x62, 0x65, 0x72, 0x20,
+ 0x70, 0x61, 0x72, 0x73, 0x65, 0x5f, 0x69, 0x64,
+ 0x65, 0x6e, 0x74, 0x69, 0x66, 0x69, 0x65, 0x72,
+ 0x12, 0x73, 0x65, 0x74, 0x5f, 0x73, 0x74, 0x79,
+ 0x6c, 0x65, 0x0f, 0xc4, 0x03, 0x02, 0xc6, 0x03,
+ 0xc8, 0x03, 0x00, 0x00, 0x02, 0x00, 0xf8, 0x01,
+ 0x00, 0x01, 0xf8, 0x01, 0x01, 0x0e, 0x00, 0x02,
+ 0x03, 0xa0, 0x01, 0x00, 0x00, 0x00, 0x02, 0x02,
+ 0x01, 0x09, 0x00, 0xc6, 0x03, 0x00, 0x0d, 0xc8,
+ 0x03, 0x01, 0x0d, 0xc4, 0x00, 0x38, 0x89, 0x00,
+ 0x00, 0x00, 0xf3, 0x29, 0x0e, 0x43, 0x02, 0x03,
+ 0x00, 0x01, 0x77, 0x01, 0x02, 0x02, 0x48, 0xf7,
+ 0x09, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x01, 0x0c,
+ 0xc4, 0x00, 0xc7, 0x2a, 0xc4, 0x01, 0xc7, 0x2b,
+ 0xc4, 0x02, 0xc7, 0x2c, 0xc4, 0x03, 0xc7, 0x2d,
+ 0xc4, 0x04, 0xc7, 0x2e, 0xc4, 0x05, 0xc7, 0x2f,
+ 0xc4, 0x06, 0xc7, 0x30, 0xc4, 0x07, 0xc7, 0x31,
+ 0xc4, 0x08, 0xc7, 0x32, 0xc4, 0x09, 0xc7, 0x33,
+ 0xc4, 0x0a, 0xc7, 0x34, 0xc4, 0x0b, 0xc7, 0x35,
+ 0xc4, 0x0c, 0xc7, 0x36, 0xc4, 0x0d, 0xc7, 0x37,
+ 0xc4, 0x0e, 0xc7, 0x38, 0xc4, 0x0f, 0xc7, 0x39,
+ 0xc4, 0x10, 0xc7, 0x3a, 0xc4, 0x11, 0xc7, 0x3b,
+ 0xc4, 0x12, 0xc7, 0x3c, 0xc4, 0x13, 0xc7, 0x3d,
+ 0xc4, 0x14, 0xc7, 0x3e, 0xc4, 0x15, 0xc7, 0x3f,
+ 0xc4, 0x16, 0xc7, 0x40, 0xc4, 0x17, 0xc7, 0x41,
+ 0xc4, 0x18, 0xc7, 0x42, 0xc4, 0x19, 0xc7, 0x43,
+ 0xc4, 0x1a, 0xc7, 0x44, 0xc4, 0x1b, 0xc7, 0x45,
+ 0xc4, 0x1c, 0xc7, 0x46, 0xc4, 0x1d, 0xc7, 0x47,
+ 0xc4, 0x1e, 0xc7, 0x48, 0xc4, 0x1f, 0xc7, 0x49,
+ 0xc4, 0x20, 0xc7, 0x4a, 0xc4, 0x21, 0xc7, 0x4b,
+ 0xc4, 0x22, 0xc7, 0x4c, 0xc4, 0x23, 0xc7, 0x4d,
+ 0xc4, 0x24, 0xc7, 0x4e, 0xc4, 0x25, 0xc7, 0x4f,
+ 0xc4, 0x26, 0xc7, 0x50, 0xc4, 0x27, 0xc7, 0x51,
+ 0xc4, 0x28, 0xc7, 0x52, 0xc4, 0x29, 0xc7, 0x53,
+ 0xc4, 0x2a, 0xc7, 0x54, 0xc4, 0x2b, 0xc7, 0x55,
+ 0xc4, 0x2c, 0xc7, 0x56, 0xc4, 0x2d, 0xc7, 0x57,
+ 0xc4, 0x2e, 0xc7, 0x58, 0xc4, 0x2f, 0xc7, 0x59,
+ 0xc4, 0x30, 0xc7, 0x5a, 0xc4, 0x31, 0xc7, 0x5b,
+ 0xc4, 0x32, 0xc7, 0x5c, 0xc4, 0x33, 0xc7, 0x5d,
+ 0xc4, 0x34, 0xc7, 0x5e, 0xc4, 0x35, 0xc7, 0x60,
+ 0xc4, 0x36, 0xc7, 0x64, 0xc4, 0x37, 0xc7, 0x65,
+ 0xc4, 0x38, 0xc7, 0x66, 0xc4, 0x39, 0xc7, 0x67,
+ 0xc4, 0x3a, 0xc7, 0x6a, 0xc4, 0x3b, 0xc7, 0x6b,
+ 0xc4, 0x3c, 0xc7, 0x6c, 0xc4, 0x3d, 0xc7, 0x6d,
+ 0xc4, 0x3e, 0xc7, 0x6e, 0xc4, 0x3f, 0xc7, 0x6f,
+ 0xc4, 0x41, 0xc7, 0x70, 0xc4, 0x42, 0xc7, 0x71,
+ 0xc4, 0x43, 0xc7, 0x72, 0xc4, 0x44, 0xc7, 0x73,
+ 0xc4, 0x45, 0xc7, 0x74, 0xc4, 0x46, 0xc7, 0x75,
+ 0xc4, 0x47, 0xc7, 0x76, 0xd5, 0x65, 0x01, 0x00,
+ 0x43, 0xe4, 0x00, 0x00, 0x00, 0xd5, 0x65, 0x00,
+ 0x00, 0x43, 0xe3, 0x00, 0x00, 0x00, 0xd5, 0x41,
+ 0x94, 0x00, 0x00, 0x00, 0xcd, 0xd5, 0x41, 0x98,
+ 0x00, 0x00, 0x00, 0xce, 0xd5, 0x41, 0x95, 0x00,
+ 0x00, 0x00, 0xcf, 0xd5, 0x41, 0x9e, 0x00, 0x00,
+ 0x00, 0xd0, 0xd5, 0x41, 0x9c, 0x00, 0x00, 0x00,
+ 0xc7, 0x04, 0xd5, 0x41, 0xe5, 0x00, 0x00, 0x00,
+ 0xc7, 0x05, 0xd5, 0x41, 0xe6, 0x00, 0x00, 0x00,
+ 0xc7, 0x06, 0x65, 0x01, 0x00, 0x41, 0xe7, 0x00,
+ 0x00, 0x00, 0xf6, 0xc7, 0x07, 0x37, 0xe8, 0x00,
+ 0x00, 0x00, 0xf8, 0xc7, 0x08, 0x37, 0xb2, 0x00,
+ 0x00, 0x00, 0xf8, 0xc7, 0x09, 0x0b, 0x04, 0xe9,
+ 0x00, 0x00, 0x00, 0x4c, 0xea, 0x00, 0x00, 0x00,
+ 0x04, 0xeb, 0x00, 0x00, 0x00, 0x4c, 0xec, 0x00,
+ 0x00, 0x00, 0x04, 0xed, 0x00, 0x00, 0x00, 0x4c,
+ 0xee, 0x00, 0x00, 0x00, 0x04, 0xef, 0x00, 0x00,
+ 0x00, 0x4c, 0xf0, 0x00, 0x00, 0x00, 0x04, 0xf1,
+ 0x00, 0x00, 0x00, 0x4c, 0xf2, 0x00, 0x00, 0x00,
+ 0x04, 0xf3, 0x00, 0x00, 0x00, 0x4c, 0xf4, 0x00,
+ 0x00, 0x00, 0x04, 0xf5, 0x00, 0x00, 0x00, 0x4c,
+ 0xf6, 0x00, 0x00, 0x00, 0x04, 0xf7, 0x00, 0x00,
+ 0x00, 0x4c, 0xf8, 0x00, 0x00, 0x00, 0x04, 0xf9,
+ 0x00, 0x00, 0x00, 0x4c, 0xfa, 0x00, 0x00, 0x00,
+ 0x04, 0xfb, 0x00, 0x00, 0x00, 0x4c, 0xfc, 0x00,
+ 0x00, 0x00, 0x04, 0xfb, 0x00, 0x00, 0x00, 0x4c,
+ 0xfd, 0x00, 0x00, 0x00, 0x04, 0xfe, 0x00, 0x00,
+ 0x00, 0x4c, 0xff, 0x00, 0x00, 0x00, 0x04, 0x00,
+ 0x01, 0x00, 0x00, 0x4c, 0x01, 0x01, 0x00, 0x00,
+ 0x04, 0x02, 0x01, 0x00, 0x00, 0x4c, 0x03, 0x01,
+ 0x00, 0x00, 0x04, 0x04, 0x01, 0x00, 0x00, 0x4c,
+ 0x05, 0x01, 0x00, 0x00, 0x04, 0x06, 0x01, 0x00,
+ 0x00, 0x4c, 0x07, 0x01, 0x00, 0x00, 0x04, 0x08,
+ 0x01, 0x00, 0x00, 0x4c, 0x09, 0x01, 0x00, 0x00,
+ 0x04, 0x0a, 0x01, 0x00, 0x00, 0x4c, 0x0b, 0x01,
+ 0x00, 0x00, 0xc7, 0x0a, 0xc6, 0x07, 0xee, 0x7e,
+ 0x0b, 0x04, 0xec, 0x00, 0x00, 0x00, 0x4c, 0x16,
+ 0x00, 0x00, 0x00, 0x04, 0xfa, 0x00, 0x00, 0x00,
+ 0x4c, 0x0c, 0x01, 0x00, 0x00, 0x04, 0xf0, 0x00,
+ 0x00, 0x00, 0x4c, 0x48, 0x00, 0x00, 0x00, 0x04,
+ 0xf8, 0x00, 0x00, 0x00, 0x4c, 0x0d, 0x01, 0x00,
+ 0x00, 0x04, 0xf0, 0x00, 0x00, 0x00, 0x4c, 0x46,
+ 0x00, 0x00, 0x00, 0x04, 0xf4, 0x00, 0x00, 0x00,
+ 0x4c, 0x0e, 0x01, 0x00, 0x00, 0x04, 0xfc, 0x00,
+ 0x00, 0x00, 0x4c, 0x1b, 0x00, 0x00, 0x00, 0x04,
+ 0x07, 0x01, 0x00, 0x00, 0x4c, 0x0f, 0x01, 0x00,
+ 0x00, 0x04, 0xf2, 0x00, 0x00, 0x00, 0x4c, 0x10,
+ 0x01, 0x00, 0x00, 0x04, 0xff, 0x00, 0x00, 0x00,
+ 0x4c, 0x11, 0x01, 0x00, 0x00, 0x04, 0xec, 0x00,
+ 0x00, 0x00, 0x4c, 0x12, 0x01, 0x00, 0x00, 0x04,
+ 0xff, 0x00, 0x00, 0x00, 0x4c, 0x13, 0x01, 0x00,
+ 0x00, 0xc7, 0x0b, 0xf0, 0x7c, 0x0b, 0x04, 0x01,
+ 0x01, 0x00, 0x00, 0x4c, 0x16, 0x00, 0x00, 0x00,
+ 0x04, 0xfa, 0x00, 0x00, 0x00, 0x4c, 0x0c, 0x01,
+ 0x00, 0x00, 0x04, 0x09, 0x01, 0x00, 0x00, 0x4c,
+ 0x48, 0x00, 0x00, 0x00, 0x04, 0xf8, 0x00, 0x00,
+ 0x00, 0x4c, 0x0d, 0x01, 0x00, 0x00, 0x04, 0xf0,
+ 0x00, 0x00, 0x00, 0x4c, 0x46, 0x00, 0x00, 0x00,
+ 0x04, 0x0b, 0x01, 0x00, 0x00, 0x4c, 0x0e, 0x01,
+ 0x00, 0x00, 0x04, 0x03, 0x01, 0x00, 0x00, 0x4c,
+ 0x1b, 0x00, 0x00, 0x00, 0x04, 0x07, 0x01, 0x00,
+ 0x00, 0x4c, 0x0f, 0x01, 0x00, 0x00, 0x04, 0x01,
+ 0x01, 0x00, 0x00, 0x4c, 0x10, 0x01, 0x00, 0x00,
+ 0x04, 0xee, 0x00, 0x00, 0x00, 0x4c, 0x11, 0x01,
+ 0x00, 0x00, 0x04, 0x0b, 0x01, 0x00, 0x00, 0x4c,
+ 0x12, 0x01, 0x00, 0x00, 0x04, 0xff, 0x00, 0x00,
+ 0x00, 0x4c, 0x13, 0x01, 0x00, 0x00, 0xc7, 0x0b,
+ 0x26, 0x00, 0x00, 0xc7, 0x0c, 0xc5, 0xc7, 0x0d,
+ 0xc5, 0xc7, 0x11, 0xc5, 0xc7, 0x12, 0xb9, 0xc7,
+ 0x13, 0xc6, 0x07, 0xee, 0x0a, 0x04, 0x14, 0x01,
+ 0x00, 0x00, 0xc7, 0x14, 0xf0, 0x08, 0x04, 0x15,
+ 0x01, 0x00, 0x00, 0xc7, 0x14, 0x04, 0x16, 0x01,
+ 0x00, 0x00, 0xc7, 0x15, 0x0a, 0xc7, 0x16, 0x09,
+ 0xc7, 0x17, 0x0a, 0xc7, 0x18, 0xb9, 0xc7, 0x19,
+ 0xc5, 0xc7, 0x1a, 0xb9, 0xc7, 0x1b, 0xc5, 0xc7,
+ 0x1c, 0xb9, 0xc7, 0x1d, 0xc5, 0xc7, 0x1e, 0xb9,
+ 0xc7, 0x1f, 0x09, 0xc7, 0x23, 0xb9, 0xc7, 0x24,
+ 0xb9, 0xc7, 0x25, 0xb9, 0xc7, 0x29, 0x0b, 0xc6,
+ 0x3c, 0x4c, 0x17, 0x01, 0x00, 0x00, 0xc6, 0x3f,
+ 0x4c, 0x18, 0x01, 0x00, 0x00, 0xc6, 0x59, 0x4c,
+ 0x19, 0x01, 0x00, 0x00, 0xc6, 0x4d, 0x4c, 0x1a,
+ 0x01, 0x00, 0x00, 0xc6, 0x3d, 0x4c, 0x1b, 0x01,
+ 0x00, 0x00, 0xc6, 0x3e, 0x4c, 0x1c, 0x01, 0x00,
+ 0x00, 0xc6, 0x3a, 0x4c, 0x1d, 0x01, 0x00, 0x00,
+ 0xc6, 0x4e, 0x4c, 0x1e, 0x01, 0x00, 0x00, 0xc6,
+ 0x5e, 0x4c, 0x1f, 0x01, 0x00, 0x00, 0xc6, 0x44,
+ 0x4c, 0x20, 0x01, 0x00, 0x00, 0xc6, 0x54, 0x4c,
+ 0x21, 0x01, 0x00, 0x00, 0xc6, 0x44, 0x4c, 0x22,
+ 0x01, 0x00, 0x00, 0xc6, 0x47, 0x4c, 0x23, 0x01,
+ 0x00, 0x00, 0xc6, 0x46, 0x4c, 0x24, 0x01, 0x00,
+ 0x00, 0xc6, 0x39, 0x4c, 0x25, 0x01, 0x00, 0x00,
+ 0xc6, 0x3b, 0x4c, 0x26, 0x01, 0x00, 0x00, 0xc6,
+ 0x3b, 0x4c, 0x27, 0x01, 0x00, 0x00, 0xc6, 0x4f,
+ 0x4c, 0x28, 0x01, 0x00, 0x00, 0xc6, 0x5a, 0x4c,
+ 0x29, 0x01, 0x00, 0x00, 0xc6, 0x58, 0x4c, 0x2a,
+ 0x01, 0x00, 0x00, 0xc6, 0x46, 0x4c, 0x2b, 0x01,
+ 0x00, 0x00, 0xc6, 0x47, 0x4c, 0x2c, 0x01, 0x00,
+ 0x00, 0xc6, 0x3e, 0x4c, 0x2d, 0x01, 0x00, 0x00,
+ 0xc6, 0x3f, 0x4c, 0x2e, 0x01, 0x00, 0x00, 0xc6,
+ 0x42, 0x4c, 0x2f, 0x01, 0x00, 0x00, 0xc6, 0x43,
+ 0x4c, 0x30, 0x01, 0x00, 0x00, 0xc6, 0x42, 0x4c,
+ 0x31, 0x01, 0x00, 0x00, 0xc6, 0x43, 0x4c, 0x32,
+ 0x01, 0x00, 0x00, 0xc6, 0x3c, 0x4c, 0x33, 0x01,
+ 0x00, 0x00, 0xc6, 0x4c, 0x4c, 0x34, 0x01, 0x00,
+ 0x00, 0xc6, 0x3d, 0x4c, 0x35, 0x01, 0x00, 0x00,
+ 0xc6, 0x49, 0x4c, 0x36, 0x01, 0x00, 0x00, 0xc6,
+ 0x4a, 0x4c, 0x37, 0x01, 0x00, 0x00, 0xc6, 0x46,
+ 0x4c, 0x38, 0x01, 0x00, 0x00, 0xc6, 0x47, 0x4c,
+ 0x39, 0x01, 0x00, 0x00, 0xc6, 0x3e, 0x4c, 0x3a,
+ 0x01, 0x00, 0x00, 0xc6, 0x3f, 0x4c, 0x3b, 0x01,
+ 0x00, 0x00, 0xc6, 0x3d, 0x4c, 0x3c, 0x01, 0x00,
+ 0x00, 0xc6, 0x3c, 0x4c, 0x3d, 0x01, 0x00, 0x00,
+ 0xc6, 0x57, 0x4c, 0x3e, 0x01, 0x00, 0x00, 0xc6,
+ 0x43, 0x4c, 0x3f, 0x01, 0x00, 0x00, 0xc6, 0x56,
+ 0x4c, 0x40, 0x01, 0x00, 0x00, 0xc6, 0x42, 0x4c,
+ 0x41, 0x01, 0x00, 0x00, 0xc6, 0x55, 0x4c, 0x42,
+ 0x01, 0x00, 0x00, 0xc6, 0x52, 0x4c, 0x43, 0x01,
+ 0x00, 0x00, 0xc6, 0x50, 0x4c, 0x44, 0x01, 0x00,
+ 0x00, 0xc6, 0x51, 0x4c, 0x45, 0x01, 0x00, 0x00,
+ 0xc6, 0x4e, 0x4c, 0x46, 0x01, 0x00, 0x00, 0xc7,
+ 0x5f, 0x09, 0xc7, 0x68, 0x04, 0xe3, 0x00, 0x00,
+ 0x00, 0xc7, 0x69, 0xc6, 0x07, 0xee, 0x09, 0xd5,
+ 0xc4, 0x40, 0x43, 0x47, 0x01, 0x00, 0x00, 0xc6,
+ 0x2a, 0xf2, 0x0e, 0xc6, 0x72, 0xf2, 0x29, 0x0e,
+ 0x43, 0x02, 0x03, 0x90, 0x05, 0x00, 0x01, 0x00,
+ 0x04, 0x07, 0x00, 0x8b, 0x01, 0x00, 0x00, 0x26,
+ 0x01, 0x00, 0x00, 0x0c, 0x00, 0x28, 0x01, 0x00,
+ 0x01, 0x0c, 0x00, 0x2b, 0x01, 0x00, 0x27, 0x01,
+ 0x00, 0x2c, 0x01, 0x65, 0x01, 0x00, 0x41, 0x0d,
+ 0x00, 0x00, 0x00, 0x42, 0x49, 0x01, 0x00, 0x00,
+ 0x24, 0x00, 0x00, 0xe5, 0xc1, 0x50, 0xe7, 0x65,
+ 0x03, 0x00, 0x42, 0x4a, 0x01, 0x00, 0x00, 0xe1,
+ 0x24, 0x01, 0x00, 0xee, 0x35, 0x65, 0x03, 0x00,
+ 0x41, 0x4b, 0x01, 0x00, 0x00, 0xee, 0x14, 0x65,
+ 0x03, 0x00, 0x42, 0x4b, 0x01, 0x00, 0x00, 0xe1,
+ 0x24, 0x01, 0x00, 0xd1, 0xee, 0x05, 0xc9, 0xb9,
+ 0x47, 0xe7, 0x65, 0x03, 0x00, 0x41, 0x4c, 0x01,
+ 0x00, 0x00, 0xee, 0x0e, 0x65, 0x03, 0x00, 0x42,
+ 0x4c, 0x01, 0x00, 0x00, 0xe1, 0x24, 0x01, 0x00,
+ 0x0e, 0x65, 0x03, 0x00, 0x42, 0x4d, 0x01, 0x00,
+ 0x00, 0x65, 0x03, 0x00, 0x41, 0x4e, 0x01, 0x00,
+ 0x00, 0x5e, 0x04, 0x00, 0x24, 0x02, 0x00, 0x0e,
+ 0x38, 0xa7, 0x00, 0x00, 0x00, 0x11, 0xc1, 0x40,
+ 0x21, 0x01, 0x00, 0x5f, 0x05, 0x00, 0x65, 0x03,
+ 0x00, 0x42, 0x4f, 0x01, 0x00, 0x00, 0xe1, 0x5e,
+ 0x06, 0x00, 0x24, 0x02, 0x00, 0x29, 0x0e, 0x43,
+ 0x02, 0x03, 0xa0, 0x05, 0x00, 0x00, 0x00, 0x02,
+ 0x01, 0x00, 0x04, 0x00, 0xa2, 0x05, 0x2d, 0x01,
+ 0xe1, 0xbc, 0xf3, 0x29, 0x0e, 0x43, 0x02, 0x03,
+ 0xa4, 0x05, 0x00, 0x02, 0x00, 0x06, 0x04, 0x00,
+ 0x28, 0x00, 0x00, 0x01, 0x0c, 0x00, 0x26, 0x01,
+ 0x00, 0x27, 0x01, 0x00, 0x2d, 0x01, 0x65, 0x00,
+ 0x00, 0x42, 0x53, 0x01, 0x00, 0x00, 0xe2, 0xe3,
+ 0x41, 0x54, 0x01, 0x00, 0x00, 0xb9, 0xe3, 0xed,
+ 0x24, 0x04, 0x00, 0xcd, 0xb9, 0xce, 0xca, 0xc9,
+ 0xa7, 0xee, 0x0b, 0xe4, 0xe3, 0xca, 0x47, 0xf3,
+ 0x0e, 0x97, 0x01, 0xf0, 0xf2, 0x29, 0x0e, 0x43,
+ 0x02, 0x03, 0xa2, 0x05, 0x01, 0x00, 0x01, 0x04,
+ 0x04, 0x00, 0x5f, 0x00, 0x00, 0x16, 0x01, 0x00,
+ 0x66, 0x01, 0x00, 0x24, 0x01, 0x00, 0x25, 0x01,
+ 0xe1, 0x9a, 0xee, 0x06, 0xe2, 0xd5, 0xf3, 0x0e,
+ 0x29, 0xe3, 0xb9, 0xb0, 0xee, 0x24, 0xd5, 0xc2,
+ 0x80, 0x00, 0xaa, 0xee, 0x1d, 0xd5, 0xc2, 0xc0,
+ 0x00, 0xa7, 0xee, 0x16, 0xe4, 0xbf, 0xa4, 0xd5,
+ 0xc1, 0x3f, 0xb1, 0xb3, 0xe8, 0xe3, 0x92, 0xeb,
+ 0xb9, 0xaf, 0xee, 0x33, 0xe2, 0xe4, 0xf3, 0x0e,
+ 0x29, 0xd5, 0xc2, 0xc0, 0x00, 0xaa, 0xee, 0x21,
+ 0xd5, 0xc2, 0xf8, 0x00, 0xa7, 0xee, 0x1a, 0xba,
+ 0xd5, 0xc2, 0xe0, 0x00, 0xaa, 0xa1, 0xd5, 0xc2,
+ 0xf0, 0x00, 0xaa, 0xa1, 0xe7, 0xd5, 0xba, 0xbf,
+ 0xe3, 0xa2, 0xa4, 0xba, 0xa2, 0xb1, 0xe8, 0x29,
+ 0xb9, 0xe7, 0xe2, 0xd5, 0xf3, 0x0e, 0x29, 0x0e,
+ 0x43, 0x02, 0x03, 0xaa, 0x05, 0x01, 0x00, 0x01,
+ 0x02, 0x00, 0x00, 0x35, 0x00, 0xd5, 0x9b, 0x04,
+ 0x48, 0x00, 0x00, 0x00, 0xaf, 0x11, 0xee, 0x2a,
+ 0x0e, 0xd5, 0x04, 0x56, 0x01, 0x00, 0x00, 0xaa,
+ 0x11, 0xee, 0x09, 0x0e, 0xd5, 0x04, 0x57, 0x01,
+ 0x00, 0x00, 0xa8, 0x11, 0xef, 0x14, 0x0e, 0xd5,
+ 0x04, 0x58, 0x01, 0x00, 0x00, 0xaa, 0x11, 0xee,
+ 0x09, 0x0e, 0xd5, 0x04, 0x59, 0x01, 0x00, 0x00,
+ 0xa8, 0x28, 0x0e, 0x43, 0x02, 0x03, 0xb4, 0x05,
+ 0x01, 0x00, 0x01, 0x02, 0x00, 0x02, 0x19, 0x00,
+ 0xd5, 0x9b, 0x04, 0x48, 0x00, 0x00, 0x00, 0xaf,
+ 0x11, 0xee, 0x0e, 0x0e, 0xd5, 0xc3, 0x00, 0xaa,
+ 0x11, 0xee, 0x06, 0x0e, 0xd5, 0xc3, 0x01, 0xa8,
+ 0x28, 0x07, 0x02, 0x30, 0x07, 0x02, 0x39, 0x0e,
+ 0x43, 0x02, 0x03, 0xb6, 0x05, 0x01, 0x00, 0x01,
+ 0x02, 0x02, 0x00, 0x2d, 0x00, 0x00, 0x2e, 0x01,
+ 0x00, 0x2f, 0x01, 0xd5, 0x9b, 0x04, 0x48, 0x00,
+ 0x00, 0x00, 0xaf, 0x11, 0xee, 0x22, 0x0e, 0xe1,
+ 0xd5, 0xf3, 0x11, 0xef, 0x1b, 0x0e, 0xe2, 0xd5,
+ 0xf3, 0x11, 0xef, 0x14, 0x0e, 0xd5, 0x04, 0x5c,
+ 0x01, 0x00, 0x00, 0xad, 0x11, 0xef, 0x09, 0x0e,
+ 0xd5, 0x04, 0x5d, 0x01, 0x00, 0x00, 0xad, 0x28,
+ 0x0e, 0x43, 0x02, 0x03, 0xbc, 0x05, 0x01, 0x04,
+ 0x01, 0x03, 0x00, 0x00, 0x32, 0x00, 0xd5, 0xed,
+ 0xd0, 0xb9, 0xcd, 0xb9, 0xcf, 0xcb, 0xcc, 0xa7,
+ 0xee, 0x25, 0xd5, 0x42, 0x5f, 0x01, 0x00, 0x00,
+ 0xcb, 0x24, 0x01, 0x00, 0xd2, 0x01, 0x00, 0xdc,
+ 0x00, 0x00, 0xa7, 0x11, 0xef, 0x09, 0x0e, 0xca,
+ 0x01, 0x00, 0xe0, 0x00, 0x00, 0xaa, 0xee, 0x03,
+ 0x97, 0x00, 0x97, 0x02, 0xf0, 0xd8, 0xc9, 0x28,
+ 0x0e, 0x43, 0x02, 0x03, 0xc0, 0x05, 0x01, 0x01,
+ 0x01, 0x03, 0x00, 0x00, 0x29, 0x00, 0xd5, 0x9b,
+ 0x04, 0x48, 0x00, 0x00, 0x00, 0xb0, 0xee, 0x03,
+ 0x09, 0x28, 0xd5, 0x42, 0x61, 0x01, 0x00, 0x00,
+ 0xb9, 0x24, 0x01, 0x00, 0xd1, 0x01, 0x00, 0xdc,
+ 0x00, 0x00, 0xaa, 0x11, 0xee, 0x09, 0x0e, 0xc9,
+ 0x01, 0x00, 0xe0, 0x00, 0x00, 0xa7, 0x28, 0x0e,
+ 0x43, 0x02, 0x03, 0xc4, 0x05, 0x02, 0x00, 0x02,
+ 0x03, 0x00, 0x00, 0x23, 0x00, 0xd5, 0xd6, 0xa1,
+ 0x11, 0x04, 0x63, 0x01, 0x00, 0x00, 0xaf, 0xef,
+ 0x13, 0x11, 0x04, 0x64, 0x01, 0x00, 0x00, 0xaf,
+ 0xef, 0x0a, 0x11, 0x04, 0x65, 0x01, 0x00, 0x00,
+ 0xaf, 0xee, 0x03, 0x0a, 0x28, 0x0e, 0x09, 0x28,
+ 0x0e, 0x43, 0x02, 0x03, 0xcc, 0x05, 0x03, 0x03,
+ 0x03, 0x06, 0x03, 0x00, 0x63, 0x00, 0x00, 0x00,
+ 0x0c, 0x00, 0x0a, 0x01, 0x00, 0x0b, 0x01, 0xd6,
+ 0xce, 0xca, 0xd5, 0xed, 0xa7, 0xee, 0x5b, 0xd7,
+ 0xca, 0xd1, 0x47, 0xcf, 0xca, 0x93, 0xd2, 0xd5,
+ 0xed, 0xa7, 0xee, 0x08, 0xd7, 0xca, 0x47, 0xcb,
+ 0xad, 0xef, 0xf2, 0x65, 0x00, 0x00, 0x42, 0x67,
+ 0x01, 0x00, 0x00, 0xe2, 0xe3, 0xcb, 0x47, 0x11,
+ 0xef, 0x07, 0x0e, 0x04, 0x16, 0x00, 0x00, 0x00,
+ 0x47, 0x24, 0x01, 0x00, 0x0e, 0x65, 0x00, 0x00,
+ 0x42, 0x67, 0x01, 0x00, 0x00, 0xd5, 0x42, 0x68,
+ 0x01, 0x00, 0x00, 0xc9, 0xca, 0x24, 0x02, 0x00,
+ 0x24, 0x01, 0x00, 0x0e, 0x65, 0x00, 0x00, 0x42,
+ 0x67, 0x01, 0x00, 0x00, 0xe2, 0x04, 0xea, 0x00,
+ 0x00, 0x00, 0x47, 0x24, 0x01, 0x00, 0x0e, 0xf0,
+ 0xa1, 0x29, 0x0e, 0x43, 0x02, 0x03, 0xd2, 0x05,
+ 0x02, 0x00, 0x02, 0x05, 0x01, 0x00, 0x1d, 0x00,
+ 0x00, 0x00, 0x0c, 0x65, 0x00, 0x00, 0x42, 0x67,
+ 0x01, 0x00, 0x00, 0x04, 0x6a, 0x01, 0x00, 0x00,
+ 0xd5, 0xba, 0xae, 0xee, 0x04, 0xd5, 0xf0, 0x02,
+ 0xc5, 0xa1, 0xd6, 0xa1, 0x24, 0x01, 0x00, 0x29,
+ 0x0e, 0x43, 0x02, 0x03, 0xd6, 0x05, 0x01, 0x02,
+ 0x01, 0x04, 0x05, 0x00, 0xa1, 0x01, 0x00, 0x00,
+ 0x29, 0x01, 0x00, 0x28, 0x01, 0x00, 0x00, 0x0c,
+ 0x00, 0x04, 0x01, 0x00, 0x35, 0x01, 0xd5, 0xb9,
+ 0xa9, 0xee, 0x4d, 0xd5, 0xb9, 0xae, 0x6c, 0x97,
+ 0x00, 0x00, 0x00, 0xe1, 0xe2, 0xba, 0xa2, 0xad,
+ 0xee, 0x19, 0x65, 0x02, 0x00, 0x42, 0x67, 0x01,
+ 0x00, 0x00, 0x04, 0x20, 0x01, 0x00, 0x00, 0x24,
+ 0x01, 0x00, 0x0e, 0xb9, 0xe5, 0xd5, 0x92, 0xd9,
+ 0xf0, 0xda, 0xe4, 0x42, 0x6c, 0x01, 0x00, 0x00,
+ 0xe2, 0xba, 0xa2, 0xe1, 0xa2, 0xd5, 0x24, 0x02,
+ 0x00, 0xce, 0x5e, 0x04, 0x00, 0xca, 0x04, 0x6d,
+ 0x01, 0x00, 0x00, 0xf4, 0x0e, 0xd5, 0xca, 0xa2,
+ 0xd9, 0xe1, 0xca, 0xa1, 0xe5, 0xf0, 0xb5, 0xd5,
+ 0x90, 0xd9, 0xd5, 0xb9, 0xae, 0xee, 0x48, 0xe1,
+ 0xb9, 0xad, 0xee, 0x22, 0x5e, 0x04, 0x00, 0xba,
+ 0x04, 0x56, 0x01, 0x00, 0x00, 0xf4, 0x0e, 0x5e,
+ 0x04, 0x00, 0xe2, 0xba, 0xa2, 0x04, 0x6d, 0x01,
+ 0x00, 0x00, 0xf4, 0x0e, 0xd5, 0x92, 0xd9, 0xe2,
+ 0xba, 0xa2, 0xe5, 0xf0, 0xd6, 0xe4, 0x42, 0x6c,
+ 0x01, 0x00, 0x00, 0xd5, 0xe1, 0x24, 0x02, 0x00,
+ 0xce, 0x5e, 0x04, 0x00, 0xca, 0x04, 0x6e, 0x01,
+ 0x00, 0x00, 0xf4, 0x0e, 0xd5, 0xca, 0xa2, 0xd9,
+ 0xe1, 0xca, 0xa2, 0xe5, 0xf0, 0xb5, 0x29, 0x0e,
+ 0x43, 0x02, 0x03, 0xde, 0x05, 0x00, 0x05, 0x00,
+ 0x06, 0x0d, 0x00, 0x9c, 0x02, 0x00, 0x00, 0x1c,
+ 0x01, 0x00, 0x1e, 0x01, 0x00, 0x18, 0x01, 0x00,
+ 0x1f, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x36, 0x01,
+ 0x00, 0x31, 0x01, 0x00, 0x1a, 0x01, 0x00, 0x76,
+ 0x01, 0x00, 0x34, 0x01, 0x00, 0x29, 0x01, 0x00,
+ 0x28, 0x01, 0x00, 0x1d, 0x01, 0xe1, 0xe2, 0xae,
+ 0x6c, 0xc6, 0x00, 0x00, 0x00, 0xe3, 0x9a, 0xee,
+ 0x32, 0xe2, 0x42, 0x68, 0x01, 0x00, 0x00, 0xb9,
+ 0xe4, 0x24, 0x02, 0x00, 0xe1, 0x42, 0x68, 0x01,
+ 0x00, 0x00, 0xb9, 0xe4, 0x24, 0x02, 0x00, 0xad,
+ 0xee, 0x19, 0x65, 0x04, 0x00, 0x42, 0x67, 0x01,
+ 0x00, 0x00, 0xe1, 0x42, 0x68, 0x01, 0x00, 0x00,
+ 0xe4, 0x24, 0x01, 0x00, 0x24, 0x01, 0x00, 0x0e,
+ 0xf0, 0x53, 0x5e, 0x05, 0x00, 0x5e, 0x06, 0x00,
+ 0xe2, 0x42, 0x68, 0x01, 0x00, 0x00, 0xb9, 0xe4,
+ 0x24, 0x02, 0x00, 0xf3, 0x90, 0xf3, 0x0e, 0xe3,
+ 0xee, 0x2e, 0x5e, 0x07, 0x00, 0xee, 0x0e, 0x5e,
+ 0x07, 0x00, 0x04, 0x20, 0x01, 0x00, 0x00, 0xa1,
+ 0xe1, 0xa1, 0xf0, 0x02, 0xe1, 0xd3, 0xed, 0xe1,
+ 0xed, 0xa2, 0xd0, 0x5e, 0x08, 0x00, 0xcb, 0xf3,
+ 0xc7, 0x04, 0x5e, 0x09, 0x00, 0xcb, 0xcc, 0xc6,
+ 0x04, 0xbb, 0x47, 0xf5, 0x0e, 0xf0, 0x0e, 0x65,
+ 0x04, 0x00, 0x42, 0x67, 0x01, 0x00, 0x00, 0xe1,
+ 0x24, 0x01, 0x00, 0x0e, 0x5e, 0x0a, 0x00, 0x5e,
+ 0x06, 0x00, 0xe1, 0xf3, 0xa1, 0x5e, 0x0b, 0x00,
+ 0xa0, 0x60, 0x0a, 0x00, 0xb9, 0xad, 0xee, 0x12,
+ 0x65, 0x04, 0x00, 0x42, 0x67, 0x01, 0x00, 0x00,
+ 0x04, 0x70, 0x01, 0x00, 0x00, 0x24, 0x01, 0x00,
+ 0x0e, 0x65, 0x04, 0x00, 0x42, 0x67, 0x01, 0x00,
+ 0x00, 0x04, 0x71, 0x01, 0x00, 0x00, 0x24, 0x01,
+ 0x00, 0x0e, 0xe1, 0xe6, 0xe1, 0xed, 0xe8, 0x5e,
+ 0x0c, 0x00, 0xe4, 0xa9, 0xee, 0x19, 0x5e, 0x05,
+ 0x00, 0x5e, 0x06, 0x00, 0xe1, 0x42, 0x68, 0x01,
+ 0x00, 0x00, 0xe4, 0x5e, 0x0c, 0x00, 0x24, 0x02,
+ 0x00, 0xf3, 0xf3, 0x0e, 0xf0, 0x1f, 0x5e, 0x0c,
+ 0x00, 0xe4, 0xa7, 0xee, 0x18, 0x5e, 0x05, 0x00,
+ 0x5e, 0x06, 0x00, 0xe1, 0x42, 0x68, 0x01, 0x00,
+ 0x00, 0x5e, 0x0c, 0x00, 0xe4, 0x24, 0x02, 0x00,
+ 0xf3, 0x90, 0xf3, 0x0e, 0x5e, 0x0c, 0x00, 0xe8,
+ 0x65, 0x04, 0x00, 0x41, 0x72, 0x01, 0x00, 0x00,
+ 0x42, 0x73, 0x01, 0x00, 0x00, 0x24, 0x00, 0x00,
+ 0x29, 0x0e, 0x43, 0x02, 0x03, 0xe8, 0x05, 0x01,
+ 0x00, 0x01, 0x04, 0x02, 0x00, 0x22, 0x00, 0x00,
+ 0x1c, 0x01, 0x00, 0x1d, 0x01, 0xd5, 0xee, 0x1f,
+ 0xe1, 0x42, 0x68, 0x01, 0x00, 0x00, 0xb9, 0xe2,
+ 0x24, 0x02, 0x00, 0xd5, 0xa1, 0xe1, 0x42, 0x68,
+ 0x01, 0x00, 0x00, 0xe2, 0x24, 0x01, 0x00, 0xa1,
+ 0xe5, 0xe2, 0xd5, 0xed, 0xa1, 0xe6, 0x29, 0x0e,
+ 0x43, 0x02, 0x03, 0xea, 0x05, 0x00, 0x00, 0x00,
+ 0x01, 0x01, 0x00, 0x03, 0x00, 0xec, 0x05, 0x23,
+ 0x01, 0x0a, 0xe5, 0x29, 0x0e, 0x43, 0x02, 0x03,
+ 0xee, 0x05, 0x00, 0x00, 0x00, 0x01, 0x02, 0x00,
+ 0x07, 0x00, 0xf0, 0x05, 0x1c, 0x01, 0xf2, 0x05,
+ 0x1d, 0x01, 0xc5, 0xe5, 0xb9, 0xe6, 0xc1, 0xfe,
+ 0x28, 0x0e, 0x43, 0x02, 0x03, 0xf4, 0x05, 0x00,
+ 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x29,
+ 0x0e, 0x43, 0x02, 0x03, 0xf6, 0x05, 0x00, 0x00,
+ 0x00, 0x01, 0x01, 0x00, 0x03, 0x00, 0xf2, 0x05,
+ 0x1d, 0x01, 0xb9, 0xe5, 0x29, 0x0e, 0x43, 0x02,
+ 0x03, 0xf8, 0x05, 0x00, 0x00, 0x00, 0x01, 0x02,
+ 0x00, 0x04, 0x00, 0xf2, 0x05, 0x1d, 0x01, 0xf0,
+ 0x05, 0x1c, 0x01, 0xe2, 0xed, 0xe5, 0x29, 0x0e,
+ 0x43, 0x02, 0x03, 0xfa, 0x05, 0x00, 0x00, 0x00,
+ 0x04, 0x03, 0x00, 0x1d, 0x00, 0xf2, 0x05, 0x1d,
+ 0x01, 0xf0, 0x05, 0x1c, 0x01, 0xc0, 0x05, 0x32,
+ 0x01, 0xe1, 0xe2, 0xed, 0xa7, 0xee, 0x17, 0xe1,
+ 0x93, 0xe5, 0xe3, 0xe2, 0x42, 0x7e, 0x01, 0x00,
+ 0x00, 0xe1, 0x24, 0x01, 0x00, 0xf3, 0xee, 0x06,
+ 0xe1, 0x93, 0xe5, 0xf0, 0xee, 0x29, 0x0e, 0x43,
+ 0x02, 0x03, 0xfe, 0x05, 0x00, 0x00, 0x00, 0x04,
+ 0x03, 0x00, 0x1c, 0x00, 0xf2, 0x05, 0x1d, 0x01,
+ 0xc0, 0x05, 0x32, 0x01, 0xf0, 0x05, 0x1c, 0x01,
+ 0xe1, 0xb9, 0xa9, 0xee, 0x17, 0xe1, 0x92, 0xe5,
+ 0xe2, 0xe3, 0x42, 0x7e, 0x01, 0x00, 0x00, 0xe1,
+ 0x24, 0x01, 0x00, 0xf3, 0xee, 0x06, 0xe1, 0x92,
+ 0xe5, 0xf0, 0xee, 0x29, 0x0e, 0x43, 0x02, 0x03,
+ 0x80, 0x06, 0x01, 0x00, 0x01, 0x04, 0x02, 0x00,
+ 0x35, 0x00, 0x00, 0x1c, 0x01, 0x00, 0x30, 0x01,
+ 0xd5, 0xe1, 0xed, 0xa7, 0xee, 0x15, 0xe2, 0xe1,
+ 0x42, 0x7e, 0x01, 0x00, 0x00, 0xd5, 0x24, 0x01,
+ 0x00, 0xf3, 0x9a, 0xee, 0x06, 0xd5, 0x93, 0xd9,
+ 0xf0, 0xe7, 0xd5, 0xe1, 0xed, 0xa7, 0xee, 0x14,
+ 0xe2, 0xe1, 0x42, 0x7e, 0x01, 0x00, 0x00, 0xd5,
+ 0x24, 0x01, 0x00, 0xf3, 0xee, 0x06, 0xd5, 0x93,
+ 0xd9, 0xf0, 0xe8, 0xd5, 0x28, 0x0e, 0x43, 0x02,
+ 0x03, 0x82, 0x06, 0x01, 0x00, 0x01, 0x05, 0x02,
+ 0x00, 0x37, 0x00, 0x00, 0x30, 0x01, 0x00, 0x1c,
+ 0x01, 0xd5, 0xb9, 0xa9, 0xee, 0x17, 0xe1, 0xe2,
+ 0x42, 0x7e, 0x01, 0x00, 0x00, 0xd5, 0xba, 0xa2,
+ 0x24, 0x01, 0x00, 0xf3, 0x9a, 0xee, 0x06, 0xd5,
+ 0x92, 0xd9, 0xf0, 0xe6, 0xd5, 0xb9, 0xa9, 0xee,
+ 0x16, 0xe1, 0xe2, 0x42, 0x7e, 0x01, 0x00, 0x00,
+ 0xd5, 0xba, 0xa2, 0x24, 0x01, 0x00, 0xf3, 0xee,
+ 0x06, 0xd5, 0x92, 0xd9, 0xf0, 0xe7, 0xd5, 0x28,
+ 0x0e, 0x43, 0x02, 0x03, 0x84, 0x06, 0x00, 0x00,
+ 0x00, 0x02, 0x02, 0x00, 0x05, 0x00, 0xf2, 0x05,
+ 0x1d, 0x01, 0x80, 0x06, 0x40, 0x01, 0xe2, 0xe1,
+ 0xf3, 0xe5, 0x29, 0x0e, 0x43, 0x02, 0x03, 0x86,
+ 0x06, 0x00, 0x00, 0x00, 0x02, 0x02, 0x00, 0x05,
+ 0x00, 0xf2, 0x05, 0x1d, 0x01, 0x82, 0x06, 0x41,
+ 0x01, 0xe2, 0xe1, 0xf3, 0xe5, 0x29, 0x0e, 0x43,
+ 0x02, 0x03, 0x88, 0x06, 0x00, 0x00, 0x00, 0x03,
+ 0x03, 0x00, 0x17, 0x00, 0xc6, 0x03, 0x00, 0x0c,
+ 0x8a, 0x06, 0x45, 0x01, 0xf0, 0x05, 0x1c, 0x01,
+ 0x65, 0x00, 0x00, 0x42, 0x67, 0x01, 0x00, 0x00,
+ 0x04, 0x20, 0x01, 0x00, 0x00, 0x24, 0x01, 0x00,
+ 0x0e, 0xe2, 0xe3, 0xf3, 0x0e, 0xb8, 0x28, 0x0e,
+ 0x43, 0x02, 0x03, 0x8a, 0x06, 0x01, 0x00, 0x01,
+ 0x03, 0x02, 0x00, 0x12, 0x00, 0x00, 0x0c, 0x01,
+ 0x00, 0x20, 0x01, 0xd5, 0xee, 0x0c, 0xe1, 0x42,
+ 0x86, 0x01, 0x00, 0x00, 0xd5, 0x24, 0x01, 0x00,
+ 0x0e, 0xe1, 0xed, 0xe6, 0x29, 0x0e, 0x43, 0x02,
+ 0x03, 0x8e, 0x06, 0x00, 0x00, 0x00, 0x03, 0x04,
+ 0x00, 0x20, 0x00, 0x90, 0x06, 0x20, 0x01, 0x92,
+ 0x06, 0x0c, 0x01, 0xf0, 0x05, 0x1c, 0x01, 0xf2,
+ 0x05, 0x1d, 0x01, 0xe1, 0xb9, 0xa9, 0xee, 0x1b,
+ 0xe1, 0xe2, 0xed, 0xad, 0xee, 0x0c, 0xe2, 0x42,
+ 0x86, 0x01, 0x00, 0x00, 0xe3, 0x24, 0x01, 0x00,
+ 0x0e, 0xe1, 0x92, 0xe5, 0xe2, 0xe1, 0x47, 0xeb,
+ 0xed, 0xe8, 0x29, 0x0e, 0x43, 0x02, 0x03, 0x94,
+ 0x06, 0x00, 0x00, 0x00, 0x03, 0x04, 0x00, 0x12,
+ 0x00, 0x90, 0x06, 0x20, 0x01, 0x92, 0x06, 0x0c,
+ 0x01, 0xf0, 0x05, 0x1c, 0x01, 0xf2, 0x05, 0x1d,
+ 0x01, 0xe1, 0xe2, 0xed, 0xba, 0xa2, 0xa7, 0xee,
+ 0x0a, 0xe1, 0x93, 0xe5, 0xe2, 0xe1, 0x47, 0xeb,
+ 0xed, 0xe8, 0x29, 0x0e, 0x43, 0x02, 0x03, 0x96,
+ 0x06, 0x01, 0x03, 0x01, 0x05, 0x04, 0x00, 0x3d,
+ 0x00, 0x00, 0x1d, 0x01, 0x00, 0x0c, 0x01, 0x00,
+ 0x20, 0x01, 0x00, 0x1c, 0x01, 0xe1, 0xcd, 0xba,
+ 0xce, 0xca, 0xe2, 0xed, 0xa8, 0xee, 0x33, 0xe2,
+ 0xed, 0xca, 0xd5, 0x9e, 0xa1, 0xe3, 0xa1, 0xe2,
+ 0xed, 0xa0, 0xcf, 0xe2, 0xcb, 0x47, 0x42, 0x68,
+ 0x01, 0x00, 0x00, 0xb9, 0xc9, 0x24, 0x02, 0x00,
+ 0xe4, 0x42, 0x68, 0x01, 0x00, 0x00, 0xb9, 0xc9,
+ 0x24, 0x02, 0x00, 0xad, 0xee, 0x08, 0xcb, 0xe7,
+ 0xe2, 0xcb, 0x47, 0xe8, 0x29, 0x97, 0x01, 0xf0,
+ 0xc9, 0x29, 0x0e, 0x43, 0x02, 0x03, 0x98, 0x06,
+ 0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x05, 0x00,
+ 0x96, 0x06, 0x48, 0x01, 0xe1, 0xb8, 0x23, 0x01,
+ 0x00, 0x0e, 0x43, 0x02, 0x03, 0x9a, 0x06, 0x00,
+ 0x00, 0x00, 0x02, 0x01, 0x00, 0x05, 0x00, 0x96,
+ 0x06, 0x48, 0x01, 0xe1, 0xba, 0x23, 0x01, 0x00,
+ 0x0e, 0x43, 0x02, 0x03, 0x9c, 0x06, 0x01, 0x02,
+ 0x01, 0x04, 0x05, 0x00, 0x66, 0x00, 0x00, 0x1d,
+ 0x01, 0x00, 0x32, 0x01, 0x00, 0x1c, 0x01, 0x00,
+ 0x22, 0x01, 0x00, 0x53, 0x01, 0xe1, 0xcd, 0xd5,
+ 0xb9, 0xa7, 0xee, 0x15, 0x96, 0x00, 0xe2, 0xe3,
+ 0x42, 0x7e, 0x01, 0x00, 0x00, 0xc9, 0x24, 0x01,
+ 0x00, 0xf3, 0xee, 0x05, 0x96, 0x00, 0xf0, 0xef,
+ 0xc9, 0xba, 0xa1, 0xce, 0xe2, 0xe3, 0x42, 0x7e,
+ 0x01, 0x00, 0x00, 0xca, 0x24, 0x01, 0x00, 0xf3,
+ 0xee, 0x05, 0x97, 0x01, 0xf0, 0xef, 0xc9, 0xb9,
+ 0xaa, 0xee, 0x30, 0xc9, 0xe3, 0xed, 0xa7, 0xee,
+ 0x2a, 0xe4, 0x5e, 0x04, 0x00, 0xaf, 0xee, 0x0a,
+ 0x5e, 0x04, 0x00, 0xc9, 0xca, 0xd5, 0xf5, 0x0e,
+ 0x29, 0xe3, 0x42, 0x68, 0x01, 0x00, 0x00, 0xb9,
+ 0xc9, 0x24, 0x02, 0x00, 0xe3, 0x42, 0x68, 0x01,
+ 0x00, 0x00, 0xca, 0x24, 0x01, 0x00, 0xa1, 0xe7,
+ 0xc9, 0xe5, 0x29, 0x0e, 0x43, 0x02, 0x03, 0x9e,
+ 0x06, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04,
+ 0x00, 0x9c, 0x06, 0x4b, 0x01, 0xe1, 0xba, 0xf3,
+ 0x29, 0x0e, 0x43, 0x02, 0x03, 0xa0, 0x06, 0x00,
+ 0x00, 0x00, 0x03, 0x03, 0x00, 0x1f, 0x00, 0xf0,
+ 0x05, 0x1c, 0x01, 0xc6, 0x03, 0x00, 0x0c, 0x9c,
+ 0x06, 0x4b, 0x01, 0xe1, 0xed, 0xb9, 0xad, 0xee,
+ 0x15, 0x65, 0x01, 0x00, 0x42, 0x67, 0x01, 0x00,
+ 0x00, 0x04, 0x20, 0x01, 0x00, 0x00, 0x24, 0x01,
+ 0x00, 0x0e, 0xc1, 0xfd, 0x28, 0xe3, 0xba, 0xf3,
+ 0x0e, 0x29, 0x0e, 0x43, 0x02, 0x03, 0xa2, 0x06,
+ 0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x04, 0x00,
+ 0x9c, 0x06, 0x4b, 0x01, 0xe1, 0xb8, 0xf3, 0x29,
+ 0x0e, 0x43, 0x02, 0x03, 0xa4, 0x06, 0x00, 0x01,
+ 0x00, 0x06, 0x02, 0x00, 0x51, 0x00, 0x00, 0x1d,
+ 0x01, 0x00, 0x1c, 0x01, 0xe1, 0xcd, 0xe2, 0xed,
+ 0xba, 0xa9, 0xee, 0x49, 0xc9, 0xb9, 0xa9, 0xee,
+ 0x44, 0xc9, 0xe2, 0xed, 0xad, 0xee, 0x03, 0x96,
+ 0x00, 0xe2, 0x42, 0x68, 0x01, 0x00, 0x00, 0xb9,
+ 0xc9, 0xba, 0xa2, 0x24, 0x02, 0x00, 0xe2, 0x42,
+ 0x68, 0x01, 0x00, 0x00, 0xc9, 0xc9, 0xba, 0xa1,
+ 0x24, 0x02, 0x00, 0xa1, 0xe2, 0x42, 0x68, 0x01,
+ 0x00, 0x00, 0xc9, 0xba, 0xa2, 0xc9, 0x24, 0x02,
+ 0x00, 0xa1, 0xe2, 0x42, 0x68, 0x01, 0x00, 0x00,
+ 0xc9, 0xba, 0xa1, 0x24, 0x01, 0x00, 0xa1, 0xe6,
+ 0xc9, 0xba, 0xa1, 0xe5, 0x29, 0x0e, 0x43, 0x02,
+ 0x03, 0xa6, 0x06, 0x00, 0x04, 0x00, 0x05, 0x04,
+ 0x00, 0x57, 0x00, 0x00, 0x41, 0x01, 0x00, 0x1d,
+ 0x01, 0x00, 0x40, 0x01, 0x00, 0x1c, 0x01, 0xe1,
+ 0xe2, 0xf3, 0xcd, 0xe3, 0xc9, 0xf3, 0xce, 0xe3,
+ 0xe2, 0xf3, 0xcf, 0xe1, 0xcb, 0xf3, 0xd0, 0xc9,
+ 0xca, 0xa7, 0xee, 0x42, 0xca, 0xe2, 0xa8, 0xee,
+ 0x3d, 0xe2, 0xcc, 0xa8, 0xee, 0x38, 0xcc, 0xcb,
+ 0xa7, 0xee, 0x33, 0xe4, 0x42, 0x68, 0x01, 0x00,
+ 0x00, 0xb9, 0xc9, 0x24, 0x02, 0x00, 0xe4, 0x42,
+ 0x68, 0x01, 0x00, 0x00, 0xcc, 0xcb, 0x24, 0x02,
+ 0x00, 0xa1, 0xe4, 0x42, 0x68, 0x01, 0x00, 0x00,
+ 0xca, 0xcc, 0x24, 0x02, 0x00, 0xa1, 0xe4, 0x42,
+ 0x68, 0x01, 0x00, 0x00, 0xc9, 0xca, 0x24, 0x02,
+ 0x00, 0xa1, 0xe8, 0xcb, 0xe6, 0x29, 0x0e, 0x43,
+ 0x02, 0x03, 0xa8, 0x06, 0x00, 0x01, 0x00, 0x05,
+ 0x03, 0x00, 0x30, 0x00, 0x00, 0x40, 0x01, 0x00,
+ 0x1d, 0x01, 0x00, 0x1c, 0x01, 0xe1, 0xe2, 0xf3,
+ 0xcd, 0xe3, 0x42, 0x68, 0x01, 0x00, 0x00, 0xb9,
+ 0xe2, 0x24, 0x02, 0x00, 0xe3, 0x42, 0x68, 0x01,
+ 0x00, 0x00, 0xe2, 0xc9, 0x24, 0x02, 0x00, 0x42,
+ 0x95, 0x01, 0x00, 0x00, 0x24, 0x00, 0x00, 0xa1,
+ 0xe3, 0x42, 0x68, 0x01, 0x00, 0x00, 0xc9, 0x24,
+ 0x01, 0x00, 0xa1, 0xe7, 0x29, 0x0e, 0x43, 0x02,
+ 0x03, 0xac, 0x06, 0x00, 0x01, 0x00, 0x05, 0x03,
+ 0x00, 0x30, 0x00, 0x00, 0x40, 0x01, 0x00, 0x1d,
+ 0x01, 0x00, 0x1c, 0x01, 0xe1, 0xe2, 0xf3, 0xcd,
+ 0xe3, 0x42, 0x68, 0x01, 0x00, 0x00, 0xb9, 0xe2,
+ 0x24, 0x02, 0x00, 0xe3, 0x42, 0x68, 0x01, 0x00,
+ 0x00, 0xe2, 0xc9, 0x24, 0x02, 0x00, 0x42, 0x97,
+ 0x01, 0x00, 0x00, 0x24, 0x00, 0x00, 0xa1, 0xe3,
+ 0x42, 0x68, 0x01, 0x00, 0x00, 0xc9, 0x24, 0x01,
+ 0x00, 0xa1, 0xe7, 0x29, 0x0e, 0x43, 0x02, 0x03,
+ 0xb0, 0x06, 0x03, 0x01, 0x03, 0x04, 0x06, 0x00,
+ 0x5e, 0x00, 0x00, 0x1c, 0x01, 0x00, 0x22, 0x01,
+ 0x00, 0x53, 0x01, 0x00, 0x0d, 0x01, 0x00, 0x1d,
+ 0x01, 0x00, 0x21, 0x01, 0xe1, 0x42, 0x68, 0x01,
+ 0x00, 0x00, 0xd5, 0xd6, 0x24, 0x02, 0x00, 0xcd,
+ 0xe2, 0xe3, 0xb0, 0xee, 0x05, 0xc9, 0xe8, 0xf0,
+ 0x10, 0xd7, 0xb9, 0xa7, 0xee, 0x07, 0xc9, 0xe4,
+ 0xa1, 0xe8, 0xf0, 0x05, 0xe4, 0xc9, 0xa1, 0xe8,
+ 0xe1, 0x42, 0x68, 0x01, 0x00, 0x00, 0xb9, 0xd5,
+ 0x24, 0x02, 0x00, 0xe1, 0x42, 0x68, 0x01, 0x00,
+ 0x00, 0xd6, 0x24, 0x01, 0x00, 0xa1, 0xe5, 0x5e,
+ 0x04, 0x00, 0xd6, 0xa9, 0xee, 0x0d, 0x5e, 0x04,
+ 0x00, 0xd6, 0xd5, 0xa2, 0xa2, 0x5f, 0x04, 0x00,
+ 0xf0, 0x0c, 0x5e, 0x04, 0x00, 0xd5, 0xa9, 0xee,
+ 0x05, 0xd5, 0x5f, 0x04, 0x00, 0xe3, 0x5f, 0x05,
+ 0x00, 0x29, 0x0e, 0x43, 0x02, 0x03, 0xb2, 0x06,
+ 0x00, 0x00, 0x00, 0x04, 0x03, 0x00, 0x07, 0x00,
+ 0xb0, 0x06, 0x53, 0x01, 0xf2, 0x05, 0x1d, 0x01,
+ 0xf0, 0x05, 0x1c, 0x01, 0xe1, 0xe2, 0xe3, 0xed,
+ 0xba, 0xf5, 0x29, 0x0e, 0x43, 0x02, 0x03, 0xb4,
+ 0x06, 0x00, 0x00, 0x00, 0x04, 0x02, 0x00, 0x06,
+ 0x00, 0xb0, 0x06, 0x53, 0x01, 0xf2, 0x05, 0x1d,
+ 0x01, 0xe1, 0xb9, 0xe2, 0xb8, 0xf5, 0x29, 0x0e,
+ 0x43, 0x02, 0x03, 0xb6, 0x06, 0x00, 0x00, 0x00,
+ 0x04, 0x03, 0x00, 0x08, 0x00, 0xb0, 0x06, 0x53,
+ 0x01, 0xf2, 0x05, 0x1d, 0x01, 0x80, 0x06, 0x40,
+ 0x01, 0xe1, 0xe2, 0xe3, 0xe2, 0xf3, 0xba, 0xf5,
+ 0x29, 0x0e, 0x43, 0x02, 0x03, 0xb8, 0x06, 0x00,
+ 0x00, 0x00, 0x04, 0x03, 0x00, 0x08, 0x00, 0xb0,
+ 0x06, 0x53, 0x01, 0x82, 0x06, 0x41, 0x01, 0xf2,
+ 0x05, 0x1d, 0x01, 0xe1, 0xe2, 0xe3, 0xf3, 0xe3,
+ 0xb8, 0xf5, 0x29, 0x0e, 0x43, 0x02, 0x03, 0xba,
+ 0x06, 0x00, 0x00, 0x00, 0x02, 0x02, 0x00, 0x04,
+ 0x00, 0xe8, 0x05, 0x38, 0x01, 0xbc, 0x06, 0x0d,
+ 0x01, 0xe1, 0xe2, 0xf3, 0x29, 0x0e, 0x43, 0x02,
+ 0x03, 0xbe, 0x06, 0x00, 0x00, 0x00, 0x03, 0x04,
+ 0x00, 0x39, 0x00, 0xc0, 0x06, 0x22, 0x01, 0xbe,
+ 0x06, 0x59, 0x01, 0xc6, 0x03, 0x00, 0x0c, 0xc2,
+ 0x06, 0x64, 0x01, 0xe1, 0xe2, 0xaf, 0xee, 0x20,
+ 0x65, 0x02, 0x00, 0x42, 0x67, 0x01, 0x00, 0x00,
+ 0x04, 0x20, 0x01, 0x00, 0x00, 0x24, 0x01, 0x00,
+ 0x0e, 0x65, 0x02, 0x00, 0x42, 0xa2, 0x01, 0x00,
+ 0x00, 0xb9, 0x24, 0x01, 0x00, 0x0e, 0x29, 0x65,
+ 0x02, 0x00, 0x42, 0x67, 0x01, 0x00, 0x00, 0x04,
+ 0xa3, 0x01, 0x00, 0x00, 0x24, 0x01, 0x00, 0x0e,
+ 0xe4, 0xf2, 0x0e, 0x29, 0x0e, 0x43, 0x02, 0x03,
+ 0xc8, 0x06, 0x00, 0x00, 0x00, 0x01, 0x02, 0x00,
+ 0x05, 0x00, 0xf0, 0x05, 0x1c, 0x01, 0xf2, 0x05,
+ 0x1d, 0x01, 0xc5, 0xe5, 0xb9, 0xe6, 0x29, 0x0e,
+ 0x43, 0x02, 0x03, 0xca, 0x06, 0x02, 0x01, 0x02,
+ 0x04, 0x01, 0x00, 0x1d, 0x00, 0x00, 0x30, 0x01,
+ 0xc5, 0xcd, 0xd6, 0xb9, 0xa9, 0xee, 0x15, 0xe1,
+ 0xd5, 0xd6, 0xba, 0xa2, 0x47, 0xf3, 0xee, 0x0c,
+ 0xd6, 0x92, 0xda, 0xd5, 0xd6, 0x47, 0xc9, 0xa1,
+ 0xcd, 0xf0, 0xe8, 0xc9, 0x28, 0x0e, 0x43, 0x02,
+ 0x03, 0xcc, 0x06, 0x02, 0x06, 0x02, 0x05, 0x7a,
+ 0x02, 0x87, 0x02, 0x08, 0xce, 0x06, 0x00, 0x01,
+ 0x00, 0xd0, 0x06, 0x00, 0x01, 0x00, 0xd2, 0x06,
+ 0x00, 0x00, 0x00, 0xd4, 0x06, 0x00, 0x01, 0x00,
+ 0xd6, 0x06, 0x00, 0x02, 0x00, 0x10, 0x00, 0x01,
+ 0x00, 0xe0, 0x01, 0x00, 0x01, 0x00, 0x9a, 0x01,
+ 0x00, 0x01, 0x00, 0xd8, 0x06, 0x00, 0x03, 0xa8,
+ 0x02, 0x00, 0x01, 0xb0, 0x02, 0x01, 0x01, 0xaa,
+ 0x02, 0x02, 0x01, 0xbc, 0x02, 0x03, 0x01, 0xb8,
+ 0x02, 0x04, 0x01, 0xca, 0x03, 0x05, 0x01, 0xcc,
+ 0x03, 0x06, 0x01, 0xda, 0x06, 0x07, 0x01, 0xdc,
+ 0x06, 0x08, 0x01, 0xde, 0x06, 0x09, 0x01, 0xe0,
+ 0x06, 0x0a, 0x01, 0xe2, 0x06, 0x0b, 0x01, 0x92,
+ 0x06, 0x0c, 0x01, 0xbc, 0x06, 0x0d, 0x01, 0xe4,
+ 0x06, 0x0e, 0x01, 0xe6, 0x06, 0x0f, 0x01, 0xe8,
+ 0x06, 0x10, 0x01, 0xea, 0x06, 0x11, 0x01, 0xec,
+ 0x06, 0x12, 0x01, 0xee, 0x06, 0x13, 0x01, 0xf0,
+ 0x06, 0x14, 0x01, 0xf2, 0x06, 0x15, 0x01, 0xf4,
+ 0x06, 0x16, 0x01, 0xf6, 0x06, 0x17, 0x01, 0xf8,
+ 0x06, 0x18, 0x01, 0xfa, 0x06, 0x19, 0x01, 0xfc,
+ 0x06, 0x1a, 0x01, 0xfe, 0x06, 0x1b, 0x01, 0xf0,
+ 0x05, 0x1c, 0x01, 0xf2, 0x05, 0x1d, 0x01, 0x80,
+ 0x07, 0x1e, 0x01, 0x82, 0x07, 0x1f, 0x01, 0x90,
+ 0x06, 0x20, 0x01, 0x84, 0x07, 0x21, 0x01, 0xc0,
+ 0x06, 0x22, 0x01, 0xec, 0x05, 0x23, 0x01, 0x86,
+ 0x07, 0x24, 0x01, 0x88, 0x07, 0x25, 0x01, 0x8a,
+ 0x07, 0x26, 0x01, 0x8c, 0x07, 0x27, 0x01, 0x8e,
+ 0x07, 0x28, 0x01, 0x90, 0x07, 0x29, 0x01, 0x90,
+ 0x05, 0x2a, 0x01, 0xa0, 0x05, 0x2b, 0x01, 0xa4,
+ 0x05, 0x2c, 0x01, 0xa2, 0x05, 0x2d, 0x01, 0xaa,
+ 0x05, 0x2e, 0x01, 0xb4, 0x05, 0x2f, 0x01, 0xb6,
+ 0x05, 0x30, 0x01, 0xbc, 0x05, 0x31, 0x01, 0xc0,
+ 0x05, 0x32, 0x01, 0xc4, 0x05, 0x33, 0x01, 0xcc,
+ 0x05, 0x34, 0x01, 0xd2, 0x05, 0x35, 0x01, 0xd6,
+ 0x05, 0x36, 0x01, 0xde, 0x05, 0x37, 0x01, 0xe8,
+ 0x05, 0x38, 0x01, 0xea, 0x05, 0x39, 0x01, 0xee,
+ 0x05, 0x3a, 0x01, 0xf4, 0x05, 0x3b, 0x01, 0xf6,
+ 0x05, 0x3c, 0x01, 0xf8, 0x05, 0x3d, 0x01, 0xfa,
+ 0x05, 0x3e, 0x01, 0xfe, 0x05, 0x3f, 0x01, 0x80,
+ 0x06, 0x40, 0x01, 0x82, 0x06, 0x41, 0x01, 0x84,
+ 0x06, 0x42, 0x01, 0x86, 0x06, 0x43, 0x01, 0x88,
+ 0x06, 0x44, 0x01, 0x8a, 0x06, 0x45, 0x01, 0x8e,
+ 0x06, 0x46, 0x01, 0x94, 0x06, 0x47, 0x01, 0x96,
+ 0x06, 0x48, 0x01, 0x98, 0x06, 0x49, 0x01, 0x9a,
+ 0x06, 0x4a, 0x01, 0x9c, 0x06, 0x4b, 0x01, 0x9e,
+ 0x06, 0x4c, 0x01, 0xa0, 0x06, 0x4d, 0x01, 0xa2,
+ 0x06, 0x4e, 0x01, 0xa4, 0x06, 0x4f, 0x01, 0xa6,
+ 0x06, 0x50, 0x01, 0xa8, 0x06, 0x51, 0x01, 0xac,
+ 0x06, 0x52, 0x01, 0xb0, 0x06, 0x53, 0x01, 0xb2,
+ 0x06, 0x54, 0x01, 0xb4, 0x06, 0x55, 0x01, 0xb6,
+ 0x06, 0x56, 0x01, 0xb8, 0x06, 0x57, 0x01, 0xba,
+ 0x06, 0x58, 0x01, 0xbe, 0x06, 0x59, 0x01, 0xc8,
+ 0x06, 0x5a, 0x01, 0xca, 0x06, 0x5b, 0x01, 0xcc,
+ 0x06, 0x5c, 0x01, 0x92, 0x07, 0x5d, 0x01, 0x94,
+ 0x07, 0x5e, 0x01, 0x96, 0x07, 0x5f, 0x01, 0x98,
+ 0x07, 0x60, 0x01, 0x9a, 0x07, 0x61, 0x01, 0x9c,
+ 0x07, 0x62, 0x01, 0x9e, 0x07, 0x63, 0x01, 0xc2,
+ 0x06, 0x64, 0x01, 0xa0, 0x07, 0x65, 0x01, 0xa2,
+ 0x07, 0x66, 0x01, 0xa4, 0x07, 0x67, 0x01, 0xa6,
+ 0x07, 0x68, 0x01, 0xa8, 0x07, 0x69, 0x01, 0xaa,
+ 0x07, 0x6a, 0x01, 0xac, 0x07, 0x6b, 0x01, 0xae,
+ 0x07, 0x6c, 0x01, 0xb0, 0x07, 0x6d, 0x01, 0xb2,
+ 0x07, 0x6e, 0x01, 0xb4, 0x07, 0x6f, 0x01, 0xb6,
+ 0x07, 0x70, 0x01, 0xb8, 0x07, 0x71, 0x01, 0xba,
+ 0x07, 0x72, 0x01, 0xbc, 0x07, 0x73, 0x01, 0xbe,
+ 0x07, 0x74, 0x01, 0xc0, 0x07, 0x75, 0x01, 0xc2,
+ 0x07, 0x76, 0x01, 0xc6, 0x03, 0x00, 0x0c, 0xc8,
+ 0x03, 0x01, 0x0c, 0x0c, 0x03, 0xc7, 0x04, 0x08,
+ 0xd0, 0x0c, 0x00, 0xc7, 0x05, 0xd6, 0xb9, 0xa8,
+ 0x11, 0xef, 0x16, 0x0e, 0x04, 0xe2, 0x01, 0x00,
+ 0x00, 0x42, 0xe3, 0x01, 0x00, 0x00, 0xd5, 0xd6,
+ 0xba, 0xa2, 0x47, 0x24, 0x01, 0x00, 0xb9, 0xaa,
+ 0xee, 0x03, 0xe1, 0x28, 0xd6, 0xbb, 0xaa, 0x6c,
+ 0xd9, 0x00, 0x00, 0x00, 0xd5, 0xd6, 0xba, 0xa2,
+ 0x47, 0x04, 0xe4, 0x01, 0x00, 0x00, 0xaf, 0x6c,
+ 0xc9, 0x00, 0x00, 0x00, 0xd6, 0x92, 0xda, 0x0b,
+ 0xcd, 0xd5, 0xd6, 0xba, 0xa2, 0x47, 0xd3, 0x11,
+ 0x04, 0xe5, 0x01, 0x00, 0x00, 0xaf, 0xef, 0x0a,
+ 0x11, 0x04, 0xe6, 0x01, 0x00, 0x00, 0xaf, 0xee,
+ 0x07, 0x04, 0x58, 0x01, 0x00, 0x00, 0x28, 0x11,
+ 0x04, 0xe7, 0x01, 0x00, 0x00, 0xaf, 0xee, 0x05,
+ 0x26, 0x00, 0x00, 0x28, 0x11, 0x04, 0xe8, 0x01,
+ 0x00, 0x00, 0xaf, 0xee, 0x03, 0x0b, 0x28, 0x11,
+ 0x04, 0xe9, 0x01, 0x00, 0x00, 0xaf, 0xee, 0x07,
+ 0xc3, 0x00, 0xc3, 0x01, 0x33, 0x28, 0x5e, 0x31,
+ 0x00, 0xcb, 0xf3, 0xee, 0x73, 0x5e, 0x5c, 0x00,
+ 0xd5, 0xd6, 0xf4, 0xce, 0x04, 0x03, 0x00, 0x00,
+ 0x00, 0x04, 0x02, 0x00, 0x00, 0x00, 0x04, 0x01,
+ 0x00, 0x00, 0x00, 0x04, 0x08, 0x00, 0x00, 0x00,
+ 0x26, 0x04, 0x00, 0x42, 0xea, 0x01, 0x00, 0x00,
+ 0xca, 0x24, 0x01, 0x00, 0x11, 0xef, 0x0b, 0x0e,
+ 0x38, 0xeb, 0x01, 0x00, 0x00, 0xca, 0x91, 0xf3,
+ 0x9a, 0xee, 0x0d, 0x38, 0x3a, 0x00, 0x00, 0x00,
+ 0xca, 0x31, 0x01, 0x00, 0x00, 0x00, 0x28, 0x5e,
+ 0x5d, 0x00, 0xd5, 0xd6, 0xca, 0xed, 0xa2, 0xf4,
+ 0xd1, 0xf7, 0x11, 0xef, 0x04, 0x0e, 0xc9, 0xf6,
+ 0xee, 0x03, 0xc9, 0x28, 0xc9, 0xe1, 0xaf, 0xee,
+ 0x13, 0xc9, 0xca, 0x47, 0xf6, 0xee, 0x0d, 0x38,
+ 0x3a, 0x00, 0x00, 0x00, 0xca, 0x31, 0x01, 0x00,
+ 0x00, 0x00, 0x28, 0xc9, 0xca, 0x47, 0x28, 0x0b,
+ 0x28, 0x29, 0x07, 0x02, 0x20, 0x07, 0x34, 0x00,
+ 0x01, 0x00, 0x13, 0x00, 0x00, 0x00, 0x08, 0x06,
+ 0x00, 0x00, 0x00, 0x04, 0x07, 0xf5, 0xff, 0xff,
+ 0xff, 0x0b, 0x00, 0x01, 0x20, 0x00, 0x0c, 0x00,
+ 0x0a, 0x0e, 0x43, 0x02, 0x03, 0x92, 0x07, 0x02,
+ 0x0a, 0x02, 0x04, 0x03, 0x01, 0xe3, 0x01, 0x00,
+ 0x00, 0x5b, 0x01, 0x00, 0x5c, 0x01, 0x00, 0x00,
+ 0x01, 0xe1, 0xd5, 0xd6, 0xf4, 0xcd, 0xe2, 0xd5,
+ 0xd6, 0xc9, 0xed, 0xa2, 0xf4, 0xcf, 0x26, 0x00,
+ 0x00, 0xd0, 0xb9, 0xc7, 0x04, 0xcb, 0xce, 0xc6,
+ 0x04, 0xc1, 0x0a, 0xa7, 0xee, 0x67, 0xca, 0xf7,
+ 0xef, 0x63, 0xca, 0x06, 0xb0, 0xee, 0x5e, 0xe3,
+ 0x42, 0xec, 0x01, 0x00, 0x00, 0xca, 0x24, 0x01,
+ 0x00, 0xc7, 0x07, 0xb9, 0xc7, 0x05, 0xc6, 0x05,
+ 0xc6, 0x07, 0xed, 0xa7, 0xee, 0x38, 0xc6, 0x07,
+ 0xc6, 0x05, 0x47, 0xc8, 0x08, 0x9b, 0x04, 0x48,
+ 0x00, 0x00, 0x00, 0xad, 0xee, 0x24, 0xc5, 0xc6,
+ 0x08, 0x91, 0xa1, 0xc6, 0x08, 0xae, 0xee, 0x1a,
+ 0xc6, 0x08, 0x42, 0xed, 0x01, 0x00, 0x00, 0xc9,
+ 0x24, 0x01, 0x00, 0xee, 0x0d, 0xcc, 0x42, 0x86,
+ 0x01, 0x00, 0x00, 0xc6, 0x08, 0x24, 0x01, 0x00,
+ 0x0e, 0x97, 0x05, 0xf0, 0xc2, 0xe3, 0x42, 0x5e,
+ 0x00, 0x00, 0x00, 0xca, 0x24, 0x01, 0x00, 0xce,
+ 0x97, 0x04, 0xf0, 0x94, 0xcc, 0xed, 0xba, 0xa9,
+ 0xee, 0x46, 0xc4, 0x00, 0xc7, 0x09, 0xc4, 0x00,
+ 0x0e, 0xcc, 0x42, 0xee, 0x01, 0x00, 0x00, 0x62,
+ 0x09, 0x00, 0x24, 0x01, 0x00, 0x0e, 0xba, 0xc8,
+ 0x05, 0xc7, 0x04, 0xc6, 0x04, 0xcc, 0xed, 0xa7,
+ 0xee, 0x1e, 0xcc, 0xc6, 0x04, 0x47, 0xcc, 0xc6,
+ 0x04, 0xba, 0xa2, 0x47, 0xae, 0xee, 0x0d, 0xcc,
+ 0xc6, 0x05, 0x95, 0xc7, 0x05, 0x74, 0xcc, 0xc6,
+ 0x04, 0x47, 0x49, 0x97, 0x04, 0xf0, 0xdd, 0xcc,
+ 0xc6, 0x05, 0x43, 0x30, 0x00, 0x00, 0x00, 0x0b,
+ 0xcc, 0x4c, 0xef, 0x01, 0x00, 0x00, 0xc9, 0xed,
+ 0x4c, 0xa8, 0x01, 0x00, 0x00, 0xcb, 0x4c, 0xf0,
+ 0x01, 0x00, 0x00, 0x28, 0x0e, 0x43, 0x02, 0x03,
+ 0xe2, 0x07, 0x02, 0x00, 0x02, 0x03, 0x00, 0x00,
+ 0x34, 0x00, 0xd5, 0xb9, 0x47, 0xd6, 0xb9, 0x47,
+ 0xae, 0xee, 0x1b, 0xd5, 0xb9, 0x47, 0x04, 0x5c,
+ 0x01, 0x00, 0x00, 0xad, 0xee, 0x03, 0xba, 0x28,
+ 0xd6, 0xb9, 0x47, 0x04, 0x5c, 0x01, 0x00, 0x00,
+ 0xad, 0xee, 0x03, 0xb8, 0x28, 0xd5, 0xd6, 0xa7,
+ 0xee, 0x03, 0xb8, 0x28, 0xd5, 0xd6, 0xa9, 0xee,
+ 0x04, 0xba, 0x91, 0x28, 0xb9, 0x28, 0x0e, 0x43,
+ 0x02, 0x03, 0x94, 0x07, 0x00, 0x0d, 0x00, 0x07,
+ 0x0a, 0x00, 0x8f, 0x03, 0x00, 0x00, 0x5d, 0x01,
+ 0x00, 0x1c, 0x01, 0x00, 0x1d, 0x01, 0x00, 0x38,
+ 0x01, 0x00, 0x22, 0x01, 0x00, 0x5e, 0x01, 0x00,
+ 0x04, 0x01, 0x00, 0x28, 0x01, 0x00, 0x00, 0x0c,
+ 0x00, 0x64, 0x01, 0xe1, 0xe2, 0xe3, 0xf4, 0xd2,
+ 0x41, 0xef, 0x01, 0x00, 0x00, 0xd1, 0xed, 0xb9,
+ 0xaf, 0xee, 0x02, 0x29, 0xc9, 0xb9, 0x47, 0xd3,
+ 0xed, 0xc7, 0x05, 0xba, 0xd0, 0xcc, 0xc9, 0xed,
+ 0xa7, 0xee, 0x2a, 0xc9, 0xcc, 0x47, 0xc7, 0x06,
+ 0xb9, 0xc7, 0x04, 0xc6, 0x04, 0xc6, 0x05, 0xa7,
+ 0xee, 0x17, 0xc6, 0x06, 0xc6, 0x04, 0x47, 0xcb,
+ 0xc6, 0x04, 0x47, 0xb0, 0xee, 0x07, 0xc6, 0x04,
+ 0xc7, 0x05, 0xf0, 0x05, 0x97, 0x04, 0xf0, 0xe4,
+ 0x97, 0x03, 0xf0, 0xd2, 0xca, 0x41, 0xa8, 0x01,
+ 0x00, 0x00, 0xd0, 0xcc, 0xc6, 0x05, 0xa7, 0xee,
+ 0x0b, 0xe4, 0xcb, 0xcc, 0x47, 0xf3, 0x0e, 0x97,
+ 0x03, 0xf0, 0xf1, 0x5e, 0x04, 0x00, 0x5e, 0x05,
+ 0x00, 0xaf, 0xee, 0x42, 0xc9, 0xed, 0xba, 0xad,
+ 0xee, 0x3c, 0xca, 0x41, 0xf0, 0x01, 0x00, 0x00,
+ 0xc9, 0xb9, 0x47, 0x47, 0xc8, 0x0c, 0xf8, 0xee,
+ 0x1a, 0xe4, 0x04, 0xf2, 0x01, 0x00, 0x00, 0xf3,
+ 0x0e, 0xc6, 0x0c, 0xed, 0xb9, 0xad, 0xee, 0x1e,
+ 0xe4, 0x04, 0xf3, 0x01, 0x00, 0x00, 0xf3, 0x0e,
+ 0xf0, 0x14, 0xc6, 0x0c, 0x9b, 0x04, 0x49, 0x00,
+ 0x00, 0x00, 0xad, 0xee, 0x09, 0xe4, 0x04, 0xe4,
+ 0x01, 0x00, 0x00, 0xf3, 0x0e, 0x5e, 0x04, 0x00,
+ 0x5e, 0x05, 0x00, 0xaf, 0x6c, 0xdc, 0x00, 0x00,
+ 0x00, 0xc9, 0xed, 0xbb, 0xaa, 0x6c, 0xd3, 0x00,
+ 0x00, 0x00, 0xb9, 0xc7, 0x07, 0xb9, 0xd0, 0xcc,
+ 0xc9, 0xed, 0xa7, 0xee, 0x18, 0x5e, 0x06, 0x00,
+ 0x42, 0xf4, 0x01, 0x00, 0x00, 0xc6, 0x07, 0xc9,
+ 0xcc, 0x47, 0xed, 0x24, 0x02, 0x00, 0xc7, 0x07,
+ 0x97, 0x03, 0xf0, 0xe4, 0xbb, 0x98, 0x07, 0x5e,
+ 0x06, 0x00, 0x42, 0xf4, 0x01, 0x00, 0x00, 0xba,
+ 0x5e, 0x06, 0x00, 0x42, 0xf5, 0x01, 0x00, 0x00,
+ 0x5e, 0x07, 0x00, 0xba, 0xa1, 0xc6, 0x07, 0x9f,
+ 0x24, 0x01, 0x00, 0x24, 0x02, 0x00, 0xc7, 0x09,
+ 0x5e, 0x06, 0x00, 0x42, 0xf6, 0x01, 0x00, 0x00,
+ 0xc9, 0xed, 0xc6, 0x09, 0x9f, 0x24, 0x01, 0x00,
+ 0xc7, 0x0b, 0x65, 0x08, 0x00, 0x42, 0x67, 0x01,
+ 0x00, 0x00, 0x04, 0x20, 0x01, 0x00, 0x00, 0x24,
+ 0x01, 0x00, 0x0e, 0xb9, 0xc7, 0x0a, 0xc6, 0x0a,
+ 0xc6, 0x0b, 0xa7, 0xee, 0x58, 0xb9, 0xc7, 0x08,
+ 0xc6, 0x08, 0xc6, 0x09, 0xa7, 0xee, 0x39, 0xc6,
+ 0x08, 0xc6, 0x0b, 0x9e, 0xc6, 0x0a, 0xa1, 0xd4,
+ 0xc9, 0xed, 0xaa, 0xef, 0x2b, 0xc9, 0xcc, 0x47,
+ 0xcf, 0xc6, 0x08, 0xc6, 0x09, 0xba, 0xa2, 0xae,
+ 0xee, 0x0d, 0xcb, 0x42, 0xf7, 0x01, 0x00, 0x00,
+ 0xc6, 0x07, 0x24, 0x01, 0x00, 0xcf, 0x65, 0x08,
+ 0x00, 0x42, 0x67, 0x01, 0x00, 0x00, 0xcb, 0x24,
+ 0x01, 0x00, 0x0e, 0x97, 0x08, 0xf0, 0xc2, 0x65,
+ 0x08, 0x00, 0x42, 0x67, 0x01, 0x00, 0x00, 0x04,
+ 0x20, 0x01, 0x00, 0x00, 0x24, 0x01, 0x00, 0x0e,
+ 0x97, 0x0a, 0xf0, 0xa3, 0x5e, 0x09, 0x00, 0xf2,
+ 0x0e, 0x29, 0x0e, 0x43, 0x02, 0x03, 0x98, 0x07,
+ 0x02, 0x01, 0x02, 0x02, 0x00, 0x00, 0x10, 0x00,
+ 0xc5, 0xcd, 0xd6, 0x94, 0xda, 0xb9, 0xa9, 0xee,
+ 0x06, 0xd5, 0x98, 0x00, 0xf0, 0xf5, 0xc9, 0x28,
+ 0x0e, 0x43, 0x02, 0x03, 0xc2, 0x06, 0x00, 0x00,
+ 0x00, 0x03, 0x07, 0x00, 0x1e, 0x00, 0xc6, 0x03,
+ 0x00, 0x0c, 0xec, 0x06, 0x12, 0x01, 0x90, 0x07,
+ 0x29, 0x01, 0xbc, 0x05, 0x31, 0x01, 0x8e, 0x07,
+ 0x28, 0x01, 0x80, 0x07, 0x1e, 0x01, 0x82, 0x07,
+ 0x1f, 0x01, 0x65, 0x00, 0x00, 0x42, 0x67, 0x01,
+ 0x00, 0x00, 0xe2, 0x24, 0x01, 0x00, 0x0e, 0xe4,
+ 0xe2, 0xf3, 0x5e, 0x04, 0x00, 0xa0, 0xe7, 0xc5,
+ 0x5f, 0x05, 0x00, 0xb9, 0x5f, 0x06, 0x00, 0x29,
+ 0x0e, 0x43, 0x02, 0x03, 0xa0, 0x07, 0x02, 0x01,
+ 0x02, 0x06, 0x12, 0x01, 0xb0, 0x01, 0x00, 0x00,
+ 0x1c, 0x01, 0x00, 0x1d, 0x01, 0x00, 0x20, 0x01,
+ 0x00, 0x0c, 0x01, 0x00, 0x63, 0x01, 0x00, 0x12,
+ 0x01, 0x00, 0x11, 0x01, 0x00, 0x1a, 0x01, 0x00,
+ 0x60, 0x01, 0x00, 0x13, 0x01, 0x00, 0x15, 0x01,
+ 0x00, 0x17, 0x01, 0x00, 0x04, 0x01, 0x00, 0x19,
+ 0x01, 0x00, 0x14, 0x01, 0x00, 0x64, 0x01, 0x00,
+ 0x37, 0x01, 0x00, 0x62, 0x01, 0xd5, 0x11, 0xef,
+ 0x03, 0x0e, 0xc5, 0xe9, 0xed, 0xe6, 0xe4, 0xed,
+ 0xe7, 0xd6, 0x5f, 0x04, 0x00, 0x5e, 0x06, 0x00,
+ 0x5f, 0x05, 0x00, 0x5e, 0x07, 0x00, 0xee, 0x22,
+ 0x5e, 0x05, 0x00, 0x5e, 0x08, 0x00, 0x04, 0xf8,
+ 0x01, 0x00, 0x00, 0x5e, 0x09, 0x00, 0x5e, 0x05,
+ 0x00, 0xed, 0xa2, 0xf4, 0xa1, 0x60, 0x05, 0x00,
+ 0x5e, 0x0a, 0x00, 0xa1, 0x5f, 0x05, 0x00, 0xf0,
+ 0x66, 0x5e, 0x0b, 0x00, 0xee, 0x50, 0x5e, 0x0c,
+ 0x00, 0x42, 0xf9, 0x01, 0x00, 0x00, 0x5e, 0x0d,
+ 0x00, 0x24, 0x01, 0x00, 0x04, 0xf8, 0x01, 0x00,
+ 0x00, 0xa1, 0xcd, 0xb9, 0x5f, 0x0d, 0x00, 0x5e,
+ 0x08, 0x00, 0xc3, 0x00, 0xbe, 0xc9, 0xed, 0xa2,
+ 0xf4, 0xc9, 0xa1, 0xcd, 0x5e, 0x05, 0x00, 0xc9,
+ 0x42, 0x68, 0x01, 0x00, 0x00, 0xb9, 0xc9, 0xed,
+ 0xbd, 0xa2, 0x24, 0x02, 0x00, 0x04, 0xe4, 0x01,
+ 0x00, 0x00, 0xa1, 0xc9, 0x42, 0x68, 0x01, 0x00,
+ 0x00, 0xc9, 0xed, 0xbd, 0xa2, 0x24, 0x01, 0x00,
+ 0xa1, 0xa1, 0x5f, 0x05, 0x00, 0x5e, 0x05, 0x00,
+ 0xed, 0x5f, 0x09, 0x00, 0x5e, 0x05, 0x00, 0x5e,
+ 0x0e, 0x00, 0xa1, 0x5f, 0x05, 0x00, 0x5e, 0x0f,
+ 0x00, 0xf2, 0x0e, 0x5e, 0x10, 0x00, 0xf2, 0x0e,
+ 0xb9, 0x5f, 0x11, 0x00, 0x29, 0x07, 0x02, 0x30,
+ 0x0e, 0x43, 0x02, 0x03, 0xa2, 0x07, 0x01, 0x01,
+ 0x01, 0x03, 0x04, 0x02, 0x8c, 0x01, 0x00, 0x00,
+ 0x01, 0x01, 0x00, 0x62, 0x01, 0x00, 0x61, 0x01,
+ 0x00, 0x67, 0x01, 0xe1, 0x42, 0xfa, 0x01, 0x00,
+ 0x00, 0xd5, 0x24, 0x01, 0x00, 0xcd, 0xe2, 0x11,
+ 0xb9, 0xaf, 0xee, 0x16, 0xc9, 0x04, 0xfb, 0x01,
+ 0x00, 0x00, 0xad, 0xee, 0x07, 0xc9, 0xe7, 0xba,
+ 0xe6, 0xf0, 0x6c, 0xe4, 0xc9, 0xf3, 0x0e, 0xf0,
+ 0x66, 0x11, 0xba, 0xaf, 0xee, 0x27, 0xe3, 0xc9,
+ 0xa1, 0xe7, 0xc9, 0x04, 0xfc, 0x01, 0x00, 0x00,
+ 0xad, 0xee, 0x05, 0xbb, 0xe6, 0xf0, 0x50, 0xc9,
+ 0x04, 0xfd, 0x01, 0x00, 0x00, 0xad, 0xee, 0x05,
+ 0xbc, 0xe6, 0xf0, 0x43, 0xe4, 0xe3, 0xf3, 0x0e,
+ 0xb9, 0xe6, 0xf0, 0x3b, 0x11, 0xbb, 0xaf, 0xee,
+ 0x27, 0xe3, 0xc9, 0xa1, 0xe7, 0xc9, 0x04, 0xfe,
+ 0x01, 0x00, 0x00, 0xad, 0x11, 0xef, 0x0e, 0x0e,
+ 0xc9, 0xc3, 0x00, 0xaa, 0x11, 0xee, 0x06, 0x0e,
+ 0xc9, 0xc3, 0x01, 0xa8, 0x9a, 0xee, 0x18, 0xe4,
+ 0xe3, 0xf3, 0x0e, 0xb9, 0xe6, 0xf0, 0x10, 0x11,
+ 0xbc, 0xaf, 0xee, 0x0b, 0xe3, 0xc9, 0xa1, 0xe7,
+ 0xe4, 0xe3, 0xf3, 0x0e, 0xb9, 0xe6, 0x29, 0x07,
+ 0x02, 0x30, 0x07, 0x02, 0x39, 0x0e, 0x43, 0x02,
+ 0x03, 0xa4, 0x07, 0x01, 0x01, 0x01, 0x05, 0x0d,
+ 0x00, 0xb0, 0x01, 0x00, 0x00, 0x23, 0x01, 0x00,
+ 0x31, 0x01, 0x00, 0x38, 0x01, 0x00, 0x5f, 0x01,
+ 0x00, 0x21, 0x01, 0x00, 0x63, 0x01, 0x00, 0x1c,
+ 0x01, 0x00, 0x01, 0x0c, 0x00, 0x26, 0x01, 0x00,
+ 0x22, 0x01, 0x00, 0x3b, 0x01, 0x00, 0x1d, 0x01,
+ 0x00, 0x37, 0x01, 0xe1, 0xee, 0x10, 0xe2, 0xd5,
+ 0xf3, 0xba, 0xaf, 0xee, 0x05, 0xe3, 0xd5, 0xf3,
+ 0x0e, 0x09, 0xe5, 0xf0, 0x7a, 0xe4, 0xd5, 0x47,
+ 0xd1, 0xee, 0x55, 0xc9, 0x5f, 0x04, 0x00, 0xc9,
+ 0xd5, 0xf3, 0x11, 0xb8, 0xaf, 0xee, 0x09, 0x5e,
+ 0x05, 0x00, 0x5e, 0x06, 0x00, 0xf3, 0x29, 0x11,
+ 0xc1, 0xfe, 0xaf, 0xee, 0x07, 0x5e, 0x05, 0x00,
+ 0x07, 0xf3, 0x29, 0x11, 0xc1, 0xfd, 0xaf, 0xee,
+ 0x26, 0x65, 0x07, 0x00, 0x42, 0x4d, 0x01, 0x00,
+ 0x00, 0x65, 0x07, 0x00, 0x41, 0x4e, 0x01, 0x00,
+ 0x00, 0x07, 0x24, 0x02, 0x00, 0x0e, 0x65, 0x07,
+ 0x00, 0x42, 0x4f, 0x01, 0x00, 0x00, 0x5e, 0x08,
+ 0x00, 0x07, 0x24, 0x02, 0x00, 0x29, 0x0e, 0x5e,
+ 0x04, 0x00, 0x5f, 0x09, 0x00, 0xf0, 0x20, 0xe2,
+ 0xd5, 0xf3, 0xba, 0xaf, 0xee, 0x14, 0xd5, 0x04,
+ 0xf8, 0x01, 0x00, 0x00, 0xaa, 0xee, 0x0b, 0xe3,
+ 0xd5, 0xf3, 0x0e, 0xe3, 0x5f, 0x09, 0x00, 0xf0,
+ 0x06, 0x5e, 0x0a, 0x00, 0xf2, 0x0e, 0x5e, 0x0b,
+ 0x00, 0xb9, 0xa7, 0xee, 0x04, 0xb9, 0xf0, 0x14,
+ 0x5e, 0x0b, 0x00, 0x5e, 0x06, 0x00, 0xed, 0xa9,
+ 0xee, 0x07, 0x5e, 0x06, 0x00, 0xed, 0xf0, 0x04,
+ 0x5e, 0x0b, 0x00, 0x5f, 0x0b, 0x00, 0x5e, 0x0c,
+ 0x00, 0xf2, 0x29, 0x0e, 0x43, 0x02, 0x03, 0xaa,
+ 0x07, 0x02, 0x01, 0x02, 0x05, 0x02, 0x01, 0x70,
+ 0x00, 0x00, 0x05, 0x01, 0x00, 0x04, 0x01, 0xe1,
+ 0xd5, 0xf3, 0x9a, 0xee, 0x0a, 0xd5, 0x42, 0x37,
+ 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0xd5, 0xb9,
+ 0xad, 0xee, 0x15, 0xba, 0xd5, 0x9f, 0xb9, 0xa7,
+ 0xee, 0x09, 0x04, 0xff, 0x01, 0x00, 0x00, 0xcd,
+ 0xf0, 0x4c, 0xc3, 0x00, 0xcd, 0xf0, 0x47, 0xd6,
+ 0xc1, 0x10, 0xad, 0xee, 0x37, 0xd5, 0xe2, 0x42,
+ 0xf5, 0x01, 0x00, 0x00, 0xd5, 0x24, 0x01, 0x00,
+ 0xaf, 0xee, 0x29, 0xd5, 0xb9, 0xa7, 0xee, 0x0c,
+ 0xd5, 0x90, 0xd9, 0x04, 0x00, 0x02, 0x00, 0x00,
+ 0xcd, 0xf0, 0x03, 0xc5, 0xcd, 0xc9, 0x04, 0x01,
+ 0x02, 0x00, 0x00, 0xd5, 0x42, 0x37, 0x00, 0x00,
+ 0x00, 0xc1, 0x10, 0x24, 0x01, 0x00, 0xa1, 0xa1,
+ 0xcd, 0xf0, 0x0b, 0xd5, 0x42, 0x37, 0x00, 0x00,
+ 0x00, 0x24, 0x00, 0x00, 0xcd, 0xc9, 0x28, 0x07,
+ 0x02, 0x30, 0x0e, 0x43, 0x02, 0x03, 0xac, 0x07,
+ 0x02, 0x01, 0x02, 0x05, 0x01, 0x01, 0xfe, 0x01,
+ 0x00, 0x00, 0x69, 0x01, 0x38, 0xb2, 0x00, 0x00,
+ 0x00, 0x42, 0xe5, 0x00, 0x00, 0x00, 0xd5, 0x24,
+ 0x01, 0x00, 0x9a, 0xee, 0x29, 0xe1, 0x04, 0x02,
+ 0x02, 0x00, 0x00, 0xb0, 0xee, 0x17, 0x04, 0x03,
+ 0x02, 0x00, 0x00, 0xd5, 0x42, 0x37, 0x00, 0x00,
+ 0x00, 0x24, 0x00, 0x00, 0xa1, 0x04, 0xf3, 0x01,
+ 0x00, 0x00, 0xa1, 0x28, 0xd5, 0x42, 0x37, 0x00,
+ 0x00, 0x00, 0x25, 0x00, 0x00, 0xd5, 0xb9, 0xad,
+ 0xee, 0x15, 0xba, 0xd5, 0x9f, 0xb9, 0xa7, 0xee,
+ 0x09, 0x04, 0xff, 0x01, 0x00, 0x00, 0xcd, 0xf0,
+ 0x3e, 0xc3, 0x00, 0xcd, 0xf0, 0x39, 0xd6, 0xc1,
+ 0x10, 0xad, 0xee, 0x29, 0xd5, 0xb9, 0xa7, 0xee,
+ 0x0c, 0xd5, 0x90, 0xd9, 0x04, 0x00, 0x02, 0x00,
+ 0x00, 0xcd, 0xf0, 0x03, 0xc5, 0xcd, 0xc9, 0x04,
+ 0x01, 0x02, 0x00, 0x00, 0xd5, 0x42, 0x37, 0x00,
+ 0x00, 0x00, 0xc1, 0x10, 0x24, 0x01, 0x00, 0xa1,
+ 0xa1, 0xcd, 0xf0, 0x0b, 0xd5, 0x42, 0x37, 0x00,
+ 0x00, 0x00, 0x24, 0x00, 0x00, 0xcd, 0xd5, 0x9b,
+ 0x04, 0x8b, 0x00, 0x00, 0x00, 0xaf, 0xee, 0x13,
+ 0xe1, 0x04, 0x02, 0x02, 0x00, 0x00, 0xb0, 0xee,
+ 0x0a, 0x04, 0x04, 0x02, 0x00, 0x00, 0x98, 0x00,
+ 0xf0, 0x57, 0xe1, 0x04, 0xe3, 0x00, 0x00, 0x00,
+ 0xb0, 0xee, 0x4e, 0xc9, 0x42, 0xe3, 0x01, 0x00,
+ 0x00, 0x04, 0xe4, 0x01, 0x00, 0x00, 0x24, 0x01,
+ 0x00, 0xb9, 0xa7, 0xee, 0x3c, 0xd6, 0xc1, 0x10,
+ 0xad, 0x11, 0xee, 0x12, 0x0e, 0xc9, 0x42, 0xe3,
+ 0x01, 0x00, 0x00, 0x04, 0x05, 0x02, 0x00, 0x00,
+ 0x24, 0x01, 0x00, 0xb9, 0xa7, 0x11, 0xef, 0x18,
+ 0x0e, 0xd6, 0xc1, 0x0a, 0xad, 0xee, 0x1a, 0xc9,
+ 0x42, 0xe3, 0x01, 0x00, 0x00, 0x04, 0x06, 0x02,
+ 0x00, 0x00, 0x24, 0x01, 0x00, 0xb9, 0xa7, 0xee,
+ 0x08, 0x04, 0x07, 0x02, 0x00, 0x00, 0x98, 0x00,
+ 0xc9, 0x28, 0x07, 0x02, 0x30, 0x0e, 0x43, 0x02,
+ 0x03, 0xae, 0x07, 0x02, 0x01, 0x02, 0x05, 0x01,
+ 0x00, 0x4a, 0x00, 0x00, 0x69, 0x01, 0xd6, 0xc1,
+ 0x10, 0xad, 0xee, 0x29, 0xd5, 0xb9, 0xa7, 0xee,
+ 0x0c, 0xd5, 0x90, 0xd9, 0x04, 0x00, 0x02, 0x00,
+ 0x00, 0xcd, 0xf0, 0x03, 0xc5, 0xcd, 0xc9, 0x04,
+ 0x01, 0x02, 0x00, 0x00, 0xd5, 0x42, 0x37, 0x00,
+ 0x00, 0x00, 0xc1, 0x10, 0x24, 0x01, 0x00, 0xa1,
+ 0xa1, 0xcd, 0xf0, 0x0b, 0xd5, 0x42, 0x37, 0x00,
+ 0x00, 0x00, 0x24, 0x00, 0x00, 0xcd, 0xe1, 0x04,
+ 0xe3, 0x00, 0x00, 0x00, 0xaf, 0xee, 0x08, 0x04,
+ 0x08, 0x02, 0x00, 0x00, 0x98, 0x00, 0xc9, 0x28,
+ 0x0e, 0x43, 0x02, 0x03, 0xb0, 0x07, 0x01, 0x02,
+ 0x01, 0x02, 0x09, 0x01, 0x0b, 0x00, 0x00, 0x00,
+ 0x0c, 0x00, 0x08, 0x01, 0x00, 0x02, 0x01, 0x00,
+ 0x00, 0x01, 0x00, 0x6a, 0x01, 0x00, 0x68, 0x01,
+ 0x00, 0x6c, 0x01, 0x00, 0x6b, 0x01, 0x00, 0x01,
+ 0x01, 0xc4, 0x00, 0xce, 0x26, 0x00, 0x00, 0xcd,
+ 0xca, 0xd5, 0xf3, 0x29, 0x0e, 0x43, 0x02, 0x03,
+ 0x92, 0x08, 0x01, 0x06, 0x01, 0x05, 0x0b, 0x00,
+ 0x95, 0x06, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00,
+ 0x01, 0x00, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00,
+ 0x01, 0x01, 0x00, 0x03, 0x00, 0x00, 0x04, 0x00,
+ 0x00, 0x05, 0x00, 0x00, 0x06, 0x00, 0x00, 0x07,
+ 0x00, 0x00, 0x08, 0x00, 0xd5, 0x9b, 0xc8, 0x04,
+ 0x04, 0x49, 0x00, 0x00, 0x00, 0xaf, 0x6c, 0xdd,
+ 0x01, 0x00, 0x00, 0xd5, 0xf7, 0xee, 0x0f, 0x65,
+ 0x00, 0x00, 0x42, 0x67, 0x01, 0x00, 0x00, 0xd5,
+ 0x24, 0x01, 0x00, 0x0e, 0x29, 0xe2, 0x42, 0xe3,
+ 0x01, 0x00, 0x00, 0xd5, 0x24, 0x01, 0x00, 0xb9,
+ 0xaa, 0xee, 0x13, 0x65, 0x00, 0x00, 0x42, 0x67,
+ 0x01, 0x00, 0x00, 0x04, 0x0a, 0x02, 0x00, 0x00,
+ 0x24, 0x01, 0x00, 0x0e, 0x29, 0xe3, 0xee, 0x62,
+ 0xd5, 0x38, 0xe8, 0x00, 0x00, 0x00, 0xab, 0x11,
+ 0xef, 0x40, 0x0e, 0xd5, 0x38, 0x0b, 0x02, 0x00,
+ 0x00, 0xab, 0x11, 0xef, 0x35, 0x0e, 0xd5, 0x38,
+ 0x0c, 0x02, 0x00, 0x00, 0xab, 0x11, 0xef, 0x2a,
+ 0x0e, 0xd5, 0x38, 0x0d, 0x02, 0x00, 0x00, 0xab,
+ 0x11, 0xef, 0x1f, 0x0e, 0xd5, 0x38, 0x0e, 0x02,
+ 0x00, 0x00, 0xab, 0x11, 0xef, 0x14, 0x0e, 0xd5,
+ 0x38, 0x0f, 0x02, 0x00, 0x00, 0xab, 0x11, 0xef,
+ 0x09, 0x0e, 0xd5, 0x38, 0x10, 0x02, 0x00, 0x00,
+ 0xab, 0xee, 0x17, 0x65, 0x00, 0x00, 0x42, 0x67,
+ 0x01, 0x00, 0x00, 0xd5, 0x42, 0x37, 0x00, 0x00,
+ 0x00, 0x24, 0x00, 0x00, 0x24, 0x01, 0x00, 0x0e,
+ 0x29, 0xe2, 0x42, 0x86, 0x01, 0x00, 0x00, 0xd5,
+ 0x24, 0x01, 0x00, 0x0e, 0xe4, 0x42, 0x11, 0x02,
+ 0x00, 0x00, 0xd5, 0x24, 0x01, 0x00, 0x6c, 0x86,
+ 0x00, 0x00, 0x00, 0xd5, 0xed, 0xcd, 0x65, 0x00,
+ 0x00, 0x42, 0x67, 0x01, 0x00, 0x00, 0x04, 0x12,
+ 0x02, 0x00, 0x00, 0x24, 0x01, 0x00, 0x0e, 0xb9,
+ 0xce, 0xca, 0xc9, 0xa7, 0xee, 0x54, 0xca, 0xb9,
+ 0xb0, 0xee, 0x12, 0x65, 0x00, 0x00, 0x42, 0x67,
+ 0x01, 0x00, 0x00, 0x04, 0x13, 0x02, 0x00, 0x00,
+ 0x24, 0x01, 0x00, 0x0e, 0xca, 0xd5, 0xac, 0xee,
+ 0x0b, 0x5e, 0x04, 0x00, 0xd5, 0xca, 0x47, 0xf3,
+ 0x0e, 0xf0, 0x12, 0x65, 0x00, 0x00, 0x42, 0x67,
+ 0x01, 0x00, 0x00, 0x04, 0x14, 0x02, 0x00, 0x00,
+ 0x24, 0x01, 0x00, 0x0e, 0xca, 0xc1, 0x14, 0xa9,
+ 0xee, 0x14, 0x65, 0x00, 0x00, 0x42, 0x67, 0x01,
+ 0x00, 0x00, 0x04, 0x15, 0x02, 0x00, 0x00, 0x24,
+ 0x01, 0x00, 0x0e, 0xf0, 0x05, 0x97, 0x01, 0xf0,
+ 0xa9, 0x65, 0x00, 0x00, 0x42, 0x67, 0x01, 0x00,
+ 0x00, 0x04, 0x16, 0x02, 0x00, 0x00, 0x24, 0x01,
+ 0x00, 0x0e, 0xf1, 0x9d, 0x00, 0x5e, 0x05, 0x00,
+ 0x42, 0x17, 0x02, 0x00, 0x00, 0xd5, 0x24, 0x01,
+ 0x00, 0x04, 0xa2, 0x00, 0x00, 0x00, 0xaf, 0xee,
+ 0x18, 0x65, 0x00, 0x00, 0x42, 0x67, 0x01, 0x00,
+ 0x00, 0xd5, 0x42, 0x37, 0x00, 0x00, 0x00, 0x24,
+ 0x00, 0x00, 0x24, 0x01, 0x00, 0x0e, 0xf0, 0x71,
+ 0x5e, 0x05, 0x00, 0x42, 0x18, 0x02, 0x00, 0x00,
+ 0xd5, 0x24, 0x01, 0x00, 0xd3, 0xed, 0xcd, 0x65,
+ 0x00, 0x00, 0x42, 0x67, 0x01, 0x00, 0x00, 0x04,
+ 0x19, 0x02, 0x00, 0x00, 0x24, 0x01, 0x00, 0x0e,
+ 0xb9, 0xce, 0xca, 0xc9, 0xa7, 0xee, 0x39, 0xca,
+ 0xb9, 0xb0, 0xee, 0x12, 0x65, 0x00, 0x00, 0x42,
+ 0x67, 0x01, 0x00, 0x00, 0x04, 0x13, 0x02, 0x00,
+ 0x00, 0x24, 0x01, 0x00, 0x0e, 0xcb, 0xca, 0x47,
+ 0xd0, 0x65, 0x00, 0x00, 0x42, 0x67, 0x01, 0x00,
+ 0x00, 0xcc, 0x04, 0x1a, 0x02, 0x00, 0x00, 0x24,
+ 0x02, 0x00, 0x0e, 0x5e, 0x04, 0x00, 0xd5, 0xcc,
+ 0x47, 0xf3, 0x0e, 0x97, 0x01, 0xf0, 0xc4, 0x65,
+ 0x00, 0x00, 0x42, 0x67, 0x01, 0x00, 0x00, 0x04,
+ 0x1b, 0x02, 0x00, 0x00, 0x24, 0x01, 0x00, 0x0e,
+ 0xe2, 0x42, 0x1c, 0x02, 0x00, 0x00, 0xd5, 0x24,
+ 0x01, 0x00, 0x0e, 0x29, 0xc6, 0x04, 0x04, 0x48,
+ 0x00, 0x00, 0x00, 0xaf, 0xee, 0x36, 0xd5, 0x42,
+ 0x1d, 0x02, 0x00, 0x00, 0x24, 0x00, 0x00, 0xc8,
+ 0x05, 0xed, 0xc1, 0x4f, 0xa9, 0xee, 0x16, 0xc6,
+ 0x05, 0x42, 0x68, 0x01, 0x00, 0x00, 0xb9, 0xc1,
+ 0x4b, 0x24, 0x02, 0x00, 0x04, 0x1e, 0x02, 0x00,
+ 0x00, 0xa1, 0xc7, 0x05, 0x65, 0x00, 0x00, 0x42,
+ 0x67, 0x01, 0x00, 0x00, 0xc6, 0x05, 0x24, 0x01,
+ 0x00, 0x0e, 0x29, 0xc6, 0x04, 0x04, 0x46, 0x00,
+ 0x00, 0x00, 0xaf, 0xee, 0x1e, 0x65, 0x00, 0x00,
+ 0x42, 0x67, 0x01, 0x00, 0x00, 0x5e, 0x06, 0x00,
+ 0xd5, 0x5e, 0x07, 0x00, 0xee, 0x05, 0xc1, 0x10,
+ 0xf0, 0x03, 0xc1, 0x0a, 0xf4, 0x24, 0x01, 0x00,
+ 0x0e, 0x29, 0xc6, 0x04, 0x04, 0x8a, 0x00, 0x00,
+ 0x00, 0xaf, 0xee, 0x1e, 0x65, 0x00, 0x00, 0x42,
+ 0x67, 0x01, 0x00, 0x00, 0x5e, 0x08, 0x00, 0xd5,
+ 0x5e, 0x07, 0x00, 0xee, 0x05, 0xc1, 0x10, 0xf0,
+ 0x03, 0xc1, 0x0a, 0xf4, 0x24, 0x01, 0x00, 0x0e,
+ 0x29, 0xc6, 0x04, 0x04, 0x8b, 0x00, 0x00, 0x00,
+ 0xaf, 0xee, 0x1e, 0x65, 0x00, 0x00, 0x42, 0x67,
+ 0x01, 0x00, 0x00, 0x5e, 0x09, 0x00, 0xd5, 0x5e,
+ 0x07, 0x00, 0xee, 0x05, 0xc1, 0x10, 0xf0, 0x03,
+ 0xc1, 0x0a, 0xf4, 0x24, 0x01, 0x00, 0x0e, 0x29,
+ 0xc6, 0x04, 0x04, 0x8c, 0x00, 0x00, 0x00, 0xaf,
+ 0xee, 0x1d, 0x65, 0x00, 0x00, 0x42, 0x67, 0x01,
+ 0x00, 0x00, 0xd5, 0x42, 0x37, 0x00, 0x00, 0x00,
+ 0x24, 0x00, 0x00, 0x04, 0x1f, 0x02, 0x00, 0x00,
+ 0xa1, 0x24, 0x01, 0x00, 0x0e, 0x29, 0xc6, 0x04,
+ 0x04, 0x4a, 0x00, 0x00, 0x00, 0xaf, 0xee, 0x13,
+ 0x65, 0x00, 0x00, 0x42, 0x67, 0x01, 0x00, 0x00,
+ 0x5e, 0x0a, 0x00, 0xd5, 0xf3, 0x24, 0x01, 0x00,
+ 0x0e, 0x29, 0xc6, 0x04, 0x04, 0x1b, 0x00, 0x00,
+ 0x00, 0xaf, 0xee, 0x20, 0x65, 0x00, 0x00, 0x42,
+ 0x67, 0x01, 0x00, 0x00, 0x04, 0x20, 0x02, 0x00,
+ 0x00, 0xd5, 0x41, 0x36, 0x00, 0x00, 0x00, 0xa1,
+ 0x04, 0x63, 0x01, 0x00, 0x00, 0xa1, 0x24, 0x01,
+ 0x00, 0x0e, 0x29, 0x65, 0x00, 0x00, 0x42, 0x67,
+ 0x01, 0x00, 0x00, 0xd5, 0x24, 0x01, 0x00, 0x0e,
+ 0x29, 0x0e, 0x43, 0x02, 0x03, 0xb2, 0x07, 0x01,
+ 0x01, 0x01, 0x04, 0x01, 0x00, 0x2c, 0x00, 0x00,
+ 0x2e, 0x01, 0xd5, 0xb9, 0x47, 0x04, 0x21, 0x02,
+ 0x00, 0x00, 0xb0, 0xee, 0x03, 0xc5, 0x28, 0xba,
+ 0xcd, 0xc9, 0xd5, 0xed, 0xa7, 0xee, 0x0d, 0xe1,
+ 0xd5, 0xc9, 0x47, 0xf3, 0x9a, 0xef, 0x05, 0x97,
+ 0x00, 0xf0, 0xef, 0xd5, 0x42, 0x68, 0x01, 0x00,
+ 0x00, 0xba, 0xc9, 0x25, 0x02, 0x00, 0x0e, 0x43,
+ 0x02, 0x03, 0xb4, 0x07, 0x02, 0x04, 0x02, 0x07,
+ 0x0c, 0x00, 0xb2, 0x07, 0x00, 0x00, 0x70, 0x01,
+ 0x00, 0x00, 0x0c, 0x00, 0x68, 0x01, 0x00, 0x17,
+ 0x01, 0x00, 0x09, 0x01, 0x00, 0x0e, 0x01, 0x00,
+ 0x04, 0x01, 0x00, 0x10, 0x01, 0x00, 0x0f, 0x01,
+ 0x00, 0x06, 0x01, 0x00, 0x69, 0x01, 0x00, 0x08,
+ 0x01, 0xd5, 0x04, 0x22, 0x02, 0x00, 0x00, 0xaf,
+ 0x11, 0xef, 0x14, 0x0e, 0xd5, 0x04, 0x23, 0x02,
+ 0x00, 0x00, 0xaf, 0x11, 0xef, 0x09, 0x0e, 0xd5,
+ 0x04, 0xdb, 0x01, 0x00, 0x00, 0xad, 0xee, 0x07,
+ 0xe1, 0xf2, 0x0e, 0xf1, 0x8d, 0x03, 0xd5, 0x04,
+ 0x24, 0x02, 0x00, 0x00, 0xaf, 0xee, 0x4b, 0xd6,
+ 0x42, 0x68, 0x01, 0x00, 0x00, 0xd5, 0xed, 0xba,
+ 0xa1, 0x24, 0x01, 0x00, 0x42, 0x25, 0x02, 0x00,
+ 0x00, 0x24, 0x00, 0x00, 0xd4, 0x42, 0x26, 0x02,
+ 0x00, 0x00, 0x04, 0xe4, 0x01, 0x00, 0x00, 0x24,
+ 0x01, 0x00, 0xcc, 0x42, 0x26, 0x02, 0x00, 0x00,
+ 0x04, 0xe9, 0x01, 0x00, 0x00, 0x24, 0x01, 0x00,
+ 0xa8, 0xee, 0x08, 0x04, 0x27, 0x02, 0x00, 0x00,
+ 0x98, 0x03, 0x65, 0x01, 0x00, 0x42, 0x28, 0x02,
+ 0x00, 0x00, 0xcc, 0x24, 0x01, 0x00, 0x0e, 0x09,
+ 0x28, 0xd5, 0x04, 0x29, 0x02, 0x00, 0x00, 0xaf,
+ 0xee, 0x06, 0x0a, 0xe7, 0xf1, 0x2c, 0x03, 0xd5,
+ 0x04, 0x2a, 0x02, 0x00, 0x00, 0xaf, 0xee, 0x06,
+ 0x09, 0xe7, 0xf1, 0x1e, 0x03, 0xd5, 0x04, 0x2b,
+ 0x02, 0x00, 0x00, 0xaf, 0xee, 0x07, 0xe4, 0x9a,
+ 0xe8, 0xf1, 0x0f, 0x03, 0x5e, 0x04, 0x00, 0x6c,
+ 0x96, 0x01, 0x00, 0x00, 0xd5, 0x04, 0x05, 0x02,
+ 0x00, 0x00, 0xaf, 0x6c, 0x8a, 0x01, 0x00, 0x00,
+ 0xd6, 0x42, 0x68, 0x01, 0x00, 0x00, 0xd5, 0xed,
+ 0xba, 0xa1, 0x24, 0x01, 0x00, 0x42, 0x25, 0x02,
+ 0x00, 0x00, 0x24, 0x00, 0x00, 0x42, 0x5c, 0x00,
+ 0x00, 0x00, 0x04, 0xf8, 0x01, 0x00, 0x00, 0x24,
+ 0x01, 0x00, 0xd1, 0xed, 0xba, 0xaf, 0xee, 0x49,
+ 0xc9, 0xb9, 0x47, 0xc5, 0xaf, 0xee, 0x42, 0x65,
+ 0x01, 0x00, 0x42, 0x67, 0x01, 0x00, 0x00, 0x04,
+ 0x2c, 0x02, 0x00, 0x00, 0x5e, 0x05, 0x00, 0xa1,
+ 0x04, 0x2d, 0x02, 0x00, 0x00, 0xa1, 0x5e, 0x06,
+ 0x00, 0x42, 0xf5, 0x01, 0x00, 0x00, 0x5e, 0x05,
+ 0x00, 0x5e, 0x07, 0x00, 0x9f, 0x24, 0x01, 0x00,
+ 0xa1, 0x04, 0x2e, 0x02, 0x00, 0x00, 0xa1, 0x5e,
+ 0x08, 0x00, 0xa1, 0x04, 0x2f, 0x02, 0x00, 0x00,
+ 0xa1, 0x24, 0x01, 0x00, 0x0e, 0xf1, 0x16, 0x01,
+ 0xc9, 0xb9, 0x47, 0x04, 0x30, 0x02, 0x00, 0x00,
+ 0xaf, 0xee, 0x0d, 0xc1, 0x0b, 0x5f, 0x05, 0x00,
+ 0xbe, 0x5f, 0x08, 0x00, 0xf1, 0xff, 0x00, 0xc9,
+ 0xb9, 0x47, 0x04, 0x31, 0x02, 0x00, 0x00, 0xaf,
+ 0xee, 0x0e, 0xc1, 0x18, 0x5f, 0x05, 0x00, 0xc1,
+ 0x08, 0x5f, 0x08, 0x00, 0xf1, 0xe7, 0x00, 0xc9,
+ 0xb9, 0x47, 0x04, 0x32, 0x02, 0x00, 0x00, 0xaf,
+ 0xee, 0x0e, 0xc1, 0x35, 0x5f, 0x05, 0x00, 0xc1,
+ 0x0b, 0x5f, 0x08, 0x00, 0xf1, 0xcf, 0x00, 0xc9,
+ 0xb9, 0x47, 0x04, 0x33, 0x02, 0x00, 0x00, 0xaf,
+ 0xee, 0x0e, 0xc1, 0x71, 0x5f, 0x05, 0x00, 0xc1,
+ 0x0f, 0x5f, 0x08, 0x00, 0xf1, 0xb7, 0x00, 0x38,
+ 0x34, 0x02, 0x00, 0x00, 0xc9, 0xb9, 0x47, 0xf3,
+ 0xce, 0xc9, 0xed, 0xbb, 0xaa, 0xee, 0x0d, 0x38,
+ 0x34, 0x02, 0x00, 0x00, 0xc9, 0xba, 0x47, 0xf3,
+ 0xcf, 0xf0, 0x0c, 0x38, 0xb3, 0x00, 0x00, 0x00,
+ 0x41, 0x35, 0x02, 0x00, 0x00, 0xcf, 0x38, 0x97,
+ 0x00, 0x00, 0x00, 0x42, 0xeb, 0x01, 0x00, 0x00,
+ 0xca, 0x24, 0x01, 0x00, 0x11, 0xef, 0x1e, 0x0e,
+ 0xca, 0x38, 0xb3, 0x00, 0x00, 0x00, 0x41, 0x36,
+ 0x02, 0x00, 0x00, 0xa7, 0x11, 0xef, 0x0e, 0x0e,
+ 0xca, 0x38, 0xb3, 0x00, 0x00, 0x00, 0x41, 0x37,
+ 0x02, 0x00, 0x00, 0xa9, 0xee, 0x14, 0x65, 0x01,
+ 0x00, 0x42, 0x67, 0x01, 0x00, 0x00, 0x04, 0x38,
+ 0x02, 0x00, 0x00, 0x24, 0x01, 0x00, 0x0e, 0x09,
+ 0x28, 0x38, 0x97, 0x00, 0x00, 0x00, 0x42, 0xeb,
+ 0x01, 0x00, 0x00, 0xcb, 0x24, 0x01, 0x00, 0x11,
+ 0xef, 0x1e, 0x0e, 0xcb, 0x38, 0xb3, 0x00, 0x00,
+ 0x00, 0x41, 0x39, 0x02, 0x00, 0x00, 0xa7, 0x11,
+ 0xef, 0x0e, 0x0e, 0xcb, 0x38, 0xb3, 0x00, 0x00,
+ 0x00, 0x41, 0x35, 0x02, 0x00, 0x00, 0xa9, 0xee,
+ 0x14, 0x65, 0x01, 0x00, 0x42, 0x67, 0x01, 0x00,
+ 0x00, 0x04, 0x3a, 0x02, 0x00, 0x00, 0x24, 0x01,
+ 0x00, 0x0e, 0x09, 0x28, 0xca, 0x5f, 0x05, 0x00,
+ 0xcb, 0x5f, 0x08, 0x00, 0x09, 0x28, 0x5e, 0x04,
+ 0x00, 0xee, 0x78, 0xd5, 0x04, 0x3b, 0x02, 0x00,
+ 0x00, 0xaf, 0xee, 0x6f, 0xd6, 0x42, 0x68, 0x01,
+ 0x00, 0x00, 0xd5, 0xed, 0xba, 0xa1, 0x24, 0x01,
+ 0x00, 0x42, 0x25, 0x02, 0x00, 0x00, 0x24, 0x00,
+ 0x00, 0xcd, 0x5e, 0x06, 0x00, 0x42, 0xf6, 0x01,
+ 0x00, 0x00, 0x5e, 0x09, 0x00, 0xc9, 0xf3, 0x5e,
+ 0x07, 0x00, 0x9e, 0x24, 0x01, 0x00, 0xd2, 0x38,
+ 0xb3, 0x00, 0x00, 0x00, 0x41, 0x36, 0x02, 0x00,
+ 0x00, 0xa7, 0x11, 0xef, 0x0e, 0x0e, 0xca, 0x38,
+ 0xb3, 0x00, 0x00, 0x00, 0x41, 0x37, 0x02, 0x00,
+ 0x00, 0xa9, 0xee, 0x14, 0x65, 0x01, 0x00, 0x42,
+ 0x67, 0x01, 0x00, 0x00, 0x04, 0x38, 0x02, 0x00,
+ 0x00, 0x24, 0x01, 0x00, 0x0e, 0x09, 0x28, 0xca,
+ 0x5f, 0x05, 0x00, 0x38, 0xb3, 0x00, 0x00, 0x00,
+ 0x41, 0x35, 0x02, 0x00, 0x00, 0x5f, 0x08, 0x00,
+ 0x09, 0x28, 0x5e, 0x04, 0x00, 0xee, 0x6e, 0xd5,
+ 0x04, 0x3c, 0x02, 0x00, 0x00, 0xaf, 0xee, 0x65,
+ 0xd6, 0x42, 0x68, 0x01, 0x00, 0x00, 0xd5, 0xed,
+ 0xba, 0xa1, 0x24, 0x01, 0x00, 0x42, 0x25, 0x02,
+ 0x00, 0x00, 0x24, 0x00, 0x00, 0xd1, 0xc5, 0xaf,
+ 0xee, 0x1e, 0x65, 0x01, 0x00, 0x42, 0x67, 0x01,
+ 0x00, 0x00, 0x04, 0x3d, 0x02, 0x00, 0x00, 0x5e,
+ 0x0a, 0x00, 0xa1, 0x04, 0x20, 0x01, 0x00, 0x00,
+ 0xa1, 0x24, 0x01, 0x00, 0x0e, 0xf0, 0x2c, 0xc9,
+ 0x04, 0xe3, 0x00, 0x00, 0x00, 0xaf, 0x11, 0xef,
+ 0x09, 0x0e, 0xc9, 0x04, 0x02, 0x02, 0x00, 0x00,
+ 0xaf, 0xee, 0x07, 0xc9, 0x5f, 0x0a, 0x00, 0xf0,
+ 0x12, 0x65, 0x01, 0x00, 0x42, 0x67, 0x01, 0x00,
+ 0x00, 0x04, 0x3e, 0x02, 0x00, 0x00, 0x24, 0x01,
+ 0x00, 0x0e, 0x09, 0x28, 0xd5, 0x04, 0x3f, 0x02,
+ 0x00, 0x00, 0xaf, 0xee, 0x14, 0x65, 0x01, 0x00,
+ 0x42, 0x67, 0x01, 0x00, 0x00, 0x04, 0x40, 0x02,
+ 0x00, 0x00, 0x24, 0x01, 0x00, 0x0e, 0xf0, 0x6a,
+ 0xd5, 0x04, 0x41, 0x02, 0x00, 0x00, 0xaf, 0xee,
+ 0x10, 0x65, 0x01, 0x00, 0x42, 0xa2, 0x01, 0x00,
+ 0x00, 0xb9, 0x24, 0x01, 0x00, 0x0e, 0xf0, 0x52,
+ 0x5e, 0x0b, 0x00, 0xee, 0x17, 0xd5, 0x04, 0x58,
+ 0x01, 0x00, 0x00, 0xaf, 0xee, 0x0e, 0x36, 0x42,
+ 0x02, 0x00, 0x00, 0x0a, 0x3b, 0x42, 0x02, 0x00,
+ 0x00, 0xf0, 0x37, 0x5e, 0x0b, 0x00, 0xee, 0x17,
+ 0xd5, 0x04, 0x08, 0x02, 0x00, 0x00, 0xaf, 0xee,
+ 0x0e, 0x36, 0x42, 0x02, 0x00, 0x00, 0x09, 0x3b,
+ 0x42, 0x02, 0x00, 0x00, 0xf0, 0x1c, 0x65, 0x01,
+ 0x00, 0x42, 0x67, 0x01, 0x00, 0x00, 0x04, 0x43,
+ 0x02, 0x00, 0x00, 0xd5, 0xa1, 0x04, 0x20, 0x01,
+ 0x00, 0x00, 0xa1, 0x24, 0x01, 0x00, 0x0e, 0x09,
+ 0x28, 0x0a, 0x28, 0x0e, 0x43, 0x02, 0x03, 0x00,
+ 0x01, 0x00, 0x01, 0x03, 0x01, 0x00, 0x46, 0x00,
+ 0x00, 0x68, 0x01, 0xd5, 0x11, 0x04, 0x44, 0x02,
+ 0x00, 0x00, 0xaf, 0xee, 0x05, 0x09, 0xe5, 0xf0,
+ 0x38, 0x11, 0x04, 0x45, 0x02, 0x00, 0x00, 0xaf,
+ 0xee, 0x05, 0x0a, 0xe5, 0xf0, 0x2b, 0x11, 0x04,
+ 0x46, 0x02, 0x00, 0x00, 0xaf, 0xee, 0x0e, 0x36,
+ 0x42, 0x02, 0x00, 0x00, 0x09, 0x3b, 0x42, 0x02,
+ 0x00, 0x00, 0xf0, 0x15, 0x11, 0x04, 0x47, 0x02,
+ 0x00, 0x00, 0xaf, 0xee, 0x0c, 0x36, 0x42, 0x02,
+ 0x00, 0x00, 0x0a, 0x3b, 0x42, 0x02, 0x00, 0x00,
+ 0x29, 0x0e, 0x43, 0x02, 0x03, 0xb6, 0x07, 0x00,
+ 0x01, 0x00, 0x05, 0x07, 0x01, 0xd5, 0x01, 0x00,
+ 0x00, 0x00, 0x0c, 0x00, 0x68, 0x01, 0x00, 0x17,
+ 0x01, 0x00, 0x08, 0x01, 0x00, 0x09, 0x01, 0x00,
+ 0x69, 0x01, 0x00, 0x07, 0x01, 0xc4, 0x00, 0xcd,
+ 0x65, 0x00, 0x00, 0x42, 0x67, 0x01, 0x00, 0x00,
+ 0x04, 0x48, 0x02, 0x00, 0x00, 0x04, 0x49, 0x02,
+ 0x00, 0x00, 0xa1, 0xc9, 0xe2, 0xf3, 0xa1, 0x04,
+ 0x4a, 0x02, 0x00, 0x00, 0xa1, 0x04, 0x4b, 0x02,
+ 0x00, 0x00, 0xa1, 0xc9, 0xe2, 0x9a, 0xf3, 0xa1,
+ 0x04, 0x4c, 0x02, 0x00, 0x00, 0xa1, 0x04, 0x4d,
+ 0x02, 0x00, 0x00, 0xa1, 0xc9, 0xe3, 0xf3, 0xa1,
+ 0x04, 0x4e, 0x02, 0x00, 0x00, 0xa1, 0x04, 0x4f,
+ 0x02, 0x00, 0x00, 0xa1, 0x24, 0x01, 0x00, 0x0e,
+ 0xe4, 0xee, 0x35, 0x65, 0x00, 0x00, 0x42, 0x67,
+ 0x01, 0x00, 0x00, 0x04, 0x50, 0x02, 0x00, 0x00,
+ 0xc9, 0x38, 0x42, 0x02, 0x00, 0x00, 0xf3, 0xa1,
+ 0x04, 0x51, 0x02, 0x00, 0x00, 0xa1, 0x04, 0x52,
+ 0x02, 0x00, 0x00, 0xa1, 0xc9, 0x38, 0x42, 0x02,
+ 0x00, 0x00, 0x9a, 0xf3, 0xa1, 0x04, 0x53, 0x02,
+ 0x00, 0x00, 0xa1, 0x24, 0x01, 0x00, 0x0e, 0x5e,
+ 0x04, 0x00, 0xee, 0x37, 0x65, 0x00, 0x00, 0x42,
+ 0x67, 0x01, 0x00, 0x00, 0x04, 0x54, 0x02, 0x00,
+ 0x00, 0x04, 0x55, 0x02, 0x00, 0x00, 0xa1, 0x24,
+ 0x01, 0x00, 0x0e, 0xe4, 0x9a, 0xee, 0x1c, 0x65,
+ 0x00, 0x00, 0x42, 0x67, 0x01, 0x00, 0x00, 0x04,
+ 0x56, 0x02, 0x00, 0x00, 0x5e, 0x05, 0x00, 0xa1,
+ 0x04, 0x57, 0x02, 0x00, 0x00, 0xa1, 0x24, 0x01,
+ 0x00, 0x0e, 0x5e, 0x06, 0x00, 0x9a, 0xee, 0x12,
+ 0x65, 0x00, 0x00, 0x42, 0x67, 0x01, 0x00, 0x00,
+ 0x04, 0x58, 0x02, 0x00, 0x00, 0x24, 0x01, 0x00,
+ 0x0e, 0x29, 0x0e, 0x43, 0x02, 0x03, 0xb2, 0x09,
+ 0x01, 0x00, 0x01, 0x01, 0x00, 0x00, 0x0f, 0x00,
+ 0xd5, 0xee, 0x07, 0x04, 0x7c, 0x00, 0x00, 0x00,
+ 0x28, 0x04, 0xf8, 0x01, 0x00, 0x00, 0x28, 0x0e,
+ 0x43, 0x02, 0x03, 0xb8, 0x07, 0x01, 0x03, 0x01,
+ 0x06, 0x08, 0x00, 0x9f, 0x02, 0x00, 0x00, 0x69,
+ 0x01, 0x00, 0x03, 0x01, 0x00, 0x00, 0x0c, 0x00,
+ 0x19, 0x01, 0x00, 0x0a, 0x01, 0x00, 0x0b, 0x01,
+ 0x00, 0x6d, 0x01, 0x00, 0x00, 0x03, 0x6f, 0x95,
+ 0x00, 0x00, 0x00, 0xe1, 0x04, 0x02, 0x02, 0x00,
+ 0x00, 0xaf, 0xee, 0x09, 0x04, 0x5a, 0x02, 0x00,
+ 0x00, 0xd5, 0xa1, 0xd9, 0xe2, 0x11, 0x21, 0x00,
+ 0x00, 0x42, 0x5b, 0x02, 0x00, 0x00, 0x24, 0x00,
+ 0x00, 0xce, 0x65, 0x02, 0x00, 0x42, 0x5c, 0x02,
+ 0x00, 0x00, 0xd5, 0x0b, 0x0a, 0x4c, 0x5d, 0x02,
+ 0x00, 0x00, 0x24, 0x02, 0x00, 0xcd, 0xe2, 0x11,
+ 0x21, 0x00, 0x00, 0x42, 0x5b, 0x02, 0x00, 0x00,
+ 0x24, 0x00, 0x00, 0xca, 0xa2, 0xe8, 0x65, 0x02,
+ 0x00, 0x42, 0x67, 0x01, 0x00, 0x00, 0x5e, 0x04,
+ 0x00, 0x5e, 0x05, 0x00, 0x41, 0x12, 0x01, 0x00,
+ 0x00, 0x47, 0x24, 0x01, 0x00, 0x0e, 0x5e, 0x06,
+ 0x00, 0xc9, 0xf3, 0x0e, 0x65, 0x02, 0x00, 0x42,
+ 0x67, 0x01, 0x00, 0x00, 0x04, 0x20, 0x01, 0x00,
+ 0x00, 0x24, 0x01, 0x00, 0x0e, 0x65, 0x02, 0x00,
+ 0x42, 0x67, 0x01, 0x00, 0x00, 0x5e, 0x04, 0x00,
+ 0x41, 0xea, 0x00, 0x00, 0x00, 0x24, 0x01, 0x00,
+ 0x0e, 0x5e, 0x07, 0x00, 0xc9, 0x43, 0x5c, 0x01,
+ 0x00, 0x00, 0x0e, 0x29, 0xcf, 0x6f, 0x86, 0x00,
+ 0x00, 0x00, 0x65, 0x02, 0x00, 0x42, 0x67, 0x01,
+ 0x00, 0x00, 0x5e, 0x04, 0x00, 0x5e, 0x05, 0x00,
+ 0x41, 0x13, 0x01, 0x00, 0x00, 0x47, 0x24, 0x01,
+ 0x00, 0x0e, 0xcb, 0x38, 0x96, 0x00, 0x00, 0x00,
+ 0xab, 0xee, 0x2c, 0x38, 0x5e, 0x02, 0x00, 0x00,
+ 0x42, 0x5f, 0x02, 0x00, 0x00, 0xcb, 0x24, 0x01,
+ 0x00, 0x0e, 0xcb, 0x41, 0x35, 0x00, 0x00, 0x00,
+ 0xee, 0x35, 0x65, 0x02, 0x00, 0x42, 0x67, 0x01,
+ 0x00, 0x00, 0xcb, 0x41, 0x35, 0x00, 0x00, 0x00,
+ 0x24, 0x01, 0x00, 0x0e, 0xf0, 0x21, 0x65, 0x02,
+ 0x00, 0x42, 0x67, 0x01, 0x00, 0x00, 0x04, 0x60,
+ 0x02, 0x00, 0x00, 0x24, 0x01, 0x00, 0x0e, 0x38,
+ 0x5e, 0x02, 0x00, 0x00, 0x42, 0x5f, 0x02, 0x00,
+ 0x00, 0xcb, 0x24, 0x01, 0x00, 0x0e, 0x65, 0x02,
+ 0x00, 0x42, 0x67, 0x01, 0x00, 0x00, 0x5e, 0x04,
+ 0x00, 0x41, 0xea, 0x00, 0x00, 0x00, 0x24, 0x01,
+ 0x00, 0x0e, 0x0e, 0x29, 0x2f, 0x0e, 0x43, 0x02,
+ 0x03, 0xba, 0x07, 0x00, 0x00, 0x00, 0x04, 0x0b,
+ 0x00, 0x6e, 0x00, 0xda, 0x06, 0x07, 0x01, 0xdc,
+ 0x06, 0x08, 0x01, 0xc6, 0x03, 0x00, 0x0c, 0xde,
+ 0x06, 0x09, 0x01, 0xe8, 0x06, 0x10, 0x01, 0xb8,
+ 0x02, 0x04, 0x01, 0xe4, 0x06, 0x0e, 0x01, 0xe6,
+ 0x06, 0x0f, 0x01, 0xa8, 0x07, 0x69, 0x01, 0xd8,
+ 0x06, 0x00, 0x03, 0xbc, 0x07, 0x73, 0x01, 0xe1,
+ 0x9a, 0xee, 0x28, 0xe2, 0xee, 0x14, 0x65, 0x02,
+ 0x00, 0x42, 0x67, 0x01, 0x00, 0x00, 0x04, 0x61,
+ 0x02, 0x00, 0x00, 0x24, 0x01, 0x00, 0x0e, 0xf0,
+ 0x12, 0x65, 0x02, 0x00, 0x42, 0x67, 0x01, 0x00,
+ 0x00, 0x04, 0x62, 0x02, 0x00, 0x00, 0x24, 0x01,
+ 0x00, 0x0e, 0xe4, 0xee, 0x3c, 0x5e, 0x05, 0x00,
+ 0x42, 0x5f, 0x02, 0x00, 0x00, 0xc1, 0x0a, 0x24,
+ 0x01, 0x00, 0x5e, 0x05, 0x00, 0x42, 0x5f, 0x02,
+ 0x00, 0x00, 0xbb, 0x24, 0x01, 0x00, 0x9f, 0x5f,
+ 0x04, 0x00, 0xc1, 0x71, 0x5f, 0x06, 0x00, 0xc1,
+ 0x0f, 0x5f, 0x07, 0x00, 0xe2, 0xee, 0x12, 0x04,
+ 0x02, 0x02, 0x00, 0x00, 0x5f, 0x08, 0x00, 0x5e,
+ 0x09, 0x00, 0xe1, 0x43, 0x42, 0x02, 0x00, 0x00,
+ 0x5e, 0x0a, 0x00, 0xf2, 0x29, 0x0e, 0x43, 0x02,
+ 0x03, 0xbc, 0x07, 0x00, 0x00, 0x00, 0x04, 0x04,
+ 0x00, 0x0c, 0x00, 0xa0, 0x07, 0x65, 0x01, 0x98,
+ 0x07, 0x60, 0x01, 0xfe, 0x06, 0x1b, 0x01, 0xbe,
+ 0x07, 0x74, 0x01, 0xe1, 0xe2, 0x04, 0x63, 0x02,
+ 0x00, 0x00, 0xe3, 0xf4, 0xe4, 0xf4, 0x29, 0x0e,
+ 0x43, 0x02, 0x03, 0xbe, 0x07, 0x01, 0x00, 0x01,
+ 0x02, 0x02, 0x00, 0x07, 0x00, 0x00, 0x75, 0x01,
+ 0x00, 0x73, 0x01, 0xe1, 0xd5, 0xf3, 0x0e, 0xe2,
+ 0xf2, 0x29, 0x0e, 0x43, 0x02, 0x03, 0xc0, 0x07,
+ 0x01, 0x02, 0x01, 0x06, 0x0c, 0x00, 0x9e, 0x01,
+ 0x00, 0x00, 0x70, 0x01, 0x00, 0x6e, 0x01, 0x00,
+ 0x6f, 0x01, 0x00, 0x1a, 0x01, 0x00, 0x76, 0x01,
+ 0x00, 0x11, 0x01, 0x00, 0x1b, 0x01, 0x00, 0x09,
+ 0x01, 0x00, 0x71, 0x01, 0x00, 0x0e, 0x01, 0x00,
+ 0x0f, 0x01, 0x00, 0x00, 0x0c, 0xd5, 0xf7, 0xee,
+ 0x04, 0xc5, 0xd9, 0x29, 0xd5, 0x04, 0x23, 0x02,
+ 0x00, 0x00, 0xaf, 0xee, 0x04, 0xe1, 0xf2, 0x29,
+ 0xe2, 0xd5, 0xf3, 0xd2, 0xed, 0xb9, 0xa9, 0xee,
+ 0x17, 0xe3, 0xca, 0xd5, 0xf4, 0x9a, 0xee, 0x02,
+ 0x29, 0xd5, 0x42, 0x68, 0x01, 0x00, 0x00, 0xca,
+ 0xed, 0xba, 0xa1, 0x24, 0x01, 0x00, 0xd9, 0xd5,
+ 0xc5, 0xaf, 0xee, 0x02, 0x29, 0xe4, 0xee, 0x0b,
+ 0xe4, 0x04, 0x20, 0x01, 0x00, 0x00, 0xa1, 0xd5,
+ 0xa1, 0xd9, 0x5e, 0x04, 0x00, 0xd5, 0xf3, 0xd1,
+ 0xb9, 0x47, 0x5f, 0x05, 0x00, 0xc9, 0xba, 0x47,
+ 0x5f, 0x06, 0x00, 0x5e, 0x05, 0x00, 0xee, 0x04,
+ 0xd5, 0xe8, 0x29, 0xc5, 0xe8, 0x5e, 0x07, 0x00,
+ 0xee, 0x24, 0x38, 0xb3, 0x00, 0x00, 0x00, 0x42,
+ 0x64, 0x02, 0x00, 0x00, 0x5e, 0x08, 0x00, 0x42,
+ 0x65, 0x02, 0x00, 0x00, 0x07, 0xd5, 0x24, 0x02,
+ 0x00, 0x5e, 0x09, 0x00, 0x5e, 0x0a, 0x00, 0x24,
+ 0x03, 0x00, 0x0e, 0xf0, 0x07, 0x5e, 0x08, 0x00,
+ 0xd5, 0xf3, 0x0e, 0xb9, 0x5f, 0x06, 0x00, 0x65,
+ 0x0b, 0x00, 0x42, 0x66, 0x02, 0x00, 0x00, 0x24,
+ 0x00, 0x00, 0x29, 0x0e, 0x43, 0x02, 0x03, 0xc2,
+ 0x07, 0x01, 0x17, 0x01, 0x04, 0x03, 0x0a, 0x8f,
+ 0x04, 0x00, 0x00, 0x30, 0x01, 0x00, 0x33, 0x01,
+ 0x00, 0x2f, 0x01, 0xc4, 0x00, 0xc7, 0x0a, 0xc4,
+ 0x01, 0xc7, 0x0b, 0xc4, 0x02, 0xc7, 0x0c, 0xc4,
+ 0x03, 0xc7, 0x0d, 0xc4, 0x04, 0xc7, 0x0e, 0xc4,
+ 0x05, 0xc7, 0x0f, 0xc4, 0x06, 0xc7, 0x10, 0xc4,
+ 0x07, 0xc7, 0x11, 0xc4, 0x08, 0xc7, 0x15, 0xc4,
+ 0x09, 0xc7, 0x16, 0xd5, 0xed, 0xd0, 0xc5, 0xc7,
+ 0x05, 0xb9, 0xc7, 0x06, 0xba, 0xc7, 0x08, 0x26,
+ 0x00, 0x00, 0xc7, 0x09, 0x04, 0x67, 0x02, 0x00,
+ 0x00, 0x04, 0x68, 0x02, 0x00, 0x00, 0xa1, 0x04,
+ 0x69, 0x02, 0x00, 0x00, 0xa1, 0x04, 0x6a, 0x02,
+ 0x00, 0x00, 0xa1, 0x04, 0x6b, 0x02, 0x00, 0x00,
+ 0xa1, 0x04, 0x6c, 0x02, 0x00, 0x00, 0xa1, 0x04,
+ 0x6d, 0x02, 0x00, 0x00, 0xa1, 0x04, 0x6e, 0x02,
+ 0x00, 0x00, 0xa1, 0x04, 0x6f, 0x02, 0x00, 0x00,
+ 0xa1, 0x04, 0x70, 0x02, 0x00, 0x00, 0xa1, 0xc7,
+ 0x12, 0x04, 0x71, 0x02, 0x00, 0x00, 0xc7, 0x13,
+ 0x04, 0x72, 0x02, 0x00, 0x00, 0xc7, 0x14, 0xb9,
+ 0xcd, 0xc9, 0xcc, 0xa7, 0x6c, 0x75, 0x01, 0x00,
+ 0x00, 0x07, 0xc7, 0x04, 0xc9, 0xcf, 0xd5, 0xc9,
+ 0x95, 0xcd, 0x47, 0xd2, 0x11, 0x04, 0xf8, 0x01,
+ 0x00, 0x00, 0xaf, 0xef, 0x1c, 0x11, 0x04, 0x1f,
+ 0x01, 0x00, 0x00, 0xaf, 0xef, 0x13, 0x11, 0x04,
+ 0x22, 0x01, 0x00, 0x00, 0xaf, 0xef, 0x0a, 0x11,
+ 0x04, 0x20, 0x01, 0x00, 0x00, 0xaf, 0xee, 0x04,
+ 0x0e, 0xf0, 0xc7, 0x11, 0x04, 0x73, 0x02, 0x00,
+ 0x00, 0xaf, 0xef, 0x0a, 0x11, 0x04, 0x00, 0x02,
+ 0x00, 0x00, 0xaf, 0xee, 0x18, 0xc9, 0xcc, 0xa7,
+ 0xee, 0x0d, 0xd5, 0xc9, 0x47, 0xca, 0xad, 0xee,
+ 0x06, 0x97, 0x00, 0x0e, 0xf0, 0xa4, 0xba, 0xc7,
+ 0x08, 0x0e, 0xf0, 0x9e, 0x11, 0x04, 0xe9, 0x01,
+ 0x00, 0x00, 0xaf, 0xee, 0x44, 0xc9, 0xcc, 0xa7,
+ 0xee, 0x13, 0xd5, 0xc9, 0x47, 0x04, 0x7c, 0x00,
+ 0x00, 0x00, 0xad, 0xee, 0x08, 0xc6, 0x0d, 0xf2,
+ 0x0e, 0xf1, 0xe7, 0x00, 0xc9, 0xcc, 0xa7, 0xee,
+ 0x13, 0xd5, 0xc9, 0x47, 0x04, 0xe9, 0x01, 0x00,
+ 0x00, 0xad, 0xee, 0x08, 0xc6, 0x0e, 0xf2, 0x0e,
+ 0xf1, 0xd0, 0x00, 0xc6, 0x08, 0xee, 0x0b, 0xc6,
+ 0x10, 0xf2, 0x0e, 0xb9, 0xc7, 0x08, 0xf1, 0xc2,
+ 0x00, 0xba, 0xc7, 0x08, 0x0e, 0xf1, 0x53, 0xff,
+ 0x11, 0x04, 0xe5, 0x01, 0x00, 0x00, 0xaf, 0xef,
+ 0x13, 0x11, 0x04, 0xe6, 0x01, 0x00, 0x00, 0xaf,
+ 0xef, 0x0a, 0x11, 0x04, 0x74, 0x02, 0x00, 0x00,
+ 0xaf, 0xee, 0x0c, 0xc6, 0x0f, 0xca, 0xf3, 0x0e,
+ 0xb9, 0xc7, 0x08, 0xf1, 0x95, 0x00, 0x11, 0x04,
+ 0xf2, 0x01, 0x00, 0x00, 0xaf, 0xef, 0x13, 0x11,
+ 0x04, 0xfc, 0x01, 0x00, 0x00, 0xaf, 0xef, 0x0a,
+ 0x11, 0x04, 0x75, 0x02, 0x00, 0x00, 0xaf, 0xee,
+ 0x0f, 0xba, 0xc7, 0x08, 0x97, 0x06, 0xc6, 0x0a,
+ 0xca, 0xf3, 0x0e, 0x0e, 0xf1, 0x04, 0xff, 0x11,
+ 0x04, 0xf3, 0x01, 0x00, 0x00, 0xaf, 0xef, 0x13,
+ 0x11, 0x04, 0xe7, 0x01, 0x00, 0x00, 0xaf, 0xef,
+ 0x0a, 0x11, 0x04, 0xe8, 0x01, 0x00, 0x00, 0xaf,
+ 0xee, 0x25, 0xb9, 0xc7, 0x08, 0xc6, 0x06, 0xb9,
+ 0xa9, 0xee, 0x13, 0xe2, 0xc6, 0x0b, 0xf2, 0xca,
+ 0xf4, 0xee, 0x0b, 0x96, 0x06, 0xc6, 0x0c, 0xf2,
+ 0x0e, 0x0e, 0xf1, 0xce, 0xfe, 0x04, 0x11, 0x01,
+ 0x00, 0x00, 0xc7, 0x04, 0xf0, 0x2c, 0xe3, 0xca,
+ 0xf3, 0xee, 0x0a, 0xc6, 0x11, 0xf2, 0x0e, 0xb9,
+ 0xc7, 0x08, 0xf0, 0x1e, 0xe1, 0xca, 0xf3, 0x11,
+ 0xef, 0x09, 0x0e, 0xca, 0x04, 0x5d, 0x01, 0x00,
+ 0x00, 0xad, 0xee, 0x07, 0xc6, 0x15, 0xf2, 0x0e,
+ 0xf0, 0x08, 0xba, 0xc7, 0x08, 0x0e, 0xf1, 0x9a,
+ 0xfe, 0x0e, 0xc6, 0x04, 0x6c, 0x94, 0xfe, 0xff,
+ 0xff, 0xc6, 0x16, 0xcb, 0xc9, 0xf4, 0x0e, 0xf1,
+ 0x89, 0xfe, 0xc6, 0x16, 0xcc, 0xcc, 0xf4, 0x0e,
+ 0xc6, 0x05, 0xc6, 0x06, 0xc6, 0x09, 0x26, 0x03,
+ 0x00, 0x28, 0x0e, 0x43, 0x02, 0x03, 0xec, 0x09,
+ 0x01, 0x00, 0x01, 0x02, 0x01, 0x00, 0x05, 0x00,
+ 0x00, 0x05, 0x01, 0xe1, 0xd5, 0xa1, 0xe5, 0x29,
+ 0x0e, 0x43, 0x02, 0x03, 0xee, 0x09, 0x01, 0x00,
+ 0x01, 0x04, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x05,
+ 0x01, 0xe1, 0x42, 0x68, 0x01, 0x00, 0x00, 0xe1,
+ 0xed, 0xba, 0xa2, 0x25, 0x01, 0x00, 0x0e, 0x43,
+ 0x02, 0x03, 0xf0, 0x09, 0x01, 0x00, 0x01, 0x05,
+ 0x02, 0x00, 0x14, 0x00, 0x00, 0x0b, 0x01, 0x00,
+ 0x05, 0x01, 0xe1, 0xf2, 0xd9, 0xe2, 0x42, 0x68,
+ 0x01, 0x00, 0x00, 0xb9, 0xe2, 0xed, 0xba, 0xa2,
+ 0x24, 0x02, 0x00, 0xe6, 0xd5, 0x28, 0x0e, 0x43,
+ 0x02, 0x03, 0xf2, 0x09, 0x00, 0x00, 0x00, 0x03,
+ 0x06, 0x00, 0x49, 0x00, 0xf4, 0x09, 0x04, 0x01,
+ 0xec, 0x09, 0x0a, 0x01, 0xf6, 0x09, 0x00, 0x01,
+ 0x90, 0x08, 0x03, 0x01, 0xf8, 0x09, 0x00, 0x03,
+ 0xf0, 0x09, 0x0c, 0x01, 0x04, 0x0c, 0x01, 0x00,
+ 0x00, 0xe5, 0xe2, 0x04, 0xe9, 0x01, 0x00, 0x00,
+ 0xf3, 0x0e, 0xe3, 0x93, 0xe7, 0xe3, 0xe4, 0xba,
+ 0xa2, 0xa7, 0xee, 0x31, 0x5e, 0x04, 0x00, 0xe3,
+ 0x47, 0x04, 0x7c, 0x00, 0x00, 0x00, 0xad, 0xee,
+ 0x1f, 0x5e, 0x04, 0x00, 0xe3, 0xba, 0xa1, 0x47,
+ 0x04, 0xe9, 0x01, 0x00, 0x00, 0xad, 0xee, 0x10,
+ 0xe3, 0xbb, 0xa1, 0xe7, 0x5e, 0x05, 0x00, 0x04,
+ 0xe9, 0x01, 0x00, 0x00, 0xf3, 0x0e, 0x29, 0xe3,
+ 0x93, 0xe7, 0xf0, 0xca, 0x29, 0x0e, 0x43, 0x02,
+ 0x03, 0xfa, 0x09, 0x00, 0x00, 0x00, 0x02, 0x04,
+ 0x00, 0x1f, 0x00, 0xf4, 0x09, 0x04, 0x01, 0xf6,
+ 0x09, 0x00, 0x01, 0x90, 0x08, 0x03, 0x01, 0xf8,
+ 0x09, 0x00, 0x03, 0x04, 0x0c, 0x01, 0x00, 0x00,
+ 0xe5, 0xe2, 0x93, 0xe6, 0xe2, 0xe3, 0xa7, 0xee,
+ 0x11, 0xe4, 0xe2, 0x47, 0x04, 0x20, 0x01, 0x00,
+ 0x00, 0xad, 0xef, 0x06, 0xe2, 0x93, 0xe6, 0xf0,
+ 0xec, 0x29, 0x0e, 0x43, 0x02, 0x03, 0xfc, 0x09,
+ 0x01, 0x00, 0x01, 0x03, 0x07, 0x00, 0x4c, 0x00,
+ 0x00, 0x04, 0x01, 0x00, 0x0a, 0x01, 0x00, 0x00,
+ 0x01, 0x00, 0x03, 0x01, 0x00, 0x01, 0x01, 0x00,
+ 0x00, 0x03, 0x00, 0x0c, 0x01, 0x04, 0x48, 0x00,
+ 0x00, 0x00, 0xe5, 0xe2, 0xd5, 0xf3, 0x0e, 0xe3,
+ 0xe4, 0xa7, 0xee, 0x3d, 0x5e, 0x05, 0x00, 0xe3,
+ 0x95, 0xe7, 0x47, 0x60, 0x04, 0x00, 0x04, 0x20,
+ 0x01, 0x00, 0x00, 0xad, 0xee, 0x09, 0x04, 0x11,
+ 0x01, 0x00, 0x00, 0xe5, 0xf0, 0xe2, 0x5e, 0x04,
+ 0x00, 0x04, 0x21, 0x02, 0x00, 0x00, 0xad, 0xee,
+ 0x0b, 0xe3, 0xe4, 0xaa, 0xef, 0x13, 0xe3, 0x93,
+ 0xe7, 0xf0, 0xcd, 0x5e, 0x04, 0x00, 0xd5, 0xad,
+ 0xee, 0xc6, 0x5e, 0x06, 0x00, 0xf2, 0x0e, 0x29,
+ 0x29, 0x0e, 0x43, 0x02, 0x03, 0xfe, 0x09, 0x00,
+ 0x00, 0x00, 0x03, 0x09, 0x00, 0xc4, 0x01, 0x00,
+ 0xf4, 0x09, 0x04, 0x01, 0xec, 0x09, 0x0a, 0x01,
+ 0xf6, 0x09, 0x00, 0x01, 0x90, 0x08, 0x03, 0x01,
+ 0xd6, 0x06, 0x01, 0x01, 0xf8, 0x09, 0x00, 0x03,
+ 0xee, 0x09, 0x0b, 0x01, 0xf0, 0x09, 0x0c, 0x01,
+ 0xb6, 0x05, 0x00, 0x00, 0x04, 0x0d, 0x01, 0x00,
+ 0x00, 0xe5, 0xe2, 0x04, 0xe9, 0x01, 0x00, 0x00,
+ 0xf3, 0x0e, 0xe3, 0xe4, 0xa7, 0x6c, 0xb1, 0x00,
+ 0x00, 0x00, 0x5e, 0x05, 0x00, 0xe3, 0x95, 0xe7,
+ 0x47, 0x60, 0x04, 0x00, 0x04, 0x20, 0x01, 0x00,
+ 0x00, 0xad, 0xee, 0x09, 0x04, 0x11, 0x01, 0x00,
+ 0x00, 0xe5, 0xf0, 0xdf, 0x5e, 0x04, 0x00, 0x04,
+ 0x21, 0x02, 0x00, 0x00, 0xad, 0xee, 0x0b, 0xe3,
+ 0xe4, 0xa7, 0xee, 0xcf, 0xe3, 0x93, 0xe7, 0xf0,
+ 0xca, 0x5e, 0x06, 0x00, 0xf2, 0x04, 0xfc, 0x01,
+ 0x00, 0x00, 0xad, 0xee, 0x13, 0x5e, 0x04, 0x00,
+ 0x04, 0xe7, 0x01, 0x00, 0x00, 0xad, 0xee, 0xb3,
+ 0x5e, 0x07, 0x00, 0xf2, 0x0e, 0xf0, 0xac, 0x5e,
+ 0x04, 0x00, 0x04, 0xfc, 0x01, 0x00, 0x00, 0xad,
+ 0xee, 0x2e, 0xe2, 0x04, 0xfc, 0x01, 0x00, 0x00,
+ 0xf3, 0x0e, 0x5e, 0x05, 0x00, 0xe3, 0x47, 0x04,
+ 0xfc, 0x01, 0x00, 0x00, 0xad, 0x11, 0xef, 0x0d,
+ 0x0e, 0x5e, 0x05, 0x00, 0xe3, 0x47, 0x04, 0xe7,
+ 0x01, 0x00, 0x00, 0xad, 0x6c, 0x7d, 0xff, 0xff,
+ 0xff, 0xe3, 0x93, 0xe7, 0xf1, 0x75, 0xff, 0x5e,
+ 0x04, 0x00, 0x04, 0xe9, 0x01, 0x00, 0x00, 0xad,
+ 0x6c, 0x69, 0xff, 0xff, 0xff, 0x5e, 0x07, 0x00,
+ 0xf2, 0x0e, 0xe3, 0xe4, 0xa7, 0xee, 0x11, 0x5e,
+ 0x08, 0x00, 0x5e, 0x05, 0x00, 0xe3, 0x47, 0xf3,
+ 0xee, 0x06, 0xe3, 0x93, 0xe7, 0xf0, 0xec, 0x29,
+ 0x0e, 0x43, 0x02, 0x03, 0x80, 0x0a, 0x00, 0x00,
+ 0x00, 0x03, 0x05, 0x00, 0x41, 0x00, 0xf4, 0x09,
+ 0x04, 0x01, 0xf6, 0x09, 0x00, 0x01, 0x90, 0x08,
+ 0x03, 0x01, 0xb6, 0x05, 0x00, 0x00, 0xf8, 0x09,
+ 0x00, 0x03, 0x04, 0x46, 0x00, 0x00, 0x00, 0xe5,
+ 0xe2, 0xe3, 0xa7, 0xee, 0x36, 0xe4, 0x5e, 0x04,
+ 0x00, 0xe2, 0x47, 0xf3, 0x11, 0xef, 0x25, 0x0e,
+ 0x5e, 0x04, 0x00, 0xe2, 0x47, 0x04, 0xe4, 0x01,
+ 0x00, 0x00, 0xad, 0xee, 0x1e, 0xe2, 0xe3, 0xba,
+ 0xa2, 0xad, 0x11, 0xef, 0x0f, 0x0e, 0x5e, 0x04,
+ 0x00, 0xe2, 0xba, 0xa1, 0x47, 0x04, 0xe4, 0x01,
+ 0x00, 0x00, 0xae, 0xee, 0x06, 0xe2, 0x93, 0xe6,
+ 0xf0, 0xc7, 0x29, 0x0e, 0x43, 0x02, 0x03, 0x82,
+ 0x0a, 0x00, 0x02, 0x00, 0x05, 0x0a, 0x00, 0xb3,
+ 0x01, 0x00, 0x00, 0x08, 0x01, 0x00, 0x00, 0x01,
+ 0x00, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+ 0x03, 0x00, 0x02, 0x01, 0x00, 0x12, 0x01, 0x00,
+ 0x04, 0x01, 0x00, 0x13, 0x01, 0x00, 0x14, 0x01,
+ 0xba, 0xe5, 0xe2, 0xe3, 0xa7, 0xee, 0x0f, 0xe4,
+ 0x5e, 0x04, 0x00, 0xe2, 0x47, 0xf3, 0xee, 0x06,
+ 0xe2, 0x93, 0xe6, 0xf0, 0xee, 0x04, 0x67, 0x02,
+ 0x00, 0x00, 0x5e, 0x04, 0x00, 0x42, 0x68, 0x01,
+ 0x00, 0x00, 0x5e, 0x05, 0x00, 0xe2, 0x24, 0x02,
+ 0x00, 0xa1, 0x04, 0x67, 0x02, 0x00, 0x00, 0xa1,
+ 0xcd, 0x5e, 0x06, 0x00, 0x42, 0xe3, 0x01, 0x00,
+ 0x00, 0xc9, 0x24, 0x01, 0x00, 0xb9, 0xaa, 0xee,
+ 0x1c, 0x04, 0x0e, 0x01, 0x00, 0x00, 0x5f, 0x07,
+ 0x00, 0x5e, 0x08, 0x00, 0x42, 0xe3, 0x01, 0x00,
+ 0x00, 0xc9, 0x24, 0x01, 0x00, 0xb9, 0xaa, 0xee,
+ 0x03, 0xb9, 0xe5, 0x29, 0xe2, 0xce, 0xca, 0xe3,
+ 0xa7, 0xee, 0x12, 0x5e, 0x04, 0x00, 0xca, 0x47,
+ 0x04, 0xf8, 0x01, 0x00, 0x00, 0xad, 0xee, 0x05,
+ 0x97, 0x01, 0xf0, 0xeb, 0xca, 0xe3, 0xa7, 0xee,
+ 0x17, 0x5e, 0x04, 0x00, 0xca, 0x47, 0x04, 0xf2,
+ 0x01, 0x00, 0x00, 0xad, 0xee, 0x0a, 0x04, 0x1b,
+ 0x00, 0x00, 0x00, 0x5f, 0x07, 0x00, 0x29, 0x5e,
+ 0x09, 0x00, 0x42, 0xe3, 0x01, 0x00, 0x00, 0xc9,
+ 0x24, 0x01, 0x00, 0xb9, 0xaa, 0xee, 0x0a, 0x04,
+ 0x0f, 0x01, 0x00, 0x00, 0x5f, 0x07, 0x00, 0x29,
+ 0x04, 0x10, 0x01, 0x00, 0x00, 0x5f, 0x07, 0x00,
+ 0xb9, 0xe5, 0x29, 0x0e, 0x43, 0x02, 0x03, 0x84,
+ 0x0a, 0x02, 0x00, 0x02, 0x03, 0x02, 0x00, 0x2b,
+ 0x00, 0x00, 0x09, 0x01, 0x00, 0x04, 0x01, 0xe1,
+ 0xed, 0xd5, 0xa7, 0xee, 0x12, 0xe1, 0x42, 0x86,
+ 0x01, 0x00, 0x00, 0x04, 0x16, 0x00, 0x00, 0x00,
+ 0x24, 0x01, 0x00, 0x0e, 0xf0, 0xea, 0xe1, 0xed,
+ 0xd6, 0xa7, 0xee, 0x0e, 0xe1, 0x42, 0x86, 0x01,
+ 0x00, 0x00, 0xe2, 0x24, 0x01, 0x00, 0x0e, 0xf0,
+ 0xee, 0x29,
+};
+
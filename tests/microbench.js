@@ -626,6 +626,53 @@ function set_collection_add(n)
     return n * len;
 }
 
+var json_long_keys_text;
+
+/* atom hashing of long property names */
+function json_parse_long_keys(n)
+{
+    var i, j, obj, len = 20;
+    if (!json_long_keys_text) {
+        obj = {};
+        for(i = 0; i < len; i++)
+            obj["a_rather_long_property_name_for_hashing_" + i] = i;
+        json_long_keys_text = JSON.stringify(obj);
+    }
+    for(j = 0; j < n; j++) {
+        global_res = JSON.parse(json_long_keys_text);
+    }
+    return n * len;
+}
+
+var colliding_keys;
+
+/* Map keys which all have the same hash with the h = h * 263 + c
+   string hash */
+function map_colliding_keys(n)
+{
+    var m, i, j, k, s, len = 1024;
+    if (!colliding_keys) {
+        colliding_keys = [];
+        for(i = 0; i < len; i++) {
+            s = "";
+            for(k = 0; k < 10; k++)
+                s += (i >> k) & 1 ? "b\u00f9" : "a\u0200";
+            colliding_keys.push(s);
+        }
+    }
+    for(j = 0; j < n; j++) {
+        m = new Map();
+        for(i = 0; i < len; i++) {
+            m.set(colliding_keys[i], i);
+        }
+        for(i = 0; i < len; i++) {
+            if (m.get(colliding_keys[i]) !== i)
+                throw Error("bug in Map");
+        }
+    }
+    return n * len;
+}
+
 function array_for(n)
 {
     var r, i, j, sum;
@@ -979,6 +1026,8 @@ function main(argc, argv, g)
         int_arith,
         float_arith,
         set_collection_add,
+        json_parse_long_keys,
+        map_colliding_keys,
         array_for,
         array_for_in,
         array_for_of,
@@ -0,0 +1,671 @@
+/*
+ * QuickJS: C API tests
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#if defined(__linux__)
+#include <sys/resource.h>
+#endif
+
+#include "../quickjs-libc.h"
+#include "../cutils.h"
+
+#define assert(cond) do {                                               \
+        if (!(cond)) {                                                  \
+            fprintf(stderr, "%s:%d: assertion failed: %s\n",            \
+                    __FILE__, __LINE__, #cond);                         \
+            exit(1);                                                    \
+        }                                                               \
+    } while (0)
+
+/* evaluate 'str' and return its result as a boolean. Exit if an
+   exception is raised. */
+static int eval_bool(JSContext *ctx, const char *str)
+{
+    JSValue val;
+    int ret;
+
+    val = JS_Eval(ctx, str, strlen(str), "<test>", JS_EVAL_TYPE_GLOBAL);
+    if (JS_IsException(val)) {
+        JSValue exc = JS_GetException(ctx);
+        const char *msg = JS_ToCString(ctx, exc);
+        fprintf(stderr, "exception: %s\n", msg ? msg : "?");
+        exit(1);
+    }
+    ret = JS_ToBool(ctx, val);
+    JS_FreeValue(ctx, val);
+    return ret;
+}
+
+static void test_context_memory(void)
+{
+    JSRuntime *rt;
+    JSContext *ctx1, *ctx2;
+    JSClassDef class_def;
+    JSClassID class_id;
+    int64_t usage1, usage2;
+    int i;
+
+    /* not available without JS_RUNTIME_CONTEXT_MEMORY */
+    rt = JS_NewRuntime();
+    ctx1 = JS_NewContext(rt);
+    assert(JS_GetContextMemoryUsage(ctx1) == -1);
+    assert(JS_SetContextMemoryLimit(ctx1, 1 << 20, 1 << 20) == -1);
+    JS_FreeContext(ctx1);
+    JS_FreeRuntime(rt);
+
+    rt = JS_NewRuntime3(NULL, NULL, JS_RUNTIME_CONTEXT_MEMORY);
+    assert(rt != NULL);
+    ctx1 = JS_NewContext(rt);
+    ctx2 = JS_NewContext(rt);
+    usage1 = JS_GetContextMemoryUsage(ctx1);
+    usage2 = JS_GetContextMemoryUsage(ctx2);
+    assert(usage1 > 0 && usage2 > 0);
+
+    /* the allocations of a context are charged to it */
+    assert(eval_bool(ctx1, "globalThis.s = 'x'.repeat(1 << 20); true"));
+    assert(JS_GetContextMemoryUsage(ctx1) >= usage1 + (1 << 20));
+    assert(JS_GetContextMemoryUsage(ctx2) == usage2);
+    assert(eval_bool(ctx1, "delete globalThis.s"));
+    JS_RunGC(rt);
+    assert(JS_GetContextMemoryUsage(ctx1) < usage1 + 4096);
+
+    /* the blocks keep the alignment of malloc() */
+    for(i = 1; i < 200; i += 7) {
+        void *ptr = js_malloc(ctx1, i);
+        assert(ptr != NULL && ((uintptr_t)ptr % (2 * sizeof(void *))) == 0);
+        ptr = js_realloc(ctx1, ptr, i * 100);
+        assert(ptr != NULL && ((uintptr_t)ptr % (2 * sizeof(void *))) == 0);
+        js_free(ctx1, ptr);
+    }
+
+    /* the allocations made without a context are not charged to the
+       context which allocated last. Only the class prototype arrays of
+       the contexts grow. */
+    usage1 = JS_GetContextMemoryUsage(ctx1);
+    assert(eval_bool(ctx2, "globalThis.o = { a: 1 }; true"));
+    usage2 = JS_GetContextMemoryUsage(ctx2);
+    memset(&class_def, 0, sizeof(class_def));
+    class_def.class_name = "Test";
+    for(i = 0; i < 100; i++) {
+        class_id = 0;
+        JS_NewClassID(&class_id);
+        assert(JS_NewClass(rt, class_id, &class_def) == 0);
+    }
+    assert(JS_GetContextMemoryUsage(ctx2) - usage2 ==
+           JS_GetContextMemoryUsage(ctx1) - usage1);
+
+    /* above the soft limit, the context gets a catchable error */
+    usage1 = JS_GetContextMemoryUsage(ctx1);
+    assert(JS_SetContextMemoryLimit(ctx1, usage1 + (1 << 20),
+                                    usage1 + (2 << 20)) == 0);
+    assert(eval_bool(ctx1,
+                     "var a = [], ok = false;"
+                     "try {"
+                     "    for(;;) a.push('x'.repeat(1000) + a.length);"
+                     "} catch(e) {"
+                     "    ok = (e instanceof InternalError);"
+                     "}"
+                     "a = null;"
+                     "ok"));
+    assert(JS_GetContextMemoryUsage(ctx1) <= usage1 + (2 << 20));
+    /* the context can still run after the error */
+    JS_RunGC(rt);
+    assert(eval_bool(ctx1, "'abc'.repeat(1000).length === 3000"));
+
+    /* the other contexts are not limited */
+    assert(eval_bool(ctx2, "globalThis.s = 'x'.repeat(4 << 20); true"));
+    assert(JS_GetContextMemoryUsage(ctx2) >= usage2 + (4 << 20));
+
+    JS_FreeContext(ctx1);
+    JS_FreeContext(ctx2);
+    JS_FreeRuntime(rt);
+}
+
+static int64_t get_malloc_size(JSRuntime *rt)
+{
+    JSMemoryUsage mu;
+    JS_ComputeMemoryUsage(rt, &mu);
+    return mu.malloc_size;
+}
+
+/* evaluate 'str' in a new arena context, then check that the arena is
+   released when the context is freed */
+static void test_arena_release(JSRuntime *rt, JSContext *ctx,
+                               const char *str, const char *str2)
+{
+    JSContext *actx;
+    int64_t size0;
+
+    size0 = get_malloc_size(rt);
+    actx = JS_NewArenaContext(rt, 1 << 20);
+    assert(actx != NULL);
+    assert(eval_bool(actx, str));
+    assert(eval_bool(ctx, str2));
+    JS_FreeContext(actx);
+    JS_RunGC(rt);
+    assert(get_malloc_size(rt) < size0 + (1 << 19));
+}
+
+static void test_arena_context(void)
+{
+    JSRuntime *rt;
+    JSContext *ctx, *actx;
+    int64_t usage;
+
+    /* not available without JS_RUNTIME_CONTEXT_MEMORY */
+    rt = JS_NewRuntime();
+    assert(JS_NewArenaContext(rt, 0) == NULL);
+    JS_FreeRuntime(rt);
+
+    rt = JS_NewRuntime3(NULL, NULL, JS_RUNTIME_CONTEXT_MEMORY);
+    ctx = JS_NewContext(rt);
+
+    /* the usage counts the chunks: the freed blocks are not reused so
+       they are still counted */
+    actx = JS_NewArenaContext(rt, 64 * 1024);
+    assert(actx != NULL);
+    usage = JS_GetContextMemoryUsage(actx);
+    assert(usage >= 64 * 1024);
+    assert(eval_bool(actx,
+                     "var a = [];"
+                     "for(var i = 0; i < 10000; i++) {"
+                     "    a.push({ x: i });"
+                     "    if (a.length > 10) a.shift();"
+                     "}"
+                     "a = null; true"));
+    JS_RunGC(rt);
+    assert(JS_GetContextMemoryUsage(actx) >= usage + (256 << 10));
+
+    /* so the limits bound the arena */
+    usage = JS_GetContextMemoryUsage(actx);
+    assert(JS_SetContextMemoryLimit(actx, usage + (1 << 20),
+                                    usage + (2 << 20)) == 0);
+    assert(eval_bool(actx,
+                     "var ok = false;"
+                     "try {"
+                     "    for(;;) { a = [ a, { x: 1 } ]; a = a[1]; }"
+                     "} catch(e) {"
+                     "    ok = (e instanceof InternalError);"
+                     "}"
+                     "ok"));
+    assert(JS_GetContextMemoryUsage(actx) <= usage + (2 << 20));
+    JS_FreeContext(actx);
+    JS_RunGC(rt);
+
+    /* the atoms and the shapes created by an arena context do not
+       keep its arena alive when another context uses them */
+    test_arena_release(rt, ctx,
+                       "globalThis.o = {}; o['key' + 123] = 1; true",
+                       "globalThis.o1 = { key123: 1 }; true");
+    test_arena_release(rt, ctx,
+                       "var o = Object.create(null); o.length = 1; true",
+                       "var o2 = Object.create(null); o2.length = 1; true");
+
+    JS_FreeContext(ctx);
+    JS_FreeRuntime(rt);
+}
+
+static void *test_malloc(JSMallocState *s, size_t size)
+{
+    return malloc(size);
+}
+
+static void test_free(JSMallocState *s, void *ptr)
+{
+    free(ptr);
+}
+
+static void *test_realloc(JSMallocState *s, void *ptr, size_t size)
+{
+    return realloc(ptr, size);
+}
+
+static const JSMallocFunctions test_malloc_funcs = {
+    test_malloc,
+    test_free,
+    test_realloc,
+    NULL,
+};
+
+static void test_background_free1(JSRuntime *rt)
+{
+    JSContext *ctx;
+    int64_t size0;
+    int i;
+
+    assert(JS_SetBackgroundFree(rt, TRUE) == 0);
+    assert(JS_SetBackgroundFree(rt, TRUE) == 0);
+    ctx = JS_NewContext(rt);
+    size0 = get_malloc_size(rt);
+
+    /* the memory usage is updated when the blocks are queued, so the
+       memory limit is not reached */
+    JS_SetMemoryLimit(rt, size0 + (48 << 20));
+    for(i = 0; i < 20; i++) {
+        assert(eval_bool(ctx,
+                         "var b = new ArrayBuffer(16 << 20);"
+                         "new Uint8Array(b).fill(1);"
+                         "b = null; true"));
+        assert(eval_bool(ctx,
+                         "var a = [];"
+                         "for(var i = 0; i < 20000; i++)"
+                         "    a.push({ x: i, s: 'a' + i });"
+                         "a = null; true"));
+    }
+    JS_RunGC(rt);
+    assert(get_malloc_size(rt) < size0 + (1 << 20));
+    JS_SetMemoryLimit(rt, -1);
+
+    /* cycles are released by the cycle collector */
+    assert(eval_bool(ctx,
+                     "var a = [];"
+                     "for(var i = 0; i < 20000; i++) {"
+                     "    var o = { s: 'x'.repeat(100) };"
+                     "    o.self = o;"
+                     "    a.push(o);"
+                     "}"
+                     "a = o = null; true"));
+    JS_RunGC(rt);
+    assert(get_malloc_size(rt) < size0 + (1 << 20));
+
+    /* disable then enable again */
+    assert(JS_SetBackgroundFree(rt, FALSE) == 0);
+    assert(JS_SetBackgroundFree(rt, FALSE) == 0);
+    assert(eval_bool(ctx, "var b = new ArrayBuffer(1 << 20); b = null; true"));
+    assert(JS_SetBackgroundFree(rt, TRUE) == 0);
+
+    /* the runtime is freed with pending blocks */
+    assert(eval_bool(ctx, "globalThis.b = new ArrayBuffer(1 << 20); true"));
+    JS_FreeContext(ctx);
+    JS_FreeRuntime(rt);
+}
+
+static void test_background_free(void)
+{
+    JSRuntime *rt;
+
+    /* custom allocators are not supported */
+    rt = JS_NewRuntime2(&test_malloc_funcs, NULL);
+    assert(JS_SetBackgroundFree(rt, TRUE) == -1);
+    assert(JS_SetBackgroundFree(rt, FALSE) == 0);
+    JS_FreeRuntime(rt);
+
+    rt = JS_NewRuntime();
+    if (JS_SetBackgroundFree(rt, TRUE) < 0) {
+        /* not supported on this platform */
+        JS_FreeRuntime(rt);
+        return;
+    }
+    test_background_free1(rt);
+    test_background_free1(JS_NewRuntime3(NULL, NULL,
+                                         JS_RUNTIME_CONTEXT_MEMORY));
+}
+
+/* small substrings do not keep a large string alive */
+static void test_string_slice(void)
+{
+    JSRuntime *rt;
+    JSContext *ctx;
+    int64_t size0;
+
+    rt = JS_NewRuntime();
+    ctx = JS_NewContext(rt);
+    size0 = get_malloc_size(rt);
+    assert(eval_bool(ctx,
+                     "var s = 'abcdefgh'.repeat(1 << 17), a = [];"
+                     "for(var i = 0; i < 6000; i++)"
+                     "    a.push(s.substring(i * 64, i * 64 + 64));"
+                     "s = null; true"));
+    JS_RunGC(rt);
+    assert(get_malloc_size(rt) < size0 + (1 << 20));
+    assert(eval_bool(ctx,
+                     "a.every((t) => t === 'abcdefgh'.repeat(8))"));
+    JS_FreeContext(ctx);
+    JS_FreeRuntime(rt);
+}
+
+/* the predefined atoms are shared by the runtimes, which have their
+   own hash seed */
+static void test_atom_hash(void)
+{
+    JSRuntime *rt[2];
+    JSContext *ctx[2];
+    JSAtom atom, atom1;
+    JSValue str;
+    int i;
+
+    for(i = 0; i < 2; i++) {
+        rt[i] = JS_NewRuntime();
+        ctx[i] = JS_NewContext(rt[i]);
+    }
+    for(i = 0; i < 2; i++) {
+        atom = JS_NewAtom(ctx[i], "length");
+        str = JS_NewString(ctx[i], "length");
+        atom1 = JS_ValueToAtom(ctx[i], str);
+        assert(atom == atom1);
+        JS_FreeAtom(ctx[i], atom);
+        JS_FreeAtom(ctx[i], atom1);
+        JS_FreeValue(ctx[i], str);
+        assert(eval_bool(ctx[i],
+                         "var name = 'len' + 'gth', o = {}, m = new Map();"
+                         "o[name] = 1;"
+                         "m.set(Object.keys({ constructor: 1 })[0], 2);"
+                         "m.set('a' + 'b', 3);"
+                         "o.length === 1 && [].hasOwnProperty(name) &&"
+                         "m.get('constr' + 'uctor') === 2 && m.get('ab') === 3 &&"
+                         "new Set(['length', name]).size === 1"));
+    }
+    for(i = 0; i < 2; i++) {
+        JS_FreeContext(ctx[i]);
+        JS_FreeRuntime(rt[i]);
+    }
+}
+
+static void test_weak_ref_keep(void)
+{
+    JSRuntime *rt;
+    JSContext *ctx, *ctx1;
+    int64_t size0;
+
+    rt = JS_NewRuntime();
+    ctx = JS_NewContext(rt);
+    assert(eval_bool(ctx,
+                     "var a = { }, b = { };"
+                     "var r = [new WeakRef(a), new WeakRef(b)];"
+                     "a = b = null; true"));
+    size0 = get_malloc_size(rt);
+    /* the targets are only kept once */
+    assert(eval_bool(ctx,
+                     "for(var i = 0; i < 100000; i++)"
+                     "    r[i & 1].deref();"
+                     "true"));
+    assert(get_malloc_size(rt) < size0 + 4096);
+    /* released at the end of the job sequence */
+    assert(JS_ExecutePendingJob(rt, &ctx1) == 0);
+    JS_RunGC(rt);
+    assert(eval_bool(ctx,
+                     "r[0].deref() === undefined && "
+                     "r[1].deref() === undefined"));
+    JS_FreeContext(ctx);
+    JS_FreeRuntime(rt);
+}
+
+static int ext_free_count;
+
+static void ext_free(JSRuntime *rt, void *opaque, void *ptr)
+{
+    assert(ptr == opaque);
+    ext_free_count++;
+}
+
+/* compare operations on the external string 's' and on its flat copy
+   't' */
+static void test_external_string1(JSContext *ctx, JSValue str)
+{
+    JSValue global = JS_GetGlobalObject(ctx);
+
+    JS_SetPropertyStr(ctx, global, "s", str);
+    JS_FreeValue(ctx, global);
+    assert(eval_bool(ctx,
+                     "var t = s.split('').join(''), o = {};"
+                     "o[s] = 1;"
+                     "s === t && s.length === t.length && o[t] === 1"));
+    /* nested slices */
+    assert(eval_bool(ctx,
+                     "var s1 = s.slice(2), t1 = t.slice(2);"
+                     "var s2 = s1.slice(3, 45), t2 = t1.slice(3, 45);"
+                     "var s3 = s2.substring(1, 40);"
+                     "s1 === t1 && s2 === t2 && s3 === t2.substring(1, 40) &&"
+                     "s3.charCodeAt(0) === t.charCodeAt(6)"));
+    /* regexp and concatenation */
+    assert(eval_bool(ctx,
+                     "var m = /ext(ernal)? (\\S+)/.exec(s2);"
+                     "m[2] === /ext(ernal)? (\\S+)/.exec(t2)[2] &&"
+                     "s.replace(/e/g, 'E') === t.replace(/e/g, 'E') &&"
+                     "s2 + s3 + '!' === t2 + t2.substring(1, 40) + '!' &&"
+                     "'>' + s1 === '>' + t1 &&"
+                     "s.split(' ').join() === t.split(' ').join()"));
+    /* the characters are released when the last slice is freed */
+    assert(eval_bool(ctx, "delete globalThis.s; s1 = s2 = null; true"));
+    JS_RunGC(JS_GetRuntime(ctx));
+    assert(ext_free_count == 0);
+    assert(eval_bool(ctx, "s3 = m = null; true"));
+    JS_RunGC(JS_GetRuntime(ctx));
+    assert(ext_free_count == 1);
+}
+
+static void test_external_string(void)
+{
+    static const char str8[] =
+        "the characters of an external \xe9string are owned by the host";
+    static uint16_t str16[sizeof(str8) - 1];
+    JSRuntime *rt;
+    JSContext *ctx;
+    JSValue val;
+    int i;
+
+    rt = JS_NewRuntime();
+    ctx = JS_NewContext(rt);
+
+    ext_free_count = 0;
+    val = JS_NewExternalString8(ctx, (const uint8_t *)str8, strlen(str8),
+                                ext_free, (void *)str8);
+    assert(!JS_IsException(val));
+    test_external_string1(ctx, val);
+
+    for(i = 0; i < countof(str16); i++)
+        str16[i] = (uint8_t)str8[i] + (str8[i] == 'h' ? 0x100 : 0);
+    ext_free_count = 0;
+    val = JS_NewExternalString16(ctx, str16, countof(str16),
+                                 ext_free, str16);
+    assert(!JS_IsException(val));
+    test_external_string1(ctx, val);
+
+    JS_FreeContext(ctx);
+    JS_FreeRuntime(rt);
+}
+
+/* return a context in a new runtime with the 'os' module */
+static JSContext *new_os_context(void)
+{
+    JSRuntime *rt;
+    JSContext *ctx;
+
+    rt = JS_NewRuntime();
+    assert(rt != NULL);
+    js_std_init_handlers(rt);
+    JS_SetModuleLoaderFunc(rt, NULL, js_module_loader, NULL);
+    ctx = JS_NewContext(rt);
+    assert(ctx != NULL);
+    assert(js_init_module_os(ctx, "os") != NULL);
+    return ctx;
+}
+
+static void free_os_context(JSContext *ctx)
+{
+    JSRuntime *rt = JS_GetRuntime(ctx);
+    js_std_free_handlers(rt);
+    JS_FreeContext(ctx);
+    JS_FreeRuntime(rt);
+}
+
+static const char sched_script[] =
+    "import * as os from 'os';\n"
+    "var fds = os.pipe(), n = 0, buf = new Uint8Array(1);\n"
+    "globalThis.high_fd = (fds[0] >= 1024);\n"
+    "function write() {\n"
+    "    os.setTimeout(() => os.write(fds[1], buf.buffer, 0, 1), 1);\n"
+    "}\n"
+    "os.setReadHandler(fds[0], () => {\n"
+    "    os.read(fds[0], buf.buffer, 0, 1);\n"
+    "    if (++n < 10) {\n"
+    "        write();\n"
+    "    } else {\n"
+    "        os.setReadHandler(fds[0], null);\n"
+    "        os.close(fds[0]);\n"
+    "        os.close(fds[1]);\n"
+    "        globalThis.result = n;\n"
+    "    }\n"
+    "});\n"
+    "write();\n";
+
+/* run the event loops of many runtimes using timers and pipes. The
+   descriptors are above FD_SETSIZE if the limits allow it. */
+static void test_scheduler(void)
+{
+    JSScheduler *s;
+    JSContext *ctx_tab[20];
+    JSValue val;
+    int i, fd, fd_count;
+    BOOL high_fd;
+
+    s = js_std_scheduler_new(3, 5, NULL, NULL);
+    if (!s)
+        return; /* not supported on this platform */
+
+    high_fd = FALSE;
+    fd_count = 0;
+#if defined(__linux__)
+    {
+        struct rlimit rl;
+        if (getrlimit(RLIMIT_NOFILE, &rl) == 0 && rl.rlim_max >= 2048) {
+            if (rl.rlim_cur < 2048) {
+                rl.rlim_cur = 2048;
+                setrlimit(RLIMIT_NOFILE, &rl);
+            }
+            /* use the descriptors below 1100 */
+            fd = open("/dev/null", O_RDONLY);
+            assert(fd >= 0);
+            while (fd < 1100) {
+                fd = dup(fd);
+                assert(fd >= 0);
+            }
+            fd_count = fd + 1;
+            high_fd = TRUE;
+        }
+    }
+#endif
+
+    for(i = 0; i < countof(ctx_tab); i++) {
+        ctx_tab[i] = new_os_context();
+        val = JS_Eval(ctx_tab[i], sched_script, strlen(sched_script),
+                      "<sched>", JS_EVAL_TYPE_MODULE);
+        assert(!JS_IsException(val));
+        JS_FreeValue(ctx_tab[i], val);
+        assert(js_std_scheduler_add(s, ctx_tab[i]) == 0);
+    }
+    js_std_scheduler_run(s);
+    js_std_scheduler_free(s);
+
+    for(i = 0; i < countof(ctx_tab); i++) {
+        JS_UpdateStackTop(JS_GetRuntime(ctx_tab[i]));
+        assert(eval_bool(ctx_tab[i], "globalThis.result === 10"));
+        if (high_fd)
+            assert(eval_bool(ctx_tab[i], "globalThis.high_fd"));
+        free_os_context(ctx_tab[i]);
+    }
+    for(fd = 3; fd < fd_count; fd++)
+        close(fd);
+}
+
+/* a context set up for hibernation: 'os' is in the baseline */
+static JSContext *new_hibernation_context(void)
+{
+    static const char str[] =
+        "import * as os from 'os'; globalThis.os = os;";
+    JSContext *ctx;
+    JSValue val;
+
+    ctx = new_os_context();
+    val = JS_Eval(ctx, str, strlen(str), "<init>", JS_EVAL_TYPE_MODULE);
+    assert(!JS_IsException(val));
+    JS_FreeValue(ctx, val);
+    js_std_loop(ctx);
+    assert(JS_SetHibernationBaseline(ctx) == 0);
+    return ctx;
+}
+
+static void test_hibernation(void)
+{
+    char filename[] = "/tmp/test_apiXXXXXX";
+    JSContext *ctx;
+    int fd;
+
+    fd = mkstemp(filename);
+    assert(fd >= 0);
+    close(fd);
+
+    ctx = new_hibernation_context();
+    assert(eval_bool(ctx,
+                     "var counter = { n: 1 }, log = [];"
+                     "function tick() { log.push(counter.n++); }"
+                     "var t1 = os.setTimeout(tick, 10);"
+                     "var t2 = os.setTimeout(() => log.push('t2'), 20);"
+                     "var handles = [t2, t2];"
+                     "let next = (function() {"
+                     "    var x = 5;"
+                     "    return () => x++;"
+                     "})();"
+                     "typeof t1 === 'object' && t1 !== t2"));
+    assert(js_std_hibernate_context(ctx, filename) == 0);
+    free_os_context(ctx);
+
+    ctx = new_hibernation_context();
+    assert(js_std_restore_context(ctx, filename) == 0);
+    /* the saved handles clear the restored timers and the new timers
+       get other identifiers */
+    assert(eval_bool(ctx,
+                     "os.clearTimeout(handles[0]);"
+                     "var t3 = os.setTimeout(() => log.push('t3'), 1);"
+                     "handles[1] === t2 && t3 !== t1 && t3 !== t2 &&"
+                     "next() === 5 && next() === 6"));
+    js_std_loop(ctx);
+    assert(eval_bool(ctx,
+                     "log.join() === 't3,1' && counter.n === 2"));
+    free_os_context(ctx);
+
+    /* restoring into a context using the same timer identifiers */
+    ctx = new_hibernation_context();
+    assert(eval_bool(ctx, "var t = os.setTimeout(() => {}, 1); true"));
+    assert(js_std_restore_context(ctx, filename) == -1);
+    JS_FreeValue(ctx, JS_GetException(ctx));
+    free_os_context(ctx);
+
+    unlink(filename);
+}
+
+int main(int argc, char **argv)
+{
+    test_context_memory();
+    test_arena_context();
+    test_background_free();
+    test_string_slice();
+    test_atom_hash();
+    test_weak_ref_keep();
+    test_external_string();
+    test_scheduler();
+    test_hibernation();
+    return 0;
+}
@@ -59,6 +59,18 @@ function test_function()
     g = constructor1.bind(null, 1);
     r = new g();
     assert(r.x, 1);
+
+    g = f.bind(1, 2).bind(3, 4);
+    assert(g.length, 0);
+    assert(g.name, "bound bound f");
+    assert(g(5), [1,2,4,5]);
+
+    function new_target() { return new.target; }
+    g = new_target.bind();
+    r = g.bind();
+    assert(new r() === new_target);
+    assert(Reflect.construct(r, [], g) === new_target);
+    assert(Reflect.construct(r, [], Array) === Array);
 }
 
 function test()
@@ -277,6 +289,39 @@ function test_string()
     assert("aaaa".split("aaaaa", 1), [ "aaaa" ]);
 
     assert(eval('"\0"'), "\0");
+
+    assert("ab".repeat(5), "ababababab");
+    assert("a\u0100".repeat(3), "a\u0100a\u0100a\u0100");
+    assert("-".repeat(0), "");
+    assert("1".padStart(8, "xyz"), "xyzxyzx1");
+    assert("1".padEnd(6, "\u0100b"), "1\u0100b\u0100b\u0100");
+    assert("\u0100".padStart(3, "*"), "**\u0100");
+    assert(["a", 1, null, "\u0100", undefined, "b"].join("--"),
+           "a--1----\u0100----b");
+    assert(["x", "y"].join("\u0100"), "x\u0100y");
+    assert("abcabc".replace("bc", "X"), "aXabc");
+    assert("abcabc".replace("bc", "[$&$$]"), "a[bc$]abc");
+    assert("abcabc".replace("bc", "\u0100"), "a\u0100abc");
+    assert("abcabc".replaceAll("bc", "$`"), "aaaabca");
+    assert("abcabc".replaceAll("b", ""), "acac");
+
+    /* substrings sharing the characters of a large string */
+    var s = "0123456789abcdef".repeat(8), a = [], o = {}, i, t;
+    for(i = 0; i < 7; i++)
+        a.push(s.substring(i * 16, i * 16 + 32));
+    t = a[6].slice(2, 20);
+    assert(a[6], "0123456789abcdef0123456789abcdef");
+    assert(t, "23456789abcdef0123");
+    assert(t.length, 18);
+    assert(t + "\u0100", "23456789abcdef0123\u0100");
+    o[a[5]] = 1;
+    assert(o["0123456789abcdef0123456789abcdef"], 1);
+    assert(Object.keys(o)[0] === a[6]);
+    s = "\u0100123456789abcdef".repeat(8);
+    t = s.substr(48, 40).slice(1);
+    assert(t, s.substring(49, 88));
+    assert(t.charCodeAt(15), 0x100);
+    assert(("  " + t + " ").trim().split("\u0100").length, 3);
 }
 
 function test_math()
@@ -570,6 +615,36 @@ function test_map()
     });
 
     assert(a.size, 0);
+
+    /* string keys with cached hashes */
+    a = new Map();
+    for(i = 0; i < 100; i++)
+        a.set("k" + i, i);
+    for(i = 0; i < 100; i++)
+        assert(a.get(["k", i].join("")), i);
+    v = "k1";
+    assert(a.get(v), 1);
+    v += "0";
+    assert(a.get(v), 10);
+    assert(v === "k" + 10, true);
+    assert(v === "k" + 11, false);
+}
+
+function test_promise()
+{
+    var then_count = 0, saved_then;
+
+    /* a patched 'then' must still be called. The results of the
+       combinators are checked in test_std.js. */
+    saved_then = Promise.prototype.then;
+    Promise.prototype.then = function (f, r) {
+        then_count++;
+        return saved_then.call(this, f, r);
+    };
+    Promise.all([1, 2]);
+    Promise.race([3]);
+    Promise.prototype.then = saved_then;
+    assert(then_count, 3);
 }
 
 function test_weak_map()
@@ -596,6 +671,53 @@ function test_weak_map()
     /* the WeakMap should be empty here */
 }
 
+function test_weak_ref()
+{
+    var o, w, fr, t, e;
+
+    o = { a: 1 };
+    w = new WeakRef(o);
+    assert(w.deref(), o);
+    assert(Object.prototype.toString.call(w), "[object WeakRef]");
+    o = null;
+    /* kept alive until the end of the current job */
+    assert(w.deref().a, 1);
+
+    try {
+        e = null;
+        new WeakRef(1);
+    } catch(err) {
+        e = err;
+    }
+    assert(e instanceof TypeError, true);
+
+    fr = new FinalizationRegistry(function (v) { });
+    assert(Object.prototype.toString.call(fr), "[object FinalizationRegistry]");
+    t = { };
+    o = { };
+    assert(fr.register(o, 1, t), undefined);
+    fr.register({ }, 2, t);
+    fr.register({ }, 3);
+    assert(fr.unregister(t), true);
+    assert(fr.unregister(t), false);
+    assert(fr.unregister(o), false);
+
+    try {
+        e = null;
+        fr.register(o, o);
+    } catch(err) {
+        e = err;
+    }
+    assert(e instanceof TypeError, true);
+    try {
+        e = null;
+        fr.register(o, 1, 2);
+    } catch(err) {
+        e = err;
+    }
+    assert(e instanceof TypeError, true);
+}
+
 function test_generator()
 {
     function *f() {
@@ -637,6 +759,51 @@ function test_generator()
     assert(v.value === undefined && v.done === true);
 }
 
+function test_proxy()
+{
+    var target, handler, p, err;
+
+    target = { a: 1 };
+    handler = { get: function(t, k) { return k === "a" ? 2 : t[k]; } };
+    p = new Proxy(target, handler);
+    assert(p.a, 2);
+    assert(p.b, undefined);
+
+    /* the trap lookups must follow the modifications of the handler */
+    handler.get = function(t, k) { return 3; };
+    assert(p.a, 3);
+    delete handler.get;
+    assert(p.a, 1);
+    assert("a" in p, true);
+    handler.has = function(t, k) { return k === "c"; };
+    assert("a" in p, false);
+    assert("c" in p, true);
+    Object.prototype.get = function(t, k) { return 4; };
+    try {
+        assert(p.a, 4);
+    } finally {
+        delete Object.prototype.get;
+    }
+    assert(p.a, 1);
+
+    /* trap defined in the prototype chain of the handler */
+    class Handler { get(t, k) { return 5; } }
+    p = new Proxy(target, new Handler());
+    assert(p.a, 5);
+
+    /* the invariants are still checked for non configurable properties */
+    Object.defineProperty(target, "d", { value: 1 });
+    p = new Proxy(target, { get: function(t, k) { return 6; } });
+    assert(p.a, 6);
+    err = false;
+    try {
+        p.d;
+    } catch(e) {
+        err = e instanceof TypeError;
+    }
+    assert(err);
+}
+
 test();
 test_function();
 test_enum();
@@ -651,5 +818,8 @@ test_date();
 test_regexp();
 test_symbol();
 test_map();
+test_promise();
 test_weak_map();
+test_weak_ref();
 test_generator();
+test_proxy();
@@ -191,6 +191,15 @@ function test_op2()
     a = {};
     assert((a instanceof Object), true, "instanceof");
     assert((a instanceof String), false, "instanceof");
+    /* the results must follow the prototype modifications */
+    Object.setPrototypeOf(a, String.prototype);
+    assert((a instanceof String), true, "instanceof");
+    Object.setPrototypeOf(String.prototype, null);
+    assert((a instanceof Object), false, "instanceof");
+    Object.setPrototypeOf(String.prototype, Object.prototype);
+    assert((a instanceof Object), true, "instanceof");
+    F.prototype = String.prototype;
+    assert((a instanceof F), true, "instanceof");
 
     assert((typeof 1), "number", "typeof");
     assert((typeof Object), "function", "typeof");
@@ -245,6 +254,35 @@ function test_arguments()
         assert(arguments[1], 3, "arguments");
     }
     f2(1, 3);
+
+    function f3(a) {
+        var b = arguments[0];
+        a = 2;
+        return b + arguments[0] + arguments.length;
+    }
+    assert(f3(1, 0), 5, "mapped arguments");
+
+    function f4(a) {
+        "use strict";
+        a = 2;
+        return arguments[0] + arguments.length;
+    }
+    assert(f4(1), 2, "unmapped arguments");
+
+    function f5(a) {
+        var args = arguments;
+        arguments[0] = 3;
+        arguments[2] = 4;
+        return a + args[0] + arguments[2] + arguments.length;
+    }
+    assert(f5(1, 2), 12, "arguments object");
+
+    function *g(a) {
+        yield arguments[1];
+        a = 3;
+        yield arguments[0];
+    }
+    assert([...g(1, 2)].join(), "2,3", "generator arguments");
 }
 
 function test_class()
@@ -304,6 +342,31 @@ function test_class()
     /* test class name scope */
     var E1 = class E { static F() { return E; } };
     assert(E1 === E1.F());
+
+    /* private fields at different property indexes */
+    class P {
+        #x;
+        constructor(x) { this.#x = x; }
+        #m() { return this.#x; }
+        get() { return this.#m(); }
+        set(v) { this.#x = v; }
+        static has(o) { try { o.#m(); return true; } catch(e) { return false; } }
+    }
+    class Q extends P {
+        constructor(x, n) {
+            super(x);
+            for(var i = 0; i < n; i++)
+                this["p" + i] = i;
+        }
+    }
+    var tab = [ new P(0), new Q(1, 3), new P(2), new Q(3, 10) ];
+    for(var i = 0; i < tab.length; i++) {
+        tab[i].set(tab[i].get() + 1);
+        assert(tab[i].get(), i + 1);
+        assert(P.has(tab[i]));
+    }
+    assert(P.has({}), false);
+    assert(P.has(new (class { #x = 1; #m() {} })()), false);
 };
 
 function test_template()
@@ -102,6 +102,38 @@ function test_operators_create() {
     r = ++a;
     assert(a.x === 3 && a.y === 4);
     assert(r === a);
+
+    /* the operator set can be replaced or removed */
+    var ops = Vec2.prototype[Symbol.operatorSet];
+    Vec2.prototype[Symbol.operatorSet] = Operators.create({
+        "+"(p1, p2) {
+            return p1.x + p2.x;
+        }
+    });
+    assert(a + b, 6);
+    delete Vec2.prototype[Symbol.operatorSet];
+    assert(a + b, "Vec2(3,4)Vec2(3,4)");
+    Vec2.prototype[Symbol.operatorSet] = ops;
+    r = a + b;
+    assert(r.x === 6 && r.y === 8);
+
+    /* the cached operator is not used once the shapes change */
+    var c = new Vec2(1, 2), d = new Vec2(3, 4);
+    for(var i = 0; i < 2; i++) {
+        r = c + d;
+        assert(r.x === 4 && r.y === 6);
+        ops = Operators.create({
+            "+"(p1, p2) {
+                return "own";
+            }
+        });
+        c[Symbol.operatorSet] = ops;
+        d[Symbol.operatorSet] = ops;
+        assert(c + d, "own");
+        assert(c + d, "own");
+        c = new Vec2(1, 2);
+        d = new Vec2(3, 4);
+    }
 }
 
 /* operators overloading thru inheritance */
@@ -58,6 +58,18 @@ function test_file1()
     for(i = 0; i < size; i++)
         assert(buf[i] === str.charCodeAt(i));
 
+    f.seek(6, std.SEEK_SET);
+    buf = new Uint8Array(16);
+    ret = f.readInto(buf.subarray(2, 7));
+    assert(ret === 5);
+    assert(String.fromCharCode.apply(null, buf.subarray(2, 7)), "world");
+    assert(f.readInto(buf) === 1);
+    assert(f.readInto(buf) === 0);
+
+    f.seek(6, std.SEEK_SET);
+    assert(f.readAsString(3), "wor");
+    assert(f.readAsString(), "ld\n");
+
     f.close();
 }
 
@@ -100,6 +112,22 @@ function test_getline()
     assert(f.eof());
     assert(line_count === lines.length);
 
+    f.seek(0, std.SEEK_SET);
+    line_count = 0;
+    for (line of f.lines()) {
+        assert(line, lines[line_count]);
+        line_count++;
+    }
+    assert(line_count === lines.length);
+
+    /* last line without line feed, long line */
+    f.seek(0, std.SEEK_SET);
+    f.puts("x".repeat(10000), "\nlast");
+    f.seek(0, std.SEEK_SET);
+    assert(f.getline(), "x".repeat(10000));
+    assert(f.getline(), "last");
+    assert(f.getline(), null);
+
     f.close();
 }
  
@@ -123,6 +151,24 @@ function test_popen()
     assert(str, content);
 
     os.remove(fname);
+
+    /* the size of a pipe is unknown */
+    f = std.popen("seq 1 10000", "r");
+    str = f.readAsString();
+    f.close();
+    assert(str.length, 48894);
+    assert(str.slice(-6), "10000\n");
+
+    /* the files of /proc have a zero size */
+    fname = "/proc/self/status";
+    if (os.stat(fname)[1] === 0) {
+        str = std.loadFile(fname);
+        assert(str.indexOf("Name:"), 0);
+        assert(str[str.length - 1], "\n");
+        f = std.open(fname, "r");
+        assert(f.readAsString().indexOf("Name:"), 0);
+        f.close();
+    }
 }
 
 function test_ext_json()
@@ -139,6 +185,68 @@ function test_ext_json()
     assert(JSON.stringify(obj), expected);
 }
 
+function json_parser_run(input, options, chunk_size)
+{
+    var p, res, i;
+    p = new std.JSONParser(options);
+    res = [];
+    for(i = 0; i < input.length; i += chunk_size)
+        res = res.concat(p.write(input.substring(i, i + chunk_size)));
+    return JSON.stringify(res.concat(p.end()));
+}
+
+function test_json_parser()
+{
+    var input, i, p, buf, res, err;
+
+    input = '[{"a":1,"b":"x\\"]}"},[2,[3]],"s\u00e9",1.5e3,true,null]';
+    for(i = 1; i < 8; i++) {
+        assert(json_parser_run(input, { depth: 1 }, i),
+               '[{"a":1,"b":"x\\"]}"},[2,[3]],"s\u00e9",1500,true,null]');
+    }
+    assert(json_parser_run(input, {}, 3), "[" + JSON.stringify(JSON.parse(input)) + "]");
+    assert(json_parser_run('{"n":1,"items":[{"id":1},{"id":2}]}', { depth: 2 }, 2),
+           '[["n",1],{"id":1},{"id":2}]');
+    input = '{"a":1,"b\\u00e9":[2,{"c":3}],"d":{}}';
+    for(i = 1; i < 8; i++) {
+        assert(json_parser_run(input, { depth: 1 }, i),
+               '[["a",1],["b\u00e9",[2,{"c":3}]],["d",{}]]');
+    }
+    assert(json_parser_run(input, { depth: 2 }, 3),
+           '[["a",1],2,{"c":3}]');
+    assert(json_parser_run('{a: 1, "b": [], }', { depth: 1, ext: true }, 2),
+           '[["a",1],["b",[]]]');
+    assert(json_parser_run('{"a":1}\n\n[2]\r\n3\n', { ndjson: true }, 2),
+           '[{"a":1},[2],3]');
+    assert(json_parser_run('[1, /* ] */ 2, // ]\n 3,]', { depth: 1, ext: true }, 2),
+           '[1,2,3]');
+
+    /* ArrayBuffer input, UTF-8 sequences split between chunks */
+    p = new std.JSONParser({ depth: 1 });
+    buf = new Uint8Array([0x5b, 0x22, 0xc3, 0xa9, 0x22, 0x2c, 0x31, 0x5d]).buffer;
+    res = p.write(buf, 0, 3);
+    assert(res.length, 0);
+    res = p.write(buf, 3);
+    assert(res.length, 2);
+    assert(res[0], "\u00e9");
+    assert(p.end().length, 0);
+
+    err = null;
+    try {
+        json_parser_run('[1 2]', { depth: 1 }, 1);
+    } catch(e) {
+        err = e;
+    }
+    assert(err instanceof SyntaxError);
+    err = null;
+    try {
+        json_parser_run('1 2', { ndjson: true }, 1);
+    } catch(e) {
+        err = e;
+    }
+    assert(err instanceof SyntaxError);
+}
+
 function test_os()
 {
     var fd, fpath, fname, fdir, buf, buf2, i, files, err, fdate, st, link_path;
@@ -258,9 +366,89 @@ function test_os_exec()
     assert(status & 0x7f, os.SIGQUIT);
 }
 
+function test_os_spawn()
+{
+    function to_str(buf) {
+        return String.fromCharCode.apply(null, new Uint8Array(buf));
+    }
+    function fail(e) {
+        print(e, e.stack);
+        std.exit(1);
+    }
+    
+    os.spawn(["sh", "-c", "echo $FOO; echo err >&2; exit 3"],
+             { env: { FOO: "hello" } }).then(function (r) {
+        assert(r.pid > 0);
+        assert(r.status, 3);
+        assert(to_str(r.stdout), "hello\n");
+        assert(to_str(r.stderr), "err\n");
+    }).catch(fail);
+
+    os.spawn(["head", "-c", "200000", "/dev/zero"], { stderr: 2 }).then(function (r) {
+        assert(r.status, 0);
+        assert(r.stdout.byteLength, 200000);
+        assert(r.stderr, undefined);
+    }).catch(fail);
+
+    os.spawn(["sh", "-c", "kill -9 $$"]).then(function (r) {
+        assert(r.status, -9);
+    }).catch(fail);
+
+    /* changing the ids needs the privileges */
+    if (os.exec(["sh", "-c", "test $(id -u) = 0"]) == 0) {
+        os.spawn(["sh", "-c", "id -u; id -g"], { uid: 65534, gid: 65533 }).then(function (r) {
+            assert(r.status, 0);
+            assert(to_str(r.stdout), "65534\n65533\n");
+        }).catch(fail);
+    }
+}
+
+/* run the qjs executable and return its exit status and error output */
+function exec_qjs(args)
+{
+    var [path, err] = os.readlink("/proc/self/exe");
+    var fds, pid, f, str, ret, status;
+    if (err)
+        path = "./qjs";
+    fds = os.pipe();
+    pid = os.exec([path].concat(args), { stderr: fds[1], block: false });
+    assert(pid >= 0);
+    os.close(fds[1]);
+    f = std.fdopen(fds[0], "r");
+    str = f.readAsString();
+    f.close();
+    [ret, status] = os.waitpid(pid, 0);
+    assert(ret, pid);
+    return [status, str];
+}
+
+function test_cpu_limit()
+{
+    var status, str, t;
+
+    function test(script) {
+        t = Date.now();
+        [status, str] = exec_qjs(["--std", "--cpu-limit", "0.2", "-e", script]);
+        assert(Date.now() - t < 5000);
+        assert(status & 0x7f, 0); /* exited */
+        assert(status >> 8, 1); /* exit code */
+        assert(str.indexOf("CPU time limit exceeded") >= 0, true, str);
+    }
+
+    test("for(;;);");
+    /* the error cannot be caught */
+    test("try { for(;;); } catch(e) {} std.exit(0);");
+    /* long running built-ins are interrupted */
+    test("/(a+)+b/.test('a'.repeat(40))");
+    test("'a'.repeat(1 << 20).indexOf('a'.repeat(1 << 19) + 'b')");
+
+    [status, str] = exec_qjs(["--cpu-limit", "10", "-e", "1 + 1"]);
+    assert(status, 0);
+}
+
 function test_timer()
 {
-    var th, i;
+    var th, i, err;
 
     /* just test that a timer can be inserted and removed */
     th = [];
@@ -268,6 +456,110 @@ function test_timer()
         th[i] = os.setTimeout(function () { }, 1000);
     for(i = 0; i < 3; i++)
         os.clearTimeout(th[i]);
+    /* clearing an expired timer is allowed, not clearing a non timer */
+    os.clearTimeout(th[0]);
+    err = null;
+    try {
+        os.clearTimeout(1);
+    } catch(e) {
+        err = e;
+    }
+    assert(err instanceof TypeError);
+}
+
+function test_finalization_registry()
+{
+    var held = [], refs = [], i, o;
+
+    /* the registry must stay reachable for the callbacks to be called */
+    globalThis.test_fr = new FinalizationRegistry(function (v) {
+        held.push(v);
+    });
+    for(i = 0; i < 4; i++) {
+        o = { id: i };
+        if (i & 1)
+            o.self = o; /* only freed by the cycle collector */
+        refs.push(new WeakRef(o));
+        test_fr.register(o, i, (i == 3) ? o : undefined);
+    }
+    o = null;
+    test_fr.register({ }, 4, refs);
+    test_fr.unregister(refs);
+
+    /* the exceptions of the timer handlers do not stop the test */
+    function check(f) {
+        return function () {
+            try {
+                f();
+            } catch(e) {
+                print(e, e.stack);
+                std.exit(1);
+            }
+        };
+    }
+
+    /* the targets are kept alive until the end of the job sequence */
+    os.setTimeout(check(function () {
+        std.gc();
+        for(i = 0; i < 4; i++)
+            assert(refs[i].deref(), undefined);
+        /* the cleanup callbacks are run as separate jobs */
+        os.setTimeout(check(function () {
+            assert(held.sort().join(","), "0,1,2,3");
+        }), 0);
+    }), 0);
+}
+
+function test_promise()
+{
+    var p, log = [], tests = [], n = 1000, tab = [], i;
+
+    function fail(e) {
+        print(e, e.stack);
+        std.exit(1);
+    }
+
+    p = [Promise.resolve(1), Promise.reject(2), new Promise(function (r) { r(3); })];
+    tests.push(Promise.all([p[2], p[0]]).then(function (v) {
+        assert(v.toString(), "3,1");
+        log.push("all");
+    }));
+    tests.push(Promise.allSettled(p).then(function (v) {
+        assert(v.length, 3);
+        assert(v[0].status === "fulfilled" && v[0].value === 1);
+        assert(v[1].status === "rejected" && v[1].reason === 2);
+        assert(v[2].value, 3);
+        log.push("allSettled");
+    }));
+    tests.push(Promise.race([p[1], p[0]]).then(function () {
+        throw Error("race resolved");
+    }, function (e) {
+        assert(e, 2);
+        log.push("race");
+    }));
+    tests.push(Promise.any([p[1], p[2]]).then(function (v) {
+        assert(v, 3);
+        log.push("any");
+    }));
+    tests.push(Promise.all([]).then(function (v) {
+        assert(v.length, 0);
+    }));
+
+    /* fan-out: the results keep the order of the inputs */
+    for(i = 0; i < n; i++)
+        tab.push((i & 1) ? Promise.resolve(i) : i);
+    tests.push(Promise.all(tab).then(function (v) {
+        assert(v.length, n);
+        for(i = 0; i < n; i++)
+            assert(v[i], i);
+        log.push("fan-out");
+    }));
+
+    /* the assertions run in promise jobs whose exceptions are only
+       printed, so the failures must exit explicitly */
+    Promise.all(tests).then(function () {
+        assert(log.join(), "all,allSettled,race,any,fan-out");
+    }).catch(fail);
 }
 
 test_printf();
@@ -277,5 +569,10 @@ test_getline();
 test_popen();
 test_os();
 test_os_exec();
+test_os_spawn();
+test_cpu_limit();
 test_timer();
 test_ext_json();
+test_json_parser();
+test_finalization_registry();
+test_promise();